@@ -0,0 +1,1061 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	andq $-1024, %rsp
+	movq %rbp, -1216(%rsp)
+	movq %rsp, %rbp
+	subq $1216, %rsp
+	movq %rbx, -1176(%rbp)
+	movq %r12, -1184(%rbp)
+	movq %r13, -1192(%rbp)
+	movq %r14, -1200(%rbp)
+	movq %r15, -1208(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "7 = constant(1)":
+	movl $1, %ebx
+	#instruction start "9 = if 2 7":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "12 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "13 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "14 = constant(12)":
+	movl $12, %r13d
+	#instruction start "15 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "16 = alloc with size 8":
+	leaq -520(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "17 = store 16 12, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "18 = alloc with size 8":
+	leaq -528(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "19 = store 18 13, state: 17":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "20 = alloc with size 4":
+	leaq -532(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "21 = store 20 14, state: 19":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "22 = alloc with size 8":
+	leaq -540(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "23 = store 22 15, state: 21":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "24 = constant(1)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "25 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "26 = load part address of 16 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "27 = proj0 26":
+	#instruction start "28 = proj1 26":
+	#instruction start "29 = load part address of 18 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "30 = proj0 29":
+	#instruction start "31 = proj1 29":
+	#instruction start "32 = load part address of 20 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "33 = proj0 32":
+	#instruction start "34 = proj1 32":
+	#instruction start "35 = load part address of 22 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "36 = proj0 35":
+	#instruction start "37 = proj1 35":
+	#instruction start "38 = allocate_call_stack 0":
+	#instruction start "39 = set_reg %rdi 28":
+	#instruction start "40 = set_reg %rsi 31 state: 39":
+	#instruction start "41 = set_reg %rdx 34 state: 40":
+	#instruction start "42 = set_reg %rcx 37 state: 41":
+	#instruction start "43 = set_reg %rax 25 state: 42":
+	#instruction start "44 = call 24":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "45 = proj0 44":
+	#instruction start "46 = proj1 44":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "47 = constant(1)":
+	movl $1, %ebx
+	#instruction start "49 = if 8 47":
+	#instruction start "57 = phi (region: 8) 3 45":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "52 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "53 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "54 = constant(13)":
+	movl $13, %r13d
+	#instruction start "55 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "56 = alloc with size 8":
+	leaq -548(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "58 = store 56 52, state: 57":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "59 = alloc with size 8":
+	leaq -556(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "60 = store 59 53, state: 58":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "61 = alloc with size 4":
+	leaq -560(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "62 = store 61 54, state: 60":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "63 = alloc with size 8":
+	leaq -568(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "64 = store 63 55, state: 62":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "65 = constant(1)":
+	leaq -64(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "66 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "67 = load part address of 56 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "68 = proj0 67":
+	#instruction start "69 = proj1 67":
+	#instruction start "70 = load part address of 59 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "71 = proj0 70":
+	#instruction start "72 = proj1 70":
+	#instruction start "73 = load part address of 61 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "74 = proj0 73":
+	#instruction start "75 = proj1 73":
+	#instruction start "76 = load part address of 63 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "77 = proj0 76":
+	#instruction start "78 = proj1 76":
+	#instruction start "79 = allocate_call_stack 0":
+	#instruction start "80 = set_reg %rdi 69":
+	#instruction start "81 = set_reg %rsi 72 state: 80":
+	#instruction start "82 = set_reg %rdx 75 state: 81":
+	#instruction start "83 = set_reg %rcx 78 state: 82":
+	#instruction start "84 = set_reg %rax 66 state: 83":
+	#instruction start "85 = call 65":
+	addq $0, %rsp
+	movq -72(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -64(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "86 = proj0 85":
+	#instruction start "87 = proj1 85":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "88 = alloc with size 1":
+	leaq -572(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "91 = constant(4)":
+	movq $4, %r12
+	#instruction start "92 = phi (region: 48) 57 86":
+	#instruction start "93 = 88 % 91":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	xorq %rdx, %rdx
+	divq %rcx
+	movq %rdx, %rax
+	movq %rax, %r13
+	#instruction start "94 = proj1 93":
+	#instruction start "95 = proj0 93":
+	#instruction start "96 = constant(0)":
+	movq $0, %rbx
+	#instruction start "97 = 95 == 96":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "99 = if 48 97":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "102 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "103 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "104 = constant(19)":
+	movl $19, %r13d
+	#instruction start "105 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "106 = alloc with size 8":
+	leaq -580(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "107 = store 106 102, state: 94":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "108 = alloc with size 8":
+	leaq -588(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "109 = store 108 103, state: 107":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "110 = alloc with size 4":
+	leaq -592(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "111 = store 110 104, state: 109":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "112 = alloc with size 8":
+	leaq -600(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "113 = store 112 105, state: 111":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "114 = constant(1)":
+	leaq -120(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "115 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "116 = load part address of 106 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "117 = proj0 116":
+	#instruction start "118 = proj1 116":
+	#instruction start "119 = load part address of 108 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "120 = proj0 119":
+	#instruction start "121 = proj1 119":
+	#instruction start "122 = load part address of 110 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "123 = proj0 122":
+	#instruction start "124 = proj1 122":
+	#instruction start "125 = load part address of 112 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "126 = proj0 125":
+	#instruction start "127 = proj1 125":
+	#instruction start "128 = allocate_call_stack 0":
+	#instruction start "129 = set_reg %rdi 118":
+	#instruction start "130 = set_reg %rsi 121 state: 129":
+	#instruction start "131 = set_reg %rdx 124 state: 130":
+	#instruction start "132 = set_reg %rcx 127 state: 131":
+	#instruction start "133 = set_reg %rax 115 state: 132":
+	#instruction start "134 = call 114":
+	addq $0, %rsp
+	movq -128(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -120(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "135 = proj0 134":
+	#instruction start "136 = proj1 134":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "89 = alloc with size 1":
+	leaq -768(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "137 = constant(256)":
+	movq $256, %r12
+	#instruction start "138 = phi (region: 98) 94 135":
+	#instruction start "139 = 89 % 137":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	xorq %rdx, %rdx
+	divq %rcx
+	movq %rdx, %rax
+	movq %rax, %r13
+	#instruction start "140 = proj1 139":
+	#instruction start "141 = proj0 139":
+	#instruction start "142 = constant(0)":
+	movq $0, %rbx
+	#instruction start "143 = 141 == 142":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "145 = if 98 143":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "148 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "149 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "150 = constant(20)":
+	movl $20, %r13d
+	#instruction start "151 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "152 = alloc with size 8":
+	leaq -776(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "153 = store 152 148, state: 140":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "154 = alloc with size 8":
+	leaq -784(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "155 = store 154 149, state: 153":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "156 = alloc with size 4":
+	leaq -788(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "157 = store 156 150, state: 155":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "158 = alloc with size 8":
+	leaq -796(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "159 = store 158 151, state: 157":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "160 = constant(1)":
+	leaq -176(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "161 = constant(0)":
+	leaq -184(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "162 = load part address of 152 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "163 = proj0 162":
+	#instruction start "164 = proj1 162":
+	#instruction start "165 = load part address of 154 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "166 = proj0 165":
+	#instruction start "167 = proj1 165":
+	#instruction start "168 = load part address of 156 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "169 = proj0 168":
+	#instruction start "170 = proj1 168":
+	#instruction start "171 = load part address of 158 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "172 = proj0 171":
+	#instruction start "173 = proj1 171":
+	#instruction start "174 = allocate_call_stack 0":
+	#instruction start "175 = set_reg %rdi 164":
+	#instruction start "176 = set_reg %rsi 167 state: 175":
+	#instruction start "177 = set_reg %rdx 170 state: 176":
+	#instruction start "178 = set_reg %rcx 173 state: 177":
+	#instruction start "179 = set_reg %rax 161 state: 178":
+	#instruction start "180 = call 160":
+	addq $0, %rsp
+	movq -184(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -176(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "181 = proj0 180":
+	#instruction start "182 = proj1 180":
+	#Block jump
+	jmp .L14
+.L13:
+	#Block jump elided
+.L14:
+	#instruction start "90 = alloc with size 1":
+	leaq -1024(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "183 = constant(1024)":
+	movq $1024, %r12
+	#instruction start "184 = phi (region: 144) 140 181":
+	#instruction start "185 = 90 % 183":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	xorq %rdx, %rdx
+	divq %rcx
+	movq %rdx, %rax
+	movq %rax, %r13
+	#instruction start "186 = proj1 185":
+	#instruction start "187 = proj0 185":
+	#instruction start "188 = constant(0)":
+	movq $0, %rbx
+	#instruction start "189 = 187 == 188":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "191 = if 144 189":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#instruction start "194 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "195 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "196 = constant(21)":
+	movl $21, %r13d
+	#instruction start "197 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "198 = alloc with size 8":
+	leaq -1032(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "199 = store 198 194, state: 186":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "200 = alloc with size 8":
+	leaq -1040(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "201 = store 200 195, state: 199":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "202 = alloc with size 4":
+	leaq -1044(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "203 = store 202 196, state: 201":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "204 = alloc with size 8":
+	leaq -1052(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "205 = store 204 197, state: 203":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "206 = constant(1)":
+	leaq -232(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "207 = constant(0)":
+	leaq -240(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "208 = load part address of 198 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "209 = proj0 208":
+	#instruction start "210 = proj1 208":
+	#instruction start "211 = load part address of 200 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "212 = proj0 211":
+	#instruction start "213 = proj1 211":
+	#instruction start "214 = load part address of 202 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "215 = proj0 214":
+	#instruction start "216 = proj1 214":
+	#instruction start "217 = load part address of 204 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "218 = proj0 217":
+	#instruction start "219 = proj1 217":
+	#instruction start "220 = allocate_call_stack 0":
+	#instruction start "221 = set_reg %rdi 210":
+	#instruction start "222 = set_reg %rsi 213 state: 221":
+	#instruction start "223 = set_reg %rdx 216 state: 222":
+	#instruction start "224 = set_reg %rcx 219 state: 223":
+	#instruction start "225 = set_reg %rax 207 state: 224":
+	#instruction start "226 = call 206":
+	addq $0, %rsp
+	movq -240(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -232(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "227 = proj0 226":
+	#instruction start "228 = proj1 226":
+	#Block jump
+	jmp .L17
+.L16:
+	#Block jump elided
+.L17:
+	#instruction start "229 = constant(9)":
+	movq $sc1, %rbx
+	#instruction start "230 = constant(4)":
+	movq $4, %r12
+	#instruction start "231 = phi (region: 190) 186 227":
+	#instruction start "232 = 229 % 230":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	xorq %rdx, %rdx
+	divq %rcx
+	movq %rdx, %rax
+	movq %rax, %r13
+	#instruction start "233 = proj1 232":
+	#instruction start "234 = proj0 232":
+	#instruction start "235 = constant(0)":
+	movq $0, %rbx
+	#instruction start "236 = 234 == 235":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "238 = if 190 236":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "241 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "242 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "243 = constant(23)":
+	movl $23, %r13d
+	#instruction start "244 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "245 = alloc with size 8":
+	leaq -1060(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "246 = store 245 241, state: 233":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "247 = alloc with size 8":
+	leaq -1068(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "248 = store 247 242, state: 246":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "249 = alloc with size 4":
+	leaq -1072(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "250 = store 249 243, state: 248":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "251 = alloc with size 8":
+	leaq -1080(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "252 = store 251 244, state: 250":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "253 = constant(1)":
+	leaq -288(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "254 = constant(0)":
+	leaq -296(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "255 = load part address of 245 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "256 = proj0 255":
+	#instruction start "257 = proj1 255":
+	#instruction start "258 = load part address of 247 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "259 = proj0 258":
+	#instruction start "260 = proj1 258":
+	#instruction start "261 = load part address of 249 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "262 = proj0 261":
+	#instruction start "263 = proj1 261":
+	#instruction start "264 = load part address of 251 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "265 = proj0 264":
+	#instruction start "266 = proj1 264":
+	#instruction start "267 = allocate_call_stack 0":
+	#instruction start "268 = set_reg %rdi 257":
+	#instruction start "269 = set_reg %rsi 260 state: 268":
+	#instruction start "270 = set_reg %rdx 263 state: 269":
+	#instruction start "271 = set_reg %rcx 266 state: 270":
+	#instruction start "272 = set_reg %rax 254 state: 271":
+	#instruction start "273 = call 253":
+	addq $0, %rsp
+	movq -296(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -288(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "274 = proj0 273":
+	#instruction start "275 = proj1 273":
+	#Block jump
+	jmp .L20
+.L19:
+	#Block jump elided
+.L20:
+	#instruction start "276 = constant(11)":
+	movq $sc2, %rbx
+	#instruction start "277 = constant(256)":
+	movq $256, %r12
+	#instruction start "278 = phi (region: 237) 233 274":
+	#instruction start "279 = 276 % 277":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	xorq %rdx, %rdx
+	divq %rcx
+	movq %rdx, %rax
+	movq %rax, %r13
+	#instruction start "280 = proj1 279":
+	#instruction start "281 = proj0 279":
+	#instruction start "282 = constant(0)":
+	movq $0, %rbx
+	#instruction start "283 = 281 == 282":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "285 = if 237 283":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "288 = constant(12)":
+	movq $.Ls12, %rbx
+	#instruction start "289 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "290 = constant(24)":
+	movl $24, %r13d
+	#instruction start "291 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "292 = alloc with size 8":
+	leaq -1088(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "293 = store 292 288, state: 280":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "294 = alloc with size 8":
+	leaq -1096(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "295 = store 294 289, state: 293":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "296 = alloc with size 4":
+	leaq -1100(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "297 = store 296 290, state: 295":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "298 = alloc with size 8":
+	leaq -1108(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "299 = store 298 291, state: 297":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "300 = constant(1)":
+	leaq -344(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "301 = constant(0)":
+	leaq -352(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "302 = load part address of 292 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "303 = proj0 302":
+	#instruction start "304 = proj1 302":
+	#instruction start "305 = load part address of 294 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "306 = proj0 305":
+	#instruction start "307 = proj1 305":
+	#instruction start "308 = load part address of 296 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "309 = proj0 308":
+	#instruction start "310 = proj1 308":
+	#instruction start "311 = load part address of 298 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "312 = proj0 311":
+	#instruction start "313 = proj1 311":
+	#instruction start "314 = allocate_call_stack 0":
+	#instruction start "315 = set_reg %rdi 304":
+	#instruction start "316 = set_reg %rsi 307 state: 315":
+	#instruction start "317 = set_reg %rdx 310 state: 316":
+	#instruction start "318 = set_reg %rcx 313 state: 317":
+	#instruction start "319 = set_reg %rax 301 state: 318":
+	#instruction start "320 = call 300":
+	addq $0, %rsp
+	movq -352(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -344(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "321 = proj0 320":
+	#instruction start "322 = proj1 320":
+	#Block jump
+	jmp .L23
+.L22:
+	#Block jump elided
+.L23:
+	#instruction start "323 = constant(0)":
+	movq $align_int, %rbx
+	#instruction start "324 = constant(4)":
+	movq $4, %r12
+	#instruction start "325 = phi (region: 284) 280 321":
+	#instruction start "326 = 323 % 324":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	xorq %rdx, %rdx
+	divq %rcx
+	movq %rdx, %rax
+	movq %rax, %r13
+	#instruction start "327 = proj1 326":
+	#instruction start "328 = proj0 326":
+	#instruction start "329 = constant(0)":
+	movq $0, %rbx
+	#instruction start "330 = 328 == 329":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "332 = if 284 330":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L25
+.L24:
+	#instruction start "335 = constant(13)":
+	movq $.Ls13, %rbx
+	#instruction start "336 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "337 = constant(25)":
+	movl $25, %r13d
+	#instruction start "338 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "339 = alloc with size 8":
+	leaq -1116(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "340 = store 339 335, state: 327":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "341 = alloc with size 8":
+	leaq -1124(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "342 = store 341 336, state: 340":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "343 = alloc with size 4":
+	leaq -1128(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "344 = store 343 337, state: 342":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "345 = alloc with size 8":
+	leaq -1136(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "346 = store 345 338, state: 344":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "347 = constant(1)":
+	leaq -400(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "348 = constant(0)":
+	leaq -408(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "349 = load part address of 339 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "350 = proj0 349":
+	#instruction start "351 = proj1 349":
+	#instruction start "352 = load part address of 341 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "353 = proj0 352":
+	#instruction start "354 = proj1 352":
+	#instruction start "355 = load part address of 343 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "356 = proj0 355":
+	#instruction start "357 = proj1 355":
+	#instruction start "358 = load part address of 345 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "359 = proj0 358":
+	#instruction start "360 = proj1 358":
+	#instruction start "361 = allocate_call_stack 0":
+	#instruction start "362 = set_reg %rdi 351":
+	#instruction start "363 = set_reg %rsi 354 state: 362":
+	#instruction start "364 = set_reg %rdx 357 state: 363":
+	#instruction start "365 = set_reg %rcx 360 state: 364":
+	#instruction start "366 = set_reg %rax 348 state: 365":
+	#instruction start "367 = call 347":
+	addq $0, %rsp
+	movq -408(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -400(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "368 = proj0 367":
+	#instruction start "369 = proj1 367":
+	#Block jump
+	jmp .L26
+.L25:
+	#Block jump elided
+.L26:
+	#instruction start "370 = alloc with size 4":
+	leaq -1140(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "371 = constant(4)":
+	movq $4, %r12
+	#instruction start "372 = phi (region: 331) 327 368":
+	#instruction start "373 = 370 % 371":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	xorq %rdx, %rdx
+	divq %rcx
+	movq %rdx, %rax
+	movq %rax, %r13
+	#instruction start "374 = proj1 373":
+	#instruction start "375 = proj0 373":
+	#instruction start "376 = constant(0)":
+	movq $0, %rbx
+	#instruction start "377 = 375 == 376":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "379 = if 331 377":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L28
+.L27:
+	#instruction start "382 = constant(14)":
+	movq $.Ls14, %rbx
+	#instruction start "383 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "384 = constant(28)":
+	movl $28, %r13d
+	#instruction start "385 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "386 = alloc with size 8":
+	leaq -1148(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "387 = store 386 382, state: 374":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "388 = alloc with size 8":
+	leaq -1156(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "389 = store 388 383, state: 387":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "390 = alloc with size 4":
+	leaq -1160(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "391 = store 390 384, state: 389":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "392 = alloc with size 8":
+	leaq -1168(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "393 = store 392 385, state: 391":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "394 = constant(1)":
+	leaq -456(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "395 = constant(0)":
+	leaq -464(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "396 = load part address of 386 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "397 = proj0 396":
+	#instruction start "398 = proj1 396":
+	#instruction start "399 = load part address of 388 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "400 = proj0 399":
+	#instruction start "401 = proj1 399":
+	#instruction start "402 = load part address of 390 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "403 = proj0 402":
+	#instruction start "404 = proj1 402":
+	#instruction start "405 = load part address of 392 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "406 = proj0 405":
+	#instruction start "407 = proj1 405":
+	#instruction start "408 = allocate_call_stack 0":
+	#instruction start "409 = set_reg %rdi 398":
+	#instruction start "410 = set_reg %rsi 401 state: 409":
+	#instruction start "411 = set_reg %rdx 404 state: 410":
+	#instruction start "412 = set_reg %rcx 407 state: 411":
+	#instruction start "413 = set_reg %rax 395 state: 412":
+	#instruction start "414 = call 394":
+	addq $0, %rsp
+	movq -464(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -456(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "415 = proj0 414":
+	#instruction start "416 = proj1 414":
+	#Block jump
+	jmp .L29
+.L28:
+	#Block jump elided
+.L29:
+	#instruction start "417 = constant(0)":
+	movl $0, %ebx
+	#instruction start "418 = set_reg %rax 417":
+	#instruction start "419 = phi (region: 378) 374 415":
+	#instruction start "420 = return 378, 418, 419":
+	movq %rbx, %rax
+	#Block return.
+	movq -1176(%rbp), %rbx
+	movq -1184(%rbp), %r12
+	movq -1192(%rbp), %r13
+	movq -1200(%rbp), %r14
+	movq -1208(%rbp), %r15
+	movq -1216(%rbp), %rbp
+	leave 
+	ret 
+.section .rodata
+.Ls2:
+	.string "_Alignof(i) == 4\000"
+.Ls3:
+	.string "tests/alignof.c\000"
+.Ls4:
+	.string "main"
+.Ls5:
+	.string "_Alignof(int) == 4\000"
+.Ls6:
+	.string "(uint64_t)(&c1) % _Alignof(int) == 0\000"
+.Ls7:
+	.string "(uint64_t)(&c2) % 256 == 0\000"
+.Ls8:
+	.string "(uint64_t)(&c3) % 1024 == 0\000"
+.Ls10:
+	.string "(uint64_t)(&sc1) % _Alignof(int) == 0\000"
+.Ls12:
+	.string "(uint64_t)(&sc2) % 256 == 0\000"
+.Ls13:
+	.string "(uint64_t)(&align_int) % _Alignof(int) == 0\000"
+.Ls14:
+	.string "(uint64_t)&a % _Alignof(int) == 0\000"
+.section .data
+.align 4
+.global align_int
+align_int:
+.byte 10
+.byte 0
+.byte 0
+.byte 0
+.section .text
+.section .data
+.align 256
+sc2:
+.zero 1
+.section .text
+.section .data
+.align 4
+sc1:
+.zero 1
+.section .text
@@ -0,0 +1,136 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rbx, -100(%rbp)
+	movq %r12, -108(%rbp)
+	movq %r13, -116(%rbp)
+	movq %r14, -124(%rbp)
+	movq %r15, -132(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(1)":
+	movl $1, %ebx
+	#instruction start "8 = if 2 6":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "11 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "12 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "13 = constant(9)":
+	movl $9, %r13d
+	#instruction start "14 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "15 = alloc with size 8":
+	leaq -72(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "16 = store 15 11, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "17 = alloc with size 8":
+	leaq -80(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "18 = store 17 12, state: 16":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "19 = alloc with size 4":
+	leaq -84(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "20 = store 19 13, state: 18":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "21 = alloc with size 8":
+	leaq -92(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "22 = store 21 14, state: 20":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "23 = constant(1)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "24 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "25 = load part address of 15 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "26 = proj0 25":
+	#instruction start "27 = proj1 25":
+	#instruction start "28 = load part address of 17 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "29 = proj0 28":
+	#instruction start "30 = proj1 28":
+	#instruction start "31 = load part address of 19 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "32 = proj0 31":
+	#instruction start "33 = proj1 31":
+	#instruction start "34 = load part address of 21 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "35 = proj0 34":
+	#instruction start "36 = proj1 34":
+	#instruction start "37 = allocate_call_stack 0":
+	#instruction start "38 = set_reg %rdi 27":
+	#instruction start "39 = set_reg %rsi 30 state: 38":
+	#instruction start "40 = set_reg %rdx 33 state: 39":
+	#instruction start "41 = set_reg %rcx 36 state: 40":
+	#instruction start "42 = set_reg %rax 24 state: 41":
+	#instruction start "43 = call 23":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "44 = proj0 43":
+	#instruction start "45 = proj1 43":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "46 = constant(0)":
+	movl $0, %ebx
+	#instruction start "47 = set_reg %rax 46":
+	#instruction start "48 = phi (region: 7) 3 44":
+	#instruction start "49 = return 7, 47, 48":
+	movq %rbx, %rax
+	#Block return.
+	movq -100(%rbp), %rbx
+	movq -108(%rbp), %r12
+	movq -116(%rbp), %r13
+	movq -124(%rbp), %r14
+	movq -132(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls2:
+	.string "sizeof arr == SIZE * sizeof (int)\000"
+.Ls3:
+	.string "tests/arr_size.c\000"
+.Ls4:
+	.string "main"
+.section .data
+.align 4
+.global arr
+arr:
+.quad 146028888075
+.quad 0
+.quad 0
+.quad 0
+.quad 0
+.section .text
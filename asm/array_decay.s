@@ -0,0 +1,405 @@
+.global func
+func:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movq %r13, -36(%rbp)
+	movq %r14, -44(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "7 = set_zero_ptr 6, size: 4":
+	movq %rbx, %rdi
+	movl $0, (%rdi)
+	#instruction start "8 = constant(0)":
+	movq $0, %r12
+	#instruction start "9 = 6 + 8":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "10 = constant(0)":
+	movq $0, %r12
+	#instruction start "11 = 9 + 10":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "12 = constant(1)":
+	movl $1, %r12d
+	#instruction start "13 = store 11 12, state: 7":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "14 = load 6, state: 13":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "15 = set_reg %rax 14":
+	#instruction start "16 = return 2, 15, 13":
+	movq %r12, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	movq -36(%rbp), %r13
+	movq -44(%rbp), %r14
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $240, %rsp
+	movq %rbx, -208(%rbp)
+	movq %r12, -216(%rbp)
+	movq %r13, -224(%rbp)
+	movq %r14, -232(%rbp)
+	movq %r15, -240(%rbp)
+.L3:
+	#instruction start "20 = proj3 18":
+	#instruction start "23 = constant(0)":
+	movq $func, %rbx
+	#instruction start "24 = constant(0)":
+	movq $0, %r12
+	#instruction start "25 = allocate_call_stack 0":
+	#instruction start "26 = set_reg %rax 24":
+	#instruction start "27 = call 23":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "28 = proj0 27":
+	#instruction start "29 = proj1 27":
+	#instruction start "30 = %rax":
+	#instruction start "31 = int_cast_zero 30":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "32 = alloc with size 4":
+	leaq -140(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "33 = store 32 31, state: 28":
+	movq %r12, %rsi
+	movl %ebx, (%rsi)
+	#instruction start "34 = constant(0)":
+	movq $0, %rbx
+	#instruction start "35 = 32 + 34":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "36 = constant(0)":
+	movl $0, %ebx
+	#instruction start "37 = int_cast_zero 36":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "38 = constant(4)":
+	movq $4, %rbx
+	#instruction start "39 = 37 * 38":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "40 = 35 + 39":
+	movq %r13, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "41 = load_volatile 40, state: 33":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "42 = proj0 41":
+	#instruction start "43 = proj1 41":
+	#instruction start "44 = constant(1)":
+	movl $1, %ebx
+	#instruction start "45 = 43 == 44":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "47 = if 19 45":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L5
+.L4:
+	#instruction start "50 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "51 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "52 = constant(12)":
+	movl $12, %r13d
+	#instruction start "53 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "54 = alloc with size 8":
+	leaq -148(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "55 = store 54 50, state: 42":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "56 = alloc with size 8":
+	leaq -156(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "57 = store 56 51, state: 55":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "58 = alloc with size 4":
+	leaq -160(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "59 = store 58 52, state: 57":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "60 = alloc with size 8":
+	leaq -168(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "61 = store 60 53, state: 59":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "62 = constant(1)":
+	leaq -16(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "63 = constant(0)":
+	leaq -24(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "64 = load part address of 54 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "65 = proj0 64":
+	#instruction start "66 = proj1 64":
+	#instruction start "67 = load part address of 56 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "68 = proj0 67":
+	#instruction start "69 = proj1 67":
+	#instruction start "70 = load part address of 58 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "71 = proj0 70":
+	#instruction start "72 = proj1 70":
+	#instruction start "73 = load part address of 60 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "74 = proj0 73":
+	#instruction start "75 = proj1 73":
+	#instruction start "76 = allocate_call_stack 0":
+	#instruction start "77 = set_reg %rdi 66":
+	#instruction start "78 = set_reg %rsi 69 state: 77":
+	#instruction start "79 = set_reg %rdx 72 state: 78":
+	#instruction start "80 = set_reg %rcx 75 state: 79":
+	#instruction start "81 = set_reg %rax 63 state: 80":
+	#instruction start "82 = call 62":
+	addq $0, %rsp
+	movq -24(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -16(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "83 = proj0 82":
+	#instruction start "84 = proj1 82":
+	#Block jump
+	jmp .L6
+.L5:
+	#Block jump elided
+.L6:
+	#instruction start "85 = constant(0)":
+	movq $func, %rbx
+	#instruction start "86 = constant(0)":
+	movq $0, %r12
+	#instruction start "87 = allocate_call_stack 0":
+	#instruction start "88 = set_reg %rax 86":
+	#instruction start "89 = phi (region: 46) 42 83":
+	#instruction start "90 = call 85":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "91 = proj0 90":
+	#instruction start "92 = proj1 90":
+	#instruction start "93 = %rax":
+	#instruction start "94 = int_cast_zero 93":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "95 = alloc with size 4":
+	leaq -172(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "96 = store 95 94, state: 91":
+	movq %r12, %rsi
+	movl %ebx, (%rsi)
+	#instruction start "97 = constant(0)":
+	movq $0, %rbx
+	#instruction start "98 = 95 + 97":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "99 = constant(0)":
+	movl $0, %ebx
+	#instruction start "100 = int_cast_zero 99":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "101 = constant(4)":
+	movq $4, %rbx
+	#instruction start "102 = 100 * 101":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "103 = 98 + 102":
+	movq %r13, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "104 = load_volatile 103, state: 96":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "105 = proj0 104":
+	#instruction start "106 = proj1 104":
+	#instruction start "107 = constant(1)":
+	movl $1, %r13d
+	#instruction start "108 = 106 + 107":
+	movq %r12, %rax
+	movq %r13, %rcx
+	addl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "109 = store 103 108, state: 105":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "110 = constant(2)":
+	movl $2, %ebx
+	#instruction start "111 = 108 == 110":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "113 = if 46 111":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L8
+.L7:
+	#instruction start "116 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "117 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "118 = constant(13)":
+	movl $13, %r13d
+	#instruction start "119 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "120 = alloc with size 8":
+	leaq -180(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "121 = store 120 116, state: 109":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "122 = alloc with size 8":
+	leaq -188(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "123 = store 122 117, state: 121":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "124 = alloc with size 4":
+	leaq -192(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "125 = store 124 118, state: 123":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "126 = alloc with size 8":
+	leaq -200(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "127 = store 126 119, state: 125":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "128 = constant(1)":
+	leaq -80(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "129 = constant(0)":
+	leaq -88(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "130 = load part address of 120 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "131 = proj0 130":
+	#instruction start "132 = proj1 130":
+	#instruction start "133 = load part address of 122 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "134 = proj0 133":
+	#instruction start "135 = proj1 133":
+	#instruction start "136 = load part address of 124 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "137 = proj0 136":
+	#instruction start "138 = proj1 136":
+	#instruction start "139 = load part address of 126 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "140 = proj0 139":
+	#instruction start "141 = proj1 139":
+	#instruction start "142 = allocate_call_stack 0":
+	#instruction start "143 = set_reg %rdi 132":
+	#instruction start "144 = set_reg %rsi 135 state: 143":
+	#instruction start "145 = set_reg %rdx 138 state: 144":
+	#instruction start "146 = set_reg %rcx 141 state: 145":
+	#instruction start "147 = set_reg %rax 129 state: 146":
+	#instruction start "148 = call 128":
+	addq $0, %rsp
+	movq -88(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -80(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "149 = proj0 148":
+	#instruction start "150 = proj1 148":
+	#Block jump
+	jmp .L9
+.L8:
+	#Block jump elided
+.L9:
+	#instruction start "151 = constant(0)":
+	movl $0, %ebx
+	#instruction start "152 = set_reg %rax 151":
+	#instruction start "153 = phi (region: 112) 109 149":
+	#instruction start "154 = return 112, 152, 153":
+	movq %rbx, %rax
+	#Block return.
+	movq -208(%rbp), %rbx
+	movq -216(%rbp), %r12
+	movq -224(%rbp), %r13
+	movq -232(%rbp), %r14
+	movq -240(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls2:
+	.string "func().a[0] == 1\000"
+.Ls3:
+	.string "tests/array_decay.c\000"
+.Ls4:
+	.string "main"
+.Ls5:
+	.string "++func().a[0] == 2\000"
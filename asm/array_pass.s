@@ -0,0 +1,472 @@
+.global expect
+expect:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movq %rbx, -36(%rbp)
+	movq %r12, -44(%rbp)
+	movq %r13, -52(%rbp)
+	movq %r14, -60(%rbp)
+	movq %r15, -68(%rbp)
+	movl %edi, %ebx
+	movl %esi, %r12d
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = %rsi":
+	#instruction start "8 = alloc with size 4":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "9 = alloc with size 4":
+	leaq -20(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "10 = store part of 8 with offset 0":
+	movq %r13, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "11 = store part of 9 with offset 0":
+	movq %r14, %rsi
+	leaq (%rsi), %rsi
+	movl %r12d, (%rsi)
+	#instruction start "14 = constant(291)":
+	leaq -4(%rbp), %rdi
+	movl $291, (%rdi)
+	#instruction start "16 = load 8, state: 11":
+	movq %r13, %rdi
+	movl (%rdi), %r12d
+	#instruction start "17 = load 9, state: 11":
+	movq %r14, %rdi
+	movl (%rdi), %r15d
+	#instruction start "18 = 16 == 17":
+	movq %r12, %rax
+	movq %r15, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "19 = if 2 18":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "25 = alloc with size 4":
+	leaq -24(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "26 = constant(1)":
+	movl $1, %r14d
+	#instruction start "27 = store 25 26, state: 11":
+	movq %r12, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 29 (28 22 25)
+	movq %r12, %rax
+	movq %rax, %r14
+	#Phi node to 186 (28 14 14)
+	movl -4(%rbp), %eax
+	movl %eax, %r15d
+	#Block jump
+	jmp .L5
+.L4:
+	#instruction start "22 = alloc with size 4":
+	leaq -28(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "23 = constant(0)":
+	movl $0, %ebx
+	#instruction start "24 = store 22 23, state: 11":
+	movq %r12, %rsi
+	movl %ebx, (%rsi)
+	#Phi node to 29 (28 22 25)
+	movq %r12, %rax
+	movq %rax, %r14
+	#Phi node to 186 (28 14 14)
+	movl -4(%rbp), %eax
+	movl %eax, %r15d
+	#Block jump elided
+.L5:
+	#instruction start "29 = phi (region: 28) 22 25":
+	#instruction start "30 = phi (region: 28) 24 27":
+	#instruction start "31 = load_volatile 29, state: 30":
+	movq %r14, %rdi
+	movl (%rdi), %ebx
+	#instruction start "32 = proj0 31":
+	#instruction start "33 = proj1 31":
+	#instruction start "34 = if 28 33":
+	#instruction start "186 = phi (region: 28) 14 14":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#Phi node to 182 (51 184 186)
+	movq %r15, %rax
+	movl %eax, %ebx
+	#Block jump
+	jmp .L11
+.L7:
+	#instruction start "37 = constant(1110)":
+	movl $1110, %r12d
+	#Phi node to 184 (40 37 184)
+	movq %r12, %rax
+	movl %eax, %r14d
+	#Block jump elided
+.L8:
+	#instruction start "42 = constant(1)":
+	movl $1, %r12d
+	#instruction start "43 = if 40 42":
+	#instruction start "181 = phi (region: 40) 32 50":
+	#instruction start "184 = phi (region: 40) 37 184":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L12
+.L9:
+	#Block jump elided
+.L10:
+	#Phi node to 182 (51 184 186)
+	movq %r14, %rax
+	movl %eax, %ebx
+	#Block jump elided
+.L11:
+	#instruction start "52 = phi (region: 51) 181 32":
+	#instruction start "182 = phi (region: 51) 184 186":
+	#instruction start "55 = set_reg %rax 182":
+	#instruction start "56 = return 51, 55, 52":
+	movq %rbx, %rax
+	#Block return.
+	movq -36(%rbp), %rbx
+	movq -44(%rbp), %r12
+	movq -52(%rbp), %r13
+	movq -60(%rbp), %r14
+	movq -68(%rbp), %r15
+	leave 
+	ret 
+.L12:
+	#Block jump elided
+.L13:
+	#instruction start "47 = load 8, state: 181":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "48 = constant(1)":
+	movl $1, %r12d
+	#instruction start "49 = 47 + 48":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %r15d
+	#instruction start "50 = store 8 49, state: 181":
+	movq %r13, %rsi
+	movl %r15d, (%rsi)
+	#Phi node to 184 (40 37 184)
+	movq %r14, %rax
+	movl %eax, %r14d
+	#Block jump
+	jmp .L8
+.global t6a
+t6a:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $96, %rsp
+	movq %rbx, -52(%rbp)
+	movq %r12, -60(%rbp)
+	movq %r13, -68(%rbp)
+	movq %r14, -76(%rbp)
+	movq %r15, -84(%rbp)
+	movl %edi, %ebx
+	movq %rsi, %r12
+.L14:
+	#instruction start "60 = proj3 58":
+	#instruction start "61 = proj1 58":
+	#instruction start "63 = %rdi":
+	#instruction start "64 = %rsi":
+	#instruction start "65 = alloc with size 4":
+	leaq -36(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "66 = alloc with size 8":
+	leaq -44(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "67 = store part of 65 with offset 0":
+	movq %r13, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "68 = store part of 66 with offset 0":
+	movq %r14, %rsi
+	leaq (%rsi), %rsi
+	movq %r12, (%rsi)
+	#instruction start "69 = constant(1)":
+	movl $1, %ebx
+	#instruction start "70 = int_cast_zero 69":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "71 = load 66, state: 68":
+	movq %r14, %rdi
+	movq (%rdi), %rbx
+	#instruction start "72 = constant(12)":
+	movq $12, %r14
+	#instruction start "73 = 70 * 72":
+	movq %r12, %rax
+	movq %r14, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "74 = 71 + 73":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "75 = constant(1)":
+	movl $1, %ebx
+	#instruction start "76 = int_cast_zero 75":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r14
+	#instruction start "77 = constant(4)":
+	movq $4, %rbx
+	#instruction start "78 = 76 * 77":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "79 = 74 + 78":
+	movq %r12, %rax
+	movq %r15, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "80 = constant(0)":
+	movq $expect, %r12
+	#instruction start "81 = constant(0)":
+	movq $0, %r14
+	#instruction start "82 = load part address of 65 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r15d
+	#instruction start "83 = proj0 82":
+	#instruction start "84 = proj1 82":
+	#instruction start "85 = load part address of 79 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r13d
+	#instruction start "86 = proj0 85":
+	#instruction start "87 = proj1 85":
+	#instruction start "88 = allocate_call_stack 0":
+	#instruction start "89 = set_reg %rdi 84":
+	#instruction start "90 = set_reg %rsi 87 state: 89":
+	#instruction start "91 = set_reg %rax 81 state: 90":
+	#instruction start "92 = call 80":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "93 = proj0 92":
+	#instruction start "94 = proj1 92":
+	#instruction start "95 = %rax":
+	#instruction start "96 = int_cast_zero 95":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "97 = set_reg %rax 96":
+	#instruction start "98 = return 59, 97, 93":
+	movq %r12, %rax
+	#Block return.
+	movq -52(%rbp), %rbx
+	movq -60(%rbp), %r12
+	movq -68(%rbp), %r13
+	movq -76(%rbp), %r14
+	movq -84(%rbp), %r15
+	leave 
+	ret 
+.global t6
+t6:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $416, %rsp
+	movq %rbx, -380(%rbp)
+	movq %r12, -388(%rbp)
+	movq %r13, -396(%rbp)
+	movq %r14, -404(%rbp)
+	movq %r15, -412(%rbp)
+	movq %rdi, -372(%rbp)
+	movq %rsi, -364(%rbp)
+	movq %rdx, -356(%rbp)
+	movq %rcx, -348(%rbp)
+	movq %r8, -340(%rbp)
+	movq %r9, -332(%rbp)
+.L15:
+	#instruction start "102 = proj3 100":
+	#instruction start "105 = alloc with size 24":
+	leaq -56(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "109 = constant(4)":
+	movl $4, %r12d
+	#instruction start "110 = int_cast_zero 109":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "112 = constant(4)":
+	movq $4, %r12
+	#instruction start "113 = 110 * 112":
+	movq %r13, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "114 = 105 + 113":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "115 = constant(65)":
+	movl $65, %r13d
+	#instruction start "116 = store 114 115, state: 102":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "117 = alloc with size 4":
+	leaq -60(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "118 = constant(65)":
+	movl $65, %r13d
+	#instruction start "119 = store 117 118, state: 116":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "120 = alloc with size 8":
+	leaq -68(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "121 = store 120 105, state: 119":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "122 = constant(1)":
+	movq $t6a, %rbx
+	#instruction start "123 = constant(0)":
+	movq $0, %r14
+	#instruction start "124 = load part address of 117 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r15d
+	#instruction start "125 = proj0 124":
+	#instruction start "126 = proj1 124":
+	#instruction start "127 = load part address of 120 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "128 = proj0 127":
+	#instruction start "129 = proj1 127":
+	#instruction start "130 = allocate_call_stack 0":
+	#instruction start "131 = set_reg %rdi 126":
+	#instruction start "132 = set_reg %rsi 129 state: 131":
+	#instruction start "133 = set_reg %rax 123 state: 132":
+	#instruction start "134 = call 122":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r12, %rsi
+	movq %r15, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "135 = proj0 134":
+	#instruction start "136 = proj1 134":
+	#instruction start "137 = %rax":
+	#instruction start "138 = int_cast_zero 137":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "139 = set_reg %rax 138":
+	#instruction start "140 = return 101, 139, 135":
+	movq %rbx, %rax
+	#Block return.
+	movq -380(%rbp), %rbx
+	movq -388(%rbp), %r12
+	movq -396(%rbp), %r13
+	movq -404(%rbp), %r14
+	movq -412(%rbp), %r15
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $96, %rsp
+	movq %rbx, -60(%rbp)
+	movq %r12, -68(%rbp)
+	movq %r13, -76(%rbp)
+	movq %r14, -84(%rbp)
+	movq %r15, -92(%rbp)
+.L16:
+	#instruction start "144 = proj3 142":
+	#instruction start "147 = constant(3)":
+	movq $.Ls3, %rbx
+	#instruction start "148 = constant(4)":
+	movq $t6, %r12
+	#instruction start "149 = constant(0)":
+	movq $0, %r13
+	#instruction start "150 = allocate_call_stack 0":
+	#instruction start "151 = set_reg %rax 149":
+	#instruction start "152 = call 148":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r14
+	#instruction start "153 = proj0 152":
+	#instruction start "154 = proj1 152":
+	#instruction start "155 = %rax":
+	#instruction start "156 = int_cast_zero 155":
+	movq %r14, %rax
+	movl %eax, %r12d
+	#instruction start "157 = alloc with size 8":
+	leaq -48(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "158 = store 157 147, state: 153":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "159 = alloc with size 4":
+	leaq -52(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "160 = store 159 156, state: 158":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "161 = constant(2)":
+	movq $printf, %r12
+	#instruction start "162 = constant(0)":
+	movq $0, %r14
+	#instruction start "163 = load part address of 157 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "164 = proj0 163":
+	#instruction start "165 = proj1 163":
+	#instruction start "166 = load part address of 159 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r13d
+	#instruction start "167 = proj0 166":
+	#instruction start "168 = proj1 166":
+	#instruction start "169 = allocate_call_stack 0":
+	#instruction start "170 = set_reg %rdi 165":
+	#instruction start "171 = set_reg %rsi 168 state: 170":
+	#instruction start "172 = set_reg %rax 162 state: 171":
+	#instruction start "173 = call 161":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "174 = proj0 173":
+	#instruction start "175 = proj1 173":
+	#instruction start "178 = constant(0)":
+	movl $0, %ebx
+	#instruction start "179 = set_reg %rax 178":
+	#instruction start "180 = return 143, 179, 174":
+	movq %rbx, %rax
+	#Block return.
+	movq -60(%rbp), %rbx
+	movq -68(%rbp), %r12
+	movq -76(%rbp), %r13
+	movq -84(%rbp), %r14
+	movq -92(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls3:
+	.string "%d\n\000"
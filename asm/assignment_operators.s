@@ -0,0 +1,949 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $752, %rsp
+	movq %rbx, -708(%rbp)
+	movq %r12, -716(%rbp)
+	movq %r13, -724(%rbp)
+	movq %r14, -732(%rbp)
+	movq %r15, -740(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "8 = constant(1)":
+	movl $1, %ebx
+	#instruction start "11 = constant(123)":
+	movq $123, %r12
+	#instruction start "12 = int_cast_zero 8":
+	movq %rbx, %rax
+	movsbq %al, %rax
+	movq %rax, %r13
+	#instruction start "13 = 12 + 11":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "14 = int_cast_zero 13":
+	movq %rbx, %rax
+	movzbl %al, %r12d
+	#instruction start "17 = int_cast_zero 14":
+	movq %r12, %rax
+	movsbq %al, %rax
+	movl %eax, %ebx
+	#instruction start "18 = constant(124)":
+	movl $124, %r12d
+	#instruction start "19 = 17 == 18":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "21 = if 2 19":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "24 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "25 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "26 = constant(7)":
+	movl $7, %r13d
+	#instruction start "27 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "28 = alloc with size 8":
+	leaq -472(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "29 = store 28 24, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "30 = alloc with size 8":
+	leaq -480(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "31 = store 30 25, state: 29":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "32 = alloc with size 4":
+	leaq -484(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "33 = store 32 26, state: 31":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "34 = alloc with size 8":
+	leaq -492(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "35 = store 34 27, state: 33":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "36 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "37 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "38 = load part address of 28 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "39 = proj0 38":
+	#instruction start "40 = proj1 38":
+	#instruction start "41 = load part address of 30 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "42 = proj0 41":
+	#instruction start "43 = proj1 41":
+	#instruction start "44 = load part address of 32 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "45 = proj0 44":
+	#instruction start "46 = proj1 44":
+	#instruction start "47 = load part address of 34 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "48 = proj0 47":
+	#instruction start "49 = proj1 47":
+	#instruction start "50 = allocate_call_stack 0":
+	#instruction start "51 = set_reg %rdi 40":
+	#instruction start "52 = set_reg %rsi 43 state: 51":
+	#instruction start "53 = set_reg %rdx 46 state: 52":
+	#instruction start "54 = set_reg %rcx 49 state: 53":
+	#instruction start "55 = set_reg %rax 37 state: 54":
+	#instruction start "56 = call 36":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "57 = proj0 56":
+	#instruction start "58 = proj1 56":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "59 = constant(1)":
+	movl $1, %ebx
+	#instruction start "61 = if 20 59":
+	#instruction start "69 = phi (region: 20) 3 57":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "64 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "65 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "66 = constant(8)":
+	movl $8, %r13d
+	#instruction start "67 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "68 = alloc with size 8":
+	leaq -500(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "70 = store 68 64, state: 69":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "71 = alloc with size 8":
+	leaq -508(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "72 = store 71 65, state: 70":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "73 = alloc with size 4":
+	leaq -512(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "74 = store 73 66, state: 72":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "75 = alloc with size 8":
+	leaq -520(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "76 = store 75 67, state: 74":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "77 = constant(0)":
+	leaq -64(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "78 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "79 = load part address of 68 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "80 = proj0 79":
+	#instruction start "81 = proj1 79":
+	#instruction start "82 = load part address of 71 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "83 = proj0 82":
+	#instruction start "84 = proj1 82":
+	#instruction start "85 = load part address of 73 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "86 = proj0 85":
+	#instruction start "87 = proj1 85":
+	#instruction start "88 = load part address of 75 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "89 = proj0 88":
+	#instruction start "90 = proj1 88":
+	#instruction start "91 = allocate_call_stack 0":
+	#instruction start "92 = set_reg %rdi 81":
+	#instruction start "93 = set_reg %rsi 84 state: 92":
+	#instruction start "94 = set_reg %rdx 87 state: 93":
+	#instruction start "95 = set_reg %rcx 90 state: 94":
+	#instruction start "96 = set_reg %rax 78 state: 95":
+	#instruction start "97 = call 77":
+	addq $0, %rsp
+	movq -72(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -64(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "98 = proj0 97":
+	#instruction start "99 = proj1 97":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "100 = constant(1)":
+	movl $1, %ebx
+	#instruction start "102 = if 60 100":
+	#instruction start "110 = phi (region: 60) 69 98":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "105 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "106 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "107 = constant(9)":
+	movl $9, %r13d
+	#instruction start "108 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "109 = alloc with size 8":
+	leaq -528(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "111 = store 109 105, state: 110":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "112 = alloc with size 8":
+	leaq -536(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "113 = store 112 106, state: 111":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "114 = alloc with size 4":
+	leaq -540(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "115 = store 114 107, state: 113":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "116 = alloc with size 8":
+	leaq -548(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "117 = store 116 108, state: 115":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "118 = constant(0)":
+	leaq -120(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "119 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "120 = load part address of 109 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "121 = proj0 120":
+	#instruction start "122 = proj1 120":
+	#instruction start "123 = load part address of 112 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "124 = proj0 123":
+	#instruction start "125 = proj1 123":
+	#instruction start "126 = load part address of 114 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "127 = proj0 126":
+	#instruction start "128 = proj1 126":
+	#instruction start "129 = load part address of 116 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "130 = proj0 129":
+	#instruction start "131 = proj1 129":
+	#instruction start "132 = allocate_call_stack 0":
+	#instruction start "133 = set_reg %rdi 122":
+	#instruction start "134 = set_reg %rsi 125 state: 133":
+	#instruction start "135 = set_reg %rdx 128 state: 134":
+	#instruction start "136 = set_reg %rcx 131 state: 135":
+	#instruction start "137 = set_reg %rax 119 state: 136":
+	#instruction start "138 = call 118":
+	addq $0, %rsp
+	movq -128(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -120(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "139 = proj0 138":
+	#instruction start "140 = proj1 138":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "141 = constant(1)":
+	movl $1, %ebx
+	#instruction start "143 = if 101 141":
+	#instruction start "151 = phi (region: 101) 110 139":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "146 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "147 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "148 = constant(10)":
+	movl $10, %r13d
+	#instruction start "149 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "150 = alloc with size 8":
+	leaq -556(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "152 = store 150 146, state: 151":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "153 = alloc with size 8":
+	leaq -564(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "154 = store 153 147, state: 152":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "155 = alloc with size 4":
+	leaq -568(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "156 = store 155 148, state: 154":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "157 = alloc with size 8":
+	leaq -576(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "158 = store 157 149, state: 156":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "159 = constant(0)":
+	leaq -176(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "160 = constant(0)":
+	leaq -184(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "161 = load part address of 150 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "162 = proj0 161":
+	#instruction start "163 = proj1 161":
+	#instruction start "164 = load part address of 153 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "165 = proj0 164":
+	#instruction start "166 = proj1 164":
+	#instruction start "167 = load part address of 155 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "168 = proj0 167":
+	#instruction start "169 = proj1 167":
+	#instruction start "170 = load part address of 157 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "171 = proj0 170":
+	#instruction start "172 = proj1 170":
+	#instruction start "173 = allocate_call_stack 0":
+	#instruction start "174 = set_reg %rdi 163":
+	#instruction start "175 = set_reg %rsi 166 state: 174":
+	#instruction start "176 = set_reg %rdx 169 state: 175":
+	#instruction start "177 = set_reg %rcx 172 state: 176":
+	#instruction start "178 = set_reg %rax 160 state: 177":
+	#instruction start "179 = call 159":
+	addq $0, %rsp
+	movq -184(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -176(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "180 = proj0 179":
+	#instruction start "181 = proj1 179":
+	#Block jump
+	jmp .L14
+.L13:
+	#Block jump elided
+.L14:
+	#instruction start "183 = phi (region: 142) 151 180":
+	#instruction start "185 = constant(10)":
+	movl $10, %ebx
+	#instruction start "191 = constant(10)":
+	movl $10, %r12d
+	#instruction start "192 = 185 == 191":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "194 = if 142 192":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#instruction start "197 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "198 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "199 = constant(13)":
+	movl $13, %r13d
+	#instruction start "200 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "201 = alloc with size 8":
+	leaq -584(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "202 = store 201 197, state: 183":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "203 = alloc with size 8":
+	leaq -592(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "204 = store 203 198, state: 202":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "205 = alloc with size 4":
+	leaq -596(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "206 = store 205 199, state: 204":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "207 = alloc with size 8":
+	leaq -604(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "208 = store 207 200, state: 206":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "209 = constant(0)":
+	leaq -232(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "210 = constant(0)":
+	leaq -240(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "211 = load part address of 201 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "212 = proj0 211":
+	#instruction start "213 = proj1 211":
+	#instruction start "214 = load part address of 203 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "215 = proj0 214":
+	#instruction start "216 = proj1 214":
+	#instruction start "217 = load part address of 205 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "218 = proj0 217":
+	#instruction start "219 = proj1 217":
+	#instruction start "220 = load part address of 207 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "221 = proj0 220":
+	#instruction start "222 = proj1 220":
+	#instruction start "223 = allocate_call_stack 0":
+	#instruction start "224 = set_reg %rdi 213":
+	#instruction start "225 = set_reg %rsi 216 state: 224":
+	#instruction start "226 = set_reg %rdx 219 state: 225":
+	#instruction start "227 = set_reg %rcx 222 state: 226":
+	#instruction start "228 = set_reg %rax 210 state: 227":
+	#instruction start "229 = call 209":
+	addq $0, %rsp
+	movq -240(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -232(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "230 = proj0 229":
+	#instruction start "231 = proj1 229":
+	#Block jump
+	jmp .L17
+.L16:
+	#Block jump elided
+.L17:
+	#instruction start "233 = phi (region: 193) 183 230":
+	#instruction start "235 = constant(4607182418800017408)":
+	leaq -288(%rbp), %rdi
+	movabsq $4607182418800017408, %rax
+	movq %rax, (%rdi)
+	#instruction start "237 = constant(1)":
+	movl $1, %r12d
+	#instruction start "239 = if 193 237":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "242 = constant(8)":
+	movq $.Ls8, %r12
+	#instruction start "243 = constant(2)":
+	movq $.Ls2, %r13
+	#instruction start "244 = constant(16)":
+	movl $16, %r14d
+	#instruction start "245 = constant(3)":
+	movq $.Ls3, %r15
+	#instruction start "246 = alloc with size 8":
+	leaq -612(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "247 = store 246 242, state: 233":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "248 = alloc with size 8":
+	leaq -620(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "249 = store 248 243, state: 247":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "250 = alloc with size 4":
+	leaq -624(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "251 = store 250 244, state: 249":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "252 = alloc with size 8":
+	leaq -632(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "253 = store 252 245, state: 251":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "254 = constant(0)":
+	leaq -296(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "255 = constant(0)":
+	leaq -304(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "256 = load part address of 246 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "257 = proj0 256":
+	#instruction start "258 = proj1 256":
+	#instruction start "259 = load part address of 248 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "260 = proj0 259":
+	#instruction start "261 = proj1 259":
+	#instruction start "262 = load part address of 250 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "263 = proj0 262":
+	#instruction start "264 = proj1 262":
+	#instruction start "265 = load part address of 252 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "266 = proj0 265":
+	#instruction start "267 = proj1 265":
+	#instruction start "268 = allocate_call_stack 0":
+	#instruction start "269 = set_reg %rdi 258":
+	#instruction start "270 = set_reg %rsi 261 state: 269":
+	#instruction start "271 = set_reg %rdx 264 state: 270":
+	#instruction start "272 = set_reg %rcx 267 state: 271":
+	#instruction start "273 = set_reg %rax 255 state: 272":
+	#instruction start "274 = call 254":
+	addq $0, %rsp
+	movq -304(%rbp), %rax
+	movq %r13, %rcx
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq -296(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "275 = proj0 274":
+	#instruction start "276 = proj1 274":
+	#Phi node to 412 (238 235 235)
+	movq -288(%rbp), %rax
+	movq %rax, %rbx
+	#Block jump
+	jmp .L20
+.L19:
+	#Phi node to 412 (238 235 235)
+	movq -288(%rbp), %rax
+	movq %rax, %rbx
+	#Block jump elided
+.L20:
+	#instruction start "277 = phi (region: 238) 233 275":
+	#instruction start "279 = constant(4607182418800017408)":
+	movabsq $4607182418800017408, %r12
+	#instruction start "412 = phi (region: 238) 235 235":
+	#instruction start "280 = 412 + 279 (float)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	addsd %xmm1, %xmm0
+	movq %xmm0, %rax
+	movq %rax, %r13
+	#instruction start "283 = constant(4611235658464650854)":
+	movabsq $4611235658464650854, %rbx
+	#instruction start "284 = 280 >= 283 (float)":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	ucomisd %xmm1, %xmm0
+	setnb %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "285 = if 238 284":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "302 = alloc with size 4":
+	leaq -636(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "303 = constant(0)":
+	movl $0, %r12d
+	#instruction start "304 = store 302 303, state: 277":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 306 (305 301 302)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L26
+.L22:
+	#instruction start "289 = constant(4611911198408756429)":
+	movabsq $4611911198408756429, %rbx
+	#instruction start "290 = 280 <= 289 (float)":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	ucomisd %xmm1, %xmm0
+	setbe %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "291 = if 287 290":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L24
+.L23:
+	#instruction start "297 = alloc with size 4":
+	leaq -640(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "298 = constant(0)":
+	movl $0, %r13d
+	#instruction start "299 = store 297 298, state: 277":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 301 (300 294 297)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L25
+.L24:
+	#instruction start "294 = alloc with size 4":
+	leaq -644(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "295 = constant(1)":
+	movl $1, %r14d
+	#instruction start "296 = store 294 295, state: 277":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 301 (300 294 297)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L25:
+	#instruction start "301 = phi (region: 300) 294 297":
+	#instruction start "308 = phi (region: 300) 296 299":
+	#Phi node to 306 (305 301 302)
+	movq %r13, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L26:
+	#instruction start "306 = phi (region: 305) 301 302":
+	#instruction start "307 = phi (region: 305) 308 304":
+	#instruction start "309 = load_volatile 306, state: 307":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "310 = proj0 309":
+	#instruction start "311 = proj1 309":
+	#instruction start "313 = if 305 311":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L28
+.L27:
+	#instruction start "316 = constant(9)":
+	movq $.Ls9, %rbx
+	#instruction start "317 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "318 = constant(18)":
+	movl $18, %r13d
+	#instruction start "319 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "320 = alloc with size 8":
+	leaq -652(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "321 = store 320 316, state: 310":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "322 = alloc with size 8":
+	leaq -660(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "323 = store 322 317, state: 321":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "324 = alloc with size 4":
+	leaq -664(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "325 = store 324 318, state: 323":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "326 = alloc with size 8":
+	leaq -672(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "327 = store 326 319, state: 325":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "328 = constant(0)":
+	leaq -352(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "329 = constant(0)":
+	leaq -360(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "330 = load part address of 320 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "331 = proj0 330":
+	#instruction start "332 = proj1 330":
+	#instruction start "333 = load part address of 322 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "334 = proj0 333":
+	#instruction start "335 = proj1 333":
+	#instruction start "336 = load part address of 324 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "337 = proj0 336":
+	#instruction start "338 = proj1 336":
+	#instruction start "339 = load part address of 326 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "340 = proj0 339":
+	#instruction start "341 = proj1 339":
+	#instruction start "342 = allocate_call_stack 0":
+	#instruction start "343 = set_reg %rdi 332":
+	#instruction start "344 = set_reg %rsi 335 state: 343":
+	#instruction start "345 = set_reg %rdx 338 state: 344":
+	#instruction start "346 = set_reg %rcx 341 state: 345":
+	#instruction start "347 = set_reg %rax 329 state: 346":
+	#instruction start "348 = call 328":
+	addq $0, %rsp
+	movq -360(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -352(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "349 = proj0 348":
+	#instruction start "350 = proj1 348":
+	#Block jump
+	jmp .L29
+.L28:
+	#Block jump elided
+.L29:
+	#instruction start "352 = phi (region: 312) 310 349":
+	#instruction start "354 = constant(1357)":
+	movl $1357, %ebx
+	#instruction start "367 = constant(1357)":
+	movl $1357, %r12d
+	#instruction start "368 = 354 == 367":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "370 = if 312 368":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L31
+.L30:
+	#instruction start "373 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "374 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "375 = constant(24)":
+	movl $24, %r13d
+	#instruction start "376 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "377 = alloc with size 8":
+	leaq -680(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "378 = store 377 373, state: 352":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "379 = alloc with size 8":
+	leaq -688(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "380 = store 379 374, state: 378":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "381 = alloc with size 4":
+	leaq -692(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "382 = store 381 375, state: 380":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "383 = alloc with size 8":
+	leaq -700(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "384 = store 383 376, state: 382":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "385 = constant(0)":
+	leaq -408(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "386 = constant(0)":
+	leaq -416(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "387 = load part address of 377 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "388 = proj0 387":
+	#instruction start "389 = proj1 387":
+	#instruction start "390 = load part address of 379 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "391 = proj0 390":
+	#instruction start "392 = proj1 390":
+	#instruction start "393 = load part address of 381 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "394 = proj0 393":
+	#instruction start "395 = proj1 393":
+	#instruction start "396 = load part address of 383 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "397 = proj0 396":
+	#instruction start "398 = proj1 396":
+	#instruction start "399 = allocate_call_stack 0":
+	#instruction start "400 = set_reg %rdi 389":
+	#instruction start "401 = set_reg %rsi 392 state: 400":
+	#instruction start "402 = set_reg %rdx 395 state: 401":
+	#instruction start "403 = set_reg %rcx 398 state: 402":
+	#instruction start "404 = set_reg %rax 386 state: 403":
+	#instruction start "405 = call 385":
+	addq $0, %rsp
+	movq -416(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -408(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "406 = proj0 405":
+	#instruction start "407 = proj1 405":
+	#Block jump
+	jmp .L32
+.L31:
+	#Block jump elided
+.L32:
+	#instruction start "408 = constant(0)":
+	movl $0, %ebx
+	#instruction start "409 = set_reg %rax 408":
+	#instruction start "410 = phi (region: 369) 352 406":
+	#instruction start "411 = return 369, 409, 410":
+	movq %rbx, %rax
+	#Block return.
+	movq -708(%rbp), %rbx
+	movq -716(%rbp), %r12
+	movq -724(%rbp), %r13
+	movq -732(%rbp), %r14
+	movq -740(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "c == 124\000"
+.Ls2:
+	.string "tests/assignment_operators.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "sizeof(++c) == 1\000"
+.Ls5:
+	.string "sizeof(c += 1) == 1\000"
+.Ls6:
+	.string "sizeof(c++) == 1\000"
+.Ls7:
+	.string "i++ == 10\000"
+.Ls8:
+	.string "sizeof(d++) == 8\000"
+.Ls9:
+	.string "d >= 1.9 && d <= 2.1\000"
+.Ls10:
+	.string "var == 0x54d\000"
@@ -0,0 +1,713 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $576, %rsp
+	movq %rbx, -541(%rbp)
+	movq %r12, -549(%rbp)
+	movq %r13, -557(%rbp)
+	movq %r14, -565(%rbp)
+	movq %r15, -573(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = alloc with size 13":
+	leaq -365(%rbp), %rsi
+	movq %rsi, -8(%rbp)
+	#instruction start "7 = constant(0)":
+	movq $0, %r12
+	#instruction start "8 = 6 + 7":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "9 = constant(10)":
+	movl $10, %r12d
+	#instruction start "10 = int_cast_zero 9":
+	movq %r12, %rax
+	movzbl %al, %r14d
+	#instruction start "11 = store 8 10, state: 3":
+	movq %r13, %rsi
+	movb %r14b, (%rsi)
+	#instruction start "12 = constant(1)":
+	movq $1, %r12
+	#instruction start "13 = 6 + 12":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "14 = constant(20)":
+	movl $20, %r12d
+	#instruction start "15 = store 13 14, state: 11":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "16 = constant(5)":
+	movq $5, %r12
+	#instruction start "17 = 6 + 16":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "18 = constant(30)":
+	movl $30, %r12d
+	#instruction start "19 = int_cast_zero 18":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r14
+	#instruction start "20 = store 17 19, state: 15":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "21 = constant(0)":
+	movq $0, %r12
+	#instruction start "22 = 6 + 21":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "23 = load_volatile 22, state: 20":
+	movq %r13, %rdi
+	movzbl (%rdi), %r12d
+	#instruction start "24 = proj0 23":
+	#instruction start "25 = proj1 23":
+	#instruction start "26 = int_cast_zero 25":
+	movq %r12, %rax
+	movsbq %al, %rax
+	movl %eax, %r13d
+	#instruction start "27 = constant(10)":
+	movl $10, %r12d
+	#instruction start "28 = 26 == 27":
+	movq %r13, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "30 = if 2 28":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "33 = constant(1)":
+	movq $.Ls1, %r12
+	#instruction start "34 = constant(2)":
+	movq $.Ls2, %r13
+	#instruction start "35 = constant(28)":
+	movl $28, %r14d
+	#instruction start "36 = constant(3)":
+	movq $.Ls3, %r15
+	#instruction start "37 = alloc with size 8":
+	leaq -373(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "38 = store 37 33, state: 24":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "39 = alloc with size 8":
+	leaq -381(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "40 = store 39 34, state: 38":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "41 = alloc with size 4":
+	leaq -385(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "42 = store 41 35, state: 40":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "43 = alloc with size 8":
+	leaq -393(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "44 = store 43 36, state: 42":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "45 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "46 = constant(0)":
+	leaq -24(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "47 = load part address of 37 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "48 = proj0 47":
+	#instruction start "49 = proj1 47":
+	#instruction start "50 = load part address of 39 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "51 = proj0 50":
+	#instruction start "52 = proj1 50":
+	#instruction start "53 = load part address of 41 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "54 = proj0 53":
+	#instruction start "55 = proj1 53":
+	#instruction start "56 = load part address of 43 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "57 = proj0 56":
+	#instruction start "58 = proj1 56":
+	#instruction start "59 = allocate_call_stack 0":
+	#instruction start "60 = set_reg %rdi 49":
+	#instruction start "61 = set_reg %rsi 52 state: 60":
+	#instruction start "62 = set_reg %rdx 55 state: 61":
+	#instruction start "63 = set_reg %rcx 58 state: 62":
+	#instruction start "64 = set_reg %rax 46 state: 63":
+	#instruction start "65 = call 45":
+	addq $0, %rsp
+	movq -24(%rbp), %rax
+	movq %r13, %rcx
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq -16(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "66 = proj0 65":
+	#instruction start "67 = proj1 65":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "68 = constant(1)":
+	movq $1, %rbx
+	#instruction start "69 = 6 + 68":
+	movq -8(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "70 = phi (region: 29) 24 66":
+	#instruction start "71 = load_volatile 69, state: 70":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "72 = proj0 71":
+	#instruction start "73 = proj1 71":
+	#instruction start "74 = constant(20)":
+	movl $20, %r12d
+	#instruction start "75 = 73 == 74":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "77 = if 29 75":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "80 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "81 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "82 = constant(29)":
+	movl $29, %r13d
+	#instruction start "83 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "84 = alloc with size 8":
+	leaq -401(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "85 = store 84 80, state: 72":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "86 = alloc with size 8":
+	leaq -409(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "87 = store 86 81, state: 85":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "88 = alloc with size 4":
+	leaq -413(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "89 = store 88 82, state: 87":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "90 = alloc with size 8":
+	leaq -421(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "91 = store 90 83, state: 89":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "92 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "93 = constant(0)":
+	leaq -80(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "94 = load part address of 84 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "95 = proj0 94":
+	#instruction start "96 = proj1 94":
+	#instruction start "97 = load part address of 86 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "98 = proj0 97":
+	#instruction start "99 = proj1 97":
+	#instruction start "100 = load part address of 88 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "101 = proj0 100":
+	#instruction start "102 = proj1 100":
+	#instruction start "103 = load part address of 90 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "104 = proj0 103":
+	#instruction start "105 = proj1 103":
+	#instruction start "106 = allocate_call_stack 0":
+	#instruction start "107 = set_reg %rdi 96":
+	#instruction start "108 = set_reg %rsi 99 state: 107":
+	#instruction start "109 = set_reg %rdx 102 state: 108":
+	#instruction start "110 = set_reg %rcx 105 state: 109":
+	#instruction start "111 = set_reg %rax 93 state: 110":
+	#instruction start "112 = call 92":
+	addq $0, %rsp
+	movq -80(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -72(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "113 = proj0 112":
+	#instruction start "114 = proj1 112":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "115 = constant(5)":
+	movq $5, %rbx
+	#instruction start "116 = 6 + 115":
+	movq -8(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "117 = phi (region: 76) 72 113":
+	#instruction start "118 = load_volatile 116, state: 117":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "119 = proj0 118":
+	#instruction start "120 = proj1 118":
+	#instruction start "121 = constant(30)":
+	movq $30, %r12
+	#instruction start "122 = 120 == 121":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "124 = if 76 122":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "127 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "128 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "129 = constant(30)":
+	movl $30, %r13d
+	#instruction start "130 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "131 = alloc with size 8":
+	leaq -429(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "132 = store 131 127, state: 119":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "133 = alloc with size 8":
+	leaq -437(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "134 = store 133 128, state: 132":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "135 = alloc with size 4":
+	leaq -441(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "136 = store 135 129, state: 134":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "137 = alloc with size 8":
+	leaq -449(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "138 = store 137 130, state: 136":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "139 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "140 = constant(0)":
+	leaq -136(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "141 = load part address of 131 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "142 = proj0 141":
+	#instruction start "143 = proj1 141":
+	#instruction start "144 = load part address of 133 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "145 = proj0 144":
+	#instruction start "146 = proj1 144":
+	#instruction start "147 = load part address of 135 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "148 = proj0 147":
+	#instruction start "149 = proj1 147":
+	#instruction start "150 = load part address of 137 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "151 = proj0 150":
+	#instruction start "152 = proj1 150":
+	#instruction start "153 = allocate_call_stack 0":
+	#instruction start "154 = set_reg %rdi 143":
+	#instruction start "155 = set_reg %rsi 146 state: 154":
+	#instruction start "156 = set_reg %rdx 149 state: 155":
+	#instruction start "157 = set_reg %rcx 152 state: 156":
+	#instruction start "158 = set_reg %rax 140 state: 157":
+	#instruction start "159 = call 139":
+	addq $0, %rsp
+	movq -136(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -128(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "160 = proj0 159":
+	#instruction start "161 = proj1 159":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "162 = constant(1)":
+	movl $1, %ebx
+	#instruction start "164 = if 123 162":
+	#instruction start "172 = phi (region: 123) 119 160":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "167 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "168 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "169 = constant(32)":
+	movl $32, %r13d
+	#instruction start "170 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "171 = alloc with size 8":
+	leaq -457(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "173 = store 171 167, state: 172":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "174 = alloc with size 8":
+	leaq -465(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "175 = store 174 168, state: 173":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "176 = alloc with size 4":
+	leaq -469(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "177 = store 176 169, state: 175":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "178 = alloc with size 8":
+	leaq -477(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "179 = store 178 170, state: 177":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "180 = constant(0)":
+	leaq -184(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "181 = constant(0)":
+	leaq -192(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "182 = load part address of 171 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "183 = proj0 182":
+	#instruction start "184 = proj1 182":
+	#instruction start "185 = load part address of 174 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "186 = proj0 185":
+	#instruction start "187 = proj1 185":
+	#instruction start "188 = load part address of 176 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "189 = proj0 188":
+	#instruction start "190 = proj1 188":
+	#instruction start "191 = load part address of 178 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "192 = proj0 191":
+	#instruction start "193 = proj1 191":
+	#instruction start "194 = allocate_call_stack 0":
+	#instruction start "195 = set_reg %rdi 184":
+	#instruction start "196 = set_reg %rsi 187 state: 195":
+	#instruction start "197 = set_reg %rdx 190 state: 196":
+	#instruction start "198 = set_reg %rcx 193 state: 197":
+	#instruction start "199 = set_reg %rax 181 state: 198":
+	#instruction start "200 = call 180":
+	addq $0, %rsp
+	movq -192(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -184(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "201 = proj0 200":
+	#instruction start "202 = proj1 200":
+	#Block jump
+	jmp .L14
+.L13:
+	#Block jump elided
+.L14:
+	#instruction start "203 = constant(1)":
+	movl $1, %ebx
+	#instruction start "205 = if 163 203":
+	#instruction start "213 = phi (region: 163) 172 201":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#instruction start "208 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "209 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "210 = constant(33)":
+	movl $33, %r13d
+	#instruction start "211 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "212 = alloc with size 8":
+	leaq -485(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "214 = store 212 208, state: 213":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "215 = alloc with size 8":
+	leaq -493(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "216 = store 215 209, state: 214":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "217 = alloc with size 4":
+	leaq -497(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "218 = store 217 210, state: 216":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "219 = alloc with size 8":
+	leaq -505(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "220 = store 219 211, state: 218":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "221 = constant(0)":
+	leaq -240(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "222 = constant(0)":
+	leaq -248(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "223 = load part address of 212 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "224 = proj0 223":
+	#instruction start "225 = proj1 223":
+	#instruction start "226 = load part address of 215 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "227 = proj0 226":
+	#instruction start "228 = proj1 226":
+	#instruction start "229 = load part address of 217 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "230 = proj0 229":
+	#instruction start "231 = proj1 229":
+	#instruction start "232 = load part address of 219 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "233 = proj0 232":
+	#instruction start "234 = proj1 232":
+	#instruction start "235 = allocate_call_stack 0":
+	#instruction start "236 = set_reg %rdi 225":
+	#instruction start "237 = set_reg %rsi 228 state: 236":
+	#instruction start "238 = set_reg %rdx 231 state: 237":
+	#instruction start "239 = set_reg %rcx 234 state: 238":
+	#instruction start "240 = set_reg %rax 222 state: 239":
+	#instruction start "241 = call 221":
+	addq $0, %rsp
+	movq -248(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -240(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "242 = proj0 241":
+	#instruction start "243 = proj1 241":
+	#Block jump
+	jmp .L17
+.L16:
+	#Block jump elided
+.L17:
+	#instruction start "244 = constant(1)":
+	movl $1, %ebx
+	#instruction start "246 = if 204 244":
+	#instruction start "254 = phi (region: 204) 213 242":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "249 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "250 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "251 = constant(34)":
+	movl $34, %r13d
+	#instruction start "252 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "253 = alloc with size 8":
+	leaq -513(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "255 = store 253 249, state: 254":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "256 = alloc with size 8":
+	leaq -521(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "257 = store 256 250, state: 255":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "258 = alloc with size 4":
+	leaq -525(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "259 = store 258 251, state: 257":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "260 = alloc with size 8":
+	leaq -533(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "261 = store 260 252, state: 259":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "262 = constant(0)":
+	leaq -296(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "263 = constant(0)":
+	leaq -304(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "264 = load part address of 253 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "265 = proj0 264":
+	#instruction start "266 = proj1 264":
+	#instruction start "267 = load part address of 256 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "268 = proj0 267":
+	#instruction start "269 = proj1 267":
+	#instruction start "270 = load part address of 258 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "271 = proj0 270":
+	#instruction start "272 = proj1 270":
+	#instruction start "273 = load part address of 260 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "274 = proj0 273":
+	#instruction start "275 = proj1 273":
+	#instruction start "276 = allocate_call_stack 0":
+	#instruction start "277 = set_reg %rdi 266":
+	#instruction start "278 = set_reg %rsi 269 state: 277":
+	#instruction start "279 = set_reg %rdx 272 state: 278":
+	#instruction start "280 = set_reg %rcx 275 state: 279":
+	#instruction start "281 = set_reg %rax 263 state: 280":
+	#instruction start "282 = call 262":
+	addq $0, %rsp
+	movq -304(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -296(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "283 = proj0 282":
+	#instruction start "284 = proj1 282":
+	#Block jump
+	jmp .L20
+.L19:
+	#Block jump elided
+.L20:
+	#instruction start "285 = constant(0)":
+	movl $0, %ebx
+	#instruction start "286 = set_reg %rax 285":
+	#instruction start "287 = phi (region: 245) 254 283":
+	#instruction start "288 = return 245, 286, 287":
+	movq %rbx, %rax
+	#Block return.
+	movq -541(%rbp), %rbx
+	movq -549(%rbp), %r12
+	movq -557(%rbp), %r13
+	movq -565(%rbp), %r14
+	movq -573(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "t.a == 10\000"
+.Ls2:
+	.string "tests/attribute_packed.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "t.b == 20\000"
+.Ls5:
+	.string "t.c == 30\000"
+.Ls6:
+	.string "sizeof(struct T_aligned) == 16\000"
+.Ls7:
+	.string "sizeof(struct T_packed) == 1 + 4 + 8\000"
+.Ls8:
+	.string "sizeof(struct T_packed2) == 1 + 4 + 8\000"
@@ -0,0 +1,3111 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $1776, %rsp
+	movq %rbx, -1734(%rbp)
+	movq %r12, -1742(%rbp)
+	movq %r13, -1750(%rbp)
+	movq %r14, -1758(%rbp)
+	movq %r15, -1766(%rbp)
+.L2:
+	#Block jump elided
+.L3:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = alloc with size 12":
+	leaq -1020(%rbp), %rsi
+	movq %rsi, -8(%rbp)
+	#instruction start "7 = constant(0)":
+	movq $0, %r12
+	#instruction start "8 = 6 + 7":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	#instruction start "9 = constant(0)":
+	movl $0, %r12d
+	#instruction start "10 = load_volatile 8, state: 3":
+	movq -16(%rbp), %rdi
+	movl (%rdi), %r14d
+	#instruction start "11 = proj0 10":
+	#instruction start "12 = proj1 10":
+	#instruction start "13 = int_cast_zero 9":
+	movq %r12, %rax
+	movq %rax, -24(%rbp)
+	#instruction start "14 = int_cast_zero 12":
+	movq %r14, %rax
+	movq %rax, %r12
+	#instruction start "15 = constant(14)":
+	movq $14, %r14
+	#instruction start "16 = constant(-49153)":
+	movq $-49153, %r13
+	#instruction start "17 = 16 & 14":
+	movq %r13, %rax
+	movq %r12, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "18 = ~16":
+	movq %r13, %rax
+	notq %rax
+	movq %rax, %r12
+	#instruction start "19 = 13 << 15":
+	movq -24(%rbp), %rax
+	movq %r14, %rcx
+	salq %cl, %rax
+	movq %rax, %r13
+	#instruction start "20 = 18 & 19":
+	movq %r12, %rax
+	movq %r13, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "21 = 20 | 17":
+	movq %r14, %rax
+	movq %r15, %rcx
+	orq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "22 = int_cast_zero 21":
+	movq %r12, %rax
+	movl %eax, %r13d
+	#instruction start "23 = store 8 22, state: 11":
+	movq -16(%rbp), %rsi
+	movl %r13d, (%rsi)
+	#instruction start "32 = constant(0)":
+	movl $0, %r12d
+	#Phi node to 1159 (25 32 44)
+	movq %r12, %rax
+	movl %eax, -28(%rbp)
+	#Block jump elided
+.L4:
+	#instruction start "34 = phi (region: 25) 23 130":
+	#instruction start "36 = constant(10)":
+	movl $10, %r12d
+	#instruction start "1159 = phi (region: 25) 32 44":
+	#instruction start "37 = 1159 < 36 (signed)":
+	movl -28(%rbp), %eax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "38 = if 25 37":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L59
+.L5:
+	#Block jump elided
+.L6:
+	#Block jump elided
+.L7:
+	#instruction start "131 = constant(0)":
+	movq $0, %r12
+	#instruction start "132 = 6 + 131":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, -36(%rbp)
+	#instruction start "133 = constant(0)":
+	movl $0, %r12d
+	#instruction start "135 = load_volatile 132, state: 34":
+	movq -36(%rbp), %rdi
+	movl (%rdi), %r15d
+	#instruction start "136 = proj0 135":
+	#instruction start "137 = proj1 135":
+	#instruction start "138 = int_cast_zero 133":
+	movq %r12, %rax
+	movq %rax, %r13
+	#instruction start "139 = int_cast_zero 137":
+	movq %r15, %rax
+	movq %rax, %r12
+	#instruction start "140 = constant(14)":
+	movq $14, %r15
+	#instruction start "141 = constant(-49153)":
+	movq $-49153, %rbx
+	#instruction start "142 = 141 & 139":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "143 = ~141":
+	movq %rbx, %rax
+	notq %rax
+	movq %rax, %r12
+	#instruction start "144 = 138 << 140":
+	movq %r13, %rax
+	movq %r15, %rcx
+	salq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "145 = 143 & 144":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	andq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "146 = 145 | 142":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "147 = int_cast_zero 146":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "148 = store 132 147, state: 136":
+	movq -36(%rbp), %rsi
+	movl %r12d, (%rsi)
+	#instruction start "157 = constant(0)":
+	movl $0, %ebx
+	#Phi node to 1163 (150 157 169)
+	movq %rbx, %rax
+	movl %eax, -40(%rbp)
+	#Block jump elided
+.L8:
+	#instruction start "159 = phi (region: 150) 148 255":
+	#instruction start "161 = constant(10)":
+	movl $10, %ebx
+	#instruction start "1163 = phi (region: 150) 157 169":
+	#instruction start "162 = 1163 < 161 (signed)":
+	movl -40(%rbp), %eax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "163 = if 150 162":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L53
+.L9:
+	#Block jump elided
+.L10:
+	#instruction start "256 = constant(0)":
+	movq $0, %rbx
+	#instruction start "257 = 6 + 256":
+	movq -8(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, -48(%rbp)
+	#instruction start "258 = constant(5)":
+	movl $5, %ebx
+	#instruction start "260 = load_volatile 257, state: 159":
+	movq -48(%rbp), %rdi
+	movl (%rdi), %r14d
+	#instruction start "261 = proj0 260":
+	#instruction start "262 = proj1 260":
+	#instruction start "263 = int_cast_zero 258":
+	movq %rbx, %rax
+	movq %rax, %r15
+	#instruction start "264 = int_cast_zero 262":
+	movq %r14, %rax
+	movq %rax, %rbx
+	#instruction start "265 = constant(0)":
+	movq $0, %r14
+	#instruction start "266 = constant(-4)":
+	movq $-4, %r12
+	#instruction start "267 = 266 & 264":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	andq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "268 = ~266":
+	movq %r12, %rax
+	notq %rax
+	movq %rax, %rbx
+	#instruction start "269 = 263 << 265":
+	movq %r15, %rax
+	movq %r14, %rcx
+	salq %cl, %rax
+	movq %rax, %r12
+	#instruction start "270 = 268 & 269":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "271 = 270 | 267":
+	movq %r14, %rax
+	movq %r13, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "272 = int_cast_zero 271":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "273 = store 257 272, state: 261":
+	movq -48(%rbp), %rsi
+	movl %r12d, (%rsi)
+	#instruction start "274 = constant(0)":
+	movq $0, %rbx
+	#instruction start "275 = 6 + 274":
+	movq -8(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "276 = load_volatile 275, state: 273":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "277 = proj0 276":
+	#instruction start "278 = proj1 276":
+	#instruction start "279 = int_cast_zero 278":
+	movq %rbx, %rax
+	movq %rax, %r12
+	#instruction start "280 = constant(62)":
+	movq $62, %rbx
+	#instruction start "281 = constant(62)":
+	movq $62, %r13
+	#instruction start "282 = 279 << 280":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "283 = 282 >> 281 (signed)":
+	movq %r14, %rax
+	movq %r13, %rcx
+	sarq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "284 = int_cast_zero 283":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "285 = constant(1)":
+	movl $1, %ebx
+	#instruction start "286 = 284 == 285":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "288 = if 153 286":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L12
+.L11:
+	#instruction start "291 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "292 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "293 = constant(35)":
+	movl $35, %r13d
+	#instruction start "294 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "295 = alloc with size 8":
+	leaq -1028(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "296 = store 295 291, state: 277":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "297 = alloc with size 8":
+	leaq -1036(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "298 = store 297 292, state: 296":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "299 = alloc with size 4":
+	leaq -1040(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "300 = store 299 293, state: 298":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "301 = alloc with size 8":
+	leaq -1048(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "302 = store 301 294, state: 300":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "303 = constant(0)":
+	leaq -56(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "304 = constant(0)":
+	leaq -64(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "305 = load part address of 295 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "306 = proj0 305":
+	#instruction start "307 = proj1 305":
+	#instruction start "308 = load part address of 297 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "309 = proj0 308":
+	#instruction start "310 = proj1 308":
+	#instruction start "311 = load part address of 299 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "312 = proj0 311":
+	#instruction start "313 = proj1 311":
+	#instruction start "314 = load part address of 301 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "315 = proj0 314":
+	#instruction start "316 = proj1 314":
+	#instruction start "317 = allocate_call_stack 0":
+	#instruction start "318 = set_reg %rdi 307":
+	#instruction start "319 = set_reg %rsi 310 state: 318":
+	#instruction start "320 = set_reg %rdx 313 state: 319":
+	#instruction start "321 = set_reg %rcx 316 state: 320":
+	#instruction start "322 = set_reg %rax 304 state: 321":
+	#instruction start "323 = call 303":
+	addq $0, %rsp
+	movq -64(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -56(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "324 = proj0 323":
+	#instruction start "325 = proj1 323":
+	#Block jump
+	jmp .L13
+.L12:
+	#Block jump elided
+.L13:
+	#instruction start "326 = constant(8)":
+	movq $8, %rbx
+	#instruction start "327 = 6 + 326":
+	movq -8(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "328 = constant(0)":
+	movq $0, %rbx
+	#instruction start "329 = 327 + 328":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	#instruction start "330 = constant(3)":
+	movl $3, %ebx
+	#instruction start "331 = phi (region: 287) 277 324":
+	#instruction start "332 = load_volatile 329, state: 331":
+	movq -112(%rbp), %rdi
+	movl (%rdi), %r12d
+	#instruction start "333 = proj0 332":
+	#instruction start "334 = proj1 332":
+	#instruction start "335 = int_cast_zero 330":
+	movq %rbx, %rax
+	movq %rax, %r14
+	#instruction start "336 = int_cast_zero 334":
+	movq %r12, %rax
+	movq %rax, %rbx
+	#instruction start "337 = constant(0)":
+	movq $0, %r12
+	#instruction start "338 = constant(-4)":
+	movq $-4, %r15
+	#instruction start "339 = 338 & 336":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	andq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "340 = ~338":
+	movq %r15, %rax
+	notq %rax
+	movq %rax, %rbx
+	#instruction start "341 = 335 << 337":
+	movq %r14, %rax
+	movq %r12, %rcx
+	salq %cl, %rax
+	movq %rax, %r15
+	#instruction start "342 = 340 & 341":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	andq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "343 = 342 | 339":
+	movq %r12, %rax
+	movq %r13, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "344 = int_cast_zero 343":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "345 = store 329 344, state: 333":
+	movq -112(%rbp), %rsi
+	movl %r12d, (%rsi)
+	#instruction start "346 = constant(8)":
+	movq $8, %rbx
+	#instruction start "347 = 6 + 346":
+	movq -8(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "348 = constant(0)":
+	movq $0, %rbx
+	#instruction start "349 = 347 + 348":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "350 = load_volatile 349, state: 345":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "351 = proj0 350":
+	#instruction start "352 = proj1 350":
+	#instruction start "353 = int_cast_zero 352":
+	movq %rbx, %rax
+	movq %rax, %r12
+	#instruction start "354 = constant(62)":
+	movq $62, %rbx
+	#instruction start "355 = constant(62)":
+	movq $62, %r13
+	#instruction start "356 = 353 << 354":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "357 = 356 >> 355":
+	movq %r14, %rax
+	movq %r13, %rcx
+	shrq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "358 = int_cast_zero 357":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "359 = constant(8)":
+	movq $8, %rbx
+	#instruction start "360 = 6 + 359":
+	movq -8(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "361 = constant(0)":
+	movq $0, %rbx
+	#instruction start "362 = 360 + 361":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "363 = load_volatile 362, state: 351":
+	movq %r14, %rdi
+	movl (%rdi), %ebx
+	#instruction start "364 = proj0 363":
+	#instruction start "365 = proj1 363":
+	#instruction start "366 = int_cast_zero 365":
+	movq %rbx, %rax
+	movq %rax, %r13
+	#instruction start "367 = constant(62)":
+	movq $62, %rbx
+	#instruction start "368 = constant(62)":
+	movq $62, %r14
+	#instruction start "369 = 366 << 367":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r15
+	#instruction start "370 = 369 >> 368":
+	movq %r15, %rax
+	movq %r14, %rcx
+	shrq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "371 = int_cast_zero 370":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "372 = 358 == 371":
+	movq %r12, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %ebx
+	#instruction start "374 = if 287 372":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L15
+.L14:
+	#instruction start "377 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "378 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "379 = constant(38)":
+	movl $38, %r13d
+	#instruction start "380 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "381 = alloc with size 8":
+	leaq -1056(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "382 = store 381 377, state: 364":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "383 = alloc with size 8":
+	leaq -1064(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "384 = store 383 378, state: 382":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "385 = alloc with size 4":
+	leaq -1068(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "386 = store 385 379, state: 384":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "387 = alloc with size 8":
+	leaq -1076(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "388 = store 387 380, state: 386":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "389 = constant(0)":
+	leaq -120(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "390 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "391 = load part address of 381 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "392 = proj0 391":
+	#instruction start "393 = proj1 391":
+	#instruction start "394 = load part address of 383 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "395 = proj0 394":
+	#instruction start "396 = proj1 394":
+	#instruction start "397 = load part address of 385 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "398 = proj0 397":
+	#instruction start "399 = proj1 397":
+	#instruction start "400 = load part address of 387 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "401 = proj0 400":
+	#instruction start "402 = proj1 400":
+	#instruction start "403 = allocate_call_stack 0":
+	#instruction start "404 = set_reg %rdi 393":
+	#instruction start "405 = set_reg %rsi 396 state: 404":
+	#instruction start "406 = set_reg %rdx 399 state: 405":
+	#instruction start "407 = set_reg %rcx 402 state: 406":
+	#instruction start "408 = set_reg %rax 390 state: 407":
+	#instruction start "409 = call 389":
+	addq $0, %rsp
+	movq -128(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -120(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "410 = proj0 409":
+	#instruction start "411 = proj1 409":
+	#Block jump
+	jmp .L16
+.L15:
+	#Block jump elided
+.L16:
+	#instruction start "412 = constant(8)":
+	movq $8, %rbx
+	#instruction start "413 = 6 + 412":
+	movq -8(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "414 = constant(0)":
+	movq $0, %rbx
+	#instruction start "415 = 413 + 414":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "416 = phi (region: 373) 364 410":
+	#instruction start "417 = load_volatile 415, state: 416":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "418 = proj0 417":
+	#instruction start "419 = proj1 417":
+	#instruction start "420 = int_cast_zero 419":
+	movq %rbx, %rax
+	movq %rax, %r12
+	#instruction start "421 = constant(62)":
+	movq $62, %rbx
+	#instruction start "422 = constant(62)":
+	movq $62, %r13
+	#instruction start "423 = 420 << 421":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "424 = 423 >> 422":
+	movq %r14, %rax
+	movq %r13, %rcx
+	shrq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "425 = int_cast_zero 424":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "426 = constant(3)":
+	movl $3, %ebx
+	#instruction start "427 = 425 == 426":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "429 = if 373 427":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L18
+.L17:
+	#instruction start "432 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "433 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "434 = constant(39)":
+	movl $39, %r13d
+	#instruction start "435 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "436 = alloc with size 8":
+	leaq -1084(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "437 = store 436 432, state: 418":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "438 = alloc with size 8":
+	leaq -1092(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "439 = store 438 433, state: 437":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "440 = alloc with size 4":
+	leaq -1096(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "441 = store 440 434, state: 439":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "442 = alloc with size 8":
+	leaq -1104(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "443 = store 442 435, state: 441":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "444 = constant(0)":
+	leaq -176(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "445 = constant(0)":
+	leaq -184(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "446 = load part address of 436 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "447 = proj0 446":
+	#instruction start "448 = proj1 446":
+	#instruction start "449 = load part address of 438 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "450 = proj0 449":
+	#instruction start "451 = proj1 449":
+	#instruction start "452 = load part address of 440 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "453 = proj0 452":
+	#instruction start "454 = proj1 452":
+	#instruction start "455 = load part address of 442 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "456 = proj0 455":
+	#instruction start "457 = proj1 455":
+	#instruction start "458 = allocate_call_stack 0":
+	#instruction start "459 = set_reg %rdi 448":
+	#instruction start "460 = set_reg %rsi 451 state: 459":
+	#instruction start "461 = set_reg %rdx 454 state: 460":
+	#instruction start "462 = set_reg %rcx 457 state: 461":
+	#instruction start "463 = set_reg %rax 445 state: 462":
+	#instruction start "464 = call 444":
+	addq $0, %rsp
+	movq -184(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -176(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "465 = proj0 464":
+	#instruction start "466 = proj1 464":
+	#Block jump
+	jmp .L19
+.L18:
+	#Block jump elided
+.L19:
+	#instruction start "467 = alloc with size 4":
+	leaq -1108(%rbp), %rsi
+	movq %rsi, -232(%rbp)
+	#instruction start "468 = phi (region: 428) 418 465":
+	#instruction start "469 = set_zero_ptr 467, size: 4":
+	movq -232(%rbp), %rdi
+	movl $0, (%rdi)
+	#instruction start "472 = constant(0)":
+	movq $0, %r12
+	#instruction start "473 = 467 + 472":
+	movq -232(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	#instruction start "474 = constant(1)":
+	movl $1, %r12d
+	#instruction start "475 = load_volatile 473, state: 469":
+	movq -240(%rbp), %rdi
+	movl (%rdi), %r14d
+	#instruction start "476 = proj0 475":
+	#instruction start "477 = proj1 475":
+	#instruction start "478 = int_cast_zero 474":
+	movq %r12, %rax
+	movq %rax, %r15
+	#instruction start "479 = int_cast_zero 477":
+	movq %r14, %rax
+	movq %rax, %r12
+	#instruction start "480 = constant(1)":
+	movq $1, %r14
+	#instruction start "481 = constant(-3)":
+	movq $-3, %rbx
+	#instruction start "482 = 481 & 479":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	andq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "483 = ~481":
+	movq %rbx, %rax
+	notq %rax
+	movq %rax, %r12
+	#instruction start "484 = 478 << 480":
+	movq %r15, %rax
+	movq %r14, %rcx
+	salq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "485 = 483 & 484":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "486 = 485 | 482":
+	movq %r14, %rax
+	movq %r13, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "487 = int_cast_zero 486":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "488 = store 473 487, state: 476":
+	movq -240(%rbp), %rsi
+	movl %r12d, (%rsi)
+	#instruction start "489 = constant(0)":
+	movq $0, %rbx
+	#instruction start "490 = 467 + 489":
+	movq -232(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "491 = load_volatile 490, state: 488":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "492 = proj0 491":
+	#instruction start "493 = proj1 491":
+	#instruction start "494 = int_cast_zero 493":
+	movq %rbx, %rax
+	movq %rax, %r12
+	#instruction start "495 = constant(62)":
+	movq $62, %rbx
+	#instruction start "496 = constant(63)":
+	movq $63, %r13
+	#instruction start "497 = 494 << 495":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "498 = 497 >> 496":
+	movq %r14, %rax
+	movq %r13, %rcx
+	shrq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "499 = int_cast_zero 498":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "500 = constant(1)":
+	movl $1, %ebx
+	#instruction start "501 = 499 == 500":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "503 = if 428 501":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L21
+.L20:
+	#instruction start "506 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "507 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "508 = constant(46)":
+	movl $46, %r13d
+	#instruction start "509 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "510 = alloc with size 8":
+	leaq -1116(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "511 = store 510 506, state: 492":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "512 = alloc with size 8":
+	leaq -1124(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "513 = store 512 507, state: 511":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "514 = alloc with size 4":
+	leaq -1128(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "515 = store 514 508, state: 513":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "516 = alloc with size 8":
+	leaq -1136(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "517 = store 516 509, state: 515":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "518 = constant(0)":
+	leaq -248(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "519 = constant(0)":
+	leaq -256(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "520 = load part address of 510 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "521 = proj0 520":
+	#instruction start "522 = proj1 520":
+	#instruction start "523 = load part address of 512 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "524 = proj0 523":
+	#instruction start "525 = proj1 523":
+	#instruction start "526 = load part address of 514 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "527 = proj0 526":
+	#instruction start "528 = proj1 526":
+	#instruction start "529 = load part address of 516 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "530 = proj0 529":
+	#instruction start "531 = proj1 529":
+	#instruction start "532 = allocate_call_stack 0":
+	#instruction start "533 = set_reg %rdi 522":
+	#instruction start "534 = set_reg %rsi 525 state: 533":
+	#instruction start "535 = set_reg %rdx 528 state: 534":
+	#instruction start "536 = set_reg %rcx 531 state: 535":
+	#instruction start "537 = set_reg %rax 519 state: 536":
+	#instruction start "538 = call 518":
+	addq $0, %rsp
+	movq -256(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -248(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "539 = proj0 538":
+	#instruction start "540 = proj1 538":
+	#Block jump
+	jmp .L22
+.L21:
+	#Block jump elided
+.L22:
+	#instruction start "541 = constant(8)":
+	movq $.LVAR0t, %rbx
+	#instruction start "542 = constant(0)":
+	movq $0, %r12
+	#instruction start "543 = 541 + 542":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "544 = phi (region: 502) 492 539":
+	#instruction start "545 = load_volatile 543, state: 544":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "546 = proj0 545":
+	#instruction start "547 = proj1 545":
+	#instruction start "548 = int_cast_zero 547":
+	movq %rbx, %rax
+	movq %rax, %r12
+	#instruction start "549 = constant(62)":
+	movq $62, %rbx
+	#instruction start "550 = constant(63)":
+	movq $63, %r13
+	#instruction start "551 = 548 << 549":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "552 = 551 >> 550":
+	movq %r14, %rax
+	movq %r13, %rcx
+	shrq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "553 = int_cast_zero 552":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "554 = constant(1)":
+	movl $1, %ebx
+	#instruction start "555 = 553 == 554":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "557 = if 502 555":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L24
+.L23:
+	#instruction start "560 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "561 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "562 = constant(53)":
+	movl $53, %r13d
+	#instruction start "563 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "564 = alloc with size 8":
+	leaq -1144(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "565 = store 564 560, state: 546":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "566 = alloc with size 8":
+	leaq -1152(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "567 = store 566 561, state: 565":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "568 = alloc with size 4":
+	leaq -1156(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "569 = store 568 562, state: 567":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "570 = alloc with size 8":
+	leaq -1164(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "571 = store 570 563, state: 569":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "572 = constant(0)":
+	leaq -304(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "573 = constant(0)":
+	leaq -312(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "574 = load part address of 564 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "575 = proj0 574":
+	#instruction start "576 = proj1 574":
+	#instruction start "577 = load part address of 566 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "578 = proj0 577":
+	#instruction start "579 = proj1 577":
+	#instruction start "580 = load part address of 568 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "581 = proj0 580":
+	#instruction start "582 = proj1 580":
+	#instruction start "583 = load part address of 570 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "584 = proj0 583":
+	#instruction start "585 = proj1 583":
+	#instruction start "586 = allocate_call_stack 0":
+	#instruction start "587 = set_reg %rdi 576":
+	#instruction start "588 = set_reg %rsi 579 state: 587":
+	#instruction start "589 = set_reg %rdx 582 state: 588":
+	#instruction start "590 = set_reg %rcx 585 state: 589":
+	#instruction start "591 = set_reg %rax 573 state: 590":
+	#instruction start "592 = call 572":
+	addq $0, %rsp
+	movq -312(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -304(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "593 = proj0 592":
+	#instruction start "594 = proj1 592":
+	#Block jump
+	jmp .L25
+.L24:
+	#Block jump elided
+.L25:
+	#instruction start "595 = constant(9)":
+	movq $.LVAR1a, %rbx
+	#instruction start "596 = constant(0)":
+	movq $0, %r12
+	#instruction start "597 = 595 + 596":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "598 = phi (region: 556) 546 593":
+	#instruction start "599 = load_volatile 597, state: 598":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "600 = proj0 599":
+	#instruction start "601 = proj1 599":
+	#instruction start "602 = int_cast_zero 601":
+	movq %rbx, %rax
+	movq %rax, %r12
+	#instruction start "603 = constant(62)":
+	movq $62, %rbx
+	#instruction start "604 = constant(62)":
+	movq $62, %r13
+	#instruction start "605 = 602 << 603":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "606 = 605 >> 604 (signed)":
+	movq %r14, %rax
+	movq %r13, %rcx
+	sarq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "607 = int_cast_zero 606":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "608 = constant(1)":
+	movl $1, %ebx
+	#instruction start "609 = 607 == 608":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "610 = if 556 609":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L27
+.L26:
+	#instruction start "638 = alloc with size 4":
+	leaq -1168(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "639 = constant(0)":
+	movl $0, %r12d
+	#instruction start "640 = store 638 639, state: 600":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 642 (641 637 638)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L31
+.L27:
+	#instruction start "613 = constant(9)":
+	movq $.LVAR1a, %rbx
+	#instruction start "614 = constant(0)":
+	movq $0, %r13
+	#instruction start "615 = 613 + 614":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "616 = load_volatile 615, state: 600":
+	movq %r14, %rdi
+	movl (%rdi), %ebx
+	#instruction start "617 = proj0 616":
+	#instruction start "618 = proj1 616":
+	#instruction start "619 = int_cast_zero 618":
+	movq %rbx, %rax
+	movq %rax, %r13
+	#instruction start "620 = constant(59)":
+	movq $59, %rbx
+	#instruction start "621 = constant(62)":
+	movq $62, %r14
+	#instruction start "622 = 619 << 620":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r15
+	#instruction start "623 = 622 >> 621 (signed)":
+	movq %r15, %rax
+	movq %r14, %rcx
+	sarq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "624 = int_cast_zero 623":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "625 = constant(1)":
+	movl $1, %ebx
+	#instruction start "626 = 624 == 625":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "627 = if 612 626":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L29
+.L28:
+	#instruction start "633 = alloc with size 4":
+	leaq -1172(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "634 = constant(0)":
+	movl $0, %r13d
+	#instruction start "635 = store 633 634, state: 617":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 637 (636 630 633)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L30
+.L29:
+	#instruction start "630 = alloc with size 4":
+	leaq -1176(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "631 = constant(1)":
+	movl $1, %r14d
+	#instruction start "632 = store 630 631, state: 617":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 637 (636 630 633)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L30:
+	#instruction start "637 = phi (region: 636) 630 633":
+	#instruction start "644 = phi (region: 636) 632 635":
+	#Phi node to 642 (641 637 638)
+	movq %r13, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L31:
+	#instruction start "642 = phi (region: 641) 637 638":
+	#instruction start "643 = phi (region: 641) 644 640":
+	#instruction start "645 = load_volatile 642, state: 643":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "646 = proj0 645":
+	#instruction start "647 = proj1 645":
+	#instruction start "649 = if 641 647":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L33
+.L32:
+	#instruction start "652 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "653 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "654 = constant(67)":
+	movl $67, %r13d
+	#instruction start "655 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "656 = alloc with size 8":
+	leaq -1184(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "657 = store 656 652, state: 646":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "658 = alloc with size 8":
+	leaq -1192(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "659 = store 658 653, state: 657":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "660 = alloc with size 4":
+	leaq -1196(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "661 = store 660 654, state: 659":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "662 = alloc with size 8":
+	leaq -1204(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "663 = store 662 655, state: 661":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "664 = constant(0)":
+	leaq -360(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "665 = constant(0)":
+	leaq -368(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "666 = load part address of 656 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "667 = proj0 666":
+	#instruction start "668 = proj1 666":
+	#instruction start "669 = load part address of 658 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "670 = proj0 669":
+	#instruction start "671 = proj1 669":
+	#instruction start "672 = load part address of 660 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "673 = proj0 672":
+	#instruction start "674 = proj1 672":
+	#instruction start "675 = load part address of 662 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "676 = proj0 675":
+	#instruction start "677 = proj1 675":
+	#instruction start "678 = allocate_call_stack 0":
+	#instruction start "679 = set_reg %rdi 668":
+	#instruction start "680 = set_reg %rsi 671 state: 679":
+	#instruction start "681 = set_reg %rdx 674 state: 680":
+	#instruction start "682 = set_reg %rcx 677 state: 681":
+	#instruction start "683 = set_reg %rax 665 state: 682":
+	#instruction start "684 = call 664":
+	addq $0, %rsp
+	movq -368(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -360(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "685 = proj0 684":
+	#instruction start "686 = proj1 684":
+	#Block jump
+	jmp .L34
+.L33:
+	#Block jump elided
+.L34:
+	#instruction start "687 = constant(11)":
+	movq $.LVAR2t, %rbx
+	#instruction start "688 = constant(0)":
+	movq $0, %r12
+	#instruction start "689 = 687 + 688":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	#instruction start "690 = constant(1)":
+	movl $1, %ebx
+	#instruction start "691 = int_cast_zero 690":
+	movq %rbx, %rax
+	movzbl %al, %r12d
+	#instruction start "692 = phi (region: 648) 646 685":
+	#instruction start "693 = load_volatile 689, state: 692":
+	movq -416(%rbp), %rdi
+	movzbl (%rdi), %ebx
+	#instruction start "694 = proj0 693":
+	#instruction start "695 = proj1 693":
+	#instruction start "696 = int_cast_zero 691":
+	movq %r12, %rax
+	movq %rax, %r14
+	#instruction start "697 = int_cast_zero 695":
+	movq %rbx, %rax
+	movq %rax, %r12
+	#instruction start "698 = constant(0)":
+	movq $0, %rbx
+	#instruction start "699 = constant(-4)":
+	movq $-4, %r15
+	#instruction start "700 = 699 & 697":
+	movq %r15, %rax
+	movq %r12, %rcx
+	andq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "701 = ~699":
+	movq %r15, %rax
+	notq %rax
+	movq %rax, %r12
+	#instruction start "702 = 696 << 698":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r15
+	#instruction start "703 = 701 & 702":
+	movq %r12, %rax
+	movq %r15, %rcx
+	andq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "704 = 703 | 700":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	orq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "705 = int_cast_zero 704":
+	movq %r12, %rax
+	movzbl %al, %ebx
+	#instruction start "706 = store 689 705, state: 694":
+	movq -416(%rbp), %rsi
+	movb %bl, (%rsi)
+	#instruction start "707 = constant(11)":
+	movq $.LVAR2t, %rbx
+	#instruction start "708 = constant(0)":
+	movq $0, %r12
+	#instruction start "709 = 707 + 708":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, -424(%rbp)
+	#instruction start "710 = constant(5)":
+	movl $5, %ebx
+	#instruction start "711 = int_cast_zero 710":
+	movq %rbx, %rax
+	movzbl %al, %r12d
+	#instruction start "712 = load_volatile 709, state: 706":
+	movq -424(%rbp), %rdi
+	movzbl (%rdi), %ebx
+	#instruction start "713 = proj0 712":
+	#instruction start "714 = proj1 712":
+	#instruction start "715 = int_cast_zero 711":
+	movq %r12, %rax
+	movq %rax, %r14
+	#instruction start "716 = int_cast_zero 714":
+	movq %rbx, %rax
+	movq %rax, %r12
+	#instruction start "717 = constant(2)":
+	movq $2, %rbx
+	#instruction start "718 = constant(-61)":
+	movq $-61, %r15
+	#instruction start "719 = 718 & 716":
+	movq %r15, %rax
+	movq %r12, %rcx
+	andq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "720 = ~718":
+	movq %r15, %rax
+	notq %rax
+	movq %rax, %r12
+	#instruction start "721 = 715 << 717":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r15
+	#instruction start "722 = 720 & 721":
+	movq %r12, %rax
+	movq %r15, %rcx
+	andq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "723 = 722 | 719":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	orq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "724 = int_cast_zero 723":
+	movq %r12, %rax
+	movzbl %al, %ebx
+	#instruction start "725 = store 709 724, state: 713":
+	movq -424(%rbp), %rsi
+	movb %bl, (%rsi)
+	#instruction start "726 = constant(11)":
+	movq $.LVAR2t, %rbx
+	#instruction start "727 = constant(0)":
+	movq $0, %r12
+	#instruction start "728 = 726 + 727":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "729 = load_volatile 728, state: 725":
+	movq %r13, %rdi
+	movzbl (%rdi), %ebx
+	#instruction start "730 = proj0 729":
+	#instruction start "731 = proj1 729":
+	#instruction start "732 = int_cast_zero 731":
+	movq %rbx, %rax
+	movq %rax, %r12
+	#instruction start "733 = constant(62)":
+	movq $62, %rbx
+	#instruction start "734 = constant(62)":
+	movq $62, %r13
+	#instruction start "735 = 732 << 733":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "736 = 735 >> 734 (signed)":
+	movq %r14, %rax
+	movq %r13, %rcx
+	sarq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "737 = int_cast_zero 736":
+	movq %rbx, %rax
+	movzbl %al, %r12d
+	#instruction start "738 = int_cast_zero 737":
+	movq %r12, %rax
+	movsbq %al, %rax
+	movl %eax, %ebx
+	#instruction start "739 = constant(1)":
+	movl $1, %r12d
+	#instruction start "740 = 738 == 739":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "742 = if 648 740":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L36
+.L35:
+	#instruction start "745 = constant(12)":
+	movq $.Ls12, %rbx
+	#instruction start "746 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "747 = constant(75)":
+	movl $75, %r13d
+	#instruction start "748 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "749 = alloc with size 8":
+	leaq -1212(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "750 = store 749 745, state: 730":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "751 = alloc with size 8":
+	leaq -1220(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "752 = store 751 746, state: 750":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "753 = alloc with size 4":
+	leaq -1224(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "754 = store 753 747, state: 752":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "755 = alloc with size 8":
+	leaq -1232(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "756 = store 755 748, state: 754":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "757 = constant(0)":
+	leaq -432(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "758 = constant(0)":
+	leaq -440(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "759 = load part address of 749 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "760 = proj0 759":
+	#instruction start "761 = proj1 759":
+	#instruction start "762 = load part address of 751 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "763 = proj0 762":
+	#instruction start "764 = proj1 762":
+	#instruction start "765 = load part address of 753 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "766 = proj0 765":
+	#instruction start "767 = proj1 765":
+	#instruction start "768 = load part address of 755 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "769 = proj0 768":
+	#instruction start "770 = proj1 768":
+	#instruction start "771 = allocate_call_stack 0":
+	#instruction start "772 = set_reg %rdi 761":
+	#instruction start "773 = set_reg %rsi 764 state: 772":
+	#instruction start "774 = set_reg %rdx 767 state: 773":
+	#instruction start "775 = set_reg %rcx 770 state: 774":
+	#instruction start "776 = set_reg %rax 758 state: 775":
+	#instruction start "777 = call 757":
+	addq $0, %rsp
+	movq -440(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -432(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "778 = proj0 777":
+	#instruction start "779 = proj1 777":
+	#Block jump
+	jmp .L37
+.L36:
+	#Block jump elided
+.L37:
+	#instruction start "780 = constant(11)":
+	movq $.LVAR2t, %rbx
+	#instruction start "781 = constant(0)":
+	movq $0, %r12
+	#instruction start "782 = 780 + 781":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "783 = phi (region: 741) 730 778":
+	#instruction start "784 = load_volatile 782, state: 783":
+	movq %r13, %rdi
+	movzbl (%rdi), %ebx
+	#instruction start "785 = proj0 784":
+	#instruction start "786 = proj1 784":
+	#instruction start "787 = int_cast_zero 786":
+	movq %rbx, %rax
+	movq %rax, %r12
+	#instruction start "788 = constant(58)":
+	movq $58, %rbx
+	#instruction start "789 = constant(60)":
+	movq $60, %r13
+	#instruction start "790 = 787 << 788":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "791 = 790 >> 789 (signed)":
+	movq %r14, %rax
+	movq %r13, %rcx
+	sarq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "792 = int_cast_zero 791":
+	movq %rbx, %rax
+	movzbl %al, %r12d
+	#instruction start "793 = int_cast_zero 792":
+	movq %r12, %rax
+	movsbq %al, %rax
+	movl %eax, %ebx
+	#instruction start "794 = constant(5)":
+	movl $5, %r12d
+	#instruction start "795 = 793 == 794":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "797 = if 741 795":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L39
+.L38:
+	#instruction start "800 = constant(13)":
+	movq $.Ls13, %rbx
+	#instruction start "801 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "802 = constant(76)":
+	movl $76, %r13d
+	#instruction start "803 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "804 = alloc with size 8":
+	leaq -1240(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "805 = store 804 800, state: 785":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "806 = alloc with size 8":
+	leaq -1248(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "807 = store 806 801, state: 805":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "808 = alloc with size 4":
+	leaq -1252(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "809 = store 808 802, state: 807":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "810 = alloc with size 8":
+	leaq -1260(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "811 = store 810 803, state: 809":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "812 = constant(0)":
+	leaq -488(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "813 = constant(0)":
+	leaq -496(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "814 = load part address of 804 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "815 = proj0 814":
+	#instruction start "816 = proj1 814":
+	#instruction start "817 = load part address of 806 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "818 = proj0 817":
+	#instruction start "819 = proj1 817":
+	#instruction start "820 = load part address of 808 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "821 = proj0 820":
+	#instruction start "822 = proj1 820":
+	#instruction start "823 = load part address of 810 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "824 = proj0 823":
+	#instruction start "825 = proj1 823":
+	#instruction start "826 = allocate_call_stack 0":
+	#instruction start "827 = set_reg %rdi 816":
+	#instruction start "828 = set_reg %rsi 819 state: 827":
+	#instruction start "829 = set_reg %rdx 822 state: 828":
+	#instruction start "830 = set_reg %rcx 825 state: 829":
+	#instruction start "831 = set_reg %rax 813 state: 830":
+	#instruction start "832 = call 812":
+	addq $0, %rsp
+	movq -496(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -488(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "833 = proj0 832":
+	#instruction start "834 = proj1 832":
+	#Block jump
+	jmp .L40
+.L39:
+	#Block jump elided
+.L40:
+	#instruction start "835 = alloc with size 4":
+	leaq -1264(%rbp), %rsi
+	movq %rsi, -544(%rbp)
+	#instruction start "836 = phi (region: 796) 785 833":
+	#instruction start "837 = set_zero_ptr 835, size: 4":
+	movq -544(%rbp), %rdi
+	movl $0, (%rdi)
+	#instruction start "838 = constant(0)":
+	movq $0, %r12
+	#instruction start "839 = 835 + 838":
+	movq -544(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, -552(%rbp)
+	#instruction start "840 = constant(2)":
+	movl $2, %r12d
+	#instruction start "841 = load_volatile 839, state: 837":
+	movq -552(%rbp), %rdi
+	movl (%rdi), %r14d
+	#instruction start "842 = proj0 841":
+	#instruction start "843 = proj1 841":
+	#instruction start "844 = int_cast_zero 840":
+	movq %r12, %rax
+	movq %rax, %r15
+	#instruction start "845 = int_cast_zero 843":
+	movq %r14, %rax
+	movq %rax, %r12
+	#instruction start "846 = constant(0)":
+	movq $0, %r14
+	#instruction start "847 = constant(-16)":
+	movq $-16, %rbx
+	#instruction start "848 = 847 & 845":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	andq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "849 = ~847":
+	movq %rbx, %rax
+	notq %rax
+	movq %rax, %r12
+	#instruction start "850 = 844 << 846":
+	movq %r15, %rax
+	movq %r14, %rcx
+	salq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "851 = 849 & 850":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "852 = 851 | 848":
+	movq %r14, %rax
+	movq %r13, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "853 = int_cast_zero 852":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "854 = store 839 853, state: 842":
+	movq -552(%rbp), %rsi
+	movl %r12d, (%rsi)
+	#instruction start "855 = alloc with size 256":
+	leaq -1520(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "858 = constant(15)":
+	movq $.Ls15, %r12
+	#instruction start "859 = constant(0)":
+	movq $0, %r13
+	#instruction start "860 = 835 + 859":
+	movq -544(%rbp), %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "861 = alloc with size 8":
+	leaq -1528(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "862 = store 861 855, state: 854":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "863 = alloc with size 8":
+	leaq -1536(%rbp), %rsi
+	movq %rsi, -560(%rbp)
+	#instruction start "864 = store 863 858, state: 862":
+	movq -560(%rbp), %rsi
+	movq %r12, (%rsi)
+	#instruction start "865 = load_volatile 860, state: 864":
+	movq %r14, %rdi
+	movl (%rdi), %r12d
+	#instruction start "866 = proj0 865":
+	#instruction start "867 = proj1 865":
+	#instruction start "868 = int_cast_zero 867":
+	movq %r12, %rax
+	movq %rax, %r14
+	#instruction start "869 = constant(60)":
+	movq $60, %r12
+	#instruction start "870 = constant(60)":
+	movq $60, %r15
+	#instruction start "871 = 868 << 869":
+	movq %r14, %rax
+	movq %r12, %rcx
+	salq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "872 = 871 >> 870 (signed)":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	sarq %cl, %rax
+	movq %rax, %r12
+	#instruction start "873 = int_cast_zero 872":
+	movq %r12, %rax
+	movl %eax, %ebx
+	#instruction start "874 = alloc with size 4":
+	leaq -1540(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "875 = store 874 873, state: 866":
+	movq %r12, %rsi
+	movl %ebx, (%rsi)
+	#instruction start "876 = constant(14)":
+	leaq -568(%rbp), %rdi
+	movq $sprintf, (%rdi)
+	#instruction start "877 = constant(0)":
+	movq $0, %r14
+	#instruction start "878 = load part address of 861 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "879 = proj0 878":
+	#instruction start "880 = proj1 878":
+	#instruction start "881 = load part address of 863 with offset 0":
+	movq -560(%rbp), %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "882 = proj0 881":
+	#instruction start "883 = proj1 881":
+	#instruction start "884 = load part address of 874 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "885 = proj0 884":
+	#instruction start "886 = proj1 884":
+	#instruction start "887 = allocate_call_stack 0":
+	#instruction start "888 = set_reg %rdi 880":
+	#instruction start "889 = set_reg %rsi 883 state: 888":
+	#instruction start "890 = set_reg %rdx 886 state: 889":
+	#instruction start "891 = set_reg %rax 877 state: 890":
+	#instruction start "892 = call 876":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %rbx, %rdx
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq -568(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r12
+	#instruction start "893 = proj0 892":
+	#instruction start "894 = proj1 892":
+	#instruction start "895 = %rax":
+	#instruction start "896 = int_cast_zero 895":
+	movq %r12, %rax
+	movl %eax, %ebx
+	#instruction start "899 = constant(0)":
+	movl $0, %r12d
+	#instruction start "900 = 896 > 899 (signed)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "902 = if 796 900":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L42
+.L41:
+	#instruction start "905 = constant(16)":
+	movq $.Ls16, %rbx
+	#instruction start "906 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "907 = constant(87)":
+	movl $87, %r13d
+	#instruction start "908 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "909 = alloc with size 8":
+	leaq -1548(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "910 = store 909 905, state: 893":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "911 = alloc with size 8":
+	leaq -1556(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "912 = store 911 906, state: 910":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "913 = alloc with size 4":
+	leaq -1560(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "914 = store 913 907, state: 912":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "915 = alloc with size 8":
+	leaq -1568(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "916 = store 915 908, state: 914":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "917 = constant(0)":
+	leaq -608(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "918 = constant(0)":
+	leaq -616(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "919 = load part address of 909 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "920 = proj0 919":
+	#instruction start "921 = proj1 919":
+	#instruction start "922 = load part address of 911 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "923 = proj0 922":
+	#instruction start "924 = proj1 922":
+	#instruction start "925 = load part address of 913 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "926 = proj0 925":
+	#instruction start "927 = proj1 925":
+	#instruction start "928 = load part address of 915 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "929 = proj0 928":
+	#instruction start "930 = proj1 928":
+	#instruction start "931 = allocate_call_stack 0":
+	#instruction start "932 = set_reg %rdi 921":
+	#instruction start "933 = set_reg %rsi 924 state: 932":
+	#instruction start "934 = set_reg %rdx 927 state: 933":
+	#instruction start "935 = set_reg %rcx 930 state: 934":
+	#instruction start "936 = set_reg %rax 918 state: 935":
+	#instruction start "937 = call 917":
+	addq $0, %rsp
+	movq -616(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -608(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "938 = proj0 937":
+	#instruction start "939 = proj1 937":
+	#Block jump
+	jmp .L43
+.L42:
+	#Block jump elided
+.L43:
+	#instruction start "940 = alloc with size 4":
+	leaq -1572(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "941 = constant(0)":
+	movq $0, %r12
+	#instruction start "942 = 940 + 941":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "943 = phi (region: 901) 893 938":
+	#instruction start "944 = load_volatile 942, state: 943":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "945 = proj0 944":
+	#instruction start "946 = proj1 944":
+	#instruction start "947 = int_cast_zero 946":
+	movq %rbx, %rax
+	movq %rax, %r12
+	#instruction start "948 = constant(41)":
+	movq $41, %rbx
+	#instruction start "949 = constant(41)":
+	movq $41, %r13
+	#instruction start "950 = 947 << 948":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "951 = 950 >> 949":
+	movq %r14, %rax
+	movq %r13, %rcx
+	shrq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "952 = int_cast_zero 951":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "953 = constant(-1)":
+	movl $4294967295, %ebx
+	#instruction start "954 = 952 > 953 (signed)":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "956 = if 901 954":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L45
+.L44:
+	#instruction start "959 = constant(17)":
+	movq $.Ls17, %rbx
+	#instruction start "960 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "961 = constant(94)":
+	movl $94, %r13d
+	#instruction start "962 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "963 = alloc with size 8":
+	leaq -1580(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "964 = store 963 959, state: 945":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "965 = alloc with size 8":
+	leaq -1588(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "966 = store 965 960, state: 964":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "967 = alloc with size 4":
+	leaq -1592(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "968 = store 967 961, state: 966":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "969 = alloc with size 8":
+	leaq -1600(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "970 = store 969 962, state: 968":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "971 = constant(0)":
+	leaq -664(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "972 = constant(0)":
+	leaq -672(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "973 = load part address of 963 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "974 = proj0 973":
+	#instruction start "975 = proj1 973":
+	#instruction start "976 = load part address of 965 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "977 = proj0 976":
+	#instruction start "978 = proj1 976":
+	#instruction start "979 = load part address of 967 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "980 = proj0 979":
+	#instruction start "981 = proj1 979":
+	#instruction start "982 = load part address of 969 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "983 = proj0 982":
+	#instruction start "984 = proj1 982":
+	#instruction start "985 = allocate_call_stack 0":
+	#instruction start "986 = set_reg %rdi 975":
+	#instruction start "987 = set_reg %rsi 978 state: 986":
+	#instruction start "988 = set_reg %rdx 981 state: 987":
+	#instruction start "989 = set_reg %rcx 984 state: 988":
+	#instruction start "990 = set_reg %rax 972 state: 989":
+	#instruction start "991 = call 971":
+	addq $0, %rsp
+	movq -672(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -664(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "992 = proj0 991":
+	#instruction start "993 = proj1 991":
+	#Block jump
+	jmp .L46
+.L45:
+	#Block jump elided
+.L46:
+	#instruction start "995 = constant(1)":
+	movl $1, %ebx
+	#instruction start "997 = if 955 995":
+	#instruction start "1005 = phi (region: 955) 945 992":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L48
+.L47:
+	#instruction start "1000 = constant(18)":
+	movq $.Ls18, %rbx
+	#instruction start "1001 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "1002 = constant(104)":
+	movl $104, %r13d
+	#instruction start "1003 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "1004 = alloc with size 8":
+	leaq -1608(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1006 = store 1004 1000, state: 1005":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1007 = alloc with size 8":
+	leaq -1616(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1008 = store 1007 1001, state: 1006":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1009 = alloc with size 4":
+	leaq -1620(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1010 = store 1009 1002, state: 1008":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1011 = alloc with size 8":
+	leaq -1628(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1012 = store 1011 1003, state: 1010":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1013 = constant(0)":
+	leaq -720(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1014 = constant(0)":
+	leaq -728(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1015 = load part address of 1004 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1016 = proj0 1015":
+	#instruction start "1017 = proj1 1015":
+	#instruction start "1018 = load part address of 1007 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1019 = proj0 1018":
+	#instruction start "1020 = proj1 1018":
+	#instruction start "1021 = load part address of 1009 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1022 = proj0 1021":
+	#instruction start "1023 = proj1 1021":
+	#instruction start "1024 = load part address of 1011 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1025 = proj0 1024":
+	#instruction start "1026 = proj1 1024":
+	#instruction start "1027 = allocate_call_stack 0":
+	#instruction start "1028 = set_reg %rdi 1017":
+	#instruction start "1029 = set_reg %rsi 1020 state: 1028":
+	#instruction start "1030 = set_reg %rdx 1023 state: 1029":
+	#instruction start "1031 = set_reg %rcx 1026 state: 1030":
+	#instruction start "1032 = set_reg %rax 1014 state: 1031":
+	#instruction start "1033 = call 1013":
+	addq $0, %rsp
+	movq -728(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -720(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1034 = proj0 1033":
+	#instruction start "1035 = proj1 1033":
+	#Block jump
+	jmp .L49
+.L48:
+	#Block jump elided
+.L49:
+	#instruction start "1036 = alloc with size 14":
+	leaq -1642(%rbp), %rsi
+	movq %rsi, -776(%rbp)
+	#instruction start "1037 = phi (region: 996) 1005 1034":
+	#instruction start "1038 = set_zero_ptr 1036, size: 14":
+	movq -776(%rbp), %rdi
+	movq $0, (%rdi)
+	movl $0, 8(%rdi)
+	movw $0, 12(%rdi)
+	#instruction start "1039 = constant(0)":
+	movq $0, %r12
+	#instruction start "1040 = 1036 + 1039":
+	movq -776(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, -784(%rbp)
+	#instruction start "1041 = constant(1)":
+	movl $1, %r12d
+	#instruction start "1042 = load_volatile 1040, state: 1038":
+	movq -784(%rbp), %rdi
+	movzwl (%rdi), %r14d
+	#instruction start "1043 = proj0 1042":
+	#instruction start "1044 = proj1 1042":
+	#instruction start "1045 = int_cast_zero 1041":
+	movq %r12, %rax
+	movq %rax, %r15
+	#instruction start "1046 = int_cast_zero 1044":
+	movq %r14, %rax
+	movq %rax, %r12
+	#instruction start "1047 = constant(0)":
+	movq $0, %r14
+	#instruction start "1048 = constant(-2048)":
+	movq $-2048, %rbx
+	#instruction start "1049 = 1048 & 1046":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	andq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1050 = ~1048":
+	movq %rbx, %rax
+	notq %rax
+	movq %rax, %r12
+	#instruction start "1051 = 1045 << 1047":
+	movq %r15, %rax
+	movq %r14, %rcx
+	salq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "1052 = 1050 & 1051":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1053 = 1052 | 1049":
+	movq %r14, %rax
+	movq %r13, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "1054 = int_cast_zero 1053":
+	movq %rbx, %rax
+	movzwl %ax, %r12d
+	#instruction start "1055 = store 1040 1054, state: 1043":
+	movq -784(%rbp), %rsi
+	movw %r12w, (%rsi)
+	#instruction start "1056 = constant(0)":
+	movq $0, %rbx
+	#instruction start "1057 = 1036 + 1056":
+	movq -776(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, -792(%rbp)
+	#instruction start "1058 = constant(1)":
+	movl $1, %ebx
+	#instruction start "1059 = load_volatile 1057, state: 1055":
+	movq -792(%rbp), %rdi
+	movzwl (%rdi), %r13d
+	#instruction start "1060 = proj0 1059":
+	#instruction start "1061 = proj1 1059":
+	#instruction start "1062 = int_cast_zero 1058":
+	movq %rbx, %rax
+	movq %rax, %r14
+	#instruction start "1063 = int_cast_zero 1061":
+	movq %r13, %rax
+	movq %rax, %rbx
+	#instruction start "1064 = constant(11)":
+	movq $11, %r13
+	#instruction start "1065 = constant(-30721)":
+	movq $-30721, %r15
+	#instruction start "1066 = 1065 & 1063":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	andq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "1067 = ~1065":
+	movq %r15, %rax
+	notq %rax
+	movq %rax, %rbx
+	#instruction start "1068 = 1062 << 1064":
+	movq %r14, %rax
+	movq %r13, %rcx
+	salq %cl, %rax
+	movq %rax, %r15
+	#instruction start "1069 = 1067 & 1068":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	andq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1070 = 1069 | 1066":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "1071 = int_cast_zero 1070":
+	movq %rbx, %rax
+	movzwl %ax, %r12d
+	#instruction start "1072 = store 1057 1071, state: 1060":
+	movq -792(%rbp), %rsi
+	movw %r12w, (%rsi)
+	#instruction start "1073 = constant(2)":
+	movq $2, %rbx
+	#instruction start "1074 = 1036 + 1073":
+	movq -776(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, -800(%rbp)
+	#instruction start "1075 = constant(1)":
+	movl $1, %ebx
+	#instruction start "1076 = load_volatile 1074, state: 1072":
+	movq -800(%rbp), %rdi
+	movzbl (%rdi), %r13d
+	#instruction start "1077 = proj0 1076":
+	#instruction start "1078 = proj1 1076":
+	#instruction start "1079 = int_cast_zero 1075":
+	movq %rbx, %rax
+	movq %rax, %r14
+	#instruction start "1080 = int_cast_zero 1078":
+	movq %r13, %rax
+	movq %rax, %rbx
+	#instruction start "1081 = constant(0)":
+	movq $0, %r13
+	#instruction start "1082 = constant(-8)":
+	movq $-8, %r15
+	#instruction start "1083 = 1082 & 1080":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	andq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "1084 = ~1082":
+	movq %r15, %rax
+	notq %rax
+	movq %rax, %rbx
+	#instruction start "1085 = 1079 << 1081":
+	movq %r14, %rax
+	movq %r13, %rcx
+	salq %cl, %rax
+	movq %rax, %r15
+	#instruction start "1086 = 1084 & 1085":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	andq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1087 = 1086 | 1083":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "1088 = int_cast_zero 1087":
+	movq %rbx, %rax
+	movzbl %al, %r12d
+	#instruction start "1089 = store 1074 1088, state: 1077":
+	movq -800(%rbp), %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1090 = constant(4)":
+	movq $4, %rbx
+	#instruction start "1091 = 1036 + 1090":
+	movq -776(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, -808(%rbp)
+	#instruction start "1092 = constant(1)":
+	movl $1, %ebx
+	#instruction start "1093 = load_volatile 1091, state: 1089":
+	movq -808(%rbp), %rdi
+	movzwl (%rdi), %r13d
+	#instruction start "1094 = proj0 1093":
+	#instruction start "1095 = proj1 1093":
+	#instruction start "1096 = int_cast_zero 1092":
+	movq %rbx, %rax
+	movq %rax, %r14
+	#instruction start "1097 = int_cast_zero 1095":
+	movq %r13, %rax
+	movq %rax, %rbx
+	#instruction start "1098 = constant(0)":
+	movq $0, %r13
+	#instruction start "1099 = constant(-32768)":
+	movq $-32768, %r15
+	#instruction start "1100 = 1099 & 1097":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	andq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "1101 = ~1099":
+	movq %r15, %rax
+	notq %rax
+	movq %rax, %rbx
+	#instruction start "1102 = 1096 << 1098":
+	movq %r14, %rax
+	movq %r13, %rcx
+	salq %cl, %rax
+	movq %rax, %r15
+	#instruction start "1103 = 1101 & 1102":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	andq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1104 = 1103 | 1100":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "1105 = int_cast_zero 1104":
+	movq %rbx, %rax
+	movzwl %ax, %r12d
+	#instruction start "1106 = store 1091 1105, state: 1094":
+	movq -808(%rbp), %rsi
+	movw %r12w, (%rsi)
+	#instruction start "1107 = constant(6)":
+	movq $6, %rbx
+	#instruction start "1108 = 1036 + 1107":
+	movq -776(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "1109 = constant(0)":
+	movq $0, %rbx
+	#instruction start "1110 = 1108 + 1109":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1111 = constant(0)":
+	movl $0, %ebx
+	#instruction start "1112 = store 1110 1111, state: 1106":
+	movq %r13, %rsi
+	movb %bl, (%rsi)
+	#instruction start "1113 = load 1036, state: 1112":
+	movq -776(%rbp), %rdi
+	movq (%rdi), %rbx
+	#instruction start "1114 = constant(4295034881)":
+	movabsq $4295034881, %r12
+	#instruction start "1115 = 1113 == 1114":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "1117 = if 996 1115":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L51
+.L50:
+	#instruction start "1120 = constant(19)":
+	movq $.Ls19, %rbx
+	#instruction start "1121 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "1122 = constant(118)":
+	movl $118, %r13d
+	#instruction start "1123 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "1124 = alloc with size 8":
+	leaq -1650(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1125 = store 1124 1120, state: 1112":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1126 = alloc with size 8":
+	leaq -1658(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1127 = store 1126 1121, state: 1125":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1128 = alloc with size 4":
+	leaq -1662(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1129 = store 1128 1122, state: 1127":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1130 = alloc with size 8":
+	leaq -1670(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1131 = store 1130 1123, state: 1129":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1132 = constant(0)":
+	leaq -816(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1133 = constant(0)":
+	leaq -824(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1134 = load part address of 1124 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1135 = proj0 1134":
+	#instruction start "1136 = proj1 1134":
+	#instruction start "1137 = load part address of 1126 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1138 = proj0 1137":
+	#instruction start "1139 = proj1 1137":
+	#instruction start "1140 = load part address of 1128 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1141 = proj0 1140":
+	#instruction start "1142 = proj1 1140":
+	#instruction start "1143 = load part address of 1130 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1144 = proj0 1143":
+	#instruction start "1145 = proj1 1143":
+	#instruction start "1146 = allocate_call_stack 0":
+	#instruction start "1147 = set_reg %rdi 1136":
+	#instruction start "1148 = set_reg %rsi 1139 state: 1147":
+	#instruction start "1149 = set_reg %rdx 1142 state: 1148":
+	#instruction start "1150 = set_reg %rcx 1145 state: 1149":
+	#instruction start "1151 = set_reg %rax 1133 state: 1150":
+	#instruction start "1152 = call 1132":
+	addq $0, %rsp
+	movq -824(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -816(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1153 = proj0 1152":
+	#instruction start "1154 = proj1 1152":
+	#Block jump
+	jmp .L52
+.L51:
+	#Block jump elided
+.L52:
+	#instruction start "1155 = constant(0)":
+	movl $0, %ebx
+	#instruction start "1156 = set_reg %rax 1155":
+	#instruction start "1157 = phi (region: 1116) 1112 1153":
+	#instruction start "1158 = return 1116, 1156, 1157":
+	movq %rbx, %rax
+	#Block return.
+	movq -1734(%rbp), %rbx
+	movq -1742(%rbp), %r12
+	movq -1750(%rbp), %r13
+	movq -1758(%rbp), %r14
+	movq -1766(%rbp), %r15
+	leave 
+	ret 
+.L53:
+	#Block jump elided
+.L54:
+	#instruction start "173 = constant(4)":
+	movl $4, %ebx
+	#instruction start "174 = 1163 % 173 (signed)":
+	movl -40(%rbp), %eax
+	movq %rbx, %rcx
+	cltd 
+	idivl %ecx
+	movl %edx, %eax
+	movl %eax, %r12d
+	#instruction start "175 = proj1 174":
+	#instruction start "176 = proj0 174":
+	#instruction start "177 = constant(0)":
+	movq $0, %rbx
+	#instruction start "178 = 6 + 177":
+	movq -8(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "179 = load_volatile 178, state: 175":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "180 = proj0 179":
+	#instruction start "181 = proj1 179":
+	#instruction start "182 = int_cast_zero 181":
+	movq %rbx, %rax
+	movq %rax, %r13
+	#instruction start "183 = constant(48)":
+	movq $48, %rbx
+	#instruction start "184 = constant(62)":
+	movq $62, %r14
+	#instruction start "185 = 182 << 183":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r15
+	#instruction start "186 = 185 >> 184":
+	movq %r15, %rax
+	movq %r14, %rcx
+	shrq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "187 = int_cast_zero 186":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "188 = 176 == 187":
+	movq %r12, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %ebx
+	#instruction start "190 = if 152 188":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L56
+.L55:
+	#instruction start "193 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "194 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "195 = constant(30)":
+	movl $30, %r13d
+	#instruction start "196 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "197 = alloc with size 8":
+	leaq -1678(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "198 = store 197 193, state: 180":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "199 = alloc with size 8":
+	leaq -1686(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "200 = store 199 194, state: 198":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "201 = alloc with size 4":
+	leaq -1690(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "202 = store 201 195, state: 200":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "203 = alloc with size 8":
+	leaq -1698(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "204 = store 203 196, state: 202":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "205 = constant(0)":
+	leaq -880(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "206 = constant(0)":
+	leaq -888(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "207 = load part address of 197 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "208 = proj0 207":
+	#instruction start "209 = proj1 207":
+	#instruction start "210 = load part address of 199 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "211 = proj0 210":
+	#instruction start "212 = proj1 210":
+	#instruction start "213 = load part address of 201 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "214 = proj0 213":
+	#instruction start "215 = proj1 213":
+	#instruction start "216 = load part address of 203 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "217 = proj0 216":
+	#instruction start "218 = proj1 216":
+	#instruction start "219 = allocate_call_stack 0":
+	#instruction start "220 = set_reg %rdi 209":
+	#instruction start "221 = set_reg %rsi 212 state: 220":
+	#instruction start "222 = set_reg %rdx 215 state: 221":
+	#instruction start "223 = set_reg %rcx 218 state: 222":
+	#instruction start "224 = set_reg %rax 206 state: 223":
+	#instruction start "225 = call 205":
+	addq $0, %rsp
+	movq -888(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -880(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "226 = proj0 225":
+	#instruction start "227 = proj1 225":
+	#Phi node to 1165 (189 1163 1163)
+	movl -40(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump
+	jmp .L57
+.L56:
+	#Phi node to 1165 (189 1163 1163)
+	movl -40(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump elided
+.L57:
+	#instruction start "230 = phi (region: 189) 180 226":
+	#instruction start "1165 = phi (region: 189) 1163 1163":
+	#Block jump elided
+.L58:
+	#instruction start "168 = constant(1)":
+	movl $1, %r12d
+	#instruction start "169 = 1165 + 168":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, -932(%rbp)
+	#instruction start "228 = constant(0)":
+	movq $0, %rbx
+	#instruction start "229 = 6 + 228":
+	movq -8(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, -940(%rbp)
+	#instruction start "231 = load_volatile 229, state: 230":
+	movq -940(%rbp), %rdi
+	movl (%rdi), %ebx
+	#instruction start "232 = proj0 231":
+	#instruction start "233 = proj1 231":
+	#instruction start "234 = int_cast_zero 233":
+	movq %rbx, %rax
+	movq %rax, %r14
+	#instruction start "235 = constant(48)":
+	movq $48, %rbx
+	#instruction start "236 = constant(62)":
+	movq $62, %r15
+	#instruction start "237 = 234 << 235":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r13
+	#instruction start "238 = 237 >> 236":
+	movq %r13, %rax
+	movq %r15, %rcx
+	shrq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "239 = int_cast_zero 238":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "240 = constant(1)":
+	movl $1, %ebx
+	#instruction start "241 = 239 + 240":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "242 = load_volatile 229, state: 232":
+	movq -940(%rbp), %rdi
+	movl (%rdi), %ebx
+	#instruction start "243 = proj0 242":
+	#instruction start "244 = proj1 242":
+	#instruction start "245 = int_cast_zero 241":
+	movq %r14, %rax
+	movq %rax, %r13
+	#instruction start "246 = int_cast_zero 244":
+	movq %rbx, %rax
+	movq %rax, %r14
+	#instruction start "247 = constant(14)":
+	movq $14, %rbx
+	#instruction start "248 = constant(-49153)":
+	movq $-49153, %r15
+	#instruction start "249 = 248 & 246":
+	movq %r15, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "250 = ~248":
+	movq %r15, %rax
+	notq %rax
+	movq %rax, %r14
+	#instruction start "251 = 245 << 247":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r15
+	#instruction start "252 = 250 & 251":
+	movq %r14, %rax
+	movq %r15, %rcx
+	andq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "253 = 252 | 249":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "254 = int_cast_zero 253":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "255 = store 229 254, state: 243":
+	movq -940(%rbp), %rsi
+	movl %ebx, (%rsi)
+	#Phi node to 1163 (150 157 169)
+	movl -932(%rbp), %eax
+	movl %eax, -40(%rbp)
+	#Block jump
+	jmp .L8
+.L59:
+	#Block jump elided
+.L60:
+	#instruction start "48 = constant(4)":
+	movl $4, %ebx
+	#instruction start "49 = 1159 % 48 (signed)":
+	movl -28(%rbp), %eax
+	movq %rbx, %rcx
+	cltd 
+	idivl %ecx
+	movl %edx, %eax
+	movl %eax, %r12d
+	#instruction start "50 = proj1 49":
+	#instruction start "51 = proj0 49":
+	#instruction start "52 = constant(0)":
+	movq $0, %rbx
+	#instruction start "53 = 6 + 52":
+	movq -8(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "54 = load_volatile 53, state: 50":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "55 = proj0 54":
+	#instruction start "56 = proj1 54":
+	#instruction start "57 = int_cast_zero 56":
+	movq %rbx, %rax
+	movq %rax, %r13
+	#instruction start "58 = constant(48)":
+	movq $48, %rbx
+	#instruction start "59 = constant(62)":
+	movq $62, %r14
+	#instruction start "60 = 57 << 58":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r15
+	#instruction start "61 = 60 >> 59":
+	movq %r15, %rax
+	movq %r14, %rcx
+	shrq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "62 = int_cast_zero 61":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "63 = 51 == 62":
+	movq %r12, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %ebx
+	#instruction start "65 = if 27 63":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L62
+.L61:
+	#instruction start "68 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "69 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "70 = constant(23)":
+	movl $23, %r13d
+	#instruction start "71 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "72 = alloc with size 8":
+	leaq -1706(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "73 = store 72 68, state: 55":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "74 = alloc with size 8":
+	leaq -1714(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "75 = store 74 69, state: 73":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "76 = alloc with size 4":
+	leaq -1718(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "77 = store 76 70, state: 75":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "78 = alloc with size 8":
+	leaq -1726(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "79 = store 78 71, state: 77":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "80 = constant(0)":
+	leaq -948(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "81 = constant(0)":
+	leaq -956(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "82 = load part address of 72 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "83 = proj0 82":
+	#instruction start "84 = proj1 82":
+	#instruction start "85 = load part address of 74 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "86 = proj0 85":
+	#instruction start "87 = proj1 85":
+	#instruction start "88 = load part address of 76 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "89 = proj0 88":
+	#instruction start "90 = proj1 88":
+	#instruction start "91 = load part address of 78 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "92 = proj0 91":
+	#instruction start "93 = proj1 91":
+	#instruction start "94 = allocate_call_stack 0":
+	#instruction start "95 = set_reg %rdi 84":
+	#instruction start "96 = set_reg %rsi 87 state: 95":
+	#instruction start "97 = set_reg %rdx 90 state: 96":
+	#instruction start "98 = set_reg %rcx 93 state: 97":
+	#instruction start "99 = set_reg %rax 81 state: 98":
+	#instruction start "100 = call 80":
+	addq $0, %rsp
+	movq -956(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -948(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "101 = proj0 100":
+	#instruction start "102 = proj1 100":
+	#Phi node to 1161 (64 1159 1159)
+	movl -28(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump
+	jmp .L63
+.L62:
+	#Phi node to 1161 (64 1159 1159)
+	movl -28(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump elided
+.L63:
+	#instruction start "105 = phi (region: 64) 55 101":
+	#instruction start "1161 = phi (region: 64) 1159 1159":
+	#Block jump elided
+.L64:
+	#instruction start "43 = constant(1)":
+	movl $1, %r12d
+	#instruction start "44 = 1161 + 43":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, -1000(%rbp)
+	#instruction start "103 = constant(0)":
+	movq $0, %rbx
+	#instruction start "104 = 6 + 103":
+	movq -8(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, -1008(%rbp)
+	#instruction start "106 = load_volatile 104, state: 105":
+	movq -1008(%rbp), %rdi
+	movl (%rdi), %ebx
+	#instruction start "107 = proj0 106":
+	#instruction start "108 = proj1 106":
+	#instruction start "109 = int_cast_zero 108":
+	movq %rbx, %rax
+	movq %rax, %r14
+	#instruction start "110 = constant(48)":
+	movq $48, %rbx
+	#instruction start "111 = constant(62)":
+	movq $62, %r15
+	#instruction start "112 = 109 << 110":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r13
+	#instruction start "113 = 112 >> 111":
+	movq %r13, %rax
+	movq %r15, %rcx
+	shrq %cl, %rax
+	movq %rax, %rbx
+	#instruction start "114 = int_cast_zero 113":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "115 = constant(1)":
+	movl $1, %ebx
+	#instruction start "116 = 114 + 115":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "117 = load_volatile 104, state: 107":
+	movq -1008(%rbp), %rdi
+	movl (%rdi), %ebx
+	#instruction start "118 = proj0 117":
+	#instruction start "119 = proj1 117":
+	#instruction start "120 = int_cast_zero 116":
+	movq %r14, %rax
+	movq %rax, %r13
+	#instruction start "121 = int_cast_zero 119":
+	movq %rbx, %rax
+	movq %rax, %r14
+	#instruction start "122 = constant(14)":
+	movq $14, %rbx
+	#instruction start "123 = constant(-49153)":
+	movq $-49153, %r15
+	#instruction start "124 = 123 & 121":
+	movq %r15, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "125 = ~123":
+	movq %r15, %rax
+	notq %rax
+	movq %rax, %r14
+	#instruction start "126 = 120 << 122":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r15
+	#instruction start "127 = 125 & 126":
+	movq %r14, %rax
+	movq %r15, %rcx
+	andq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "128 = 127 | 124":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "129 = int_cast_zero 128":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "130 = store 104 129, state: 118":
+	movq -1008(%rbp), %rsi
+	movl %ebx, (%rsi)
+	#Phi node to 1159 (25 32 44)
+	movl -1000(%rbp), %eax
+	movl %eax, -28(%rbp)
+	#Block jump
+	jmp .L4
+.section .rodata
+.Ls1:
+	.string "i % 4 == s.val\000"
+.Ls2:
+	.string "tests/bitfields.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "s.a == 1\000"
+.Ls5:
+	.string "s.shared_2 == s.shared_3\000"
+.Ls6:
+	.string "s.shared_2 == 3\000"
+.Ls7:
+	.string "t.y == 1\000"
+.Ls10:
+	.string "a.a == 1 && a.b == 1\000"
+.Ls12:
+	.string "t.c == 1\000"
+.Ls13:
+	.string "t.c2 == 5\000"
+.Ls15:
+	.string "%d\n\000"
+.Ls16:
+	.string "len > 0\000"
+.Ls17:
+	.string "t.a > -1\000"
+.Ls18:
+	.string "sizeof t == 4\000"
+.Ls19:
+	.string "*(uint64_t *)&t == 0x100010801\000"
+.section .data
+.align 4
+.LVAR0t:
+.byte 2
+.byte 0
+.byte 0
+.byte 0
+.section .text
+.section .data
+.align 4
+.LVAR1a:
+.byte 9
+.byte 0
+.byte 0
+.byte 0
+.section .text
+.section .data
+.align 1
+.LVAR2t:
+.zero 1
+.section .text
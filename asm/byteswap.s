@@ -0,0 +1,474 @@
+.global byteswap
+byteswap:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -24(%rbp)
+	movq %r12, -32(%rbp)
+	movq %r13, -40(%rbp)
+	movq %r14, -48(%rbp)
+	movq %r15, -56(%rbp)
+	movq %rdi, %rbx
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = alloc with size 8":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "8 = store part of 7 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "9 = load 7, state: 8":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "10 = constant(-72057594037927936)":
+	movabsq $-72057594037927936, %r13
+	#instruction start "11 = 9 & 10":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "12 = constant(56)":
+	movq $56, %rbx
+	#instruction start "13 = 11 >> 12":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r13
+	#instruction start "14 = load 7, state: 8":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "15 = constant(71776119061217280)":
+	movabsq $71776119061217280, %r14
+	#instruction start "16 = 14 & 15":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "17 = constant(40)":
+	movq $40, %rbx
+	#instruction start "18 = 16 >> 17":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "19 = 13 | 18":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "20 = load 7, state: 8":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "21 = constant(280375465082880)":
+	movabsq $280375465082880, %r14
+	#instruction start "22 = 20 & 21":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "23 = constant(24)":
+	movq $24, %r13
+	#instruction start "24 = 22 >> 23":
+	movq %r15, %rax
+	movq %r13, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "25 = 19 | 24":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "26 = load 7, state: 8":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "27 = constant(1095216660480)":
+	movabsq $1095216660480, %r14
+	#instruction start "28 = 26 & 27":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "29 = constant(8)":
+	movq $8, %rbx
+	#instruction start "30 = 28 >> 29":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "31 = 25 | 30":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "32 = load 7, state: 8":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "33 = constant(4278190080)":
+	movabsq $4278190080, %r14
+	#instruction start "34 = 32 & 33":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "35 = constant(8)":
+	movq $8, %r13
+	#instruction start "36 = 34 << 35":
+	movq %r15, %rax
+	movq %r13, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "37 = 31 | 36":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "38 = load 7, state: 8":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "39 = constant(16711680)":
+	movq $16711680, %r14
+	#instruction start "40 = 38 & 39":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "41 = constant(24)":
+	movq $24, %rbx
+	#instruction start "42 = 40 << 41":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "43 = 37 | 42":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "44 = load 7, state: 8":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "45 = constant(65280)":
+	movq $65280, %r14
+	#instruction start "46 = 44 & 45":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "47 = constant(40)":
+	movq $40, %r13
+	#instruction start "48 = 46 << 47":
+	movq %r15, %rax
+	movq %r13, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "49 = 43 | 48":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "50 = load 7, state: 8":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "51 = constant(255)":
+	movq $255, %r12
+	#instruction start "52 = 50 & 51":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "53 = constant(56)":
+	movq $56, %rbx
+	#instruction start "54 = 52 << 53":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r12
+	#instruction start "55 = 49 | 54":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "56 = set_reg %rax 55":
+	#instruction start "57 = return 2, 56, 8":
+	movq %rbx, %rax
+	#Block return.
+	movq -24(%rbp), %rbx
+	movq -32(%rbp), %r12
+	movq -40(%rbp), %r13
+	movq -48(%rbp), %r14
+	movq -56(%rbp), %r15
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $240, %rsp
+	movq %rbx, -208(%rbp)
+	movq %r12, -216(%rbp)
+	movq %r13, -224(%rbp)
+	movq %r14, -232(%rbp)
+	movq %r15, -240(%rbp)
+.L3:
+	#instruction start "61 = proj3 59":
+	#instruction start "64 = constant(1)":
+	movl $1, %ebx
+	#instruction start "66 = if 60 64":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L5
+.L4:
+	#instruction start "69 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "70 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "71 = constant(21)":
+	movl $21, %r13d
+	#instruction start "72 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "73 = alloc with size 8":
+	leaq -144(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "74 = store 73 69, state: 61":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "75 = alloc with size 8":
+	leaq -152(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "76 = store 75 70, state: 74":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "77 = alloc with size 4":
+	leaq -156(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "78 = store 77 71, state: 76":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "79 = alloc with size 8":
+	leaq -164(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "80 = store 79 72, state: 78":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "81 = constant(1)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "82 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "83 = load part address of 73 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "84 = proj0 83":
+	#instruction start "85 = proj1 83":
+	#instruction start "86 = load part address of 75 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "87 = proj0 86":
+	#instruction start "88 = proj1 86":
+	#instruction start "89 = load part address of 77 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "90 = proj0 89":
+	#instruction start "91 = proj1 89":
+	#instruction start "92 = load part address of 79 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "93 = proj0 92":
+	#instruction start "94 = proj1 92":
+	#instruction start "95 = allocate_call_stack 0":
+	#instruction start "96 = set_reg %rdi 85":
+	#instruction start "97 = set_reg %rsi 88 state: 96":
+	#instruction start "98 = set_reg %rdx 91 state: 97":
+	#instruction start "99 = set_reg %rcx 94 state: 98":
+	#instruction start "100 = set_reg %rax 82 state: 99":
+	#instruction start "101 = call 81":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "102 = proj0 101":
+	#instruction start "103 = proj1 101":
+	#Block jump
+	jmp .L6
+.L5:
+	#Block jump elided
+.L6:
+	#instruction start "104 = constant(1481921582679238371)":
+	movabsq $1481921582679238371, %rbx
+	#instruction start "105 = alloc with size 8":
+	leaq -172(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "106 = phi (region: 65) 61 102":
+	#instruction start "107 = store 105 104, state: 106":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "108 = constant(5)":
+	movq $byteswap, %rbx
+	#instruction start "109 = constant(0)":
+	movq $0, %r13
+	#instruction start "110 = load part address of 105 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "111 = proj0 110":
+	#instruction start "112 = proj1 110":
+	#instruction start "113 = allocate_call_stack 0":
+	#instruction start "114 = set_reg %rdi 112":
+	#instruction start "115 = set_reg %rax 109 state: 114":
+	#instruction start "116 = call 108":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r12
+	#instruction start "117 = proj0 116":
+	#instruction start "118 = proj1 116":
+	#instruction start "119 = %rax":
+	#instruction start "120 = int_cast_zero 119":
+	movq %r12, %rax
+	movq %rax, %rbx
+	#instruction start "121 = constant(-2042781618898759660)":
+	movabsq $-2042781618898759660, %r12
+	#instruction start "122 = 120 == 121":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "124 = if 65 122":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L8
+.L7:
+	#instruction start "127 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "128 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "129 = constant(22)":
+	movl $22, %r13d
+	#instruction start "130 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "131 = alloc with size 8":
+	leaq -180(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "132 = store 131 127, state: 117":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "133 = alloc with size 8":
+	leaq -188(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "134 = store 133 128, state: 132":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "135 = alloc with size 4":
+	leaq -192(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "136 = store 135 129, state: 134":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "137 = alloc with size 8":
+	leaq -200(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "138 = store 137 130, state: 136":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "139 = constant(1)":
+	leaq -80(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "140 = constant(0)":
+	leaq -88(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "141 = load part address of 131 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "142 = proj0 141":
+	#instruction start "143 = proj1 141":
+	#instruction start "144 = load part address of 133 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "145 = proj0 144":
+	#instruction start "146 = proj1 144":
+	#instruction start "147 = load part address of 135 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "148 = proj0 147":
+	#instruction start "149 = proj1 147":
+	#instruction start "150 = load part address of 137 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "151 = proj0 150":
+	#instruction start "152 = proj1 150":
+	#instruction start "153 = allocate_call_stack 0":
+	#instruction start "154 = set_reg %rdi 143":
+	#instruction start "155 = set_reg %rsi 146 state: 154":
+	#instruction start "156 = set_reg %rdx 149 state: 155":
+	#instruction start "157 = set_reg %rcx 152 state: 156":
+	#instruction start "158 = set_reg %rax 140 state: 157":
+	#instruction start "159 = call 139":
+	addq $0, %rsp
+	movq -88(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -80(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "160 = proj0 159":
+	#instruction start "161 = proj1 159":
+	#Block jump
+	jmp .L9
+.L8:
+	#Block jump elided
+.L9:
+	#instruction start "162 = constant(0)":
+	movl $0, %ebx
+	#instruction start "163 = set_reg %rax 162":
+	#instruction start "164 = phi (region: 123) 117 160":
+	#instruction start "165 = return 123, 163, 164":
+	movq %rbx, %rax
+	#Block return.
+	movq -208(%rbp), %rbx
+	movq -216(%rbp), %r12
+	movq -224(%rbp), %r13
+	movq -232(%rbp), %r14
+	movq -240(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls2:
+	.string "__bswap_constant_64(0x1490d7d3f094a6e3ull) == 0xe3a694f0d3d79014ull\000"
+.Ls3:
+	.string "tests/byteswap.c\000"
+.Ls4:
+	.string "main"
+.Ls6:
+	.string "byteswap(0x1490d7d3f094a6e3ull) == 0xe3a694f0d3d79014ull\000"
+.section .data
+.align 8
+.global l
+l:
+.quad -72057594037927936
+.section .text
@@ -0,0 +1,746 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $640, %rsp
+	movq %rbx, -600(%rbp)
+	movq %r12, -608(%rbp)
+	movq %r13, -616(%rbp)
+	movq %r14, -624(%rbp)
+	movq %r15, -632(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(1)":
+	movl $1, %ebx
+	#instruction start "8 = if 2 6":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "11 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "12 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "13 = constant(6)":
+	movl $6, %r13d
+	#instruction start "14 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "15 = alloc with size 8":
+	leaq -400(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "16 = store 15 11, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "17 = alloc with size 8":
+	leaq -408(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "18 = store 17 12, state: 16":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "19 = alloc with size 4":
+	leaq -412(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "20 = store 19 13, state: 18":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "21 = alloc with size 8":
+	leaq -420(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "22 = store 21 14, state: 20":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "23 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "24 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "25 = load part address of 15 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "26 = proj0 25":
+	#instruction start "27 = proj1 25":
+	#instruction start "28 = load part address of 17 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "29 = proj0 28":
+	#instruction start "30 = proj1 28":
+	#instruction start "31 = load part address of 19 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "32 = proj0 31":
+	#instruction start "33 = proj1 31":
+	#instruction start "34 = load part address of 21 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "35 = proj0 34":
+	#instruction start "36 = proj1 34":
+	#instruction start "37 = allocate_call_stack 0":
+	#instruction start "38 = set_reg %rdi 27":
+	#instruction start "39 = set_reg %rsi 30 state: 38":
+	#instruction start "40 = set_reg %rdx 33 state: 39":
+	#instruction start "41 = set_reg %rcx 36 state: 40":
+	#instruction start "42 = set_reg %rax 24 state: 41":
+	#instruction start "43 = call 23":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "44 = proj0 43":
+	#instruction start "45 = proj1 43":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "46 = constant(1)":
+	movl $1, %ebx
+	#instruction start "48 = if 7 46":
+	#instruction start "56 = phi (region: 7) 3 44":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "51 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "52 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "53 = constant(7)":
+	movl $7, %r13d
+	#instruction start "54 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "55 = alloc with size 8":
+	leaq -428(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "57 = store 55 51, state: 56":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "58 = alloc with size 8":
+	leaq -436(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "59 = store 58 52, state: 57":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "60 = alloc with size 4":
+	leaq -440(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "61 = store 60 53, state: 59":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "62 = alloc with size 8":
+	leaq -448(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "63 = store 62 54, state: 61":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "64 = constant(0)":
+	leaq -64(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "65 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "66 = load part address of 55 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "67 = proj0 66":
+	#instruction start "68 = proj1 66":
+	#instruction start "69 = load part address of 58 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "70 = proj0 69":
+	#instruction start "71 = proj1 69":
+	#instruction start "72 = load part address of 60 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "73 = proj0 72":
+	#instruction start "74 = proj1 72":
+	#instruction start "75 = load part address of 62 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "76 = proj0 75":
+	#instruction start "77 = proj1 75":
+	#instruction start "78 = allocate_call_stack 0":
+	#instruction start "79 = set_reg %rdi 68":
+	#instruction start "80 = set_reg %rsi 71 state: 79":
+	#instruction start "81 = set_reg %rdx 74 state: 80":
+	#instruction start "82 = set_reg %rcx 77 state: 81":
+	#instruction start "83 = set_reg %rax 65 state: 82":
+	#instruction start "84 = call 64":
+	addq $0, %rsp
+	movq -72(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -64(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "85 = proj0 84":
+	#instruction start "86 = proj1 84":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "87 = constant(1)":
+	movl $1, %ebx
+	#instruction start "89 = if 47 87":
+	#instruction start "97 = phi (region: 47) 56 85":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "92 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "93 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "94 = constant(8)":
+	movl $8, %r13d
+	#instruction start "95 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "96 = alloc with size 8":
+	leaq -456(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "98 = store 96 92, state: 97":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "99 = alloc with size 8":
+	leaq -464(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "100 = store 99 93, state: 98":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "101 = alloc with size 4":
+	leaq -468(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "102 = store 101 94, state: 100":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "103 = alloc with size 8":
+	leaq -476(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "104 = store 103 95, state: 102":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "105 = constant(0)":
+	leaq -120(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "106 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "107 = load part address of 96 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "108 = proj0 107":
+	#instruction start "109 = proj1 107":
+	#instruction start "110 = load part address of 99 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "111 = proj0 110":
+	#instruction start "112 = proj1 110":
+	#instruction start "113 = load part address of 101 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "114 = proj0 113":
+	#instruction start "115 = proj1 113":
+	#instruction start "116 = load part address of 103 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "117 = proj0 116":
+	#instruction start "118 = proj1 116":
+	#instruction start "119 = allocate_call_stack 0":
+	#instruction start "120 = set_reg %rdi 109":
+	#instruction start "121 = set_reg %rsi 112 state: 120":
+	#instruction start "122 = set_reg %rdx 115 state: 121":
+	#instruction start "123 = set_reg %rcx 118 state: 122":
+	#instruction start "124 = set_reg %rax 106 state: 123":
+	#instruction start "125 = call 105":
+	addq $0, %rsp
+	movq -128(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -120(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "126 = proj0 125":
+	#instruction start "127 = proj1 125":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "128 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "129 = phi (region: 88) 97 126":
+	#instruction start "130 = load_volatile 128, state: 129":
+	movq %rbx, %rdi
+	movzbl (%rdi), %r12d
+	#instruction start "131 = proj0 130":
+	#instruction start "132 = proj1 130":
+	#instruction start "133 = int_cast_zero 132":
+	movq %r12, %rax
+	movsbq %al, %rax
+	movl %eax, %ebx
+	#instruction start "134 = constant(7)":
+	movl $7, %r12d
+	#instruction start "135 = 133 == 134":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "137 = if 88 135":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "140 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "141 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "142 = constant(10)":
+	movl $10, %r13d
+	#instruction start "143 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "144 = alloc with size 8":
+	leaq -484(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "145 = store 144 140, state: 131":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "146 = alloc with size 8":
+	leaq -492(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "147 = store 146 141, state: 145":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "148 = alloc with size 4":
+	leaq -496(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "149 = store 148 142, state: 147":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "150 = alloc with size 8":
+	leaq -504(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "151 = store 150 143, state: 149":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "152 = constant(0)":
+	leaq -176(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "153 = constant(0)":
+	leaq -184(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "154 = load part address of 144 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "155 = proj0 154":
+	#instruction start "156 = proj1 154":
+	#instruction start "157 = load part address of 146 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "158 = proj0 157":
+	#instruction start "159 = proj1 157":
+	#instruction start "160 = load part address of 148 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "161 = proj0 160":
+	#instruction start "162 = proj1 160":
+	#instruction start "163 = load part address of 150 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "164 = proj0 163":
+	#instruction start "165 = proj1 163":
+	#instruction start "166 = allocate_call_stack 0":
+	#instruction start "167 = set_reg %rdi 156":
+	#instruction start "168 = set_reg %rsi 159 state: 167":
+	#instruction start "169 = set_reg %rdx 162 state: 168":
+	#instruction start "170 = set_reg %rcx 165 state: 169":
+	#instruction start "171 = set_reg %rax 153 state: 170":
+	#instruction start "172 = call 152":
+	addq $0, %rsp
+	movq -184(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -176(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "173 = proj0 172":
+	#instruction start "174 = proj1 172":
+	#Block jump
+	jmp .L14
+.L13:
+	#Block jump elided
+.L14:
+	#instruction start "175 = constant(9)":
+	movq $.Ls9, %rbx
+	#instruction start "176 = constant(9)":
+	movq $.Ls9, %r12
+	#instruction start "177 = alloc with size 8":
+	leaq -512(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "178 = phi (region: 136) 131 173":
+	#instruction start "179 = store 177 175, state: 178":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "180 = alloc with size 8":
+	leaq -520(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "181 = store 180 176, state: 179":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "182 = constant(8)":
+	movq $strcmp, %r12
+	#instruction start "183 = constant(0)":
+	movq $0, %r14
+	#instruction start "184 = load part address of 177 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "185 = proj0 184":
+	#instruction start "186 = proj1 184":
+	#instruction start "187 = load part address of 180 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "188 = proj0 187":
+	#instruction start "189 = proj1 187":
+	#instruction start "190 = allocate_call_stack 0":
+	#instruction start "191 = set_reg %rdi 186":
+	#instruction start "192 = set_reg %rsi 189 state: 191":
+	#instruction start "193 = set_reg %rax 183 state: 192":
+	#instruction start "194 = call 182":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "195 = proj0 194":
+	#instruction start "196 = proj1 194":
+	#instruction start "197 = %rax":
+	#instruction start "198 = int_cast_zero 197":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "199 = constant(0)":
+	movl $0, %ebx
+	#instruction start "200 = 198 == 199":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "202 = if 136 200":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#instruction start "205 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "206 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "207 = constant(12)":
+	movl $12, %r13d
+	#instruction start "208 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "209 = alloc with size 8":
+	leaq -528(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "210 = store 209 205, state: 195":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "211 = alloc with size 8":
+	leaq -536(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "212 = store 211 206, state: 210":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "213 = alloc with size 4":
+	leaq -540(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "214 = store 213 207, state: 212":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "215 = alloc with size 8":
+	leaq -548(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "216 = store 215 208, state: 214":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "217 = constant(0)":
+	leaq -256(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "218 = constant(0)":
+	leaq -264(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "219 = load part address of 209 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "220 = proj0 219":
+	#instruction start "221 = proj1 219":
+	#instruction start "222 = load part address of 211 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "223 = proj0 222":
+	#instruction start "224 = proj1 222":
+	#instruction start "225 = load part address of 213 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "226 = proj0 225":
+	#instruction start "227 = proj1 225":
+	#instruction start "228 = load part address of 215 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "229 = proj0 228":
+	#instruction start "230 = proj1 228":
+	#instruction start "231 = allocate_call_stack 0":
+	#instruction start "232 = set_reg %rdi 221":
+	#instruction start "233 = set_reg %rsi 224 state: 232":
+	#instruction start "234 = set_reg %rdx 227 state: 233":
+	#instruction start "235 = set_reg %rcx 230 state: 234":
+	#instruction start "236 = set_reg %rax 218 state: 235":
+	#instruction start "237 = call 217":
+	addq $0, %rsp
+	movq -264(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -256(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "238 = proj0 237":
+	#instruction start "239 = proj1 237":
+	#Block jump
+	jmp .L17
+.L16:
+	#Block jump elided
+.L17:
+	#instruction start "240 = constant(11)":
+	movq $.Ls11, %rbx
+	#instruction start "241 = constant(11)":
+	movq $.Ls11, %r12
+	#instruction start "242 = alloc with size 8":
+	leaq -556(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "243 = phi (region: 201) 195 238":
+	#instruction start "244 = store 242 240, state: 243":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "245 = alloc with size 8":
+	leaq -564(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "246 = store 245 241, state: 244":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "247 = constant(8)":
+	movq $strcmp, %r12
+	#instruction start "248 = constant(0)":
+	movq $0, %r14
+	#instruction start "249 = load part address of 242 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "250 = proj0 249":
+	#instruction start "251 = proj1 249":
+	#instruction start "252 = load part address of 245 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "253 = proj0 252":
+	#instruction start "254 = proj1 252":
+	#instruction start "255 = allocate_call_stack 0":
+	#instruction start "256 = set_reg %rdi 251":
+	#instruction start "257 = set_reg %rsi 254 state: 256":
+	#instruction start "258 = set_reg %rax 248 state: 257":
+	#instruction start "259 = call 247":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "260 = proj0 259":
+	#instruction start "261 = proj1 259":
+	#instruction start "262 = %rax":
+	#instruction start "263 = int_cast_zero 262":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "264 = constant(0)":
+	movl $0, %ebx
+	#instruction start "265 = 263 == 264":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "267 = if 201 265":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "270 = constant(12)":
+	movq $.Ls12, %rbx
+	#instruction start "271 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "272 = constant(15)":
+	movl $15, %r13d
+	#instruction start "273 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "274 = alloc with size 8":
+	leaq -572(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "275 = store 274 270, state: 260":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "276 = alloc with size 8":
+	leaq -580(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "277 = store 276 271, state: 275":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "278 = alloc with size 4":
+	leaq -584(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "279 = store 278 272, state: 277":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "280 = alloc with size 8":
+	leaq -592(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "281 = store 280 273, state: 279":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "282 = constant(0)":
+	leaq -336(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "283 = constant(0)":
+	leaq -344(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "284 = load part address of 274 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "285 = proj0 284":
+	#instruction start "286 = proj1 284":
+	#instruction start "287 = load part address of 276 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "288 = proj0 287":
+	#instruction start "289 = proj1 287":
+	#instruction start "290 = load part address of 278 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "291 = proj0 290":
+	#instruction start "292 = proj1 290":
+	#instruction start "293 = load part address of 280 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "294 = proj0 293":
+	#instruction start "295 = proj1 293":
+	#instruction start "296 = allocate_call_stack 0":
+	#instruction start "297 = set_reg %rdi 286":
+	#instruction start "298 = set_reg %rsi 289 state: 297":
+	#instruction start "299 = set_reg %rdx 292 state: 298":
+	#instruction start "300 = set_reg %rcx 295 state: 299":
+	#instruction start "301 = set_reg %rax 283 state: 300":
+	#instruction start "302 = call 282":
+	addq $0, %rsp
+	movq -344(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -336(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "303 = proj0 302":
+	#instruction start "304 = proj1 302":
+	#Block jump
+	jmp .L20
+.L19:
+	#Block jump elided
+.L20:
+	#instruction start "305 = constant(0)":
+	movl $0, %ebx
+	#instruction start "306 = set_reg %rax 305":
+	#instruction start "307 = phi (region: 266) 260 303":
+	#instruction start "308 = return 266, 306, 307":
+	movq %rbx, %rax
+	#Block return.
+	movq -600(%rbp), %rbx
+	movq -608(%rbp), %r12
+	movq -616(%rbp), %r13
+	movq -624(%rbp), %r14
+	movq -632(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "'\\n' == 10\000"
+.Ls2:
+	.string "tests/character_constants.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "'\\0' == 0\000"
+.Ls5:
+	.string "'\\064' == 064\000"
+.Ls6:
+	.string "\007\000"
+.Ls7:
+	.string "\"\\a\"[0] == 7\000"
+.Ls9:
+	.string "strS45\000"
+.Ls10:
+	.string "strcmp(\"str\\12345\", \"strS45\") == 0\000"
+.Ls11:
+	.string "L'\\x123'\000"
+.Ls12:
+	.string "strcmp(STR(L'\\x123'), \"L'\\\\x123'\") == 0\000"
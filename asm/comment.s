@@ -0,0 +1,358 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movq %rbx, -224(%rbp)
+	movq %r12, -232(%rbp)
+	movq %r13, -240(%rbp)
+	movq %r14, -248(%rbp)
+	movq %r15, -256(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(1)":
+	movq $str, %rbx
+	#instruction start "7 = load_volatile 6, state: 3":
+	movq %rbx, %rdi
+	movq (%rdi), %r12
+	#instruction start "8 = proj0 7":
+	#instruction start "9 = proj1 7":
+	#instruction start "10 = constant(0)":
+	movq $.Ls0, %rbx
+	#instruction start "11 = alloc with size 8":
+	leaq -152(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "12 = store 11 9, state: 8":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "13 = alloc with size 8":
+	leaq -160(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "14 = store 13 10, state: 12":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "15 = constant(5)":
+	movq $strcmp, %rbx
+	#instruction start "16 = constant(0)":
+	movq $0, %r14
+	#instruction start "17 = load part address of 11 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "18 = proj0 17":
+	#instruction start "19 = proj1 17":
+	#instruction start "20 = load part address of 13 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "21 = proj0 20":
+	#instruction start "22 = proj1 20":
+	#instruction start "23 = allocate_call_stack 0":
+	#instruction start "24 = set_reg %rdi 19":
+	#instruction start "25 = set_reg %rsi 22 state: 24":
+	#instruction start "26 = set_reg %rax 16 state: 25":
+	#instruction start "27 = call 15":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r12
+	#instruction start "28 = proj0 27":
+	#instruction start "29 = proj1 27":
+	#instruction start "30 = %rax":
+	#instruction start "31 = int_cast_zero 30":
+	movq %r12, %rax
+	movl %eax, %ebx
+	#instruction start "32 = constant(0)":
+	movl $0, %r12d
+	#instruction start "33 = 31 == 32":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "35 = if 2 33":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "38 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "39 = constant(8)":
+	movq $.Ls8, %r12
+	#instruction start "40 = constant(18)":
+	movl $18, %r13d
+	#instruction start "41 = constant(9)":
+	movq $.Ls9, %r14
+	#instruction start "42 = alloc with size 8":
+	leaq -168(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "43 = store 42 38, state: 28":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "44 = alloc with size 8":
+	leaq -176(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "45 = store 44 39, state: 43":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "46 = alloc with size 4":
+	leaq -180(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "47 = store 46 40, state: 45":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "48 = alloc with size 8":
+	leaq -188(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "49 = store 48 41, state: 47":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "50 = constant(6)":
+	leaq -32(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "51 = constant(0)":
+	leaq -40(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "52 = load part address of 42 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "53 = proj0 52":
+	#instruction start "54 = proj1 52":
+	#instruction start "55 = load part address of 44 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "56 = proj0 55":
+	#instruction start "57 = proj1 55":
+	#instruction start "58 = load part address of 46 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "59 = proj0 58":
+	#instruction start "60 = proj1 58":
+	#instruction start "61 = load part address of 48 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "62 = proj0 61":
+	#instruction start "63 = proj1 61":
+	#instruction start "64 = allocate_call_stack 0":
+	#instruction start "65 = set_reg %rdi 54":
+	#instruction start "66 = set_reg %rsi 57 state: 65":
+	#instruction start "67 = set_reg %rdx 60 state: 66":
+	#instruction start "68 = set_reg %rcx 63 state: 67":
+	#instruction start "69 = set_reg %rax 51 state: 68":
+	#instruction start "70 = call 50":
+	addq $0, %rsp
+	movq -40(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -32(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "71 = proj0 70":
+	#instruction start "72 = proj1 70":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "73 = constant(2)":
+	movq $after_stars, %rbx
+	#instruction start "74 = constant(3)":
+	movq $after_splice, %r12
+	#instruction start "75 = phi (region: 34) 28 71":
+	#instruction start "76 = load_volatile 73, state: 75":
+	movq %rbx, %rdi
+	movl (%rdi), %r13d
+	#instruction start "77 = proj0 76":
+	#instruction start "78 = proj1 76":
+	#instruction start "79 = load_volatile 74, state: 77":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "80 = proj0 79":
+	#instruction start "81 = proj1 79":
+	#instruction start "82 = 78 + 81":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addl %ecx, %eax
+	movl %eax, %r12d
+	#instruction start "83 = constant(4)":
+	movq $after_line, %rbx
+	#instruction start "84 = load_volatile 83, state: 80":
+	movq %rbx, %rdi
+	movl (%rdi), %r13d
+	#instruction start "85 = proj0 84":
+	#instruction start "86 = proj1 84":
+	#instruction start "87 = 82 + 86":
+	movq %r12, %rax
+	movq %r13, %rcx
+	addl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "88 = constant(6)":
+	movl $6, %r12d
+	#instruction start "89 = 87 == 88":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "91 = if 34 89":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "94 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "95 = constant(8)":
+	movq $.Ls8, %r12
+	#instruction start "96 = constant(19)":
+	movl $19, %r13d
+	#instruction start "97 = constant(9)":
+	movq $.Ls9, %r14
+	#instruction start "98 = alloc with size 8":
+	leaq -196(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "99 = store 98 94, state: 85":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "100 = alloc with size 8":
+	leaq -204(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "101 = store 100 95, state: 99":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "102 = alloc with size 4":
+	leaq -208(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "103 = store 102 96, state: 101":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "104 = alloc with size 8":
+	leaq -216(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "105 = store 104 97, state: 103":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "106 = constant(6)":
+	leaq -88(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "107 = constant(0)":
+	leaq -96(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "108 = load part address of 98 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "109 = proj0 108":
+	#instruction start "110 = proj1 108":
+	#instruction start "111 = load part address of 100 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "112 = proj0 111":
+	#instruction start "113 = proj1 111":
+	#instruction start "114 = load part address of 102 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "115 = proj0 114":
+	#instruction start "116 = proj1 114":
+	#instruction start "117 = load part address of 104 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "118 = proj0 117":
+	#instruction start "119 = proj1 117":
+	#instruction start "120 = allocate_call_stack 0":
+	#instruction start "121 = set_reg %rdi 110":
+	#instruction start "122 = set_reg %rsi 113 state: 121":
+	#instruction start "123 = set_reg %rdx 116 state: 122":
+	#instruction start "124 = set_reg %rcx 119 state: 123":
+	#instruction start "125 = set_reg %rax 107 state: 124":
+	#instruction start "126 = call 106":
+	addq $0, %rsp
+	movq -96(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -88(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "127 = proj0 126":
+	#instruction start "128 = proj1 126":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "129 = constant(0)":
+	movl $0, %ebx
+	#instruction start "130 = set_reg %rax 129":
+	#instruction start "131 = phi (region: 90) 85 127":
+	#instruction start "132 = return 90, 130, 131":
+	movq %rbx, %rax
+	#Block return.
+	movq -224(%rbp), %rbx
+	movq -232(%rbp), %r12
+	movq -240(%rbp), %r13
+	movq -248(%rbp), %r14
+	movq -256(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls0:
+	.string "a\"/*b\000"
+.Ls7:
+	.string "strcmp(str, \"a\\\"/\" \"*b\") == 0\000"
+.Ls8:
+	.string "tests/comment.c\000"
+.Ls9:
+	.string "main"
+.Ls10:
+	.string "after_stars + after_splice + after_line == 6\000"
+.section .data
+.align 8
+.global str
+str:
+.quad .Ls0
+.section .text
+.section .data
+.align 4
+.global after_stars
+after_stars:
+.byte 1
+.byte 0
+.byte 0
+.byte 0
+.section .text
+.section .data
+.align 4
+.global after_splice
+after_splice:
+.byte 2
+.byte 0
+.byte 0
+.byte 0
+.section .text
+.section .data
+.align 4
+.global after_line
+after_line:
+.byte 3
+.byte 0
+.byte 0
+.byte 0
+.section .text
@@ -0,0 +1,222 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $224, %rsp
+	movq %rbx, -184(%rbp)
+	movq %r12, -192(%rbp)
+	movq %r13, -200(%rbp)
+	movq %r14, -208(%rbp)
+	movq %r15, -216(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(1)":
+	movl $1, %ebx
+	#instruction start "8 = if 2 6":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "11 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "12 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "13 = constant(4)":
+	movl $4, %r13d
+	#instruction start "14 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "15 = alloc with size 8":
+	leaq -128(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "16 = store 15 11, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "17 = alloc with size 8":
+	leaq -136(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "18 = store 17 12, state: 16":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "19 = alloc with size 4":
+	leaq -140(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "20 = store 19 13, state: 18":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "21 = alloc with size 8":
+	leaq -148(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "22 = store 21 14, state: 20":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "23 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "24 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "25 = load part address of 15 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "26 = proj0 25":
+	#instruction start "27 = proj1 25":
+	#instruction start "28 = load part address of 17 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "29 = proj0 28":
+	#instruction start "30 = proj1 28":
+	#instruction start "31 = load part address of 19 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "32 = proj0 31":
+	#instruction start "33 = proj1 31":
+	#instruction start "34 = load part address of 21 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "35 = proj0 34":
+	#instruction start "36 = proj1 34":
+	#instruction start "37 = allocate_call_stack 0":
+	#instruction start "38 = set_reg %rdi 27":
+	#instruction start "39 = set_reg %rsi 30 state: 38":
+	#instruction start "40 = set_reg %rdx 33 state: 39":
+	#instruction start "41 = set_reg %rcx 36 state: 40":
+	#instruction start "42 = set_reg %rax 24 state: 41":
+	#instruction start "43 = call 23":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "44 = proj0 43":
+	#instruction start "45 = proj1 43":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "46 = constant(1)":
+	movl $1, %ebx
+	#instruction start "48 = if 7 46":
+	#instruction start "56 = phi (region: 7) 3 44":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "51 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "52 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "53 = constant(5)":
+	movl $5, %r13d
+	#instruction start "54 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "55 = alloc with size 8":
+	leaq -156(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "57 = store 55 51, state: 56":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "58 = alloc with size 8":
+	leaq -164(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "59 = store 58 52, state: 57":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "60 = alloc with size 4":
+	leaq -168(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "61 = store 60 53, state: 59":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "62 = alloc with size 8":
+	leaq -176(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "63 = store 62 54, state: 61":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "64 = constant(0)":
+	leaq -64(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "65 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "66 = load part address of 55 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "67 = proj0 66":
+	#instruction start "68 = proj1 66":
+	#instruction start "69 = load part address of 58 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "70 = proj0 69":
+	#instruction start "71 = proj1 69":
+	#instruction start "72 = load part address of 60 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "73 = proj0 72":
+	#instruction start "74 = proj1 72":
+	#instruction start "75 = load part address of 62 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "76 = proj0 75":
+	#instruction start "77 = proj1 75":
+	#instruction start "78 = allocate_call_stack 0":
+	#instruction start "79 = set_reg %rdi 68":
+	#instruction start "80 = set_reg %rsi 71 state: 79":
+	#instruction start "81 = set_reg %rdx 74 state: 80":
+	#instruction start "82 = set_reg %rcx 77 state: 81":
+	#instruction start "83 = set_reg %rax 65 state: 82":
+	#instruction start "84 = call 64":
+	addq $0, %rsp
+	movq -72(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -64(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "85 = proj0 84":
+	#instruction start "86 = proj1 84":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "87 = constant(0)":
+	movl $0, %ebx
+	#instruction start "88 = set_reg %rax 87":
+	#instruction start "89 = phi (region: 47) 56 85":
+	#instruction start "90 = return 47, 88, 89":
+	movq %rbx, %rax
+	#Block return.
+	movq -184(%rbp), %rbx
+	movq -192(%rbp), %r12
+	movq -200(%rbp), %r13
+	movq -208(%rbp), %r14
+	movq -216(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "1000000 == 1000000\000"
+.Ls2:
+	.string "tests/digit_separator.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "10.00000 == 10.0\000"
@@ -0,0 +1,318 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $304, %rsp
+	movq %rbx, -268(%rbp)
+	movq %r12, -276(%rbp)
+	movq %r13, -284(%rbp)
+	movq %r14, -292(%rbp)
+	movq %r15, -300(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(1)":
+	movl $1, %ebx
+	#instruction start "8 = if 2 6":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "11 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "12 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "13 = constant(30)":
+	movl $30, %r13d
+	#instruction start "14 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "15 = alloc with size 8":
+	leaq -184(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "16 = store 15 11, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "17 = alloc with size 8":
+	leaq -192(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "18 = store 17 12, state: 16":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "19 = alloc with size 4":
+	leaq -196(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "20 = store 19 13, state: 18":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "21 = alloc with size 8":
+	leaq -204(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "22 = store 21 14, state: 20":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "23 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "24 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "25 = load part address of 15 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "26 = proj0 25":
+	#instruction start "27 = proj1 25":
+	#instruction start "28 = load part address of 17 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "29 = proj0 28":
+	#instruction start "30 = proj1 28":
+	#instruction start "31 = load part address of 19 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "32 = proj0 31":
+	#instruction start "33 = proj1 31":
+	#instruction start "34 = load part address of 21 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "35 = proj0 34":
+	#instruction start "36 = proj1 34":
+	#instruction start "37 = allocate_call_stack 0":
+	#instruction start "38 = set_reg %rdi 27":
+	#instruction start "39 = set_reg %rsi 30 state: 38":
+	#instruction start "40 = set_reg %rdx 33 state: 39":
+	#instruction start "41 = set_reg %rcx 36 state: 40":
+	#instruction start "42 = set_reg %rax 24 state: 41":
+	#instruction start "43 = call 23":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "44 = proj0 43":
+	#instruction start "45 = proj1 43":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "46 = constant(1)":
+	movl $1, %ebx
+	#instruction start "48 = if 7 46":
+	#instruction start "56 = phi (region: 7) 3 44":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "51 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "52 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "53 = constant(31)":
+	movl $31, %r13d
+	#instruction start "54 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "55 = alloc with size 8":
+	leaq -212(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "57 = store 55 51, state: 56":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "58 = alloc with size 8":
+	leaq -220(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "59 = store 58 52, state: 57":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "60 = alloc with size 4":
+	leaq -224(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "61 = store 60 53, state: 59":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "62 = alloc with size 8":
+	leaq -232(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "63 = store 62 54, state: 61":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "64 = constant(0)":
+	leaq -64(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "65 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "66 = load part address of 55 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "67 = proj0 66":
+	#instruction start "68 = proj1 66":
+	#instruction start "69 = load part address of 58 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "70 = proj0 69":
+	#instruction start "71 = proj1 69":
+	#instruction start "72 = load part address of 60 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "73 = proj0 72":
+	#instruction start "74 = proj1 72":
+	#instruction start "75 = load part address of 62 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "76 = proj0 75":
+	#instruction start "77 = proj1 75":
+	#instruction start "78 = allocate_call_stack 0":
+	#instruction start "79 = set_reg %rdi 68":
+	#instruction start "80 = set_reg %rsi 71 state: 79":
+	#instruction start "81 = set_reg %rdx 74 state: 80":
+	#instruction start "82 = set_reg %rcx 77 state: 81":
+	#instruction start "83 = set_reg %rax 65 state: 82":
+	#instruction start "84 = call 64":
+	addq $0, %rsp
+	movq -72(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -64(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "85 = proj0 84":
+	#instruction start "86 = proj1 84":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "87 = constant(1)":
+	movl $1, %ebx
+	#instruction start "89 = if 47 87":
+	#instruction start "97 = phi (region: 47) 56 85":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "92 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "93 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "94 = constant(32)":
+	movl $32, %r13d
+	#instruction start "95 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "96 = alloc with size 8":
+	leaq -240(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "98 = store 96 92, state: 97":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "99 = alloc with size 8":
+	leaq -248(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "100 = store 99 93, state: 98":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "101 = alloc with size 4":
+	leaq -252(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "102 = store 101 94, state: 100":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "103 = alloc with size 8":
+	leaq -260(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "104 = store 103 95, state: 102":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "105 = constant(0)":
+	leaq -120(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "106 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "107 = load part address of 96 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "108 = proj0 107":
+	#instruction start "109 = proj1 107":
+	#instruction start "110 = load part address of 99 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "111 = proj0 110":
+	#instruction start "112 = proj1 110":
+	#instruction start "113 = load part address of 101 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "114 = proj0 113":
+	#instruction start "115 = proj1 113":
+	#instruction start "116 = load part address of 103 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "117 = proj0 116":
+	#instruction start "118 = proj1 116":
+	#instruction start "119 = allocate_call_stack 0":
+	#instruction start "120 = set_reg %rdi 109":
+	#instruction start "121 = set_reg %rsi 112 state: 120":
+	#instruction start "122 = set_reg %rdx 115 state: 121":
+	#instruction start "123 = set_reg %rcx 118 state: 122":
+	#instruction start "124 = set_reg %rax 106 state: 123":
+	#instruction start "125 = call 105":
+	addq $0, %rsp
+	movq -128(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -120(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "126 = proj0 125":
+	#instruction start "127 = proj1 125":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "128 = constant(0)":
+	movl $0, %ebx
+	#instruction start "129 = set_reg %rax 128":
+	#instruction start "130 = phi (region: 88) 97 126":
+	#instruction start "131 = return 88, 129, 130":
+	movq %rbx, %rax
+	#Block return.
+	movq -268(%rbp), %rbx
+	movq -276(%rbp), %r12
+	movq -284(%rbp), %r13
+	movq -292(%rbp), %r14
+	movq -300(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "VAL == 234\000"
+.Ls2:
+	.string "tests/elifdef.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "VAL2 == 456\000"
+.Ls5:
+	.string "VAL3 == 234\000"
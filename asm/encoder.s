@@ -0,0 +1,135 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rbx, -100(%rbp)
+	movq %r12, -108(%rbp)
+	movq %r13, -116(%rbp)
+	movq %r14, -124(%rbp)
+	movq %r15, -132(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "8 = constant(294967296)":
+	movl $294967296, %ebx
+	#instruction start "11 = constant(294967296)":
+	movl $294967296, %r12d
+	#instruction start "12 = 8 == 11":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "14 = if 2 12":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "17 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "18 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "19 = constant(6)":
+	movl $6, %r13d
+	#instruction start "20 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "21 = alloc with size 8":
+	leaq -72(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "22 = store 21 17, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "23 = alloc with size 8":
+	leaq -80(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "24 = store 23 18, state: 22":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "25 = alloc with size 4":
+	leaq -84(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "26 = store 25 19, state: 24":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "27 = alloc with size 8":
+	leaq -92(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "28 = store 27 20, state: 26":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "29 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "30 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "31 = load part address of 21 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "32 = proj0 31":
+	#instruction start "33 = proj1 31":
+	#instruction start "34 = load part address of 23 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "35 = proj0 34":
+	#instruction start "36 = proj1 34":
+	#instruction start "37 = load part address of 25 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "38 = proj0 37":
+	#instruction start "39 = proj1 37":
+	#instruction start "40 = load part address of 27 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "41 = proj0 40":
+	#instruction start "42 = proj1 40":
+	#instruction start "43 = allocate_call_stack 0":
+	#instruction start "44 = set_reg %rdi 33":
+	#instruction start "45 = set_reg %rsi 36 state: 44":
+	#instruction start "46 = set_reg %rdx 39 state: 45":
+	#instruction start "47 = set_reg %rcx 42 state: 46":
+	#instruction start "48 = set_reg %rax 30 state: 47":
+	#instruction start "49 = call 29":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "50 = proj0 49":
+	#instruction start "51 = proj1 49":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "52 = constant(0)":
+	movl $0, %ebx
+	#instruction start "53 = set_reg %rax 52":
+	#instruction start "54 = phi (region: 13) 3 50":
+	#instruction start "55 = return 13, 53, 54":
+	movq %rbx, %rax
+	#Block return.
+	movq -100(%rbp), %rbx
+	movq -108(%rbp), %r12
+	movq -116(%rbp), %r13
+	movq -124(%rbp), %r14
+	movq -132(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "a == (unsigned int)-4000000000\000"
+.Ls2:
+	.string "tests/encoder.c\000"
+.Ls3:
+	.string "main"
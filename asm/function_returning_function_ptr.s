@@ -0,0 +1,215 @@
+.global f1
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $320, %rsp
+	movq %rbx, -320(%rbp)
+	movq %rdi, -312(%rbp)
+	movq %rsi, -304(%rbp)
+	movq %rdx, -296(%rbp)
+	movq %rcx, -288(%rbp)
+	movq %r8, -280(%rbp)
+	movq %r9, -272(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(10)":
+	movl $10, %ebx
+	#instruction start "7 = set_reg %rax 6":
+	#instruction start "8 = return 2, 7, 3":
+	movq %rbx, %rax
+	#Block return.
+	movq -320(%rbp), %rbx
+	leave 
+	ret 
+.global f2
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $320, %rsp
+	movq %rbx, -320(%rbp)
+	movq %rdi, -312(%rbp)
+	movq %rsi, -304(%rbp)
+	movq %rdx, -296(%rbp)
+	movq %rcx, -288(%rbp)
+	movq %r8, -280(%rbp)
+	movq %r9, -272(%rbp)
+.L3:
+	#instruction start "12 = proj3 10":
+	#instruction start "15 = constant(0)":
+	movq $f1, %rbx
+	#instruction start "16 = set_reg %rax 15":
+	#instruction start "17 = return 11, 16, 12":
+	movq %rbx, %rax
+	#Block return.
+	movq -320(%rbp), %rbx
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movq %rbx, -116(%rbp)
+	movq %r12, -124(%rbp)
+	movq %r13, -132(%rbp)
+	movq %r14, -140(%rbp)
+	movq %r15, -148(%rbp)
+.L4:
+	#instruction start "21 = proj3 19":
+	#instruction start "24 = constant(1)":
+	movq $f2, %rbx
+	#instruction start "25 = constant(0)":
+	movq $0, %r12
+	#instruction start "26 = allocate_call_stack 0":
+	#instruction start "27 = set_reg %rax 25":
+	#instruction start "28 = call 24":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "29 = proj0 28":
+	#instruction start "30 = proj1 28":
+	#instruction start "31 = %rax":
+	#instruction start "32 = int_cast_zero 31":
+	movq %r13, %rax
+	movq %rax, %rbx
+	#instruction start "33 = constant(0)":
+	movq $0, %r12
+	#instruction start "34 = allocate_call_stack 0":
+	#instruction start "35 = set_reg %rax 33":
+	#instruction start "36 = call 32":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "37 = proj0 36":
+	#instruction start "38 = proj1 36":
+	#instruction start "39 = %rax":
+	#instruction start "40 = int_cast_zero 39":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "41 = constant(10)":
+	movl $10, %r12d
+	#instruction start "42 = 40 == 41":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "44 = if 20 42":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L6
+.L5:
+	#instruction start "47 = constant(3)":
+	movq $.Ls3, %rbx
+	#instruction start "48 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "49 = constant(12)":
+	movl $12, %r13d
+	#instruction start "50 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "51 = alloc with size 8":
+	leaq -88(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "52 = store 51 47, state: 37":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "53 = alloc with size 8":
+	leaq -96(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "54 = store 53 48, state: 52":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "55 = alloc with size 4":
+	leaq -100(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "56 = store 55 49, state: 54":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "57 = alloc with size 8":
+	leaq -108(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "58 = store 57 50, state: 56":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "59 = constant(2)":
+	leaq -24(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "60 = constant(0)":
+	leaq -32(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "61 = load part address of 51 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "62 = proj0 61":
+	#instruction start "63 = proj1 61":
+	#instruction start "64 = load part address of 53 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "65 = proj0 64":
+	#instruction start "66 = proj1 64":
+	#instruction start "67 = load part address of 55 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "68 = proj0 67":
+	#instruction start "69 = proj1 67":
+	#instruction start "70 = load part address of 57 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "71 = proj0 70":
+	#instruction start "72 = proj1 70":
+	#instruction start "73 = allocate_call_stack 0":
+	#instruction start "74 = set_reg %rdi 63":
+	#instruction start "75 = set_reg %rsi 66 state: 74":
+	#instruction start "76 = set_reg %rdx 69 state: 75":
+	#instruction start "77 = set_reg %rcx 72 state: 76":
+	#instruction start "78 = set_reg %rax 60 state: 77":
+	#instruction start "79 = call 59":
+	addq $0, %rsp
+	movq -32(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -24(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "80 = proj0 79":
+	#instruction start "81 = proj1 79":
+	#Block jump
+	jmp .L7
+.L6:
+	#Block jump elided
+.L7:
+	#instruction start "82 = constant(0)":
+	movl $0, %ebx
+	#instruction start "83 = set_reg %rax 82":
+	#instruction start "84 = phi (region: 43) 37 80":
+	#instruction start "85 = return 43, 83, 84":
+	movq %rbx, %rax
+	#Block return.
+	movq -116(%rbp), %rbx
+	movq -124(%rbp), %r12
+	movq -132(%rbp), %r13
+	movq -140(%rbp), %r14
+	movq -148(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls3:
+	.string "f2()() == 10\000"
+.Ls4:
+	.string "tests/function_returning_function_ptr.c\000"
+.Ls5:
+	.string "main"
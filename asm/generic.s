@@ -0,0 +1,817 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $736, %rsp
+	movq %rbx, -700(%rbp)
+	movq %r12, -708(%rbp)
+	movq %r13, -716(%rbp)
+	movq %r14, -724(%rbp)
+	movq %r15, -732(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "9 = alloc with size 12":
+	leaq -468(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "10 = set_zero_ptr 9, size: 12":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movl $0, 8(%rdi)
+	#instruction start "11 = constant(0)":
+	movq $0, %r12
+	#instruction start "12 = 9 + 11":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "13 = constant(0)":
+	movl $0, %ebx
+	#instruction start "14 = store 12 13, state: 10":
+	movq %r13, %rsi
+	movl %ebx, (%rsi)
+	#instruction start "15 = constant(1)":
+	movl $1, %ebx
+	#instruction start "17 = if 2 15":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "20 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "21 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "22 = constant(32)":
+	movl $32, %r13d
+	#instruction start "23 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "24 = alloc with size 8":
+	leaq -476(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "25 = store 24 20, state: 14":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "26 = alloc with size 8":
+	leaq -484(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "27 = store 26 21, state: 25":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "28 = alloc with size 4":
+	leaq -488(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "29 = store 28 22, state: 27":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "30 = alloc with size 8":
+	leaq -496(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "31 = store 30 23, state: 29":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "32 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "33 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "34 = load part address of 24 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "35 = proj0 34":
+	#instruction start "36 = proj1 34":
+	#instruction start "37 = load part address of 26 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "38 = proj0 37":
+	#instruction start "39 = proj1 37":
+	#instruction start "40 = load part address of 28 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "41 = proj0 40":
+	#instruction start "42 = proj1 40":
+	#instruction start "43 = load part address of 30 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "44 = proj0 43":
+	#instruction start "45 = proj1 43":
+	#instruction start "46 = allocate_call_stack 0":
+	#instruction start "47 = set_reg %rdi 36":
+	#instruction start "48 = set_reg %rsi 39 state: 47":
+	#instruction start "49 = set_reg %rdx 42 state: 48":
+	#instruction start "50 = set_reg %rcx 45 state: 49":
+	#instruction start "51 = set_reg %rax 33 state: 50":
+	#instruction start "52 = call 32":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "53 = proj0 52":
+	#instruction start "54 = proj1 52":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "55 = constant(1)":
+	movl $1, %ebx
+	#instruction start "57 = if 16 55":
+	#instruction start "65 = phi (region: 16) 14 53":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "60 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "61 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "62 = constant(34)":
+	movl $34, %r13d
+	#instruction start "63 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "64 = alloc with size 8":
+	leaq -504(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "66 = store 64 60, state: 65":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "67 = alloc with size 8":
+	leaq -512(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "68 = store 67 61, state: 66":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "69 = alloc with size 4":
+	leaq -516(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "70 = store 69 62, state: 68":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "71 = alloc with size 8":
+	leaq -524(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "72 = store 71 63, state: 70":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "73 = constant(0)":
+	leaq -64(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "74 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "75 = load part address of 64 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "76 = proj0 75":
+	#instruction start "77 = proj1 75":
+	#instruction start "78 = load part address of 67 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "79 = proj0 78":
+	#instruction start "80 = proj1 78":
+	#instruction start "81 = load part address of 69 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "82 = proj0 81":
+	#instruction start "83 = proj1 81":
+	#instruction start "84 = load part address of 71 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "85 = proj0 84":
+	#instruction start "86 = proj1 84":
+	#instruction start "87 = allocate_call_stack 0":
+	#instruction start "88 = set_reg %rdi 77":
+	#instruction start "89 = set_reg %rsi 80 state: 88":
+	#instruction start "90 = set_reg %rdx 83 state: 89":
+	#instruction start "91 = set_reg %rcx 86 state: 90":
+	#instruction start "92 = set_reg %rax 74 state: 91":
+	#instruction start "93 = call 73":
+	addq $0, %rsp
+	movq -72(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -64(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "94 = proj0 93":
+	#instruction start "95 = proj1 93":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "96 = constant(1)":
+	movl $1, %ebx
+	#instruction start "98 = if 56 96":
+	#instruction start "106 = phi (region: 56) 65 94":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "101 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "102 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "103 = constant(35)":
+	movl $35, %r13d
+	#instruction start "104 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "105 = alloc with size 8":
+	leaq -532(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "107 = store 105 101, state: 106":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "108 = alloc with size 8":
+	leaq -540(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "109 = store 108 102, state: 107":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "110 = alloc with size 4":
+	leaq -544(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "111 = store 110 103, state: 109":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "112 = alloc with size 8":
+	leaq -552(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "113 = store 112 104, state: 111":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "114 = constant(0)":
+	leaq -120(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "115 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "116 = load part address of 105 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "117 = proj0 116":
+	#instruction start "118 = proj1 116":
+	#instruction start "119 = load part address of 108 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "120 = proj0 119":
+	#instruction start "121 = proj1 119":
+	#instruction start "122 = load part address of 110 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "123 = proj0 122":
+	#instruction start "124 = proj1 122":
+	#instruction start "125 = load part address of 112 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "126 = proj0 125":
+	#instruction start "127 = proj1 125":
+	#instruction start "128 = allocate_call_stack 0":
+	#instruction start "129 = set_reg %rdi 118":
+	#instruction start "130 = set_reg %rsi 121 state: 129":
+	#instruction start "131 = set_reg %rdx 124 state: 130":
+	#instruction start "132 = set_reg %rcx 127 state: 131":
+	#instruction start "133 = set_reg %rax 115 state: 132":
+	#instruction start "134 = call 114":
+	addq $0, %rsp
+	movq -128(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -120(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "135 = proj0 134":
+	#instruction start "136 = proj1 134":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "137 = constant(1)":
+	movl $1, %ebx
+	#instruction start "139 = if 97 137":
+	#instruction start "147 = phi (region: 97) 106 135":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "142 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "143 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "144 = constant(36)":
+	movl $36, %r13d
+	#instruction start "145 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "146 = alloc with size 8":
+	leaq -560(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "148 = store 146 142, state: 147":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "149 = alloc with size 8":
+	leaq -568(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "150 = store 149 143, state: 148":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "151 = alloc with size 4":
+	leaq -572(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "152 = store 151 144, state: 150":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "153 = alloc with size 8":
+	leaq -580(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "154 = store 153 145, state: 152":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "155 = constant(0)":
+	leaq -176(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "156 = constant(0)":
+	leaq -184(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "157 = load part address of 146 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "158 = proj0 157":
+	#instruction start "159 = proj1 157":
+	#instruction start "160 = load part address of 149 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "161 = proj0 160":
+	#instruction start "162 = proj1 160":
+	#instruction start "163 = load part address of 151 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "164 = proj0 163":
+	#instruction start "165 = proj1 163":
+	#instruction start "166 = load part address of 153 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "167 = proj0 166":
+	#instruction start "168 = proj1 166":
+	#instruction start "169 = allocate_call_stack 0":
+	#instruction start "170 = set_reg %rdi 159":
+	#instruction start "171 = set_reg %rsi 162 state: 170":
+	#instruction start "172 = set_reg %rdx 165 state: 171":
+	#instruction start "173 = set_reg %rcx 168 state: 172":
+	#instruction start "174 = set_reg %rax 156 state: 173":
+	#instruction start "175 = call 155":
+	addq $0, %rsp
+	movq -184(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -176(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "176 = proj0 175":
+	#instruction start "177 = proj1 175":
+	#Block jump
+	jmp .L14
+.L13:
+	#Block jump elided
+.L14:
+	#instruction start "178 = constant(1)":
+	movl $1, %ebx
+	#instruction start "180 = if 138 178":
+	#instruction start "188 = phi (region: 138) 147 176":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#instruction start "183 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "184 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "185 = constant(37)":
+	movl $37, %r13d
+	#instruction start "186 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "187 = alloc with size 8":
+	leaq -588(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "189 = store 187 183, state: 188":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "190 = alloc with size 8":
+	leaq -596(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "191 = store 190 184, state: 189":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "192 = alloc with size 4":
+	leaq -600(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "193 = store 192 185, state: 191":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "194 = alloc with size 8":
+	leaq -608(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "195 = store 194 186, state: 193":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "196 = constant(0)":
+	leaq -232(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "197 = constant(0)":
+	leaq -240(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "198 = load part address of 187 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "199 = proj0 198":
+	#instruction start "200 = proj1 198":
+	#instruction start "201 = load part address of 190 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "202 = proj0 201":
+	#instruction start "203 = proj1 201":
+	#instruction start "204 = load part address of 192 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "205 = proj0 204":
+	#instruction start "206 = proj1 204":
+	#instruction start "207 = load part address of 194 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "208 = proj0 207":
+	#instruction start "209 = proj1 207":
+	#instruction start "210 = allocate_call_stack 0":
+	#instruction start "211 = set_reg %rdi 200":
+	#instruction start "212 = set_reg %rsi 203 state: 211":
+	#instruction start "213 = set_reg %rdx 206 state: 212":
+	#instruction start "214 = set_reg %rcx 209 state: 213":
+	#instruction start "215 = set_reg %rax 197 state: 214":
+	#instruction start "216 = call 196":
+	addq $0, %rsp
+	movq -240(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -232(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "217 = proj0 216":
+	#instruction start "218 = proj1 216":
+	#Block jump
+	jmp .L17
+.L16:
+	#Block jump elided
+.L17:
+	#instruction start "219 = constant(1)":
+	movl $1, %ebx
+	#instruction start "221 = if 179 219":
+	#instruction start "229 = phi (region: 179) 188 217":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "224 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "225 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "226 = constant(38)":
+	movl $38, %r13d
+	#instruction start "227 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "228 = alloc with size 8":
+	leaq -616(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "230 = store 228 224, state: 229":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "231 = alloc with size 8":
+	leaq -624(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "232 = store 231 225, state: 230":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "233 = alloc with size 4":
+	leaq -628(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "234 = store 233 226, state: 232":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "235 = alloc with size 8":
+	leaq -636(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "236 = store 235 227, state: 234":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "237 = constant(0)":
+	leaq -288(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "238 = constant(0)":
+	leaq -296(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "239 = load part address of 228 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "240 = proj0 239":
+	#instruction start "241 = proj1 239":
+	#instruction start "242 = load part address of 231 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "243 = proj0 242":
+	#instruction start "244 = proj1 242":
+	#instruction start "245 = load part address of 233 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "246 = proj0 245":
+	#instruction start "247 = proj1 245":
+	#instruction start "248 = load part address of 235 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "249 = proj0 248":
+	#instruction start "250 = proj1 248":
+	#instruction start "251 = allocate_call_stack 0":
+	#instruction start "252 = set_reg %rdi 241":
+	#instruction start "253 = set_reg %rsi 244 state: 252":
+	#instruction start "254 = set_reg %rdx 247 state: 253":
+	#instruction start "255 = set_reg %rcx 250 state: 254":
+	#instruction start "256 = set_reg %rax 238 state: 255":
+	#instruction start "257 = call 237":
+	addq $0, %rsp
+	movq -296(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -288(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "258 = proj0 257":
+	#instruction start "259 = proj1 257":
+	#Block jump
+	jmp .L20
+.L19:
+	#Block jump elided
+.L20:
+	#instruction start "260 = constant(1)":
+	movl $1, %ebx
+	#instruction start "262 = if 220 260":
+	#instruction start "270 = phi (region: 220) 229 258":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "265 = constant(9)":
+	movq $.Ls9, %rbx
+	#instruction start "266 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "267 = constant(39)":
+	movl $39, %r13d
+	#instruction start "268 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "269 = alloc with size 8":
+	leaq -644(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "271 = store 269 265, state: 270":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "272 = alloc with size 8":
+	leaq -652(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "273 = store 272 266, state: 271":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "274 = alloc with size 4":
+	leaq -656(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "275 = store 274 267, state: 273":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "276 = alloc with size 8":
+	leaq -664(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "277 = store 276 268, state: 275":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "278 = constant(0)":
+	leaq -344(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "279 = constant(0)":
+	leaq -352(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "280 = load part address of 269 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "281 = proj0 280":
+	#instruction start "282 = proj1 280":
+	#instruction start "283 = load part address of 272 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "284 = proj0 283":
+	#instruction start "285 = proj1 283":
+	#instruction start "286 = load part address of 274 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "287 = proj0 286":
+	#instruction start "288 = proj1 286":
+	#instruction start "289 = load part address of 276 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "290 = proj0 289":
+	#instruction start "291 = proj1 289":
+	#instruction start "292 = allocate_call_stack 0":
+	#instruction start "293 = set_reg %rdi 282":
+	#instruction start "294 = set_reg %rsi 285 state: 293":
+	#instruction start "295 = set_reg %rdx 288 state: 294":
+	#instruction start "296 = set_reg %rcx 291 state: 295":
+	#instruction start "297 = set_reg %rax 279 state: 296":
+	#instruction start "298 = call 278":
+	addq $0, %rsp
+	movq -352(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -344(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "299 = proj0 298":
+	#instruction start "300 = proj1 298":
+	#Block jump
+	jmp .L23
+.L22:
+	#Block jump elided
+.L23:
+	#instruction start "301 = constant(1)":
+	movl $1, %ebx
+	#instruction start "303 = if 261 301":
+	#instruction start "311 = phi (region: 261) 270 299":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L25
+.L24:
+	#instruction start "306 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "307 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "308 = constant(41)":
+	movl $41, %r13d
+	#instruction start "309 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "310 = alloc with size 8":
+	leaq -672(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "312 = store 310 306, state: 311":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "313 = alloc with size 8":
+	leaq -680(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "314 = store 313 307, state: 312":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "315 = alloc with size 4":
+	leaq -684(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "316 = store 315 308, state: 314":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "317 = alloc with size 8":
+	leaq -692(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "318 = store 317 309, state: 316":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "319 = constant(0)":
+	leaq -400(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "320 = constant(0)":
+	leaq -408(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "321 = load part address of 310 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "322 = proj0 321":
+	#instruction start "323 = proj1 321":
+	#instruction start "324 = load part address of 313 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "325 = proj0 324":
+	#instruction start "326 = proj1 324":
+	#instruction start "327 = load part address of 315 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "328 = proj0 327":
+	#instruction start "329 = proj1 327":
+	#instruction start "330 = load part address of 317 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "331 = proj0 330":
+	#instruction start "332 = proj1 330":
+	#instruction start "333 = allocate_call_stack 0":
+	#instruction start "334 = set_reg %rdi 323":
+	#instruction start "335 = set_reg %rsi 326 state: 334":
+	#instruction start "336 = set_reg %rdx 329 state: 335":
+	#instruction start "337 = set_reg %rcx 332 state: 336":
+	#instruction start "338 = set_reg %rax 320 state: 337":
+	#instruction start "339 = call 319":
+	addq $0, %rsp
+	movq -408(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -400(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "340 = proj0 339":
+	#instruction start "341 = proj1 339":
+	#Block jump
+	jmp .L26
+.L25:
+	#Block jump elided
+.L26:
+	#instruction start "342 = constant(0)":
+	movl $0, %ebx
+	#instruction start "343 = set_reg %rax 342":
+	#instruction start "344 = phi (region: 302) 311 340":
+	#instruction start "345 = return 302, 343, 344":
+	movq %rbx, %rax
+	#Block return.
+	movq -700(%rbp), %rbx
+	movq -708(%rbp), %r12
+	movq -716(%rbp), %r13
+	movq -724(%rbp), %r14
+	movq -732(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "typeid('0') == 6\000"
+.Ls2:
+	.string "tests/generic.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "typeid(i) == 8\000"
+.Ls5:
+	.string "typeid(p) == 8\000"
+.Ls6:
+	.string "typeid(s) == 9\000"
+.Ls7:
+	.string "typeid(0x7FFFFFFF) == 6\000"
+.Ls8:
+	.string "typeid(0xFFFFFFFF) == 7\000"
+.Ls9:
+	.string "typeid(0x7FFFFFFFU) == 7\000"
+.Ls10:
+	.string "typeid(ai) == 17\000"
@@ -0,0 +1,61 @@
+.global func
+func:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movq %rbx, -24(%rbp)
+	movq %r12, -32(%rbp)
+	movq %r13, -40(%rbp)
+	movq %r14, -48(%rbp)
+	movl %edi, %ebx
+	movl %esi, %r12d
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = %rsi":
+	#instruction start "8 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "9 = alloc with size 4":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "10 = store part of 8 with offset 0":
+	movq %r13, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "11 = store part of 9 with offset 0":
+	movq %r14, %rsi
+	leaq (%rsi), %rsi
+	movl %r12d, (%rsi)
+	#instruction start "12 = load 9, state: 11":
+	movq %r14, %rdi
+	movl (%rdi), %ebx
+	#instruction start "13 = set_reg %rax 12":
+	#instruction start "14 = return 2, 13, 11":
+	movq %rbx, %rax
+	#Block return.
+	movq -24(%rbp), %rbx
+	movq -32(%rbp), %r12
+	movq -40(%rbp), %r13
+	movq -48(%rbp), %r14
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rbx, -16(%rbp)
+.L3:
+	#instruction start "18 = proj3 16":
+	#instruction start "23 = constant(0)":
+	movl $0, %ebx
+	#instruction start "26 = set_reg %rax 23":
+	#instruction start "27 = return 17, 26, 18":
+	movq %rbx, %rax
+	#Block return.
+	movq -16(%rbp), %rbx
+	leave 
+	ret 
+.section .rodata
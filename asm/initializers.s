@@ -0,0 +1,6273 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $3120, %rsp
+	movq %rbx, -3083(%rbp)
+	movq %r12, -3091(%rbp)
+	movq %r13, -3099(%rbp)
+	movq %r14, -3107(%rbp)
+	movq %r15, -3115(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "8 = constant(10)":
+	leaq -4(%rbp), %rdi
+	movl $10, (%rdi)
+	#instruction start "12 = constant(10)":
+	movl $10, %r12d
+	#instruction start "16 = constant(10)":
+	leaq -8(%rbp), %rdi
+	movl $10, (%rdi)
+	#instruction start "20 = 8 == 12":
+	movl -4(%rbp), %eax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "22 = if 2 20":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "25 = constant(1)":
+	movq $.Ls1, %r12
+	#instruction start "26 = constant(2)":
+	movq $.Ls2, %r14
+	#instruction start "27 = constant(10)":
+	movl $10, %r15d
+	#instruction start "28 = constant(3)":
+	movq $.Ls3, %r13
+	#instruction start "29 = alloc with size 8":
+	leaq -1768(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "30 = store 29 25, state: 3":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "31 = alloc with size 8":
+	leaq -1776(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "32 = store 31 26, state: 30":
+	movq %r12, %rsi
+	movq %r14, (%rsi)
+	#instruction start "33 = alloc with size 4":
+	leaq -1780(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "34 = store 33 27, state: 32":
+	movq %r14, %rsi
+	movl %r15d, (%rsi)
+	#instruction start "35 = alloc with size 8":
+	leaq -1788(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "36 = store 35 28, state: 34":
+	movq %r15, %rsi
+	movq %r13, (%rsi)
+	#instruction start "37 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "38 = constant(0)":
+	leaq -24(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "39 = load part address of 29 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "40 = proj0 39":
+	#instruction start "41 = proj1 39":
+	#instruction start "42 = load part address of 31 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "43 = proj0 42":
+	#instruction start "44 = proj1 42":
+	#instruction start "45 = load part address of 33 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "46 = proj0 45":
+	#instruction start "47 = proj1 45":
+	#instruction start "48 = load part address of 35 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "49 = proj0 48":
+	#instruction start "50 = proj1 48":
+	#instruction start "51 = allocate_call_stack 0":
+	#instruction start "52 = set_reg %rdi 41":
+	#instruction start "53 = set_reg %rsi 44 state: 52":
+	#instruction start "54 = set_reg %rdx 47 state: 53":
+	#instruction start "55 = set_reg %rcx 50 state: 54":
+	#instruction start "56 = set_reg %rax 38 state: 55":
+	#instruction start "57 = call 37":
+	addq $0, %rsp
+	movq -24(%rbp), %rax
+	movq %r14, %rcx
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r13, %rdi
+	movq -16(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "58 = proj0 57":
+	#instruction start "59 = proj1 57":
+	#Phi node to 2366 (21 8 8)
+	movl -4(%rbp), %eax
+	movl %eax, %ebx
+	#Phi node to 2367 (21 16 16)
+	movl -8(%rbp), %eax
+	movl %eax, %r12d
+	#Block jump
+	jmp .L5
+.L4:
+	#Phi node to 2366 (21 8 8)
+	movl -4(%rbp), %eax
+	movl %eax, %ebx
+	#Phi node to 2367 (21 16 16)
+	movl -8(%rbp), %eax
+	movl %eax, %r12d
+	#Block jump elided
+.L5:
+	#instruction start "60 = phi (region: 21) 3 58":
+	#instruction start "2366 = phi (region: 21) 8 8":
+	#instruction start "2367 = phi (region: 21) 16 16":
+	#instruction start "63 = 2366 == 2367":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "65 = if 21 63":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "68 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "69 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "70 = constant(11)":
+	movl $11, %r13d
+	#instruction start "71 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "72 = alloc with size 8":
+	leaq -1796(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "73 = store 72 68, state: 60":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "74 = alloc with size 8":
+	leaq -1804(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "75 = store 74 69, state: 73":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "76 = alloc with size 4":
+	leaq -1808(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "77 = store 76 70, state: 75":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "78 = alloc with size 8":
+	leaq -1816(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "79 = store 78 71, state: 77":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "80 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "81 = constant(0)":
+	leaq -80(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "82 = load part address of 72 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "83 = proj0 82":
+	#instruction start "84 = proj1 82":
+	#instruction start "85 = load part address of 74 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "86 = proj0 85":
+	#instruction start "87 = proj1 85":
+	#instruction start "88 = load part address of 76 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "89 = proj0 88":
+	#instruction start "90 = proj1 88":
+	#instruction start "91 = load part address of 78 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "92 = proj0 91":
+	#instruction start "93 = proj1 91":
+	#instruction start "94 = allocate_call_stack 0":
+	#instruction start "95 = set_reg %rdi 84":
+	#instruction start "96 = set_reg %rsi 87 state: 95":
+	#instruction start "97 = set_reg %rdx 90 state: 96":
+	#instruction start "98 = set_reg %rcx 93 state: 97":
+	#instruction start "99 = set_reg %rax 81 state: 98":
+	#instruction start "100 = call 80":
+	addq $0, %rsp
+	movq -80(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -72(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "101 = proj0 100":
+	#instruction start "102 = proj1 100":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "104 = phi (region: 64) 60 101":
+	#instruction start "106 = constant(4294967295)":
+	movl $4294967295, %ebx
+	#instruction start "109 = constant(4294967295)":
+	movl $4294967295, %r12d
+	#instruction start "110 = 106 == 109":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "112 = if 64 110":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "115 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "116 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "117 = constant(14)":
+	movl $14, %r13d
+	#instruction start "118 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "119 = alloc with size 8":
+	leaq -1824(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "120 = store 119 115, state: 104":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "121 = alloc with size 8":
+	leaq -1832(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "122 = store 121 116, state: 120":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "123 = alloc with size 4":
+	leaq -1836(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "124 = store 123 117, state: 122":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "125 = alloc with size 8":
+	leaq -1844(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "126 = store 125 118, state: 124":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "127 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "128 = constant(0)":
+	leaq -136(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "129 = load part address of 119 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "130 = proj0 129":
+	#instruction start "131 = proj1 129":
+	#instruction start "132 = load part address of 121 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "133 = proj0 132":
+	#instruction start "134 = proj1 132":
+	#instruction start "135 = load part address of 123 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "136 = proj0 135":
+	#instruction start "137 = proj1 135":
+	#instruction start "138 = load part address of 125 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "139 = proj0 138":
+	#instruction start "140 = proj1 138":
+	#instruction start "141 = allocate_call_stack 0":
+	#instruction start "142 = set_reg %rdi 131":
+	#instruction start "143 = set_reg %rsi 134 state: 142":
+	#instruction start "144 = set_reg %rdx 137 state: 143":
+	#instruction start "145 = set_reg %rcx 140 state: 144":
+	#instruction start "146 = set_reg %rax 128 state: 145":
+	#instruction start "147 = call 127":
+	addq $0, %rsp
+	movq -136(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -128(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "148 = proj0 147":
+	#instruction start "149 = proj1 147":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "150 = alloc with size 8":
+	leaq -1852(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "151 = constant(0)":
+	movq $0, %r12
+	#instruction start "152 = 150 + 151":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "153 = constant(10)":
+	movl $10, %r12d
+	#instruction start "154 = phi (region: 111) 104 148":
+	#instruction start "155 = store 152 153, state: 154":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "156 = constant(4)":
+	movq $4, %r12
+	#instruction start "157 = 150 + 156":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "158 = constant(20)":
+	movl $20, %r12d
+	#instruction start "159 = store 157 158, state: 155":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "160 = alloc with size 8":
+	leaq -1860(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "161 = set_zero_ptr 160, size: 8":
+	movq %r12, %rdi
+	movq $0, (%rdi)
+	#instruction start "162 = memcpy from 160 to 150":
+	movq %r12, %rsi
+	movq %rbx, %rdi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	#instruction start "163 = constant(0)":
+	movq $0, %r13
+	#instruction start "164 = 160 + 163":
+	movq %r12, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "165 = constant(0)":
+	movq $0, %r13
+	#instruction start "166 = 150 + 165":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "167 = load_volatile 164, state: 162":
+	movq %r14, %rdi
+	movl (%rdi), %ebx
+	#instruction start "168 = proj0 167":
+	#instruction start "169 = proj1 167":
+	#instruction start "170 = load_volatile 166, state: 168":
+	movq %r15, %rdi
+	movl (%rdi), %r13d
+	#instruction start "171 = proj0 170":
+	#instruction start "172 = proj1 170":
+	#instruction start "173 = 169 == 172":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "174 = if 111 173":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "199 = alloc with size 4":
+	leaq -1864(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "200 = constant(0)":
+	movl $0, %r13d
+	#instruction start "201 = store 199 200, state: 171":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 203 (202 198 199)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L17
+.L13:
+	#instruction start "177 = constant(4)":
+	movq $4, %rbx
+	#instruction start "178 = 160 + 177":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "179 = constant(4)":
+	movq $4, %rbx
+	#instruction start "180 = 160 + 179":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "181 = load_volatile 178, state: 171":
+	movq %r14, %rdi
+	movl (%rdi), %ebx
+	#instruction start "182 = proj0 181":
+	#instruction start "183 = proj1 181":
+	#instruction start "184 = load_volatile 180, state: 182":
+	movq %r15, %rdi
+	movl (%rdi), %r12d
+	#instruction start "185 = proj0 184":
+	#instruction start "186 = proj1 184":
+	#instruction start "187 = 183 == 186":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "188 = if 176 187":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L15
+.L14:
+	#instruction start "194 = alloc with size 4":
+	leaq -1868(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "195 = constant(0)":
+	movl $0, %r12d
+	#instruction start "196 = store 194 195, state: 185":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 198 (197 191 194)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L16
+.L15:
+	#instruction start "191 = alloc with size 4":
+	leaq -1872(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "192 = constant(1)":
+	movl $1, %r14d
+	#instruction start "193 = store 191 192, state: 185":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 198 (197 191 194)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L16:
+	#instruction start "198 = phi (region: 197) 191 194":
+	#instruction start "205 = phi (region: 197) 193 196":
+	#Phi node to 203 (202 198 199)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L17:
+	#instruction start "203 = phi (region: 202) 198 199":
+	#instruction start "204 = phi (region: 202) 205 201":
+	#instruction start "206 = load_volatile 203, state: 204":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "207 = proj0 206":
+	#instruction start "208 = proj1 206":
+	#instruction start "210 = if 202 208":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "213 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "214 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "215 = constant(25)":
+	movl $25, %r13d
+	#instruction start "216 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "217 = alloc with size 8":
+	leaq -1880(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "218 = store 217 213, state: 207":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "219 = alloc with size 8":
+	leaq -1888(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "220 = store 219 214, state: 218":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "221 = alloc with size 4":
+	leaq -1892(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "222 = store 221 215, state: 220":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "223 = alloc with size 8":
+	leaq -1900(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "224 = store 223 216, state: 222":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "225 = constant(0)":
+	leaq -184(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "226 = constant(0)":
+	leaq -192(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "227 = load part address of 217 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "228 = proj0 227":
+	#instruction start "229 = proj1 227":
+	#instruction start "230 = load part address of 219 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "231 = proj0 230":
+	#instruction start "232 = proj1 230":
+	#instruction start "233 = load part address of 221 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "234 = proj0 233":
+	#instruction start "235 = proj1 233":
+	#instruction start "236 = load part address of 223 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "237 = proj0 236":
+	#instruction start "238 = proj1 236":
+	#instruction start "239 = allocate_call_stack 0":
+	#instruction start "240 = set_reg %rdi 229":
+	#instruction start "241 = set_reg %rsi 232 state: 240":
+	#instruction start "242 = set_reg %rdx 235 state: 241":
+	#instruction start "243 = set_reg %rcx 238 state: 242":
+	#instruction start "244 = set_reg %rax 226 state: 243":
+	#instruction start "245 = call 225":
+	addq $0, %rsp
+	movq -192(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -184(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "246 = proj0 245":
+	#instruction start "247 = proj1 245":
+	#Block jump
+	jmp .L20
+.L19:
+	#Block jump elided
+.L20:
+	#instruction start "248 = alloc with size 6":
+	leaq -1906(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "249 = phi (region: 209) 207 246":
+	#instruction start "250 = set_zero_ptr 248, size: 6":
+	movq %rbx, %rdi
+	movl $0, (%rdi)
+	movw $0, 4(%rdi)
+	#instruction start "251 = constant(72)":
+	movl $72, %r12d
+	#instruction start "252 = constant(0)":
+	movq $0, %r13
+	#instruction start "253 = 252 + 248":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "254 = store 253 251, state: 250":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "255 = constant(101)":
+	movl $101, %r12d
+	#instruction start "256 = constant(1)":
+	movq $1, %r13
+	#instruction start "257 = 256 + 248":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "258 = store 257 255, state: 254":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "259 = constant(108)":
+	movl $108, %r12d
+	#instruction start "260 = constant(2)":
+	movq $2, %r13
+	#instruction start "261 = 260 + 248":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "262 = store 261 259, state: 258":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "263 = constant(108)":
+	movl $108, %r12d
+	#instruction start "264 = constant(3)":
+	movq $3, %r13
+	#instruction start "265 = 264 + 248":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "266 = store 265 263, state: 262":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "267 = constant(111)":
+	movl $111, %r12d
+	#instruction start "268 = constant(4)":
+	movq $4, %r13
+	#instruction start "269 = 268 + 248":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "270 = store 269 267, state: 266":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "271 = constant(0)":
+	movl $0, %r12d
+	#instruction start "272 = constant(5)":
+	movq $5, %r13
+	#instruction start "273 = 272 + 248":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "274 = store 273 271, state: 270":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "275 = alloc with size 6":
+	leaq -1912(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "276 = set_zero_ptr 275, size: 6":
+	movq %r12, %rdi
+	movl $0, (%rdi)
+	movw $0, 4(%rdi)
+	#instruction start "277 = constant(72)":
+	movl $72, %r13d
+	#instruction start "278 = constant(0)":
+	movq $0, %r14
+	#instruction start "279 = 278 + 275":
+	movq %r14, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "280 = store 279 277, state: 276":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "281 = constant(101)":
+	movl $101, %r13d
+	#instruction start "282 = constant(1)":
+	movq $1, %r14
+	#instruction start "283 = 282 + 275":
+	movq %r14, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "284 = store 283 281, state: 280":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "285 = constant(108)":
+	movl $108, %r13d
+	#instruction start "286 = constant(2)":
+	movq $2, %r14
+	#instruction start "287 = 286 + 275":
+	movq %r14, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "288 = store 287 285, state: 284":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "289 = constant(108)":
+	movl $108, %r13d
+	#instruction start "290 = constant(3)":
+	movq $3, %r14
+	#instruction start "291 = 290 + 275":
+	movq %r14, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "292 = store 291 289, state: 288":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "293 = constant(111)":
+	movl $111, %r13d
+	#instruction start "294 = constant(4)":
+	movq $4, %r14
+	#instruction start "295 = 294 + 275":
+	movq %r14, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "296 = store 295 293, state: 292":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "297 = constant(0)":
+	movl $0, %r13d
+	#instruction start "298 = constant(5)":
+	movq $5, %r14
+	#instruction start "299 = 298 + 275":
+	movq %r14, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "300 = store 299 297, state: 296":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "301 = alloc with size 8":
+	leaq -1920(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "302 = store 301 248, state: 300":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "303 = alloc with size 8":
+	leaq -1928(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "304 = store 303 275, state: 302":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "305 = constant(7)":
+	movq $strcmp, %r12
+	#instruction start "306 = constant(0)":
+	movq $0, %r14
+	#instruction start "307 = load part address of 301 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "308 = proj0 307":
+	#instruction start "309 = proj1 307":
+	#instruction start "310 = load part address of 303 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "311 = proj0 310":
+	#instruction start "312 = proj1 310":
+	#instruction start "313 = allocate_call_stack 0":
+	#instruction start "314 = set_reg %rdi 309":
+	#instruction start "315 = set_reg %rsi 312 state: 314":
+	#instruction start "316 = set_reg %rax 306 state: 315":
+	#instruction start "317 = call 305":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "318 = proj0 317":
+	#instruction start "319 = proj1 317":
+	#instruction start "320 = %rax":
+	#instruction start "321 = int_cast_zero 320":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "322 = constant(0)":
+	movl $0, %ebx
+	#instruction start "323 = 321 == 322":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "325 = if 209 323":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "328 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "329 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "330 = constant(32)":
+	movl $32, %r13d
+	#instruction start "331 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "332 = alloc with size 8":
+	leaq -1936(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "333 = store 332 328, state: 318":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "334 = alloc with size 8":
+	leaq -1944(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "335 = store 334 329, state: 333":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "336 = alloc with size 4":
+	leaq -1948(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "337 = store 336 330, state: 335":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "338 = alloc with size 8":
+	leaq -1956(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "339 = store 338 331, state: 337":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "340 = constant(0)":
+	leaq -264(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "341 = constant(0)":
+	leaq -272(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "342 = load part address of 332 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "343 = proj0 342":
+	#instruction start "344 = proj1 342":
+	#instruction start "345 = load part address of 334 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "346 = proj0 345":
+	#instruction start "347 = proj1 345":
+	#instruction start "348 = load part address of 336 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "349 = proj0 348":
+	#instruction start "350 = proj1 348":
+	#instruction start "351 = load part address of 338 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "352 = proj0 351":
+	#instruction start "353 = proj1 351":
+	#instruction start "354 = allocate_call_stack 0":
+	#instruction start "355 = set_reg %rdi 344":
+	#instruction start "356 = set_reg %rsi 347 state: 355":
+	#instruction start "357 = set_reg %rdx 350 state: 356":
+	#instruction start "358 = set_reg %rcx 353 state: 357":
+	#instruction start "359 = set_reg %rax 341 state: 358":
+	#instruction start "360 = call 340":
+	addq $0, %rsp
+	movq -272(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -264(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "361 = proj0 360":
+	#instruction start "362 = proj1 360":
+	#Block jump
+	jmp .L23
+.L22:
+	#Block jump elided
+.L23:
+	#instruction start "363 = alloc with size 8":
+	leaq -1964(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "364 = phi (region: 324) 318 361":
+	#instruction start "365 = set_zero_ptr 363, size: 8":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	#instruction start "366 = constant(0)":
+	movq $0, %r12
+	#instruction start "367 = 363 + 366":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "368 = constant(64)":
+	movl $64, %r12d
+	#instruction start "369 = store 367 368, state: 365":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "370 = constant(4)":
+	movq $4, %r12
+	#instruction start "371 = 363 + 370":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "372 = constant(64)":
+	movl $64, %r12d
+	#instruction start "373 = store 371 372, state: 369":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "374 = constant(0)":
+	movq $0, %r12
+	#instruction start "375 = 363 + 374":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "376 = constant(4)":
+	movq $4, %r12
+	#instruction start "377 = 363 + 376":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "378 = load_volatile 375, state: 373":
+	movq %r13, %rdi
+	movl (%rdi), %r12d
+	#instruction start "379 = proj0 378":
+	#instruction start "380 = proj1 378":
+	#instruction start "381 = load_volatile 377, state: 379":
+	movq %r14, %rdi
+	movl (%rdi), %r13d
+	#instruction start "382 = proj0 381":
+	#instruction start "383 = proj1 381":
+	#instruction start "384 = 380 == 383":
+	movq %r12, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "385 = if 324 384":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L25
+.L24:
+	#instruction start "406 = alloc with size 4":
+	leaq -1968(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "407 = constant(0)":
+	movl $0, %r13d
+	#instruction start "408 = store 406 407, state: 382":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 410 (409 405 406)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L29
+.L25:
+	#instruction start "388 = constant(0)":
+	movq $0, %r12
+	#instruction start "389 = 363 + 388":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "390 = load_volatile 389, state: 382":
+	movq %r14, %rdi
+	movl (%rdi), %ebx
+	#instruction start "391 = proj0 390":
+	#instruction start "392 = proj1 390":
+	#instruction start "393 = constant(64)":
+	movl $64, %r12d
+	#instruction start "394 = 392 == 393":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "395 = if 387 394":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L27
+.L26:
+	#instruction start "401 = alloc with size 4":
+	leaq -1972(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "402 = constant(0)":
+	movl $0, %r12d
+	#instruction start "403 = store 401 402, state: 391":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 405 (404 398 401)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L28
+.L27:
+	#instruction start "398 = alloc with size 4":
+	leaq -1976(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "399 = constant(1)":
+	movl $1, %r14d
+	#instruction start "400 = store 398 399, state: 391":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 405 (404 398 401)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L28:
+	#instruction start "405 = phi (region: 404) 398 401":
+	#instruction start "412 = phi (region: 404) 400 403":
+	#Phi node to 410 (409 405 406)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L29:
+	#instruction start "410 = phi (region: 409) 405 406":
+	#instruction start "411 = phi (region: 409) 412 408":
+	#instruction start "413 = load_volatile 410, state: 411":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "414 = proj0 413":
+	#instruction start "415 = proj1 413":
+	#instruction start "417 = if 409 415":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L31
+.L30:
+	#instruction start "420 = constant(9)":
+	movq $.Ls9, %rbx
+	#instruction start "421 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "422 = constant(42)":
+	movl $42, %r13d
+	#instruction start "423 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "424 = alloc with size 8":
+	leaq -1984(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "425 = store 424 420, state: 414":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "426 = alloc with size 8":
+	leaq -1992(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "427 = store 426 421, state: 425":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "428 = alloc with size 4":
+	leaq -1996(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "429 = store 428 422, state: 427":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "430 = alloc with size 8":
+	leaq -2004(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "431 = store 430 423, state: 429":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "432 = constant(0)":
+	leaq -320(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "433 = constant(0)":
+	leaq -328(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "434 = load part address of 424 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "435 = proj0 434":
+	#instruction start "436 = proj1 434":
+	#instruction start "437 = load part address of 426 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "438 = proj0 437":
+	#instruction start "439 = proj1 437":
+	#instruction start "440 = load part address of 428 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "441 = proj0 440":
+	#instruction start "442 = proj1 440":
+	#instruction start "443 = load part address of 430 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "444 = proj0 443":
+	#instruction start "445 = proj1 443":
+	#instruction start "446 = allocate_call_stack 0":
+	#instruction start "447 = set_reg %rdi 436":
+	#instruction start "448 = set_reg %rsi 439 state: 447":
+	#instruction start "449 = set_reg %rdx 442 state: 448":
+	#instruction start "450 = set_reg %rcx 445 state: 449":
+	#instruction start "451 = set_reg %rax 433 state: 450":
+	#instruction start "452 = call 432":
+	addq $0, %rsp
+	movq -328(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -320(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "453 = proj0 452":
+	#instruction start "454 = proj1 452":
+	#Block jump
+	jmp .L32
+.L31:
+	#Block jump elided
+.L32:
+	#instruction start "455 = alloc with size 20":
+	leaq -2024(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "456 = phi (region: 416) 414 453":
+	#instruction start "457 = set_zero_ptr 455, size: 20":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	movl $0, 16(%rdi)
+	#instruction start "458 = constant(0)":
+	movq $0, %r12
+	#instruction start "459 = 455 + 458":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "460 = constant(10)":
+	movl $10, %r12d
+	#instruction start "461 = store 459 460, state: 457":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "462 = constant(4)":
+	movq $4, %r12
+	#instruction start "463 = 455 + 462":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "464 = constant(0)":
+	movq $0, %r12
+	#instruction start "465 = 463 + 464":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "466 = constant(72)":
+	movl $72, %r12d
+	#instruction start "467 = constant(0)":
+	movq $0, %r13
+	#instruction start "468 = 467 + 465":
+	movq %r13, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "469 = store 468 466, state: 461":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "470 = constant(101)":
+	movl $101, %r12d
+	#instruction start "471 = constant(1)":
+	movq $1, %r13
+	#instruction start "472 = 471 + 465":
+	movq %r13, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "473 = store 472 470, state: 469":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "474 = constant(108)":
+	movl $108, %r12d
+	#instruction start "475 = constant(2)":
+	movq $2, %r13
+	#instruction start "476 = 475 + 465":
+	movq %r13, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "477 = store 476 474, state: 473":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "478 = constant(108)":
+	movl $108, %r12d
+	#instruction start "479 = constant(3)":
+	movq $3, %r13
+	#instruction start "480 = 479 + 465":
+	movq %r13, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "481 = store 480 478, state: 477":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "482 = constant(111)":
+	movl $111, %r12d
+	#instruction start "483 = constant(4)":
+	movq $4, %r13
+	#instruction start "484 = 483 + 465":
+	movq %r13, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "485 = store 484 482, state: 481":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "486 = constant(0)":
+	movl $0, %r12d
+	#instruction start "487 = constant(5)":
+	movq $5, %r13
+	#instruction start "488 = 487 + 465":
+	movq %r13, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "489 = store 488 486, state: 485":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "490 = constant(16)":
+	movq $16, %r12
+	#instruction start "491 = 455 + 490":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "492 = constant(7)":
+	movl $7, %r12d
+	#instruction start "493 = store 491 492, state: 489":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "494 = constant(4)":
+	movq $4, %r12
+	#instruction start "495 = 455 + 494":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "496 = constant(8)":
+	movq $8, %rbx
+	#instruction start "497 = 495 + 496":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "498 = load_volatile 497, state: 493":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "499 = proj0 498":
+	#instruction start "500 = proj1 498":
+	#instruction start "501 = constant(0)":
+	movl $0, %r12d
+	#instruction start "502 = 500 == 501":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "504 = if 416 502":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L34
+.L33:
+	#instruction start "507 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "508 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "509 = constant(59)":
+	movl $59, %r13d
+	#instruction start "510 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "511 = alloc with size 8":
+	leaq -2032(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "512 = store 511 507, state: 499":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "513 = alloc with size 8":
+	leaq -2040(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "514 = store 513 508, state: 512":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "515 = alloc with size 4":
+	leaq -2044(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "516 = store 515 509, state: 514":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "517 = alloc with size 8":
+	leaq -2052(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "518 = store 517 510, state: 516":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "519 = constant(0)":
+	leaq -376(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "520 = constant(0)":
+	leaq -384(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "521 = load part address of 511 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "522 = proj0 521":
+	#instruction start "523 = proj1 521":
+	#instruction start "524 = load part address of 513 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "525 = proj0 524":
+	#instruction start "526 = proj1 524":
+	#instruction start "527 = load part address of 515 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "528 = proj0 527":
+	#instruction start "529 = proj1 527":
+	#instruction start "530 = load part address of 517 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "531 = proj0 530":
+	#instruction start "532 = proj1 530":
+	#instruction start "533 = allocate_call_stack 0":
+	#instruction start "534 = set_reg %rdi 523":
+	#instruction start "535 = set_reg %rsi 526 state: 534":
+	#instruction start "536 = set_reg %rdx 529 state: 535":
+	#instruction start "537 = set_reg %rcx 532 state: 536":
+	#instruction start "538 = set_reg %rax 520 state: 537":
+	#instruction start "539 = call 519":
+	addq $0, %rsp
+	movq -384(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -376(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "540 = proj0 539":
+	#instruction start "541 = proj1 539":
+	#Block jump
+	jmp .L35
+.L34:
+	#Block jump elided
+.L35:
+	#instruction start "542 = alloc with size 16":
+	leaq -2068(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "543 = phi (region: 503) 499 540":
+	#instruction start "544 = set_zero_ptr 542, size: 16":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	#instruction start "545 = constant(0)":
+	movq $0, %r12
+	#instruction start "546 = 542 + 545":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "547 = constant(10)":
+	movl $10, %r12d
+	#instruction start "548 = store 546 547, state: 544":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "549 = constant(4)":
+	movq $4, %r12
+	#instruction start "550 = 542 + 549":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "551 = constant(72)":
+	movl $72, %r12d
+	#instruction start "552 = constant(0)":
+	movq $0, %r14
+	#instruction start "553 = 552 + 550":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "554 = store 553 551, state: 548":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "555 = constant(101)":
+	movl $101, %r12d
+	#instruction start "556 = constant(1)":
+	movq $1, %r14
+	#instruction start "557 = 556 + 550":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "558 = store 557 555, state: 554":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "559 = constant(108)":
+	movl $108, %r12d
+	#instruction start "560 = constant(2)":
+	movq $2, %r14
+	#instruction start "561 = 560 + 550":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "562 = store 561 559, state: 558":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "563 = constant(108)":
+	movl $108, %r12d
+	#instruction start "564 = constant(3)":
+	movq $3, %r14
+	#instruction start "565 = 564 + 550":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "566 = store 565 563, state: 562":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "567 = constant(111)":
+	movl $111, %r12d
+	#instruction start "568 = constant(4)":
+	movq $4, %r14
+	#instruction start "569 = 568 + 550":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "570 = store 569 567, state: 566":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "571 = constant(0)":
+	movl $0, %r12d
+	#instruction start "572 = constant(5)":
+	movq $5, %r14
+	#instruction start "573 = 572 + 550":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "574 = store 573 571, state: 570":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "575 = constant(12)":
+	movq $12, %r12
+	#instruction start "576 = 542 + 575":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "577 = constant(0)":
+	movq $0, %r12
+	#instruction start "578 = 576 + 577":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "579 = constant(7)":
+	movl $7, %r12d
+	#instruction start "580 = store 578 579, state: 574":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "581 = constant(12)":
+	movq $12, %r12
+	#instruction start "582 = 542 + 581":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "583 = constant(0)":
+	movq $0, %rbx
+	#instruction start "584 = 582 + 583":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "585 = load_volatile 584, state: 580":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "586 = proj0 585":
+	#instruction start "587 = proj1 585":
+	#instruction start "588 = constant(7)":
+	movl $7, %r12d
+	#instruction start "589 = 587 == 588":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "591 = if 503 589":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L37
+.L36:
+	#instruction start "594 = constant(11)":
+	movq $.Ls11, %rbx
+	#instruction start "595 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "596 = constant(75)":
+	movl $75, %r13d
+	#instruction start "597 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "598 = alloc with size 8":
+	leaq -2076(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "599 = store 598 594, state: 586":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "600 = alloc with size 8":
+	leaq -2084(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "601 = store 600 595, state: 599":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "602 = alloc with size 4":
+	leaq -2088(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "603 = store 602 596, state: 601":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "604 = alloc with size 8":
+	leaq -2096(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "605 = store 604 597, state: 603":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "606 = constant(0)":
+	leaq -432(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "607 = constant(0)":
+	leaq -440(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "608 = load part address of 598 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "609 = proj0 608":
+	#instruction start "610 = proj1 608":
+	#instruction start "611 = load part address of 600 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "612 = proj0 611":
+	#instruction start "613 = proj1 611":
+	#instruction start "614 = load part address of 602 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "615 = proj0 614":
+	#instruction start "616 = proj1 614":
+	#instruction start "617 = load part address of 604 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "618 = proj0 617":
+	#instruction start "619 = proj1 617":
+	#instruction start "620 = allocate_call_stack 0":
+	#instruction start "621 = set_reg %rdi 610":
+	#instruction start "622 = set_reg %rsi 613 state: 621":
+	#instruction start "623 = set_reg %rdx 616 state: 622":
+	#instruction start "624 = set_reg %rcx 619 state: 623":
+	#instruction start "625 = set_reg %rax 607 state: 624":
+	#instruction start "626 = call 606":
+	addq $0, %rsp
+	movq -440(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -432(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "627 = proj0 626":
+	#instruction start "628 = proj1 626":
+	#Block jump
+	jmp .L38
+.L37:
+	#Block jump elided
+.L38:
+	#instruction start "629 = alloc with size 12":
+	leaq -2108(%rbp), %rsi
+	movq %rsi, -488(%rbp)
+	#instruction start "630 = phi (region: 590) 586 627":
+	#instruction start "631 = set_zero_ptr 629, size: 12":
+	movq -488(%rbp), %rdi
+	movq $0, (%rdi)
+	movl $0, 8(%rdi)
+	#instruction start "632 = constant(0)":
+	movq $0, %r12
+	#instruction start "633 = 629 + 632":
+	movq -488(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "634 = alloc with size 12":
+	leaq -2120(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "635 = set_zero_ptr 634, size: 12":
+	movq %r12, %rdi
+	movq $0, (%rdi)
+	movl $0, 8(%rdi)
+	#instruction start "636 = constant(0)":
+	movq $0, %r14
+	#instruction start "637 = 634 + 636":
+	movq %r12, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "638 = constant(1)":
+	movl $1, %r14d
+	#instruction start "639 = store 637 638, state: 635":
+	movq %r15, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "640 = constant(4)":
+	movq $4, %r14
+	#instruction start "641 = 634 + 640":
+	movq %r12, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "642 = constant(0)":
+	movq $0, %r14
+	#instruction start "643 = 641 + 642":
+	movq %r15, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "644 = constant(2)":
+	movl $2, %r14d
+	#instruction start "645 = store 643 644, state: 639":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "646 = memcpy from 633 to 634":
+	movq %r13, %rsi
+	movq %r12, %rdi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	movl 8(%rdi), %eax
+	movl %eax, 8(%rsi)
+	#instruction start "647 = alloc with size 12":
+	leaq -2132(%rbp), %rsi
+	movq %rsi, -496(%rbp)
+	#instruction start "648 = set_zero_ptr 647, size: 12":
+	movq -496(%rbp), %rdi
+	movq $0, (%rdi)
+	movl $0, 8(%rdi)
+	#instruction start "649 = constant(0)":
+	movq $0, %r12
+	#instruction start "650 = 647 + 649":
+	movq -496(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "651 = constant(0)":
+	movq $0, %r12
+	#instruction start "652 = 650 + 651":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "653 = constant(1)":
+	movl $1, %r12d
+	#instruction start "654 = store 652 653, state: 648":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "655 = constant(4)":
+	movq $4, %r12
+	#instruction start "656 = 650 + 655":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "657 = alloc with size 8":
+	leaq -2140(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "658 = set_zero_ptr 657, size: 8":
+	movq %r12, %rdi
+	movq $0, (%rdi)
+	#instruction start "659 = constant(0)":
+	movq $0, %r13
+	#instruction start "660 = 657 + 659":
+	movq %r12, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "661 = constant(1)":
+	movl $1, %r13d
+	#instruction start "662 = store 660 661, state: 658":
+	movq %r15, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "663 = constant(4)":
+	movq $4, %r13
+	#instruction start "664 = 657 + 663":
+	movq %r12, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "665 = constant(2)":
+	movl $2, %r13d
+	#instruction start "666 = store 664 665, state: 662":
+	movq %r15, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "667 = memcpy from 656 to 657":
+	movq %r14, %rsi
+	movq %r12, %rdi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	#instruction start "668 = alloc with size 12":
+	leaq -2152(%rbp), %rsi
+	movq %rsi, -504(%rbp)
+	#instruction start "669 = set_zero_ptr 668, size: 12":
+	movq -504(%rbp), %rdi
+	movq $0, (%rdi)
+	movl $0, 8(%rdi)
+	#instruction start "670 = constant(0)":
+	movq $0, %r13
+	#instruction start "671 = 668 + 670":
+	movq -504(%rbp), %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "672 = constant(0)":
+	movq $0, %r13
+	#instruction start "673 = 671 + 672":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "674 = constant(1)":
+	movl $1, %r13d
+	#instruction start "675 = store 673 674, state: 669":
+	movq %r15, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "676 = constant(4)":
+	movq $4, %r13
+	#instruction start "677 = 671 + 676":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "678 = constant(0)":
+	movq $0, %r13
+	#instruction start "679 = 677 + 678":
+	movq %r15, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "680 = constant(2)":
+	movl $2, %r13d
+	#instruction start "681 = store 679 680, state: 675":
+	movq %r14, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "682 = constant(4)":
+	movq $4, %r13
+	#instruction start "683 = 677 + 682":
+	movq %r15, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "684 = constant(3)":
+	movl $3, %r13d
+	#instruction start "685 = store 683 684, state: 681":
+	movq %r14, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "686 = constant(0)":
+	movq $0, %r13
+	#instruction start "687 = 629 + 686":
+	movq -488(%rbp), %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "688 = constant(0)":
+	movq $0, %r13
+	#instruction start "689 = 687 + 688":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "690 = load_volatile 689, state: 685":
+	movq %r15, %rdi
+	movl (%rdi), %r13d
+	#instruction start "691 = proj0 690":
+	#instruction start "692 = proj1 690":
+	#instruction start "693 = constant(1)":
+	movl $1, %r14d
+	#instruction start "694 = 692 == 693":
+	movq %r13, %rax
+	movq %r14, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r15d
+	#instruction start "695 = if 590 694":
+	movq %r15, %rdi
+	testq %rdi, %rdi
+	jne .L40
+.L39:
+	#instruction start "720 = alloc with size 4":
+	leaq -2156(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "721 = constant(0)":
+	movl $0, %r14d
+	#instruction start "722 = store 720 721, state: 691":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 724 (723 719 720)
+	movq %r13, %rax
+	movq %rax, %r14
+	#Block jump
+	jmp .L44
+.L40:
+	#instruction start "698 = constant(0)":
+	movq $0, %r13
+	#instruction start "699 = 629 + 698":
+	movq -488(%rbp), %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "700 = constant(4)":
+	movq $4, %r13
+	#instruction start "701 = 699 + 700":
+	movq %r15, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "702 = constant(0)":
+	movq $0, %r13
+	#instruction start "703 = 701 + 702":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "704 = load_volatile 703, state: 691":
+	movq %r15, %rdi
+	movl (%rdi), %ebx
+	#instruction start "705 = proj0 704":
+	#instruction start "706 = proj1 704":
+	#instruction start "707 = constant(2)":
+	movl $2, %r13d
+	#instruction start "708 = 706 == 707":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r15d
+	#instruction start "709 = if 697 708":
+	movq %r15, %rdi
+	testq %rdi, %rdi
+	jne .L42
+.L41:
+	#instruction start "715 = alloc with size 4":
+	leaq -2160(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "716 = constant(0)":
+	movl $0, %r13d
+	#instruction start "717 = store 715 716, state: 705":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 719 (718 712 715)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L43
+.L42:
+	#instruction start "712 = alloc with size 4":
+	leaq -2164(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "713 = constant(1)":
+	movl $1, %r15d
+	#instruction start "714 = store 712 713, state: 705":
+	movq %rbx, %rsi
+	movl %r15d, (%rsi)
+	#Phi node to 719 (718 712 715)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L43:
+	#instruction start "719 = phi (region: 718) 712 715":
+	#instruction start "726 = phi (region: 718) 714 717":
+	#Phi node to 724 (723 719 720)
+	movq %r13, %rax
+	movq %rax, %r14
+	#Block jump elided
+.L44:
+	#instruction start "724 = phi (region: 723) 719 720":
+	#instruction start "725 = phi (region: 723) 726 722":
+	#instruction start "727 = load_volatile 724, state: 725":
+	movq %r14, %rdi
+	movl (%rdi), %ebx
+	#instruction start "728 = proj0 727":
+	#instruction start "729 = proj1 727":
+	#instruction start "731 = if 723 729":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L46
+.L45:
+	#instruction start "734 = constant(12)":
+	movq $.Ls12, %rbx
+	#instruction start "735 = constant(2)":
+	movq $.Ls2, %r13
+	#instruction start "736 = constant(91)":
+	movl $91, %r14d
+	#instruction start "737 = constant(3)":
+	movq $.Ls3, %r15
+	#instruction start "738 = alloc with size 8":
+	leaq -2172(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "739 = store 738 734, state: 728":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "740 = alloc with size 8":
+	leaq -2180(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "741 = store 740 735, state: 739":
+	movq %rbx, %rsi
+	movq %r13, (%rsi)
+	#instruction start "742 = alloc with size 4":
+	leaq -2184(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "743 = store 742 736, state: 741":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "744 = alloc with size 8":
+	leaq -2192(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "745 = store 744 737, state: 743":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "746 = constant(0)":
+	leaq -512(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "747 = constant(0)":
+	leaq -520(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "748 = load part address of 738 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "749 = proj0 748":
+	#instruction start "750 = proj1 748":
+	#instruction start "751 = load part address of 740 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "752 = proj0 751":
+	#instruction start "753 = proj1 751":
+	#instruction start "754 = load part address of 742 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "755 = proj0 754":
+	#instruction start "756 = proj1 754":
+	#instruction start "757 = load part address of 744 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "758 = proj0 757":
+	#instruction start "759 = proj1 757":
+	#instruction start "760 = allocate_call_stack 0":
+	#instruction start "761 = set_reg %rdi 750":
+	#instruction start "762 = set_reg %rsi 753 state: 761":
+	#instruction start "763 = set_reg %rdx 756 state: 762":
+	#instruction start "764 = set_reg %rcx 759 state: 763":
+	#instruction start "765 = set_reg %rax 747 state: 764":
+	#instruction start "766 = call 746":
+	addq $0, %rsp
+	movq -520(%rbp), %rax
+	movq %r13, %rcx
+	movq %rbx, %rdx
+	movq %r12, %rsi
+	movq %r15, %rdi
+	movq -512(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "767 = proj0 766":
+	#instruction start "768 = proj1 766":
+	#Block jump
+	jmp .L47
+.L46:
+	#Block jump elided
+.L47:
+	#instruction start "769 = constant(0)":
+	movq $0, %rbx
+	#instruction start "770 = 668 + 769":
+	movq -504(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "771 = constant(0)":
+	movq $0, %rbx
+	#instruction start "772 = 770 + 771":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "773 = phi (region: 730) 728 767":
+	#instruction start "774 = load_volatile 772, state: 773":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "775 = proj0 774":
+	#instruction start "776 = proj1 774":
+	#instruction start "777 = constant(1)":
+	movl $1, %r12d
+	#instruction start "778 = 776 == 777":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "779 = if 730 778":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L49
+.L48:
+	#instruction start "804 = alloc with size 4":
+	leaq -2196(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "805 = constant(0)":
+	movl $0, %r12d
+	#instruction start "806 = store 804 805, state: 775":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 808 (807 803 804)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L53
+.L49:
+	#instruction start "782 = constant(0)":
+	movq $0, %rbx
+	#instruction start "783 = 668 + 782":
+	movq -504(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "784 = constant(4)":
+	movq $4, %rbx
+	#instruction start "785 = 783 + 784":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "786 = constant(0)":
+	movq $0, %rbx
+	#instruction start "787 = 785 + 786":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "788 = load_volatile 787, state: 775":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "789 = proj0 788":
+	#instruction start "790 = proj1 788":
+	#instruction start "791 = constant(2)":
+	movl $2, %r13d
+	#instruction start "792 = 790 == 791":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "793 = if 781 792":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L51
+.L50:
+	#instruction start "799 = alloc with size 4":
+	leaq -2200(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "800 = constant(0)":
+	movl $0, %r13d
+	#instruction start "801 = store 799 800, state: 789":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 803 (802 796 799)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L52
+.L51:
+	#instruction start "796 = alloc with size 4":
+	leaq -2204(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "797 = constant(1)":
+	movl $1, %r14d
+	#instruction start "798 = store 796 797, state: 789":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 803 (802 796 799)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L52:
+	#instruction start "803 = phi (region: 802) 796 799":
+	#instruction start "810 = phi (region: 802) 798 801":
+	#Phi node to 808 (807 803 804)
+	movq %r13, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L53:
+	#instruction start "808 = phi (region: 807) 803 804":
+	#instruction start "809 = phi (region: 807) 810 806":
+	#instruction start "811 = load_volatile 808, state: 809":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "812 = proj0 811":
+	#instruction start "813 = proj1 811":
+	#instruction start "814 = if 807 813":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L55
+.L54:
+	#instruction start "839 = alloc with size 4":
+	leaq -2208(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "840 = constant(0)":
+	movl $0, %r12d
+	#instruction start "841 = store 839 840, state: 812":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 843 (842 838 839)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L59
+.L55:
+	#instruction start "817 = constant(0)":
+	movq $0, %rbx
+	#instruction start "818 = 668 + 817":
+	movq -504(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "819 = constant(4)":
+	movq $4, %rbx
+	#instruction start "820 = 818 + 819":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "821 = constant(4)":
+	movq $4, %rbx
+	#instruction start "822 = 820 + 821":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "823 = load_volatile 822, state: 812":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "824 = proj0 823":
+	#instruction start "825 = proj1 823":
+	#instruction start "826 = constant(3)":
+	movl $3, %r13d
+	#instruction start "827 = 825 == 826":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "828 = if 816 827":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L57
+.L56:
+	#instruction start "834 = alloc with size 4":
+	leaq -2212(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "835 = constant(0)":
+	movl $0, %r13d
+	#instruction start "836 = store 834 835, state: 824":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 838 (837 831 834)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L58
+.L57:
+	#instruction start "831 = alloc with size 4":
+	leaq -2216(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "832 = constant(1)":
+	movl $1, %r14d
+	#instruction start "833 = store 831 832, state: 824":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 838 (837 831 834)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L58:
+	#instruction start "838 = phi (region: 837) 831 834":
+	#instruction start "845 = phi (region: 837) 833 836":
+	#Phi node to 843 (842 838 839)
+	movq %r13, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L59:
+	#instruction start "843 = phi (region: 842) 838 839":
+	#instruction start "844 = phi (region: 842) 845 841":
+	#instruction start "846 = load_volatile 843, state: 844":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "847 = proj0 846":
+	#instruction start "848 = proj1 846":
+	#instruction start "850 = if 842 848":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L61
+.L60:
+	#instruction start "853 = constant(13)":
+	movq $.Ls13, %rbx
+	#instruction start "854 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "855 = constant(92)":
+	movl $92, %r13d
+	#instruction start "856 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "857 = alloc with size 8":
+	leaq -2224(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "858 = store 857 853, state: 847":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "859 = alloc with size 8":
+	leaq -2232(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "860 = store 859 854, state: 858":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "861 = alloc with size 4":
+	leaq -2236(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "862 = store 861 855, state: 860":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "863 = alloc with size 8":
+	leaq -2244(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "864 = store 863 856, state: 862":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "865 = constant(0)":
+	leaq -568(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "866 = constant(0)":
+	leaq -576(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "867 = load part address of 857 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "868 = proj0 867":
+	#instruction start "869 = proj1 867":
+	#instruction start "870 = load part address of 859 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "871 = proj0 870":
+	#instruction start "872 = proj1 870":
+	#instruction start "873 = load part address of 861 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "874 = proj0 873":
+	#instruction start "875 = proj1 873":
+	#instruction start "876 = load part address of 863 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "877 = proj0 876":
+	#instruction start "878 = proj1 876":
+	#instruction start "879 = allocate_call_stack 0":
+	#instruction start "880 = set_reg %rdi 869":
+	#instruction start "881 = set_reg %rsi 872 state: 880":
+	#instruction start "882 = set_reg %rdx 875 state: 881":
+	#instruction start "883 = set_reg %rcx 878 state: 882":
+	#instruction start "884 = set_reg %rax 866 state: 883":
+	#instruction start "885 = call 865":
+	addq $0, %rsp
+	movq -576(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -568(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "886 = proj0 885":
+	#instruction start "887 = proj1 885":
+	#Block jump
+	jmp .L62
+.L61:
+	#Block jump elided
+.L62:
+	#instruction start "888 = constant(0)":
+	movq $0, %rbx
+	#instruction start "889 = 647 + 888":
+	movq -496(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "890 = constant(0)":
+	movq $0, %rbx
+	#instruction start "891 = 889 + 890":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "892 = phi (region: 849) 847 886":
+	#instruction start "893 = load_volatile 891, state: 892":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "894 = proj0 893":
+	#instruction start "895 = proj1 893":
+	#instruction start "896 = constant(1)":
+	movl $1, %r12d
+	#instruction start "897 = 895 == 896":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "899 = if 849 897":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L64
+.L63:
+	#instruction start "902 = constant(14)":
+	movq $.Ls14, %rbx
+	#instruction start "903 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "904 = constant(93)":
+	movl $93, %r13d
+	#instruction start "905 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "906 = alloc with size 8":
+	leaq -2252(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "907 = store 906 902, state: 894":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "908 = alloc with size 8":
+	leaq -2260(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "909 = store 908 903, state: 907":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "910 = alloc with size 4":
+	leaq -2264(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "911 = store 910 904, state: 909":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "912 = alloc with size 8":
+	leaq -2272(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "913 = store 912 905, state: 911":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "914 = constant(0)":
+	leaq -624(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "915 = constant(0)":
+	leaq -632(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "916 = load part address of 906 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "917 = proj0 916":
+	#instruction start "918 = proj1 916":
+	#instruction start "919 = load part address of 908 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "920 = proj0 919":
+	#instruction start "921 = proj1 919":
+	#instruction start "922 = load part address of 910 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "923 = proj0 922":
+	#instruction start "924 = proj1 922":
+	#instruction start "925 = load part address of 912 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "926 = proj0 925":
+	#instruction start "927 = proj1 925":
+	#instruction start "928 = allocate_call_stack 0":
+	#instruction start "929 = set_reg %rdi 918":
+	#instruction start "930 = set_reg %rsi 921 state: 929":
+	#instruction start "931 = set_reg %rdx 924 state: 930":
+	#instruction start "932 = set_reg %rcx 927 state: 931":
+	#instruction start "933 = set_reg %rax 915 state: 932":
+	#instruction start "934 = call 914":
+	addq $0, %rsp
+	movq -632(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -624(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "935 = proj0 934":
+	#instruction start "936 = proj1 934":
+	#Block jump
+	jmp .L65
+.L64:
+	#Block jump elided
+.L65:
+	#instruction start "937 = alloc with size 16":
+	leaq -2288(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "938 = phi (region: 898) 894 935":
+	#instruction start "939 = set_zero_ptr 937, size: 16":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	#instruction start "940 = constant(0)":
+	movq $0, %r12
+	#instruction start "941 = 937 + 940":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "942 = constant(0)":
+	movq $0, %r12
+	#instruction start "943 = 941 + 942":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "944 = constant(1)":
+	movl $1, %r12d
+	#instruction start "945 = store 943 944, state: 939":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "946 = constant(4)":
+	movq $4, %r12
+	#instruction start "947 = 941 + 946":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "948 = constant(2)":
+	movl $2, %r12d
+	#instruction start "949 = store 947 948, state: 945":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "950 = constant(8)":
+	movq $8, %r12
+	#instruction start "951 = 941 + 950":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "952 = constant(3)":
+	movl $3, %r12d
+	#instruction start "953 = store 951 952, state: 949":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "954 = constant(12)":
+	movq $12, %r12
+	#instruction start "955 = 941 + 954":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "956 = constant(4)":
+	movl $4, %r12d
+	#instruction start "957 = store 955 956, state: 953":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "958 = constant(0)":
+	movq $0, %r12
+	#instruction start "959 = 937 + 958":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "960 = constant(3)":
+	movl $3, %ebx
+	#instruction start "961 = int_cast_zero 960":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "962 = constant(4)":
+	movq $4, %rbx
+	#instruction start "963 = 961 * 962":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "964 = 959 + 963":
+	movq %r13, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "965 = load_volatile 964, state: 957":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "966 = proj0 965":
+	#instruction start "967 = proj1 965":
+	#instruction start "968 = constant(4)":
+	movl $4, %ebx
+	#instruction start "969 = 967 == 968":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "971 = if 898 969":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L67
+.L66:
+	#instruction start "974 = constant(15)":
+	movq $.Ls15, %rbx
+	#instruction start "975 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "976 = constant(100)":
+	movl $100, %r13d
+	#instruction start "977 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "978 = alloc with size 8":
+	leaq -2296(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "979 = store 978 974, state: 966":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "980 = alloc with size 8":
+	leaq -2304(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "981 = store 980 975, state: 979":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "982 = alloc with size 4":
+	leaq -2308(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "983 = store 982 976, state: 981":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "984 = alloc with size 8":
+	leaq -2316(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "985 = store 984 977, state: 983":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "986 = constant(0)":
+	leaq -680(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "987 = constant(0)":
+	leaq -688(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "988 = load part address of 978 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "989 = proj0 988":
+	#instruction start "990 = proj1 988":
+	#instruction start "991 = load part address of 980 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "992 = proj0 991":
+	#instruction start "993 = proj1 991":
+	#instruction start "994 = load part address of 982 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "995 = proj0 994":
+	#instruction start "996 = proj1 994":
+	#instruction start "997 = load part address of 984 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "998 = proj0 997":
+	#instruction start "999 = proj1 997":
+	#instruction start "1000 = allocate_call_stack 0":
+	#instruction start "1001 = set_reg %rdi 990":
+	#instruction start "1002 = set_reg %rsi 993 state: 1001":
+	#instruction start "1003 = set_reg %rdx 996 state: 1002":
+	#instruction start "1004 = set_reg %rcx 999 state: 1003":
+	#instruction start "1005 = set_reg %rax 987 state: 1004":
+	#instruction start "1006 = call 986":
+	addq $0, %rsp
+	movq -688(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -680(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1007 = proj0 1006":
+	#instruction start "1008 = proj1 1006":
+	#Block jump
+	jmp .L68
+.L67:
+	#Block jump elided
+.L68:
+	#instruction start "1009 = alloc with size 12":
+	leaq -2328(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1010 = phi (region: 970) 966 1007":
+	#instruction start "1011 = set_zero_ptr 1009, size: 12":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movl $0, 8(%rdi)
+	#instruction start "1012 = constant(0)":
+	movq $0, %r12
+	#instruction start "1013 = 1009 + 1012":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1014 = constant(0)":
+	movq $0, %r12
+	#instruction start "1015 = 1013 + 1014":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1016 = constant(2)":
+	movl $2, %r12d
+	#instruction start "1017 = store 1015 1016, state: 1011":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "1018 = constant(4)":
+	movq $4, %r12
+	#instruction start "1019 = 1013 + 1018":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1020 = constant(4)":
+	movl $4, %r12d
+	#instruction start "1021 = store 1019 1020, state: 1017":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "1022 = constant(0)":
+	movq $0, %r12
+	#instruction start "1023 = 1009 + 1022":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1024 = constant(0)":
+	movq $0, %r12
+	#instruction start "1025 = 1023 + 1024":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1026 = load_volatile 1025, state: 1021":
+	movq %r14, %rdi
+	movl (%rdi), %r12d
+	#instruction start "1027 = proj0 1026":
+	#instruction start "1028 = proj1 1026":
+	#instruction start "1029 = constant(2)":
+	movl $2, %r13d
+	#instruction start "1030 = 1028 == 1029":
+	movq %r12, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "1031 = if 970 1030":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L70
+.L69:
+	#instruction start "1054 = alloc with size 4":
+	leaq -2332(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1055 = constant(0)":
+	movl $0, %r13d
+	#instruction start "1056 = store 1054 1055, state: 1027":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 1058 (1057 1053 1054)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L74
+.L70:
+	#instruction start "1034 = constant(0)":
+	movq $0, %r12
+	#instruction start "1035 = 1009 + 1034":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1036 = constant(4)":
+	movq $4, %r12
+	#instruction start "1037 = 1035 + 1036":
+	movq %r14, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "1038 = load_volatile 1037, state: 1027":
+	movq %r15, %rdi
+	movl (%rdi), %r12d
+	#instruction start "1039 = proj0 1038":
+	#instruction start "1040 = proj1 1038":
+	#instruction start "1041 = constant(4)":
+	movl $4, %r14d
+	#instruction start "1042 = 1040 == 1041":
+	movq %r12, %rax
+	movq %r14, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r15d
+	#instruction start "1043 = if 1033 1042":
+	movq %r15, %rdi
+	testq %rdi, %rdi
+	jne .L72
+.L71:
+	#instruction start "1049 = alloc with size 4":
+	leaq -2336(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1050 = constant(0)":
+	movl $0, %r14d
+	#instruction start "1051 = store 1049 1050, state: 1039":
+	movq %r12, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 1053 (1052 1046 1049)
+	movq %r12, %rax
+	movq %rax, %r14
+	#Block jump
+	jmp .L73
+.L72:
+	#instruction start "1046 = alloc with size 4":
+	leaq -2340(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1047 = constant(1)":
+	movl $1, %r15d
+	#instruction start "1048 = store 1046 1047, state: 1039":
+	movq %r12, %rsi
+	movl %r15d, (%rsi)
+	#Phi node to 1053 (1052 1046 1049)
+	movq %r12, %rax
+	movq %rax, %r14
+	#Block jump elided
+.L73:
+	#instruction start "1053 = phi (region: 1052) 1046 1049":
+	#instruction start "1060 = phi (region: 1052) 1048 1051":
+	#Phi node to 1058 (1057 1053 1054)
+	movq %r14, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L74:
+	#instruction start "1058 = phi (region: 1057) 1053 1054":
+	#instruction start "1059 = phi (region: 1057) 1060 1056":
+	#instruction start "1061 = load_volatile 1058, state: 1059":
+	movq %r13, %rdi
+	movl (%rdi), %r12d
+	#instruction start "1062 = proj0 1061":
+	#instruction start "1063 = proj1 1061":
+	#instruction start "1064 = if 1057 1063":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L76
+.L75:
+	#instruction start "1085 = alloc with size 4":
+	leaq -2344(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1086 = constant(0)":
+	movl $0, %r13d
+	#instruction start "1087 = store 1085 1086, state: 1062":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 1089 (1088 1084 1085)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L80
+.L76:
+	#instruction start "1067 = constant(8)":
+	movq $8, %r12
+	#instruction start "1068 = 1009 + 1067":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1069 = load_volatile 1068, state: 1062":
+	movq %r14, %rdi
+	movl (%rdi), %ebx
+	#instruction start "1070 = proj0 1069":
+	#instruction start "1071 = proj1 1069":
+	#instruction start "1072 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1073 = 1071 == 1072":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "1074 = if 1066 1073":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L78
+.L77:
+	#instruction start "1080 = alloc with size 4":
+	leaq -2348(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1081 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1082 = store 1080 1081, state: 1070":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 1084 (1083 1077 1080)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L79
+.L78:
+	#instruction start "1077 = alloc with size 4":
+	leaq -2352(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1078 = constant(1)":
+	movl $1, %r14d
+	#instruction start "1079 = store 1077 1078, state: 1070":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 1084 (1083 1077 1080)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L79:
+	#instruction start "1084 = phi (region: 1083) 1077 1080":
+	#instruction start "1091 = phi (region: 1083) 1079 1082":
+	#Phi node to 1089 (1088 1084 1085)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L80:
+	#instruction start "1089 = phi (region: 1088) 1084 1085":
+	#instruction start "1090 = phi (region: 1088) 1091 1087":
+	#instruction start "1092 = load_volatile 1089, state: 1090":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "1093 = proj0 1092":
+	#instruction start "1094 = proj1 1092":
+	#instruction start "1096 = if 1088 1094":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L82
+.L81:
+	#instruction start "1099 = constant(16)":
+	movq $.Ls16, %rbx
+	#instruction start "1100 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "1101 = constant(111)":
+	movl $111, %r13d
+	#instruction start "1102 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "1103 = alloc with size 8":
+	leaq -2360(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1104 = store 1103 1099, state: 1093":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1105 = alloc with size 8":
+	leaq -2368(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1106 = store 1105 1100, state: 1104":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1107 = alloc with size 4":
+	leaq -2372(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1108 = store 1107 1101, state: 1106":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1109 = alloc with size 8":
+	leaq -2380(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1110 = store 1109 1102, state: 1108":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1111 = constant(0)":
+	leaq -736(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1112 = constant(0)":
+	leaq -744(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1113 = load part address of 1103 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1114 = proj0 1113":
+	#instruction start "1115 = proj1 1113":
+	#instruction start "1116 = load part address of 1105 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1117 = proj0 1116":
+	#instruction start "1118 = proj1 1116":
+	#instruction start "1119 = load part address of 1107 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1120 = proj0 1119":
+	#instruction start "1121 = proj1 1119":
+	#instruction start "1122 = load part address of 1109 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1123 = proj0 1122":
+	#instruction start "1124 = proj1 1122":
+	#instruction start "1125 = allocate_call_stack 0":
+	#instruction start "1126 = set_reg %rdi 1115":
+	#instruction start "1127 = set_reg %rsi 1118 state: 1126":
+	#instruction start "1128 = set_reg %rdx 1121 state: 1127":
+	#instruction start "1129 = set_reg %rcx 1124 state: 1128":
+	#instruction start "1130 = set_reg %rax 1112 state: 1129":
+	#instruction start "1131 = call 1111":
+	addq $0, %rsp
+	movq -744(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -736(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1132 = proj0 1131":
+	#instruction start "1133 = proj1 1131":
+	#Block jump
+	jmp .L83
+.L82:
+	#Block jump elided
+.L83:
+	#instruction start "1134 = alloc with size 3":
+	leaq -2383(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1135 = phi (region: 1095) 1093 1132":
+	#instruction start "1136 = set_zero_ptr 1134, size: 3":
+	movq %rbx, %rdi
+	movw $0, (%rdi)
+	movb $0, 2(%rdi)
+	#instruction start "1137 = constant(0)":
+	movq $0, %r12
+	#instruction start "1138 = 1134 + 1137":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1139 = constant(17)":
+	movq $.Ls17, %r12
+	#instruction start "1140 = memcpy from 1138 to 1139":
+	movq %r13, %rsi
+	movq %r12, %rdi
+	movb (%rdi), %al
+	movb %al, (%rsi)
+	#instruction start "1141 = constant(1)":
+	movq $1, %r12
+	#instruction start "1142 = 1134 + 1141":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1143 = constant(98)":
+	movl $98, %r12d
+	#instruction start "1144 = store 1142 1143, state: 1140":
+	movq %r13, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1145 = constant(2)":
+	movq $2, %r12
+	#instruction start "1146 = 1134 + 1145":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1147 = constant(99)":
+	movl $99, %ebx
+	#instruction start "1148 = store 1146 1147, state: 1144":
+	movq %r13, %rsi
+	movb %bl, (%rsi)
+	#instruction start "1149 = alloc with size 32":
+	leaq -2415(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1150 = set_zero_ptr 1149, size: 32":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	movq $0, 16(%rdi)
+	movq $0, 24(%rdi)
+	#instruction start "1151 = constant(0)":
+	movq $0, %r12
+	#instruction start "1152 = 1149 + 1151":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1153 = constant(0)":
+	movq $0, %r12
+	#instruction start "1154 = 1152 + 1153":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1155 = constant(18)":
+	movq $.Ls18, %r12
+	#instruction start "1156 = store 1154 1155, state: 1150":
+	movq %r14, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1157 = constant(16)":
+	movq $16, %r12
+	#instruction start "1158 = 1149 + 1157":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1161 = constant(8)":
+	movq $8, %r12
+	#instruction start "1162 = 1158 + 1161":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1163 = constant(19)":
+	movq $.Ls19, %r12
+	#instruction start "1164 = store 1162 1163, state: 1156":
+	movq %r14, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1165 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1166 = int_cast_zero 1165":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "1167 = constant(16)":
+	movq $16, %r12
+	#instruction start "1168 = 1166 * 1167":
+	movq %r13, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1169 = 1149 + 1168":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "1170 = constant(0)":
+	movl $0, %ebx
+	#instruction start "1171 = int_cast_zero 1170":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "1172 = constant(8)":
+	movq $8, %rbx
+	#instruction start "1173 = 1171 * 1172":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1174 = 1169 + 1173":
+	movq %r12, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "1175 = constant(18)":
+	movq $.Ls18, %r12
+	#instruction start "1176 = alloc with size 8":
+	leaq -2423(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1177 = store 1176 1175, state: 1164":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1178 = constant(7)":
+	movq $strcmp, %r12
+	#instruction start "1179 = constant(0)":
+	movq $0, %r14
+	#instruction start "1180 = load part address of 1174 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1181 = proj0 1180":
+	#instruction start "1182 = proj1 1180":
+	#instruction start "1183 = load part address of 1176 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "1184 = proj0 1183":
+	#instruction start "1185 = proj1 1183":
+	#instruction start "1186 = allocate_call_stack 0":
+	#instruction start "1187 = set_reg %rdi 1182":
+	#instruction start "1188 = set_reg %rsi 1185 state: 1187":
+	#instruction start "1189 = set_reg %rax 1179 state: 1188":
+	#instruction start "1190 = call 1178":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "1191 = proj0 1190":
+	#instruction start "1192 = proj1 1190":
+	#instruction start "1193 = %rax":
+	#instruction start "1194 = int_cast_zero 1193":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "1195 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1196 = 1194 == 1195":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "1198 = if 1095 1196":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L85
+.L84:
+	#instruction start "1201 = constant(20)":
+	movq $.Ls20, %rbx
+	#instruction start "1202 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "1203 = constant(121)":
+	movl $121, %r13d
+	#instruction start "1204 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "1205 = alloc with size 8":
+	leaq -2431(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1206 = store 1205 1201, state: 1191":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1207 = alloc with size 8":
+	leaq -2439(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1208 = store 1207 1202, state: 1206":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1209 = alloc with size 4":
+	leaq -2443(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1210 = store 1209 1203, state: 1208":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1211 = alloc with size 8":
+	leaq -2451(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1212 = store 1211 1204, state: 1210":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1213 = constant(0)":
+	leaq -816(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1214 = constant(0)":
+	leaq -824(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1215 = load part address of 1205 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1216 = proj0 1215":
+	#instruction start "1217 = proj1 1215":
+	#instruction start "1218 = load part address of 1207 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1219 = proj0 1218":
+	#instruction start "1220 = proj1 1218":
+	#instruction start "1221 = load part address of 1209 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1222 = proj0 1221":
+	#instruction start "1223 = proj1 1221":
+	#instruction start "1224 = load part address of 1211 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1225 = proj0 1224":
+	#instruction start "1226 = proj1 1224":
+	#instruction start "1227 = allocate_call_stack 0":
+	#instruction start "1228 = set_reg %rdi 1217":
+	#instruction start "1229 = set_reg %rsi 1220 state: 1228":
+	#instruction start "1230 = set_reg %rdx 1223 state: 1229":
+	#instruction start "1231 = set_reg %rcx 1226 state: 1230":
+	#instruction start "1232 = set_reg %rax 1214 state: 1231":
+	#instruction start "1233 = call 1213":
+	addq $0, %rsp
+	movq -824(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -816(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1234 = proj0 1233":
+	#instruction start "1235 = proj1 1233":
+	#Block jump
+	jmp .L86
+.L85:
+	#Block jump elided
+.L86:
+	#instruction start "1236 = alloc with size 16":
+	leaq -2467(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1237 = phi (region: 1197) 1191 1234":
+	#instruction start "1238 = set_zero_ptr 1236, size: 16":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	#instruction start "1239 = constant(0)":
+	movq $0, %r12
+	#instruction start "1240 = 1236 + 1239":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1241 = constant(1)":
+	movl $1, %r12d
+	#instruction start "1242 = store 1240 1241, state: 1238":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "1243 = constant(4)":
+	movq $4, %r12
+	#instruction start "1244 = 1236 + 1243":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1245 = constant(0)":
+	movq $0, %r12
+	#instruction start "1246 = 1244 + 1245":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1247 = constant(2)":
+	movl $2, %r12d
+	#instruction start "1248 = store 1246 1247, state: 1242":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "1249 = constant(8)":
+	movq $8, %r12
+	#instruction start "1250 = 1236 + 1249":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1251 = constant(0)":
+	movq $0, %r12
+	#instruction start "1252 = 1250 + 1251":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1253 = constant(3)":
+	movl $3, %r12d
+	#instruction start "1254 = store 1252 1253, state: 1248":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "1255 = constant(4)":
+	movq $4, %r12
+	#instruction start "1256 = 1250 + 1255":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1257 = constant(4)":
+	movl $4, %r12d
+	#instruction start "1258 = store 1256 1257, state: 1254":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "1259 = constant(8)":
+	movq $8, %r12
+	#instruction start "1260 = 1236 + 1259":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1261 = constant(0)":
+	movq $0, %r12
+	#instruction start "1262 = 1260 + 1261":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1263 = load_volatile 1262, state: 1258":
+	movq %r14, %rdi
+	movl (%rdi), %r12d
+	#instruction start "1264 = proj0 1263":
+	#instruction start "1265 = proj1 1263":
+	#instruction start "1266 = constant(3)":
+	movl $3, %r13d
+	#instruction start "1267 = 1265 == 1266":
+	movq %r12, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "1268 = if 1197 1267":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L88
+.L87:
+	#instruction start "1289 = alloc with size 4":
+	leaq -2471(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1290 = constant(0)":
+	movl $0, %r13d
+	#instruction start "1291 = store 1289 1290, state: 1264":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 1293 (1292 1288 1289)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L92
+.L88:
+	#instruction start "1271 = constant(0)":
+	movq $0, %r12
+	#instruction start "1272 = 1236 + 1271":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1273 = load_volatile 1272, state: 1264":
+	movq %r14, %rdi
+	movl (%rdi), %r12d
+	#instruction start "1274 = proj0 1273":
+	#instruction start "1275 = proj1 1273":
+	#instruction start "1276 = constant(1)":
+	movl $1, %r14d
+	#instruction start "1277 = 1275 == 1276":
+	movq %r12, %rax
+	movq %r14, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r15d
+	#instruction start "1278 = if 1270 1277":
+	movq %r15, %rdi
+	testq %rdi, %rdi
+	jne .L90
+.L89:
+	#instruction start "1284 = alloc with size 4":
+	leaq -2475(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1285 = constant(0)":
+	movl $0, %r14d
+	#instruction start "1286 = store 1284 1285, state: 1274":
+	movq %r12, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 1288 (1287 1281 1284)
+	movq %r12, %rax
+	movq %rax, %r14
+	#Block jump
+	jmp .L91
+.L90:
+	#instruction start "1281 = alloc with size 4":
+	leaq -2479(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1282 = constant(1)":
+	movl $1, %r15d
+	#instruction start "1283 = store 1281 1282, state: 1274":
+	movq %r12, %rsi
+	movl %r15d, (%rsi)
+	#Phi node to 1288 (1287 1281 1284)
+	movq %r12, %rax
+	movq %rax, %r14
+	#Block jump elided
+.L91:
+	#instruction start "1288 = phi (region: 1287) 1281 1284":
+	#instruction start "1295 = phi (region: 1287) 1283 1286":
+	#Phi node to 1293 (1292 1288 1289)
+	movq %r14, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L92:
+	#instruction start "1293 = phi (region: 1292) 1288 1289":
+	#instruction start "1294 = phi (region: 1292) 1295 1291":
+	#instruction start "1296 = load_volatile 1293, state: 1294":
+	movq %r13, %rdi
+	movl (%rdi), %r12d
+	#instruction start "1297 = proj0 1296":
+	#instruction start "1298 = proj1 1296":
+	#instruction start "1299 = if 1292 1298":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L94
+.L93:
+	#instruction start "1322 = alloc with size 4":
+	leaq -2483(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1323 = constant(0)":
+	movl $0, %r13d
+	#instruction start "1324 = store 1322 1323, state: 1297":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 1326 (1325 1321 1322)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L98
+.L94:
+	#instruction start "1302 = constant(4)":
+	movq $4, %r12
+	#instruction start "1303 = 1236 + 1302":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1304 = constant(0)":
+	movq $0, %rbx
+	#instruction start "1305 = 1303 + 1304":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "1306 = load_volatile 1305, state: 1297":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "1307 = proj0 1306":
+	#instruction start "1308 = proj1 1306":
+	#instruction start "1309 = constant(2)":
+	movl $2, %r12d
+	#instruction start "1310 = 1308 == 1309":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "1311 = if 1301 1310":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L96
+.L95:
+	#instruction start "1317 = alloc with size 4":
+	leaq -2487(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1318 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1319 = store 1317 1318, state: 1307":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 1321 (1320 1314 1317)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L97
+.L96:
+	#instruction start "1314 = alloc with size 4":
+	leaq -2491(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1315 = constant(1)":
+	movl $1, %r14d
+	#instruction start "1316 = store 1314 1315, state: 1307":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 1321 (1320 1314 1317)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L97:
+	#instruction start "1321 = phi (region: 1320) 1314 1317":
+	#instruction start "1328 = phi (region: 1320) 1316 1319":
+	#Phi node to 1326 (1325 1321 1322)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L98:
+	#instruction start "1326 = phi (region: 1325) 1321 1322":
+	#instruction start "1327 = phi (region: 1325) 1328 1324":
+	#instruction start "1329 = load_volatile 1326, state: 1327":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "1330 = proj0 1329":
+	#instruction start "1331 = proj1 1329":
+	#instruction start "1333 = if 1325 1331":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L100
+.L99:
+	#instruction start "1336 = constant(21)":
+	movq $.Ls21, %rbx
+	#instruction start "1337 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "1338 = constant(135)":
+	movl $135, %r13d
+	#instruction start "1339 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "1340 = alloc with size 8":
+	leaq -2499(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1341 = store 1340 1336, state: 1330":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1342 = alloc with size 8":
+	leaq -2507(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1343 = store 1342 1337, state: 1341":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1344 = alloc with size 4":
+	leaq -2511(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1345 = store 1344 1338, state: 1343":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1346 = alloc with size 8":
+	leaq -2519(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1347 = store 1346 1339, state: 1345":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1348 = constant(0)":
+	leaq -872(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1349 = constant(0)":
+	leaq -880(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1350 = load part address of 1340 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1351 = proj0 1350":
+	#instruction start "1352 = proj1 1350":
+	#instruction start "1353 = load part address of 1342 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1354 = proj0 1353":
+	#instruction start "1355 = proj1 1353":
+	#instruction start "1356 = load part address of 1344 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1357 = proj0 1356":
+	#instruction start "1358 = proj1 1356":
+	#instruction start "1359 = load part address of 1346 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1360 = proj0 1359":
+	#instruction start "1361 = proj1 1359":
+	#instruction start "1362 = allocate_call_stack 0":
+	#instruction start "1363 = set_reg %rdi 1352":
+	#instruction start "1364 = set_reg %rsi 1355 state: 1363":
+	#instruction start "1365 = set_reg %rdx 1358 state: 1364":
+	#instruction start "1366 = set_reg %rcx 1361 state: 1365":
+	#instruction start "1367 = set_reg %rax 1349 state: 1366":
+	#instruction start "1368 = call 1348":
+	addq $0, %rsp
+	movq -880(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -872(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1369 = proj0 1368":
+	#instruction start "1370 = proj1 1368":
+	#Block jump
+	jmp .L101
+.L100:
+	#Block jump elided
+.L101:
+	#instruction start "1371 = alloc with size 12":
+	leaq -2531(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1372 = phi (region: 1332) 1330 1369":
+	#instruction start "1373 = set_zero_ptr 1371, size: 12":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movl $0, 8(%rdi)
+	#instruction start "1374 = constant(0)":
+	movq $0, %r12
+	#instruction start "1375 = 1371 + 1374":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1376 = constant(2)":
+	movl $2, %r12d
+	#instruction start "1377 = store 1375 1376, state: 1373":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "1378 = constant(4)":
+	movq $4, %r12
+	#instruction start "1379 = 1371 + 1378":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1380 = constant(5)":
+	movl $5, %r12d
+	#instruction start "1381 = store 1379 1380, state: 1377":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "1382 = constant(8)":
+	movq $8, %r12
+	#instruction start "1383 = 1371 + 1382":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1384 = constant(3)":
+	movl $3, %r12d
+	#instruction start "1385 = store 1383 1384, state: 1381":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "1386 = constant(8)":
+	movq $8, %r12
+	#instruction start "1387 = 1371 + 1386":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1388 = load_volatile 1387, state: 1385":
+	movq %r13, %rdi
+	movl (%rdi), %r12d
+	#instruction start "1389 = proj0 1388":
+	#instruction start "1390 = proj1 1388":
+	#instruction start "1391 = constant(3)":
+	movl $3, %r13d
+	#instruction start "1392 = 1390 == 1391":
+	movq %r12, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "1393 = if 1332 1392":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L103
+.L102:
+	#instruction start "1414 = alloc with size 4":
+	leaq -2535(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1415 = constant(0)":
+	movl $0, %r13d
+	#instruction start "1416 = store 1414 1415, state: 1389":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 1418 (1417 1413 1414)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L107
+.L103:
+	#instruction start "1396 = constant(0)":
+	movq $0, %r12
+	#instruction start "1397 = 1371 + 1396":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1398 = load_volatile 1397, state: 1389":
+	movq %r14, %rdi
+	movl (%rdi), %r12d
+	#instruction start "1399 = proj0 1398":
+	#instruction start "1400 = proj1 1398":
+	#instruction start "1401 = constant(2)":
+	movl $2, %r14d
+	#instruction start "1402 = 1400 == 1401":
+	movq %r12, %rax
+	movq %r14, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r15d
+	#instruction start "1403 = if 1395 1402":
+	movq %r15, %rdi
+	testq %rdi, %rdi
+	jne .L105
+.L104:
+	#instruction start "1409 = alloc with size 4":
+	leaq -2539(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1410 = constant(0)":
+	movl $0, %r14d
+	#instruction start "1411 = store 1409 1410, state: 1399":
+	movq %r12, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 1413 (1412 1406 1409)
+	movq %r12, %rax
+	movq %rax, %r14
+	#Block jump
+	jmp .L106
+.L105:
+	#instruction start "1406 = alloc with size 4":
+	leaq -2543(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1407 = constant(1)":
+	movl $1, %r15d
+	#instruction start "1408 = store 1406 1407, state: 1399":
+	movq %r12, %rsi
+	movl %r15d, (%rsi)
+	#Phi node to 1413 (1412 1406 1409)
+	movq %r12, %rax
+	movq %rax, %r14
+	#Block jump elided
+.L106:
+	#instruction start "1413 = phi (region: 1412) 1406 1409":
+	#instruction start "1420 = phi (region: 1412) 1408 1411":
+	#Phi node to 1418 (1417 1413 1414)
+	movq %r14, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L107:
+	#instruction start "1418 = phi (region: 1417) 1413 1414":
+	#instruction start "1419 = phi (region: 1417) 1420 1416":
+	#instruction start "1421 = load_volatile 1418, state: 1419":
+	movq %r13, %rdi
+	movl (%rdi), %r12d
+	#instruction start "1422 = proj0 1421":
+	#instruction start "1423 = proj1 1421":
+	#instruction start "1424 = if 1417 1423":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L109
+.L108:
+	#instruction start "1445 = alloc with size 4":
+	leaq -2547(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1446 = constant(0)":
+	movl $0, %r13d
+	#instruction start "1447 = store 1445 1446, state: 1422":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 1449 (1448 1444 1445)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L113
+.L109:
+	#instruction start "1427 = constant(4)":
+	movq $4, %r12
+	#instruction start "1428 = 1371 + 1427":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1429 = load_volatile 1428, state: 1422":
+	movq %r14, %rdi
+	movl (%rdi), %ebx
+	#instruction start "1430 = proj0 1429":
+	#instruction start "1431 = proj1 1429":
+	#instruction start "1432 = constant(5)":
+	movl $5, %r12d
+	#instruction start "1433 = 1431 == 1432":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "1434 = if 1426 1433":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L111
+.L110:
+	#instruction start "1440 = alloc with size 4":
+	leaq -2551(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1441 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1442 = store 1440 1441, state: 1430":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 1444 (1443 1437 1440)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L112
+.L111:
+	#instruction start "1437 = alloc with size 4":
+	leaq -2555(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1438 = constant(1)":
+	movl $1, %r14d
+	#instruction start "1439 = store 1437 1438, state: 1430":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 1444 (1443 1437 1440)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L112:
+	#instruction start "1444 = phi (region: 1443) 1437 1440":
+	#instruction start "1451 = phi (region: 1443) 1439 1442":
+	#Phi node to 1449 (1448 1444 1445)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L113:
+	#instruction start "1449 = phi (region: 1448) 1444 1445":
+	#instruction start "1450 = phi (region: 1448) 1451 1447":
+	#instruction start "1452 = load_volatile 1449, state: 1450":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "1453 = proj0 1452":
+	#instruction start "1454 = proj1 1452":
+	#instruction start "1456 = if 1448 1454":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L115
+.L114:
+	#instruction start "1459 = constant(22)":
+	movq $.Ls22, %rbx
+	#instruction start "1460 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "1461 = constant(144)":
+	movl $144, %r13d
+	#instruction start "1462 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "1463 = alloc with size 8":
+	leaq -2563(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1464 = store 1463 1459, state: 1453":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1465 = alloc with size 8":
+	leaq -2571(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1466 = store 1465 1460, state: 1464":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1467 = alloc with size 4":
+	leaq -2575(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1468 = store 1467 1461, state: 1466":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1469 = alloc with size 8":
+	leaq -2583(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1470 = store 1469 1462, state: 1468":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1471 = constant(0)":
+	leaq -928(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1472 = constant(0)":
+	leaq -936(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1473 = load part address of 1463 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1474 = proj0 1473":
+	#instruction start "1475 = proj1 1473":
+	#instruction start "1476 = load part address of 1465 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1477 = proj0 1476":
+	#instruction start "1478 = proj1 1476":
+	#instruction start "1479 = load part address of 1467 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1480 = proj0 1479":
+	#instruction start "1481 = proj1 1479":
+	#instruction start "1482 = load part address of 1469 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1483 = proj0 1482":
+	#instruction start "1484 = proj1 1482":
+	#instruction start "1485 = allocate_call_stack 0":
+	#instruction start "1486 = set_reg %rdi 1475":
+	#instruction start "1487 = set_reg %rsi 1478 state: 1486":
+	#instruction start "1488 = set_reg %rdx 1481 state: 1487":
+	#instruction start "1489 = set_reg %rcx 1484 state: 1488":
+	#instruction start "1490 = set_reg %rax 1472 state: 1489":
+	#instruction start "1491 = call 1471":
+	addq $0, %rsp
+	movq -936(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -928(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1492 = proj0 1491":
+	#instruction start "1493 = proj1 1491":
+	#Block jump
+	jmp .L116
+.L115:
+	#Block jump elided
+.L116:
+	#instruction start "1494 = alloc with size 7":
+	leaq -2590(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1495 = phi (region: 1455) 1453 1492":
+	#instruction start "1496 = set_zero_ptr 1494, size: 7":
+	movq %rbx, %rdi
+	movl $0, (%rdi)
+	movw $0, 4(%rdi)
+	movb $0, 6(%rdi)
+	#instruction start "1497 = constant(115)":
+	movl $115, %r12d
+	#instruction start "1498 = constant(0)":
+	movq $0, %r13
+	#instruction start "1499 = 1498 + 1494":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1500 = store 1499 1497, state: 1496":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1501 = constant(116)":
+	movl $116, %r12d
+	#instruction start "1502 = constant(1)":
+	movq $1, %r13
+	#instruction start "1503 = 1502 + 1494":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1504 = store 1503 1501, state: 1500":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1505 = constant(114)":
+	movl $114, %r12d
+	#instruction start "1506 = constant(2)":
+	movq $2, %r13
+	#instruction start "1507 = 1506 + 1494":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1508 = store 1507 1505, state: 1504":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1509 = constant(105)":
+	movl $105, %r12d
+	#instruction start "1510 = constant(3)":
+	movq $3, %r13
+	#instruction start "1511 = 1510 + 1494":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1512 = store 1511 1509, state: 1508":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1513 = constant(110)":
+	movl $110, %r12d
+	#instruction start "1514 = constant(4)":
+	movq $4, %r13
+	#instruction start "1515 = 1514 + 1494":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1516 = store 1515 1513, state: 1512":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1517 = constant(103)":
+	movl $103, %r12d
+	#instruction start "1518 = constant(5)":
+	movq $5, %r13
+	#instruction start "1519 = 1518 + 1494":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1520 = store 1519 1517, state: 1516":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1521 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1522 = constant(6)":
+	movq $6, %r13
+	#instruction start "1523 = 1522 + 1494":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1524 = store 1523 1521, state: 1520":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1525 = alloc with size 7":
+	leaq -2597(%rbp), %rsi
+	movq %rsi, -984(%rbp)
+	#instruction start "1526 = set_zero_ptr 1525, size: 7":
+	movq -984(%rbp), %rdi
+	movl $0, (%rdi)
+	movw $0, 4(%rdi)
+	movb $0, 6(%rdi)
+	#instruction start "1527 = constant(115)":
+	movl $115, %r13d
+	#instruction start "1528 = constant(0)":
+	movq $0, %r14
+	#instruction start "1529 = 1528 + 1525":
+	movq %r14, %rax
+	movq -984(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "1530 = store 1529 1527, state: 1526":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "1531 = constant(116)":
+	movl $116, %r13d
+	#instruction start "1532 = constant(1)":
+	movq $1, %r14
+	#instruction start "1533 = 1532 + 1525":
+	movq %r14, %rax
+	movq -984(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "1534 = store 1533 1531, state: 1530":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "1535 = constant(114)":
+	movl $114, %r13d
+	#instruction start "1536 = constant(2)":
+	movq $2, %r14
+	#instruction start "1537 = 1536 + 1525":
+	movq %r14, %rax
+	movq -984(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "1538 = store 1537 1535, state: 1534":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "1539 = constant(105)":
+	movl $105, %r13d
+	#instruction start "1540 = constant(3)":
+	movq $3, %r14
+	#instruction start "1541 = 1540 + 1525":
+	movq %r14, %rax
+	movq -984(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "1542 = store 1541 1539, state: 1538":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "1543 = constant(110)":
+	movl $110, %r13d
+	#instruction start "1544 = constant(4)":
+	movq $4, %r14
+	#instruction start "1545 = 1544 + 1525":
+	movq %r14, %rax
+	movq -984(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "1546 = store 1545 1543, state: 1542":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "1547 = constant(103)":
+	movl $103, %r13d
+	#instruction start "1548 = constant(5)":
+	movq $5, %r14
+	#instruction start "1549 = 1548 + 1525":
+	movq %r14, %rax
+	movq -984(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "1550 = store 1549 1547, state: 1546":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "1551 = constant(0)":
+	movl $0, %r13d
+	#instruction start "1552 = constant(6)":
+	movq $6, %r14
+	#instruction start "1553 = 1552 + 1525":
+	movq %r14, %rax
+	movq -984(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "1554 = store 1553 1551, state: 1550":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "1555 = constant(23)":
+	movq $.Ls23, %r13
+	#instruction start "1556 = alloc with size 8":
+	leaq -2605(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "1557 = store 1556 1494, state: 1554":
+	movq %r14, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1558 = alloc with size 8":
+	leaq -2613(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1559 = store 1558 1555, state: 1557":
+	movq %rbx, %rsi
+	movq %r13, (%rsi)
+	#instruction start "1560 = constant(7)":
+	movq $strcmp, %r13
+	#instruction start "1561 = constant(0)":
+	movq $0, %r15
+	#instruction start "1562 = load part address of 1556 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1563 = proj0 1562":
+	#instruction start "1564 = proj1 1562":
+	#instruction start "1565 = load part address of 1558 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1566 = proj0 1565":
+	#instruction start "1567 = proj1 1565":
+	#instruction start "1568 = allocate_call_stack 0":
+	#instruction start "1569 = set_reg %rdi 1564":
+	#instruction start "1570 = set_reg %rsi 1567 state: 1569":
+	#instruction start "1571 = set_reg %rax 1561 state: 1570":
+	#instruction start "1572 = call 1560":
+	addq $0, %rsp
+	movq %r15, %rax
+	movq %r14, %rsi
+	movq %r12, %rdi
+	movq %r13, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "1573 = proj0 1572":
+	#instruction start "1574 = proj1 1572":
+	#instruction start "1575 = %rax":
+	#instruction start "1576 = int_cast_zero 1575":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "1577 = constant(0)":
+	movl $0, %ebx
+	#instruction start "1578 = 1576 == 1577":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "1580 = if 1455 1578":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L118
+.L117:
+	#instruction start "1583 = constant(24)":
+	movq $.Ls24, %rbx
+	#instruction start "1584 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "1585 = constant(149)":
+	movl $149, %r13d
+	#instruction start "1586 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "1587 = alloc with size 8":
+	leaq -2621(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1588 = store 1587 1583, state: 1573":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1589 = alloc with size 8":
+	leaq -2629(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1590 = store 1589 1584, state: 1588":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1591 = alloc with size 4":
+	leaq -2633(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1592 = store 1591 1585, state: 1590":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1593 = alloc with size 8":
+	leaq -2641(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1594 = store 1593 1586, state: 1592":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1595 = constant(0)":
+	leaq -1016(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1596 = constant(0)":
+	leaq -1024(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1597 = load part address of 1587 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1598 = proj0 1597":
+	#instruction start "1599 = proj1 1597":
+	#instruction start "1600 = load part address of 1589 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1601 = proj0 1600":
+	#instruction start "1602 = proj1 1600":
+	#instruction start "1603 = load part address of 1591 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1604 = proj0 1603":
+	#instruction start "1605 = proj1 1603":
+	#instruction start "1606 = load part address of 1593 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1607 = proj0 1606":
+	#instruction start "1608 = proj1 1606":
+	#instruction start "1609 = allocate_call_stack 0":
+	#instruction start "1610 = set_reg %rdi 1599":
+	#instruction start "1611 = set_reg %rsi 1602 state: 1610":
+	#instruction start "1612 = set_reg %rdx 1605 state: 1611":
+	#instruction start "1613 = set_reg %rcx 1608 state: 1612":
+	#instruction start "1614 = set_reg %rax 1596 state: 1613":
+	#instruction start "1615 = call 1595":
+	addq $0, %rsp
+	movq -1024(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1016(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1616 = proj0 1615":
+	#instruction start "1617 = proj1 1615":
+	#Block jump
+	jmp .L119
+.L118:
+	#Block jump elided
+.L119:
+	#instruction start "1618 = constant(23)":
+	movq $.Ls23, %rbx
+	#instruction start "1619 = alloc with size 8":
+	leaq -2649(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1620 = phi (region: 1579) 1573 1616":
+	#instruction start "1621 = store 1619 1525, state: 1620":
+	movq %r12, %rsi
+	leaq -984(%rbp), %rdi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	#instruction start "1622 = alloc with size 8":
+	leaq -2657(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1623 = store 1622 1618, state: 1621":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1624 = constant(7)":
+	movq $strcmp, %rbx
+	#instruction start "1625 = constant(0)":
+	movq $0, %r14
+	#instruction start "1626 = load part address of 1619 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1627 = proj0 1626":
+	#instruction start "1628 = proj1 1626":
+	#instruction start "1629 = load part address of 1622 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1630 = proj0 1629":
+	#instruction start "1631 = proj1 1629":
+	#instruction start "1632 = allocate_call_stack 0":
+	#instruction start "1633 = set_reg %rdi 1628":
+	#instruction start "1634 = set_reg %rsi 1631 state: 1633":
+	#instruction start "1635 = set_reg %rax 1625 state: 1634":
+	#instruction start "1636 = call 1624":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r12, %rsi
+	movq %r15, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "1637 = proj0 1636":
+	#instruction start "1638 = proj1 1636":
+	#instruction start "1639 = %rax":
+	#instruction start "1640 = int_cast_zero 1639":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "1641 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1642 = 1640 == 1641":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "1644 = if 1579 1642":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L121
+.L120:
+	#instruction start "1647 = constant(25)":
+	movq $.Ls25, %rbx
+	#instruction start "1648 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "1649 = constant(150)":
+	movl $150, %r13d
+	#instruction start "1650 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "1651 = alloc with size 8":
+	leaq -2665(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1652 = store 1651 1647, state: 1637":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1653 = alloc with size 8":
+	leaq -2673(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1654 = store 1653 1648, state: 1652":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1655 = alloc with size 4":
+	leaq -2677(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1656 = store 1655 1649, state: 1654":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1657 = alloc with size 8":
+	leaq -2685(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1658 = store 1657 1650, state: 1656":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1659 = constant(0)":
+	leaq -1096(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1660 = constant(0)":
+	leaq -1104(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1661 = load part address of 1651 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1662 = proj0 1661":
+	#instruction start "1663 = proj1 1661":
+	#instruction start "1664 = load part address of 1653 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1665 = proj0 1664":
+	#instruction start "1666 = proj1 1664":
+	#instruction start "1667 = load part address of 1655 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1668 = proj0 1667":
+	#instruction start "1669 = proj1 1667":
+	#instruction start "1670 = load part address of 1657 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1671 = proj0 1670":
+	#instruction start "1672 = proj1 1670":
+	#instruction start "1673 = allocate_call_stack 0":
+	#instruction start "1674 = set_reg %rdi 1663":
+	#instruction start "1675 = set_reg %rsi 1666 state: 1674":
+	#instruction start "1676 = set_reg %rdx 1669 state: 1675":
+	#instruction start "1677 = set_reg %rcx 1672 state: 1676":
+	#instruction start "1678 = set_reg %rax 1660 state: 1677":
+	#instruction start "1679 = call 1659":
+	addq $0, %rsp
+	movq -1104(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1096(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1680 = proj0 1679":
+	#instruction start "1681 = proj1 1679":
+	#Block jump
+	jmp .L122
+.L121:
+	#Block jump elided
+.L122:
+	#instruction start "1682 = alloc with size 10":
+	leaq -2695(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1683 = phi (region: 1643) 1637 1680":
+	#instruction start "1684 = set_zero_ptr 1682, size: 10":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movw $0, 8(%rdi)
+	#instruction start "1685 = constant(65)":
+	movl $65, %r12d
+	#instruction start "1686 = constant(0)":
+	movq $0, %r13
+	#instruction start "1687 = 1686 + 1682":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1688 = store 1687 1685, state: 1684":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1689 = constant(66)":
+	movl $66, %r12d
+	#instruction start "1690 = constant(1)":
+	movq $1, %r13
+	#instruction start "1691 = 1690 + 1682":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1692 = store 1691 1689, state: 1688":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1693 = constant(67)":
+	movl $67, %r12d
+	#instruction start "1694 = constant(2)":
+	movq $2, %r13
+	#instruction start "1695 = 1694 + 1682":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1696 = store 1695 1693, state: 1692":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1697 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1698 = constant(3)":
+	movq $3, %r13
+	#instruction start "1699 = 1698 + 1682":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1700 = store 1699 1697, state: 1696":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1701 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1702 = constant(4)":
+	movq $4, %r13
+	#instruction start "1703 = 1702 + 1682":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1704 = store 1703 1701, state: 1700":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1705 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1706 = constant(5)":
+	movq $5, %r13
+	#instruction start "1707 = 1706 + 1682":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1708 = store 1707 1705, state: 1704":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1709 = constant(68)":
+	movl $68, %r12d
+	#instruction start "1710 = constant(6)":
+	movq $6, %r13
+	#instruction start "1711 = 1710 + 1682":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1712 = store 1711 1709, state: 1708":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1713 = constant(69)":
+	movl $69, %r12d
+	#instruction start "1714 = constant(7)":
+	movq $7, %r13
+	#instruction start "1715 = 1714 + 1682":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1716 = store 1715 1713, state: 1712":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1717 = constant(70)":
+	movl $70, %r12d
+	#instruction start "1718 = constant(8)":
+	movq $8, %r13
+	#instruction start "1719 = 1718 + 1682":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1720 = store 1719 1717, state: 1716":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1721 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1722 = constant(9)":
+	movq $9, %r13
+	#instruction start "1723 = 1722 + 1682":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1724 = store 1723 1721, state: 1720":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1725 = alloc with size 10":
+	leaq -2705(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1726 = set_zero_ptr 1725, size: 10":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movw $0, 8(%rdi)
+	#instruction start "1727 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1728 = constant(0)":
+	movq $0, %r13
+	#instruction start "1729 = 1728 + 1725":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1730 = store 1729 1727, state: 1726":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1731 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1732 = constant(1)":
+	movq $1, %r13
+	#instruction start "1733 = 1732 + 1725":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1734 = store 1733 1731, state: 1730":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1735 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1736 = constant(2)":
+	movq $2, %r13
+	#instruction start "1737 = 1736 + 1725":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1738 = store 1737 1735, state: 1734":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1739 = constant(65)":
+	movl $65, %r12d
+	#instruction start "1740 = constant(3)":
+	movq $3, %r13
+	#instruction start "1741 = 1740 + 1725":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1742 = store 1741 1739, state: 1738":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1743 = constant(66)":
+	movl $66, %r12d
+	#instruction start "1744 = constant(4)":
+	movq $4, %r13
+	#instruction start "1745 = 1744 + 1725":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1746 = store 1745 1743, state: 1742":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1747 = constant(67)":
+	movl $67, %r12d
+	#instruction start "1748 = constant(5)":
+	movq $5, %r13
+	#instruction start "1749 = 1748 + 1725":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1750 = store 1749 1747, state: 1746":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1751 = constant(68)":
+	movl $68, %r12d
+	#instruction start "1752 = constant(6)":
+	movq $6, %r13
+	#instruction start "1753 = 1752 + 1725":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1754 = store 1753 1751, state: 1750":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1755 = constant(69)":
+	movl $69, %r12d
+	#instruction start "1756 = constant(7)":
+	movq $7, %r13
+	#instruction start "1757 = 1756 + 1725":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1758 = store 1757 1755, state: 1754":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1759 = constant(70)":
+	movl $70, %r12d
+	#instruction start "1760 = constant(8)":
+	movq $8, %r13
+	#instruction start "1761 = 1760 + 1725":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1762 = store 1761 1759, state: 1758":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1763 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1764 = constant(9)":
+	movq $9, %r13
+	#instruction start "1765 = 1764 + 1725":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1766 = store 1765 1763, state: 1762":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1767 = alloc with size 10":
+	leaq -2715(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1768 = set_zero_ptr 1767, size: 10":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movw $0, 8(%rdi)
+	#instruction start "1769 = constant(65)":
+	movl $65, %r12d
+	#instruction start "1770 = constant(0)":
+	movq $0, %r13
+	#instruction start "1771 = 1770 + 1767":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1772 = store 1771 1769, state: 1768":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1773 = constant(66)":
+	movl $66, %r12d
+	#instruction start "1774 = constant(1)":
+	movq $1, %r13
+	#instruction start "1775 = 1774 + 1767":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1776 = store 1775 1773, state: 1772":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1777 = constant(67)":
+	movl $67, %r12d
+	#instruction start "1778 = constant(2)":
+	movq $2, %r13
+	#instruction start "1779 = 1778 + 1767":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1780 = store 1779 1777, state: 1776":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1781 = constant(68)":
+	movl $68, %r12d
+	#instruction start "1782 = constant(3)":
+	movq $3, %r13
+	#instruction start "1783 = 1782 + 1767":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1784 = store 1783 1781, state: 1780":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1785 = constant(69)":
+	movl $69, %r12d
+	#instruction start "1786 = constant(4)":
+	movq $4, %r13
+	#instruction start "1787 = 1786 + 1767":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1788 = store 1787 1785, state: 1784":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1789 = constant(70)":
+	movl $70, %r12d
+	#instruction start "1790 = constant(5)":
+	movq $5, %r13
+	#instruction start "1791 = 1790 + 1767":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1792 = store 1791 1789, state: 1788":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1793 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1794 = constant(6)":
+	movq $6, %r13
+	#instruction start "1795 = 1794 + 1767":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1796 = store 1795 1793, state: 1792":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1797 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1798 = constant(7)":
+	movq $7, %r13
+	#instruction start "1799 = 1798 + 1767":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1800 = store 1799 1797, state: 1796":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1801 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1802 = constant(8)":
+	movq $8, %r13
+	#instruction start "1803 = 1802 + 1767":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1804 = store 1803 1801, state: 1800":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1805 = constant(0)":
+	movl $0, %r12d
+	#instruction start "1806 = constant(9)":
+	movq $9, %r13
+	#instruction start "1807 = 1806 + 1767":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1808 = store 1807 1805, state: 1804":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "1809 = constant(1)":
+	movl $1, %ebx
+	#instruction start "1811 = if 1643 1809":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L124
+.L123:
+	#instruction start "1814 = constant(26)":
+	movq $.Ls26, %rbx
+	#instruction start "1815 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "1816 = constant(157)":
+	movl $157, %r13d
+	#instruction start "1817 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "1818 = alloc with size 8":
+	leaq -2723(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1819 = store 1818 1814, state: 1808":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1820 = alloc with size 8":
+	leaq -2731(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1821 = store 1820 1815, state: 1819":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1822 = alloc with size 4":
+	leaq -2735(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1823 = store 1822 1816, state: 1821":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1824 = alloc with size 8":
+	leaq -2743(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1825 = store 1824 1817, state: 1823":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1826 = constant(0)":
+	leaq -1152(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1827 = constant(0)":
+	leaq -1160(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1828 = load part address of 1818 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1829 = proj0 1828":
+	#instruction start "1830 = proj1 1828":
+	#instruction start "1831 = load part address of 1820 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1832 = proj0 1831":
+	#instruction start "1833 = proj1 1831":
+	#instruction start "1834 = load part address of 1822 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1835 = proj0 1834":
+	#instruction start "1836 = proj1 1834":
+	#instruction start "1837 = load part address of 1824 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1838 = proj0 1837":
+	#instruction start "1839 = proj1 1837":
+	#instruction start "1840 = allocate_call_stack 0":
+	#instruction start "1841 = set_reg %rdi 1830":
+	#instruction start "1842 = set_reg %rsi 1833 state: 1841":
+	#instruction start "1843 = set_reg %rdx 1836 state: 1842":
+	#instruction start "1844 = set_reg %rcx 1839 state: 1843":
+	#instruction start "1845 = set_reg %rax 1827 state: 1844":
+	#instruction start "1846 = call 1826":
+	addq $0, %rsp
+	movq -1160(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1152(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1847 = proj0 1846":
+	#instruction start "1848 = proj1 1846":
+	#Block jump
+	jmp .L125
+.L124:
+	#Block jump elided
+.L125:
+	#instruction start "1849 = constant(1)":
+	movl $1, %ebx
+	#instruction start "1851 = if 1810 1849":
+	#instruction start "1859 = phi (region: 1810) 1808 1847":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L127
+.L126:
+	#instruction start "1854 = constant(27)":
+	movq $.Ls27, %rbx
+	#instruction start "1855 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "1856 = constant(158)":
+	movl $158, %r13d
+	#instruction start "1857 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "1858 = alloc with size 8":
+	leaq -2751(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1860 = store 1858 1854, state: 1859":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1861 = alloc with size 8":
+	leaq -2759(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1862 = store 1861 1855, state: 1860":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1863 = alloc with size 4":
+	leaq -2763(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1864 = store 1863 1856, state: 1862":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1865 = alloc with size 8":
+	leaq -2771(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1866 = store 1865 1857, state: 1864":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1867 = constant(0)":
+	leaq -1208(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1868 = constant(0)":
+	leaq -1216(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1869 = load part address of 1858 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1870 = proj0 1869":
+	#instruction start "1871 = proj1 1869":
+	#instruction start "1872 = load part address of 1861 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1873 = proj0 1872":
+	#instruction start "1874 = proj1 1872":
+	#instruction start "1875 = load part address of 1863 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1876 = proj0 1875":
+	#instruction start "1877 = proj1 1875":
+	#instruction start "1878 = load part address of 1865 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1879 = proj0 1878":
+	#instruction start "1880 = proj1 1878":
+	#instruction start "1881 = allocate_call_stack 0":
+	#instruction start "1882 = set_reg %rdi 1871":
+	#instruction start "1883 = set_reg %rsi 1874 state: 1882":
+	#instruction start "1884 = set_reg %rdx 1877 state: 1883":
+	#instruction start "1885 = set_reg %rcx 1880 state: 1884":
+	#instruction start "1886 = set_reg %rax 1868 state: 1885":
+	#instruction start "1887 = call 1867":
+	addq $0, %rsp
+	movq -1216(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1208(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1888 = proj0 1887":
+	#instruction start "1889 = proj1 1887":
+	#Block jump
+	jmp .L128
+.L127:
+	#Block jump elided
+.L128:
+	#instruction start "1890 = constant(1)":
+	movl $1, %ebx
+	#instruction start "1892 = if 1850 1890":
+	#instruction start "1900 = phi (region: 1850) 1859 1888":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L130
+.L129:
+	#instruction start "1895 = constant(28)":
+	movq $.Ls28, %rbx
+	#instruction start "1896 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "1897 = constant(159)":
+	movl $159, %r13d
+	#instruction start "1898 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "1899 = alloc with size 8":
+	leaq -2779(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1901 = store 1899 1895, state: 1900":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1902 = alloc with size 8":
+	leaq -2787(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1903 = store 1902 1896, state: 1901":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1904 = alloc with size 4":
+	leaq -2791(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1905 = store 1904 1897, state: 1903":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1906 = alloc with size 8":
+	leaq -2799(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1907 = store 1906 1898, state: 1905":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1908 = constant(0)":
+	leaq -1264(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1909 = constant(0)":
+	leaq -1272(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1910 = load part address of 1899 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1911 = proj0 1910":
+	#instruction start "1912 = proj1 1910":
+	#instruction start "1913 = load part address of 1902 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1914 = proj0 1913":
+	#instruction start "1915 = proj1 1913":
+	#instruction start "1916 = load part address of 1904 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1917 = proj0 1916":
+	#instruction start "1918 = proj1 1916":
+	#instruction start "1919 = load part address of 1906 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1920 = proj0 1919":
+	#instruction start "1921 = proj1 1919":
+	#instruction start "1922 = allocate_call_stack 0":
+	#instruction start "1923 = set_reg %rdi 1912":
+	#instruction start "1924 = set_reg %rsi 1915 state: 1923":
+	#instruction start "1925 = set_reg %rdx 1918 state: 1924":
+	#instruction start "1926 = set_reg %rcx 1921 state: 1925":
+	#instruction start "1927 = set_reg %rax 1909 state: 1926":
+	#instruction start "1928 = call 1908":
+	addq $0, %rsp
+	movq -1272(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1264(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1929 = proj0 1928":
+	#instruction start "1930 = proj1 1928":
+	#Block jump
+	jmp .L131
+.L130:
+	#Block jump elided
+.L131:
+	#instruction start "1931 = alloc with size 12":
+	leaq -2811(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1932 = phi (region: 1891) 1900 1929":
+	#instruction start "1933 = set_zero_ptr 1931, size: 12":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movl $0, 8(%rdi)
+	#instruction start "1934 = constant(0)":
+	movq $0, %r12
+	#instruction start "1935 = 1931 + 1934":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1936 = constant(0)":
+	movq $0, %r12
+	#instruction start "1937 = 1935 + 1936":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1938 = constant(1)":
+	movl $1, %r12d
+	#instruction start "1939 = store 1937 1938, state: 1933":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "1940 = constant(4)":
+	movq $4, %r12
+	#instruction start "1941 = 1935 + 1940":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1942 = constant(3)":
+	movl $3, %r12d
+	#instruction start "1943 = store 1941 1942, state: 1939":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "1944 = constant(8)":
+	movq $8, %r12
+	#instruction start "1945 = 1935 + 1944":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "1946 = constant(2)":
+	movl $2, %r12d
+	#instruction start "1947 = store 1945 1946, state: 1943":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "1948 = constant(0)":
+	movq $0, %r12
+	#instruction start "1949 = 1931 + 1948":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "1950 = constant(4)":
+	movq $4, %rbx
+	#instruction start "1951 = 1949 + 1950":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "1952 = load_volatile 1951, state: 1947":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "1953 = proj0 1952":
+	#instruction start "1954 = proj1 1952":
+	#instruction start "1955 = constant(3)":
+	movl $3, %r12d
+	#instruction start "1956 = 1954 == 1955":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "1958 = if 1891 1956":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L133
+.L132:
+	#instruction start "1961 = constant(29)":
+	movq $.Ls29, %rbx
+	#instruction start "1962 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "1963 = constant(168)":
+	movl $168, %r13d
+	#instruction start "1964 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "1965 = alloc with size 8":
+	leaq -2819(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1966 = store 1965 1961, state: 1953":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1967 = alloc with size 8":
+	leaq -2827(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1968 = store 1967 1962, state: 1966":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1969 = alloc with size 4":
+	leaq -2831(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1970 = store 1969 1963, state: 1968":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1971 = alloc with size 8":
+	leaq -2839(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1972 = store 1971 1964, state: 1970":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1973 = constant(0)":
+	leaq -1320(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1974 = constant(0)":
+	leaq -1328(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1975 = load part address of 1965 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1976 = proj0 1975":
+	#instruction start "1977 = proj1 1975":
+	#instruction start "1978 = load part address of 1967 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1979 = proj0 1978":
+	#instruction start "1980 = proj1 1978":
+	#instruction start "1981 = load part address of 1969 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1982 = proj0 1981":
+	#instruction start "1983 = proj1 1981":
+	#instruction start "1984 = load part address of 1971 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1985 = proj0 1984":
+	#instruction start "1986 = proj1 1984":
+	#instruction start "1987 = allocate_call_stack 0":
+	#instruction start "1988 = set_reg %rdi 1977":
+	#instruction start "1989 = set_reg %rsi 1980 state: 1988":
+	#instruction start "1990 = set_reg %rdx 1983 state: 1989":
+	#instruction start "1991 = set_reg %rcx 1986 state: 1990":
+	#instruction start "1992 = set_reg %rax 1974 state: 1991":
+	#instruction start "1993 = call 1973":
+	addq $0, %rsp
+	movq -1328(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1320(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1994 = proj0 1993":
+	#instruction start "1995 = proj1 1993":
+	#Block jump
+	jmp .L134
+.L133:
+	#Block jump elided
+.L134:
+	#instruction start "1996 = alloc with size 16":
+	leaq -2855(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1997 = phi (region: 1957) 1953 1994":
+	#instruction start "1998 = set_zero_ptr 1996, size: 16":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	#instruction start "1999 = constant(0)":
+	movq $0, %r12
+	#instruction start "2000 = 1996 + 1999":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "2001 = constant(5)":
+	movl $5, %r12d
+	#instruction start "2002 = store 2000 2001, state: 1998":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "2005 = constant(8)":
+	movq $8, %r12
+	#instruction start "2006 = 1996 + 2005":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "2007 = constant(2)":
+	movl $2, %r12d
+	#instruction start "2008 = store 2006 2007, state: 2002":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "2009 = constant(12)":
+	movq $12, %r12
+	#instruction start "2010 = 1996 + 2009":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "2011 = constant(3)":
+	movl $3, %ebx
+	#instruction start "2012 = store 2010 2011, state: 2008":
+	movq %r13, %rsi
+	movl %ebx, (%rsi)
+	#instruction start "2013 = constant(1)":
+	movl $1, %ebx
+	#instruction start "2015 = if 1957 2013":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L136
+.L135:
+	#instruction start "2018 = constant(30)":
+	movq $.Ls30, %rbx
+	#instruction start "2019 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "2020 = constant(173)":
+	movl $173, %r13d
+	#instruction start "2021 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "2022 = alloc with size 8":
+	leaq -2863(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "2023 = store 2022 2018, state: 2012":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "2024 = alloc with size 8":
+	leaq -2871(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "2025 = store 2024 2019, state: 2023":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "2026 = alloc with size 4":
+	leaq -2875(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "2027 = store 2026 2020, state: 2025":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "2028 = alloc with size 8":
+	leaq -2883(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "2029 = store 2028 2021, state: 2027":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "2030 = constant(0)":
+	leaq -1376(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "2031 = constant(0)":
+	leaq -1384(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "2032 = load part address of 2022 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "2033 = proj0 2032":
+	#instruction start "2034 = proj1 2032":
+	#instruction start "2035 = load part address of 2024 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "2036 = proj0 2035":
+	#instruction start "2037 = proj1 2035":
+	#instruction start "2038 = load part address of 2026 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "2039 = proj0 2038":
+	#instruction start "2040 = proj1 2038":
+	#instruction start "2041 = load part address of 2028 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "2042 = proj0 2041":
+	#instruction start "2043 = proj1 2041":
+	#instruction start "2044 = allocate_call_stack 0":
+	#instruction start "2045 = set_reg %rdi 2034":
+	#instruction start "2046 = set_reg %rsi 2037 state: 2045":
+	#instruction start "2047 = set_reg %rdx 2040 state: 2046":
+	#instruction start "2048 = set_reg %rcx 2043 state: 2047":
+	#instruction start "2049 = set_reg %rax 2031 state: 2048":
+	#instruction start "2050 = call 2030":
+	addq $0, %rsp
+	movq -1384(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1376(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "2051 = proj0 2050":
+	#instruction start "2052 = proj1 2050":
+	#Block jump
+	jmp .L137
+.L136:
+	#Block jump elided
+.L137:
+	#instruction start "2053 = alloc with size 8":
+	leaq -2891(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "2054 = phi (region: 2014) 2012 2051":
+	#instruction start "2055 = set_zero_ptr 2053, size: 8":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	#instruction start "2056 = constant(0)":
+	movq $0, %r12
+	#instruction start "2057 = 2053 + 2056":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "2058 = constant(0)":
+	movq $0, %r12
+	#instruction start "2059 = 2057 + 2058":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "2060 = constant(3)":
+	movl $3, %r12d
+	#instruction start "2061 = store 2059 2060, state: 2055":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "2062 = constant(4)":
+	movq $4, %r12
+	#instruction start "2063 = 2057 + 2062":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "2064 = constant(10)":
+	movl $10, %r12d
+	#instruction start "2065 = store 2063 2064, state: 2061":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "2066 = constant(0)":
+	movq $0, %r12
+	#instruction start "2067 = 2053 + 2066":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "2068 = constant(0)":
+	movq $0, %rbx
+	#instruction start "2069 = 2067 + 2068":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "2070 = load_volatile 2069, state: 2065":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "2071 = proj0 2070":
+	#instruction start "2072 = proj1 2070":
+	#instruction start "2073 = constant(3)":
+	movl $3, %r12d
+	#instruction start "2074 = 2072 == 2073":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "2076 = if 2014 2074":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L139
+.L138:
+	#instruction start "2079 = constant(31)":
+	movq $.Ls31, %rbx
+	#instruction start "2080 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "2081 = constant(188)":
+	movl $188, %r13d
+	#instruction start "2082 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "2083 = alloc with size 8":
+	leaq -2899(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "2084 = store 2083 2079, state: 2071":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "2085 = alloc with size 8":
+	leaq -2907(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "2086 = store 2085 2080, state: 2084":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "2087 = alloc with size 4":
+	leaq -2911(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "2088 = store 2087 2081, state: 2086":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "2089 = alloc with size 8":
+	leaq -2919(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "2090 = store 2089 2082, state: 2088":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "2091 = constant(0)":
+	leaq -1432(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "2092 = constant(0)":
+	leaq -1440(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "2093 = load part address of 2083 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "2094 = proj0 2093":
+	#instruction start "2095 = proj1 2093":
+	#instruction start "2096 = load part address of 2085 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "2097 = proj0 2096":
+	#instruction start "2098 = proj1 2096":
+	#instruction start "2099 = load part address of 2087 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "2100 = proj0 2099":
+	#instruction start "2101 = proj1 2099":
+	#instruction start "2102 = load part address of 2089 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "2103 = proj0 2102":
+	#instruction start "2104 = proj1 2102":
+	#instruction start "2105 = allocate_call_stack 0":
+	#instruction start "2106 = set_reg %rdi 2095":
+	#instruction start "2107 = set_reg %rsi 2098 state: 2106":
+	#instruction start "2108 = set_reg %rdx 2101 state: 2107":
+	#instruction start "2109 = set_reg %rcx 2104 state: 2108":
+	#instruction start "2110 = set_reg %rax 2092 state: 2109":
+	#instruction start "2111 = call 2091":
+	addq $0, %rsp
+	movq -1440(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1432(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "2112 = proj0 2111":
+	#instruction start "2113 = proj1 2111":
+	#Block jump
+	jmp .L140
+.L139:
+	#Block jump elided
+.L140:
+	#instruction start "2114 = alloc with size 8":
+	leaq -2927(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "2115 = phi (region: 2075) 2071 2112":
+	#instruction start "2116 = set_zero_ptr 2114, size: 8":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	#instruction start "2117 = constant(0)":
+	movq $0, %r12
+	#instruction start "2118 = 2114 + 2117":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "2119 = constant(1)":
+	movl $1, %r12d
+	#instruction start "2120 = store 2118 2119, state: 2116":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "2121 = constant(4)":
+	movq $4, %r12
+	#instruction start "2122 = 2114 + 2121":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "2123 = constant(2)":
+	movl $2, %r12d
+	#instruction start "2124 = store 2122 2123, state: 2120":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "2125 = alloc with size 12":
+	leaq -2939(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "2126 = set_zero_ptr 2125, size: 12":
+	movq %r12, %rdi
+	movq $0, (%rdi)
+	movl $0, 8(%rdi)
+	#instruction start "2127 = constant(0)":
+	movq $0, %r13
+	#instruction start "2128 = 2125 + 2127":
+	movq %r12, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "2129 = memcpy from 2128 to 2114":
+	movq %r14, %rsi
+	movq %rbx, %rdi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	#instruction start "2130 = constant(8)":
+	movq $8, %rbx
+	#instruction start "2131 = 2125 + 2130":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "2132 = constant(10)":
+	movl $10, %ebx
+	#instruction start "2133 = store 2131 2132, state: 2129":
+	movq %r13, %rsi
+	movl %ebx, (%rsi)
+	#instruction start "2134 = constant(0)":
+	movq $0, %rbx
+	#instruction start "2135 = 2125 + 2134":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "2136 = constant(4)":
+	movq $4, %rbx
+	#instruction start "2137 = 2135 + 2136":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "2138 = load_volatile 2137, state: 2133":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "2139 = proj0 2138":
+	#instruction start "2140 = proj1 2138":
+	#instruction start "2141 = constant(2)":
+	movl $2, %r12d
+	#instruction start "2142 = 2140 == 2141":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "2144 = if 2075 2142":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L142
+.L141:
+	#instruction start "2147 = constant(32)":
+	movq $.Ls32, %rbx
+	#instruction start "2148 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "2149 = constant(198)":
+	movl $198, %r13d
+	#instruction start "2150 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "2151 = alloc with size 8":
+	leaq -2947(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "2152 = store 2151 2147, state: 2139":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "2153 = alloc with size 8":
+	leaq -2955(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "2154 = store 2153 2148, state: 2152":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "2155 = alloc with size 4":
+	leaq -2959(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "2156 = store 2155 2149, state: 2154":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "2157 = alloc with size 8":
+	leaq -2967(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "2158 = store 2157 2150, state: 2156":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "2159 = constant(0)":
+	leaq -1488(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "2160 = constant(0)":
+	leaq -1496(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "2161 = load part address of 2151 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "2162 = proj0 2161":
+	#instruction start "2163 = proj1 2161":
+	#instruction start "2164 = load part address of 2153 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "2165 = proj0 2164":
+	#instruction start "2166 = proj1 2164":
+	#instruction start "2167 = load part address of 2155 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "2168 = proj0 2167":
+	#instruction start "2169 = proj1 2167":
+	#instruction start "2170 = load part address of 2157 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "2171 = proj0 2170":
+	#instruction start "2172 = proj1 2170":
+	#instruction start "2173 = allocate_call_stack 0":
+	#instruction start "2174 = set_reg %rdi 2163":
+	#instruction start "2175 = set_reg %rsi 2166 state: 2174":
+	#instruction start "2176 = set_reg %rdx 2169 state: 2175":
+	#instruction start "2177 = set_reg %rcx 2172 state: 2176":
+	#instruction start "2178 = set_reg %rax 2160 state: 2177":
+	#instruction start "2179 = call 2159":
+	addq $0, %rsp
+	movq -1496(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1488(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "2180 = proj0 2179":
+	#instruction start "2181 = proj1 2179":
+	#Block jump
+	jmp .L143
+.L142:
+	#Block jump elided
+.L143:
+	#instruction start "2182 = constant(34)":
+	movq $.LVAR1ptr, %rbx
+	#instruction start "2183 = phi (region: 2143) 2139 2180":
+	#instruction start "2184 = load_volatile 2182, state: 2183":
+	movq %rbx, %rdi
+	movq (%rdi), %r12
+	#instruction start "2185 = proj0 2184":
+	#instruction start "2186 = proj1 2184":
+	#instruction start "2187 = constant(13)":
+	movl $13, %ebx
+	#instruction start "2188 = store 2186 2187, state: 2185":
+	movq %r12, %rsi
+	movl %ebx, (%rsi)
+	#instruction start "2189 = constant(33)":
+	movq $.LVAR0t, %rbx
+	#instruction start "2190 = load_volatile 2189, state: 2188":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "2191 = proj0 2190":
+	#instruction start "2192 = proj1 2190":
+	#instruction start "2193 = constant(13)":
+	movl $13, %ebx
+	#instruction start "2194 = 2192 == 2193":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "2196 = if 2143 2194":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L145
+.L144:
+	#instruction start "2199 = constant(35)":
+	movq $.Ls35, %rbx
+	#instruction start "2200 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "2201 = constant(208)":
+	movl $208, %r13d
+	#instruction start "2202 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "2203 = alloc with size 8":
+	leaq -2975(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "2204 = store 2203 2199, state: 2191":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "2205 = alloc with size 8":
+	leaq -2983(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "2206 = store 2205 2200, state: 2204":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "2207 = alloc with size 4":
+	leaq -2987(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "2208 = store 2207 2201, state: 2206":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "2209 = alloc with size 8":
+	leaq -2995(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "2210 = store 2209 2202, state: 2208":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "2211 = constant(0)":
+	leaq -1544(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "2212 = constant(0)":
+	leaq -1552(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "2213 = load part address of 2203 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "2214 = proj0 2213":
+	#instruction start "2215 = proj1 2213":
+	#instruction start "2216 = load part address of 2205 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "2217 = proj0 2216":
+	#instruction start "2218 = proj1 2216":
+	#instruction start "2219 = load part address of 2207 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "2220 = proj0 2219":
+	#instruction start "2221 = proj1 2219":
+	#instruction start "2222 = load part address of 2209 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "2223 = proj0 2222":
+	#instruction start "2224 = proj1 2222":
+	#instruction start "2225 = allocate_call_stack 0":
+	#instruction start "2226 = set_reg %rdi 2215":
+	#instruction start "2227 = set_reg %rsi 2218 state: 2226":
+	#instruction start "2228 = set_reg %rdx 2221 state: 2227":
+	#instruction start "2229 = set_reg %rcx 2224 state: 2228":
+	#instruction start "2230 = set_reg %rax 2212 state: 2229":
+	#instruction start "2231 = call 2211":
+	addq $0, %rsp
+	movq -1552(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1544(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "2232 = proj0 2231":
+	#instruction start "2233 = proj1 2231":
+	#Block jump
+	jmp .L146
+.L145:
+	#Block jump elided
+.L146:
+	#instruction start "2234 = constant(37)":
+	movq $.LVAR2ts1, %rbx
+	#instruction start "2235 = constant(36)":
+	movq $.Ls36, %r12
+	#instruction start "2236 = alloc with size 8":
+	leaq -3003(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "2237 = phi (region: 2195) 2191 2232":
+	#instruction start "2238 = store 2236 2235, state: 2237":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "2239 = constant(7)":
+	movq $strcmp, %r12
+	#instruction start "2240 = constant(0)":
+	movq $0, %r14
+	#instruction start "2241 = load part address of 2234 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "2242 = proj0 2241":
+	#instruction start "2243 = proj1 2241":
+	#instruction start "2244 = load part address of 2236 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "2245 = proj0 2244":
+	#instruction start "2246 = proj1 2244":
+	#instruction start "2247 = allocate_call_stack 0":
+	#instruction start "2248 = set_reg %rdi 2243":
+	#instruction start "2249 = set_reg %rsi 2246 state: 2248":
+	#instruction start "2250 = set_reg %rax 2240 state: 2249":
+	#instruction start "2251 = call 2239":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "2252 = proj0 2251":
+	#instruction start "2253 = proj1 2251":
+	#instruction start "2254 = %rax":
+	#instruction start "2255 = int_cast_zero 2254":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "2256 = constant(0)":
+	movl $0, %r12d
+	#instruction start "2257 = 2255 == 2256":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "2259 = if 2195 2257":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L148
+.L147:
+	#instruction start "2262 = constant(38)":
+	movq $.Ls38, %rbx
+	#instruction start "2263 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "2264 = constant(218)":
+	movl $218, %r13d
+	#instruction start "2265 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "2266 = alloc with size 8":
+	leaq -3011(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "2267 = store 2266 2262, state: 2252":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "2268 = alloc with size 8":
+	leaq -3019(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "2269 = store 2268 2263, state: 2267":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "2270 = alloc with size 4":
+	leaq -3023(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "2271 = store 2270 2264, state: 2269":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "2272 = alloc with size 8":
+	leaq -3031(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "2273 = store 2272 2265, state: 2271":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "2274 = constant(0)":
+	leaq -1624(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "2275 = constant(0)":
+	leaq -1632(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "2276 = load part address of 2266 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "2277 = proj0 2276":
+	#instruction start "2278 = proj1 2276":
+	#instruction start "2279 = load part address of 2268 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "2280 = proj0 2279":
+	#instruction start "2281 = proj1 2279":
+	#instruction start "2282 = load part address of 2270 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "2283 = proj0 2282":
+	#instruction start "2284 = proj1 2282":
+	#instruction start "2285 = load part address of 2272 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "2286 = proj0 2285":
+	#instruction start "2287 = proj1 2285":
+	#instruction start "2288 = allocate_call_stack 0":
+	#instruction start "2289 = set_reg %rdi 2278":
+	#instruction start "2290 = set_reg %rsi 2281 state: 2289":
+	#instruction start "2291 = set_reg %rdx 2284 state: 2290":
+	#instruction start "2292 = set_reg %rcx 2287 state: 2291":
+	#instruction start "2293 = set_reg %rax 2275 state: 2292":
+	#instruction start "2294 = call 2274":
+	addq $0, %rsp
+	movq -1632(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1624(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "2295 = proj0 2294":
+	#instruction start "2296 = proj1 2294":
+	#Block jump
+	jmp .L149
+.L148:
+	#Block jump elided
+.L149:
+	#instruction start "2297 = constant(36)":
+	movq $.Ls36, %rbx
+	#instruction start "2298 = alloc with size 8":
+	leaq -3039(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "2299 = constant(39)":
+	movq $.LVAR3ts2, %r13
+	#instruction start "2300 = phi (region: 2258) 2252 2295":
+	#instruction start "2301 = store 2298 2299, state: 2300":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "2302 = alloc with size 8":
+	leaq -3047(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "2303 = store 2302 2297, state: 2301":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "2304 = constant(7)":
+	movq $strcmp, %rbx
+	#instruction start "2305 = constant(0)":
+	movq $0, %r14
+	#instruction start "2306 = load part address of 2298 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "2307 = proj0 2306":
+	#instruction start "2308 = proj1 2306":
+	#instruction start "2309 = load part address of 2302 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "2310 = proj0 2309":
+	#instruction start "2311 = proj1 2309":
+	#instruction start "2312 = allocate_call_stack 0":
+	#instruction start "2313 = set_reg %rdi 2308":
+	#instruction start "2314 = set_reg %rsi 2311 state: 2313":
+	#instruction start "2315 = set_reg %rax 2305 state: 2314":
+	#instruction start "2316 = call 2304":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r12, %rsi
+	movq %r15, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "2317 = proj0 2316":
+	#instruction start "2318 = proj1 2316":
+	#instruction start "2319 = %rax":
+	#instruction start "2320 = int_cast_zero 2319":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "2321 = constant(0)":
+	movl $0, %r12d
+	#instruction start "2322 = 2320 == 2321":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "2324 = if 2258 2322":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L151
+.L150:
+	#instruction start "2327 = constant(40)":
+	movq $.Ls40, %rbx
+	#instruction start "2328 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "2329 = constant(225)":
+	movl $225, %r13d
+	#instruction start "2330 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "2331 = alloc with size 8":
+	leaq -3055(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "2332 = store 2331 2327, state: 2317":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "2333 = alloc with size 8":
+	leaq -3063(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "2334 = store 2333 2328, state: 2332":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "2335 = alloc with size 4":
+	leaq -3067(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "2336 = store 2335 2329, state: 2334":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "2337 = alloc with size 8":
+	leaq -3075(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "2338 = store 2337 2330, state: 2336":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "2339 = constant(0)":
+	leaq -1704(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "2340 = constant(0)":
+	leaq -1712(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "2341 = load part address of 2331 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "2342 = proj0 2341":
+	#instruction start "2343 = proj1 2341":
+	#instruction start "2344 = load part address of 2333 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "2345 = proj0 2344":
+	#instruction start "2346 = proj1 2344":
+	#instruction start "2347 = load part address of 2335 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "2348 = proj0 2347":
+	#instruction start "2349 = proj1 2347":
+	#instruction start "2350 = load part address of 2337 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "2351 = proj0 2350":
+	#instruction start "2352 = proj1 2350":
+	#instruction start "2353 = allocate_call_stack 0":
+	#instruction start "2354 = set_reg %rdi 2343":
+	#instruction start "2355 = set_reg %rsi 2346 state: 2354":
+	#instruction start "2356 = set_reg %rdx 2349 state: 2355":
+	#instruction start "2357 = set_reg %rcx 2352 state: 2356":
+	#instruction start "2358 = set_reg %rax 2340 state: 2357":
+	#instruction start "2359 = call 2339":
+	addq $0, %rsp
+	movq -1712(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1704(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "2360 = proj0 2359":
+	#instruction start "2361 = proj1 2359":
+	#Block jump
+	jmp .L152
+.L151:
+	#Block jump elided
+.L152:
+	#instruction start "2362 = constant(0)":
+	movl $0, %ebx
+	#instruction start "2363 = set_reg %rax 2362":
+	#instruction start "2364 = phi (region: 2323) 2317 2360":
+	#instruction start "2365 = return 2323, 2363, 2364":
+	movq %rbx, %rax
+	#Block return.
+	movq -3083(%rbp), %rbx
+	movq -3091(%rbp), %r12
+	movq -3099(%rbp), %r13
+	movq -3107(%rbp), %r14
+	movq -3115(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "i1 == i2\000"
+.Ls2:
+	.string "tests/initializers.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "i1 == i3\000"
+.Ls5:
+	.string "a == 0xffffffff\000"
+.Ls6:
+	.string "t2.a == t1.a && t2.b == t2.b\000"
+.Ls8:
+	.string "strcmp(str1, str2) == 0\000"
+.Ls9:
+	.string "t3.a == t3.b && t3.a == 64\000"
+.Ls10:
+	.string "t4.inner.c == 0\000"
+.Ls11:
+	.string "t5.inner.c == 7\000"
+.Ls12:
+	.string "t6.t5.a == 1 && t6.t5.t6.a == 2\000"
+.Ls13:
+	.string "t8.t5.a == 1 && t8.t5.t6.a == 2 && t8.t5.t6.b == 3\000"
+.Ls14:
+	.string "t7.t5.a == 1\000"
+.Ls15:
+	.string "t9.arr[3] == 4\000"
+.Ls16:
+	.string "t.inner.a == 2 && t.inner.b == 4 && t.c == 0\000"
+.Ls17:
+	.string "hello\000"
+.Ls18:
+	.string "AAA\000"
+.Ls19:
+	.string "BBB\000"
+.Ls20:
+	.string "strcmp(matrix[0][0], \"AAA\") == 0\000"
+.Ls21:
+	.string "t.t2.d == 3 && t.a == 1 && t.b == 2\000"
+.Ls22:
+	.string "t.z == 3 && t.x == 2 && t.y == 5\000"
+.Ls23:
+	.string "string\000"
+.Ls24:
+	.string "strcmp((char *)ustr, \"string\") == 0\000"
+.Ls25:
+	.string "strcmp((char *)sstr, \"string\") == 0\000"
+.Ls26:
+	.string "sizeof str1 == 10\000"
+.Ls27:
+	.string "sizeof str2 == 10\000"
+.Ls28:
+	.string "sizeof str3 == 10\000"
+.Ls29:
+	.string "t.b == 3\000"
+.Ls30:
+	.string "sizeof a == 4 * sizeof(int)\000"
+.Ls31:
+	.string "t.a == 3\000"
+.Ls32:
+	.string "t2.a.b == 2\000"
+.Ls35:
+	.string "t.a == 13\000"
+.Ls36:
+	.string "abc\000"
+.Ls38:
+	.string "strcmp(ts1[0].str, \"abc\") == 0\000"
+.Ls40:
+	.string "strcmp(ts2[0].str, \"abc\") == 0\000"
+.section .data
+.align 4
+.LVAR0t:
+.zero 4
+.section .text
+.section .data
+.align 8
+.LVAR1ptr:
+.quad .LVAR0t
+.section .text
+.section .data
+.align 8
+.LVAR2ts1:
+.quad .Ls36
+.section .text
+.section .data
+.align 1
+.LVAR3ts2:
+.byte 97
+.byte 98
+.byte 99
+.byte 0
+.section .text
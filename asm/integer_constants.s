@@ -0,0 +1,464 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $400, %rsp
+	movq %rbx, -356(%rbp)
+	movq %r12, -364(%rbp)
+	movq %r13, -372(%rbp)
+	movq %r14, -380(%rbp)
+	movq %r15, -388(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "8 = constant(77)":
+	movl $77, %ebx
+	#instruction start "12 = constant(63)":
+	leaq -4(%rbp), %rdi
+	movl $63, (%rdi)
+	#instruction start "16 = 8 != 12":
+	movq %rbx, %rax
+	movl -4(%rbp), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "18 = if 2 16":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "21 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "22 = constant(2)":
+	movq $.Ls2, %r13
+	#instruction start "23 = constant(5)":
+	movl $5, %r14d
+	#instruction start "24 = constant(3)":
+	movq $.Ls3, %r15
+	#instruction start "25 = alloc with size 8":
+	leaq -244(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "26 = store 25 21, state: 3":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "27 = alloc with size 8":
+	leaq -252(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "28 = store 27 22, state: 26":
+	movq %rbx, %rsi
+	movq %r13, (%rsi)
+	#instruction start "29 = alloc with size 4":
+	leaq -256(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "30 = store 29 23, state: 28":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "31 = alloc with size 8":
+	leaq -264(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "32 = store 31 24, state: 30":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "33 = constant(0)":
+	leaq -12(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "34 = constant(0)":
+	leaq -20(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "35 = load part address of 25 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "36 = proj0 35":
+	#instruction start "37 = proj1 35":
+	#instruction start "38 = load part address of 27 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "39 = proj0 38":
+	#instruction start "40 = proj1 38":
+	#instruction start "41 = load part address of 29 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "42 = proj0 41":
+	#instruction start "43 = proj1 41":
+	#instruction start "44 = load part address of 31 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "45 = proj0 44":
+	#instruction start "46 = proj1 44":
+	#instruction start "47 = allocate_call_stack 0":
+	#instruction start "48 = set_reg %rdi 37":
+	#instruction start "49 = set_reg %rsi 40 state: 48":
+	#instruction start "50 = set_reg %rdx 43 state: 49":
+	#instruction start "51 = set_reg %rcx 46 state: 50":
+	#instruction start "52 = set_reg %rax 34 state: 51":
+	#instruction start "53 = call 33":
+	addq $0, %rsp
+	movq -20(%rbp), %rax
+	movq %r13, %rcx
+	movq %rbx, %rdx
+	movq %r12, %rsi
+	movq %r15, %rdi
+	movq -12(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "54 = proj0 53":
+	#instruction start "55 = proj1 53":
+	#Phi node to 204 (17 12 12)
+	movl -4(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump
+	jmp .L5
+.L4:
+	#Phi node to 204 (17 12 12)
+	movl -4(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump elided
+.L5:
+	#instruction start "56 = phi (region: 17) 3 54":
+	#instruction start "58 = constant(63)":
+	movl $63, %r12d
+	#instruction start "204 = phi (region: 17) 12 12":
+	#instruction start "59 = 204 == 58":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "61 = if 17 59":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "64 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "65 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "66 = constant(6)":
+	movl $6, %r13d
+	#instruction start "67 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "68 = alloc with size 8":
+	leaq -272(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "69 = store 68 64, state: 56":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "70 = alloc with size 8":
+	leaq -280(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "71 = store 70 65, state: 69":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "72 = alloc with size 4":
+	leaq -284(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "73 = store 72 66, state: 71":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "74 = alloc with size 8":
+	leaq -292(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "75 = store 74 67, state: 73":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "76 = constant(0)":
+	leaq -68(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "77 = constant(0)":
+	leaq -76(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "78 = load part address of 68 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "79 = proj0 78":
+	#instruction start "80 = proj1 78":
+	#instruction start "81 = load part address of 70 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "82 = proj0 81":
+	#instruction start "83 = proj1 81":
+	#instruction start "84 = load part address of 72 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "85 = proj0 84":
+	#instruction start "86 = proj1 84":
+	#instruction start "87 = load part address of 74 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "88 = proj0 87":
+	#instruction start "89 = proj1 87":
+	#instruction start "90 = allocate_call_stack 0":
+	#instruction start "91 = set_reg %rdi 80":
+	#instruction start "92 = set_reg %rsi 83 state: 91":
+	#instruction start "93 = set_reg %rdx 86 state: 92":
+	#instruction start "94 = set_reg %rcx 89 state: 93":
+	#instruction start "95 = set_reg %rax 77 state: 94":
+	#instruction start "96 = call 76":
+	addq $0, %rsp
+	movq -76(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -68(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "97 = proj0 96":
+	#instruction start "98 = proj1 96":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "100 = phi (region: 60) 56 97":
+	#instruction start "102 = constant(5)":
+	movl $5, %ebx
+	#instruction start "105 = constant(5)":
+	movl $5, %r12d
+	#instruction start "106 = 102 == 105":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "108 = if 60 106":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "111 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "112 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "113 = constant(9)":
+	movl $9, %r13d
+	#instruction start "114 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "115 = alloc with size 8":
+	leaq -300(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "116 = store 115 111, state: 100":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "117 = alloc with size 8":
+	leaq -308(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "118 = store 117 112, state: 116":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "119 = alloc with size 4":
+	leaq -312(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "120 = store 119 113, state: 118":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "121 = alloc with size 8":
+	leaq -320(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "122 = store 121 114, state: 120":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "123 = constant(0)":
+	leaq -124(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "124 = constant(0)":
+	leaq -132(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "125 = load part address of 115 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "126 = proj0 125":
+	#instruction start "127 = proj1 125":
+	#instruction start "128 = load part address of 117 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "129 = proj0 128":
+	#instruction start "130 = proj1 128":
+	#instruction start "131 = load part address of 119 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "132 = proj0 131":
+	#instruction start "133 = proj1 131":
+	#instruction start "134 = load part address of 121 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "135 = proj0 134":
+	#instruction start "136 = proj1 134":
+	#instruction start "137 = allocate_call_stack 0":
+	#instruction start "138 = set_reg %rdi 127":
+	#instruction start "139 = set_reg %rsi 130 state: 138":
+	#instruction start "140 = set_reg %rdx 133 state: 139":
+	#instruction start "141 = set_reg %rcx 136 state: 140":
+	#instruction start "142 = set_reg %rax 124 state: 141":
+	#instruction start "143 = call 123":
+	addq $0, %rsp
+	movq -132(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -124(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "144 = proj0 143":
+	#instruction start "145 = proj1 143":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "147 = phi (region: 107) 100 144":
+	#instruction start "149 = constant(0)":
+	movl $0, %ebx
+	#instruction start "152 = ~149":
+	movq %rbx, %rax
+	notq %rax
+	movl %eax, %r12d
+	#instruction start "153 = int_cast_zero 152":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %rbx
+	#instruction start "154 = constant(-1)":
+	movq $-1, %r12
+	#instruction start "155 = 153 == 154":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "157 = if 107 155":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "160 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "161 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "162 = constant(12)":
+	movl $12, %r13d
+	#instruction start "163 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "164 = alloc with size 8":
+	leaq -328(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "165 = store 164 160, state: 147":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "166 = alloc with size 8":
+	leaq -336(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "167 = store 166 161, state: 165":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "168 = alloc with size 4":
+	leaq -340(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "169 = store 168 162, state: 167":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "170 = alloc with size 8":
+	leaq -348(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "171 = store 170 163, state: 169":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "172 = constant(0)":
+	leaq -180(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "173 = constant(0)":
+	leaq -188(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "174 = load part address of 164 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "175 = proj0 174":
+	#instruction start "176 = proj1 174":
+	#instruction start "177 = load part address of 166 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "178 = proj0 177":
+	#instruction start "179 = proj1 177":
+	#instruction start "180 = load part address of 168 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "181 = proj0 180":
+	#instruction start "182 = proj1 180":
+	#instruction start "183 = load part address of 170 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "184 = proj0 183":
+	#instruction start "185 = proj1 183":
+	#instruction start "186 = allocate_call_stack 0":
+	#instruction start "187 = set_reg %rdi 176":
+	#instruction start "188 = set_reg %rsi 179 state: 187":
+	#instruction start "189 = set_reg %rdx 182 state: 188":
+	#instruction start "190 = set_reg %rcx 185 state: 189":
+	#instruction start "191 = set_reg %rax 173 state: 190":
+	#instruction start "192 = call 172":
+	addq $0, %rsp
+	movq -188(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -180(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "193 = proj0 192":
+	#instruction start "194 = proj1 192":
+	#Block jump
+	jmp .L14
+.L13:
+	#Block jump elided
+.L14:
+	#instruction start "195 = constant(0)":
+	movl $0, %ebx
+	#instruction start "196 = set_reg %rax 195":
+	#instruction start "197 = phi (region: 156) 147 193":
+	#instruction start "198 = return 156, 196, 197":
+	movq %rbx, %rax
+	#Block return.
+	movq -356(%rbp), %rbx
+	movq -364(%rbp), %r12
+	movq -372(%rbp), %r13
+	movq -380(%rbp), %r14
+	movq -388(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "a != b\000"
+.Ls2:
+	.string "tests/integer_constants.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "b == 0x3f\000"
+.Ls5:
+	.string "c == 5\000"
+.Ls6:
+	.string "~x == 0xffffffffffffffff\000"
@@ -0,0 +1,1566 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $1392, %rsp
+	movq %rbx, -1360(%rbp)
+	movq %r12, -1368(%rbp)
+	movq %r13, -1376(%rbp)
+	movq %r14, -1384(%rbp)
+	movq %r15, -1392(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(1)":
+	movl $1, %ebx
+	#instruction start "8 = if 2 6":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "11 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "12 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "13 = constant(22)":
+	movl $22, %r13d
+	#instruction start "14 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "15 = alloc with size 8":
+	leaq -912(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "16 = store 15 11, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "17 = alloc with size 8":
+	leaq -920(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "18 = store 17 12, state: 16":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "19 = alloc with size 4":
+	leaq -924(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "20 = store 19 13, state: 18":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "21 = alloc with size 8":
+	leaq -932(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "22 = store 21 14, state: 20":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "23 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "24 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "25 = load part address of 15 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "26 = proj0 25":
+	#instruction start "27 = proj1 25":
+	#instruction start "28 = load part address of 17 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "29 = proj0 28":
+	#instruction start "30 = proj1 28":
+	#instruction start "31 = load part address of 19 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "32 = proj0 31":
+	#instruction start "33 = proj1 31":
+	#instruction start "34 = load part address of 21 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "35 = proj0 34":
+	#instruction start "36 = proj1 34":
+	#instruction start "37 = allocate_call_stack 0":
+	#instruction start "38 = set_reg %rdi 27":
+	#instruction start "39 = set_reg %rsi 30 state: 38":
+	#instruction start "40 = set_reg %rdx 33 state: 39":
+	#instruction start "41 = set_reg %rcx 36 state: 40":
+	#instruction start "42 = set_reg %rax 24 state: 41":
+	#instruction start "43 = call 23":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "44 = proj0 43":
+	#instruction start "45 = proj1 43":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "46 = constant(1)":
+	movl $1, %ebx
+	#instruction start "48 = if 7 46":
+	#instruction start "56 = phi (region: 7) 3 44":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "51 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "52 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "53 = constant(23)":
+	movl $23, %r13d
+	#instruction start "54 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "55 = alloc with size 8":
+	leaq -940(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "57 = store 55 51, state: 56":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "58 = alloc with size 8":
+	leaq -948(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "59 = store 58 52, state: 57":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "60 = alloc with size 4":
+	leaq -952(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "61 = store 60 53, state: 59":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "62 = alloc with size 8":
+	leaq -960(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "63 = store 62 54, state: 61":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "64 = constant(0)":
+	leaq -64(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "65 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "66 = load part address of 55 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "67 = proj0 66":
+	#instruction start "68 = proj1 66":
+	#instruction start "69 = load part address of 58 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "70 = proj0 69":
+	#instruction start "71 = proj1 69":
+	#instruction start "72 = load part address of 60 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "73 = proj0 72":
+	#instruction start "74 = proj1 72":
+	#instruction start "75 = load part address of 62 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "76 = proj0 75":
+	#instruction start "77 = proj1 75":
+	#instruction start "78 = allocate_call_stack 0":
+	#instruction start "79 = set_reg %rdi 68":
+	#instruction start "80 = set_reg %rsi 71 state: 79":
+	#instruction start "81 = set_reg %rdx 74 state: 80":
+	#instruction start "82 = set_reg %rcx 77 state: 81":
+	#instruction start "83 = set_reg %rax 65 state: 82":
+	#instruction start "84 = call 64":
+	addq $0, %rsp
+	movq -72(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -64(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "85 = proj0 84":
+	#instruction start "86 = proj1 84":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "87 = constant(1)":
+	movl $1, %ebx
+	#instruction start "89 = if 47 87":
+	#instruction start "97 = phi (region: 47) 56 85":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "92 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "93 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "94 = constant(24)":
+	movl $24, %r13d
+	#instruction start "95 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "96 = alloc with size 8":
+	leaq -968(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "98 = store 96 92, state: 97":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "99 = alloc with size 8":
+	leaq -976(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "100 = store 99 93, state: 98":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "101 = alloc with size 4":
+	leaq -980(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "102 = store 101 94, state: 100":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "103 = alloc with size 8":
+	leaq -988(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "104 = store 103 95, state: 102":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "105 = constant(0)":
+	leaq -120(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "106 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "107 = load part address of 96 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "108 = proj0 107":
+	#instruction start "109 = proj1 107":
+	#instruction start "110 = load part address of 99 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "111 = proj0 110":
+	#instruction start "112 = proj1 110":
+	#instruction start "113 = load part address of 101 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "114 = proj0 113":
+	#instruction start "115 = proj1 113":
+	#instruction start "116 = load part address of 103 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "117 = proj0 116":
+	#instruction start "118 = proj1 116":
+	#instruction start "119 = allocate_call_stack 0":
+	#instruction start "120 = set_reg %rdi 109":
+	#instruction start "121 = set_reg %rsi 112 state: 120":
+	#instruction start "122 = set_reg %rdx 115 state: 121":
+	#instruction start "123 = set_reg %rcx 118 state: 122":
+	#instruction start "124 = set_reg %rax 106 state: 123":
+	#instruction start "125 = call 105":
+	addq $0, %rsp
+	movq -128(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -120(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "126 = proj0 125":
+	#instruction start "127 = proj1 125":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "128 = constant(1)":
+	movl $1, %ebx
+	#instruction start "130 = if 88 128":
+	#instruction start "138 = phi (region: 88) 97 126":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "133 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "134 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "135 = constant(25)":
+	movl $25, %r13d
+	#instruction start "136 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "137 = alloc with size 8":
+	leaq -996(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "139 = store 137 133, state: 138":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "140 = alloc with size 8":
+	leaq -1004(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "141 = store 140 134, state: 139":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "142 = alloc with size 4":
+	leaq -1008(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "143 = store 142 135, state: 141":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "144 = alloc with size 8":
+	leaq -1016(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "145 = store 144 136, state: 143":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "146 = constant(0)":
+	leaq -176(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "147 = constant(0)":
+	leaq -184(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "148 = load part address of 137 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "149 = proj0 148":
+	#instruction start "150 = proj1 148":
+	#instruction start "151 = load part address of 140 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "152 = proj0 151":
+	#instruction start "153 = proj1 151":
+	#instruction start "154 = load part address of 142 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "155 = proj0 154":
+	#instruction start "156 = proj1 154":
+	#instruction start "157 = load part address of 144 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "158 = proj0 157":
+	#instruction start "159 = proj1 157":
+	#instruction start "160 = allocate_call_stack 0":
+	#instruction start "161 = set_reg %rdi 150":
+	#instruction start "162 = set_reg %rsi 153 state: 161":
+	#instruction start "163 = set_reg %rdx 156 state: 162":
+	#instruction start "164 = set_reg %rcx 159 state: 163":
+	#instruction start "165 = set_reg %rax 147 state: 164":
+	#instruction start "166 = call 146":
+	addq $0, %rsp
+	movq -184(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -176(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "167 = proj0 166":
+	#instruction start "168 = proj1 166":
+	#Block jump
+	jmp .L14
+.L13:
+	#Block jump elided
+.L14:
+	#instruction start "169 = constant(1)":
+	movl $1, %ebx
+	#instruction start "171 = if 129 169":
+	#instruction start "179 = phi (region: 129) 138 167":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#instruction start "174 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "175 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "176 = constant(26)":
+	movl $26, %r13d
+	#instruction start "177 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "178 = alloc with size 8":
+	leaq -1024(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "180 = store 178 174, state: 179":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "181 = alloc with size 8":
+	leaq -1032(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "182 = store 181 175, state: 180":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "183 = alloc with size 4":
+	leaq -1036(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "184 = store 183 176, state: 182":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "185 = alloc with size 8":
+	leaq -1044(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "186 = store 185 177, state: 184":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "187 = constant(0)":
+	leaq -232(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "188 = constant(0)":
+	leaq -240(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "189 = load part address of 178 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "190 = proj0 189":
+	#instruction start "191 = proj1 189":
+	#instruction start "192 = load part address of 181 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "193 = proj0 192":
+	#instruction start "194 = proj1 192":
+	#instruction start "195 = load part address of 183 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "196 = proj0 195":
+	#instruction start "197 = proj1 195":
+	#instruction start "198 = load part address of 185 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "199 = proj0 198":
+	#instruction start "200 = proj1 198":
+	#instruction start "201 = allocate_call_stack 0":
+	#instruction start "202 = set_reg %rdi 191":
+	#instruction start "203 = set_reg %rsi 194 state: 202":
+	#instruction start "204 = set_reg %rdx 197 state: 203":
+	#instruction start "205 = set_reg %rcx 200 state: 204":
+	#instruction start "206 = set_reg %rax 188 state: 205":
+	#instruction start "207 = call 187":
+	addq $0, %rsp
+	movq -240(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -232(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "208 = proj0 207":
+	#instruction start "209 = proj1 207":
+	#Block jump
+	jmp .L17
+.L16:
+	#Block jump elided
+.L17:
+	#instruction start "210 = constant(1)":
+	movl $1, %ebx
+	#instruction start "212 = if 170 210":
+	#instruction start "220 = phi (region: 170) 179 208":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "215 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "216 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "217 = constant(27)":
+	movl $27, %r13d
+	#instruction start "218 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "219 = alloc with size 8":
+	leaq -1052(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "221 = store 219 215, state: 220":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "222 = alloc with size 8":
+	leaq -1060(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "223 = store 222 216, state: 221":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "224 = alloc with size 4":
+	leaq -1064(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "225 = store 224 217, state: 223":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "226 = alloc with size 8":
+	leaq -1072(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "227 = store 226 218, state: 225":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "228 = constant(0)":
+	leaq -288(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "229 = constant(0)":
+	leaq -296(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "230 = load part address of 219 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "231 = proj0 230":
+	#instruction start "232 = proj1 230":
+	#instruction start "233 = load part address of 222 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "234 = proj0 233":
+	#instruction start "235 = proj1 233":
+	#instruction start "236 = load part address of 224 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "237 = proj0 236":
+	#instruction start "238 = proj1 236":
+	#instruction start "239 = load part address of 226 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "240 = proj0 239":
+	#instruction start "241 = proj1 239":
+	#instruction start "242 = allocate_call_stack 0":
+	#instruction start "243 = set_reg %rdi 232":
+	#instruction start "244 = set_reg %rsi 235 state: 243":
+	#instruction start "245 = set_reg %rdx 238 state: 244":
+	#instruction start "246 = set_reg %rcx 241 state: 245":
+	#instruction start "247 = set_reg %rax 229 state: 246":
+	#instruction start "248 = call 228":
+	addq $0, %rsp
+	movq -296(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -288(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "249 = proj0 248":
+	#instruction start "250 = proj1 248":
+	#Block jump
+	jmp .L20
+.L19:
+	#Block jump elided
+.L20:
+	#instruction start "251 = constant(1)":
+	movl $1, %ebx
+	#instruction start "253 = if 211 251":
+	#instruction start "261 = phi (region: 211) 220 249":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "256 = constant(9)":
+	movq $.Ls9, %rbx
+	#instruction start "257 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "258 = constant(28)":
+	movl $28, %r13d
+	#instruction start "259 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "260 = alloc with size 8":
+	leaq -1080(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "262 = store 260 256, state: 261":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "263 = alloc with size 8":
+	leaq -1088(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "264 = store 263 257, state: 262":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "265 = alloc with size 4":
+	leaq -1092(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "266 = store 265 258, state: 264":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "267 = alloc with size 8":
+	leaq -1100(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "268 = store 267 259, state: 266":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "269 = constant(0)":
+	leaq -344(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "270 = constant(0)":
+	leaq -352(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "271 = load part address of 260 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "272 = proj0 271":
+	#instruction start "273 = proj1 271":
+	#instruction start "274 = load part address of 263 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "275 = proj0 274":
+	#instruction start "276 = proj1 274":
+	#instruction start "277 = load part address of 265 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "278 = proj0 277":
+	#instruction start "279 = proj1 277":
+	#instruction start "280 = load part address of 267 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "281 = proj0 280":
+	#instruction start "282 = proj1 280":
+	#instruction start "283 = allocate_call_stack 0":
+	#instruction start "284 = set_reg %rdi 273":
+	#instruction start "285 = set_reg %rsi 276 state: 284":
+	#instruction start "286 = set_reg %rdx 279 state: 285":
+	#instruction start "287 = set_reg %rcx 282 state: 286":
+	#instruction start "288 = set_reg %rax 270 state: 287":
+	#instruction start "289 = call 269":
+	addq $0, %rsp
+	movq -352(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -344(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "290 = proj0 289":
+	#instruction start "291 = proj1 289":
+	#Block jump
+	jmp .L23
+.L22:
+	#Block jump elided
+.L23:
+	#instruction start "292 = constant(1)":
+	movl $1, %ebx
+	#instruction start "294 = if 252 292":
+	#instruction start "302 = phi (region: 252) 261 290":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L25
+.L24:
+	#instruction start "297 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "298 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "299 = constant(29)":
+	movl $29, %r13d
+	#instruction start "300 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "301 = alloc with size 8":
+	leaq -1108(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "303 = store 301 297, state: 302":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "304 = alloc with size 8":
+	leaq -1116(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "305 = store 304 298, state: 303":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "306 = alloc with size 4":
+	leaq -1120(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "307 = store 306 299, state: 305":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "308 = alloc with size 8":
+	leaq -1128(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "309 = store 308 300, state: 307":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "310 = constant(0)":
+	leaq -400(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "311 = constant(0)":
+	leaq -408(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "312 = load part address of 301 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "313 = proj0 312":
+	#instruction start "314 = proj1 312":
+	#instruction start "315 = load part address of 304 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "316 = proj0 315":
+	#instruction start "317 = proj1 315":
+	#instruction start "318 = load part address of 306 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "319 = proj0 318":
+	#instruction start "320 = proj1 318":
+	#instruction start "321 = load part address of 308 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "322 = proj0 321":
+	#instruction start "323 = proj1 321":
+	#instruction start "324 = allocate_call_stack 0":
+	#instruction start "325 = set_reg %rdi 314":
+	#instruction start "326 = set_reg %rsi 317 state: 325":
+	#instruction start "327 = set_reg %rdx 320 state: 326":
+	#instruction start "328 = set_reg %rcx 323 state: 327":
+	#instruction start "329 = set_reg %rax 311 state: 328":
+	#instruction start "330 = call 310":
+	addq $0, %rsp
+	movq -408(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -400(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "331 = proj0 330":
+	#instruction start "332 = proj1 330":
+	#Block jump
+	jmp .L26
+.L25:
+	#Block jump elided
+.L26:
+	#instruction start "333 = constant(1)":
+	movl $1, %ebx
+	#instruction start "335 = if 293 333":
+	#instruction start "343 = phi (region: 293) 302 331":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L28
+.L27:
+	#instruction start "338 = constant(11)":
+	movq $.Ls11, %rbx
+	#instruction start "339 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "340 = constant(30)":
+	movl $30, %r13d
+	#instruction start "341 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "342 = alloc with size 8":
+	leaq -1136(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "344 = store 342 338, state: 343":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "345 = alloc with size 8":
+	leaq -1144(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "346 = store 345 339, state: 344":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "347 = alloc with size 4":
+	leaq -1148(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "348 = store 347 340, state: 346":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "349 = alloc with size 8":
+	leaq -1156(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "350 = store 349 341, state: 348":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "351 = constant(0)":
+	leaq -456(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "352 = constant(0)":
+	leaq -464(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "353 = load part address of 342 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "354 = proj0 353":
+	#instruction start "355 = proj1 353":
+	#instruction start "356 = load part address of 345 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "357 = proj0 356":
+	#instruction start "358 = proj1 356":
+	#instruction start "359 = load part address of 347 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "360 = proj0 359":
+	#instruction start "361 = proj1 359":
+	#instruction start "362 = load part address of 349 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "363 = proj0 362":
+	#instruction start "364 = proj1 362":
+	#instruction start "365 = allocate_call_stack 0":
+	#instruction start "366 = set_reg %rdi 355":
+	#instruction start "367 = set_reg %rsi 358 state: 366":
+	#instruction start "368 = set_reg %rdx 361 state: 367":
+	#instruction start "369 = set_reg %rcx 364 state: 368":
+	#instruction start "370 = set_reg %rax 352 state: 369":
+	#instruction start "371 = call 351":
+	addq $0, %rsp
+	movq -464(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -456(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "372 = proj0 371":
+	#instruction start "373 = proj1 371":
+	#Block jump
+	jmp .L29
+.L28:
+	#Block jump elided
+.L29:
+	#instruction start "374 = constant(1)":
+	movl $1, %ebx
+	#instruction start "376 = if 334 374":
+	#instruction start "384 = phi (region: 334) 343 372":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L31
+.L30:
+	#instruction start "379 = constant(12)":
+	movq $.Ls12, %rbx
+	#instruction start "380 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "381 = constant(31)":
+	movl $31, %r13d
+	#instruction start "382 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "383 = alloc with size 8":
+	leaq -1164(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "385 = store 383 379, state: 384":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "386 = alloc with size 8":
+	leaq -1172(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "387 = store 386 380, state: 385":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "388 = alloc with size 4":
+	leaq -1176(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "389 = store 388 381, state: 387":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "390 = alloc with size 8":
+	leaq -1184(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "391 = store 390 382, state: 389":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "392 = constant(0)":
+	leaq -512(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "393 = constant(0)":
+	leaq -520(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "394 = load part address of 383 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "395 = proj0 394":
+	#instruction start "396 = proj1 394":
+	#instruction start "397 = load part address of 386 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "398 = proj0 397":
+	#instruction start "399 = proj1 397":
+	#instruction start "400 = load part address of 388 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "401 = proj0 400":
+	#instruction start "402 = proj1 400":
+	#instruction start "403 = load part address of 390 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "404 = proj0 403":
+	#instruction start "405 = proj1 403":
+	#instruction start "406 = allocate_call_stack 0":
+	#instruction start "407 = set_reg %rdi 396":
+	#instruction start "408 = set_reg %rsi 399 state: 407":
+	#instruction start "409 = set_reg %rdx 402 state: 408":
+	#instruction start "410 = set_reg %rcx 405 state: 409":
+	#instruction start "411 = set_reg %rax 393 state: 410":
+	#instruction start "412 = call 392":
+	addq $0, %rsp
+	movq -520(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -512(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "413 = proj0 412":
+	#instruction start "414 = proj1 412":
+	#Block jump
+	jmp .L32
+.L31:
+	#Block jump elided
+.L32:
+	#instruction start "415 = constant(1)":
+	movl $1, %ebx
+	#instruction start "417 = if 375 415":
+	#instruction start "425 = phi (region: 375) 384 413":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L34
+.L33:
+	#instruction start "420 = constant(13)":
+	movq $.Ls13, %rbx
+	#instruction start "421 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "422 = constant(32)":
+	movl $32, %r13d
+	#instruction start "423 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "424 = alloc with size 8":
+	leaq -1192(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "426 = store 424 420, state: 425":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "427 = alloc with size 8":
+	leaq -1200(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "428 = store 427 421, state: 426":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "429 = alloc with size 4":
+	leaq -1204(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "430 = store 429 422, state: 428":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "431 = alloc with size 8":
+	leaq -1212(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "432 = store 431 423, state: 430":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "433 = constant(0)":
+	leaq -568(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "434 = constant(0)":
+	leaq -576(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "435 = load part address of 424 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "436 = proj0 435":
+	#instruction start "437 = proj1 435":
+	#instruction start "438 = load part address of 427 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "439 = proj0 438":
+	#instruction start "440 = proj1 438":
+	#instruction start "441 = load part address of 429 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "442 = proj0 441":
+	#instruction start "443 = proj1 441":
+	#instruction start "444 = load part address of 431 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "445 = proj0 444":
+	#instruction start "446 = proj1 444":
+	#instruction start "447 = allocate_call_stack 0":
+	#instruction start "448 = set_reg %rdi 437":
+	#instruction start "449 = set_reg %rsi 440 state: 448":
+	#instruction start "450 = set_reg %rdx 443 state: 449":
+	#instruction start "451 = set_reg %rcx 446 state: 450":
+	#instruction start "452 = set_reg %rax 434 state: 451":
+	#instruction start "453 = call 433":
+	addq $0, %rsp
+	movq -576(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -568(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "454 = proj0 453":
+	#instruction start "455 = proj1 453":
+	#Block jump
+	jmp .L35
+.L34:
+	#Block jump elided
+.L35:
+	#instruction start "456 = constant(1)":
+	movl $1, %ebx
+	#instruction start "458 = if 416 456":
+	#instruction start "466 = phi (region: 416) 425 454":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L37
+.L36:
+	#instruction start "461 = constant(14)":
+	movq $.Ls14, %rbx
+	#instruction start "462 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "463 = constant(33)":
+	movl $33, %r13d
+	#instruction start "464 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "465 = alloc with size 8":
+	leaq -1220(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "467 = store 465 461, state: 466":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "468 = alloc with size 8":
+	leaq -1228(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "469 = store 468 462, state: 467":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "470 = alloc with size 4":
+	leaq -1232(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "471 = store 470 463, state: 469":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "472 = alloc with size 8":
+	leaq -1240(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "473 = store 472 464, state: 471":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "474 = constant(0)":
+	leaq -624(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "475 = constant(0)":
+	leaq -632(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "476 = load part address of 465 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "477 = proj0 476":
+	#instruction start "478 = proj1 476":
+	#instruction start "479 = load part address of 468 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "480 = proj0 479":
+	#instruction start "481 = proj1 479":
+	#instruction start "482 = load part address of 470 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "483 = proj0 482":
+	#instruction start "484 = proj1 482":
+	#instruction start "485 = load part address of 472 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "486 = proj0 485":
+	#instruction start "487 = proj1 485":
+	#instruction start "488 = allocate_call_stack 0":
+	#instruction start "489 = set_reg %rdi 478":
+	#instruction start "490 = set_reg %rsi 481 state: 489":
+	#instruction start "491 = set_reg %rdx 484 state: 490":
+	#instruction start "492 = set_reg %rcx 487 state: 491":
+	#instruction start "493 = set_reg %rax 475 state: 492":
+	#instruction start "494 = call 474":
+	addq $0, %rsp
+	movq -632(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -624(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "495 = proj0 494":
+	#instruction start "496 = proj1 494":
+	#Block jump
+	jmp .L38
+.L37:
+	#Block jump elided
+.L38:
+	#instruction start "497 = constant(1)":
+	movl $1, %ebx
+	#instruction start "499 = if 457 497":
+	#instruction start "507 = phi (region: 457) 466 495":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L40
+.L39:
+	#instruction start "502 = constant(15)":
+	movq $.Ls15, %rbx
+	#instruction start "503 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "504 = constant(34)":
+	movl $34, %r13d
+	#instruction start "505 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "506 = alloc with size 8":
+	leaq -1248(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "508 = store 506 502, state: 507":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "509 = alloc with size 8":
+	leaq -1256(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "510 = store 509 503, state: 508":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "511 = alloc with size 4":
+	leaq -1260(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "512 = store 511 504, state: 510":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "513 = alloc with size 8":
+	leaq -1268(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "514 = store 513 505, state: 512":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "515 = constant(0)":
+	leaq -680(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "516 = constant(0)":
+	leaq -688(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "517 = load part address of 506 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "518 = proj0 517":
+	#instruction start "519 = proj1 517":
+	#instruction start "520 = load part address of 509 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "521 = proj0 520":
+	#instruction start "522 = proj1 520":
+	#instruction start "523 = load part address of 511 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "524 = proj0 523":
+	#instruction start "525 = proj1 523":
+	#instruction start "526 = load part address of 513 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "527 = proj0 526":
+	#instruction start "528 = proj1 526":
+	#instruction start "529 = allocate_call_stack 0":
+	#instruction start "530 = set_reg %rdi 519":
+	#instruction start "531 = set_reg %rsi 522 state: 530":
+	#instruction start "532 = set_reg %rdx 525 state: 531":
+	#instruction start "533 = set_reg %rcx 528 state: 532":
+	#instruction start "534 = set_reg %rax 516 state: 533":
+	#instruction start "535 = call 515":
+	addq $0, %rsp
+	movq -688(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -680(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "536 = proj0 535":
+	#instruction start "537 = proj1 535":
+	#Block jump
+	jmp .L41
+.L40:
+	#Block jump elided
+.L41:
+	#instruction start "538 = constant(1)":
+	movl $1, %ebx
+	#instruction start "540 = if 498 538":
+	#instruction start "548 = phi (region: 498) 507 536":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L43
+.L42:
+	#instruction start "543 = constant(16)":
+	movq $.Ls16, %rbx
+	#instruction start "544 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "545 = constant(35)":
+	movl $35, %r13d
+	#instruction start "546 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "547 = alloc with size 8":
+	leaq -1276(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "549 = store 547 543, state: 548":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "550 = alloc with size 8":
+	leaq -1284(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "551 = store 550 544, state: 549":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "552 = alloc with size 4":
+	leaq -1288(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "553 = store 552 545, state: 551":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "554 = alloc with size 8":
+	leaq -1296(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "555 = store 554 546, state: 553":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "556 = constant(0)":
+	leaq -736(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "557 = constant(0)":
+	leaq -744(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "558 = load part address of 547 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "559 = proj0 558":
+	#instruction start "560 = proj1 558":
+	#instruction start "561 = load part address of 550 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "562 = proj0 561":
+	#instruction start "563 = proj1 561":
+	#instruction start "564 = load part address of 552 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "565 = proj0 564":
+	#instruction start "566 = proj1 564":
+	#instruction start "567 = load part address of 554 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "568 = proj0 567":
+	#instruction start "569 = proj1 567":
+	#instruction start "570 = allocate_call_stack 0":
+	#instruction start "571 = set_reg %rdi 560":
+	#instruction start "572 = set_reg %rsi 563 state: 571":
+	#instruction start "573 = set_reg %rdx 566 state: 572":
+	#instruction start "574 = set_reg %rcx 569 state: 573":
+	#instruction start "575 = set_reg %rax 557 state: 574":
+	#instruction start "576 = call 556":
+	addq $0, %rsp
+	movq -744(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -736(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "577 = proj0 576":
+	#instruction start "578 = proj1 576":
+	#Block jump
+	jmp .L44
+.L43:
+	#Block jump elided
+.L44:
+	#instruction start "579 = constant(1)":
+	movl $1, %ebx
+	#instruction start "581 = if 539 579":
+	#instruction start "589 = phi (region: 539) 548 577":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L46
+.L45:
+	#instruction start "584 = constant(17)":
+	movq $.Ls17, %rbx
+	#instruction start "585 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "586 = constant(36)":
+	movl $36, %r13d
+	#instruction start "587 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "588 = alloc with size 8":
+	leaq -1304(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "590 = store 588 584, state: 589":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "591 = alloc with size 8":
+	leaq -1312(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "592 = store 591 585, state: 590":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "593 = alloc with size 4":
+	leaq -1316(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "594 = store 593 586, state: 592":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "595 = alloc with size 8":
+	leaq -1324(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "596 = store 595 587, state: 594":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "597 = constant(0)":
+	leaq -792(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "598 = constant(0)":
+	leaq -800(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "599 = load part address of 588 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "600 = proj0 599":
+	#instruction start "601 = proj1 599":
+	#instruction start "602 = load part address of 591 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "603 = proj0 602":
+	#instruction start "604 = proj1 602":
+	#instruction start "605 = load part address of 593 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "606 = proj0 605":
+	#instruction start "607 = proj1 605":
+	#instruction start "608 = load part address of 595 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "609 = proj0 608":
+	#instruction start "610 = proj1 608":
+	#instruction start "611 = allocate_call_stack 0":
+	#instruction start "612 = set_reg %rdi 601":
+	#instruction start "613 = set_reg %rsi 604 state: 612":
+	#instruction start "614 = set_reg %rdx 607 state: 613":
+	#instruction start "615 = set_reg %rcx 610 state: 614":
+	#instruction start "616 = set_reg %rax 598 state: 615":
+	#instruction start "617 = call 597":
+	addq $0, %rsp
+	movq -800(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -792(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "618 = proj0 617":
+	#instruction start "619 = proj1 617":
+	#Block jump
+	jmp .L47
+.L46:
+	#Block jump elided
+.L47:
+	#instruction start "620 = constant(1)":
+	movl $1, %ebx
+	#instruction start "622 = if 580 620":
+	#instruction start "630 = phi (region: 580) 589 618":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L49
+.L48:
+	#instruction start "625 = constant(18)":
+	movq $.Ls18, %rbx
+	#instruction start "626 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "627 = constant(37)":
+	movl $37, %r13d
+	#instruction start "628 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "629 = alloc with size 8":
+	leaq -1332(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "631 = store 629 625, state: 630":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "632 = alloc with size 8":
+	leaq -1340(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "633 = store 632 626, state: 631":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "634 = alloc with size 4":
+	leaq -1344(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "635 = store 634 627, state: 633":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "636 = alloc with size 8":
+	leaq -1352(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "637 = store 636 628, state: 635":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "638 = constant(0)":
+	leaq -848(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "639 = constant(0)":
+	leaq -856(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "640 = load part address of 629 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "641 = proj0 640":
+	#instruction start "642 = proj1 640":
+	#instruction start "643 = load part address of 632 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "644 = proj0 643":
+	#instruction start "645 = proj1 643":
+	#instruction start "646 = load part address of 634 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "647 = proj0 646":
+	#instruction start "648 = proj1 646":
+	#instruction start "649 = load part address of 636 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "650 = proj0 649":
+	#instruction start "651 = proj1 649":
+	#instruction start "652 = allocate_call_stack 0":
+	#instruction start "653 = set_reg %rdi 642":
+	#instruction start "654 = set_reg %rsi 645 state: 653":
+	#instruction start "655 = set_reg %rdx 648 state: 654":
+	#instruction start "656 = set_reg %rcx 651 state: 655":
+	#instruction start "657 = set_reg %rax 639 state: 656":
+	#instruction start "658 = call 638":
+	addq $0, %rsp
+	movq -856(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -848(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "659 = proj0 658":
+	#instruction start "660 = proj1 658":
+	#Block jump
+	jmp .L50
+.L49:
+	#Block jump elided
+.L50:
+	#instruction start "661 = constant(0)":
+	movl $0, %ebx
+	#instruction start "662 = set_reg %rax 661":
+	#instruction start "663 = phi (region: 621) 630 659":
+	#instruction start "664 = return 621, 662, 663":
+	movq %rbx, %rax
+	#Block return.
+	movq -1360(%rbp), %rbx
+	movq -1368(%rbp), %r12
+	movq -1376(%rbp), %r13
+	movq -1384(%rbp), %r14
+	movq -1392(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "CHAR_BIT == 8\000"
+.Ls2:
+	.string "tests/integer_sizes.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "SCHAR_MIN == -128\000"
+.Ls5:
+	.string "SCHAR_MAX == 127\000"
+.Ls6:
+	.string "UCHAR_MAX == 255\000"
+.Ls7:
+	.string "SHRT_MIN == -32768\000"
+.Ls8:
+	.string "SHRT_MAX == 32767\000"
+.Ls9:
+	.string "USHRT_MAX == 65535\000"
+.Ls10:
+	.string "INT_MIN == -2147483648\000"
+.Ls11:
+	.string "INT_MAX == 2147483647\000"
+.Ls12:
+	.string "UINT_MAX == -1\000"
+.Ls13:
+	.string "LONG_MIN == -9223372036854775807ll - 1\000"
+.Ls14:
+	.string "LONG_MAX == 9223372036854775807\000"
+.Ls15:
+	.string "ULONG_MAX == 18446744073709551615ul\000"
+.Ls16:
+	.string "LLONG_MIN == -9223372036854775807l - 1\000"
+.Ls17:
+	.string "LLONG_MAX == 9223372036854775807\000"
+.Ls18:
+	.string "ULLONG_MAX == 18446744073709551615ull\000"
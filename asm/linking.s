@@ -0,0 +1,189 @@
+.global f
+f:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -16(%rbp)
+	movq %r12, -24(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(0)":
+	movq $a, %rbx
+	#instruction start "7 = load_volatile 6, state: 3":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "8 = proj0 7":
+	#instruction start "9 = proj1 7":
+	#instruction start "10 = set_reg %rax 9":
+	#instruction start "11 = return 2, 10, 8":
+	movq %r12, %rax
+	#Block return.
+	movq -16(%rbp), %rbx
+	movq -24(%rbp), %r12
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rbx, -108(%rbp)
+	movq %r12, -116(%rbp)
+	movq %r13, -124(%rbp)
+	movq %r14, -132(%rbp)
+	movq %r15, -140(%rbp)
+.L3:
+	#instruction start "15 = proj3 13":
+	#instruction start "18 = constant(0)":
+	movq $a, %rbx
+	#instruction start "19 = constant(10)":
+	movl $10, %r12d
+	#instruction start "20 = store 18 19, state: 15":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "21 = constant(1)":
+	movq $f, %rbx
+	#instruction start "22 = constant(0)":
+	movq $0, %r12
+	#instruction start "23 = allocate_call_stack 0":
+	#instruction start "24 = set_reg %rax 22":
+	#instruction start "25 = call 21":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "26 = proj0 25":
+	#instruction start "27 = proj1 25":
+	#instruction start "28 = %rax":
+	#instruction start "29 = int_cast_zero 28":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "30 = constant(10)":
+	movl $10, %r12d
+	#instruction start "31 = 29 == 30":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "33 = if 14 31":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L5
+.L4:
+	#instruction start "36 = constant(3)":
+	movq $.Ls3, %rbx
+	#instruction start "37 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "38 = constant(13)":
+	movl $13, %r13d
+	#instruction start "39 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "40 = alloc with size 8":
+	leaq -80(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "41 = store 40 36, state: 26":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "42 = alloc with size 8":
+	leaq -88(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "43 = store 42 37, state: 41":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "44 = alloc with size 4":
+	leaq -92(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "45 = store 44 38, state: 43":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "46 = alloc with size 8":
+	leaq -100(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "47 = store 46 39, state: 45":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "48 = constant(2)":
+	leaq -16(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "49 = constant(0)":
+	leaq -24(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "50 = load part address of 40 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "51 = proj0 50":
+	#instruction start "52 = proj1 50":
+	#instruction start "53 = load part address of 42 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "54 = proj0 53":
+	#instruction start "55 = proj1 53":
+	#instruction start "56 = load part address of 44 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "57 = proj0 56":
+	#instruction start "58 = proj1 56":
+	#instruction start "59 = load part address of 46 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "60 = proj0 59":
+	#instruction start "61 = proj1 59":
+	#instruction start "62 = allocate_call_stack 0":
+	#instruction start "63 = set_reg %rdi 52":
+	#instruction start "64 = set_reg %rsi 55 state: 63":
+	#instruction start "65 = set_reg %rdx 58 state: 64":
+	#instruction start "66 = set_reg %rcx 61 state: 65":
+	#instruction start "67 = set_reg %rax 49 state: 66":
+	#instruction start "68 = call 48":
+	addq $0, %rsp
+	movq -24(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -16(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "69 = proj0 68":
+	#instruction start "70 = proj1 68":
+	#Block jump
+	jmp .L6
+.L5:
+	#Block jump elided
+.L6:
+	#instruction start "71 = constant(0)":
+	movl $0, %ebx
+	#instruction start "72 = set_reg %rax 71":
+	#instruction start "73 = phi (region: 32) 26 69":
+	#instruction start "74 = return 32, 72, 73":
+	movq %rbx, %rax
+	#Block return.
+	movq -108(%rbp), %rbx
+	movq -116(%rbp), %r12
+	movq -124(%rbp), %r13
+	movq -132(%rbp), %r14
+	movq -140(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls3:
+	.string "f() == 10\000"
+.Ls4:
+	.string "tests/linking.c\000"
+.Ls5:
+	.string "main"
+.section .data
+.align 4
+.global a
+a:
+.zero 4
+.section .text
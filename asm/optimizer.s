@@ -0,0 +1,1068 @@
+.global func
+func:
+	pushq %rbp
+	movq %rsp, %rbp
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = return 2, -1, 3":
+	#Block return.
+	leave 
+	ret 
+.global parse_struct
+parse_struct:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movq %rbx, -32(%rbp)
+	movq %r12, -40(%rbp)
+	movq %r13, -48(%rbp)
+.L3:
+	#instruction start "9 = proj3 7":
+	#instruction start "16 = constant(1)":
+	movl $1, %ebx
+	#instruction start "17 = if 8 16":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L5
+.L4:
+	#instruction start "14 = constant(0)":
+	movq $0, %rbx
+	#instruction start "29 = constant(0)":
+	movq $0, %r12
+	#instruction start "30 = 14 + 29":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "31 = load_volatile 30, state: 9":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "32 = proj0 31":
+	#instruction start "33 = proj1 31":
+	#instruction start "34 = set_reg %rax 33":
+	#instruction start "35 = return 18, 34, 32":
+	movq %rbx, %rax
+	#Block return.
+	movq -32(%rbp), %rbx
+	movq -40(%rbp), %r12
+	movq -48(%rbp), %r13
+	leave 
+	ret 
+.L5:
+	#instruction start "20 = constant(0)":
+	movq $func, %rbx
+	#instruction start "21 = constant(0)":
+	movq $0, %r12
+	#instruction start "22 = allocate_call_stack 0":
+	#instruction start "23 = set_reg %rax 21":
+	#instruction start "24 = call 20":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "25 = proj0 24":
+	#instruction start "26 = proj1 24":
+	#Block jump elided
+.L6:
+	#instruction start "37 = constant(0)":
+	movl $0, %ebx
+	#instruction start "38 = set_reg %rax 37":
+	#instruction start "39 = phi (region: 27) 25 40":
+	#instruction start "41 = return 27, 38, 39":
+	movq %rbx, %rax
+	#Block return.
+	movq -32(%rbp), %rbx
+	movq -40(%rbp), %r12
+	movq -48(%rbp), %r13
+	leave 
+	ret 
+.global test2
+test2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movq %rbx, -48(%rbp)
+	movq %r12, -56(%rbp)
+	movq %r13, -64(%rbp)
+	movq %r14, -72(%rbp)
+	movq %r15, -80(%rbp)
+.L7:
+	#instruction start "45 = proj3 43":
+	#instruction start "50 = constant(0)":
+	movl $0, %ebx
+	#instruction start "54 = constant(0)":
+	movq $0, %r12
+	#Phi node to 437 (56 50 439)
+	movq %rbx, %rax
+	movl %eax, -4(%rbp)
+	#Phi node to 441 (56 54 443)
+	movq %r12, %rax
+	movq %rax, -16(%rbp)
+	#Block jump elided
+.L8:
+	#instruction start "57 = phi (region: 56) 45 88":
+	#instruction start "59 = constant(1)":
+	movl $1, %ebx
+	#instruction start "437 = phi (region: 56) 50 439":
+	#instruction start "60 = 437 + 59":
+	movl -4(%rbp), %eax
+	movq %rbx, %rcx
+	addl %ecx, %eax
+	movl %eax, -8(%rbp)
+	#instruction start "441 = phi (region: 56) 54 443":
+	#instruction start "63 = if 56 441":
+	movq -16(%rbp), %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L9:
+	#instruction start "70 = constant(0)":
+	movl $0, %ebx
+	#instruction start "71 = 60 < 70 (signed)":
+	movl -8(%rbp), %eax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, %r15d
+	#instruction start "72 = if 64 71":
+	movq %r15, %rdi
+	testq %rdi, %rdi
+	jne .L11
+.L10:
+	#instruction start "78 = alloc with size 4":
+	leaq -32(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "79 = constant(0)":
+	movl $0, %r15d
+	#instruction start "80 = store 78 79, state: 57":
+	movq %rbx, %rsi
+	movl %r15d, (%rsi)
+	#Phi node to 82 (81 75 78)
+	movq %rbx, %rax
+	movq %rax, %r15
+	#Phi node to 440 (81 60 60)
+	movl -8(%rbp), %eax
+	movl %eax, %r13d
+	#Phi node to 444 (81 441 441)
+	movq -16(%rbp), %rax
+	movq %rax, %r14
+	#Block jump
+	jmp .L12
+.L11:
+	#instruction start "75 = alloc with size 4":
+	leaq -36(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "76 = constant(1)":
+	movl $1, %r12d
+	#instruction start "77 = store 75 76, state: 57":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 82 (81 75 78)
+	movq %rbx, %rax
+	movq %rax, %r15
+	#Phi node to 440 (81 60 60)
+	movl -8(%rbp), %eax
+	movl %eax, %r13d
+	#Phi node to 444 (81 441 441)
+	movq -16(%rbp), %rax
+	movq %rax, %r14
+	#Block jump elided
+.L12:
+	#instruction start "82 = phi (region: 81) 75 78":
+	#instruction start "86 = phi (region: 81) 77 80":
+	#instruction start "440 = phi (region: 81) 60 60":
+	#instruction start "444 = phi (region: 81) 441 441":
+	#Phi node to 84 (83 66 82)
+	movq %r15, %rax
+	movq %rax, %rbx
+	#Phi node to 439 (83 60 440)
+	movq %r13, %rax
+	movl %eax, -20(%rbp)
+	#Phi node to 443 (83 441 444)
+	movq %r14, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L14
+.L13:
+	#instruction start "66 = alloc with size 4":
+	leaq -40(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "67 = constant(1)":
+	movl $1, %r14d
+	#instruction start "68 = store 66 67, state: 57":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 84 (83 66 82)
+	movq %r13, %rax
+	movq %rax, %rbx
+	#Phi node to 439 (83 60 440)
+	movl -8(%rbp), %eax
+	movl %eax, -20(%rbp)
+	#Phi node to 443 (83 441 444)
+	movq -16(%rbp), %rax
+	movq %rax, %r12
+	#Block jump elided
+.L14:
+	#instruction start "84 = phi (region: 83) 66 82":
+	#instruction start "85 = phi (region: 83) 68 86":
+	#instruction start "87 = load_volatile 84, state: 85":
+	movq %rbx, %rdi
+	movl (%rdi), %r13d
+	#instruction start "88 = proj0 87":
+	#instruction start "89 = proj1 87":
+	#instruction start "90 = if 83 89":
+	#instruction start "439 = phi (region: 83) 60 440":
+	#instruction start "443 = phi (region: 83) 441 444":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L17
+.L15:
+	#Phi node to 445 (96 446 443)
+	movq %r12, %rax
+	movq %rax, %rbx
+	#Block jump elided
+.L16:
+	#instruction start "97 = phi (region: 96) 98 88":
+	#instruction start "445 = phi (region: 96) 446 443":
+	#instruction start "100 = int_cast_zero 445":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "101 = set_reg %rax 100":
+	#instruction start "102 = return 96, 101, 97":
+	movq %r13, %rax
+	#Block return.
+	movq -48(%rbp), %rbx
+	movq -56(%rbp), %r12
+	movq -64(%rbp), %r13
+	movq -72(%rbp), %r14
+	movq -80(%rbp), %r15
+	leave 
+	ret 
+.L17:
+	#Block jump elided
+.L18:
+	#Phi node to 437 (56 50 439)
+	movl -20(%rbp), %eax
+	movl %eax, -4(%rbp)
+	#Phi node to 441 (56 54 443)
+	movq %r12, %rax
+	movq %rax, -16(%rbp)
+	#Block jump
+	jmp .L8
+type_search_member2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -16(%rbp)
+	movq %r12, -24(%rbp)
+	movq %rdi, %rbx
+.L19:
+	#instruction start "106 = proj3 104":
+	#instruction start "107 = proj1 104":
+	#instruction start "109 = %rdi":
+	#instruction start "110 = alloc with size 8":
+	leaq -8(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "111 = store part of 110 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "112 = load 110, state: 111":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "113 = constant(10)":
+	movq $10, %r12
+	#instruction start "114 = store 112 113, state: 111":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "115 = return 105, -1, 114":
+	#Block return.
+	movq -16(%rbp), %rbx
+	movq -24(%rbp), %r12
+	leave 
+	ret 
+.global test3
+test3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movq %rbx, -124(%rbp)
+	movq %r12, -132(%rbp)
+	movq %r13, -140(%rbp)
+	movq %r14, -148(%rbp)
+	movq %r15, -156(%rbp)
+.L20:
+	#instruction start "118 = proj3 116":
+	#instruction start "121 = alloc with size 8":
+	leaq -80(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "122 = alloc with size 8":
+	leaq -88(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "123 = store 122 121, state: 118":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "124 = constant(1)":
+	movq $type_search_member2, %r13
+	#instruction start "125 = constant(0)":
+	movq $0, %r14
+	#instruction start "126 = load part address of 122 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "127 = proj0 126":
+	#instruction start "128 = proj1 126":
+	#instruction start "129 = allocate_call_stack 0":
+	#instruction start "130 = set_reg %rdi 128":
+	#instruction start "131 = set_reg %rax 125 state: 130":
+	#instruction start "132 = call 124":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r15, %rdi
+	movq %r13, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "133 = proj0 132":
+	#instruction start "134 = proj1 132":
+	#instruction start "135 = load 121, state: 133":
+	movq %rbx, %rdi
+	movq (%rdi), %r12
+	#instruction start "136 = constant(10)":
+	movq $10, %rbx
+	#instruction start "137 = 135 == 136":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "139 = if 117 137":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "142 = constant(3)":
+	movq $.Ls3, %rbx
+	#instruction start "143 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "144 = constant(46)":
+	movl $46, %r13d
+	#instruction start "145 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "146 = alloc with size 8":
+	leaq -96(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "147 = store 146 142, state: 133":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "148 = alloc with size 8":
+	leaq -104(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "149 = store 148 143, state: 147":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "150 = alloc with size 4":
+	leaq -108(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "151 = store 150 144, state: 149":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "152 = alloc with size 8":
+	leaq -116(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "153 = store 152 145, state: 151":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "154 = constant(2)":
+	leaq -24(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "155 = constant(0)":
+	leaq -32(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "156 = load part address of 146 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "157 = proj0 156":
+	#instruction start "158 = proj1 156":
+	#instruction start "159 = load part address of 148 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "160 = proj0 159":
+	#instruction start "161 = proj1 159":
+	#instruction start "162 = load part address of 150 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "163 = proj0 162":
+	#instruction start "164 = proj1 162":
+	#instruction start "165 = load part address of 152 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "166 = proj0 165":
+	#instruction start "167 = proj1 165":
+	#instruction start "168 = allocate_call_stack 0":
+	#instruction start "169 = set_reg %rdi 158":
+	#instruction start "170 = set_reg %rsi 161 state: 169":
+	#instruction start "171 = set_reg %rdx 164 state: 170":
+	#instruction start "172 = set_reg %rcx 167 state: 171":
+	#instruction start "173 = set_reg %rax 155 state: 172":
+	#instruction start "174 = call 154":
+	addq $0, %rsp
+	movq -32(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -24(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "175 = proj0 174":
+	#instruction start "176 = proj1 174":
+	#Block jump
+	jmp .L23
+.L22:
+	#Block jump elided
+.L23:
+	#instruction start "177 = phi (region: 138) 133 175":
+	#instruction start "178 = return 138, -1, 177":
+	#Block return.
+	movq -124(%rbp), %rbx
+	movq -132(%rbp), %r12
+	movq -140(%rbp), %r13
+	movq -148(%rbp), %r14
+	movq -156(%rbp), %r15
+	leave 
+	ret 
+get_ptr:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rbx, -16(%rbp)
+.L24:
+	#instruction start "181 = proj3 179":
+	#instruction start "184 = constant(6)":
+	movq $.LVAR0def, %rbx
+	#instruction start "185 = set_reg %rax 184":
+	#instruction start "186 = return 180, 185, 181":
+	movq %rbx, %rax
+	#Block return.
+	movq -16(%rbp), %rbx
+	leave 
+	ret 
+.global define_map_add2
+define_map_add2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -28(%rbp)
+	movq %r12, -36(%rbp)
+	movq %r13, -44(%rbp)
+	movq %r14, -52(%rbp)
+	movl %edi, %ebx
+.L25:
+	#instruction start "190 = proj3 188":
+	#instruction start "191 = proj1 188":
+	#instruction start "193 = %rdi":
+	#instruction start "194 = alloc with size 4":
+	leaq -20(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "195 = store part of 194 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "198 = constant(7)":
+	movq $get_ptr, %rbx
+	#instruction start "199 = constant(0)":
+	movq $0, %r13
+	#instruction start "200 = allocate_call_stack 0":
+	#instruction start "201 = set_reg %rax 199":
+	#instruction start "202 = call 198":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r14
+	#instruction start "203 = proj0 202":
+	#instruction start "204 = proj1 202":
+	#instruction start "205 = %rax":
+	#instruction start "206 = int_cast_zero 205":
+	movq %r14, %rax
+	movq %rax, %rbx
+	#instruction start "208 = load 194, state: 203":
+	movq %r12, %rdi
+	movl (%rdi), %r13d
+	#instruction start "209 = if 189 208":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L27
+.L26:
+	#Phi node to 447 (212 206 206)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L28
+.L27:
+	#Phi node to 447 (212 206 206)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L28:
+	#instruction start "213 = phi (region: 212) 203 203":
+	#instruction start "447 = phi (region: 212) 206 206":
+	#instruction start "215 = load_volatile 447, state: 213":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "216 = proj0 215":
+	#instruction start "217 = proj1 215":
+	#instruction start "218 = set_reg %rax 217":
+	#instruction start "219 = return 212, 218, 216":
+	movq %rbx, %rax
+	#Block return.
+	movq -28(%rbp), %rbx
+	movq -36(%rbp), %r12
+	movq -44(%rbp), %r13
+	movq -52(%rbp), %r14
+	leave 
+	ret 
+.global test4
+test4:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rbx, -112(%rbp)
+	movq %r12, -120(%rbp)
+	movq %r13, -128(%rbp)
+	movq %r14, -136(%rbp)
+	movq %r15, -144(%rbp)
+.L29:
+	#instruction start "223 = proj3 221":
+	#instruction start "226 = alloc with size 4":
+	leaq -76(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "227 = set_zero_ptr 226, size: 4":
+	movq %rbx, %rdi
+	movl $0, (%rdi)
+	#instruction start "228 = constant(0)":
+	movl $0, %r12d
+	#instruction start "229 = store 226 228, state: 227":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "230 = constant(8)":
+	movq $define_map_add2, %r12
+	#instruction start "231 = constant(0)":
+	movq $0, %r13
+	#instruction start "232 = load part address of 226 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "233 = proj0 232":
+	#instruction start "234 = proj1 232":
+	#instruction start "235 = allocate_call_stack 0":
+	#instruction start "236 = set_reg %rdi 234":
+	#instruction start "237 = set_reg %rax 231 state: 236":
+	#instruction start "238 = call 230":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "239 = proj0 238":
+	#instruction start "240 = proj1 238":
+	#instruction start "241 = %rax":
+	#instruction start "242 = int_cast_zero 241":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "243 = constant(10)":
+	movl $10, %ebx
+	#instruction start "244 = 242 == 243":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "246 = if 222 244":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L31
+.L30:
+	#instruction start "249 = constant(9)":
+	movq $.Ls9, %rbx
+	#instruction start "250 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "251 = constant(69)":
+	movl $69, %r13d
+	#instruction start "252 = constant(10)":
+	movq $.Ls10, %r14
+	#instruction start "253 = alloc with size 8":
+	leaq -84(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "254 = store 253 249, state: 239":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "255 = alloc with size 8":
+	leaq -92(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "256 = store 255 250, state: 254":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "257 = alloc with size 4":
+	leaq -96(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "258 = store 257 251, state: 256":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "259 = alloc with size 8":
+	leaq -104(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "260 = store 259 252, state: 258":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "261 = constant(2)":
+	leaq -24(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "262 = constant(0)":
+	leaq -32(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "263 = load part address of 253 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "264 = proj0 263":
+	#instruction start "265 = proj1 263":
+	#instruction start "266 = load part address of 255 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "267 = proj0 266":
+	#instruction start "268 = proj1 266":
+	#instruction start "269 = load part address of 257 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "270 = proj0 269":
+	#instruction start "271 = proj1 269":
+	#instruction start "272 = load part address of 259 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "273 = proj0 272":
+	#instruction start "274 = proj1 272":
+	#instruction start "275 = allocate_call_stack 0":
+	#instruction start "276 = set_reg %rdi 265":
+	#instruction start "277 = set_reg %rsi 268 state: 276":
+	#instruction start "278 = set_reg %rdx 271 state: 277":
+	#instruction start "279 = set_reg %rcx 274 state: 278":
+	#instruction start "280 = set_reg %rax 262 state: 279":
+	#instruction start "281 = call 261":
+	addq $0, %rsp
+	movq -32(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -24(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "282 = proj0 281":
+	#instruction start "283 = proj1 281":
+	#Block jump
+	jmp .L32
+.L31:
+	#Block jump elided
+.L32:
+	#instruction start "284 = phi (region: 245) 239 282":
+	#instruction start "285 = return 245, -1, 284":
+	#Block return.
+	movq -112(%rbp), %rbx
+	movq -120(%rbp), %r12
+	movq -128(%rbp), %r13
+	movq -136(%rbp), %r14
+	movq -144(%rbp), %r15
+	leave 
+	ret 
+.global escape_sequence_read2
+escape_sequence_read2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -24(%rbp)
+	movq %r12, -32(%rbp)
+	movq %r13, -40(%rbp)
+	movq %r14, -48(%rbp)
+	movq %r15, -56(%rbp)
+	movq %rdi, %rbx
+.L33:
+	#instruction start "288 = proj3 286":
+	#instruction start "289 = proj1 286":
+	#instruction start "291 = %rdi":
+	#instruction start "292 = alloc with size 8":
+	leaq -16(%rbp), %rsi
+	movq %rsi, -8(%rbp)
+	#instruction start "293 = store part of 292 with offset 0":
+	movq -8(%rbp), %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "296 = constant(11)":
+	movq $.Ls11, %rbx
+	#instruction start "300 = constant(0)":
+	movl $0, %r13d
+	#Phi node to 449 (303 296 449)
+	movq %rbx, %rax
+	movq %rax, %r14
+	#Phi node to 450 (303 300 321)
+	movq %r13, %rax
+	movl %eax, %r15d
+	#Block jump elided
+.L34:
+	#instruction start "305 = phi (region: 303) 293 318":
+	#instruction start "307 = constant(1)":
+	movl $1, %ebx
+	#instruction start "450 = phi (region: 303) 300 321":
+	#instruction start "308 = 450 < 307 (signed)":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "309 = if 303 308":
+	#instruction start "449 = phi (region: 303) 296 449":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L37
+.L35:
+	#Block jump elided
+.L36:
+	#instruction start "324 = load 292, state: 305":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %rbx
+	#instruction start "326 = store 324 450, state: 305":
+	movq %rbx, %rsi
+	movl %r15d, (%rsi)
+	#instruction start "327 = return 304, -1, 326":
+	#Block return.
+	movq -24(%rbp), %rbx
+	movq -32(%rbp), %r12
+	movq -40(%rbp), %r13
+	movq -48(%rbp), %r14
+	movq -56(%rbp), %r15
+	leave 
+	ret 
+.L37:
+	#Block jump elided
+.L38:
+	#instruction start "314 = constant(1)":
+	movl $1, %ebx
+	#instruction start "315 = 450 * 314 (signed)":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	imull %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "317 = load_volatile 449, state: 305":
+	movq %r14, %rdi
+	movzbl (%rdi), %ebx
+	#instruction start "318 = proj0 317":
+	#instruction start "319 = proj1 317":
+	#instruction start "320 = int_cast_zero 319":
+	movq %rbx, %rax
+	movsbq %al, %rax
+	movl %eax, %r12d
+	#instruction start "321 = 315 + 320":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %ebx
+	#Phi node to 449 (303 296 449)
+	movq %r14, %rax
+	movq %rax, %r14
+	#Phi node to 450 (303 300 321)
+	movq %rbx, %rax
+	movl %eax, %r15d
+	#Block jump
+	jmp .L34
+.global test5
+test5:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -36(%rbp)
+	movq %r12, -44(%rbp)
+	movq %r13, -52(%rbp)
+	movq %r14, -60(%rbp)
+.L39:
+	#instruction start "330 = proj3 328":
+	#instruction start "333 = alloc with size 4":
+	leaq -20(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "334 = alloc with size 8":
+	leaq -28(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "335 = store 334 333, state: 330":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "336 = constant(12)":
+	movq $escape_sequence_read2, %rbx
+	#instruction start "337 = constant(0)":
+	movq $0, %r13
+	#instruction start "338 = load part address of 334 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "339 = proj0 338":
+	#instruction start "340 = proj1 338":
+	#instruction start "341 = allocate_call_stack 0":
+	#instruction start "342 = set_reg %rdi 340":
+	#instruction start "343 = set_reg %rax 337 state: 342":
+	#instruction start "344 = call 336":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "345 = proj0 344":
+	#instruction start "346 = proj1 344":
+	#instruction start "347 = return 329, -1, 345":
+	#Block return.
+	movq -36(%rbp), %rbx
+	movq -44(%rbp), %r12
+	movq -52(%rbp), %r13
+	movq -60(%rbp), %r14
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $176, %rsp
+	movq %rbx, -140(%rbp)
+	movq %r12, -148(%rbp)
+	movq %r13, -156(%rbp)
+	movq %r14, -164(%rbp)
+	movq %r15, -172(%rbp)
+.L40:
+	#instruction start "350 = proj3 348":
+	#instruction start "353 = constant(13)":
+	movq $parse_struct, %rbx
+	#instruction start "354 = constant(0)":
+	movq $0, %r12
+	#instruction start "355 = allocate_call_stack 0":
+	#instruction start "356 = set_reg %rax 354":
+	#instruction start "357 = call 353":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "358 = proj0 357":
+	#instruction start "359 = proj1 357":
+	#instruction start "362 = constant(14)":
+	movq $test2, %rbx
+	#instruction start "363 = constant(0)":
+	movq $0, %r12
+	#instruction start "364 = allocate_call_stack 0":
+	#instruction start "365 = set_reg %rax 363":
+	#instruction start "366 = call 362":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "367 = proj0 366":
+	#instruction start "368 = proj1 366":
+	#instruction start "369 = %rax":
+	#instruction start "370 = int_cast_zero 369":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "371 = constant(0)":
+	movl $0, %r12d
+	#instruction start "372 = 370 == 371":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "374 = if 349 372":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L42
+.L41:
+	#instruction start "377 = constant(15)":
+	movq $.Ls15, %rbx
+	#instruction start "378 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "379 = constant(91)":
+	movl $91, %r13d
+	#instruction start "380 = constant(16)":
+	movq $.Ls16, %r14
+	#instruction start "381 = alloc with size 8":
+	leaq -112(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "382 = store 381 377, state: 367":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "383 = alloc with size 8":
+	leaq -120(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "384 = store 383 378, state: 382":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "385 = alloc with size 4":
+	leaq -124(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "386 = store 385 379, state: 384":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "387 = alloc with size 8":
+	leaq -132(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "388 = store 387 380, state: 386":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "389 = constant(2)":
+	leaq -24(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "390 = constant(0)":
+	leaq -32(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "391 = load part address of 381 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "392 = proj0 391":
+	#instruction start "393 = proj1 391":
+	#instruction start "394 = load part address of 383 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "395 = proj0 394":
+	#instruction start "396 = proj1 394":
+	#instruction start "397 = load part address of 385 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "398 = proj0 397":
+	#instruction start "399 = proj1 397":
+	#instruction start "400 = load part address of 387 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "401 = proj0 400":
+	#instruction start "402 = proj1 400":
+	#instruction start "403 = allocate_call_stack 0":
+	#instruction start "404 = set_reg %rdi 393":
+	#instruction start "405 = set_reg %rsi 396 state: 404":
+	#instruction start "406 = set_reg %rdx 399 state: 405":
+	#instruction start "407 = set_reg %rcx 402 state: 406":
+	#instruction start "408 = set_reg %rax 390 state: 407":
+	#instruction start "409 = call 389":
+	addq $0, %rsp
+	movq -32(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -24(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "410 = proj0 409":
+	#instruction start "411 = proj1 409":
+	#Block jump
+	jmp .L43
+.L42:
+	#Block jump elided
+.L43:
+	#instruction start "412 = constant(17)":
+	movq $test3, %rbx
+	#instruction start "413 = constant(0)":
+	movq $0, %r12
+	#instruction start "414 = allocate_call_stack 0":
+	#instruction start "415 = set_reg %rax 413":
+	#instruction start "416 = phi (region: 373) 367 410":
+	#instruction start "417 = call 412":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "418 = proj0 417":
+	#instruction start "419 = proj1 417":
+	#instruction start "420 = constant(18)":
+	movq $test4, %rbx
+	#instruction start "421 = constant(0)":
+	movq $0, %r12
+	#instruction start "422 = allocate_call_stack 0":
+	#instruction start "423 = set_reg %rax 421":
+	#instruction start "424 = call 420":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "425 = proj0 424":
+	#instruction start "426 = proj1 424":
+	#instruction start "427 = constant(19)":
+	movq $test5, %rbx
+	#instruction start "428 = constant(0)":
+	movq $0, %r12
+	#instruction start "429 = allocate_call_stack 0":
+	#instruction start "430 = set_reg %rax 428":
+	#instruction start "431 = call 427":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "432 = proj0 431":
+	#instruction start "433 = proj1 431":
+	#instruction start "434 = constant(0)":
+	movl $0, %ebx
+	#instruction start "435 = set_reg %rax 434":
+	#instruction start "436 = return 373, 435, 432":
+	movq %rbx, %rax
+	#Block return.
+	movq -140(%rbp), %rbx
+	movq -148(%rbp), %r12
+	movq -156(%rbp), %r13
+	movq -164(%rbp), %r14
+	movq -172(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls3:
+	.string "(void *)indices == (void *)10\000"
+.Ls4:
+	.string "tests/optimizer.c\000"
+.Ls5:
+	.string "test3"
+.Ls9:
+	.string "define_map_add2(def) == 10\000"
+.Ls10:
+	.string "test4"
+.Ls11:
+	.string "\\\000"
+.Ls15:
+	.string "test2() == 0\000"
+.Ls16:
+	.string "main"
+.section .data
+.align 4
+.LVAR0def:
+.byte 10
+.byte 0
+.byte 0
+.byte 0
+.section .text
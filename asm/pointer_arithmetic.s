@@ -0,0 +1,1500 @@
+__bswap_16:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movq %rbx, -18(%rbp)
+	movq %r12, -26(%rbp)
+	movq %r13, -34(%rbp)
+	movq %r14, -42(%rbp)
+	movzwl %di, %ebx
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = alloc with size 2":
+	leaq -10(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "8 = store part of 7 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movw %bx, (%rsi)
+	#instruction start "9 = load 7, state: 8":
+	movq %r12, %rdi
+	movzwl (%rdi), %ebx
+	#instruction start "10 = int_cast_zero 9":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "11 = constant(8)":
+	movl $8, %ebx
+	#instruction start "12 = 10 >> 11 (signed)":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	sarl %cl, %eax
+	movl %eax, %r14d
+	#instruction start "13 = constant(255)":
+	movl $255, %ebx
+	#instruction start "14 = 12 & 13":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	andl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "15 = load 7, state: 8":
+	movq %r12, %rdi
+	movzwl (%rdi), %ebx
+	#instruction start "16 = int_cast_zero 15":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "17 = constant(255)":
+	movl $255, %ebx
+	#instruction start "18 = 16 & 17":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	andl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "19 = constant(8)":
+	movl $8, %ebx
+	#instruction start "20 = 18 << 19":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	sall %cl, %eax
+	movl %eax, %r12d
+	#instruction start "21 = 14 | 20":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "22 = int_cast_zero 21":
+	movq %rbx, %rax
+	movzwl %ax, %r12d
+	#instruction start "23 = set_reg %rax 22":
+	#instruction start "24 = return 2, 23, 8":
+	movq %r12, %rax
+	#Block return.
+	movq -18(%rbp), %rbx
+	movq -26(%rbp), %r12
+	movq -34(%rbp), %r13
+	movq -42(%rbp), %r14
+	leave 
+	ret 
+__bswap_32:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movq %r13, -36(%rbp)
+	movq %r14, -44(%rbp)
+	movq %r15, -52(%rbp)
+	movl %edi, %ebx
+.L3:
+	#instruction start "28 = proj3 26":
+	#instruction start "29 = proj1 26":
+	#instruction start "31 = %rdi":
+	#instruction start "32 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "33 = store part of 32 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "34 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "35 = constant(4278190080)":
+	movl $4278190080, %r13d
+	#instruction start "36 = 34 & 35":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	andl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "37 = constant(24)":
+	movl $24, %ebx
+	#instruction start "38 = 36 >> 37":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	shrl %cl, %eax
+	movl %eax, %r13d
+	#instruction start "39 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "40 = constant(16711680)":
+	movl $16711680, %r14d
+	#instruction start "41 = 39 & 40":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andl %ecx, %eax
+	movl %eax, %r15d
+	#instruction start "42 = constant(8)":
+	movl $8, %ebx
+	#instruction start "43 = 41 >> 42":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	shrl %cl, %eax
+	movl %eax, %r14d
+	#instruction start "44 = 38 | 43":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "45 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %r13d
+	#instruction start "46 = constant(65280)":
+	movl $65280, %r14d
+	#instruction start "47 = 45 & 46":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andl %ecx, %eax
+	movl %eax, %r15d
+	#instruction start "48 = constant(8)":
+	movl $8, %r13d
+	#instruction start "49 = 47 << 48":
+	movq %r15, %rax
+	movq %r13, %rcx
+	sall %cl, %eax
+	movl %eax, %r14d
+	#instruction start "50 = 44 | 49":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "51 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "52 = constant(255)":
+	movl $255, %r12d
+	#instruction start "53 = 51 & 52":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	andl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "54 = constant(24)":
+	movl $24, %ebx
+	#instruction start "55 = 53 << 54":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	sall %cl, %eax
+	movl %eax, %r12d
+	#instruction start "56 = 50 | 55":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "57 = set_reg %rax 56":
+	#instruction start "58 = return 27, 57, 33":
+	movq %rbx, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	movq -36(%rbp), %r13
+	movq -44(%rbp), %r14
+	movq -52(%rbp), %r15
+	leave 
+	ret 
+__bswap_64:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -24(%rbp)
+	movq %r12, -32(%rbp)
+	movq %r13, -40(%rbp)
+	movq %r14, -48(%rbp)
+	movq %r15, -56(%rbp)
+	movq %rdi, %rbx
+.L4:
+	#instruction start "62 = proj3 60":
+	#instruction start "63 = proj1 60":
+	#instruction start "65 = %rdi":
+	#instruction start "66 = alloc with size 8":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "67 = store part of 66 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "68 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "69 = constant(-72057594037927936)":
+	movabsq $-72057594037927936, %r13
+	#instruction start "70 = 68 & 69":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "71 = constant(56)":
+	movq $56, %rbx
+	#instruction start "72 = 70 >> 71":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r13
+	#instruction start "73 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "74 = constant(71776119061217280)":
+	movabsq $71776119061217280, %r14
+	#instruction start "75 = 73 & 74":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "76 = constant(40)":
+	movq $40, %rbx
+	#instruction start "77 = 75 >> 76":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "78 = 72 | 77":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "79 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "80 = constant(280375465082880)":
+	movabsq $280375465082880, %r14
+	#instruction start "81 = 79 & 80":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "82 = constant(24)":
+	movq $24, %r13
+	#instruction start "83 = 81 >> 82":
+	movq %r15, %rax
+	movq %r13, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "84 = 78 | 83":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "85 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "86 = constant(1095216660480)":
+	movabsq $1095216660480, %r14
+	#instruction start "87 = 85 & 86":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "88 = constant(8)":
+	movq $8, %rbx
+	#instruction start "89 = 87 >> 88":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "90 = 84 | 89":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "91 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "92 = constant(4278190080)":
+	movabsq $4278190080, %r14
+	#instruction start "93 = 91 & 92":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "94 = constant(8)":
+	movq $8, %r13
+	#instruction start "95 = 93 << 94":
+	movq %r15, %rax
+	movq %r13, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "96 = 90 | 95":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "97 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "98 = constant(16711680)":
+	movq $16711680, %r14
+	#instruction start "99 = 97 & 98":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "100 = constant(24)":
+	movq $24, %rbx
+	#instruction start "101 = 99 << 100":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "102 = 96 | 101":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "103 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "104 = constant(65280)":
+	movq $65280, %r14
+	#instruction start "105 = 103 & 104":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "106 = constant(40)":
+	movq $40, %r13
+	#instruction start "107 = 105 << 106":
+	movq %r15, %rax
+	movq %r13, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "108 = 102 | 107":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "109 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "110 = constant(255)":
+	movq $255, %r12
+	#instruction start "111 = 109 & 110":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "112 = constant(56)":
+	movq $56, %rbx
+	#instruction start "113 = 111 << 112":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r12
+	#instruction start "114 = 108 | 113":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "115 = set_reg %rax 114":
+	#instruction start "116 = return 61, 115, 67":
+	movq %rbx, %rax
+	#Block return.
+	movq -24(%rbp), %rbx
+	movq -32(%rbp), %r12
+	movq -40(%rbp), %r13
+	movq -48(%rbp), %r14
+	movq -56(%rbp), %r15
+	leave 
+	ret 
+__uint16_identity:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -18(%rbp)
+	movq %r12, -26(%rbp)
+	movzwl %di, %ebx
+.L5:
+	#instruction start "120 = proj3 118":
+	#instruction start "121 = proj1 118":
+	#instruction start "123 = %rdi":
+	#instruction start "124 = alloc with size 2":
+	leaq -10(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "125 = store part of 124 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movw %bx, (%rsi)
+	#instruction start "126 = load 124, state: 125":
+	movq %r12, %rdi
+	movzwl (%rdi), %ebx
+	#instruction start "127 = set_reg %rax 126":
+	#instruction start "128 = return 119, 127, 125":
+	movq %rbx, %rax
+	#Block return.
+	movq -18(%rbp), %rbx
+	movq -26(%rbp), %r12
+	leave 
+	ret 
+__uint32_identity:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movl %edi, %ebx
+.L6:
+	#instruction start "132 = proj3 130":
+	#instruction start "133 = proj1 130":
+	#instruction start "135 = %rdi":
+	#instruction start "136 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "137 = store part of 136 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "138 = load 136, state: 137":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "139 = set_reg %rax 138":
+	#instruction start "140 = return 131, 139, 137":
+	movq %rbx, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	leave 
+	ret 
+__uint64_identity:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -24(%rbp)
+	movq %r12, -32(%rbp)
+	movq %rdi, %rbx
+.L7:
+	#instruction start "144 = proj3 142":
+	#instruction start "145 = proj1 142":
+	#instruction start "147 = %rdi":
+	#instruction start "148 = alloc with size 8":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "149 = store part of 148 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "150 = load 148, state: 149":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "151 = set_reg %rax 150":
+	#instruction start "152 = return 143, 151, 149":
+	movq %rbx, %rax
+	#Block return.
+	movq -24(%rbp), %rbx
+	movq -32(%rbp), %r12
+	leave 
+	ret 
+.global func
+func:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movq %rbx, -16(%rbp)
+	movq %r12, -24(%rbp)
+	movq %r13, -32(%rbp)
+	movq %r14, -40(%rbp)
+	movq %r15, -48(%rbp)
+	movq %rdi, %rbx
+.L8:
+	#instruction start "156 = proj3 154":
+	#instruction start "157 = proj1 154":
+	#instruction start "159 = %rdi":
+	#instruction start "160 = alloc with size 8":
+	leaq -8(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "161 = store part of 160 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "162 = constant(1)":
+	movl $1, %ebx
+	#instruction start "163 = int_cast_zero 162":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "164 = load 160, state: 161":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "165 = constant(4)":
+	movq $4, %r14
+	#instruction start "166 = 163 * 165":
+	movq %r13, %rax
+	movq %r14, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "167 = 164 - 166":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	subq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "168 = store 160 167, state: 161":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "169 = constant(1)":
+	movl $1, %ebx
+	#instruction start "170 = int_cast_zero 169":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "171 = load 160, state: 168":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "172 = constant(4)":
+	movq $4, %r14
+	#instruction start "173 = 170 * 172":
+	movq %r13, %rax
+	movq %r14, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "174 = 171 + 173":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "175 = store 160 174, state: 168":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "176 = constant(10)":
+	movl $10, %ebx
+	#instruction start "177 = int_cast_zero 176":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "178 = load 160, state: 175":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "179 = constant(4)":
+	movq $4, %r14
+	#instruction start "180 = 177 * 179":
+	movq %r13, %rax
+	movq %r14, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "181 = 178 + 180":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "182 = store 160 181, state: 175":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "183 = constant(10)":
+	movl $10, %ebx
+	#instruction start "184 = int_cast_zero 183":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "185 = load 160, state: 182":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "186 = constant(4)":
+	movq $4, %r14
+	#instruction start "187 = 184 * 186":
+	movq %r13, %rax
+	movq %r14, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "188 = 185 + 187":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "189 = store 160 188, state: 182":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "190 = constant(10)":
+	movl $10, %ebx
+	#instruction start "191 = int_cast_zero 190":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "192 = load 160, state: 189":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "193 = constant(4)":
+	movq $4, %r14
+	#instruction start "194 = 191 * 193":
+	movq %r13, %rax
+	movq %r14, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "195 = 192 - 194":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	subq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "196 = store 160 195, state: 189":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "197 = return 155, -1, 196":
+	#Block return.
+	movq -16(%rbp), %rbx
+	movq -24(%rbp), %r12
+	movq -32(%rbp), %r13
+	movq -40(%rbp), %r14
+	movq -48(%rbp), %r15
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $544, %rsp
+	movq %rbx, -508(%rbp)
+	movq %r12, -516(%rbp)
+	movq %r13, -524(%rbp)
+	movq %r14, -532(%rbp)
+	movq %r15, -540(%rbp)
+.L9:
+	#instruction start "200 = proj3 198":
+	#instruction start "203 = alloc with size 40":
+	leaq -352(%rbp), %rsi
+	movq %rsi, -8(%rbp)
+	#instruction start "204 = set_zero_ptr 203, size: 40":
+	movq -8(%rbp), %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	movq $0, 16(%rdi)
+	movq $0, 24(%rdi)
+	movq $0, 32(%rdi)
+	#instruction start "205 = constant(0)":
+	movq $0, %r12
+	#instruction start "206 = 203 + 205":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "207 = constant(1)":
+	movl $1, %r12d
+	#instruction start "208 = store 206 207, state: 204":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "209 = constant(4)":
+	movq $4, %r12
+	#instruction start "210 = 203 + 209":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "211 = constant(2)":
+	movl $2, %r12d
+	#instruction start "212 = store 210 211, state: 208":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "213 = constant(8)":
+	movq $8, %r12
+	#instruction start "214 = 203 + 213":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "215 = constant(3)":
+	movl $3, %r12d
+	#instruction start "216 = store 214 215, state: 212":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "217 = constant(12)":
+	movq $12, %r12
+	#instruction start "218 = 203 + 217":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "219 = constant(4)":
+	movl $4, %r12d
+	#instruction start "220 = store 218 219, state: 216":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "221 = constant(16)":
+	movq $16, %r12
+	#instruction start "222 = 203 + 221":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "223 = constant(5)":
+	movl $5, %r12d
+	#instruction start "224 = store 222 223, state: 220":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "225 = constant(20)":
+	movq $20, %r12
+	#instruction start "226 = 203 + 225":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "227 = constant(6)":
+	movl $6, %r12d
+	#instruction start "228 = store 226 227, state: 224":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "229 = constant(24)":
+	movq $24, %r12
+	#instruction start "230 = 203 + 229":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "231 = constant(7)":
+	movl $7, %r12d
+	#instruction start "232 = store 230 231, state: 228":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "233 = constant(28)":
+	movq $28, %r12
+	#instruction start "234 = 203 + 233":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "235 = constant(8)":
+	movl $8, %r12d
+	#instruction start "236 = store 234 235, state: 232":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "237 = constant(32)":
+	movq $32, %r12
+	#instruction start "238 = 203 + 237":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "239 = constant(9)":
+	movl $9, %r12d
+	#instruction start "240 = store 238 239, state: 236":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "241 = constant(36)":
+	movq $36, %r12
+	#instruction start "242 = 203 + 241":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "243 = constant(10)":
+	movl $10, %r12d
+	#instruction start "244 = store 242 243, state: 240":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "247 = constant(5)":
+	movl $5, %r12d
+	#instruction start "248 = int_cast_zero 247":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "249 = constant(4)":
+	movq $4, %r12
+	#instruction start "250 = 248 * 249":
+	movq %r13, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "251 = 203 + 250":
+	movq -8(%rbp), %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "253 = constant(5)":
+	movl $5, %r13d
+	#instruction start "254 = int_cast_zero 253":
+	movq %r13, %rax
+	movslq %eax, %rax
+	movq %rax, %r14
+	#instruction start "256 = constant(4)":
+	movq $4, %r13
+	#instruction start "257 = 254 * 256":
+	movq %r14, %rax
+	movq %r13, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "258 = 251 - 257":
+	movq %r12, %rax
+	movq %r15, %rcx
+	subq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "259 = constant(20)":
+	movl $20, %r12d
+	#instruction start "260 = store 258 259, state: 244":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "261 = constant(0)":
+	movl $0, %r12d
+	#instruction start "262 = int_cast_zero 261":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "263 = constant(4)":
+	movq $4, %r12
+	#instruction start "264 = 262 * 263":
+	movq %r13, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "265 = 203 + 264":
+	movq -8(%rbp), %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "266 = load_volatile 265, state: 260":
+	movq %r12, %rdi
+	movl (%rdi), %r13d
+	#instruction start "267 = proj0 266":
+	#instruction start "268 = proj1 266":
+	#instruction start "269 = constant(20)":
+	movl $20, %r12d
+	#instruction start "270 = 268 == 269":
+	movq %r13, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "272 = if 199 270":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L11
+.L10:
+	#instruction start "275 = constant(1)":
+	movq $.Ls1, %r12
+	#instruction start "276 = constant(2)":
+	movq $.Ls2, %r13
+	#instruction start "277 = constant(19)":
+	movl $19, %r14d
+	#instruction start "278 = constant(3)":
+	movq $.Ls3, %r15
+	#instruction start "279 = alloc with size 8":
+	leaq -360(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "280 = store 279 275, state: 267":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "281 = alloc with size 8":
+	leaq -368(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "282 = store 281 276, state: 280":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "283 = alloc with size 4":
+	leaq -372(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "284 = store 283 277, state: 282":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "285 = alloc with size 8":
+	leaq -380(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "286 = store 285 278, state: 284":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "287 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "288 = constant(0)":
+	leaq -24(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "289 = load part address of 279 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "290 = proj0 289":
+	#instruction start "291 = proj1 289":
+	#instruction start "292 = load part address of 281 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "293 = proj0 292":
+	#instruction start "294 = proj1 292":
+	#instruction start "295 = load part address of 283 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "296 = proj0 295":
+	#instruction start "297 = proj1 295":
+	#instruction start "298 = load part address of 285 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "299 = proj0 298":
+	#instruction start "300 = proj1 298":
+	#instruction start "301 = allocate_call_stack 0":
+	#instruction start "302 = set_reg %rdi 291":
+	#instruction start "303 = set_reg %rsi 294 state: 302":
+	#instruction start "304 = set_reg %rdx 297 state: 303":
+	#instruction start "305 = set_reg %rcx 300 state: 304":
+	#instruction start "306 = set_reg %rax 288 state: 305":
+	#instruction start "307 = call 287":
+	addq $0, %rsp
+	movq -24(%rbp), %rax
+	movq %r13, %rcx
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq -16(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "308 = proj0 307":
+	#instruction start "309 = proj1 307":
+	#Block jump
+	jmp .L12
+.L11:
+	#Block jump elided
+.L12:
+	#instruction start "311 = phi (region: 271) 267 308":
+	#instruction start "313 = constant(0)":
+	movq $0, %rbx
+	#instruction start "316 = constant(0)":
+	movq $0, %r12
+	#instruction start "317 = 313 == 316":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "319 = if 271 317":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L14
+.L13:
+	#instruction start "322 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "323 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "324 = constant(22)":
+	movl $22, %r13d
+	#instruction start "325 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "326 = alloc with size 8":
+	leaq -388(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "327 = store 326 322, state: 311":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "328 = alloc with size 8":
+	leaq -396(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "329 = store 328 323, state: 327":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "330 = alloc with size 4":
+	leaq -400(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "331 = store 330 324, state: 329":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "332 = alloc with size 8":
+	leaq -408(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "333 = store 332 325, state: 331":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "334 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "335 = constant(0)":
+	leaq -80(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "336 = load part address of 326 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "337 = proj0 336":
+	#instruction start "338 = proj1 336":
+	#instruction start "339 = load part address of 328 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "340 = proj0 339":
+	#instruction start "341 = proj1 339":
+	#instruction start "342 = load part address of 330 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "343 = proj0 342":
+	#instruction start "344 = proj1 342":
+	#instruction start "345 = load part address of 332 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "346 = proj0 345":
+	#instruction start "347 = proj1 345":
+	#instruction start "348 = allocate_call_stack 0":
+	#instruction start "349 = set_reg %rdi 338":
+	#instruction start "350 = set_reg %rsi 341 state: 349":
+	#instruction start "351 = set_reg %rdx 344 state: 350":
+	#instruction start "352 = set_reg %rcx 347 state: 351":
+	#instruction start "353 = set_reg %rax 335 state: 352":
+	#instruction start "354 = call 334":
+	addq $0, %rsp
+	movq -80(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -72(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "355 = proj0 354":
+	#instruction start "356 = proj1 354":
+	#Block jump
+	jmp .L15
+.L14:
+	#Block jump elided
+.L15:
+	#instruction start "357 = constant(5)":
+	movl $5, %ebx
+	#instruction start "358 = int_cast_zero 357":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "359 = constant(4)":
+	movq $4, %rbx
+	#instruction start "360 = 358 * 359":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "361 = 203 + 360":
+	movq -8(%rbp), %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "362 = constant(3)":
+	movl $3, %r12d
+	#instruction start "363 = int_cast_zero 362":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "364 = constant(4)":
+	movq $4, %r12
+	#instruction start "365 = 363 * 364":
+	movq %r13, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "366 = 203 + 365":
+	movq -8(%rbp), %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "367 = constant(4)":
+	movq $4, %r13
+	#instruction start "368 = 361 - 366":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	subq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "369 = phi (region: 318) 311 355":
+	#instruction start "370 = 368 / 367 (signed)":
+	movq %r14, %rax
+	movq %r13, %rcx
+	cqto 
+	idivq %rcx
+	movq %rax, %rbx
+	#instruction start "371 = proj1 370":
+	#instruction start "372 = proj0 370":
+	#instruction start "373 = constant(2)":
+	movq $2, %r12
+	#instruction start "374 = 372 == 373":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "376 = if 318 374":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L17
+.L16:
+	#instruction start "379 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "380 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "381 = constant(24)":
+	movl $24, %r13d
+	#instruction start "382 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "383 = alloc with size 8":
+	leaq -416(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "384 = store 383 379, state: 371":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "385 = alloc with size 8":
+	leaq -424(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "386 = store 385 380, state: 384":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "387 = alloc with size 4":
+	leaq -428(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "388 = store 387 381, state: 386":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "389 = alloc with size 8":
+	leaq -436(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "390 = store 389 382, state: 388":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "391 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "392 = constant(0)":
+	leaq -136(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "393 = load part address of 383 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "394 = proj0 393":
+	#instruction start "395 = proj1 393":
+	#instruction start "396 = load part address of 385 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "397 = proj0 396":
+	#instruction start "398 = proj1 396":
+	#instruction start "399 = load part address of 387 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "400 = proj0 399":
+	#instruction start "401 = proj1 399":
+	#instruction start "402 = load part address of 389 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "403 = proj0 402":
+	#instruction start "404 = proj1 402":
+	#instruction start "405 = allocate_call_stack 0":
+	#instruction start "406 = set_reg %rdi 395":
+	#instruction start "407 = set_reg %rsi 398 state: 406":
+	#instruction start "408 = set_reg %rdx 401 state: 407":
+	#instruction start "409 = set_reg %rcx 404 state: 408":
+	#instruction start "410 = set_reg %rax 392 state: 409":
+	#instruction start "411 = call 391":
+	addq $0, %rsp
+	movq -136(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -128(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "412 = proj0 411":
+	#instruction start "413 = proj1 411":
+	#Block jump
+	jmp .L18
+.L17:
+	#Block jump elided
+.L18:
+	#instruction start "414 = constant(3)":
+	movl $3, %ebx
+	#instruction start "415 = int_cast_zero 414":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "416 = constant(4)":
+	movq $4, %rbx
+	#instruction start "417 = 415 * 416":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "418 = 203 + 417":
+	movq -8(%rbp), %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "419 = constant(5)":
+	movl $5, %r12d
+	#instruction start "420 = int_cast_zero 419":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "421 = constant(4)":
+	movq $4, %r12
+	#instruction start "422 = 420 * 421":
+	movq %r13, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "423 = 203 + 422":
+	movq -8(%rbp), %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "424 = constant(4)":
+	movq $4, %r13
+	#instruction start "425 = 418 - 423":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	subq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "426 = phi (region: 375) 371 412":
+	#instruction start "427 = 425 / 424 (signed)":
+	movq %r14, %rax
+	movq %r13, %rcx
+	cqto 
+	idivq %rcx
+	movq %rax, %rbx
+	#instruction start "428 = proj1 427":
+	#instruction start "429 = proj0 427":
+	#instruction start "430 = constant(-2)":
+	movq $-2, %r12
+	#instruction start "431 = 429 == 430":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "433 = if 375 431":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L20
+.L19:
+	#instruction start "436 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "437 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "438 = constant(25)":
+	movl $25, %r13d
+	#instruction start "439 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "440 = alloc with size 8":
+	leaq -444(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "441 = store 440 436, state: 428":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "442 = alloc with size 8":
+	leaq -452(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "443 = store 442 437, state: 441":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "444 = alloc with size 4":
+	leaq -456(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "445 = store 444 438, state: 443":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "446 = alloc with size 8":
+	leaq -464(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "447 = store 446 439, state: 445":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "448 = constant(0)":
+	leaq -184(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "449 = constant(0)":
+	leaq -192(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "450 = load part address of 440 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "451 = proj0 450":
+	#instruction start "452 = proj1 450":
+	#instruction start "453 = load part address of 442 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "454 = proj0 453":
+	#instruction start "455 = proj1 453":
+	#instruction start "456 = load part address of 444 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "457 = proj0 456":
+	#instruction start "458 = proj1 456":
+	#instruction start "459 = load part address of 446 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "460 = proj0 459":
+	#instruction start "461 = proj1 459":
+	#instruction start "462 = allocate_call_stack 0":
+	#instruction start "463 = set_reg %rdi 452":
+	#instruction start "464 = set_reg %rsi 455 state: 463":
+	#instruction start "465 = set_reg %rdx 458 state: 464":
+	#instruction start "466 = set_reg %rcx 461 state: 465":
+	#instruction start "467 = set_reg %rax 449 state: 466":
+	#instruction start "468 = call 448":
+	addq $0, %rsp
+	movq -192(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -184(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "469 = proj0 468":
+	#instruction start "470 = proj1 468":
+	#Block jump
+	jmp .L21
+.L20:
+	#Block jump elided
+.L21:
+	#instruction start "471 = constant(0)":
+	movq $0, %rbx
+	#instruction start "472 = alloc with size 8":
+	leaq -472(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "473 = phi (region: 432) 428 469":
+	#instruction start "474 = store 472 471, state: 473":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "475 = constant(7)":
+	movq $func, %rbx
+	#instruction start "476 = constant(0)":
+	movq $0, %r13
+	#instruction start "477 = load part address of 472 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "478 = proj0 477":
+	#instruction start "479 = proj1 477":
+	#instruction start "480 = allocate_call_stack 0":
+	#instruction start "481 = set_reg %rdi 479":
+	#instruction start "482 = set_reg %rax 476 state: 481":
+	#instruction start "483 = call 475":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "484 = proj0 483":
+	#instruction start "485 = proj1 483":
+	#instruction start "486 = constant(1)":
+	movl $1, %ebx
+	#instruction start "488 = if 432 486":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L23
+.L22:
+	#instruction start "491 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "492 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "493 = constant(29)":
+	movl $29, %r13d
+	#instruction start "494 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "495 = alloc with size 8":
+	leaq -480(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "496 = store 495 491, state: 484":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "497 = alloc with size 8":
+	leaq -488(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "498 = store 497 492, state: 496":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "499 = alloc with size 4":
+	leaq -492(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "500 = store 499 493, state: 498":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "501 = alloc with size 8":
+	leaq -500(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "502 = store 501 494, state: 500":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "503 = constant(0)":
+	leaq -256(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "504 = constant(0)":
+	leaq -264(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "505 = load part address of 495 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "506 = proj0 505":
+	#instruction start "507 = proj1 505":
+	#instruction start "508 = load part address of 497 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "509 = proj0 508":
+	#instruction start "510 = proj1 508":
+	#instruction start "511 = load part address of 499 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "512 = proj0 511":
+	#instruction start "513 = proj1 511":
+	#instruction start "514 = load part address of 501 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "515 = proj0 514":
+	#instruction start "516 = proj1 514":
+	#instruction start "517 = allocate_call_stack 0":
+	#instruction start "518 = set_reg %rdi 507":
+	#instruction start "519 = set_reg %rsi 510 state: 518":
+	#instruction start "520 = set_reg %rdx 513 state: 519":
+	#instruction start "521 = set_reg %rcx 516 state: 520":
+	#instruction start "522 = set_reg %rax 504 state: 521":
+	#instruction start "523 = call 503":
+	addq $0, %rsp
+	movq -264(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -256(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "524 = proj0 523":
+	#instruction start "525 = proj1 523":
+	#Block jump
+	jmp .L24
+.L23:
+	#Block jump elided
+.L24:
+	#instruction start "526 = constant(0)":
+	movl $0, %ebx
+	#instruction start "527 = set_reg %rax 526":
+	#instruction start "528 = phi (region: 487) 484 524":
+	#instruction start "529 = return 487, 527, 528":
+	movq %rbx, %rax
+	#Block return.
+	movq -508(%rbp), %rbx
+	movq -516(%rbp), %r12
+	movq -524(%rbp), %r13
+	movq -532(%rbp), %r14
+	movq -540(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "arr[0] == 20\000"
+.Ls2:
+	.string "tests/pointer_arithmetic.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "null_ptr == 0\000"
+.Ls5:
+	.string "&arr[5] - &arr[3] == 2\000"
+.Ls6:
+	.string "&arr[3] - &arr[5] == -2\000"
+.Ls8:
+	.string "sizeof(&arr[0] - &arr[3]) == sizeof(ptrdiff_t)\000"
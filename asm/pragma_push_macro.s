@@ -0,0 +1,794 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $720, %rsp
+	movq %rbx, -688(%rbp)
+	movq %r12, -696(%rbp)
+	movq %r13, -704(%rbp)
+	movq %r14, -712(%rbp)
+	movq %r15, -720(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(1)":
+	movl $1, %ebx
+	#instruction start "8 = if 2 6":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "11 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "12 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "13 = constant(7)":
+	movl $7, %r13d
+	#instruction start "14 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "15 = alloc with size 8":
+	leaq -464(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "16 = store 15 11, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "17 = alloc with size 8":
+	leaq -472(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "18 = store 17 12, state: 16":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "19 = alloc with size 4":
+	leaq -476(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "20 = store 19 13, state: 18":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "21 = alloc with size 8":
+	leaq -484(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "22 = store 21 14, state: 20":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "23 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "24 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "25 = load part address of 15 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "26 = proj0 25":
+	#instruction start "27 = proj1 25":
+	#instruction start "28 = load part address of 17 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "29 = proj0 28":
+	#instruction start "30 = proj1 28":
+	#instruction start "31 = load part address of 19 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "32 = proj0 31":
+	#instruction start "33 = proj1 31":
+	#instruction start "34 = load part address of 21 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "35 = proj0 34":
+	#instruction start "36 = proj1 34":
+	#instruction start "37 = allocate_call_stack 0":
+	#instruction start "38 = set_reg %rdi 27":
+	#instruction start "39 = set_reg %rsi 30 state: 38":
+	#instruction start "40 = set_reg %rdx 33 state: 39":
+	#instruction start "41 = set_reg %rcx 36 state: 40":
+	#instruction start "42 = set_reg %rax 24 state: 41":
+	#instruction start "43 = call 23":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "44 = proj0 43":
+	#instruction start "45 = proj1 43":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "46 = constant(1)":
+	movl $1, %ebx
+	#instruction start "48 = if 7 46":
+	#instruction start "56 = phi (region: 7) 3 44":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "51 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "52 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "53 = constant(8)":
+	movl $8, %r13d
+	#instruction start "54 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "55 = alloc with size 8":
+	leaq -492(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "57 = store 55 51, state: 56":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "58 = alloc with size 8":
+	leaq -500(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "59 = store 58 52, state: 57":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "60 = alloc with size 4":
+	leaq -504(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "61 = store 60 53, state: 59":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "62 = alloc with size 8":
+	leaq -512(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "63 = store 62 54, state: 61":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "64 = constant(0)":
+	leaq -64(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "65 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "66 = load part address of 55 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "67 = proj0 66":
+	#instruction start "68 = proj1 66":
+	#instruction start "69 = load part address of 58 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "70 = proj0 69":
+	#instruction start "71 = proj1 69":
+	#instruction start "72 = load part address of 60 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "73 = proj0 72":
+	#instruction start "74 = proj1 72":
+	#instruction start "75 = load part address of 62 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "76 = proj0 75":
+	#instruction start "77 = proj1 75":
+	#instruction start "78 = allocate_call_stack 0":
+	#instruction start "79 = set_reg %rdi 68":
+	#instruction start "80 = set_reg %rsi 71 state: 79":
+	#instruction start "81 = set_reg %rdx 74 state: 80":
+	#instruction start "82 = set_reg %rcx 77 state: 81":
+	#instruction start "83 = set_reg %rax 65 state: 82":
+	#instruction start "84 = call 64":
+	addq $0, %rsp
+	movq -72(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -64(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "85 = proj0 84":
+	#instruction start "86 = proj1 84":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "87 = constant(1)":
+	movl $1, %ebx
+	#instruction start "89 = if 47 87":
+	#instruction start "97 = phi (region: 47) 56 85":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "92 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "93 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "94 = constant(12)":
+	movl $12, %r13d
+	#instruction start "95 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "96 = alloc with size 8":
+	leaq -520(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "98 = store 96 92, state: 97":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "99 = alloc with size 8":
+	leaq -528(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "100 = store 99 93, state: 98":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "101 = alloc with size 4":
+	leaq -532(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "102 = store 101 94, state: 100":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "103 = alloc with size 8":
+	leaq -540(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "104 = store 103 95, state: 102":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "105 = constant(0)":
+	leaq -120(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "106 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "107 = load part address of 96 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "108 = proj0 107":
+	#instruction start "109 = proj1 107":
+	#instruction start "110 = load part address of 99 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "111 = proj0 110":
+	#instruction start "112 = proj1 110":
+	#instruction start "113 = load part address of 101 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "114 = proj0 113":
+	#instruction start "115 = proj1 113":
+	#instruction start "116 = load part address of 103 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "117 = proj0 116":
+	#instruction start "118 = proj1 116":
+	#instruction start "119 = allocate_call_stack 0":
+	#instruction start "120 = set_reg %rdi 109":
+	#instruction start "121 = set_reg %rsi 112 state: 120":
+	#instruction start "122 = set_reg %rdx 115 state: 121":
+	#instruction start "123 = set_reg %rcx 118 state: 122":
+	#instruction start "124 = set_reg %rax 106 state: 123":
+	#instruction start "125 = call 105":
+	addq $0, %rsp
+	movq -128(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -120(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "126 = proj0 125":
+	#instruction start "127 = proj1 125":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "128 = constant(1)":
+	movl $1, %ebx
+	#instruction start "130 = if 88 128":
+	#instruction start "138 = phi (region: 88) 97 126":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "133 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "134 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "135 = constant(14)":
+	movl $14, %r13d
+	#instruction start "136 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "137 = alloc with size 8":
+	leaq -548(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "139 = store 137 133, state: 138":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "140 = alloc with size 8":
+	leaq -556(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "141 = store 140 134, state: 139":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "142 = alloc with size 4":
+	leaq -560(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "143 = store 142 135, state: 141":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "144 = alloc with size 8":
+	leaq -568(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "145 = store 144 136, state: 143":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "146 = constant(0)":
+	leaq -176(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "147 = constant(0)":
+	leaq -184(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "148 = load part address of 137 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "149 = proj0 148":
+	#instruction start "150 = proj1 148":
+	#instruction start "151 = load part address of 140 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "152 = proj0 151":
+	#instruction start "153 = proj1 151":
+	#instruction start "154 = load part address of 142 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "155 = proj0 154":
+	#instruction start "156 = proj1 154":
+	#instruction start "157 = load part address of 144 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "158 = proj0 157":
+	#instruction start "159 = proj1 157":
+	#instruction start "160 = allocate_call_stack 0":
+	#instruction start "161 = set_reg %rdi 150":
+	#instruction start "162 = set_reg %rsi 153 state: 161":
+	#instruction start "163 = set_reg %rdx 156 state: 162":
+	#instruction start "164 = set_reg %rcx 159 state: 163":
+	#instruction start "165 = set_reg %rax 147 state: 164":
+	#instruction start "166 = call 146":
+	addq $0, %rsp
+	movq -184(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -176(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "167 = proj0 166":
+	#instruction start "168 = proj1 166":
+	#Block jump
+	jmp .L14
+.L13:
+	#Block jump elided
+.L14:
+	#instruction start "169 = constant(1)":
+	movl $1, %ebx
+	#instruction start "171 = if 129 169":
+	#instruction start "179 = phi (region: 129) 138 167":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#instruction start "174 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "175 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "176 = constant(16)":
+	movl $16, %r13d
+	#instruction start "177 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "178 = alloc with size 8":
+	leaq -576(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "180 = store 178 174, state: 179":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "181 = alloc with size 8":
+	leaq -584(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "182 = store 181 175, state: 180":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "183 = alloc with size 4":
+	leaq -588(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "184 = store 183 176, state: 182":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "185 = alloc with size 8":
+	leaq -596(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "186 = store 185 177, state: 184":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "187 = constant(0)":
+	leaq -232(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "188 = constant(0)":
+	leaq -240(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "189 = load part address of 178 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "190 = proj0 189":
+	#instruction start "191 = proj1 189":
+	#instruction start "192 = load part address of 181 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "193 = proj0 192":
+	#instruction start "194 = proj1 192":
+	#instruction start "195 = load part address of 183 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "196 = proj0 195":
+	#instruction start "197 = proj1 195":
+	#instruction start "198 = load part address of 185 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "199 = proj0 198":
+	#instruction start "200 = proj1 198":
+	#instruction start "201 = allocate_call_stack 0":
+	#instruction start "202 = set_reg %rdi 191":
+	#instruction start "203 = set_reg %rsi 194 state: 202":
+	#instruction start "204 = set_reg %rdx 197 state: 203":
+	#instruction start "205 = set_reg %rcx 200 state: 204":
+	#instruction start "206 = set_reg %rax 188 state: 205":
+	#instruction start "207 = call 187":
+	addq $0, %rsp
+	movq -240(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -232(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "208 = proj0 207":
+	#instruction start "209 = proj1 207":
+	#Block jump
+	jmp .L17
+.L16:
+	#Block jump elided
+.L17:
+	#instruction start "210 = constant(1)":
+	movl $1, %ebx
+	#instruction start "212 = if 170 210":
+	#instruction start "220 = phi (region: 170) 179 208":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "215 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "216 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "217 = constant(18)":
+	movl $18, %r13d
+	#instruction start "218 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "219 = alloc with size 8":
+	leaq -604(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "221 = store 219 215, state: 220":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "222 = alloc with size 8":
+	leaq -612(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "223 = store 222 216, state: 221":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "224 = alloc with size 4":
+	leaq -616(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "225 = store 224 217, state: 223":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "226 = alloc with size 8":
+	leaq -624(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "227 = store 226 218, state: 225":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "228 = constant(0)":
+	leaq -288(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "229 = constant(0)":
+	leaq -296(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "230 = load part address of 219 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "231 = proj0 230":
+	#instruction start "232 = proj1 230":
+	#instruction start "233 = load part address of 222 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "234 = proj0 233":
+	#instruction start "235 = proj1 233":
+	#instruction start "236 = load part address of 224 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "237 = proj0 236":
+	#instruction start "238 = proj1 236":
+	#instruction start "239 = load part address of 226 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "240 = proj0 239":
+	#instruction start "241 = proj1 239":
+	#instruction start "242 = allocate_call_stack 0":
+	#instruction start "243 = set_reg %rdi 232":
+	#instruction start "244 = set_reg %rsi 235 state: 243":
+	#instruction start "245 = set_reg %rdx 238 state: 244":
+	#instruction start "246 = set_reg %rcx 241 state: 245":
+	#instruction start "247 = set_reg %rax 229 state: 246":
+	#instruction start "248 = call 228":
+	addq $0, %rsp
+	movq -296(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -288(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "249 = proj0 248":
+	#instruction start "250 = proj1 248":
+	#Block jump
+	jmp .L20
+.L19:
+	#Block jump elided
+.L20:
+	#instruction start "251 = constant(1)":
+	movl $1, %ebx
+	#instruction start "253 = if 211 251":
+	#instruction start "261 = phi (region: 211) 220 249":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "256 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "257 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "258 = constant(30)":
+	movl $30, %r13d
+	#instruction start "259 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "260 = alloc with size 8":
+	leaq -632(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "262 = store 260 256, state: 261":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "263 = alloc with size 8":
+	leaq -640(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "264 = store 263 257, state: 262":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "265 = alloc with size 4":
+	leaq -644(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "266 = store 265 258, state: 264":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "267 = alloc with size 8":
+	leaq -652(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "268 = store 267 259, state: 266":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "269 = constant(0)":
+	leaq -344(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "270 = constant(0)":
+	leaq -352(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "271 = load part address of 260 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "272 = proj0 271":
+	#instruction start "273 = proj1 271":
+	#instruction start "274 = load part address of 263 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "275 = proj0 274":
+	#instruction start "276 = proj1 274":
+	#instruction start "277 = load part address of 265 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "278 = proj0 277":
+	#instruction start "279 = proj1 277":
+	#instruction start "280 = load part address of 267 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "281 = proj0 280":
+	#instruction start "282 = proj1 280":
+	#instruction start "283 = allocate_call_stack 0":
+	#instruction start "284 = set_reg %rdi 273":
+	#instruction start "285 = set_reg %rsi 276 state: 284":
+	#instruction start "286 = set_reg %rdx 279 state: 285":
+	#instruction start "287 = set_reg %rcx 282 state: 286":
+	#instruction start "288 = set_reg %rax 270 state: 287":
+	#instruction start "289 = call 269":
+	addq $0, %rsp
+	movq -352(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -344(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "290 = proj0 289":
+	#instruction start "291 = proj1 289":
+	#Block jump
+	jmp .L23
+.L22:
+	#Block jump elided
+.L23:
+	#instruction start "292 = constant(1)":
+	movl $1, %ebx
+	#instruction start "294 = if 252 292":
+	#instruction start "302 = phi (region: 252) 261 290":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L25
+.L24:
+	#instruction start "297 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "298 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "299 = constant(32)":
+	movl $32, %r13d
+	#instruction start "300 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "301 = alloc with size 8":
+	leaq -660(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "303 = store 301 297, state: 302":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "304 = alloc with size 8":
+	leaq -668(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "305 = store 304 298, state: 303":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "306 = alloc with size 4":
+	leaq -672(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "307 = store 306 299, state: 305":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "308 = alloc with size 8":
+	leaq -680(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "309 = store 308 300, state: 307":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "310 = constant(0)":
+	leaq -400(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "311 = constant(0)":
+	leaq -408(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "312 = load part address of 301 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "313 = proj0 312":
+	#instruction start "314 = proj1 312":
+	#instruction start "315 = load part address of 304 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "316 = proj0 315":
+	#instruction start "317 = proj1 315":
+	#instruction start "318 = load part address of 306 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "319 = proj0 318":
+	#instruction start "320 = proj1 318":
+	#instruction start "321 = load part address of 308 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "322 = proj0 321":
+	#instruction start "323 = proj1 321":
+	#instruction start "324 = allocate_call_stack 0":
+	#instruction start "325 = set_reg %rdi 314":
+	#instruction start "326 = set_reg %rsi 317 state: 325":
+	#instruction start "327 = set_reg %rdx 320 state: 326":
+	#instruction start "328 = set_reg %rcx 323 state: 327":
+	#instruction start "329 = set_reg %rax 311 state: 328":
+	#instruction start "330 = call 310":
+	addq $0, %rsp
+	movq -408(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -400(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "331 = proj0 330":
+	#instruction start "332 = proj1 330":
+	#Block jump
+	jmp .L26
+.L25:
+	#Block jump elided
+.L26:
+	#instruction start "333 = constant(0)":
+	movl $0, %ebx
+	#instruction start "334 = set_reg %rax 333":
+	#instruction start "335 = phi (region: 293) 302 331":
+	#instruction start "336 = return 293, 334, 335":
+	movq %rbx, %rax
+	#Block return.
+	movq -688(%rbp), %rbx
+	movq -696(%rbp), %r12
+	movq -704(%rbp), %r13
+	movq -712(%rbp), %r14
+	movq -720(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "X == 1\000"
+.Ls2:
+	.string "tests/pragma_push_macro.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "Y == 2\000"
+.Ls5:
+	.string "X == 2\000"
+.Ls6:
+	.string "Y == 3\000"
+.Ls7:
+	.string "F(1) == 3\000"
+.Ls8:
+	.string "F(1) == 2\000"
@@ -0,0 +1,1237 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $1024, %rsp
+	movq %rbx, -984(%rbp)
+	movq %r12, -992(%rbp)
+	movq %r13, -1000(%rbp)
+	movq %r14, -1008(%rbp)
+	movq %r15, -1016(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "10 = constant(30)":
+	movl $30, %ebx
+	#instruction start "13 = constant(30)":
+	movl $30, %r12d
+	#instruction start "14 = 10 == 13":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "16 = if 2 14":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "19 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "20 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "21 = constant(26)":
+	movl $26, %r13d
+	#instruction start "22 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "23 = alloc with size 8":
+	leaq -660(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "24 = store 23 19, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "25 = alloc with size 8":
+	leaq -668(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "26 = store 25 20, state: 24":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "27 = alloc with size 4":
+	leaq -672(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "28 = store 27 21, state: 26":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "29 = alloc with size 8":
+	leaq -680(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "30 = store 29 22, state: 28":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "31 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "32 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "33 = load part address of 23 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "34 = proj0 33":
+	#instruction start "35 = proj1 33":
+	#instruction start "36 = load part address of 25 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "37 = proj0 36":
+	#instruction start "38 = proj1 36":
+	#instruction start "39 = load part address of 27 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "40 = proj0 39":
+	#instruction start "41 = proj1 39":
+	#instruction start "42 = load part address of 29 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "43 = proj0 42":
+	#instruction start "44 = proj1 42":
+	#instruction start "45 = allocate_call_stack 0":
+	#instruction start "46 = set_reg %rdi 35":
+	#instruction start "47 = set_reg %rsi 38 state: 46":
+	#instruction start "48 = set_reg %rdx 41 state: 47":
+	#instruction start "49 = set_reg %rcx 44 state: 48":
+	#instruction start "50 = set_reg %rax 32 state: 49":
+	#instruction start "51 = call 31":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "52 = proj0 51":
+	#instruction start "53 = proj1 51":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "55 = phi (region: 15) 3 52":
+	#instruction start "59 = constant(10)":
+	movl $10, %ebx
+	#instruction start "62 = constant(10)":
+	movl $10, %r12d
+	#instruction start "63 = 59 == 62":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "65 = if 15 63":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "68 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "69 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "70 = constant(32)":
+	movl $32, %r13d
+	#instruction start "71 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "72 = alloc with size 8":
+	leaq -688(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "73 = store 72 68, state: 55":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "74 = alloc with size 8":
+	leaq -696(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "75 = store 74 69, state: 73":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "76 = alloc with size 4":
+	leaq -700(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "77 = store 76 70, state: 75":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "78 = alloc with size 8":
+	leaq -708(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "79 = store 78 71, state: 77":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "80 = constant(0)":
+	leaq -64(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "81 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "82 = load part address of 72 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "83 = proj0 82":
+	#instruction start "84 = proj1 82":
+	#instruction start "85 = load part address of 74 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "86 = proj0 85":
+	#instruction start "87 = proj1 85":
+	#instruction start "88 = load part address of 76 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "89 = proj0 88":
+	#instruction start "90 = proj1 88":
+	#instruction start "91 = load part address of 78 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "92 = proj0 91":
+	#instruction start "93 = proj1 91":
+	#instruction start "94 = allocate_call_stack 0":
+	#instruction start "95 = set_reg %rdi 84":
+	#instruction start "96 = set_reg %rsi 87 state: 95":
+	#instruction start "97 = set_reg %rdx 90 state: 96":
+	#instruction start "98 = set_reg %rcx 93 state: 97":
+	#instruction start "99 = set_reg %rax 81 state: 98":
+	#instruction start "100 = call 80":
+	addq $0, %rsp
+	movq -72(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -64(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "101 = proj0 100":
+	#instruction start "102 = proj1 100":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "103 = constant(1)":
+	movl $1, %ebx
+	#instruction start "105 = if 64 103":
+	#instruction start "113 = phi (region: 64) 55 101":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "108 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "109 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "110 = constant(34)":
+	movl $34, %r13d
+	#instruction start "111 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "112 = alloc with size 8":
+	leaq -716(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "114 = store 112 108, state: 113":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "115 = alloc with size 8":
+	leaq -724(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "116 = store 115 109, state: 114":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "117 = alloc with size 4":
+	leaq -728(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "118 = store 117 110, state: 116":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "119 = alloc with size 8":
+	leaq -736(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "120 = store 119 111, state: 118":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "121 = constant(0)":
+	leaq -120(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "122 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "123 = load part address of 112 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "124 = proj0 123":
+	#instruction start "125 = proj1 123":
+	#instruction start "126 = load part address of 115 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "127 = proj0 126":
+	#instruction start "128 = proj1 126":
+	#instruction start "129 = load part address of 117 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "130 = proj0 129":
+	#instruction start "131 = proj1 129":
+	#instruction start "132 = load part address of 119 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "133 = proj0 132":
+	#instruction start "134 = proj1 132":
+	#instruction start "135 = allocate_call_stack 0":
+	#instruction start "136 = set_reg %rdi 125":
+	#instruction start "137 = set_reg %rsi 128 state: 136":
+	#instruction start "138 = set_reg %rdx 131 state: 137":
+	#instruction start "139 = set_reg %rcx 134 state: 138":
+	#instruction start "140 = set_reg %rax 122 state: 139":
+	#instruction start "141 = call 121":
+	addq $0, %rsp
+	movq -128(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -120(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "142 = proj0 141":
+	#instruction start "143 = proj1 141":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "144 = alloc with size 8":
+	leaq -744(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "145 = phi (region: 104) 113 142":
+	#instruction start "146 = set_zero_ptr 144, size: 8":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	#instruction start "147 = constant(0)":
+	movq $0, %r12
+	#instruction start "148 = store 144 147, state: 146":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "155 = constant(6)":
+	movq $.Ls6, %r12
+	#instruction start "156 = store 144 155, state: 148":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "157 = constant(6)":
+	movq $.Ls6, %r12
+	#instruction start "158 = alloc with size 8":
+	leaq -752(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "159 = store 158 157, state: 156":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "160 = constant(7)":
+	movq $strcmp, %r12
+	#instruction start "161 = constant(0)":
+	movq $0, %r14
+	#instruction start "162 = load part address of 144 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "163 = proj0 162":
+	#instruction start "164 = proj1 162":
+	#instruction start "165 = load part address of 158 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "166 = proj0 165":
+	#instruction start "167 = proj1 165":
+	#instruction start "168 = allocate_call_stack 0":
+	#instruction start "169 = set_reg %rdi 164":
+	#instruction start "170 = set_reg %rsi 167 state: 169":
+	#instruction start "171 = set_reg %rax 161 state: 170":
+	#instruction start "172 = call 160":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "173 = proj0 172":
+	#instruction start "174 = proj1 172":
+	#instruction start "175 = %rax":
+	#instruction start "176 = int_cast_zero 175":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "177 = constant(0)":
+	movl $0, %r12d
+	#instruction start "178 = 176 == 177":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "180 = if 104 178":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "183 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "184 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "185 = constant(43)":
+	movl $43, %r13d
+	#instruction start "186 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "187 = alloc with size 8":
+	leaq -760(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "188 = store 187 183, state: 173":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "189 = alloc with size 8":
+	leaq -768(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "190 = store 189 184, state: 188":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "191 = alloc with size 4":
+	leaq -772(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "192 = store 191 185, state: 190":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "193 = alloc with size 8":
+	leaq -780(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "194 = store 193 186, state: 192":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "195 = constant(0)":
+	leaq -200(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "196 = constant(0)":
+	leaq -208(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "197 = load part address of 187 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "198 = proj0 197":
+	#instruction start "199 = proj1 197":
+	#instruction start "200 = load part address of 189 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "201 = proj0 200":
+	#instruction start "202 = proj1 200":
+	#instruction start "203 = load part address of 191 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "204 = proj0 203":
+	#instruction start "205 = proj1 203":
+	#instruction start "206 = load part address of 193 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "207 = proj0 206":
+	#instruction start "208 = proj1 206":
+	#instruction start "209 = allocate_call_stack 0":
+	#instruction start "210 = set_reg %rdi 199":
+	#instruction start "211 = set_reg %rsi 202 state: 210":
+	#instruction start "212 = set_reg %rdx 205 state: 211":
+	#instruction start "213 = set_reg %rcx 208 state: 212":
+	#instruction start "214 = set_reg %rax 196 state: 213":
+	#instruction start "215 = call 195":
+	addq $0, %rsp
+	movq -208(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -200(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "216 = proj0 215":
+	#instruction start "217 = proj1 215":
+	#Block jump
+	jmp .L14
+.L13:
+	#Block jump elided
+.L14:
+	#instruction start "219 = phi (region: 179) 173 216":
+	#instruction start "223 = constant(1)":
+	movl $1, %ebx
+	#instruction start "226 = constant(1)":
+	movl $1, %r12d
+	#instruction start "227 = 223 == 226":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "229 = if 179 227":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#instruction start "232 = constant(9)":
+	movq $.Ls9, %rbx
+	#instruction start "233 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "234 = constant(87)":
+	movl $87, %r13d
+	#instruction start "235 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "236 = alloc with size 8":
+	leaq -788(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "237 = store 236 232, state: 219":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "238 = alloc with size 8":
+	leaq -796(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "239 = store 238 233, state: 237":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "240 = alloc with size 4":
+	leaq -800(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "241 = store 240 234, state: 239":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "242 = alloc with size 8":
+	leaq -808(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "243 = store 242 235, state: 241":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "244 = constant(0)":
+	leaq -256(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "245 = constant(0)":
+	leaq -264(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "246 = load part address of 236 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "247 = proj0 246":
+	#instruction start "248 = proj1 246":
+	#instruction start "249 = load part address of 238 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "250 = proj0 249":
+	#instruction start "251 = proj1 249":
+	#instruction start "252 = load part address of 240 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "253 = proj0 252":
+	#instruction start "254 = proj1 252":
+	#instruction start "255 = load part address of 242 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "256 = proj0 255":
+	#instruction start "257 = proj1 255":
+	#instruction start "258 = allocate_call_stack 0":
+	#instruction start "259 = set_reg %rdi 248":
+	#instruction start "260 = set_reg %rsi 251 state: 259":
+	#instruction start "261 = set_reg %rdx 254 state: 260":
+	#instruction start "262 = set_reg %rcx 257 state: 261":
+	#instruction start "263 = set_reg %rax 245 state: 262":
+	#instruction start "264 = call 244":
+	addq $0, %rsp
+	movq -264(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -256(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "265 = proj0 264":
+	#instruction start "266 = proj1 264":
+	#Block jump
+	jmp .L17
+.L16:
+	#Block jump elided
+.L17:
+	#instruction start "267 = constant(2)":
+	leaq -308(%rbp), %rdi
+	movl $2, (%rdi)
+	#instruction start "268 = phi (region: 228) 219 265":
+	#instruction start "271 = constant(2)":
+	movl $2, %r12d
+	#instruction start "272 = 267 == 271":
+	movl -308(%rbp), %eax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "274 = if 228 272":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "277 = constant(10)":
+	movq $.Ls10, %r12
+	#instruction start "278 = constant(2)":
+	movq $.Ls2, %r13
+	#instruction start "279 = constant(90)":
+	movl $90, %r14d
+	#instruction start "280 = constant(3)":
+	movq $.Ls3, %r15
+	#instruction start "281 = alloc with size 8":
+	leaq -816(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "282 = store 281 277, state: 268":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "283 = alloc with size 8":
+	leaq -824(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "284 = store 283 278, state: 282":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "285 = alloc with size 4":
+	leaq -828(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "286 = store 285 279, state: 284":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "287 = alloc with size 8":
+	leaq -836(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "288 = store 287 280, state: 286":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "289 = constant(0)":
+	leaq -316(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "290 = constant(0)":
+	leaq -324(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "291 = load part address of 281 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "292 = proj0 291":
+	#instruction start "293 = proj1 291":
+	#instruction start "294 = load part address of 283 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "295 = proj0 294":
+	#instruction start "296 = proj1 294":
+	#instruction start "297 = load part address of 285 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "298 = proj0 297":
+	#instruction start "299 = proj1 297":
+	#instruction start "300 = load part address of 287 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "301 = proj0 300":
+	#instruction start "302 = proj1 300":
+	#instruction start "303 = allocate_call_stack 0":
+	#instruction start "304 = set_reg %rdi 293":
+	#instruction start "305 = set_reg %rsi 296 state: 304":
+	#instruction start "306 = set_reg %rdx 299 state: 305":
+	#instruction start "307 = set_reg %rcx 302 state: 306":
+	#instruction start "308 = set_reg %rax 290 state: 307":
+	#instruction start "309 = call 289":
+	addq $0, %rsp
+	movq -324(%rbp), %rax
+	movq %r13, %rcx
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq -316(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "310 = proj0 309":
+	#instruction start "311 = proj1 309":
+	#Phi node to 544 (273 267 267)
+	movl -308(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump
+	jmp .L20
+.L19:
+	#Phi node to 544 (273 267 267)
+	movl -308(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump elided
+.L20:
+	#instruction start "312 = phi (region: 273) 268 310":
+	#instruction start "314 = constant(3)":
+	movl $3, %r12d
+	#instruction start "544 = phi (region: 273) 267 267":
+	#instruction start "315 = 544 + 314":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "318 = constant(1)":
+	movl $1, %ebx
+	#instruction start "319 = 315 ^ 318":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	xorl %ecx, %eax
+	movl %eax, %r12d
+	#instruction start "322 = constant(4)":
+	movl $4, %ebx
+	#instruction start "323 = 319 == 322":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "325 = if 273 323":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "328 = constant(11)":
+	movq $.Ls11, %rbx
+	#instruction start "329 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "330 = constant(96)":
+	movl $96, %r13d
+	#instruction start "331 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "332 = alloc with size 8":
+	leaq -844(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "333 = store 332 328, state: 312":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "334 = alloc with size 8":
+	leaq -852(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "335 = store 334 329, state: 333":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "336 = alloc with size 4":
+	leaq -856(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "337 = store 336 330, state: 335":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "338 = alloc with size 8":
+	leaq -864(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "339 = store 338 331, state: 337":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "340 = constant(0)":
+	leaq -372(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "341 = constant(0)":
+	leaq -380(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "342 = load part address of 332 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "343 = proj0 342":
+	#instruction start "344 = proj1 342":
+	#instruction start "345 = load part address of 334 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "346 = proj0 345":
+	#instruction start "347 = proj1 345":
+	#instruction start "348 = load part address of 336 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "349 = proj0 348":
+	#instruction start "350 = proj1 348":
+	#instruction start "351 = load part address of 338 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "352 = proj0 351":
+	#instruction start "353 = proj1 351":
+	#instruction start "354 = allocate_call_stack 0":
+	#instruction start "355 = set_reg %rdi 344":
+	#instruction start "356 = set_reg %rsi 347 state: 355":
+	#instruction start "357 = set_reg %rdx 350 state: 356":
+	#instruction start "358 = set_reg %rcx 353 state: 357":
+	#instruction start "359 = set_reg %rax 341 state: 358":
+	#instruction start "360 = call 340":
+	addq $0, %rsp
+	movq -380(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -372(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "361 = proj0 360":
+	#instruction start "362 = proj1 360":
+	#Block jump
+	jmp .L23
+.L22:
+	#Block jump elided
+.L23:
+	#instruction start "363 = constant(1)":
+	movl $1, %ebx
+	#instruction start "365 = if 324 363":
+	#instruction start "373 = phi (region: 324) 312 361":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L25
+.L24:
+	#instruction start "368 = constant(12)":
+	movq $.Ls12, %rbx
+	#instruction start "369 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "370 = constant(97)":
+	movl $97, %r13d
+	#instruction start "371 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "372 = alloc with size 8":
+	leaq -872(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "374 = store 372 368, state: 373":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "375 = alloc with size 8":
+	leaq -880(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "376 = store 375 369, state: 374":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "377 = alloc with size 4":
+	leaq -884(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "378 = store 377 370, state: 376":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "379 = alloc with size 8":
+	leaq -892(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "380 = store 379 371, state: 378":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "381 = constant(0)":
+	leaq -428(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "382 = constant(0)":
+	leaq -436(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "383 = load part address of 372 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "384 = proj0 383":
+	#instruction start "385 = proj1 383":
+	#instruction start "386 = load part address of 375 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "387 = proj0 386":
+	#instruction start "388 = proj1 386":
+	#instruction start "389 = load part address of 377 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "390 = proj0 389":
+	#instruction start "391 = proj1 389":
+	#instruction start "392 = load part address of 379 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "393 = proj0 392":
+	#instruction start "394 = proj1 392":
+	#instruction start "395 = allocate_call_stack 0":
+	#instruction start "396 = set_reg %rdi 385":
+	#instruction start "397 = set_reg %rsi 388 state: 396":
+	#instruction start "398 = set_reg %rdx 391 state: 397":
+	#instruction start "399 = set_reg %rcx 394 state: 398":
+	#instruction start "400 = set_reg %rax 382 state: 399":
+	#instruction start "401 = call 381":
+	addq $0, %rsp
+	movq -436(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -428(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "402 = proj0 401":
+	#instruction start "403 = proj1 401":
+	#Block jump
+	jmp .L26
+.L25:
+	#Block jump elided
+.L26:
+	#instruction start "404 = constant(1)":
+	movl $1, %ebx
+	#instruction start "406 = if 364 404":
+	#instruction start "414 = phi (region: 364) 373 402":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L28
+.L27:
+	#instruction start "409 = constant(14)":
+	movq $.Ls14, %rbx
+	#instruction start "410 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "411 = constant(98)":
+	movl $98, %r13d
+	#instruction start "412 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "413 = alloc with size 8":
+	leaq -900(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "415 = store 413 409, state: 414":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "416 = alloc with size 8":
+	leaq -908(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "417 = store 416 410, state: 415":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "418 = alloc with size 4":
+	leaq -912(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "419 = store 418 411, state: 417":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "420 = alloc with size 8":
+	leaq -920(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "421 = store 420 412, state: 419":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "422 = constant(0)":
+	leaq -484(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "423 = constant(0)":
+	leaq -492(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "424 = load part address of 413 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "425 = proj0 424":
+	#instruction start "426 = proj1 424":
+	#instruction start "427 = load part address of 416 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "428 = proj0 427":
+	#instruction start "429 = proj1 427":
+	#instruction start "430 = load part address of 418 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "431 = proj0 430":
+	#instruction start "432 = proj1 430":
+	#instruction start "433 = load part address of 420 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "434 = proj0 433":
+	#instruction start "435 = proj1 433":
+	#instruction start "436 = allocate_call_stack 0":
+	#instruction start "437 = set_reg %rdi 426":
+	#instruction start "438 = set_reg %rsi 429 state: 437":
+	#instruction start "439 = set_reg %rdx 432 state: 438":
+	#instruction start "440 = set_reg %rcx 435 state: 439":
+	#instruction start "441 = set_reg %rax 423 state: 440":
+	#instruction start "442 = call 422":
+	addq $0, %rsp
+	movq -492(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -484(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "443 = proj0 442":
+	#instruction start "444 = proj1 442":
+	#Block jump
+	jmp .L29
+.L28:
+	#Block jump elided
+.L29:
+	#instruction start "445 = constant(1)":
+	movl $1, %ebx
+	#instruction start "447 = if 405 445":
+	#instruction start "455 = phi (region: 405) 414 443":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L31
+.L30:
+	#instruction start "450 = constant(15)":
+	movq $.Ls15, %rbx
+	#instruction start "451 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "452 = constant(99)":
+	movl $99, %r13d
+	#instruction start "453 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "454 = alloc with size 8":
+	leaq -928(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "456 = store 454 450, state: 455":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "457 = alloc with size 8":
+	leaq -936(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "458 = store 457 451, state: 456":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "459 = alloc with size 4":
+	leaq -940(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "460 = store 459 452, state: 458":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "461 = alloc with size 8":
+	leaq -948(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "462 = store 461 453, state: 460":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "463 = constant(0)":
+	leaq -540(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "464 = constant(0)":
+	leaq -548(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "465 = load part address of 454 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "466 = proj0 465":
+	#instruction start "467 = proj1 465":
+	#instruction start "468 = load part address of 457 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "469 = proj0 468":
+	#instruction start "470 = proj1 468":
+	#instruction start "471 = load part address of 459 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "472 = proj0 471":
+	#instruction start "473 = proj1 471":
+	#instruction start "474 = load part address of 461 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "475 = proj0 474":
+	#instruction start "476 = proj1 474":
+	#instruction start "477 = allocate_call_stack 0":
+	#instruction start "478 = set_reg %rdi 467":
+	#instruction start "479 = set_reg %rsi 470 state: 478":
+	#instruction start "480 = set_reg %rdx 473 state: 479":
+	#instruction start "481 = set_reg %rcx 476 state: 480":
+	#instruction start "482 = set_reg %rax 464 state: 481":
+	#instruction start "483 = call 463":
+	addq $0, %rsp
+	movq -548(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -540(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "484 = proj0 483":
+	#instruction start "485 = proj1 483":
+	#Block jump
+	jmp .L32
+.L31:
+	#Block jump elided
+.L32:
+	#instruction start "487 = phi (region: 446) 455 484":
+	#instruction start "489 = constant(0)":
+	movl $0, %ebx
+	#instruction start "492 = constant(1)":
+	movl $1, %r12d
+	#instruction start "493 = 489 + 492":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "494 = constant(1)":
+	movl $1, %ebx
+	#instruction start "495 = 494 == 493":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "497 = if 446 495":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L34
+.L33:
+	#instruction start "500 = constant(16)":
+	movq $.Ls16, %rbx
+	#instruction start "501 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "502 = constant(102)":
+	movl $102, %r13d
+	#instruction start "503 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "504 = alloc with size 8":
+	leaq -956(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "505 = store 504 500, state: 487":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "506 = alloc with size 8":
+	leaq -964(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "507 = store 506 501, state: 505":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "508 = alloc with size 4":
+	leaq -968(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "509 = store 508 502, state: 507":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "510 = alloc with size 8":
+	leaq -976(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "511 = store 510 503, state: 509":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "512 = constant(0)":
+	leaq -596(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "513 = constant(0)":
+	leaq -604(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "514 = load part address of 504 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "515 = proj0 514":
+	#instruction start "516 = proj1 514":
+	#instruction start "517 = load part address of 506 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "518 = proj0 517":
+	#instruction start "519 = proj1 517":
+	#instruction start "520 = load part address of 508 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "521 = proj0 520":
+	#instruction start "522 = proj1 520":
+	#instruction start "523 = load part address of 510 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "524 = proj0 523":
+	#instruction start "525 = proj1 523":
+	#instruction start "526 = allocate_call_stack 0":
+	#instruction start "527 = set_reg %rdi 516":
+	#instruction start "528 = set_reg %rsi 519 state: 527":
+	#instruction start "529 = set_reg %rdx 522 state: 528":
+	#instruction start "530 = set_reg %rcx 525 state: 529":
+	#instruction start "531 = set_reg %rax 513 state: 530":
+	#instruction start "532 = call 512":
+	addq $0, %rsp
+	movq -604(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -596(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "533 = proj0 532":
+	#instruction start "534 = proj1 532":
+	#Block jump
+	jmp .L35
+.L34:
+	#Block jump elided
+.L35:
+	#instruction start "535 = constant(0)":
+	movl $0, %ebx
+	#instruction start "536 = set_reg %rax 535":
+	#instruction start "537 = phi (region: 496) 487 533":
+	#instruction start "538 = return 496, 536, 537":
+	movq %rbx, %rax
+	#Block return.
+	movq -984(%rbp), %rbx
+	movq -992(%rbp), %r12
+	movq -1000(%rbp), %r13
+	movq -1008(%rbp), %r14
+	movq -1016(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "COMBINE(HELLO) == 30\000"
+.Ls2:
+	.string "tests/preprocess.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "a == 10\000"
+.Ls5:
+	.string "CAT(0x, ff) == 0xff\000"
+.Ls6:
+	.string "Hello\000"
+.Ls8:
+	.string "strcmp(include, \"Hello\") == 0\000"
+.Ls9:
+	.string "abcd == 1\000"
+.Ls10:
+	.string "abcd == 2\000"
+.Ls11:
+	.string "abcd == 4\000"
+.Ls12:
+	.string "paste(0x, 1p1) == 2.0\000"
+.Ls13:
+	.string "a\000\000\000b\000\000\000\000\000\000\000"
+.Ls14:
+	.string "sizeof paste(L, \"ab\") == sizeof L\"ab\"\000"
+.Ls15:
+	.string "paste(u, 'a') == u'a'\000"
+.Ls16:
+	.string "__COUNTER__ == first + 1\000"
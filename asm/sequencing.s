@@ -0,0 +1,149 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rbx, -100(%rbp)
+	movq %r12, -108(%rbp)
+	movq %r13, -116(%rbp)
+	movq %r14, -124(%rbp)
+	movq %r15, -132(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "8 = constant(1)":
+	movl $1, %ebx
+	#instruction start "15 = constant(1)":
+	movl $1, %r12d
+	#instruction start "16 = 8 + 15":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "21 = constant(1)":
+	movl $1, %ebx
+	#instruction start "22 = 16 + 21":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addl %ecx, %eax
+	movl %eax, %r12d
+	#instruction start "25 = constant(3)":
+	movl $3, %ebx
+	#instruction start "26 = 22 == 25":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "28 = if 2 26":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "31 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "32 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "33 = constant(6)":
+	movl $6, %r13d
+	#instruction start "34 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "35 = alloc with size 8":
+	leaq -72(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "36 = store 35 31, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "37 = alloc with size 8":
+	leaq -80(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "38 = store 37 32, state: 36":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "39 = alloc with size 4":
+	leaq -84(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "40 = store 39 33, state: 38":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "41 = alloc with size 8":
+	leaq -92(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "42 = store 41 34, state: 40":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "43 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "44 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "45 = load part address of 35 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "46 = proj0 45":
+	#instruction start "47 = proj1 45":
+	#instruction start "48 = load part address of 37 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "49 = proj0 48":
+	#instruction start "50 = proj1 48":
+	#instruction start "51 = load part address of 39 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "52 = proj0 51":
+	#instruction start "53 = proj1 51":
+	#instruction start "54 = load part address of 41 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "55 = proj0 54":
+	#instruction start "56 = proj1 54":
+	#instruction start "57 = allocate_call_stack 0":
+	#instruction start "58 = set_reg %rdi 47":
+	#instruction start "59 = set_reg %rsi 50 state: 58":
+	#instruction start "60 = set_reg %rdx 53 state: 59":
+	#instruction start "61 = set_reg %rcx 56 state: 60":
+	#instruction start "62 = set_reg %rax 44 state: 61":
+	#instruction start "63 = call 43":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "64 = proj0 63":
+	#instruction start "65 = proj1 63":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "66 = constant(0)":
+	movl $0, %ebx
+	#instruction start "67 = set_reg %rax 66":
+	#instruction start "68 = phi (region: 27) 3 64":
+	#instruction start "69 = return 27, 67, 68":
+	movq %rbx, %rax
+	#Block return.
+	movq -100(%rbp), %rbx
+	movq -108(%rbp), %r12
+	movq -116(%rbp), %r13
+	movq -124(%rbp), %r14
+	movq -132(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "a == 3\000"
+.Ls2:
+	.string "tests/sequencing.c\000"
+.Ls3:
+	.string "main"
@@ -0,0 +1,1329 @@
+.global function
+function:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movq %r13, -36(%rbp)
+	movq %r14, -44(%rbp)
+	movq %rdi, %rbx
+	movl %esi, %r12d
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = %rsi":
+	#instruction start "8 = alloc with size 8":
+	leaq -8(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "9 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "10 = store part of 8 with offset 0":
+	movq %r13, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "11 = store part of 9 with offset 0":
+	movq %r14, %rsi
+	leaq (%rsi), %rsi
+	movl %r12d, (%rsi)
+	#instruction start "12 = return 2, -1, 11":
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	movq -36(%rbp), %r13
+	movq -44(%rbp), %r14
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $912, %rsp
+	movq %rbx, -870(%rbp)
+	movq %r12, -878(%rbp)
+	movq %r13, -886(%rbp)
+	movq %r14, -894(%rbp)
+	movq %r15, -902(%rbp)
+.L3:
+	#instruction start "15 = proj3 13":
+	#instruction start "18 = alloc with size 10":
+	leaq -570(%rbp), %rsi
+	movq %rsi, -8(%rbp)
+	#instruction start "19 = set_zero_ptr 18, size: 10":
+	movq -8(%rbp), %rdi
+	movq $0, (%rdi)
+	movw $0, 8(%rdi)
+	#instruction start "20 = constant(0)":
+	movq $0, %r12
+	#instruction start "21 = 18 + 20":
+	movq -8(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "22 = constant(72)":
+	movl $72, %r12d
+	#instruction start "23 = constant(0)":
+	movq $0, %r14
+	#instruction start "24 = 23 + 21":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "25 = store 24 22, state: 19":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "26 = constant(109)":
+	movl $109, %r12d
+	#instruction start "27 = constant(1)":
+	movq $1, %r14
+	#instruction start "28 = 27 + 21":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "29 = store 28 26, state: 25":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "30 = constant(109)":
+	movl $109, %r12d
+	#instruction start "31 = constant(2)":
+	movq $2, %r14
+	#instruction start "32 = 31 + 21":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "33 = store 32 30, state: 29":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "34 = constant(109)":
+	movl $109, %r12d
+	#instruction start "35 = constant(3)":
+	movq $3, %r14
+	#instruction start "36 = 35 + 21":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "37 = store 36 34, state: 33":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "38 = constant(0)":
+	movl $0, %r12d
+	#instruction start "39 = constant(4)":
+	movq $4, %r14
+	#instruction start "40 = 39 + 21":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "41 = store 40 38, state: 37":
+	movq %r15, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "42 = alloc with size 12":
+	leaq -582(%rbp), %rsi
+	movq %rsi, -16(%rbp)
+	#instruction start "43 = set_zero_ptr 42, size: 12":
+	movq -16(%rbp), %rdi
+	movq $0, (%rdi)
+	movl $0, 8(%rdi)
+	#instruction start "44 = constant(72)":
+	movl $72, %r13d
+	#instruction start "45 = constant(0)":
+	movq $0, %r14
+	#instruction start "46 = 45 + 42":
+	movq %r14, %rax
+	movq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "47 = store 46 44, state: 43":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "48 = constant(101)":
+	movl $101, %r13d
+	#instruction start "49 = constant(1)":
+	movq $1, %r14
+	#instruction start "50 = 49 + 42":
+	movq %r14, %rax
+	movq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "51 = store 50 48, state: 47":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "52 = constant(108)":
+	movl $108, %r13d
+	#instruction start "53 = constant(2)":
+	movq $2, %r14
+	#instruction start "54 = 53 + 42":
+	movq %r14, %rax
+	movq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "55 = store 54 52, state: 51":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "56 = constant(108)":
+	movl $108, %r13d
+	#instruction start "57 = constant(3)":
+	movq $3, %r14
+	#instruction start "58 = 57 + 42":
+	movq %r14, %rax
+	movq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "59 = store 58 56, state: 55":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "60 = constant(111)":
+	movl $111, %r13d
+	#instruction start "61 = constant(4)":
+	movq $4, %r14
+	#instruction start "62 = 61 + 42":
+	movq %r14, %rax
+	movq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "63 = store 62 60, state: 59":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "64 = constant(32)":
+	movl $32, %r13d
+	#instruction start "65 = constant(5)":
+	movq $5, %r14
+	#instruction start "66 = 65 + 42":
+	movq %r14, %rax
+	movq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "67 = store 66 64, state: 63":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "68 = constant(119)":
+	movl $119, %r13d
+	#instruction start "69 = constant(6)":
+	movq $6, %r14
+	#instruction start "70 = 69 + 42":
+	movq %r14, %rax
+	movq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "71 = store 70 68, state: 67":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "72 = constant(111)":
+	movl $111, %r13d
+	#instruction start "73 = constant(7)":
+	movq $7, %r14
+	#instruction start "74 = 73 + 42":
+	movq %r14, %rax
+	movq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "75 = store 74 72, state: 71":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "76 = constant(114)":
+	movl $114, %r13d
+	#instruction start "77 = constant(8)":
+	movq $8, %r14
+	#instruction start "78 = 77 + 42":
+	movq %r14, %rax
+	movq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "79 = store 78 76, state: 75":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "80 = constant(108)":
+	movl $108, %r13d
+	#instruction start "81 = constant(9)":
+	movq $9, %r14
+	#instruction start "82 = 81 + 42":
+	movq %r14, %rax
+	movq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "83 = store 82 80, state: 79":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "84 = constant(100)":
+	movl $100, %r13d
+	#instruction start "85 = constant(10)":
+	movq $10, %r14
+	#instruction start "86 = 85 + 42":
+	movq %r14, %rax
+	movq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "87 = store 86 84, state: 83":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "88 = constant(0)":
+	movl $0, %r13d
+	#instruction start "89 = constant(11)":
+	movq $11, %r14
+	#instruction start "90 = 89 + 42":
+	movq %r14, %rax
+	movq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "91 = store 90 88, state: 87":
+	movq %r15, %rsi
+	movb %r13b, (%rsi)
+	#instruction start "92 = constant(1)":
+	movq $.LVAR0str, %r13
+	#instruction start "93 = constant(0)":
+	movq $.Ls0, %r14
+	#instruction start "94 = alloc with size 8":
+	leaq -590(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "95 = store 94 93, state: 91":
+	movq %r15, %rsi
+	movq %r14, (%rsi)
+	#instruction start "96 = constant(4)":
+	movq $strcmp, %r14
+	#instruction start "97 = constant(0)":
+	movq $0, %rbx
+	#instruction start "98 = load part address of 92 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "99 = proj0 98":
+	#instruction start "100 = proj1 98":
+	#instruction start "101 = load part address of 94 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "102 = proj0 101":
+	#instruction start "103 = proj1 101":
+	#instruction start "104 = allocate_call_stack 0":
+	#instruction start "105 = set_reg %rdi 100":
+	#instruction start "106 = set_reg %rsi 103 state: 105":
+	#instruction start "107 = set_reg %rax 97 state: 106":
+	#instruction start "108 = call 96":
+	addq $0, %rsp
+	movq %rbx, %rax
+	movq %r13, %rsi
+	movq %r12, %rdi
+	movq %r14, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r15
+	#instruction start "109 = proj0 108":
+	#instruction start "110 = proj1 108":
+	#instruction start "111 = %rax":
+	#instruction start "112 = int_cast_zero 111":
+	movq %r15, %rax
+	movl %eax, %ebx
+	#instruction start "113 = constant(0)":
+	movl $0, %r12d
+	#instruction start "114 = 112 == 113":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "116 = if 14 114":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L5
+.L4:
+	#instruction start "119 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "120 = constant(7)":
+	movq $.Ls7, %r12
+	#instruction start "121 = constant(17)":
+	movl $17, %r13d
+	#instruction start "122 = constant(8)":
+	movq $.Ls8, %r14
+	#instruction start "123 = alloc with size 8":
+	leaq -598(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "124 = store 123 119, state: 109":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "125 = alloc with size 8":
+	leaq -606(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "126 = store 125 120, state: 124":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "127 = alloc with size 4":
+	leaq -610(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "128 = store 127 121, state: 126":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "129 = alloc with size 8":
+	leaq -618(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "130 = store 129 122, state: 128":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "131 = constant(5)":
+	leaq -48(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "132 = constant(0)":
+	leaq -56(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "133 = load part address of 123 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "134 = proj0 133":
+	#instruction start "135 = proj1 133":
+	#instruction start "136 = load part address of 125 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "137 = proj0 136":
+	#instruction start "138 = proj1 136":
+	#instruction start "139 = load part address of 127 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "140 = proj0 139":
+	#instruction start "141 = proj1 139":
+	#instruction start "142 = load part address of 129 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "143 = proj0 142":
+	#instruction start "144 = proj1 142":
+	#instruction start "145 = allocate_call_stack 0":
+	#instruction start "146 = set_reg %rdi 135":
+	#instruction start "147 = set_reg %rsi 138 state: 146":
+	#instruction start "148 = set_reg %rdx 141 state: 147":
+	#instruction start "149 = set_reg %rcx 144 state: 148":
+	#instruction start "150 = set_reg %rax 132 state: 149":
+	#instruction start "151 = call 131":
+	addq $0, %rsp
+	movq -56(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -48(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "152 = proj0 151":
+	#instruction start "153 = proj1 151":
+	#Block jump
+	jmp .L6
+.L5:
+	#Block jump elided
+.L6:
+	#instruction start "154 = constant(1)":
+	movl $1, %ebx
+	#instruction start "156 = if 115 154":
+	#instruction start "164 = phi (region: 115) 109 152":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L8
+.L7:
+	#instruction start "159 = constant(9)":
+	movq $.Ls9, %rbx
+	#instruction start "160 = constant(7)":
+	movq $.Ls7, %r12
+	#instruction start "161 = constant(18)":
+	movl $18, %r13d
+	#instruction start "162 = constant(8)":
+	movq $.Ls8, %r14
+	#instruction start "163 = alloc with size 8":
+	leaq -626(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "165 = store 163 159, state: 164":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "166 = alloc with size 8":
+	leaq -634(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "167 = store 166 160, state: 165":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "168 = alloc with size 4":
+	leaq -638(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "169 = store 168 161, state: 167":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "170 = alloc with size 8":
+	leaq -646(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "171 = store 170 162, state: 169":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "172 = constant(5)":
+	leaq -104(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "173 = constant(0)":
+	leaq -112(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "174 = load part address of 163 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "175 = proj0 174":
+	#instruction start "176 = proj1 174":
+	#instruction start "177 = load part address of 166 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "178 = proj0 177":
+	#instruction start "179 = proj1 177":
+	#instruction start "180 = load part address of 168 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "181 = proj0 180":
+	#instruction start "182 = proj1 180":
+	#instruction start "183 = load part address of 170 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "184 = proj0 183":
+	#instruction start "185 = proj1 183":
+	#instruction start "186 = allocate_call_stack 0":
+	#instruction start "187 = set_reg %rdi 176":
+	#instruction start "188 = set_reg %rsi 179 state: 187":
+	#instruction start "189 = set_reg %rdx 182 state: 188":
+	#instruction start "190 = set_reg %rcx 185 state: 189":
+	#instruction start "191 = set_reg %rax 173 state: 190":
+	#instruction start "192 = call 172":
+	addq $0, %rsp
+	movq -112(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -104(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "193 = proj0 192":
+	#instruction start "194 = proj1 192":
+	#Block jump
+	jmp .L9
+.L8:
+	#Block jump elided
+.L9:
+	#instruction start "195 = constant(1)":
+	movl $1, %ebx
+	#instruction start "197 = if 155 195":
+	#instruction start "205 = phi (region: 155) 164 193":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L11
+.L10:
+	#instruction start "200 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "201 = constant(7)":
+	movq $.Ls7, %r12
+	#instruction start "202 = constant(19)":
+	movl $19, %r13d
+	#instruction start "203 = constant(8)":
+	movq $.Ls8, %r14
+	#instruction start "204 = alloc with size 8":
+	leaq -654(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "206 = store 204 200, state: 205":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "207 = alloc with size 8":
+	leaq -662(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "208 = store 207 201, state: 206":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "209 = alloc with size 4":
+	leaq -666(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "210 = store 209 202, state: 208":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "211 = alloc with size 8":
+	leaq -674(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "212 = store 211 203, state: 210":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "213 = constant(5)":
+	leaq -160(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "214 = constant(0)":
+	leaq -168(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "215 = load part address of 204 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "216 = proj0 215":
+	#instruction start "217 = proj1 215":
+	#instruction start "218 = load part address of 207 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "219 = proj0 218":
+	#instruction start "220 = proj1 218":
+	#instruction start "221 = load part address of 209 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "222 = proj0 221":
+	#instruction start "223 = proj1 221":
+	#instruction start "224 = load part address of 211 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "225 = proj0 224":
+	#instruction start "226 = proj1 224":
+	#instruction start "227 = allocate_call_stack 0":
+	#instruction start "228 = set_reg %rdi 217":
+	#instruction start "229 = set_reg %rsi 220 state: 228":
+	#instruction start "230 = set_reg %rdx 223 state: 229":
+	#instruction start "231 = set_reg %rcx 226 state: 230":
+	#instruction start "232 = set_reg %rax 214 state: 231":
+	#instruction start "233 = call 213":
+	addq $0, %rsp
+	movq -168(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -160(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "234 = proj0 233":
+	#instruction start "235 = proj1 233":
+	#Block jump
+	jmp .L12
+.L11:
+	#Block jump elided
+.L12:
+	#instruction start "236 = constant(0)":
+	movq $.Ls0, %rbx
+	#instruction start "237 = alloc with size 8":
+	leaq -682(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "238 = constant(2)":
+	movq $.LVAR1str_arr, %r13
+	#instruction start "239 = phi (region: 196) 205 234":
+	#instruction start "240 = store 237 238, state: 239":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "241 = alloc with size 8":
+	leaq -690(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "242 = store 241 236, state: 240":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "243 = constant(4)":
+	movq $strcmp, %rbx
+	#instruction start "244 = constant(0)":
+	movq $0, %r14
+	#instruction start "245 = load part address of 237 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "246 = proj0 245":
+	#instruction start "247 = proj1 245":
+	#instruction start "248 = load part address of 241 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "249 = proj0 248":
+	#instruction start "250 = proj1 248":
+	#instruction start "251 = allocate_call_stack 0":
+	#instruction start "252 = set_reg %rdi 247":
+	#instruction start "253 = set_reg %rsi 250 state: 252":
+	#instruction start "254 = set_reg %rax 244 state: 253":
+	#instruction start "255 = call 243":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r12, %rsi
+	movq %r15, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "256 = proj0 255":
+	#instruction start "257 = proj1 255":
+	#instruction start "258 = %rax":
+	#instruction start "259 = int_cast_zero 258":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "260 = constant(0)":
+	movl $0, %r12d
+	#instruction start "261 = 259 == 260":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "263 = if 196 261":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L14
+.L13:
+	#instruction start "266 = constant(11)":
+	movq $.Ls11, %rbx
+	#instruction start "267 = constant(7)":
+	movq $.Ls7, %r12
+	#instruction start "268 = constant(20)":
+	movl $20, %r13d
+	#instruction start "269 = constant(8)":
+	movq $.Ls8, %r14
+	#instruction start "270 = alloc with size 8":
+	leaq -698(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "271 = store 270 266, state: 256":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "272 = alloc with size 8":
+	leaq -706(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "273 = store 272 267, state: 271":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "274 = alloc with size 4":
+	leaq -710(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "275 = store 274 268, state: 273":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "276 = alloc with size 8":
+	leaq -718(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "277 = store 276 269, state: 275":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "278 = constant(5)":
+	leaq -240(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "279 = constant(0)":
+	leaq -248(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "280 = load part address of 270 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "281 = proj0 280":
+	#instruction start "282 = proj1 280":
+	#instruction start "283 = load part address of 272 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "284 = proj0 283":
+	#instruction start "285 = proj1 283":
+	#instruction start "286 = load part address of 274 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "287 = proj0 286":
+	#instruction start "288 = proj1 286":
+	#instruction start "289 = load part address of 276 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "290 = proj0 289":
+	#instruction start "291 = proj1 289":
+	#instruction start "292 = allocate_call_stack 0":
+	#instruction start "293 = set_reg %rdi 282":
+	#instruction start "294 = set_reg %rsi 285 state: 293":
+	#instruction start "295 = set_reg %rdx 288 state: 294":
+	#instruction start "296 = set_reg %rcx 291 state: 295":
+	#instruction start "297 = set_reg %rax 279 state: 296":
+	#instruction start "298 = call 278":
+	addq $0, %rsp
+	movq -248(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -240(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "299 = proj0 298":
+	#instruction start "300 = proj1 298":
+	#Block jump
+	jmp .L15
+.L14:
+	#Block jump elided
+.L15:
+	#instruction start "301 = constant(0)":
+	movq $.Ls0, %rbx
+	#instruction start "302 = alloc with size 8":
+	leaq -726(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "303 = constant(3)":
+	movq $.LVAR2str_arr2, %r13
+	#instruction start "304 = phi (region: 262) 256 299":
+	#instruction start "305 = store 302 303, state: 304":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "306 = alloc with size 8":
+	leaq -734(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "307 = store 306 301, state: 305":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "308 = constant(4)":
+	movq $strcmp, %rbx
+	#instruction start "309 = constant(0)":
+	movq $0, %r14
+	#instruction start "310 = load part address of 302 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "311 = proj0 310":
+	#instruction start "312 = proj1 310":
+	#instruction start "313 = load part address of 306 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "314 = proj0 313":
+	#instruction start "315 = proj1 313":
+	#instruction start "316 = allocate_call_stack 0":
+	#instruction start "317 = set_reg %rdi 312":
+	#instruction start "318 = set_reg %rsi 315 state: 317":
+	#instruction start "319 = set_reg %rax 309 state: 318":
+	#instruction start "320 = call 308":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r12, %rsi
+	movq %r15, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "321 = proj0 320":
+	#instruction start "322 = proj1 320":
+	#instruction start "323 = %rax":
+	#instruction start "324 = int_cast_zero 323":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "325 = constant(0)":
+	movl $0, %r12d
+	#instruction start "326 = 324 == 325":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "328 = if 262 326":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L17
+.L16:
+	#instruction start "331 = constant(12)":
+	movq $.Ls12, %rbx
+	#instruction start "332 = constant(7)":
+	movq $.Ls7, %r12
+	#instruction start "333 = constant(21)":
+	movl $21, %r13d
+	#instruction start "334 = constant(8)":
+	movq $.Ls8, %r14
+	#instruction start "335 = alloc with size 8":
+	leaq -742(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "336 = store 335 331, state: 321":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "337 = alloc with size 8":
+	leaq -750(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "338 = store 337 332, state: 336":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "339 = alloc with size 4":
+	leaq -754(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "340 = store 339 333, state: 338":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "341 = alloc with size 8":
+	leaq -762(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "342 = store 341 334, state: 340":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "343 = constant(5)":
+	leaq -320(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "344 = constant(0)":
+	leaq -328(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "345 = load part address of 335 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "346 = proj0 345":
+	#instruction start "347 = proj1 345":
+	#instruction start "348 = load part address of 337 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "349 = proj0 348":
+	#instruction start "350 = proj1 348":
+	#instruction start "351 = load part address of 339 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "352 = proj0 351":
+	#instruction start "353 = proj1 351":
+	#instruction start "354 = load part address of 341 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "355 = proj0 354":
+	#instruction start "356 = proj1 354":
+	#instruction start "357 = allocate_call_stack 0":
+	#instruction start "358 = set_reg %rdi 347":
+	#instruction start "359 = set_reg %rsi 350 state: 358":
+	#instruction start "360 = set_reg %rdx 353 state: 359":
+	#instruction start "361 = set_reg %rcx 356 state: 360":
+	#instruction start "362 = set_reg %rax 344 state: 361":
+	#instruction start "363 = call 343":
+	addq $0, %rsp
+	movq -328(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -320(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "364 = proj0 363":
+	#instruction start "365 = proj1 363":
+	#Block jump
+	jmp .L18
+.L17:
+	#Block jump elided
+.L18:
+	#instruction start "366 = constant(0)":
+	movq $.Ls0, %rbx
+	#instruction start "367 = alloc with size 8":
+	leaq -770(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "368 = phi (region: 327) 321 364":
+	#instruction start "369 = store 367 42, state: 368":
+	movq %r12, %rsi
+	leaq -16(%rbp), %rdi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	#instruction start "370 = alloc with size 8":
+	leaq -778(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "371 = store 370 366, state: 369":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "372 = constant(4)":
+	movq $strcmp, %rbx
+	#instruction start "373 = constant(0)":
+	movq $0, %r14
+	#instruction start "374 = load part address of 367 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "375 = proj0 374":
+	#instruction start "376 = proj1 374":
+	#instruction start "377 = load part address of 370 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "378 = proj0 377":
+	#instruction start "379 = proj1 377":
+	#instruction start "380 = allocate_call_stack 0":
+	#instruction start "381 = set_reg %rdi 376":
+	#instruction start "382 = set_reg %rsi 379 state: 381":
+	#instruction start "383 = set_reg %rax 373 state: 382":
+	#instruction start "384 = call 372":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r12, %rsi
+	movq %r15, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "385 = proj0 384":
+	#instruction start "386 = proj1 384":
+	#instruction start "387 = %rax":
+	#instruction start "388 = int_cast_zero 387":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "389 = constant(0)":
+	movl $0, %r12d
+	#instruction start "390 = 388 == 389":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "392 = if 327 390":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L20
+.L19:
+	#instruction start "395 = constant(13)":
+	movq $.Ls13, %rbx
+	#instruction start "396 = constant(7)":
+	movq $.Ls7, %r12
+	#instruction start "397 = constant(22)":
+	movl $22, %r13d
+	#instruction start "398 = constant(8)":
+	movq $.Ls8, %r14
+	#instruction start "399 = alloc with size 8":
+	leaq -786(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "400 = store 399 395, state: 385":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "401 = alloc with size 8":
+	leaq -794(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "402 = store 401 396, state: 400":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "403 = alloc with size 4":
+	leaq -798(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "404 = store 403 397, state: 402":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "405 = alloc with size 8":
+	leaq -806(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "406 = store 405 398, state: 404":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "407 = constant(5)":
+	leaq -400(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "408 = constant(0)":
+	leaq -408(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "409 = load part address of 399 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "410 = proj0 409":
+	#instruction start "411 = proj1 409":
+	#instruction start "412 = load part address of 401 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "413 = proj0 412":
+	#instruction start "414 = proj1 412":
+	#instruction start "415 = load part address of 403 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "416 = proj0 415":
+	#instruction start "417 = proj1 415":
+	#instruction start "418 = load part address of 405 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "419 = proj0 418":
+	#instruction start "420 = proj1 418":
+	#instruction start "421 = allocate_call_stack 0":
+	#instruction start "422 = set_reg %rdi 411":
+	#instruction start "423 = set_reg %rsi 414 state: 422":
+	#instruction start "424 = set_reg %rdx 417 state: 423":
+	#instruction start "425 = set_reg %rcx 420 state: 424":
+	#instruction start "426 = set_reg %rax 408 state: 425":
+	#instruction start "427 = call 407":
+	addq $0, %rsp
+	movq -408(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -400(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "428 = proj0 427":
+	#instruction start "429 = proj1 427":
+	#Block jump
+	jmp .L21
+.L20:
+	#Block jump elided
+.L21:
+	#instruction start "430 = constant(0)":
+	movq $0, %rbx
+	#instruction start "431 = 18 + 430":
+	movq -8(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "432 = constant(14)":
+	movq $.Ls14, %rbx
+	#instruction start "433 = alloc with size 8":
+	leaq -814(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "434 = phi (region: 391) 385 428":
+	#instruction start "435 = store 433 431, state: 434":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "436 = alloc with size 8":
+	leaq -822(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "437 = store 436 432, state: 435":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "438 = constant(4)":
+	movq $strcmp, %rbx
+	#instruction start "439 = constant(0)":
+	movq $0, %r14
+	#instruction start "440 = load part address of 433 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "441 = proj0 440":
+	#instruction start "442 = proj1 440":
+	#instruction start "443 = load part address of 436 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "444 = proj0 443":
+	#instruction start "445 = proj1 443":
+	#instruction start "446 = allocate_call_stack 0":
+	#instruction start "447 = set_reg %rdi 442":
+	#instruction start "448 = set_reg %rsi 445 state: 447":
+	#instruction start "449 = set_reg %rax 439 state: 448":
+	#instruction start "450 = call 438":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r12
+	#instruction start "451 = proj0 450":
+	#instruction start "452 = proj1 450":
+	#instruction start "453 = %rax":
+	#instruction start "454 = int_cast_zero 453":
+	movq %r12, %rax
+	movl %eax, %ebx
+	#instruction start "455 = constant(0)":
+	movl $0, %r12d
+	#instruction start "456 = 454 == 455":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "458 = if 391 456":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L23
+.L22:
+	#instruction start "461 = constant(15)":
+	movq $.Ls15, %rbx
+	#instruction start "462 = constant(7)":
+	movq $.Ls7, %r12
+	#instruction start "463 = constant(23)":
+	movl $23, %r13d
+	#instruction start "464 = constant(8)":
+	movq $.Ls8, %r14
+	#instruction start "465 = alloc with size 8":
+	leaq -830(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "466 = store 465 461, state: 451":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "467 = alloc with size 8":
+	leaq -838(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "468 = store 467 462, state: 466":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "469 = alloc with size 4":
+	leaq -842(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "470 = store 469 463, state: 468":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "471 = alloc with size 8":
+	leaq -850(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "472 = store 471 464, state: 470":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "473 = constant(5)":
+	leaq -480(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "474 = constant(0)":
+	leaq -488(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "475 = load part address of 465 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "476 = proj0 475":
+	#instruction start "477 = proj1 475":
+	#instruction start "478 = load part address of 467 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "479 = proj0 478":
+	#instruction start "480 = proj1 478":
+	#instruction start "481 = load part address of 469 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "482 = proj0 481":
+	#instruction start "483 = proj1 481":
+	#instruction start "484 = load part address of 471 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "485 = proj0 484":
+	#instruction start "486 = proj1 484":
+	#instruction start "487 = allocate_call_stack 0":
+	#instruction start "488 = set_reg %rdi 477":
+	#instruction start "489 = set_reg %rsi 480 state: 488":
+	#instruction start "490 = set_reg %rdx 483 state: 489":
+	#instruction start "491 = set_reg %rcx 486 state: 490":
+	#instruction start "492 = set_reg %rax 474 state: 491":
+	#instruction start "493 = call 473":
+	addq $0, %rsp
+	movq -488(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -480(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "494 = proj0 493":
+	#instruction start "495 = proj1 493":
+	#Block jump
+	jmp .L24
+.L23:
+	#Block jump elided
+.L24:
+	#instruction start "496 = constant(17)":
+	movq $.Ls17, %rbx
+	#instruction start "497 = constant(6)":
+	movl $6, %r12d
+	#instruction start "498 = alloc with size 8":
+	leaq -858(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "499 = phi (region: 457) 451 494":
+	#instruction start "500 = store 498 496, state: 499":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "501 = alloc with size 4":
+	leaq -862(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "502 = store 501 497, state: 500":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "503 = constant(16)":
+	movq $function, %r12
+	#instruction start "504 = constant(0)":
+	movq $0, %r14
+	#instruction start "505 = load part address of 498 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "506 = proj0 505":
+	#instruction start "507 = proj1 505":
+	#instruction start "508 = load part address of 501 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r13d
+	#instruction start "509 = proj0 508":
+	#instruction start "510 = proj1 508":
+	#instruction start "511 = allocate_call_stack 0":
+	#instruction start "512 = set_reg %rdi 507":
+	#instruction start "513 = set_reg %rsi 510 state: 512":
+	#instruction start "514 = set_reg %rax 504 state: 513":
+	#instruction start "515 = call 503":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "516 = proj0 515":
+	#instruction start "517 = proj1 515":
+	#instruction start "518 = constant(0)":
+	movl $0, %ebx
+	#instruction start "519 = set_reg %rax 518":
+	#instruction start "520 = return 457, 519, 516":
+	movq %rbx, %rax
+	#Block return.
+	movq -870(%rbp), %rbx
+	movq -878(%rbp), %r12
+	movq -886(%rbp), %r13
+	movq -894(%rbp), %r14
+	movq -902(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls0:
+	.string "Hello world\000"
+.Ls6:
+	.string "strcmp(str, \"Hello world\") == 0\000"
+.Ls7:
+	.string "tests/static_strings.c\000"
+.Ls8:
+	.string "main"
+.Ls9:
+	.string "sizeof str_arr == 12\000"
+.Ls10:
+	.string "sizeof str_arr2 == 40\000"
+.Ls11:
+	.string "strcmp(str_arr, \"Hello world\") == 0\000"
+.Ls12:
+	.string "strcmp(str_arr2, \"Hello world\") == 0\000"
+.Ls13:
+	.string "strcmp(str_arr_local, \"Hello world\") == 0\000"
+.Ls14:
+	.string "Hmmm\000"
+.Ls15:
+	.string "strcmp(aggregate.arr1, \"Hmmm\") == 0\000"
+.Ls17:
+	.string "string\000"
+.section .data
+.align 8
+.LVAR0str:
+.quad .Ls0
+.section .text
+.section .data
+.align 1
+.LVAR1str_arr:
+.quad 8031924123371070792
+.byte 114
+.byte 108
+.byte 100
+.byte 0
+.section .text
+.section .data
+.align 1
+.LVAR2str_arr2:
+.quad 8031924123371070792
+.quad 6581362
+.quad 0
+.quad 0
+.quad 0
+.section .text
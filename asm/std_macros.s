@@ -0,0 +1,310 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $272, %rsp
+	movq %rbx, -232(%rbp)
+	movq %r12, -240(%rbp)
+	movq %r13, -248(%rbp)
+	movq %r14, -256(%rbp)
+	movq %r15, -264(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "7 = alloc with size 8":
+	leaq -160(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "8 = store 7 6, state: 3":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "9 = constant(0)":
+	movq $strlen, %rbx
+	#instruction start "10 = constant(0)":
+	movq $0, %r13
+	#instruction start "11 = load part address of 7 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "12 = proj0 11":
+	#instruction start "13 = proj1 11":
+	#instruction start "14 = allocate_call_stack 0":
+	#instruction start "15 = set_reg %rdi 13":
+	#instruction start "16 = set_reg %rax 10 state: 15":
+	#instruction start "17 = call 9":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r12
+	#instruction start "18 = proj0 17":
+	#instruction start "19 = proj1 17":
+	#instruction start "20 = %rax":
+	#instruction start "21 = int_cast_zero 20":
+	movq %r12, %rax
+	movq %rax, %rbx
+	#instruction start "22 = constant(11)":
+	movq $11, %r12
+	#instruction start "23 = 21 == 22":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "25 = if 2 23":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "28 = constant(3)":
+	movq $.Ls3, %rbx
+	#instruction start "29 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "30 = constant(6)":
+	movl $6, %r13d
+	#instruction start "31 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "32 = alloc with size 8":
+	leaq -168(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "33 = store 32 28, state: 18":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "34 = alloc with size 8":
+	leaq -176(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "35 = store 34 29, state: 33":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "36 = alloc with size 4":
+	leaq -180(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "37 = store 36 30, state: 35":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "38 = alloc with size 8":
+	leaq -188(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "39 = store 38 31, state: 37":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "40 = constant(2)":
+	leaq -24(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "41 = constant(0)":
+	leaq -32(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "42 = load part address of 32 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "43 = proj0 42":
+	#instruction start "44 = proj1 42":
+	#instruction start "45 = load part address of 34 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "46 = proj0 45":
+	#instruction start "47 = proj1 45":
+	#instruction start "48 = load part address of 36 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "49 = proj0 48":
+	#instruction start "50 = proj1 48":
+	#instruction start "51 = load part address of 38 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "52 = proj0 51":
+	#instruction start "53 = proj1 51":
+	#instruction start "54 = allocate_call_stack 0":
+	#instruction start "55 = set_reg %rdi 44":
+	#instruction start "56 = set_reg %rsi 47 state: 55":
+	#instruction start "57 = set_reg %rdx 50 state: 56":
+	#instruction start "58 = set_reg %rcx 53 state: 57":
+	#instruction start "59 = set_reg %rax 41 state: 58":
+	#instruction start "60 = call 40":
+	addq $0, %rsp
+	movq -32(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -24(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "61 = proj0 60":
+	#instruction start "62 = proj1 60":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "63 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "64 = alloc with size 8":
+	leaq -196(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "65 = phi (region: 24) 18 61":
+	#instruction start "66 = store 64 63, state: 65":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "67 = constant(0)":
+	movq $strlen, %rbx
+	#instruction start "68 = constant(0)":
+	movq $0, %r13
+	#instruction start "69 = load part address of 64 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "70 = proj0 69":
+	#instruction start "71 = proj1 69":
+	#instruction start "72 = allocate_call_stack 0":
+	#instruction start "73 = set_reg %rdi 71":
+	#instruction start "74 = set_reg %rax 68 state: 73":
+	#instruction start "75 = call 67":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r12
+	#instruction start "76 = proj0 75":
+	#instruction start "77 = proj1 75":
+	#instruction start "78 = %rax":
+	#instruction start "79 = int_cast_zero 78":
+	movq %r12, %rax
+	movq %rax, %rbx
+	#instruction start "80 = constant(8)":
+	movq $8, %r12
+	#instruction start "81 = 79 == 80":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "83 = if 24 81":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "86 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "87 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "88 = constant(7)":
+	movl $7, %r13d
+	#instruction start "89 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "90 = alloc with size 8":
+	leaq -204(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "91 = store 90 86, state: 76":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "92 = alloc with size 8":
+	leaq -212(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "93 = store 92 87, state: 91":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "94 = alloc with size 4":
+	leaq -216(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "95 = store 94 88, state: 93":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "96 = alloc with size 8":
+	leaq -224(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "97 = store 96 89, state: 95":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "98 = constant(2)":
+	leaq -96(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "99 = constant(0)":
+	leaq -104(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "100 = load part address of 90 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "101 = proj0 100":
+	#instruction start "102 = proj1 100":
+	#instruction start "103 = load part address of 92 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "104 = proj0 103":
+	#instruction start "105 = proj1 103":
+	#instruction start "106 = load part address of 94 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "107 = proj0 106":
+	#instruction start "108 = proj1 106":
+	#instruction start "109 = load part address of 96 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "110 = proj0 109":
+	#instruction start "111 = proj1 109":
+	#instruction start "112 = allocate_call_stack 0":
+	#instruction start "113 = set_reg %rdi 102":
+	#instruction start "114 = set_reg %rsi 105 state: 113":
+	#instruction start "115 = set_reg %rdx 108 state: 114":
+	#instruction start "116 = set_reg %rcx 111 state: 115":
+	#instruction start "117 = set_reg %rax 99 state: 116":
+	#instruction start "118 = call 98":
+	addq $0, %rsp
+	movq -104(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -96(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "119 = proj0 118":
+	#instruction start "120 = proj1 118":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "121 = constant(0)":
+	movl $0, %ebx
+	#instruction start "122 = set_reg %rax 121":
+	#instruction start "123 = phi (region: 82) 76 119":
+	#instruction start "124 = return 82, 122, 123":
+	movq %rbx, %rax
+	#Block return.
+	movq -232(%rbp), %rbx
+	movq -240(%rbp), %r12
+	movq -248(%rbp), %r13
+	movq -256(%rbp), %r14
+	movq -264(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "Oct 18 2026\000"
+.Ls3:
+	.string "strlen(__DATE__) == 11\000"
+.Ls4:
+	.string "tests/std_macros.c\000"
+.Ls5:
+	.string "main"
+.Ls6:
+	.string "09:58:27\000"
+.Ls7:
+	.string "strlen(__TIME__) == 8\000"
@@ -0,0 +1,136 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movq %rbx, -44(%rbp)
+	movq %r12, -52(%rbp)
+	movq %r13, -60(%rbp)
+	movq %r14, -68(%rbp)
+	movl %edi, %ebx
+	movq %rsi, %r12
+.L2:
+	#Block jump elided
+.L3:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = %rsi":
+	#instruction start "8 = alloc with size 4":
+	leaq -28(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "9 = alloc with size 8":
+	leaq -36(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "10 = store part of 8 with offset 0":
+	movq %r13, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "11 = store part of 9 with offset 0":
+	movq %r14, %rsi
+	leaq (%rsi), %rsi
+	movq %r12, (%rsi)
+	#instruction start "14 = constant(10)":
+	movl $10, %ebx
+	#instruction start "22 = constant(0)":
+	movl $0, %r12d
+	#instruction start "23 = 14 == 22":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "24 = if 18 23":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L15
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "36 = constant(10)":
+	movl $10, %r12d
+	#instruction start "37 = 14 == 36":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "38 = if 21 37":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L12
+.L6:
+	#Block jump elided
+.L7:
+	#instruction start "43 = constant(2)":
+	movl $2, %r12d
+	#instruction start "44 = 14 == 43":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "45 = if 35 44":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L11
+.L8:
+	#Block jump elided
+.L9:
+	#Block jump elided
+.L10:
+	#instruction start "58 = constant(1)":
+	movl $1, %ebx
+	#instruction start "59 = set_reg %rax 58":
+	#instruction start "60 = phi (region: 57) 63 11":
+	#instruction start "61 = return 57, 59, 60":
+	movq %rbx, %rax
+	#Block return.
+	movq -44(%rbp), %rbx
+	movq -52(%rbp), %r12
+	movq -60(%rbp), %r13
+	movq -68(%rbp), %r14
+	leave 
+	ret 
+.L11:
+	#Block jump
+	jmp .L14
+.L12:
+	#Block jump elided
+.L13:
+	#instruction start "51 = phi (region: 34) 52 11":
+	#Block jump elided
+.L14:
+	#instruction start "48 = constant(0)":
+	movl $0, %ebx
+	#instruction start "49 = set_reg %rax 48":
+	#instruction start "50 = phi (region: 41) 51 11":
+	#instruction start "55 = return 41, 49, 50":
+	movq %rbx, %rax
+	#Block return.
+	movq -44(%rbp), %rbx
+	movq -52(%rbp), %r12
+	movq -60(%rbp), %r13
+	movq -68(%rbp), %r14
+	leave 
+	ret 
+.L15:
+	#Block jump elided
+.L16:
+	#instruction start "27 = constant(12)":
+	movl $12, %ebx
+	#instruction start "28 = set_reg %rax 27":
+	#instruction start "29 = phi (region: 20) 30 11":
+	#instruction start "32 = return 20, 28, 29":
+	movq %rbx, %rax
+	#Block return.
+	movq -44(%rbp), %rbx
+	movq -52(%rbp), %r12
+	movq -60(%rbp), %r13
+	movq -68(%rbp), %r14
+	leave 
+	ret 
+.section .rodata
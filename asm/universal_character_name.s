@@ -0,0 +1,2122 @@
+.global funcሴh
+funcሴh:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movl %edi, %ebx
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "8 = store part of 7 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "9 = load 7, state: 8":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "10 = set_reg %rax 9":
+	#instruction start "11 = return 2, 10, 8":
+	movq %rbx, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	leave 
+	ret 
+.global funcሴ1234h
+funcሴ1234h:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movl %edi, %ebx
+.L3:
+	#instruction start "15 = proj3 13":
+	#instruction start "16 = proj1 13":
+	#instruction start "18 = %rdi":
+	#instruction start "19 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "20 = store part of 19 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "21 = load 19, state: 20":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "22 = set_reg %rax 21":
+	#instruction start "23 = return 14, 22, 20":
+	movq %rbx, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	leave 
+	ret 
+.global func𒈓
+func𒈓:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movl %edi, %ebx
+.L4:
+	#instruction start "27 = proj3 25":
+	#instruction start "28 = proj1 25":
+	#instruction start "30 = %rdi":
+	#instruction start "31 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "32 = store part of 31 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "33 = load 31, state: 32":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "34 = set_reg %rax 33":
+	#instruction start "35 = return 26, 34, 32":
+	movq %rbx, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	leave 
+	ret 
+.global 𒈓
+𒈓:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movl %edi, %ebx
+.L5:
+	#instruction start "39 = proj3 37":
+	#instruction start "40 = proj1 37":
+	#instruction start "42 = %rdi":
+	#instruction start "43 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "44 = store part of 43 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "45 = load 43, state: 44":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "46 = set_reg %rax 45":
+	#instruction start "47 = return 38, 46, 44":
+	movq %rbx, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	leave 
+	ret 
+.global 😀
+😀:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movq %r13, -36(%rbp)
+	movl %edi, %ebx
+.L6:
+	#instruction start "51 = proj3 49":
+	#instruction start "52 = proj1 49":
+	#instruction start "54 = %rdi":
+	#instruction start "55 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "56 = store part of 55 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "59 = load 55, state: 56":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "60 = load 55, state: 56":
+	movq %r12, %rdi
+	movl (%rdi), %r13d
+	#instruction start "61 = 59 * 60 (signed)":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	imull %ecx, %eax
+	movl %eax, %r12d
+	#instruction start "64 = set_reg %rax 61":
+	#instruction start "65 = return 50, 64, 56":
+	movq %r12, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	movq -36(%rbp), %r13
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $1568, %rsp
+	movq %rbx, -1536(%rbp)
+	movq %r12, -1544(%rbp)
+	movq %r13, -1552(%rbp)
+	movq %r14, -1560(%rbp)
+	movq %r15, -1568(%rbp)
+.L7:
+	#instruction start "69 = proj3 67":
+	#instruction start "72 = alloc with size 4":
+	leaq -1044(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "73 = constant(2)":
+	movl $2, %r12d
+	#instruction start "74 = store 72 73, state: 69":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "75 = constant(0)":
+	movq $😀, %r12
+	#instruction start "76 = constant(0)":
+	movq $0, %r13
+	#instruction start "77 = load part address of 72 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "78 = proj0 77":
+	#instruction start "79 = proj1 77":
+	#instruction start "80 = allocate_call_stack 0":
+	#instruction start "81 = set_reg %rdi 79":
+	#instruction start "82 = set_reg %rax 76 state: 81":
+	#instruction start "83 = call 75":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "84 = proj0 83":
+	#instruction start "85 = proj1 83":
+	#instruction start "86 = %rax":
+	#instruction start "87 = int_cast_zero 86":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "88 = constant(4)":
+	movl $4, %ebx
+	#instruction start "89 = 87 == 88":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "91 = if 68 89":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L9
+.L8:
+	#instruction start "94 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "95 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "96 = constant(26)":
+	movl $26, %r13d
+	#instruction start "97 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "98 = alloc with size 8":
+	leaq -1052(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "99 = store 98 94, state: 84":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "100 = alloc with size 8":
+	leaq -1060(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "101 = store 100 95, state: 99":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "102 = alloc with size 4":
+	leaq -1064(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "103 = store 102 96, state: 101":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "104 = alloc with size 8":
+	leaq -1072(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "105 = store 104 97, state: 103":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "106 = constant(1)":
+	leaq -24(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "107 = constant(0)":
+	leaq -32(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "108 = load part address of 98 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "109 = proj0 108":
+	#instruction start "110 = proj1 108":
+	#instruction start "111 = load part address of 100 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "112 = proj0 111":
+	#instruction start "113 = proj1 111":
+	#instruction start "114 = load part address of 102 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "115 = proj0 114":
+	#instruction start "116 = proj1 114":
+	#instruction start "117 = load part address of 104 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "118 = proj0 117":
+	#instruction start "119 = proj1 117":
+	#instruction start "120 = allocate_call_stack 0":
+	#instruction start "121 = set_reg %rdi 110":
+	#instruction start "122 = set_reg %rsi 113 state: 121":
+	#instruction start "123 = set_reg %rdx 116 state: 122":
+	#instruction start "124 = set_reg %rcx 119 state: 123":
+	#instruction start "125 = set_reg %rax 107 state: 124":
+	#instruction start "126 = call 106":
+	addq $0, %rsp
+	movq -32(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -24(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "127 = proj0 126":
+	#instruction start "128 = proj1 126":
+	#Block jump
+	jmp .L10
+.L9:
+	#Block jump elided
+.L10:
+	#instruction start "129 = alloc with size 4":
+	leaq -1076(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "130 = constant(10)":
+	movl $10, %r12d
+	#instruction start "131 = phi (region: 90) 84 127":
+	#instruction start "132 = store 129 130, state: 131":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "133 = constant(5)":
+	movq $funcሴh, %r12
+	#instruction start "134 = constant(0)":
+	movq $0, %r13
+	#instruction start "135 = load part address of 129 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "136 = proj0 135":
+	#instruction start "137 = proj1 135":
+	#instruction start "138 = allocate_call_stack 0":
+	#instruction start "139 = set_reg %rdi 137":
+	#instruction start "140 = set_reg %rax 134 state: 139":
+	#instruction start "141 = call 133":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "142 = proj0 141":
+	#instruction start "143 = proj1 141":
+	#instruction start "144 = %rax":
+	#instruction start "145 = int_cast_zero 144":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "146 = constant(10)":
+	movl $10, %ebx
+	#instruction start "147 = 145 == 146":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "149 = if 90 147":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L12
+.L11:
+	#instruction start "152 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "153 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "154 = constant(28)":
+	movl $28, %r13d
+	#instruction start "155 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "156 = alloc with size 8":
+	leaq -1084(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "157 = store 156 152, state: 142":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "158 = alloc with size 8":
+	leaq -1092(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "159 = store 158 153, state: 157":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "160 = alloc with size 4":
+	leaq -1096(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "161 = store 160 154, state: 159":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "162 = alloc with size 8":
+	leaq -1104(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "163 = store 162 155, state: 161":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "164 = constant(1)":
+	leaq -96(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "165 = constant(0)":
+	leaq -104(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "166 = load part address of 156 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "167 = proj0 166":
+	#instruction start "168 = proj1 166":
+	#instruction start "169 = load part address of 158 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "170 = proj0 169":
+	#instruction start "171 = proj1 169":
+	#instruction start "172 = load part address of 160 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "173 = proj0 172":
+	#instruction start "174 = proj1 172":
+	#instruction start "175 = load part address of 162 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "176 = proj0 175":
+	#instruction start "177 = proj1 175":
+	#instruction start "178 = allocate_call_stack 0":
+	#instruction start "179 = set_reg %rdi 168":
+	#instruction start "180 = set_reg %rsi 171 state: 179":
+	#instruction start "181 = set_reg %rdx 174 state: 180":
+	#instruction start "182 = set_reg %rcx 177 state: 181":
+	#instruction start "183 = set_reg %rax 165 state: 182":
+	#instruction start "184 = call 164":
+	addq $0, %rsp
+	movq -104(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -96(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "185 = proj0 184":
+	#instruction start "186 = proj1 184":
+	#Block jump
+	jmp .L13
+.L12:
+	#Block jump elided
+.L13:
+	#instruction start "187 = alloc with size 4":
+	leaq -1108(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "188 = constant(10)":
+	movl $10, %r12d
+	#instruction start "189 = phi (region: 148) 142 185":
+	#instruction start "190 = store 187 188, state: 189":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "191 = constant(7)":
+	movq $funcሴ1234h, %r12
+	#instruction start "192 = constant(0)":
+	movq $0, %r13
+	#instruction start "193 = load part address of 187 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "194 = proj0 193":
+	#instruction start "195 = proj1 193":
+	#instruction start "196 = allocate_call_stack 0":
+	#instruction start "197 = set_reg %rdi 195":
+	#instruction start "198 = set_reg %rax 192 state: 197":
+	#instruction start "199 = call 191":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "200 = proj0 199":
+	#instruction start "201 = proj1 199":
+	#instruction start "202 = %rax":
+	#instruction start "203 = int_cast_zero 202":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "204 = constant(10)":
+	movl $10, %ebx
+	#instruction start "205 = 203 == 204":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "207 = if 148 205":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L15
+.L14:
+	#instruction start "210 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "211 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "212 = constant(29)":
+	movl $29, %r13d
+	#instruction start "213 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "214 = alloc with size 8":
+	leaq -1116(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "215 = store 214 210, state: 200":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "216 = alloc with size 8":
+	leaq -1124(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "217 = store 216 211, state: 215":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "218 = alloc with size 4":
+	leaq -1128(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "219 = store 218 212, state: 217":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "220 = alloc with size 8":
+	leaq -1136(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "221 = store 220 213, state: 219":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "222 = constant(1)":
+	leaq -168(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "223 = constant(0)":
+	leaq -176(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "224 = load part address of 214 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "225 = proj0 224":
+	#instruction start "226 = proj1 224":
+	#instruction start "227 = load part address of 216 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "228 = proj0 227":
+	#instruction start "229 = proj1 227":
+	#instruction start "230 = load part address of 218 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "231 = proj0 230":
+	#instruction start "232 = proj1 230":
+	#instruction start "233 = load part address of 220 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "234 = proj0 233":
+	#instruction start "235 = proj1 233":
+	#instruction start "236 = allocate_call_stack 0":
+	#instruction start "237 = set_reg %rdi 226":
+	#instruction start "238 = set_reg %rsi 229 state: 237":
+	#instruction start "239 = set_reg %rdx 232 state: 238":
+	#instruction start "240 = set_reg %rcx 235 state: 239":
+	#instruction start "241 = set_reg %rax 223 state: 240":
+	#instruction start "242 = call 222":
+	addq $0, %rsp
+	movq -176(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -168(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "243 = proj0 242":
+	#instruction start "244 = proj1 242":
+	#Block jump
+	jmp .L16
+.L15:
+	#Block jump elided
+.L16:
+	#instruction start "245 = alloc with size 4":
+	leaq -1140(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "246 = constant(10)":
+	movl $10, %r12d
+	#instruction start "247 = phi (region: 206) 200 243":
+	#instruction start "248 = store 245 246, state: 247":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "249 = constant(5)":
+	movq $funcሴh, %r12
+	#instruction start "250 = constant(0)":
+	movq $0, %r13
+	#instruction start "251 = load part address of 245 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "252 = proj0 251":
+	#instruction start "253 = proj1 251":
+	#instruction start "254 = allocate_call_stack 0":
+	#instruction start "255 = set_reg %rdi 253":
+	#instruction start "256 = set_reg %rax 250 state: 255":
+	#instruction start "257 = call 249":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "258 = proj0 257":
+	#instruction start "259 = proj1 257":
+	#instruction start "260 = %rax":
+	#instruction start "261 = int_cast_zero 260":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "262 = constant(10)":
+	movl $10, %ebx
+	#instruction start "263 = 261 == 262":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "265 = if 206 263":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L18
+.L17:
+	#instruction start "268 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "269 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "270 = constant(30)":
+	movl $30, %r13d
+	#instruction start "271 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "272 = alloc with size 8":
+	leaq -1148(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "273 = store 272 268, state: 258":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "274 = alloc with size 8":
+	leaq -1156(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "275 = store 274 269, state: 273":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "276 = alloc with size 4":
+	leaq -1160(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "277 = store 276 270, state: 275":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "278 = alloc with size 8":
+	leaq -1168(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "279 = store 278 271, state: 277":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "280 = constant(1)":
+	leaq -240(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "281 = constant(0)":
+	leaq -248(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "282 = load part address of 272 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "283 = proj0 282":
+	#instruction start "284 = proj1 282":
+	#instruction start "285 = load part address of 274 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "286 = proj0 285":
+	#instruction start "287 = proj1 285":
+	#instruction start "288 = load part address of 276 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "289 = proj0 288":
+	#instruction start "290 = proj1 288":
+	#instruction start "291 = load part address of 278 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "292 = proj0 291":
+	#instruction start "293 = proj1 291":
+	#instruction start "294 = allocate_call_stack 0":
+	#instruction start "295 = set_reg %rdi 284":
+	#instruction start "296 = set_reg %rsi 287 state: 295":
+	#instruction start "297 = set_reg %rdx 290 state: 296":
+	#instruction start "298 = set_reg %rcx 293 state: 297":
+	#instruction start "299 = set_reg %rax 281 state: 298":
+	#instruction start "300 = call 280":
+	addq $0, %rsp
+	movq -248(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -240(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "301 = proj0 300":
+	#instruction start "302 = proj1 300":
+	#Block jump
+	jmp .L19
+.L18:
+	#Block jump elided
+.L19:
+	#instruction start "303 = alloc with size 4":
+	leaq -1172(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "304 = constant(10)":
+	movl $10, %r12d
+	#instruction start "305 = phi (region: 264) 258 301":
+	#instruction start "306 = store 303 304, state: 305":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "307 = constant(7)":
+	movq $funcሴ1234h, %r12
+	#instruction start "308 = constant(0)":
+	movq $0, %r13
+	#instruction start "309 = load part address of 303 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "310 = proj0 309":
+	#instruction start "311 = proj1 309":
+	#instruction start "312 = allocate_call_stack 0":
+	#instruction start "313 = set_reg %rdi 311":
+	#instruction start "314 = set_reg %rax 308 state: 313":
+	#instruction start "315 = call 307":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "316 = proj0 315":
+	#instruction start "317 = proj1 315":
+	#instruction start "318 = %rax":
+	#instruction start "319 = int_cast_zero 318":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "320 = constant(10)":
+	movl $10, %ebx
+	#instruction start "321 = 319 == 320":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "323 = if 264 321":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L21
+.L20:
+	#instruction start "326 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "327 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "328 = constant(31)":
+	movl $31, %r13d
+	#instruction start "329 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "330 = alloc with size 8":
+	leaq -1180(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "331 = store 330 326, state: 316":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "332 = alloc with size 8":
+	leaq -1188(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "333 = store 332 327, state: 331":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "334 = alloc with size 4":
+	leaq -1192(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "335 = store 334 328, state: 333":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "336 = alloc with size 8":
+	leaq -1200(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "337 = store 336 329, state: 335":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "338 = constant(1)":
+	leaq -312(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "339 = constant(0)":
+	leaq -320(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "340 = load part address of 330 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "341 = proj0 340":
+	#instruction start "342 = proj1 340":
+	#instruction start "343 = load part address of 332 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "344 = proj0 343":
+	#instruction start "345 = proj1 343":
+	#instruction start "346 = load part address of 334 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "347 = proj0 346":
+	#instruction start "348 = proj1 346":
+	#instruction start "349 = load part address of 336 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "350 = proj0 349":
+	#instruction start "351 = proj1 349":
+	#instruction start "352 = allocate_call_stack 0":
+	#instruction start "353 = set_reg %rdi 342":
+	#instruction start "354 = set_reg %rsi 345 state: 353":
+	#instruction start "355 = set_reg %rdx 348 state: 354":
+	#instruction start "356 = set_reg %rcx 351 state: 355":
+	#instruction start "357 = set_reg %rax 339 state: 356":
+	#instruction start "358 = call 338":
+	addq $0, %rsp
+	movq -320(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -312(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "359 = proj0 358":
+	#instruction start "360 = proj1 358":
+	#Block jump
+	jmp .L22
+.L21:
+	#Block jump elided
+.L22:
+	#instruction start "361 = alloc with size 4":
+	leaq -1204(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "362 = constant(10)":
+	movl $10, %r12d
+	#instruction start "363 = phi (region: 322) 316 359":
+	#instruction start "364 = store 361 362, state: 363":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "365 = constant(9)":
+	movq $func𒈓, %r12
+	#instruction start "366 = constant(0)":
+	movq $0, %r13
+	#instruction start "367 = load part address of 361 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "368 = proj0 367":
+	#instruction start "369 = proj1 367":
+	#instruction start "370 = allocate_call_stack 0":
+	#instruction start "371 = set_reg %rdi 369":
+	#instruction start "372 = set_reg %rax 366 state: 371":
+	#instruction start "373 = call 365":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "374 = proj0 373":
+	#instruction start "375 = proj1 373":
+	#instruction start "376 = %rax":
+	#instruction start "377 = int_cast_zero 376":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "378 = constant(10)":
+	movl $10, %ebx
+	#instruction start "379 = 377 == 378":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "381 = if 322 379":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L24
+.L23:
+	#instruction start "384 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "385 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "386 = constant(32)":
+	movl $32, %r13d
+	#instruction start "387 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "388 = alloc with size 8":
+	leaq -1212(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "389 = store 388 384, state: 374":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "390 = alloc with size 8":
+	leaq -1220(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "391 = store 390 385, state: 389":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "392 = alloc with size 4":
+	leaq -1224(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "393 = store 392 386, state: 391":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "394 = alloc with size 8":
+	leaq -1232(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "395 = store 394 387, state: 393":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "396 = constant(1)":
+	leaq -384(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "397 = constant(0)":
+	leaq -392(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "398 = load part address of 388 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "399 = proj0 398":
+	#instruction start "400 = proj1 398":
+	#instruction start "401 = load part address of 390 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "402 = proj0 401":
+	#instruction start "403 = proj1 401":
+	#instruction start "404 = load part address of 392 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "405 = proj0 404":
+	#instruction start "406 = proj1 404":
+	#instruction start "407 = load part address of 394 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "408 = proj0 407":
+	#instruction start "409 = proj1 407":
+	#instruction start "410 = allocate_call_stack 0":
+	#instruction start "411 = set_reg %rdi 400":
+	#instruction start "412 = set_reg %rsi 403 state: 411":
+	#instruction start "413 = set_reg %rdx 406 state: 412":
+	#instruction start "414 = set_reg %rcx 409 state: 413":
+	#instruction start "415 = set_reg %rax 397 state: 414":
+	#instruction start "416 = call 396":
+	addq $0, %rsp
+	movq -392(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -384(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "417 = proj0 416":
+	#instruction start "418 = proj1 416":
+	#Block jump
+	jmp .L25
+.L24:
+	#Block jump elided
+.L25:
+	#instruction start "419 = alloc with size 4":
+	leaq -1236(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "420 = constant(10)":
+	movl $10, %r12d
+	#instruction start "421 = phi (region: 380) 374 417":
+	#instruction start "422 = store 419 420, state: 421":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "423 = constant(11)":
+	movq $𒈓, %r12
+	#instruction start "424 = constant(0)":
+	movq $0, %r13
+	#instruction start "425 = load part address of 419 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "426 = proj0 425":
+	#instruction start "427 = proj1 425":
+	#instruction start "428 = allocate_call_stack 0":
+	#instruction start "429 = set_reg %rdi 427":
+	#instruction start "430 = set_reg %rax 424 state: 429":
+	#instruction start "431 = call 423":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "432 = proj0 431":
+	#instruction start "433 = proj1 431":
+	#instruction start "434 = %rax":
+	#instruction start "435 = int_cast_zero 434":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "436 = constant(10)":
+	movl $10, %ebx
+	#instruction start "437 = 435 == 436":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "439 = if 380 437":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L27
+.L26:
+	#instruction start "442 = constant(12)":
+	movq $.Ls12, %rbx
+	#instruction start "443 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "444 = constant(33)":
+	movl $33, %r13d
+	#instruction start "445 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "446 = alloc with size 8":
+	leaq -1244(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "447 = store 446 442, state: 432":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "448 = alloc with size 8":
+	leaq -1252(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "449 = store 448 443, state: 447":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "450 = alloc with size 4":
+	leaq -1256(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "451 = store 450 444, state: 449":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "452 = alloc with size 8":
+	leaq -1264(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "453 = store 452 445, state: 451":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "454 = constant(1)":
+	leaq -456(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "455 = constant(0)":
+	leaq -464(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "456 = load part address of 446 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "457 = proj0 456":
+	#instruction start "458 = proj1 456":
+	#instruction start "459 = load part address of 448 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "460 = proj0 459":
+	#instruction start "461 = proj1 459":
+	#instruction start "462 = load part address of 450 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "463 = proj0 462":
+	#instruction start "464 = proj1 462":
+	#instruction start "465 = load part address of 452 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "466 = proj0 465":
+	#instruction start "467 = proj1 465":
+	#instruction start "468 = allocate_call_stack 0":
+	#instruction start "469 = set_reg %rdi 458":
+	#instruction start "470 = set_reg %rsi 461 state: 469":
+	#instruction start "471 = set_reg %rdx 464 state: 470":
+	#instruction start "472 = set_reg %rcx 467 state: 471":
+	#instruction start "473 = set_reg %rax 455 state: 472":
+	#instruction start "474 = call 454":
+	addq $0, %rsp
+	movq -464(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -456(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "475 = proj0 474":
+	#instruction start "476 = proj1 474":
+	#Block jump
+	jmp .L28
+.L27:
+	#Block jump elided
+.L28:
+	#instruction start "477 = constant(14)":
+	movq $.Ls14, %rbx
+	#instruction start "478 = constant(14)":
+	movq $.Ls14, %r12
+	#instruction start "479 = alloc with size 8":
+	leaq -1272(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "480 = phi (region: 438) 432 475":
+	#instruction start "481 = store 479 477, state: 480":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "482 = alloc with size 8":
+	leaq -1280(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "483 = store 482 478, state: 481":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "484 = constant(13)":
+	movq $strcmp, %r12
+	#instruction start "485 = constant(0)":
+	movq $0, %r14
+	#instruction start "486 = load part address of 479 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "487 = proj0 486":
+	#instruction start "488 = proj1 486":
+	#instruction start "489 = load part address of 482 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "490 = proj0 489":
+	#instruction start "491 = proj1 489":
+	#instruction start "492 = allocate_call_stack 0":
+	#instruction start "493 = set_reg %rdi 488":
+	#instruction start "494 = set_reg %rsi 491 state: 493":
+	#instruction start "495 = set_reg %rax 485 state: 494":
+	#instruction start "496 = call 484":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "497 = proj0 496":
+	#instruction start "498 = proj1 496":
+	#instruction start "499 = %rax":
+	#instruction start "500 = int_cast_zero 499":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "501 = constant(0)":
+	movl $0, %ebx
+	#instruction start "502 = 500 == 501":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "504 = if 438 502":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L30
+.L29:
+	#instruction start "507 = constant(15)":
+	movq $.Ls15, %rbx
+	#instruction start "508 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "509 = constant(36)":
+	movl $36, %r13d
+	#instruction start "510 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "511 = alloc with size 8":
+	leaq -1288(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "512 = store 511 507, state: 497":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "513 = alloc with size 8":
+	leaq -1296(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "514 = store 513 508, state: 512":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "515 = alloc with size 4":
+	leaq -1300(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "516 = store 515 509, state: 514":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "517 = alloc with size 8":
+	leaq -1308(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "518 = store 517 510, state: 516":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "519 = constant(1)":
+	leaq -536(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "520 = constant(0)":
+	leaq -544(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "521 = load part address of 511 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "522 = proj0 521":
+	#instruction start "523 = proj1 521":
+	#instruction start "524 = load part address of 513 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "525 = proj0 524":
+	#instruction start "526 = proj1 524":
+	#instruction start "527 = load part address of 515 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "528 = proj0 527":
+	#instruction start "529 = proj1 527":
+	#instruction start "530 = load part address of 517 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "531 = proj0 530":
+	#instruction start "532 = proj1 530":
+	#instruction start "533 = allocate_call_stack 0":
+	#instruction start "534 = set_reg %rdi 523":
+	#instruction start "535 = set_reg %rsi 526 state: 534":
+	#instruction start "536 = set_reg %rdx 529 state: 535":
+	#instruction start "537 = set_reg %rcx 532 state: 536":
+	#instruction start "538 = set_reg %rax 520 state: 537":
+	#instruction start "539 = call 519":
+	addq $0, %rsp
+	movq -544(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -536(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "540 = proj0 539":
+	#instruction start "541 = proj1 539":
+	#Block jump
+	jmp .L31
+.L30:
+	#Block jump elided
+.L31:
+	#instruction start "542 = constant(16)":
+	movq $.Ls16, %rbx
+	#instruction start "543 = constant(16)":
+	movq $.Ls16, %r12
+	#instruction start "544 = alloc with size 8":
+	leaq -1316(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "545 = phi (region: 503) 497 540":
+	#instruction start "546 = store 544 542, state: 545":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "547 = alloc with size 8":
+	leaq -1324(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "548 = store 547 543, state: 546":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "549 = constant(13)":
+	movq $strcmp, %r12
+	#instruction start "550 = constant(0)":
+	movq $0, %r14
+	#instruction start "551 = load part address of 544 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "552 = proj0 551":
+	#instruction start "553 = proj1 551":
+	#instruction start "554 = load part address of 547 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "555 = proj0 554":
+	#instruction start "556 = proj1 554":
+	#instruction start "557 = allocate_call_stack 0":
+	#instruction start "558 = set_reg %rdi 553":
+	#instruction start "559 = set_reg %rsi 556 state: 558":
+	#instruction start "560 = set_reg %rax 550 state: 559":
+	#instruction start "561 = call 549":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "562 = proj0 561":
+	#instruction start "563 = proj1 561":
+	#instruction start "564 = %rax":
+	#instruction start "565 = int_cast_zero 564":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "566 = constant(0)":
+	movl $0, %ebx
+	#instruction start "567 = 565 == 566":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "569 = if 503 567":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L33
+.L32:
+	#instruction start "572 = constant(17)":
+	movq $.Ls17, %rbx
+	#instruction start "573 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "574 = constant(37)":
+	movl $37, %r13d
+	#instruction start "575 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "576 = alloc with size 8":
+	leaq -1332(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "577 = store 576 572, state: 562":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "578 = alloc with size 8":
+	leaq -1340(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "579 = store 578 573, state: 577":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "580 = alloc with size 4":
+	leaq -1344(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "581 = store 580 574, state: 579":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "582 = alloc with size 8":
+	leaq -1352(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "583 = store 582 575, state: 581":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "584 = constant(1)":
+	leaq -616(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "585 = constant(0)":
+	leaq -624(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "586 = load part address of 576 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "587 = proj0 586":
+	#instruction start "588 = proj1 586":
+	#instruction start "589 = load part address of 578 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "590 = proj0 589":
+	#instruction start "591 = proj1 589":
+	#instruction start "592 = load part address of 580 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "593 = proj0 592":
+	#instruction start "594 = proj1 592":
+	#instruction start "595 = load part address of 582 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "596 = proj0 595":
+	#instruction start "597 = proj1 595":
+	#instruction start "598 = allocate_call_stack 0":
+	#instruction start "599 = set_reg %rdi 588":
+	#instruction start "600 = set_reg %rsi 591 state: 599":
+	#instruction start "601 = set_reg %rdx 594 state: 600":
+	#instruction start "602 = set_reg %rcx 597 state: 601":
+	#instruction start "603 = set_reg %rax 585 state: 602":
+	#instruction start "604 = call 584":
+	addq $0, %rsp
+	movq -624(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -616(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "605 = proj0 604":
+	#instruction start "606 = proj1 604":
+	#Block jump
+	jmp .L34
+.L33:
+	#Block jump elided
+.L34:
+	#instruction start "607 = constant(1)":
+	movl $1, %ebx
+	#instruction start "609 = if 568 607":
+	#instruction start "617 = phi (region: 568) 562 605":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L36
+.L35:
+	#instruction start "612 = constant(18)":
+	movq $.Ls18, %rbx
+	#instruction start "613 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "614 = constant(39)":
+	movl $39, %r13d
+	#instruction start "615 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "616 = alloc with size 8":
+	leaq -1360(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "618 = store 616 612, state: 617":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "619 = alloc with size 8":
+	leaq -1368(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "620 = store 619 613, state: 618":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "621 = alloc with size 4":
+	leaq -1372(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "622 = store 621 614, state: 620":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "623 = alloc with size 8":
+	leaq -1380(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "624 = store 623 615, state: 622":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "625 = constant(1)":
+	leaq -672(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "626 = constant(0)":
+	leaq -680(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "627 = load part address of 616 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "628 = proj0 627":
+	#instruction start "629 = proj1 627":
+	#instruction start "630 = load part address of 619 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "631 = proj0 630":
+	#instruction start "632 = proj1 630":
+	#instruction start "633 = load part address of 621 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "634 = proj0 633":
+	#instruction start "635 = proj1 633":
+	#instruction start "636 = load part address of 623 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "637 = proj0 636":
+	#instruction start "638 = proj1 636":
+	#instruction start "639 = allocate_call_stack 0":
+	#instruction start "640 = set_reg %rdi 629":
+	#instruction start "641 = set_reg %rsi 632 state: 640":
+	#instruction start "642 = set_reg %rdx 635 state: 641":
+	#instruction start "643 = set_reg %rcx 638 state: 642":
+	#instruction start "644 = set_reg %rax 626 state: 643":
+	#instruction start "645 = call 625":
+	addq $0, %rsp
+	movq -680(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -672(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "646 = proj0 645":
+	#instruction start "647 = proj1 645":
+	#Block jump
+	jmp .L37
+.L36:
+	#Block jump elided
+.L37:
+	#instruction start "648 = constant(1)":
+	movl $1, %ebx
+	#instruction start "650 = if 608 648":
+	#instruction start "658 = phi (region: 608) 617 646":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L39
+.L38:
+	#instruction start "653 = constant(19)":
+	movq $.Ls19, %rbx
+	#instruction start "654 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "655 = constant(40)":
+	movl $40, %r13d
+	#instruction start "656 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "657 = alloc with size 8":
+	leaq -1388(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "659 = store 657 653, state: 658":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "660 = alloc with size 8":
+	leaq -1396(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "661 = store 660 654, state: 659":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "662 = alloc with size 4":
+	leaq -1400(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "663 = store 662 655, state: 661":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "664 = alloc with size 8":
+	leaq -1408(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "665 = store 664 656, state: 663":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "666 = constant(1)":
+	leaq -728(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "667 = constant(0)":
+	leaq -736(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "668 = load part address of 657 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "669 = proj0 668":
+	#instruction start "670 = proj1 668":
+	#instruction start "671 = load part address of 660 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "672 = proj0 671":
+	#instruction start "673 = proj1 671":
+	#instruction start "674 = load part address of 662 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "675 = proj0 674":
+	#instruction start "676 = proj1 674":
+	#instruction start "677 = load part address of 664 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "678 = proj0 677":
+	#instruction start "679 = proj1 677":
+	#instruction start "680 = allocate_call_stack 0":
+	#instruction start "681 = set_reg %rdi 670":
+	#instruction start "682 = set_reg %rsi 673 state: 681":
+	#instruction start "683 = set_reg %rdx 676 state: 682":
+	#instruction start "684 = set_reg %rcx 679 state: 683":
+	#instruction start "685 = set_reg %rax 667 state: 684":
+	#instruction start "686 = call 666":
+	addq $0, %rsp
+	movq -736(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -728(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "687 = proj0 686":
+	#instruction start "688 = proj1 686":
+	#Block jump
+	jmp .L40
+.L39:
+	#Block jump elided
+.L40:
+	#instruction start "689 = constant(1)":
+	movl $1, %ebx
+	#instruction start "691 = if 649 689":
+	#instruction start "699 = phi (region: 649) 658 687":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L42
+.L41:
+	#instruction start "694 = constant(20)":
+	movq $.Ls20, %rbx
+	#instruction start "695 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "696 = constant(41)":
+	movl $41, %r13d
+	#instruction start "697 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "698 = alloc with size 8":
+	leaq -1416(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "700 = store 698 694, state: 699":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "701 = alloc with size 8":
+	leaq -1424(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "702 = store 701 695, state: 700":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "703 = alloc with size 4":
+	leaq -1428(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "704 = store 703 696, state: 702":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "705 = alloc with size 8":
+	leaq -1436(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "706 = store 705 697, state: 704":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "707 = constant(1)":
+	leaq -784(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "708 = constant(0)":
+	leaq -792(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "709 = load part address of 698 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "710 = proj0 709":
+	#instruction start "711 = proj1 709":
+	#instruction start "712 = load part address of 701 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "713 = proj0 712":
+	#instruction start "714 = proj1 712":
+	#instruction start "715 = load part address of 703 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "716 = proj0 715":
+	#instruction start "717 = proj1 715":
+	#instruction start "718 = load part address of 705 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "719 = proj0 718":
+	#instruction start "720 = proj1 718":
+	#instruction start "721 = allocate_call_stack 0":
+	#instruction start "722 = set_reg %rdi 711":
+	#instruction start "723 = set_reg %rsi 714 state: 722":
+	#instruction start "724 = set_reg %rdx 717 state: 723":
+	#instruction start "725 = set_reg %rcx 720 state: 724":
+	#instruction start "726 = set_reg %rax 708 state: 725":
+	#instruction start "727 = call 707":
+	addq $0, %rsp
+	movq -792(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -784(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "728 = proj0 727":
+	#instruction start "729 = proj1 727":
+	#Block jump
+	jmp .L43
+.L42:
+	#Block jump elided
+.L43:
+	#instruction start "730 = constant(1)":
+	movl $1, %ebx
+	#instruction start "732 = if 690 730":
+	#instruction start "740 = phi (region: 690) 699 728":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L45
+.L44:
+	#instruction start "735 = constant(21)":
+	movq $.Ls21, %rbx
+	#instruction start "736 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "737 = constant(42)":
+	movl $42, %r13d
+	#instruction start "738 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "739 = alloc with size 8":
+	leaq -1444(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "741 = store 739 735, state: 740":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "742 = alloc with size 8":
+	leaq -1452(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "743 = store 742 736, state: 741":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "744 = alloc with size 4":
+	leaq -1456(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "745 = store 744 737, state: 743":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "746 = alloc with size 8":
+	leaq -1464(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "747 = store 746 738, state: 745":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "748 = constant(1)":
+	leaq -840(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "749 = constant(0)":
+	leaq -848(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "750 = load part address of 739 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "751 = proj0 750":
+	#instruction start "752 = proj1 750":
+	#instruction start "753 = load part address of 742 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "754 = proj0 753":
+	#instruction start "755 = proj1 753":
+	#instruction start "756 = load part address of 744 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "757 = proj0 756":
+	#instruction start "758 = proj1 756":
+	#instruction start "759 = load part address of 746 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "760 = proj0 759":
+	#instruction start "761 = proj1 759":
+	#instruction start "762 = allocate_call_stack 0":
+	#instruction start "763 = set_reg %rdi 752":
+	#instruction start "764 = set_reg %rsi 755 state: 763":
+	#instruction start "765 = set_reg %rdx 758 state: 764":
+	#instruction start "766 = set_reg %rcx 761 state: 765":
+	#instruction start "767 = set_reg %rax 749 state: 766":
+	#instruction start "768 = call 748":
+	addq $0, %rsp
+	movq -848(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -840(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "769 = proj0 768":
+	#instruction start "770 = proj1 768":
+	#Block jump
+	jmp .L46
+.L45:
+	#Block jump elided
+.L46:
+	#instruction start "772 = phi (region: 731) 740 769":
+	#instruction start "780 = alloc with size 4":
+	leaq -1468(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "781 = constant(2)":
+	movl $2, %r12d
+	#instruction start "782 = store 780 781, state: 772":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "783 = constant(9)":
+	movq $func𒈓, %r12
+	#instruction start "784 = constant(0)":
+	movq $0, %r13
+	#instruction start "785 = load part address of 780 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "786 = proj0 785":
+	#instruction start "787 = proj1 785":
+	#instruction start "788 = allocate_call_stack 0":
+	#instruction start "789 = set_reg %rdi 787":
+	#instruction start "790 = set_reg %rax 784 state: 789":
+	#instruction start "791 = call 783":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "792 = proj0 791":
+	#instruction start "793 = proj1 791":
+	#instruction start "794 = %rax":
+	#instruction start "795 = int_cast_zero 794":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "796 = constant(2)":
+	movl $2, %ebx
+	#instruction start "797 = 795 == 796":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "799 = if 731 797":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L48
+.L47:
+	#instruction start "802 = constant(22)":
+	movq $.Ls22, %rbx
+	#instruction start "803 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "804 = constant(49)":
+	movl $49, %r13d
+	#instruction start "805 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "806 = alloc with size 8":
+	leaq -1476(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "807 = store 806 802, state: 792":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "808 = alloc with size 8":
+	leaq -1484(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "809 = store 808 803, state: 807":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "810 = alloc with size 4":
+	leaq -1488(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "811 = store 810 804, state: 809":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "812 = alloc with size 8":
+	leaq -1496(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "813 = store 812 805, state: 811":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "814 = constant(1)":
+	leaq -912(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "815 = constant(0)":
+	leaq -920(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "816 = load part address of 806 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "817 = proj0 816":
+	#instruction start "818 = proj1 816":
+	#instruction start "819 = load part address of 808 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "820 = proj0 819":
+	#instruction start "821 = proj1 819":
+	#instruction start "822 = load part address of 810 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "823 = proj0 822":
+	#instruction start "824 = proj1 822":
+	#instruction start "825 = load part address of 812 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "826 = proj0 825":
+	#instruction start "827 = proj1 825":
+	#instruction start "828 = allocate_call_stack 0":
+	#instruction start "829 = set_reg %rdi 818":
+	#instruction start "830 = set_reg %rsi 821 state: 829":
+	#instruction start "831 = set_reg %rdx 824 state: 830":
+	#instruction start "832 = set_reg %rcx 827 state: 831":
+	#instruction start "833 = set_reg %rax 815 state: 832":
+	#instruction start "834 = call 814":
+	addq $0, %rsp
+	movq -920(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -912(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "835 = proj0 834":
+	#instruction start "836 = proj1 834":
+	#Block jump
+	jmp .L49
+.L48:
+	#Block jump elided
+.L49:
+	#instruction start "837 = alloc with size 4":
+	leaq -1500(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "838 = constant(2)":
+	movl $2, %r12d
+	#instruction start "839 = phi (region: 798) 792 835":
+	#instruction start "840 = store 837 838, state: 839":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "841 = constant(9)":
+	movq $func𒈓, %r12
+	#instruction start "842 = constant(0)":
+	movq $0, %r13
+	#instruction start "843 = load part address of 837 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "844 = proj0 843":
+	#instruction start "845 = proj1 843":
+	#instruction start "846 = allocate_call_stack 0":
+	#instruction start "847 = set_reg %rdi 845":
+	#instruction start "848 = set_reg %rax 842 state: 847":
+	#instruction start "849 = call 841":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "850 = proj0 849":
+	#instruction start "851 = proj1 849":
+	#instruction start "852 = %rax":
+	#instruction start "853 = int_cast_zero 852":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "854 = constant(2)":
+	movl $2, %ebx
+	#instruction start "855 = 853 == 854":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "857 = if 798 855":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L51
+.L50:
+	#instruction start "860 = constant(22)":
+	movq $.Ls22, %rbx
+	#instruction start "861 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "862 = constant(50)":
+	movl $50, %r13d
+	#instruction start "863 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "864 = alloc with size 8":
+	leaq -1508(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "865 = store 864 860, state: 850":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "866 = alloc with size 8":
+	leaq -1516(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "867 = store 866 861, state: 865":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "868 = alloc with size 4":
+	leaq -1520(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "869 = store 868 862, state: 867":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "870 = alloc with size 8":
+	leaq -1528(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "871 = store 870 863, state: 869":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "872 = constant(1)":
+	leaq -984(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "873 = constant(0)":
+	leaq -992(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "874 = load part address of 864 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "875 = proj0 874":
+	#instruction start "876 = proj1 874":
+	#instruction start "877 = load part address of 866 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "878 = proj0 877":
+	#instruction start "879 = proj1 877":
+	#instruction start "880 = load part address of 868 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "881 = proj0 880":
+	#instruction start "882 = proj1 880":
+	#instruction start "883 = load part address of 870 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "884 = proj0 883":
+	#instruction start "885 = proj1 883":
+	#instruction start "886 = allocate_call_stack 0":
+	#instruction start "887 = set_reg %rdi 876":
+	#instruction start "888 = set_reg %rsi 879 state: 887":
+	#instruction start "889 = set_reg %rdx 882 state: 888":
+	#instruction start "890 = set_reg %rcx 885 state: 889":
+	#instruction start "891 = set_reg %rax 873 state: 890":
+	#instruction start "892 = call 872":
+	addq $0, %rsp
+	movq -992(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -984(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "893 = proj0 892":
+	#instruction start "894 = proj1 892":
+	#Block jump
+	jmp .L52
+.L51:
+	#Block jump elided
+.L52:
+	#instruction start "895 = constant(0)":
+	movl $0, %ebx
+	#instruction start "896 = set_reg %rax 895":
+	#instruction start "897 = phi (region: 856) 850 893":
+	#instruction start "898 = return 856, 896, 897":
+	movq %rbx, %rax
+	#Block return.
+	movq -1536(%rbp), %rbx
+	movq -1544(%rbp), %r12
+	movq -1552(%rbp), %r13
+	movq -1560(%rbp), %r14
+	movq -1568(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls2:
+	.string "\360\237\230\200(2) == 4\000"
+.Ls3:
+	.string "tests/universal_character_name.c\000"
+.Ls4:
+	.string "main"
+.Ls6:
+	.string "func\341\210\264h(10) == 10\000"
+.Ls8:
+	.string "func\341\210\2641234h(10) == 10\000"
+.Ls10:
+	.string "func\360\222\210\223(10) == 10\000"
+.Ls12:
+	.string "\360\222\210\223(10) == 10\000"
+.Ls14:
+	.string "\341\232\250\000"
+.Ls15:
+	.string "strcmp(\"\341\232\250\", \"\341\232\250\") == 0\000"
+.Ls16:
+	.string "\360\222\210\223\000"
+.Ls17:
+	.string "strcmp(\"\360\222\210\223\", \"\360\222\210\223\") == 0\000"
+.Ls18:
+	.string "L'\341\232\250' == L'\341\232\250'\000"
+.Ls19:
+	.string "L'\360\222\210\223' == L'\360\222\210\223'\000"
+.Ls20:
+	.string "u'\341\232\250' == u'\341\232\250'\000"
+.Ls21:
+	.string "U'\360\222\210\223' == U'\360\222\210\223'\000"
+.Ls22:
+	.string "func\360\222\210\223(2) == 2\000"
@@ -0,0 +1,2682 @@
+__bswap_16:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movq %rbx, -18(%rbp)
+	movq %r12, -26(%rbp)
+	movq %r13, -34(%rbp)
+	movq %r14, -42(%rbp)
+	movzwl %di, %ebx
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = alloc with size 2":
+	leaq -10(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "8 = store part of 7 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movw %bx, (%rsi)
+	#instruction start "9 = load 7, state: 8":
+	movq %r12, %rdi
+	movzwl (%rdi), %ebx
+	#instruction start "10 = int_cast_zero 9":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "11 = constant(8)":
+	movl $8, %ebx
+	#instruction start "12 = 10 >> 11 (signed)":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	sarl %cl, %eax
+	movl %eax, %r14d
+	#instruction start "13 = constant(255)":
+	movl $255, %ebx
+	#instruction start "14 = 12 & 13":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	andl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "15 = load 7, state: 8":
+	movq %r12, %rdi
+	movzwl (%rdi), %ebx
+	#instruction start "16 = int_cast_zero 15":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "17 = constant(255)":
+	movl $255, %ebx
+	#instruction start "18 = 16 & 17":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	andl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "19 = constant(8)":
+	movl $8, %ebx
+	#instruction start "20 = 18 << 19":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	sall %cl, %eax
+	movl %eax, %r12d
+	#instruction start "21 = 14 | 20":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "22 = int_cast_zero 21":
+	movq %rbx, %rax
+	movzwl %ax, %r12d
+	#instruction start "23 = set_reg %rax 22":
+	#instruction start "24 = return 2, 23, 8":
+	movq %r12, %rax
+	#Block return.
+	movq -18(%rbp), %rbx
+	movq -26(%rbp), %r12
+	movq -34(%rbp), %r13
+	movq -42(%rbp), %r14
+	leave 
+	ret 
+__bswap_32:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movq %r13, -36(%rbp)
+	movq %r14, -44(%rbp)
+	movq %r15, -52(%rbp)
+	movl %edi, %ebx
+.L3:
+	#instruction start "28 = proj3 26":
+	#instruction start "29 = proj1 26":
+	#instruction start "31 = %rdi":
+	#instruction start "32 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "33 = store part of 32 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "34 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "35 = constant(4278190080)":
+	movl $4278190080, %r13d
+	#instruction start "36 = 34 & 35":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	andl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "37 = constant(24)":
+	movl $24, %ebx
+	#instruction start "38 = 36 >> 37":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	shrl %cl, %eax
+	movl %eax, %r13d
+	#instruction start "39 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "40 = constant(16711680)":
+	movl $16711680, %r14d
+	#instruction start "41 = 39 & 40":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andl %ecx, %eax
+	movl %eax, %r15d
+	#instruction start "42 = constant(8)":
+	movl $8, %ebx
+	#instruction start "43 = 41 >> 42":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	shrl %cl, %eax
+	movl %eax, %r14d
+	#instruction start "44 = 38 | 43":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "45 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %r13d
+	#instruction start "46 = constant(65280)":
+	movl $65280, %r14d
+	#instruction start "47 = 45 & 46":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andl %ecx, %eax
+	movl %eax, %r15d
+	#instruction start "48 = constant(8)":
+	movl $8, %r13d
+	#instruction start "49 = 47 << 48":
+	movq %r15, %rax
+	movq %r13, %rcx
+	sall %cl, %eax
+	movl %eax, %r14d
+	#instruction start "50 = 44 | 49":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "51 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "52 = constant(255)":
+	movl $255, %r12d
+	#instruction start "53 = 51 & 52":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	andl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "54 = constant(24)":
+	movl $24, %ebx
+	#instruction start "55 = 53 << 54":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	sall %cl, %eax
+	movl %eax, %r12d
+	#instruction start "56 = 50 | 55":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "57 = set_reg %rax 56":
+	#instruction start "58 = return 27, 57, 33":
+	movq %rbx, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	movq -36(%rbp), %r13
+	movq -44(%rbp), %r14
+	movq -52(%rbp), %r15
+	leave 
+	ret 
+__bswap_64:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -24(%rbp)
+	movq %r12, -32(%rbp)
+	movq %r13, -40(%rbp)
+	movq %r14, -48(%rbp)
+	movq %r15, -56(%rbp)
+	movq %rdi, %rbx
+.L4:
+	#instruction start "62 = proj3 60":
+	#instruction start "63 = proj1 60":
+	#instruction start "65 = %rdi":
+	#instruction start "66 = alloc with size 8":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "67 = store part of 66 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "68 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "69 = constant(-72057594037927936)":
+	movabsq $-72057594037927936, %r13
+	#instruction start "70 = 68 & 69":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "71 = constant(56)":
+	movq $56, %rbx
+	#instruction start "72 = 70 >> 71":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r13
+	#instruction start "73 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "74 = constant(71776119061217280)":
+	movabsq $71776119061217280, %r14
+	#instruction start "75 = 73 & 74":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "76 = constant(40)":
+	movq $40, %rbx
+	#instruction start "77 = 75 >> 76":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "78 = 72 | 77":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "79 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "80 = constant(280375465082880)":
+	movabsq $280375465082880, %r14
+	#instruction start "81 = 79 & 80":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "82 = constant(24)":
+	movq $24, %r13
+	#instruction start "83 = 81 >> 82":
+	movq %r15, %rax
+	movq %r13, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "84 = 78 | 83":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "85 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "86 = constant(1095216660480)":
+	movabsq $1095216660480, %r14
+	#instruction start "87 = 85 & 86":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "88 = constant(8)":
+	movq $8, %rbx
+	#instruction start "89 = 87 >> 88":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "90 = 84 | 89":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "91 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "92 = constant(4278190080)":
+	movabsq $4278190080, %r14
+	#instruction start "93 = 91 & 92":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "94 = constant(8)":
+	movq $8, %r13
+	#instruction start "95 = 93 << 94":
+	movq %r15, %rax
+	movq %r13, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "96 = 90 | 95":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "97 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "98 = constant(16711680)":
+	movq $16711680, %r14
+	#instruction start "99 = 97 & 98":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "100 = constant(24)":
+	movq $24, %rbx
+	#instruction start "101 = 99 << 100":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "102 = 96 | 101":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "103 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "104 = constant(65280)":
+	movq $65280, %r14
+	#instruction start "105 = 103 & 104":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "106 = constant(40)":
+	movq $40, %r13
+	#instruction start "107 = 105 << 106":
+	movq %r15, %rax
+	movq %r13, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "108 = 102 | 107":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "109 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "110 = constant(255)":
+	movq $255, %r12
+	#instruction start "111 = 109 & 110":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "112 = constant(56)":
+	movq $56, %rbx
+	#instruction start "113 = 111 << 112":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r12
+	#instruction start "114 = 108 | 113":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "115 = set_reg %rax 114":
+	#instruction start "116 = return 61, 115, 67":
+	movq %rbx, %rax
+	#Block return.
+	movq -24(%rbp), %rbx
+	movq -32(%rbp), %r12
+	movq -40(%rbp), %r13
+	movq -48(%rbp), %r14
+	movq -56(%rbp), %r15
+	leave 
+	ret 
+__uint16_identity:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -18(%rbp)
+	movq %r12, -26(%rbp)
+	movzwl %di, %ebx
+.L5:
+	#instruction start "120 = proj3 118":
+	#instruction start "121 = proj1 118":
+	#instruction start "123 = %rdi":
+	#instruction start "124 = alloc with size 2":
+	leaq -10(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "125 = store part of 124 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movw %bx, (%rsi)
+	#instruction start "126 = load 124, state: 125":
+	movq %r12, %rdi
+	movzwl (%rdi), %ebx
+	#instruction start "127 = set_reg %rax 126":
+	#instruction start "128 = return 119, 127, 125":
+	movq %rbx, %rax
+	#Block return.
+	movq -18(%rbp), %rbx
+	movq -26(%rbp), %r12
+	leave 
+	ret 
+__uint32_identity:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movl %edi, %ebx
+.L6:
+	#instruction start "132 = proj3 130":
+	#instruction start "133 = proj1 130":
+	#instruction start "135 = %rdi":
+	#instruction start "136 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "137 = store part of 136 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "138 = load 136, state: 137":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "139 = set_reg %rax 138":
+	#instruction start "140 = return 131, 139, 137":
+	movq %rbx, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	leave 
+	ret 
+__uint64_identity:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -24(%rbp)
+	movq %r12, -32(%rbp)
+	movq %rdi, %rbx
+.L7:
+	#instruction start "144 = proj3 142":
+	#instruction start "145 = proj1 142":
+	#instruction start "147 = %rdi":
+	#instruction start "148 = alloc with size 8":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "149 = store part of 148 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "150 = load 148, state: 149":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "151 = set_reg %rax 150":
+	#instruction start "152 = return 143, 151, 149":
+	movq %rbx, %rax
+	#Block return.
+	movq -24(%rbp), %rbx
+	movq -32(%rbp), %r12
+	leave 
+	ret 
+.global func1
+func1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rbx, -100(%rbp)
+	movq %r12, -108(%rbp)
+	movq %r13, -116(%rbp)
+	movq %r14, -124(%rbp)
+	movq %r15, -132(%rbp)
+	movq %rdi, %rbx
+.L8:
+	#instruction start "156 = proj3 154":
+	#instruction start "157 = proj1 154":
+	#instruction start "159 = %rdi":
+	#instruction start "160 = alloc with size 8":
+	leaq -64(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "161 = store part of 160 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "162 = constant(0)":
+	movq $global, %rbx
+	#instruction start "163 = load_volatile 162, state: 161":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "164 = proj0 163":
+	#instruction start "165 = proj1 163":
+	#instruction start "166 = int_cast_zero 165":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %rbx
+	#instruction start "167 = int_cast_zero 166":
+	movq %rbx, %rax
+	movq %rax, %r12
+	#instruction start "168 = constant(1)":
+	movq $1, %rbx
+	#instruction start "169 = 167 * 168":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "170 = constant(0)":
+	movq $global, %rbx
+	#instruction start "171 = load_volatile 170, state: 164":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "172 = proj0 171":
+	#instruction start "173 = proj1 171":
+	#instruction start "174 = int_cast_zero 173":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %rbx
+	#instruction start "175 = 169 == 174":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "177 = if 155 175":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "180 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "181 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "182 = constant(7)":
+	movl $7, %r13d
+	#instruction start "183 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "184 = alloc with size 8":
+	leaq -72(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "185 = store 184 180, state: 172":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "186 = alloc with size 8":
+	leaq -80(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "187 = store 186 181, state: 185":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "188 = alloc with size 4":
+	leaq -84(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "189 = store 188 182, state: 187":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "190 = alloc with size 8":
+	leaq -92(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "191 = store 190 183, state: 189":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "192 = constant(1)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "193 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "194 = load part address of 184 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "195 = proj0 194":
+	#instruction start "196 = proj1 194":
+	#instruction start "197 = load part address of 186 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "198 = proj0 197":
+	#instruction start "199 = proj1 197":
+	#instruction start "200 = load part address of 188 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "201 = proj0 200":
+	#instruction start "202 = proj1 200":
+	#instruction start "203 = load part address of 190 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "204 = proj0 203":
+	#instruction start "205 = proj1 203":
+	#instruction start "206 = allocate_call_stack 0":
+	#instruction start "207 = set_reg %rdi 196":
+	#instruction start "208 = set_reg %rsi 199 state: 207":
+	#instruction start "209 = set_reg %rdx 202 state: 208":
+	#instruction start "210 = set_reg %rcx 205 state: 209":
+	#instruction start "211 = set_reg %rax 193 state: 210":
+	#instruction start "212 = call 192":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "213 = proj0 212":
+	#instruction start "214 = proj1 212":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "215 = phi (region: 176) 172 213":
+	#instruction start "216 = return 176, -1, 215":
+	#Block return.
+	movq -100(%rbp), %rbx
+	movq -108(%rbp), %r12
+	movq -116(%rbp), %r13
+	movq -124(%rbp), %r14
+	movq -132(%rbp), %r15
+	leave 
+	ret 
+.global func2
+func2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rbx, -104(%rbp)
+	movq %r12, -112(%rbp)
+	movq %r13, -120(%rbp)
+	movq %r14, -128(%rbp)
+	movq %r15, -136(%rbp)
+	movl %edi, %ebx
+	movq %rsi, %r12
+.L12:
+	#instruction start "219 = proj3 217":
+	#instruction start "220 = proj1 217":
+	#instruction start "222 = %rdi":
+	#instruction start "223 = %rsi":
+	#instruction start "224 = alloc with size 4":
+	leaq -60(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "225 = alloc with size 8":
+	leaq -68(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "226 = store part of 224 with offset 0":
+	movq %r13, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "227 = store part of 225 with offset 0":
+	movq %r14, %rsi
+	leaq (%rsi), %rsi
+	movq %r12, (%rsi)
+	#instruction start "228 = load 224, state: 227":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "229 = constant(2)":
+	movl $2, %r12d
+	#instruction start "230 = 228 * 229 (signed)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	imull %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "231 = int_cast_zero 230":
+	movq %r14, %rax
+	movslq %eax, %rax
+	movq %rax, %rbx
+	#instruction start "232 = int_cast_zero 231":
+	movq %rbx, %rax
+	movq %rax, %r12
+	#instruction start "233 = constant(1)":
+	movq $1, %rbx
+	#instruction start "234 = 232 * 233":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "235 = load 224, state: 227":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "236 = constant(2)":
+	movl $2, %r12d
+	#instruction start "237 = 235 * 236 (signed)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	imull %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "238 = int_cast_zero 237":
+	movq %r13, %rax
+	movslq %eax, %rax
+	movq %rax, %rbx
+	#instruction start "239 = 234 == 238":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "241 = if 218 239":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L14
+.L13:
+	#instruction start "244 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "245 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "246 = constant(11)":
+	movl $11, %r13d
+	#instruction start "247 = constant(6)":
+	movq $.Ls6, %r14
+	#instruction start "248 = alloc with size 8":
+	leaq -76(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "249 = store 248 244, state: 227":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "250 = alloc with size 8":
+	leaq -84(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "251 = store 250 245, state: 249":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "252 = alloc with size 4":
+	leaq -88(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "253 = store 252 246, state: 251":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "254 = alloc with size 8":
+	leaq -96(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "255 = store 254 247, state: 253":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "256 = constant(1)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "257 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "258 = load part address of 248 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "259 = proj0 258":
+	#instruction start "260 = proj1 258":
+	#instruction start "261 = load part address of 250 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "262 = proj0 261":
+	#instruction start "263 = proj1 261":
+	#instruction start "264 = load part address of 252 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "265 = proj0 264":
+	#instruction start "266 = proj1 264":
+	#instruction start "267 = load part address of 254 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "268 = proj0 267":
+	#instruction start "269 = proj1 267":
+	#instruction start "270 = allocate_call_stack 0":
+	#instruction start "271 = set_reg %rdi 260":
+	#instruction start "272 = set_reg %rsi 263 state: 271":
+	#instruction start "273 = set_reg %rdx 266 state: 272":
+	#instruction start "274 = set_reg %rcx 269 state: 273":
+	#instruction start "275 = set_reg %rax 257 state: 274":
+	#instruction start "276 = call 256":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "277 = proj0 276":
+	#instruction start "278 = proj1 276":
+	#Block jump
+	jmp .L15
+.L14:
+	#Block jump elided
+.L15:
+	#instruction start "279 = phi (region: 240) 227 277":
+	#instruction start "280 = return 240, -1, 279":
+	#Block return.
+	movq -104(%rbp), %rbx
+	movq -112(%rbp), %r12
+	movq -120(%rbp), %r13
+	movq -128(%rbp), %r14
+	movq -136(%rbp), %r15
+	leave 
+	ret 
+.global func3
+func3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movq %rbx, -96(%rbp)
+	movq %r12, -104(%rbp)
+	movq %r13, -112(%rbp)
+	movq %r14, -120(%rbp)
+	movq %r15, -128(%rbp)
+	movl %edi, %ebx
+.L16:
+	#instruction start "283 = proj3 281":
+	#instruction start "284 = proj1 281":
+	#instruction start "286 = %rdi":
+	#instruction start "287 = alloc with size 4":
+	leaq -60(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "288 = store part of 287 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "289 = load 287, state: 288":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "290 = constant(10)":
+	movl $10, %r12d
+	#instruction start "291 = 289 == 290":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "293 = if 282 291":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L18
+.L17:
+	#instruction start "296 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "297 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "298 = constant(18)":
+	movl $18, %r13d
+	#instruction start "299 = constant(8)":
+	movq $.Ls8, %r14
+	#instruction start "300 = alloc with size 8":
+	leaq -68(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "301 = store 300 296, state: 288":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "302 = alloc with size 8":
+	leaq -76(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "303 = store 302 297, state: 301":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "304 = alloc with size 4":
+	leaq -80(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "305 = store 304 298, state: 303":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "306 = alloc with size 8":
+	leaq -88(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "307 = store 306 299, state: 305":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "308 = constant(1)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "309 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "310 = load part address of 300 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "311 = proj0 310":
+	#instruction start "312 = proj1 310":
+	#instruction start "313 = load part address of 302 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "314 = proj0 313":
+	#instruction start "315 = proj1 313":
+	#instruction start "316 = load part address of 304 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "317 = proj0 316":
+	#instruction start "318 = proj1 316":
+	#instruction start "319 = load part address of 306 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "320 = proj0 319":
+	#instruction start "321 = proj1 319":
+	#instruction start "322 = allocate_call_stack 0":
+	#instruction start "323 = set_reg %rdi 312":
+	#instruction start "324 = set_reg %rsi 315 state: 323":
+	#instruction start "325 = set_reg %rdx 318 state: 324":
+	#instruction start "326 = set_reg %rcx 321 state: 325":
+	#instruction start "327 = set_reg %rax 309 state: 326":
+	#instruction start "328 = call 308":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "329 = proj0 328":
+	#instruction start "330 = proj1 328":
+	#Block jump
+	jmp .L19
+.L18:
+	#Block jump elided
+.L19:
+	#instruction start "331 = phi (region: 292) 288 329":
+	#instruction start "332 = return 292, -1, 331":
+	#Block return.
+	movq -96(%rbp), %rbx
+	movq -104(%rbp), %r12
+	movq -112(%rbp), %r13
+	movq -120(%rbp), %r14
+	movq -128(%rbp), %r15
+	leave 
+	ret 
+.global func4
+func4:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rbx, -100(%rbp)
+	movq %r12, -108(%rbp)
+	movq %r13, -116(%rbp)
+	movq %r14, -124(%rbp)
+	movq %r15, -132(%rbp)
+	movq %rdi, %rbx
+.L20:
+	#instruction start "335 = proj3 333":
+	#instruction start "336 = proj1 333":
+	#instruction start "338 = %rdi":
+	#instruction start "339 = alloc with size 8":
+	leaq -64(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "340 = store part of 339 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "341 = constant(9)":
+	movq $global_size, %rbx
+	#instruction start "342 = load_volatile 341, state: 340":
+	movq %rbx, %rdi
+	movq (%rdi), %r12
+	#instruction start "343 = proj0 342":
+	#instruction start "344 = proj1 342":
+	#instruction start "345 = int_cast_zero 344":
+	movq %r12, %rax
+	movq %rax, %rbx
+	#instruction start "346 = constant(1)":
+	movq $1, %r12
+	#instruction start "347 = 345 * 346":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "348 = constant(9)":
+	movq $global_size, %rbx
+	#instruction start "349 = load_volatile 348, state: 343":
+	movq %rbx, %rdi
+	movq (%rdi), %r12
+	#instruction start "350 = proj0 349":
+	#instruction start "351 = proj1 349":
+	#instruction start "352 = 347 == 351":
+	movq %r13, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %ebx
+	#instruction start "354 = if 334 352":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "357 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "358 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "359 = constant(23)":
+	movl $23, %r13d
+	#instruction start "360 = constant(11)":
+	movq $.Ls11, %r14
+	#instruction start "361 = alloc with size 8":
+	leaq -72(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "362 = store 361 357, state: 350":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "363 = alloc with size 8":
+	leaq -80(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "364 = store 363 358, state: 362":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "365 = alloc with size 4":
+	leaq -84(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "366 = store 365 359, state: 364":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "367 = alloc with size 8":
+	leaq -92(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "368 = store 367 360, state: 366":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "369 = constant(1)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "370 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "371 = load part address of 361 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "372 = proj0 371":
+	#instruction start "373 = proj1 371":
+	#instruction start "374 = load part address of 363 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "375 = proj0 374":
+	#instruction start "376 = proj1 374":
+	#instruction start "377 = load part address of 365 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "378 = proj0 377":
+	#instruction start "379 = proj1 377":
+	#instruction start "380 = load part address of 367 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "381 = proj0 380":
+	#instruction start "382 = proj1 380":
+	#instruction start "383 = allocate_call_stack 0":
+	#instruction start "384 = set_reg %rdi 373":
+	#instruction start "385 = set_reg %rsi 376 state: 384":
+	#instruction start "386 = set_reg %rdx 379 state: 385":
+	#instruction start "387 = set_reg %rcx 382 state: 386":
+	#instruction start "388 = set_reg %rax 370 state: 387":
+	#instruction start "389 = call 369":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "390 = proj0 389":
+	#instruction start "391 = proj1 389":
+	#Block jump
+	jmp .L23
+.L22:
+	#Block jump elided
+.L23:
+	#instruction start "392 = phi (region: 353) 350 390":
+	#instruction start "393 = return 353, -1, 392":
+	#Block return.
+	movq -100(%rbp), %rbx
+	movq -108(%rbp), %r12
+	movq -116(%rbp), %r13
+	movq -124(%rbp), %r14
+	movq -132(%rbp), %r15
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8944, %rsp
+	movq %rbx, -8908(%rbp)
+	movq %r12, -8916(%rbp)
+	movq %r13, -8924(%rbp)
+	movq %r14, -8932(%rbp)
+	movq %r15, -8940(%rbp)
+	movq $0, -632(%rbp)
+	movq $0, -624(%rbp)
+	movq $0, -616(%rbp)
+.L24:
+	#instruction start "396 = proj3 394":
+	#instruction start "401 = constant(100)":
+	leaq -4(%rbp), %rdi
+	movl $100, (%rdi)
+	#instruction start "404 = int_cast_zero 401":
+	movl -4(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -12(%rbp)
+	#instruction start "405 = int_cast_zero 404":
+	movq -12(%rbp), %rax
+	movq %rax, %r13
+	#instruction start "406 = constant(4)":
+	movq $4, %r14
+	#instruction start "407 = 405 * 406":
+	movq %r13, %rax
+	movq %r14, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "408 = vla_alloc 407":
+	movq $0, -624(%rbp)
+	movq $0, -616(%rbp)
+	movq -632(%rbp), %rax
+	cmpq $0, %rax
+	jne .L56
+	movq %rsp, %rax
+	movq %rax, -632(%rbp)
+.L56:
+	movq %rax, %rsp
+	movq %rsp, -632(%rbp)
+	movq %r15, %rax
+	subq %rax, %rsp
+	movq %rsp, -20(%rbp)
+	andq $-16, %rsp
+	#instruction start "409 = constant(20)":
+	movl $20, %r14d
+	#instruction start "410 = int_cast_zero 409":
+	movq %r14, %rax
+	movslq %eax, %rax
+	movq %rax, %r15
+	#instruction start "411 = constant(4)":
+	movq $4, %r14
+	#instruction start "412 = 410 * 411":
+	movq %r15, %rax
+	movq %r14, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "413 = 408 + 412":
+	movq -20(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "414 = constant(100)":
+	movl $100, %r12d
+	#instruction start "415 = store 413 414, state: 396":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "416 = constant(99)":
+	movl $99, %r12d
+	#instruction start "417 = int_cast_zero 416":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r14
+	#instruction start "418 = constant(4)":
+	movq $4, %r12
+	#instruction start "419 = 417 * 418":
+	movq %r14, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "420 = 408 + 419":
+	movq -20(%rbp), %rax
+	movq %r15, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "421 = constant(99)":
+	movl $99, %r14d
+	#instruction start "422 = store 420 421, state: 415":
+	movq %r12, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "424 = int_cast_zero 401":
+	movl -4(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "425 = int_cast_zero 424":
+	movq %r12, %rax
+	movq %rax, %r14
+	#instruction start "426 = constant(4)":
+	movq $4, %r12
+	#instruction start "427 = 425 * 426":
+	movq %r14, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "428 = vla_alloc 427":
+	movq $0, -616(%rbp)
+	movq -624(%rbp), %rax
+	cmpq $0, %rax
+	jne .L57
+	movq %rsp, %rax
+	movq %rax, -624(%rbp)
+.L57:
+	movq %rax, %rsp
+	movq %rsp, -624(%rbp)
+	movq %r15, %rax
+	subq %rax, %rsp
+	movq %rsp, %r12
+	andq $-16, %rsp
+	#instruction start "429 = constant(0)":
+	movl $0, %r14d
+	#instruction start "430 = int_cast_zero 429":
+	movq %r14, %rax
+	movslq %eax, %rax
+	movq %rax, %r15
+	#instruction start "431 = constant(4)":
+	movq $4, %r14
+	#instruction start "432 = 430 * 431":
+	movq %r15, %rax
+	movq %r14, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "433 = 428 + 432":
+	movq %r12, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "434 = constant(20)":
+	movl $20, %r12d
+	#instruction start "435 = store 433 434, state: 422":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "436 = constant(20)":
+	movl $20, %r12d
+	#instruction start "437 = int_cast_zero 436":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "438 = constant(4)":
+	movq $4, %r12
+	#instruction start "439 = 437 * 438":
+	movq %r13, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "440 = 408 + 439":
+	movq -20(%rbp), %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "441 = load_volatile 440, state: 435":
+	movq %r12, %rdi
+	movl (%rdi), %r13d
+	#instruction start "442 = proj0 441":
+	#instruction start "443 = proj1 441":
+	#instruction start "444 = constant(100)":
+	movl $100, %r12d
+	#instruction start "445 = 443 == 444":
+	movq %r13, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "447 = if 395 445":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L26
+.L25:
+	#instruction start "450 = constant(12)":
+	movq $.Ls12, %r12
+	#instruction start "451 = constant(3)":
+	movq $.Ls3, %r13
+	#instruction start "452 = constant(33)":
+	movl $33, %r14d
+	#instruction start "453 = constant(13)":
+	movq $.Ls13, %r15
+	#instruction start "454 = alloc with size 8":
+	leaq -640(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "455 = store 454 450, state: 442":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "456 = alloc with size 8":
+	leaq -648(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "457 = store 456 451, state: 455":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "458 = alloc with size 4":
+	leaq -652(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "459 = store 458 452, state: 457":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "460 = alloc with size 8":
+	leaq -660(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "461 = store 460 453, state: 459":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "462 = constant(1)":
+	leaq -28(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "463 = constant(0)":
+	leaq -36(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "464 = load part address of 454 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "465 = proj0 464":
+	#instruction start "466 = proj1 464":
+	#instruction start "467 = load part address of 456 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "468 = proj0 467":
+	#instruction start "469 = proj1 467":
+	#instruction start "470 = load part address of 458 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "471 = proj0 470":
+	#instruction start "472 = proj1 470":
+	#instruction start "473 = load part address of 460 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "474 = proj0 473":
+	#instruction start "475 = proj1 473":
+	#instruction start "476 = allocate_call_stack 0":
+	#instruction start "477 = set_reg %rdi 466":
+	#instruction start "478 = set_reg %rsi 469 state: 477":
+	#instruction start "479 = set_reg %rdx 472 state: 478":
+	#instruction start "480 = set_reg %rcx 475 state: 479":
+	#instruction start "481 = set_reg %rax 463 state: 480":
+	#instruction start "482 = call 462":
+	addq $0, %rsp
+	movq -36(%rbp), %rax
+	movq %r13, %rcx
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq -28(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "483 = proj0 482":
+	#instruction start "484 = proj1 482":
+	#Phi node to 990 (446 401 401)
+	movl -4(%rbp), %eax
+	movl %eax, -80(%rbp)
+	#Block jump
+	jmp .L27
+.L26:
+	#Phi node to 990 (446 401 401)
+	movl -4(%rbp), %eax
+	movl %eax, -80(%rbp)
+	#Block jump elided
+.L27:
+	#instruction start "485 = constant(99)":
+	movl $99, %r12d
+	#instruction start "486 = int_cast_zero 485":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "487 = constant(4)":
+	movq $4, %r12
+	#instruction start "488 = 486 * 487":
+	movq %r13, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "489 = 408 + 488":
+	movq -20(%rbp), %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "490 = phi (region: 446) 442 483":
+	#instruction start "491 = load_volatile 489, state: 490":
+	movq %r12, %rdi
+	movl (%rdi), %r13d
+	#instruction start "492 = proj0 491":
+	#instruction start "493 = proj1 491":
+	#instruction start "494 = constant(99)":
+	movl $99, %r12d
+	#instruction start "495 = 493 == 494":
+	movq %r13, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "497 = if 446 495":
+	#instruction start "990 = phi (region: 446) 401 401":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L29
+.L28:
+	#instruction start "500 = constant(14)":
+	movq $.Ls14, %r12
+	#instruction start "501 = constant(3)":
+	movq $.Ls3, %r13
+	#instruction start "502 = constant(34)":
+	movl $34, %r14d
+	#instruction start "503 = constant(13)":
+	movq $.Ls13, %r15
+	#instruction start "504 = alloc with size 8":
+	leaq -668(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "505 = store 504 500, state: 492":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "506 = alloc with size 8":
+	leaq -676(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "507 = store 506 501, state: 505":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "508 = alloc with size 4":
+	leaq -680(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "509 = store 508 502, state: 507":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "510 = alloc with size 8":
+	leaq -688(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "511 = store 510 503, state: 509":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "512 = constant(1)":
+	leaq -88(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "513 = constant(0)":
+	leaq -96(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "514 = load part address of 504 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "515 = proj0 514":
+	#instruction start "516 = proj1 514":
+	#instruction start "517 = load part address of 506 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "518 = proj0 517":
+	#instruction start "519 = proj1 517":
+	#instruction start "520 = load part address of 508 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "521 = proj0 520":
+	#instruction start "522 = proj1 520":
+	#instruction start "523 = load part address of 510 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "524 = proj0 523":
+	#instruction start "525 = proj1 523":
+	#instruction start "526 = allocate_call_stack 0":
+	#instruction start "527 = set_reg %rdi 516":
+	#instruction start "528 = set_reg %rsi 519 state: 527":
+	#instruction start "529 = set_reg %rdx 522 state: 528":
+	#instruction start "530 = set_reg %rcx 525 state: 529":
+	#instruction start "531 = set_reg %rax 513 state: 530":
+	#instruction start "532 = call 512":
+	addq $0, %rsp
+	movq -96(%rbp), %rax
+	movq %r13, %rcx
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq -88(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "533 = proj0 532":
+	#instruction start "534 = proj1 532":
+	#Phi node to 989 (496 990 990)
+	movl -80(%rbp), %eax
+	movl %eax, -140(%rbp)
+	#Block jump
+	jmp .L30
+.L29:
+	#Phi node to 989 (496 990 990)
+	movl -80(%rbp), %eax
+	movl %eax, -140(%rbp)
+	#Block jump elided
+.L30:
+	#instruction start "535 = phi (region: 496) 492 533":
+	#instruction start "989 = phi (region: 496) 990 990":
+	#instruction start "537 = int_cast_zero 989":
+	movl -140(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "538 = int_cast_zero 537":
+	movq %r12, %rax
+	movq %rax, %r13
+	#instruction start "539 = constant(1)":
+	movq $1, %r12
+	#instruction start "540 = 538 * 539":
+	movq %r13, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "542 = int_cast_zero 989":
+	movl -140(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "543 = 540 == 542":
+	movq %r14, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "545 = if 496 543":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L32
+.L31:
+	#instruction start "548 = constant(15)":
+	movq $.Ls15, %r12
+	#instruction start "549 = constant(3)":
+	movq $.Ls3, %r13
+	#instruction start "550 = constant(36)":
+	movl $36, %r14d
+	#instruction start "551 = constant(13)":
+	movq $.Ls13, %r15
+	#instruction start "552 = alloc with size 8":
+	leaq -696(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "553 = store 552 548, state: 535":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "554 = alloc with size 8":
+	leaq -704(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "555 = store 554 549, state: 553":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "556 = alloc with size 4":
+	leaq -708(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "557 = store 556 550, state: 555":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "558 = alloc with size 8":
+	leaq -716(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "559 = store 558 551, state: 557":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "560 = constant(1)":
+	leaq -148(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "561 = constant(0)":
+	leaq -156(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "562 = load part address of 552 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "563 = proj0 562":
+	#instruction start "564 = proj1 562":
+	#instruction start "565 = load part address of 554 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "566 = proj0 565":
+	#instruction start "567 = proj1 565":
+	#instruction start "568 = load part address of 556 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "569 = proj0 568":
+	#instruction start "570 = proj1 568":
+	#instruction start "571 = load part address of 558 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "572 = proj0 571":
+	#instruction start "573 = proj1 571":
+	#instruction start "574 = allocate_call_stack 0":
+	#instruction start "575 = set_reg %rdi 564":
+	#instruction start "576 = set_reg %rsi 567 state: 575":
+	#instruction start "577 = set_reg %rdx 570 state: 576":
+	#instruction start "578 = set_reg %rcx 573 state: 577":
+	#instruction start "579 = set_reg %rax 561 state: 578":
+	#instruction start "580 = call 560":
+	addq $0, %rsp
+	movq -156(%rbp), %rax
+	movq %r13, %rcx
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq -148(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "581 = proj0 580":
+	#instruction start "582 = proj1 580":
+	#Phi node to 991 (544 989 989)
+	movl -140(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump
+	jmp .L33
+.L32:
+	#Phi node to 991 (544 989 989)
+	movl -140(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump elided
+.L33:
+	#instruction start "583 = phi (region: 544) 535 581":
+	#instruction start "585 = constant(2)":
+	movl $2, %r12d
+	#instruction start "991 = phi (region: 544) 989 989":
+	#instruction start "586 = 991 * 585 (signed)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	imull %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "587 = int_cast_zero 586":
+	movq %r13, %rax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "589 = int_cast_zero 991":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "590 = int_cast_zero 589":
+	movq %r13, %rax
+	movq %rax, %r14
+	#instruction start "591 = int_cast_zero 587":
+	movq %r12, %rax
+	movq %rax, %r13
+	#instruction start "592 = constant(1)":
+	movq $1, %r12
+	#instruction start "593 = 591 * 592":
+	movq %r13, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "594 = 590 * 593":
+	movq %r14, %rax
+	movq %r15, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "597 = 991 * 991 (signed)":
+	movq %rbx, %rax
+	movq %rbx, %rcx
+	imull %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "598 = constant(2)":
+	movl $2, %ebx
+	#instruction start "599 = 597 * 598 (signed)":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	imull %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "600 = int_cast_zero 599":
+	movq %r14, %rax
+	movslq %eax, %rax
+	movq %rax, %rbx
+	#instruction start "601 = 594 == 600":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "603 = if 544 601":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L35
+.L34:
+	#instruction start "606 = constant(16)":
+	movq $.Ls16, %rbx
+	#instruction start "607 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "608 = constant(37)":
+	movl $37, %r13d
+	#instruction start "609 = constant(13)":
+	movq $.Ls13, %r14
+	#instruction start "610 = alloc with size 8":
+	leaq -724(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "611 = store 610 606, state: 583":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "612 = alloc with size 8":
+	leaq -732(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "613 = store 612 607, state: 611":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "614 = alloc with size 4":
+	leaq -736(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "615 = store 614 608, state: 613":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "616 = alloc with size 8":
+	leaq -744(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "617 = store 616 609, state: 615":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "618 = constant(1)":
+	leaq -204(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "619 = constant(0)":
+	leaq -212(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "620 = load part address of 610 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "621 = proj0 620":
+	#instruction start "622 = proj1 620":
+	#instruction start "623 = load part address of 612 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "624 = proj0 623":
+	#instruction start "625 = proj1 623":
+	#instruction start "626 = load part address of 614 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "627 = proj0 626":
+	#instruction start "628 = proj1 626":
+	#instruction start "629 = load part address of 616 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "630 = proj0 629":
+	#instruction start "631 = proj1 629":
+	#instruction start "632 = allocate_call_stack 0":
+	#instruction start "633 = set_reg %rdi 622":
+	#instruction start "634 = set_reg %rsi 625 state: 633":
+	#instruction start "635 = set_reg %rdx 628 state: 634":
+	#instruction start "636 = set_reg %rcx 631 state: 635":
+	#instruction start "637 = set_reg %rax 619 state: 636":
+	#instruction start "638 = call 618":
+	addq $0, %rsp
+	movq -212(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -204(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "639 = proj0 638":
+	#instruction start "640 = proj1 638":
+	#Block jump
+	jmp .L36
+.L35:
+	#Block jump elided
+.L36:
+	#instruction start "642 = phi (region: 602) 583 639":
+	#instruction start "644 = constant(5)":
+	leaq -256(%rbp), %rdi
+	movl $5, (%rdi)
+	#instruction start "647 = int_cast_zero 644":
+	movl -256(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "648 = int_cast_zero 647":
+	movq %r12, %rax
+	movq %rax, %r13
+	#instruction start "649 = constant(1)":
+	movq $1, %r12
+	#instruction start "650 = 648 * 649":
+	movq %r13, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "651 = constant(2)":
+	movq $2, %r12
+	#instruction start "652 = 651 * 650":
+	movq %r12, %rax
+	movq %r14, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "653 = constant(2)":
+	movl $2, %r12d
+	#instruction start "655 = 653 * 644 (signed)":
+	movq %r12, %rax
+	movl -256(%rbp), %ecx
+	imull %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "656 = int_cast_zero 655":
+	movq %r14, %rax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "657 = 652 == 656":
+	movq %r13, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "659 = if 602 657":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L38
+.L37:
+	#instruction start "662 = constant(17)":
+	movq $.Ls17, %r12
+	#instruction start "663 = constant(3)":
+	movq $.Ls3, %r13
+	#instruction start "664 = constant(40)":
+	movl $40, %r14d
+	#instruction start "665 = constant(13)":
+	movq $.Ls13, %r15
+	#instruction start "666 = alloc with size 8":
+	leaq -752(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "667 = store 666 662, state: 642":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "668 = alloc with size 8":
+	leaq -760(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "669 = store 668 663, state: 667":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "670 = alloc with size 4":
+	leaq -764(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "671 = store 670 664, state: 669":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "672 = alloc with size 8":
+	leaq -772(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "673 = store 672 665, state: 671":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "674 = constant(1)":
+	leaq -264(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "675 = constant(0)":
+	leaq -272(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "676 = load part address of 666 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "677 = proj0 676":
+	#instruction start "678 = proj1 676":
+	#instruction start "679 = load part address of 668 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "680 = proj0 679":
+	#instruction start "681 = proj1 679":
+	#instruction start "682 = load part address of 670 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "683 = proj0 682":
+	#instruction start "684 = proj1 682":
+	#instruction start "685 = load part address of 672 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "686 = proj0 685":
+	#instruction start "687 = proj1 685":
+	#instruction start "688 = allocate_call_stack 0":
+	#instruction start "689 = set_reg %rdi 678":
+	#instruction start "690 = set_reg %rsi 681 state: 689":
+	#instruction start "691 = set_reg %rdx 684 state: 690":
+	#instruction start "692 = set_reg %rcx 687 state: 691":
+	#instruction start "693 = set_reg %rax 675 state: 692":
+	#instruction start "694 = call 674":
+	addq $0, %rsp
+	movq -272(%rbp), %rax
+	movq %r13, %rcx
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq -264(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "695 = proj0 694":
+	#instruction start "696 = proj1 694":
+	#Phi node to 992 (658 644 644)
+	movl -256(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump
+	jmp .L39
+.L38:
+	#Phi node to 992 (658 644 644)
+	movl -256(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump elided
+.L39:
+	#instruction start "697 = phi (region: 658) 642 695":
+	#instruction start "992 = phi (region: 658) 644 644":
+	#instruction start "699 = int_cast_zero 992":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "701 = int_cast_zero 992":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "708 = int_cast_zero 701":
+	movq %r13, %rax
+	movq %rax, %r14
+	#instruction start "709 = int_cast_zero 699":
+	movq %r12, %rax
+	movq %rax, %r13
+	#instruction start "710 = constant(1)":
+	movq $1, %r12
+	#instruction start "711 = 709 * 710":
+	movq %r13, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "712 = 708 * 711":
+	movq %r14, %rax
+	movq %r15, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "715 = 992 * 992 (signed)":
+	movq %rbx, %rax
+	movq %rbx, %rcx
+	imull %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "716 = int_cast_zero 715":
+	movq %r13, %rax
+	movslq %eax, %rax
+	movq %rax, %rbx
+	#instruction start "717 = 712 == 716":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "719 = if 658 717":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L41
+.L40:
+	#instruction start "722 = constant(18)":
+	movq $.Ls18, %rbx
+	#instruction start "723 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "724 = constant(43)":
+	movl $43, %r13d
+	#instruction start "725 = constant(13)":
+	movq $.Ls13, %r14
+	#instruction start "726 = alloc with size 8":
+	leaq -780(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "727 = store 726 722, state: 697":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "728 = alloc with size 8":
+	leaq -788(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "729 = store 728 723, state: 727":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "730 = alloc with size 4":
+	leaq -792(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "731 = store 730 724, state: 729":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "732 = alloc with size 8":
+	leaq -800(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "733 = store 732 725, state: 731":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "734 = constant(1)":
+	leaq -320(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "735 = constant(0)":
+	leaq -328(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "736 = load part address of 726 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "737 = proj0 736":
+	#instruction start "738 = proj1 736":
+	#instruction start "739 = load part address of 728 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "740 = proj0 739":
+	#instruction start "741 = proj1 739":
+	#instruction start "742 = load part address of 730 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "743 = proj0 742":
+	#instruction start "744 = proj1 742":
+	#instruction start "745 = load part address of 732 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "746 = proj0 745":
+	#instruction start "747 = proj1 745":
+	#instruction start "748 = allocate_call_stack 0":
+	#instruction start "749 = set_reg %rdi 738":
+	#instruction start "750 = set_reg %rsi 741 state: 749":
+	#instruction start "751 = set_reg %rdx 744 state: 750":
+	#instruction start "752 = set_reg %rcx 747 state: 751":
+	#instruction start "753 = set_reg %rax 735 state: 752":
+	#instruction start "754 = call 734":
+	addq $0, %rsp
+	movq -328(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -320(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "755 = proj0 754":
+	#instruction start "756 = proj1 754":
+	#Block jump
+	jmp .L42
+.L41:
+	#Block jump elided
+.L42:
+	#instruction start "988 = phi (region: 718) 697 755":
+	#Block jump elided
+.L43:
+	#instruction start "766 = constant(0)":
+	movl $0, %ebx
+	#Phi node to 993 (759 766 778)
+	movq %rbx, %rax
+	movl %eax, -380(%rbp)
+	#Block jump elided
+.L44:
+	#instruction start "757 = alloc with size 8000":
+	leaq -8800(%rbp), %rsi
+	movq %rsi, -376(%rbp)
+	#instruction start "768 = phi (region: 759) 988 826":
+	#instruction start "770 = constant(1000)":
+	movl $1000, %r13d
+	#instruction start "993 = phi (region: 759) 766 778":
+	#instruction start "771 = 993 < 770 (signed)":
+	movl -380(%rbp), %eax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "772 = if 759 771":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L53
+.L45:
+	#Block jump elided
+.L46:
+	#instruction start "827 = constant(0)":
+	movl $0, %r13d
+	#instruction start "828 = int_cast_zero 827":
+	movq %r13, %rax
+	movslq %eax, %rax
+	movq %rax, %r14
+	#instruction start "829 = constant(8)":
+	movq $8, %r13
+	#instruction start "830 = 828 * 829":
+	movq %r14, %rax
+	movq %r13, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "831 = 757 + 830":
+	movq -376(%rbp), %rax
+	movq %r15, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "832 = constant(999)":
+	movl $999, %r14d
+	#instruction start "833 = int_cast_zero 832":
+	movq %r14, %rax
+	movslq %eax, %rax
+	movq %rax, %r15
+	#instruction start "834 = constant(8)":
+	movq $8, %r14
+	#instruction start "835 = 833 * 834":
+	movq %r15, %rax
+	movq %r14, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "836 = 757 + 835":
+	movq -376(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "838 = load_volatile 831, state: 768":
+	movq %r13, %rdi
+	movq (%rdi), %rbx
+	#instruction start "839 = proj0 838":
+	#instruction start "840 = proj1 838":
+	#instruction start "841 = load_volatile 836, state: 839":
+	movq %r14, %rdi
+	movq (%rdi), %r13
+	#instruction start "842 = proj0 841":
+	#instruction start "843 = proj1 841":
+	#instruction start "844 = constant(1)":
+	movq $1, %r14
+	#instruction start "845 = 840 - 843":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	subq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "846 = 845 / 844 (signed)":
+	movq %r15, %rax
+	movq %r14, %rcx
+	cqto 
+	idivq %rcx
+	movq %rax, %rbx
+	#instruction start "847 = proj1 846":
+	#instruction start "848 = proj0 846":
+	#instruction start "849 = constant(1100)":
+	movq $1100, %r13
+	#instruction start "850 = 848 < 849 (signed)":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "852 = if 762 850":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L48
+.L47:
+	#instruction start "855 = constant(20)":
+	movq $.Ls20, %rbx
+	#instruction start "856 = constant(3)":
+	movq $.Ls3, %r13
+	#instruction start "857 = constant(51)":
+	movl $51, %r14d
+	#instruction start "858 = constant(13)":
+	movq $.Ls13, %r15
+	#instruction start "859 = alloc with size 8":
+	leaq -8808(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "860 = store 859 855, state: 847":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "861 = alloc with size 8":
+	leaq -8816(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "862 = store 861 856, state: 860":
+	movq %rbx, %rsi
+	movq %r13, (%rsi)
+	#instruction start "863 = alloc with size 4":
+	leaq -8820(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "864 = store 863 857, state: 862":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "865 = alloc with size 8":
+	leaq -8828(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "866 = store 865 858, state: 864":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "867 = constant(1)":
+	leaq -388(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "868 = constant(0)":
+	leaq -396(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "869 = load part address of 859 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "870 = proj0 869":
+	#instruction start "871 = proj1 869":
+	#instruction start "872 = load part address of 861 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "873 = proj0 872":
+	#instruction start "874 = proj1 872":
+	#instruction start "875 = load part address of 863 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "876 = proj0 875":
+	#instruction start "877 = proj1 875":
+	#instruction start "878 = load part address of 865 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "879 = proj0 878":
+	#instruction start "880 = proj1 878":
+	#instruction start "881 = allocate_call_stack 0":
+	#instruction start "882 = set_reg %rdi 871":
+	#instruction start "883 = set_reg %rsi 874 state: 882":
+	#instruction start "884 = set_reg %rdx 877 state: 883":
+	#instruction start "885 = set_reg %rcx 880 state: 884":
+	#instruction start "886 = set_reg %rax 868 state: 885":
+	#instruction start "887 = call 867":
+	addq $0, %rsp
+	movq -396(%rbp), %rax
+	movq %r13, %rcx
+	movq %rbx, %rdx
+	movq %r12, %rsi
+	movq %r15, %rdi
+	movq -388(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "888 = proj0 887":
+	#instruction start "889 = proj1 887":
+	#Block jump
+	jmp .L49
+.L48:
+	#Block jump elided
+.L49:
+	#instruction start "890 = constant(0)":
+	movq $0, %rbx
+	#instruction start "891 = alloc with size 8":
+	leaq -8836(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "892 = phi (region: 851) 847 888":
+	#instruction start "893 = store 891 890, state: 892":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "894 = constant(21)":
+	movq $func1, %rbx
+	#instruction start "895 = constant(0)":
+	movq $0, %r13
+	#instruction start "896 = load part address of 891 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "897 = proj0 896":
+	#instruction start "898 = proj1 896":
+	#instruction start "899 = allocate_call_stack 0":
+	#instruction start "900 = set_reg %rdi 898":
+	#instruction start "901 = set_reg %rax 895 state: 900":
+	#instruction start "902 = call 894":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "903 = proj0 902":
+	#instruction start "904 = proj1 902":
+	#instruction start "905 = constant(0)":
+	movq $0, %rbx
+	#instruction start "906 = alloc with size 4":
+	leaq -8840(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "907 = constant(100)":
+	movl $100, %r13d
+	#instruction start "908 = store 906 907, state: 903":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "909 = alloc with size 8":
+	leaq -8848(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "910 = store 909 905, state: 908":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "911 = constant(22)":
+	movq $func2, %rbx
+	#instruction start "912 = constant(0)":
+	movq $0, %r14
+	#instruction start "913 = load part address of 906 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r15d
+	#instruction start "914 = proj0 913":
+	#instruction start "915 = proj1 913":
+	#instruction start "916 = load part address of 909 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "917 = proj0 916":
+	#instruction start "918 = proj1 916":
+	#instruction start "919 = allocate_call_stack 0":
+	#instruction start "920 = set_reg %rdi 915":
+	#instruction start "921 = set_reg %rsi 918 state: 920":
+	#instruction start "922 = set_reg %rax 912 state: 921":
+	#instruction start "923 = call 911":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r12, %rsi
+	movq %r15, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "924 = proj0 923":
+	#instruction start "925 = proj1 923":
+	#instruction start "926 = alloc with size 4":
+	leaq -8852(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "927 = constant(10)":
+	movl $10, %r12d
+	#instruction start "928 = store 926 927, state: 924":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "929 = constant(23)":
+	movq $func3, %r12
+	#instruction start "930 = constant(0)":
+	movq $0, %r13
+	#instruction start "931 = load part address of 926 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "932 = proj0 931":
+	#instruction start "933 = proj1 931":
+	#instruction start "934 = allocate_call_stack 0":
+	#instruction start "935 = set_reg %rdi 933":
+	#instruction start "936 = set_reg %rax 930 state: 935":
+	#instruction start "937 = call 929":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "938 = proj0 937":
+	#instruction start "939 = proj1 937":
+	#instruction start "940 = int_cast_zero 404":
+	movq -12(%rbp), %rax
+	movq %rax, %rbx
+	#instruction start "941 = constant(4)":
+	movq $4, %r12
+	#instruction start "942 = 940 * 941":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "943 = constant(400)":
+	movq $400, %rbx
+	#instruction start "944 = 942 == 943":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "946 = if 851 944":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L51
+.L50:
+	#instruction start "949 = constant(24)":
+	movq $.Ls24, %rbx
+	#instruction start "950 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "951 = constant(57)":
+	movl $57, %r13d
+	#instruction start "952 = constant(13)":
+	movq $.Ls13, %r14
+	#instruction start "953 = alloc with size 8":
+	leaq -8860(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "954 = store 953 949, state: 938":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "955 = alloc with size 8":
+	leaq -8868(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "956 = store 955 950, state: 954":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "957 = alloc with size 4":
+	leaq -8872(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "958 = store 957 951, state: 956":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "959 = alloc with size 8":
+	leaq -8880(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "960 = store 959 952, state: 958":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "961 = constant(1)":
+	leaq -500(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "962 = constant(0)":
+	leaq -508(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "963 = load part address of 953 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "964 = proj0 963":
+	#instruction start "965 = proj1 963":
+	#instruction start "966 = load part address of 955 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "967 = proj0 966":
+	#instruction start "968 = proj1 966":
+	#instruction start "969 = load part address of 957 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "970 = proj0 969":
+	#instruction start "971 = proj1 969":
+	#instruction start "972 = load part address of 959 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "973 = proj0 972":
+	#instruction start "974 = proj1 972":
+	#instruction start "975 = allocate_call_stack 0":
+	#instruction start "976 = set_reg %rdi 965":
+	#instruction start "977 = set_reg %rsi 968 state: 976":
+	#instruction start "978 = set_reg %rdx 971 state: 977":
+	#instruction start "979 = set_reg %rcx 974 state: 978":
+	#instruction start "980 = set_reg %rax 962 state: 979":
+	#instruction start "981 = call 961":
+	addq $0, %rsp
+	movq -508(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -500(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "982 = proj0 981":
+	#instruction start "983 = proj1 981":
+	#Block jump
+	jmp .L52
+.L51:
+	#Block jump elided
+.L52:
+	#instruction start "984 = constant(0)":
+	movl $0, %ebx
+	#instruction start "985 = set_reg %rax 984":
+	#instruction start "986 = phi (region: 945) 938 982":
+	#instruction start "987 = return 945, 985, 986":
+	movq %rbx, %rax
+	#Block return.
+	movq -8908(%rbp), %rbx
+	movq -8916(%rbp), %r12
+	movq -8924(%rbp), %r13
+	movq -8932(%rbp), %r14
+	movq -8940(%rbp), %r15
+	leave 
+	ret 
+.L53:
+	#Block jump elided
+.L54:
+	#Block jump elided
+.L55:
+	#instruction start "777 = constant(1)":
+	movl $1, %ebx
+	#instruction start "778 = 993 + 777":
+	movl -380(%rbp), %eax
+	movq %rbx, %rcx
+	addl %ecx, %eax
+	movl %eax, -560(%rbp)
+	#instruction start "782 = constant(100)":
+	movl $100, %ebx
+	#instruction start "783 = 993 + 782":
+	movl -380(%rbp), %eax
+	movq %rbx, %rcx
+	addl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "784 = int_cast_zero 783":
+	movq %r13, %rax
+	movslq %eax, %rax
+	movq %rax, %rbx
+	#instruction start "785 = int_cast_zero 784":
+	movq %rbx, %rax
+	movq %rax, %r13
+	#instruction start "786 = constant(1)":
+	movq $1, %rbx
+	#instruction start "787 = 785 * 786":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "788 = vla_alloc 787":
+	movq -616(%rbp), %rax
+	cmpq $0, %rax
+	jne .L58
+	movq %rsp, %rax
+	movq %rax, -616(%rbp)
+.L58:
+	movq %rax, %rsp
+	movq %rsp, -616(%rbp)
+	movq %r14, %rax
+	subq %rax, %rsp
+	movq %rsp, -568(%rbp)
+	andq $-16, %rsp
+	#instruction start "790 = constant(100)":
+	movl $100, %r13d
+	#instruction start "791 = 993 + 790":
+	movl -380(%rbp), %eax
+	movq %r13, %rcx
+	addl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "792 = int_cast_zero 791":
+	movq %r14, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "793 = alloc with size 8":
+	leaq -8888(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "794 = store 793 788, state: 768":
+	movq %r14, %rsi
+	leaq -568(%rbp), %rdi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	#instruction start "795 = alloc with size 4":
+	leaq -8892(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "796 = constant(0)":
+	movl $0, %r12d
+	#instruction start "797 = store 795 796, state: 794":
+	movq %r15, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "798 = alloc with size 8":
+	leaq -8900(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "799 = store 798 792, state: 797":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "800 = constant(19)":
+	leaq -576(%rbp), %rdi
+	movq $memset, (%rdi)
+	#instruction start "801 = constant(0)":
+	movq $0, %rbx
+	#instruction start "802 = load part address of 793 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "803 = proj0 802":
+	#instruction start "804 = proj1 802":
+	#instruction start "805 = load part address of 795 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "806 = proj0 805":
+	#instruction start "807 = proj1 805":
+	#instruction start "808 = load part address of 798 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "809 = proj0 808":
+	#instruction start "810 = proj1 808":
+	#instruction start "811 = allocate_call_stack 0":
+	#instruction start "812 = set_reg %rdi 804":
+	#instruction start "813 = set_reg %rsi 807 state: 812":
+	#instruction start "814 = set_reg %rdx 810 state: 813":
+	#instruction start "815 = set_reg %rax 801 state: 814":
+	#instruction start "816 = call 800":
+	addq $0, %rsp
+	movq %rbx, %rax
+	movq %r15, %rdx
+	movq %r14, %rsi
+	movq %r13, %rdi
+	movq -576(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "817 = proj0 816":
+	#instruction start "818 = proj1 816":
+	#instruction start "822 = int_cast_zero 993":
+	movl -380(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rbx
+	#instruction start "823 = constant(8)":
+	movq $8, %r12
+	#instruction start "824 = 822 * 823":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "825 = 757 + 824":
+	movq -376(%rbp), %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "826 = store 825 788, state: 817":
+	movq %rbx, %rsi
+	leaq -568(%rbp), %rdi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	#Phi node to 993 (759 766 778)
+	movl -560(%rbp), %eax
+	movl %eax, -380(%rbp)
+	#Block jump
+	jmp .L44
+.section .rodata
+.Ls2:
+	.string "sizeof *arr == global\000"
+.Ls3:
+	.string "tests/vla.c\000"
+.Ls4:
+	.string "func1"
+.Ls5:
+	.string "sizeof *arr == n * 2\000"
+.Ls6:
+	.string "func2"
+.Ls7:
+	.string "func3 == 10\000"
+.Ls8:
+	.string "func3"
+.Ls10:
+	.string "sizeof *arr == global_size\000"
+.Ls11:
+	.string "func4"
+.Ls12:
+	.string "arr[20] == 100\000"
+.Ls13:
+	.string "main"
+.Ls14:
+	.string "arr[99] == 99\000"
+.Ls15:
+	.string "sizeof (char [a]) == a\000"
+.Ls16:
+	.string "sizeof (char [a][a * 2]) == a * a * 2\000"
+.Ls17:
+	.string "sizeof (char[2][n]) == 2 * n\000"
+.Ls18:
+	.string "sizeof arr3 == n * n\000"
+.Ls20:
+	.string "ptrs[0] - ptrs[999] < 1100\000"
+.Ls24:
+	.string "sizeof arr == 4 * 10 * 10\000"
+.section .data
+.align 4
+.global global
+global:
+.byte 10
+.byte 0
+.byte 0
+.byte 0
+.section .text
+.section .data
+.align 8
+.global global_size
+global_size:
+.quad 10
+.section .text
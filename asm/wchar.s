@@ -0,0 +1,2277 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $848, %rsp
+	movq %rbx, -811(%rbp)
+	movq %r12, -819(%rbp)
+	movq %r13, -827(%rbp)
+	movq %r14, -835(%rbp)
+	movq %r15, -843(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(0)":
+	movq $.Ls0, %rbx
+	#instruction start "7 = load_volatile 6, state: 3":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "8 = proj0 7":
+	#instruction start "9 = proj1 7":
+	#instruction start "11 = if 2 9":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "14 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "15 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "16 = constant(8)":
+	movl $8, %r13d
+	#instruction start "17 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "18 = alloc with size 8":
+	leaq -480(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "19 = store 18 14, state: 8":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "20 = alloc with size 8":
+	leaq -488(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "21 = store 20 15, state: 19":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "22 = alloc with size 4":
+	leaq -492(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "23 = store 22 16, state: 21":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "24 = alloc with size 8":
+	leaq -500(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "25 = store 24 17, state: 23":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "26 = constant(1)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "27 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "28 = load part address of 18 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "29 = proj0 28":
+	#instruction start "30 = proj1 28":
+	#instruction start "31 = load part address of 20 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "32 = proj0 31":
+	#instruction start "33 = proj1 31":
+	#instruction start "34 = load part address of 22 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "35 = proj0 34":
+	#instruction start "36 = proj1 34":
+	#instruction start "37 = load part address of 24 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "38 = proj0 37":
+	#instruction start "39 = proj1 37":
+	#instruction start "40 = allocate_call_stack 0":
+	#instruction start "41 = set_reg %rdi 30":
+	#instruction start "42 = set_reg %rsi 33 state: 41":
+	#instruction start "43 = set_reg %rdx 36 state: 42":
+	#instruction start "44 = set_reg %rcx 39 state: 43":
+	#instruction start "45 = set_reg %rax 27 state: 44":
+	#instruction start "46 = call 26":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "47 = proj0 46":
+	#instruction start "48 = proj1 46":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "49 = alloc with size 7":
+	leaq -507(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "50 = phi (region: 10) 8 47":
+	#instruction start "51 = set_zero_ptr 49, size: 7":
+	movq %rbx, %rdi
+	movl $0, (%rdi)
+	movw $0, 4(%rdi)
+	movb $0, 6(%rdi)
+	#instruction start "52 = constant(97)":
+	movl $97, %r12d
+	#instruction start "53 = constant(0)":
+	movq $0, %r13
+	#instruction start "54 = 53 + 49":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "55 = store 54 52, state: 51":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "56 = constant(98)":
+	movl $98, %r12d
+	#instruction start "57 = constant(1)":
+	movq $1, %r13
+	#instruction start "58 = 57 + 49":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "59 = store 58 56, state: 55":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "60 = constant(99)":
+	movl $99, %r12d
+	#instruction start "61 = constant(2)":
+	movq $2, %r13
+	#instruction start "62 = 61 + 49":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "63 = store 62 60, state: 59":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "64 = constant(100)":
+	movl $100, %r12d
+	#instruction start "65 = constant(3)":
+	movq $3, %r13
+	#instruction start "66 = 65 + 49":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "67 = store 66 64, state: 63":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "68 = constant(101)":
+	movl $101, %r12d
+	#instruction start "69 = constant(4)":
+	movq $4, %r13
+	#instruction start "70 = 69 + 49":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "71 = store 70 68, state: 67":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "72 = constant(102)":
+	movl $102, %r12d
+	#instruction start "73 = constant(5)":
+	movq $5, %r13
+	#instruction start "74 = 73 + 49":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "75 = store 74 72, state: 71":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "76 = constant(0)":
+	movl $0, %r12d
+	#instruction start "77 = constant(6)":
+	movq $6, %r13
+	#instruction start "78 = 77 + 49":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "79 = store 78 76, state: 75":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "80 = alloc with size 28":
+	leaq -535(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "81 = set_zero_ptr 80, size: 28":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	movq $0, 16(%rdi)
+	movl $0, 24(%rdi)
+	#instruction start "82 = constant(97)":
+	movl $97, %r12d
+	#instruction start "83 = constant(0)":
+	movq $0, %r13
+	#instruction start "84 = 83 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "85 = store 84 82, state: 81":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "86 = constant(0)":
+	movl $0, %r12d
+	#instruction start "87 = constant(1)":
+	movq $1, %r13
+	#instruction start "88 = 87 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "89 = store 88 86, state: 85":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "90 = constant(0)":
+	movl $0, %r12d
+	#instruction start "91 = constant(2)":
+	movq $2, %r13
+	#instruction start "92 = 91 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "93 = store 92 90, state: 89":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "94 = constant(0)":
+	movl $0, %r12d
+	#instruction start "95 = constant(3)":
+	movq $3, %r13
+	#instruction start "96 = 95 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "97 = store 96 94, state: 93":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "98 = constant(98)":
+	movl $98, %r12d
+	#instruction start "99 = constant(4)":
+	movq $4, %r13
+	#instruction start "100 = 99 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "101 = store 100 98, state: 97":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "102 = constant(0)":
+	movl $0, %r12d
+	#instruction start "103 = constant(5)":
+	movq $5, %r13
+	#instruction start "104 = 103 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "105 = store 104 102, state: 101":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "106 = constant(0)":
+	movl $0, %r12d
+	#instruction start "107 = constant(6)":
+	movq $6, %r13
+	#instruction start "108 = 107 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "109 = store 108 106, state: 105":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "110 = constant(0)":
+	movl $0, %r12d
+	#instruction start "111 = constant(7)":
+	movq $7, %r13
+	#instruction start "112 = 111 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "113 = store 112 110, state: 109":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "114 = constant(99)":
+	movl $99, %r12d
+	#instruction start "115 = constant(8)":
+	movq $8, %r13
+	#instruction start "116 = 115 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "117 = store 116 114, state: 113":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "118 = constant(0)":
+	movl $0, %r12d
+	#instruction start "119 = constant(9)":
+	movq $9, %r13
+	#instruction start "120 = 119 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "121 = store 120 118, state: 117":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "122 = constant(0)":
+	movl $0, %r12d
+	#instruction start "123 = constant(10)":
+	movq $10, %r13
+	#instruction start "124 = 123 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "125 = store 124 122, state: 121":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "126 = constant(0)":
+	movl $0, %r12d
+	#instruction start "127 = constant(11)":
+	movq $11, %r13
+	#instruction start "128 = 127 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "129 = store 128 126, state: 125":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "130 = constant(100)":
+	movl $100, %r12d
+	#instruction start "131 = constant(12)":
+	movq $12, %r13
+	#instruction start "132 = 131 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "133 = store 132 130, state: 129":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "134 = constant(0)":
+	movl $0, %r12d
+	#instruction start "135 = constant(13)":
+	movq $13, %r13
+	#instruction start "136 = 135 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "137 = store 136 134, state: 133":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "138 = constant(0)":
+	movl $0, %r12d
+	#instruction start "139 = constant(14)":
+	movq $14, %r13
+	#instruction start "140 = 139 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "141 = store 140 138, state: 137":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "142 = constant(0)":
+	movl $0, %r12d
+	#instruction start "143 = constant(15)":
+	movq $15, %r13
+	#instruction start "144 = 143 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "145 = store 144 142, state: 141":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "146 = constant(101)":
+	movl $101, %r12d
+	#instruction start "147 = constant(16)":
+	movq $16, %r13
+	#instruction start "148 = 147 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "149 = store 148 146, state: 145":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "150 = constant(0)":
+	movl $0, %r12d
+	#instruction start "151 = constant(17)":
+	movq $17, %r13
+	#instruction start "152 = 151 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "153 = store 152 150, state: 149":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "154 = constant(0)":
+	movl $0, %r12d
+	#instruction start "155 = constant(18)":
+	movq $18, %r13
+	#instruction start "156 = 155 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "157 = store 156 154, state: 153":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "158 = constant(0)":
+	movl $0, %r12d
+	#instruction start "159 = constant(19)":
+	movq $19, %r13
+	#instruction start "160 = 159 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "161 = store 160 158, state: 157":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "162 = constant(102)":
+	movl $102, %r12d
+	#instruction start "163 = constant(20)":
+	movq $20, %r13
+	#instruction start "164 = 163 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "165 = store 164 162, state: 161":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "166 = constant(0)":
+	movl $0, %r12d
+	#instruction start "167 = constant(21)":
+	movq $21, %r13
+	#instruction start "168 = 167 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "169 = store 168 166, state: 165":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "170 = constant(0)":
+	movl $0, %r12d
+	#instruction start "171 = constant(22)":
+	movq $22, %r13
+	#instruction start "172 = 171 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "173 = store 172 170, state: 169":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "174 = constant(0)":
+	movl $0, %r12d
+	#instruction start "175 = constant(23)":
+	movq $23, %r13
+	#instruction start "176 = 175 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "177 = store 176 174, state: 173":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "178 = constant(0)":
+	movl $0, %r12d
+	#instruction start "179 = constant(24)":
+	movq $24, %r13
+	#instruction start "180 = 179 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "181 = store 180 178, state: 177":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "182 = constant(0)":
+	movl $0, %r12d
+	#instruction start "183 = constant(25)":
+	movq $25, %r13
+	#instruction start "184 = 183 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "185 = store 184 182, state: 181":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "186 = constant(0)":
+	movl $0, %r12d
+	#instruction start "187 = constant(26)":
+	movq $26, %r13
+	#instruction start "188 = 187 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "189 = store 188 186, state: 185":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "190 = constant(0)":
+	movl $0, %r12d
+	#instruction start "191 = constant(27)":
+	movq $27, %r13
+	#instruction start "192 = 191 + 80":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "193 = store 192 190, state: 189":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "194 = constant(1)":
+	movl $1, %ebx
+	#instruction start "196 = if 10 194":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "199 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "200 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "201 = constant(19)":
+	movl $19, %r13d
+	#instruction start "202 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "203 = alloc with size 8":
+	leaq -543(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "204 = store 203 199, state: 193":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "205 = alloc with size 8":
+	leaq -551(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "206 = store 205 200, state: 204":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "207 = alloc with size 4":
+	leaq -555(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "208 = store 207 201, state: 206":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "209 = alloc with size 8":
+	leaq -563(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "210 = store 209 202, state: 208":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "211 = constant(1)":
+	leaq -64(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "212 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "213 = load part address of 203 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "214 = proj0 213":
+	#instruction start "215 = proj1 213":
+	#instruction start "216 = load part address of 205 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "217 = proj0 216":
+	#instruction start "218 = proj1 216":
+	#instruction start "219 = load part address of 207 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "220 = proj0 219":
+	#instruction start "221 = proj1 219":
+	#instruction start "222 = load part address of 209 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "223 = proj0 222":
+	#instruction start "224 = proj1 222":
+	#instruction start "225 = allocate_call_stack 0":
+	#instruction start "226 = set_reg %rdi 215":
+	#instruction start "227 = set_reg %rsi 218 state: 226":
+	#instruction start "228 = set_reg %rdx 221 state: 227":
+	#instruction start "229 = set_reg %rcx 224 state: 228":
+	#instruction start "230 = set_reg %rax 212 state: 229":
+	#instruction start "231 = call 211":
+	addq $0, %rsp
+	movq -72(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -64(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "232 = proj0 231":
+	#instruction start "233 = proj1 231":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "234 = alloc with size 12":
+	leaq -575(%rbp), %rsi
+	movq %rsi, -120(%rbp)
+	#instruction start "235 = phi (region: 195) 193 232":
+	#instruction start "236 = set_zero_ptr 234, size: 12":
+	movq -120(%rbp), %rdi
+	movq $0, (%rdi)
+	movl $0, 8(%rdi)
+	#instruction start "237 = constant(-98)":
+	movl $158, %r12d
+	#instruction start "238 = constant(0)":
+	movq $0, %r13
+	#instruction start "239 = 238 + 234":
+	movq %r13, %rax
+	movq -120(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "240 = store 239 237, state: 236":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "241 = constant(-44)":
+	movl $212, %r12d
+	#instruction start "242 = constant(1)":
+	movq $1, %r13
+	#instruction start "243 = 242 + 234":
+	movq %r13, %rax
+	movq -120(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "244 = store 243 241, state: 240":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "245 = constant(1)":
+	movl $1, %r12d
+	#instruction start "246 = constant(2)":
+	movq $2, %r13
+	#instruction start "247 = 246 + 234":
+	movq %r13, %rax
+	movq -120(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "248 = store 247 245, state: 244":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "249 = constant(0)":
+	movl $0, %r12d
+	#instruction start "250 = constant(3)":
+	movq $3, %r13
+	#instruction start "251 = 250 + 234":
+	movq %r13, %rax
+	movq -120(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "252 = store 251 249, state: 248":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "253 = constant(57)":
+	movl $57, %r12d
+	#instruction start "254 = constant(4)":
+	movq $4, %r13
+	#instruction start "255 = 254 + 234":
+	movq %r13, %rax
+	movq -120(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "256 = store 255 253, state: 252":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "257 = constant(-43)":
+	movl $213, %r12d
+	#instruction start "258 = constant(5)":
+	movq $5, %r13
+	#instruction start "259 = 258 + 234":
+	movq %r13, %rax
+	movq -120(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "260 = store 259 257, state: 256":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "261 = constant(1)":
+	movl $1, %r12d
+	#instruction start "262 = constant(6)":
+	movq $6, %r13
+	#instruction start "263 = 262 + 234":
+	movq %r13, %rax
+	movq -120(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "264 = store 263 261, state: 260":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "265 = constant(0)":
+	movl $0, %r12d
+	#instruction start "266 = constant(7)":
+	movq $7, %r13
+	#instruction start "267 = 266 + 234":
+	movq %r13, %rax
+	movq -120(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "268 = store 267 265, state: 264":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "269 = constant(0)":
+	movl $0, %r12d
+	#instruction start "270 = constant(8)":
+	movq $8, %r13
+	#instruction start "271 = 270 + 234":
+	movq %r13, %rax
+	movq -120(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "272 = store 271 269, state: 268":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "273 = constant(0)":
+	movl $0, %r12d
+	#instruction start "274 = constant(9)":
+	movq $9, %r13
+	#instruction start "275 = 274 + 234":
+	movq %r13, %rax
+	movq -120(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "276 = store 275 273, state: 272":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "277 = constant(0)":
+	movl $0, %r12d
+	#instruction start "278 = constant(10)":
+	movq $10, %r13
+	#instruction start "279 = 278 + 234":
+	movq %r13, %rax
+	movq -120(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "280 = store 279 277, state: 276":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "281 = constant(0)":
+	movl $0, %r12d
+	#instruction start "282 = constant(11)":
+	movq $11, %r13
+	#instruction start "283 = 282 + 234":
+	movq %r13, %rax
+	movq -120(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "284 = store 283 281, state: 280":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "285 = constant(0)":
+	movl $0, %r12d
+	#instruction start "286 = int_cast_zero 285":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "287 = constant(4)":
+	movq $4, %r12
+	#instruction start "288 = 286 * 287":
+	movq %r13, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "289 = 234 + 288":
+	movq -120(%rbp), %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "290 = load_volatile 289, state: 284":
+	movq %r12, %rdi
+	movl (%rdi), %r13d
+	#instruction start "291 = proj0 290":
+	#instruction start "292 = proj1 290":
+	#instruction start "293 = constant(119966)":
+	movl $119966, %r12d
+	#instruction start "294 = 292 == 293":
+	movq %r13, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "296 = if 195 294":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "299 = constant(9)":
+	movq $.Ls9, %r12
+	#instruction start "300 = constant(3)":
+	movq $.Ls3, %r13
+	#instruction start "301 = constant(23)":
+	movl $23, %r14d
+	#instruction start "302 = constant(4)":
+	movq $.Ls4, %r15
+	#instruction start "303 = alloc with size 8":
+	leaq -583(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "304 = store 303 299, state: 291":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "305 = alloc with size 8":
+	leaq -591(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "306 = store 305 300, state: 304":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "307 = alloc with size 4":
+	leaq -595(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "308 = store 307 301, state: 306":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "309 = alloc with size 8":
+	leaq -603(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "310 = store 309 302, state: 308":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "311 = constant(1)":
+	leaq -128(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "312 = constant(0)":
+	leaq -136(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "313 = load part address of 303 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "314 = proj0 313":
+	#instruction start "315 = proj1 313":
+	#instruction start "316 = load part address of 305 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "317 = proj0 316":
+	#instruction start "318 = proj1 316":
+	#instruction start "319 = load part address of 307 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "320 = proj0 319":
+	#instruction start "321 = proj1 319":
+	#instruction start "322 = load part address of 309 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "323 = proj0 322":
+	#instruction start "324 = proj1 322":
+	#instruction start "325 = allocate_call_stack 0":
+	#instruction start "326 = set_reg %rdi 315":
+	#instruction start "327 = set_reg %rsi 318 state: 326":
+	#instruction start "328 = set_reg %rdx 321 state: 327":
+	#instruction start "329 = set_reg %rcx 324 state: 328":
+	#instruction start "330 = set_reg %rax 312 state: 329":
+	#instruction start "331 = call 311":
+	addq $0, %rsp
+	movq -136(%rbp), %rax
+	movq %r13, %rcx
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq -128(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "332 = proj0 331":
+	#instruction start "333 = proj1 331":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "334 = constant(1)":
+	movl $1, %ebx
+	#instruction start "335 = int_cast_zero 334":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "336 = constant(4)":
+	movq $4, %rbx
+	#instruction start "337 = 335 * 336":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "338 = 234 + 337":
+	movq -120(%rbp), %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "339 = phi (region: 295) 291 332":
+	#instruction start "340 = load_volatile 338, state: 339":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "341 = proj0 340":
+	#instruction start "342 = proj1 340":
+	#instruction start "343 = constant(120121)":
+	movl $120121, %ebx
+	#instruction start "344 = 342 == 343":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "346 = if 295 344":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "349 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "350 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "351 = constant(24)":
+	movl $24, %r13d
+	#instruction start "352 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "353 = alloc with size 8":
+	leaq -611(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "354 = store 353 349, state: 341":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "355 = alloc with size 8":
+	leaq -619(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "356 = store 355 350, state: 354":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "357 = alloc with size 4":
+	leaq -623(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "358 = store 357 351, state: 356":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "359 = alloc with size 8":
+	leaq -631(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "360 = store 359 352, state: 358":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "361 = constant(1)":
+	leaq -184(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "362 = constant(0)":
+	leaq -192(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "363 = load part address of 353 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "364 = proj0 363":
+	#instruction start "365 = proj1 363":
+	#instruction start "366 = load part address of 355 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "367 = proj0 366":
+	#instruction start "368 = proj1 366":
+	#instruction start "369 = load part address of 357 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "370 = proj0 369":
+	#instruction start "371 = proj1 369":
+	#instruction start "372 = load part address of 359 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "373 = proj0 372":
+	#instruction start "374 = proj1 372":
+	#instruction start "375 = allocate_call_stack 0":
+	#instruction start "376 = set_reg %rdi 365":
+	#instruction start "377 = set_reg %rsi 368 state: 376":
+	#instruction start "378 = set_reg %rdx 371 state: 377":
+	#instruction start "379 = set_reg %rcx 374 state: 378":
+	#instruction start "380 = set_reg %rax 362 state: 379":
+	#instruction start "381 = call 361":
+	addq $0, %rsp
+	movq -192(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -184(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "382 = proj0 381":
+	#instruction start "383 = proj1 381":
+	#Block jump
+	jmp .L14
+.L13:
+	#Block jump elided
+.L14:
+	#instruction start "384 = constant(1)":
+	movl $1, %ebx
+	#instruction start "385 = if 345 384":
+	#instruction start "389 = phi (region: 345) 341 382":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#Block jump
+	jmp .L23
+.L16:
+	#instruction start "388 = alloc with size 60":
+	leaq -691(%rbp), %rsi
+	movq %rsi, -240(%rbp)
+	#instruction start "390 = set_zero_ptr 388, size: 60":
+	movq -240(%rbp), %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	movq $0, 16(%rdi)
+	movq $0, 24(%rdi)
+	movq $0, 32(%rdi)
+	movq $0, 40(%rdi)
+	movq $0, 48(%rdi)
+	movl $0, 56(%rdi)
+	#instruction start "391 = constant(-96)":
+	movl $160, %r12d
+	#instruction start "392 = constant(0)":
+	movq $0, %r13
+	#instruction start "393 = 392 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "394 = store 393 391, state: 390":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "395 = constant(22)":
+	movl $22, %r12d
+	#instruction start "396 = constant(1)":
+	movq $1, %r13
+	#instruction start "397 = 396 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "398 = store 397 395, state: 394":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "399 = constant(0)":
+	movl $0, %r12d
+	#instruction start "400 = constant(2)":
+	movq $2, %r13
+	#instruction start "401 = 400 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "402 = store 401 399, state: 398":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "403 = constant(0)":
+	movl $0, %r12d
+	#instruction start "404 = constant(3)":
+	movq $3, %r13
+	#instruction start "405 = 404 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "406 = store 405 403, state: 402":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "407 = constant(-57)":
+	movl $199, %r12d
+	#instruction start "408 = constant(4)":
+	movq $4, %r13
+	#instruction start "409 = 408 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "410 = store 409 407, state: 406":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "411 = constant(22)":
+	movl $22, %r12d
+	#instruction start "412 = constant(5)":
+	movq $5, %r13
+	#instruction start "413 = 412 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "414 = store 413 411, state: 410":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "415 = constant(0)":
+	movl $0, %r12d
+	#instruction start "416 = constant(6)":
+	movq $6, %r13
+	#instruction start "417 = 416 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "418 = store 417 415, state: 414":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "419 = constant(0)":
+	movl $0, %r12d
+	#instruction start "420 = constant(7)":
+	movq $7, %r13
+	#instruction start "421 = 420 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "422 = store 421 419, state: 418":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "423 = constant(-69)":
+	movl $187, %r12d
+	#instruction start "424 = constant(8)":
+	movq $8, %r13
+	#instruction start "425 = 424 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "426 = store 425 423, state: 422":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "427 = constant(22)":
+	movl $22, %r12d
+	#instruction start "428 = constant(9)":
+	movq $9, %r13
+	#instruction start "429 = 428 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "430 = store 429 427, state: 426":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "431 = constant(0)":
+	movl $0, %r12d
+	#instruction start "432 = constant(10)":
+	movq $10, %r13
+	#instruction start "433 = 432 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "434 = store 433 431, state: 430":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "435 = constant(0)":
+	movl $0, %r12d
+	#instruction start "436 = constant(11)":
+	movq $11, %r13
+	#instruction start "437 = 436 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "438 = store 437 435, state: 434":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "439 = constant(-21)":
+	movl $235, %r12d
+	#instruction start "440 = constant(12)":
+	movq $12, %r13
+	#instruction start "441 = 440 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "442 = store 441 439, state: 438":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "443 = constant(22)":
+	movl $22, %r12d
+	#instruction start "444 = constant(13)":
+	movq $13, %r13
+	#instruction start "445 = 444 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "446 = store 445 443, state: 442":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "447 = constant(0)":
+	movl $0, %r12d
+	#instruction start "448 = constant(14)":
+	movq $14, %r13
+	#instruction start "449 = 448 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "450 = store 449 447, state: 446":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "451 = constant(0)":
+	movl $0, %r12d
+	#instruction start "452 = constant(15)":
+	movq $15, %r13
+	#instruction start "453 = 452 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "454 = store 453 451, state: 450":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "455 = constant(-46)":
+	movl $210, %r12d
+	#instruction start "456 = constant(16)":
+	movq $16, %r13
+	#instruction start "457 = 456 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "458 = store 457 455, state: 454":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "459 = constant(22)":
+	movl $22, %r12d
+	#instruction start "460 = constant(17)":
+	movq $17, %r13
+	#instruction start "461 = 460 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "462 = store 461 459, state: 458":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "463 = constant(0)":
+	movl $0, %r12d
+	#instruction start "464 = constant(18)":
+	movq $18, %r13
+	#instruction start "465 = 464 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "466 = store 465 463, state: 462":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "467 = constant(0)":
+	movl $0, %r12d
+	#instruction start "468 = constant(19)":
+	movq $19, %r13
+	#instruction start "469 = 468 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "470 = store 469 467, state: 466":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "471 = constant(-26)":
+	movl $230, %r12d
+	#instruction start "472 = constant(20)":
+	movq $20, %r13
+	#instruction start "473 = 472 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "474 = store 473 471, state: 470":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "475 = constant(22)":
+	movl $22, %r12d
+	#instruction start "476 = constant(21)":
+	movq $21, %r13
+	#instruction start "477 = 476 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "478 = store 477 475, state: 474":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "479 = constant(0)":
+	movl $0, %r12d
+	#instruction start "480 = constant(22)":
+	movq $22, %r13
+	#instruction start "481 = 480 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "482 = store 481 479, state: 478":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "483 = constant(0)":
+	movl $0, %r12d
+	#instruction start "484 = constant(23)":
+	movq $23, %r13
+	#instruction start "485 = 484 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "486 = store 485 483, state: 482":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "487 = constant(-90)":
+	movl $166, %r12d
+	#instruction start "488 = constant(24)":
+	movq $24, %r13
+	#instruction start "489 = 488 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "490 = store 489 487, state: 486":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "491 = constant(22)":
+	movl $22, %r12d
+	#instruction start "492 = constant(25)":
+	movq $25, %r13
+	#instruction start "493 = 492 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "494 = store 493 491, state: 490":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "495 = constant(0)":
+	movl $0, %r12d
+	#instruction start "496 = constant(26)":
+	movq $26, %r13
+	#instruction start "497 = 496 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "498 = store 497 495, state: 494":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "499 = constant(0)":
+	movl $0, %r12d
+	#instruction start "500 = constant(27)":
+	movq $27, %r13
+	#instruction start "501 = 500 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "502 = store 501 499, state: 498":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "503 = constant(-21)":
+	movl $235, %r12d
+	#instruction start "504 = constant(28)":
+	movq $28, %r13
+	#instruction start "505 = 504 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "506 = store 505 503, state: 502":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "507 = constant(22)":
+	movl $22, %r12d
+	#instruction start "508 = constant(29)":
+	movq $29, %r13
+	#instruction start "509 = 508 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "510 = store 509 507, state: 506":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "511 = constant(0)":
+	movl $0, %r12d
+	#instruction start "512 = constant(30)":
+	movq $30, %r13
+	#instruction start "513 = 512 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "514 = store 513 511, state: 510":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "515 = constant(0)":
+	movl $0, %r12d
+	#instruction start "516 = constant(31)":
+	movq $31, %r13
+	#instruction start "517 = 516 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "518 = store 517 515, state: 514":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "519 = constant(-96)":
+	movl $160, %r12d
+	#instruction start "520 = constant(32)":
+	movq $32, %r13
+	#instruction start "521 = 520 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "522 = store 521 519, state: 518":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "523 = constant(22)":
+	movl $22, %r12d
+	#instruction start "524 = constant(33)":
+	movq $33, %r13
+	#instruction start "525 = 524 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "526 = store 525 523, state: 522":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "527 = constant(0)":
+	movl $0, %r12d
+	#instruction start "528 = constant(34)":
+	movq $34, %r13
+	#instruction start "529 = 528 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "530 = store 529 527, state: 526":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "531 = constant(0)":
+	movl $0, %r12d
+	#instruction start "532 = constant(35)":
+	movq $35, %r13
+	#instruction start "533 = 532 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "534 = store 533 531, state: 530":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "535 = constant(-79)":
+	movl $177, %r12d
+	#instruction start "536 = constant(36)":
+	movq $36, %r13
+	#instruction start "537 = 536 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "538 = store 537 535, state: 534":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "539 = constant(22)":
+	movl $22, %r12d
+	#instruction start "540 = constant(37)":
+	movq $37, %r13
+	#instruction start "541 = 540 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "542 = store 541 539, state: 538":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "543 = constant(0)":
+	movl $0, %r12d
+	#instruction start "544 = constant(38)":
+	movq $38, %r13
+	#instruction start "545 = 544 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "546 = store 545 543, state: 542":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "547 = constant(0)":
+	movl $0, %r12d
+	#instruction start "548 = constant(39)":
+	movq $39, %r13
+	#instruction start "549 = 548 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "550 = store 549 547, state: 546":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "551 = constant(-87)":
+	movl $169, %r12d
+	#instruction start "552 = constant(40)":
+	movq $40, %r13
+	#instruction start "553 = 552 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "554 = store 553 551, state: 550":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "555 = constant(22)":
+	movl $22, %r12d
+	#instruction start "556 = constant(41)":
+	movq $41, %r13
+	#instruction start "557 = 556 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "558 = store 557 555, state: 554":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "559 = constant(0)":
+	movl $0, %r12d
+	#instruction start "560 = constant(42)":
+	movq $42, %r13
+	#instruction start "561 = 560 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "562 = store 561 559, state: 558":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "563 = constant(0)":
+	movl $0, %r12d
+	#instruction start "564 = constant(43)":
+	movq $43, %r13
+	#instruction start "565 = 564 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "566 = store 565 563, state: 562":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "567 = constant(-96)":
+	movl $160, %r12d
+	#instruction start "568 = constant(44)":
+	movq $44, %r13
+	#instruction start "569 = 568 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "570 = store 569 567, state: 566":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "571 = constant(22)":
+	movl $22, %r12d
+	#instruction start "572 = constant(45)":
+	movq $45, %r13
+	#instruction start "573 = 572 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "574 = store 573 571, state: 570":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "575 = constant(0)":
+	movl $0, %r12d
+	#instruction start "576 = constant(46)":
+	movq $46, %r13
+	#instruction start "577 = 576 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "578 = store 577 575, state: 574":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "579 = constant(0)":
+	movl $0, %r12d
+	#instruction start "580 = constant(47)":
+	movq $47, %r13
+	#instruction start "581 = 580 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "582 = store 581 579, state: 578":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "583 = constant(-94)":
+	movl $162, %r12d
+	#instruction start "584 = constant(48)":
+	movq $48, %r13
+	#instruction start "585 = 584 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "586 = store 585 583, state: 582":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "587 = constant(22)":
+	movl $22, %r12d
+	#instruction start "588 = constant(49)":
+	movq $49, %r13
+	#instruction start "589 = 588 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "590 = store 589 587, state: 586":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "591 = constant(0)":
+	movl $0, %r12d
+	#instruction start "592 = constant(50)":
+	movq $50, %r13
+	#instruction start "593 = 592 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "594 = store 593 591, state: 590":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "595 = constant(0)":
+	movl $0, %r12d
+	#instruction start "596 = constant(51)":
+	movq $51, %r13
+	#instruction start "597 = 596 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "598 = store 597 595, state: 594":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "599 = constant(-79)":
+	movl $177, %r12d
+	#instruction start "600 = constant(52)":
+	movq $52, %r13
+	#instruction start "601 = 600 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "602 = store 601 599, state: 598":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "603 = constant(22)":
+	movl $22, %r12d
+	#instruction start "604 = constant(53)":
+	movq $53, %r13
+	#instruction start "605 = 604 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "606 = store 605 603, state: 602":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "607 = constant(0)":
+	movl $0, %r12d
+	#instruction start "608 = constant(54)":
+	movq $54, %r13
+	#instruction start "609 = 608 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "610 = store 609 607, state: 606":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "611 = constant(0)":
+	movl $0, %r12d
+	#instruction start "612 = constant(55)":
+	movq $55, %r13
+	#instruction start "613 = 612 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "614 = store 613 611, state: 610":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "615 = constant(0)":
+	movl $0, %r12d
+	#instruction start "616 = constant(56)":
+	movq $56, %r13
+	#instruction start "617 = 616 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "618 = store 617 615, state: 614":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "619 = constant(0)":
+	movl $0, %r12d
+	#instruction start "620 = constant(57)":
+	movq $57, %r13
+	#instruction start "621 = 620 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "622 = store 621 619, state: 618":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "623 = constant(0)":
+	movl $0, %r12d
+	#instruction start "624 = constant(58)":
+	movq $58, %r13
+	#instruction start "625 = 624 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "626 = store 625 623, state: 622":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "627 = constant(0)":
+	movl $0, %r12d
+	#instruction start "628 = constant(59)":
+	movq $59, %r13
+	#instruction start "629 = 628 + 388":
+	movq %r13, %rax
+	movq -240(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "630 = store 629 627, state: 626":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "631 = constant(0)":
+	movl $0, %r12d
+	#instruction start "632 = int_cast_zero 631":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "633 = constant(4)":
+	movq $4, %r12
+	#instruction start "634 = 632 * 633":
+	movq %r13, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "635 = 388 + 634":
+	movq -240(%rbp), %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "636 = load_volatile 635, state: 630":
+	movq %r12, %rdi
+	movl (%rdi), %r13d
+	#instruction start "637 = proj0 636":
+	#instruction start "638 = proj1 636":
+	#instruction start "639 = constant(5792)":
+	movl $5792, %r12d
+	#instruction start "640 = 638 == 639":
+	movq %r13, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "642 = if 387 640":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L18
+.L17:
+	#instruction start "645 = constant(11)":
+	movq $.Ls11, %r12
+	#instruction start "646 = constant(3)":
+	movq $.Ls3, %r13
+	#instruction start "647 = constant(28)":
+	movl $28, %r14d
+	#instruction start "648 = constant(4)":
+	movq $.Ls4, %r15
+	#instruction start "649 = alloc with size 8":
+	leaq -699(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "650 = store 649 645, state: 637":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "651 = alloc with size 8":
+	leaq -707(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "652 = store 651 646, state: 650":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "653 = alloc with size 4":
+	leaq -711(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "654 = store 653 647, state: 652":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "655 = alloc with size 8":
+	leaq -719(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "656 = store 655 648, state: 654":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "657 = constant(1)":
+	leaq -248(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "658 = constant(0)":
+	leaq -256(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "659 = load part address of 649 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "660 = proj0 659":
+	#instruction start "661 = proj1 659":
+	#instruction start "662 = load part address of 651 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "663 = proj0 662":
+	#instruction start "664 = proj1 662":
+	#instruction start "665 = load part address of 653 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "666 = proj0 665":
+	#instruction start "667 = proj1 665":
+	#instruction start "668 = load part address of 655 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "669 = proj0 668":
+	#instruction start "670 = proj1 668":
+	#instruction start "671 = allocate_call_stack 0":
+	#instruction start "672 = set_reg %rdi 661":
+	#instruction start "673 = set_reg %rsi 664 state: 672":
+	#instruction start "674 = set_reg %rdx 667 state: 673":
+	#instruction start "675 = set_reg %rcx 670 state: 674":
+	#instruction start "676 = set_reg %rax 658 state: 675":
+	#instruction start "677 = call 657":
+	addq $0, %rsp
+	movq -256(%rbp), %rax
+	movq %r13, %rcx
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq -248(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "678 = proj0 677":
+	#instruction start "679 = proj1 677":
+	#Block jump
+	jmp .L19
+.L18:
+	#Block jump elided
+.L19:
+	#instruction start "680 = constant(13)":
+	movq $13, %rbx
+	#instruction start "681 = constant(4)":
+	movq $4, %r12
+	#instruction start "682 = 680 * 681":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "683 = 388 + 682":
+	movq -240(%rbp), %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "684 = phi (region: 641) 637 678":
+	#instruction start "685 = load_volatile 683, state: 684":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "686 = proj0 685":
+	#instruction start "687 = proj1 685":
+	#instruction start "688 = constant(5809)":
+	movl $5809, %ebx
+	#instruction start "689 = 687 == 688":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "691 = if 641 689":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L21
+.L20:
+	#instruction start "694 = constant(12)":
+	movq $.Ls12, %rbx
+	#instruction start "695 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "696 = constant(29)":
+	movl $29, %r13d
+	#instruction start "697 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "698 = alloc with size 8":
+	leaq -727(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "699 = store 698 694, state: 686":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "700 = alloc with size 8":
+	leaq -735(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "701 = store 700 695, state: 699":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "702 = alloc with size 4":
+	leaq -739(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "703 = store 702 696, state: 701":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "704 = alloc with size 8":
+	leaq -747(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "705 = store 704 697, state: 703":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "706 = constant(1)":
+	leaq -304(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "707 = constant(0)":
+	leaq -312(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "708 = load part address of 698 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "709 = proj0 708":
+	#instruction start "710 = proj1 708":
+	#instruction start "711 = load part address of 700 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "712 = proj0 711":
+	#instruction start "713 = proj1 711":
+	#instruction start "714 = load part address of 702 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "715 = proj0 714":
+	#instruction start "716 = proj1 714":
+	#instruction start "717 = load part address of 704 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "718 = proj0 717":
+	#instruction start "719 = proj1 717":
+	#instruction start "720 = allocate_call_stack 0":
+	#instruction start "721 = set_reg %rdi 710":
+	#instruction start "722 = set_reg %rsi 713 state: 721":
+	#instruction start "723 = set_reg %rdx 716 state: 722":
+	#instruction start "724 = set_reg %rcx 719 state: 723":
+	#instruction start "725 = set_reg %rax 707 state: 724":
+	#instruction start "726 = call 706":
+	addq $0, %rsp
+	movq -312(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -304(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "727 = proj0 726":
+	#instruction start "728 = proj1 726":
+	#Block jump
+	jmp .L22
+.L21:
+	#Block jump elided
+.L22:
+	#instruction start "732 = phi (region: 690) 686 727":
+	#Block jump elided
+.L23:
+	#instruction start "730 = constant(13)":
+	movq $.Ls13, %rbx
+	#instruction start "731 = phi (region: 729) 732 389":
+	#instruction start "733 = load_volatile 730, state: 731":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "734 = proj0 733":
+	#instruction start "735 = proj1 733":
+	#instruction start "736 = constant(237)":
+	movl $237, %ebx
+	#instruction start "737 = 735 == 736":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "739 = if 729 737":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L25
+.L24:
+	#instruction start "742 = constant(14)":
+	movq $.Ls14, %rbx
+	#instruction start "743 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "744 = constant(32)":
+	movl $32, %r13d
+	#instruction start "745 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "746 = alloc with size 8":
+	leaq -755(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "747 = store 746 742, state: 734":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "748 = alloc with size 8":
+	leaq -763(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "749 = store 748 743, state: 747":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "750 = alloc with size 4":
+	leaq -767(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "751 = store 750 744, state: 749":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "752 = alloc with size 8":
+	leaq -775(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "753 = store 752 745, state: 751":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "754 = constant(1)":
+	leaq -360(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "755 = constant(0)":
+	leaq -368(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "756 = load part address of 746 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "757 = proj0 756":
+	#instruction start "758 = proj1 756":
+	#instruction start "759 = load part address of 748 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "760 = proj0 759":
+	#instruction start "761 = proj1 759":
+	#instruction start "762 = load part address of 750 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "763 = proj0 762":
+	#instruction start "764 = proj1 762":
+	#instruction start "765 = load part address of 752 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "766 = proj0 765":
+	#instruction start "767 = proj1 765":
+	#instruction start "768 = allocate_call_stack 0":
+	#instruction start "769 = set_reg %rdi 758":
+	#instruction start "770 = set_reg %rsi 761 state: 769":
+	#instruction start "771 = set_reg %rdx 764 state: 770":
+	#instruction start "772 = set_reg %rcx 767 state: 771":
+	#instruction start "773 = set_reg %rax 755 state: 772":
+	#instruction start "774 = call 754":
+	addq $0, %rsp
+	movq -368(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -360(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "775 = proj0 774":
+	#instruction start "776 = proj1 774":
+	#Block jump
+	jmp .L26
+.L25:
+	#Block jump elided
+.L26:
+	#instruction start "777 = constant(1)":
+	movl $1, %ebx
+	#instruction start "779 = if 738 777":
+	#instruction start "787 = phi (region: 738) 734 775":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L28
+.L27:
+	#instruction start "782 = constant(15)":
+	movq $.Ls15, %rbx
+	#instruction start "783 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "784 = constant(34)":
+	movl $34, %r13d
+	#instruction start "785 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "786 = alloc with size 8":
+	leaq -783(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "788 = store 786 782, state: 787":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "789 = alloc with size 8":
+	leaq -791(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "790 = store 789 783, state: 788":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "791 = alloc with size 4":
+	leaq -795(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "792 = store 791 784, state: 790":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "793 = alloc with size 8":
+	leaq -803(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "794 = store 793 785, state: 792":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "795 = constant(1)":
+	leaq -416(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "796 = constant(0)":
+	leaq -424(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "797 = load part address of 786 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "798 = proj0 797":
+	#instruction start "799 = proj1 797":
+	#instruction start "800 = load part address of 789 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "801 = proj0 800":
+	#instruction start "802 = proj1 800":
+	#instruction start "803 = load part address of 791 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "804 = proj0 803":
+	#instruction start "805 = proj1 803":
+	#instruction start "806 = load part address of 793 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "807 = proj0 806":
+	#instruction start "808 = proj1 806":
+	#instruction start "809 = allocate_call_stack 0":
+	#instruction start "810 = set_reg %rdi 799":
+	#instruction start "811 = set_reg %rsi 802 state: 810":
+	#instruction start "812 = set_reg %rdx 805 state: 811":
+	#instruction start "813 = set_reg %rcx 808 state: 812":
+	#instruction start "814 = set_reg %rax 796 state: 813":
+	#instruction start "815 = call 795":
+	addq $0, %rsp
+	movq -424(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -416(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "816 = proj0 815":
+	#instruction start "817 = proj1 815":
+	#Block jump
+	jmp .L29
+.L28:
+	#Block jump elided
+.L29:
+	#instruction start "818 = constant(0)":
+	movl $0, %ebx
+	#instruction start "819 = set_reg %rax 818":
+	#instruction start "820 = phi (region: 778) 787 816":
+	#instruction start "821 = return 778, 819, 820":
+	movq %rbx, %rax
+	#Block return.
+	movq -811(%rbp), %rbx
+	movq -819(%rbp), %r12
+	movq -827(%rbp), %r13
+	movq -835(%rbp), %r14
+	movq -843(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls0:
+	.string "a\000\000\000b\000\000\000c\000\000\000d\000\000\000e\000\000\000f\000\000\000\000\000\000\000"
+.Ls2:
+	.string "(L\"abc\" \"def\")[0]\000"
+.Ls3:
+	.string "tests/wchar.c\000"
+.Ls4:
+	.string "main"
+.Ls5:
+	.string "a\000b\000c\000d\000e\000f\000\000\000"
+.Ls6:
+	.string "a\000\000\000b\000\000\000c\000\000\000\000\000\000\000"
+.Ls7:
+	.string "a\000b\000c\000\000\000"
+.Ls8:
+	.string "sizeof(wide_str) == sizeof(L\"abcdef\")\000"
+.Ls9:
+	.string "str32[0] == 0x1d49e\000"
+.Ls10:
+	.string "str32[1] == 0x1d539\000"
+.Ls11:
+	.string "s2[0] == 0x16a0\000"
+.Ls12:
+	.string "s2[sizeof s2 / sizeof *s2 - 2] == 0x16b1\000"
+.Ls13:
+	.string "\355\000\000\000\300\000\000\000\300\000\000\000\000\000\000\000"
+.Ls14:
+	.string "(L\"\" \"\\355\\300\\300\")[0] == 0355\000"
+.Ls15:
+	.string "L'\357\274\241' == 0xff21\000"
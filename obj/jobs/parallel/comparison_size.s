@@ -0,0 +1,889 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $496, %rsp
+	movq %rbx, -460(%rbp)
+	movq %r12, -468(%rbp)
+	movq %r13, -476(%rbp)
+	movq %r14, -484(%rbp)
+	movq %r15, -492(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "8 = constant(0)":
+	movq $.Ls0, %rbx
+	#instruction start "12 = constant(4607182418800017408)":
+	leaq -8(%rbp), %rdi
+	movabsq $4607182418800017408, %rax
+	movq %rax, (%rdi)
+	#instruction start "16 = constant(5)":
+	leaq -16(%rbp), %rdi
+	movabsq $5, %rax
+	movq %rax, (%rdi)
+	#instruction start "18 = alloc with size 8":
+	leaq -304(%rbp), %rsi
+	movq %rsi, -24(%rbp)
+	#instruction start "19 = set_zero_ptr 18, size: 8":
+	movq -24(%rbp), %rdi
+	movq $0, (%rdi)
+	#instruction start "20 = constant(0)":
+	movq $0, %r15
+	#instruction start "21 = 18 + 20":
+	movq -24(%rbp), %rax
+	movq %r15, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "22 = constant(0)":
+	movl $0, %r15d
+	#instruction start "23 = store 21 22, state: 19":
+	movq %r14, %rsi
+	movl %r15d, (%rsi)
+	#instruction start "24 = constant(4)":
+	movq $4, %r14
+	#instruction start "25 = 18 + 24":
+	movq -24(%rbp), %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "26 = constant(7)":
+	movl $7, %r14d
+	#instruction start "27 = store 25 26, state: 23":
+	movq %r15, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "28 = constant(0)":
+	movq $0, %r14
+	#instruction start "29 = 18 + 28":
+	movq -24(%rbp), %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "31 = constant(0)":
+	movq $0, %r14
+	#instruction start "32 = 8 != 31":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "33 = store 29 32, state: 27":
+	movq %r15, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "34 = constant(0)":
+	movq $0, %rbx
+	#instruction start "35 = 18 + 34":
+	movq -24(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "36 = load_volatile 35, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "37 = proj0 36":
+	#instruction start "38 = proj1 36":
+	#instruction start "39 = constant(1)":
+	movl $1, %r12d
+	#instruction start "40 = 38 == 39":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "41 = if 2 40":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "62 = alloc with size 4":
+	leaq -308(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "63 = constant(0)":
+	movl $0, %r12d
+	#instruction start "64 = store 62 63, state: 37":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 66 (65 61 62)
+	movq %rbx, %rax
+	movq %rax, -32(%rbp)
+	#Phi node to 325 (65 326 12)
+	movq -8(%rbp), %rax
+	movq %rax, -40(%rbp)
+	#Phi node to 331 (65 332 16)
+	movq -16(%rbp), %rax
+	movq %rax, -48(%rbp)
+	#Block jump
+	jmp .L8
+.L4:
+	#instruction start "44 = constant(4)":
+	movq $4, %rbx
+	#instruction start "45 = 18 + 44":
+	movq -24(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "46 = load_volatile 45, state: 37":
+	movq %r15, %rdi
+	movl (%rdi), %ebx
+	#instruction start "47 = proj0 46":
+	#instruction start "48 = proj1 46":
+	#instruction start "49 = constant(7)":
+	movl $7, %r15d
+	#instruction start "50 = 48 == 49":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "51 = if 43 50":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L6
+.L5:
+	#instruction start "57 = alloc with size 4":
+	leaq -312(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "58 = constant(0)":
+	movl $0, %r14d
+	#instruction start "59 = store 57 58, state: 47":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 61 (60 54 57)
+	movq %rbx, %rax
+	movq %rax, %r14
+	#Phi node to 326 (60 12 12)
+	movq -8(%rbp), %rax
+	movq %rax, %r15
+	#Phi node to 332 (60 16 16)
+	movq -16(%rbp), %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L7
+.L6:
+	#instruction start "54 = alloc with size 4":
+	leaq -316(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "55 = constant(1)":
+	movl $1, %r12d
+	#instruction start "56 = store 54 55, state: 47":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 61 (60 54 57)
+	movq %rbx, %rax
+	movq %rax, %r14
+	#Phi node to 326 (60 12 12)
+	movq -8(%rbp), %rax
+	movq %rax, %r15
+	#Phi node to 332 (60 16 16)
+	movq -16(%rbp), %rax
+	movq %rax, %r13
+	#Block jump elided
+.L7:
+	#instruction start "61 = phi (region: 60) 54 57":
+	#instruction start "68 = phi (region: 60) 56 59":
+	#instruction start "326 = phi (region: 60) 12 12":
+	#instruction start "332 = phi (region: 60) 16 16":
+	#Phi node to 66 (65 61 62)
+	movq %r14, %rax
+	movq %rax, -32(%rbp)
+	#Phi node to 325 (65 326 12)
+	movq %r15, %rax
+	movq %rax, -40(%rbp)
+	#Phi node to 331 (65 332 16)
+	movq %r13, %rax
+	movq %rax, -48(%rbp)
+	#Block jump elided
+.L8:
+	#instruction start "66 = phi (region: 65) 61 62":
+	#instruction start "67 = phi (region: 65) 68 64":
+	#instruction start "69 = load_volatile 66, state: 67":
+	movq -32(%rbp), %rdi
+	movl (%rdi), %ebx
+	#instruction start "70 = proj0 69":
+	#instruction start "71 = proj1 69":
+	#instruction start "73 = if 65 71":
+	#instruction start "325 = phi (region: 65) 326 12":
+	#instruction start "331 = phi (region: 65) 332 16":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "76 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "77 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "78 = constant(15)":
+	movl $15, %r13d
+	#instruction start "79 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "80 = alloc with size 8":
+	leaq -324(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "81 = store 80 76, state: 70":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "82 = alloc with size 8":
+	leaq -332(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "83 = store 82 77, state: 81":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "84 = alloc with size 4":
+	leaq -336(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "85 = store 84 78, state: 83":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "86 = alloc with size 8":
+	leaq -344(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "87 = store 86 79, state: 85":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "88 = constant(1)":
+	leaq -56(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "89 = constant(0)":
+	leaq -64(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "90 = load part address of 80 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "91 = proj0 90":
+	#instruction start "92 = proj1 90":
+	#instruction start "93 = load part address of 82 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "94 = proj0 93":
+	#instruction start "95 = proj1 93":
+	#instruction start "96 = load part address of 84 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "97 = proj0 96":
+	#instruction start "98 = proj1 96":
+	#instruction start "99 = load part address of 86 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "100 = proj0 99":
+	#instruction start "101 = proj1 99":
+	#instruction start "102 = allocate_call_stack 0":
+	#instruction start "103 = set_reg %rdi 92":
+	#instruction start "104 = set_reg %rsi 95 state: 103":
+	#instruction start "105 = set_reg %rdx 98 state: 104":
+	#instruction start "106 = set_reg %rcx 101 state: 105":
+	#instruction start "107 = set_reg %rax 89 state: 106":
+	#instruction start "108 = call 88":
+	addq $0, %rsp
+	movq -64(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -56(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "109 = proj0 108":
+	#instruction start "110 = proj1 108":
+	#Phi node to 324 (72 325 325)
+	movq -40(%rbp), %rax
+	movq %rax, %rbx
+	#Phi node to 330 (72 331 331)
+	movq -48(%rbp), %rax
+	movq %rax, -112(%rbp)
+	#Block jump
+	jmp .L11
+.L10:
+	#Phi node to 324 (72 325 325)
+	movq -40(%rbp), %rax
+	movq %rax, %rbx
+	#Phi node to 330 (72 331 331)
+	movq -48(%rbp), %rax
+	movq %rax, -112(%rbp)
+	#Block jump elided
+.L11:
+	#instruction start "111 = constant(0)":
+	movq $0, %r13
+	#instruction start "112 = 18 + 111":
+	movq -24(%rbp), %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "113 = phi (region: 72) 70 109":
+	#instruction start "115 = constant(4611686018427387904)":
+	movabsq $4611686018427387904, %r13
+	#instruction start "324 = phi (region: 72) 325 325":
+	#instruction start "116 = 324 < 115 (float)":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	ucomisd %xmm1, %xmm0
+	setb %al
+	movzbl %al, %eax
+	movl %eax, %r15d
+	#instruction start "117 = store 112 116, state: 113":
+	movq %r14, %rsi
+	movl %r15d, (%rsi)
+	#instruction start "118 = constant(0)":
+	movq $0, %rbx
+	#instruction start "119 = 18 + 118":
+	movq -24(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "120 = load_volatile 119, state: 117":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "121 = proj0 120":
+	#instruction start "122 = proj1 120":
+	#instruction start "123 = constant(1)":
+	movl $1, %r13d
+	#instruction start "124 = 122 == 123":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "125 = if 72 124":
+	#instruction start "330 = phi (region: 72) 331 331":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "146 = alloc with size 4":
+	leaq -348(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "147 = constant(0)":
+	movl $0, %r13d
+	#instruction start "148 = store 146 147, state: 121":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 150 (149 145 146)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Phi node to 328 (149 329 330)
+	movq -112(%rbp), %rax
+	movq %rax, -120(%rbp)
+	#Block jump
+	jmp .L17
+.L13:
+	#instruction start "128 = constant(4)":
+	movq $4, %rbx
+	#instruction start "129 = 18 + 128":
+	movq -24(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "130 = load_volatile 129, state: 121":
+	movq %r15, %rdi
+	movl (%rdi), %ebx
+	#instruction start "131 = proj0 130":
+	#instruction start "132 = proj1 130":
+	#instruction start "133 = constant(7)":
+	movl $7, %r15d
+	#instruction start "134 = 132 == 133":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "135 = if 127 134":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L15
+.L14:
+	#instruction start "141 = alloc with size 4":
+	leaq -352(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "142 = constant(0)":
+	movl $0, %r14d
+	#instruction start "143 = store 141 142, state: 131":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 145 (144 138 141)
+	movq %rbx, %rax
+	movq %rax, %r14
+	#Phi node to 329 (144 330 330)
+	movq -112(%rbp), %rax
+	movq %rax, %r15
+	#Block jump
+	jmp .L16
+.L15:
+	#instruction start "138 = alloc with size 4":
+	leaq -356(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "139 = constant(1)":
+	movl $1, %r12d
+	#instruction start "140 = store 138 139, state: 131":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 145 (144 138 141)
+	movq %rbx, %rax
+	movq %rax, %r14
+	#Phi node to 329 (144 330 330)
+	movq -112(%rbp), %rax
+	movq %rax, %r15
+	#Block jump elided
+.L16:
+	#instruction start "145 = phi (region: 144) 138 141":
+	#instruction start "152 = phi (region: 144) 140 143":
+	#instruction start "329 = phi (region: 144) 330 330":
+	#Phi node to 150 (149 145 146)
+	movq %r14, %rax
+	movq %rax, %r13
+	#Phi node to 328 (149 329 330)
+	movq %r15, %rax
+	movq %rax, -120(%rbp)
+	#Block jump elided
+.L17:
+	#instruction start "150 = phi (region: 149) 145 146":
+	#instruction start "151 = phi (region: 149) 152 148":
+	#instruction start "153 = load_volatile 150, state: 151":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "154 = proj0 153":
+	#instruction start "155 = proj1 153":
+	#instruction start "157 = if 149 155":
+	#instruction start "328 = phi (region: 149) 329 330":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "160 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "161 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "162 = constant(18)":
+	movl $18, %r13d
+	#instruction start "163 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "164 = alloc with size 8":
+	leaq -364(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "165 = store 164 160, state: 154":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "166 = alloc with size 8":
+	leaq -372(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "167 = store 166 161, state: 165":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "168 = alloc with size 4":
+	leaq -376(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "169 = store 168 162, state: 167":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "170 = alloc with size 8":
+	leaq -384(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "171 = store 170 163, state: 169":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "172 = constant(1)":
+	leaq -128(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "173 = constant(0)":
+	leaq -136(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "174 = load part address of 164 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "175 = proj0 174":
+	#instruction start "176 = proj1 174":
+	#instruction start "177 = load part address of 166 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "178 = proj0 177":
+	#instruction start "179 = proj1 177":
+	#instruction start "180 = load part address of 168 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "181 = proj0 180":
+	#instruction start "182 = proj1 180":
+	#instruction start "183 = load part address of 170 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "184 = proj0 183":
+	#instruction start "185 = proj1 183":
+	#instruction start "186 = allocate_call_stack 0":
+	#instruction start "187 = set_reg %rdi 176":
+	#instruction start "188 = set_reg %rsi 179 state: 187":
+	#instruction start "189 = set_reg %rdx 182 state: 188":
+	#instruction start "190 = set_reg %rcx 185 state: 189":
+	#instruction start "191 = set_reg %rax 173 state: 190":
+	#instruction start "192 = call 172":
+	addq $0, %rsp
+	movq -136(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -128(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "193 = proj0 192":
+	#instruction start "194 = proj1 192":
+	#Phi node to 327 (156 328 328)
+	movq -120(%rbp), %rax
+	movq %rax, %rbx
+	#Block jump
+	jmp .L20
+.L19:
+	#Phi node to 327 (156 328 328)
+	movq -120(%rbp), %rax
+	movq %rax, %rbx
+	#Block jump elided
+.L20:
+	#instruction start "195 = constant(0)":
+	movq $0, %r12
+	#instruction start "196 = 18 + 195":
+	movq -24(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "197 = phi (region: 156) 154 193":
+	#instruction start "199 = constant(5)":
+	movq $5, %r12
+	#instruction start "327 = phi (region: 156) 328 328":
+	#instruction start "200 = 327 == 199":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "201 = store 196 200, state: 197":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "202 = constant(0)":
+	movq $0, %rbx
+	#instruction start "203 = 18 + 202":
+	movq -24(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "204 = load_volatile 203, state: 201":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "205 = proj0 204":
+	#instruction start "206 = proj1 204":
+	#instruction start "207 = constant(1)":
+	movl $1, %r12d
+	#instruction start "208 = 206 == 207":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "209 = if 156 208":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "230 = alloc with size 4":
+	leaq -388(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "231 = constant(0)":
+	movl $0, %r12d
+	#instruction start "232 = store 230 231, state: 205":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 234 (233 229 230)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L26
+.L22:
+	#instruction start "212 = constant(4)":
+	movq $4, %rbx
+	#instruction start "213 = 18 + 212":
+	movq -24(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "214 = load_volatile 213, state: 205":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "215 = proj0 214":
+	#instruction start "216 = proj1 214":
+	#instruction start "217 = constant(7)":
+	movl $7, %r13d
+	#instruction start "218 = 216 == 217":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "219 = if 211 218":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L24
+.L23:
+	#instruction start "225 = alloc with size 4":
+	leaq -392(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "226 = constant(0)":
+	movl $0, %r13d
+	#instruction start "227 = store 225 226, state: 215":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 229 (228 222 225)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L25
+.L24:
+	#instruction start "222 = alloc with size 4":
+	leaq -396(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "223 = constant(1)":
+	movl $1, %r14d
+	#instruction start "224 = store 222 223, state: 215":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 229 (228 222 225)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L25:
+	#instruction start "229 = phi (region: 228) 222 225":
+	#instruction start "236 = phi (region: 228) 224 227":
+	#Phi node to 234 (233 229 230)
+	movq %r13, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L26:
+	#instruction start "234 = phi (region: 233) 229 230":
+	#instruction start "235 = phi (region: 233) 236 232":
+	#instruction start "237 = load_volatile 234, state: 235":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "238 = proj0 237":
+	#instruction start "239 = proj1 237":
+	#instruction start "241 = if 233 239":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L28
+.L27:
+	#instruction start "244 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "245 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "246 = constant(21)":
+	movl $21, %r13d
+	#instruction start "247 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "248 = alloc with size 8":
+	leaq -404(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "249 = store 248 244, state: 238":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "250 = alloc with size 8":
+	leaq -412(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "251 = store 250 245, state: 249":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "252 = alloc with size 4":
+	leaq -416(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "253 = store 252 246, state: 251":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "254 = alloc with size 8":
+	leaq -424(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "255 = store 254 247, state: 253":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "256 = constant(1)":
+	leaq -184(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "257 = constant(0)":
+	leaq -192(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "258 = load part address of 248 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "259 = proj0 258":
+	#instruction start "260 = proj1 258":
+	#instruction start "261 = load part address of 250 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "262 = proj0 261":
+	#instruction start "263 = proj1 261":
+	#instruction start "264 = load part address of 252 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "265 = proj0 264":
+	#instruction start "266 = proj1 264":
+	#instruction start "267 = load part address of 254 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "268 = proj0 267":
+	#instruction start "269 = proj1 267":
+	#instruction start "270 = allocate_call_stack 0":
+	#instruction start "271 = set_reg %rdi 260":
+	#instruction start "272 = set_reg %rsi 263 state: 271":
+	#instruction start "273 = set_reg %rdx 266 state: 272":
+	#instruction start "274 = set_reg %rcx 269 state: 273":
+	#instruction start "275 = set_reg %rax 257 state: 274":
+	#instruction start "276 = call 256":
+	addq $0, %rsp
+	movq -192(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -184(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "277 = proj0 276":
+	#instruction start "278 = proj1 276":
+	#Block jump
+	jmp .L29
+.L28:
+	#Block jump elided
+.L29:
+	#instruction start "279 = constant(1)":
+	movl $1, %ebx
+	#instruction start "281 = if 240 279":
+	#instruction start "289 = phi (region: 240) 238 277":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L31
+.L30:
+	#instruction start "284 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "285 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "286 = constant(23)":
+	movl $23, %r13d
+	#instruction start "287 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "288 = alloc with size 8":
+	leaq -432(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "290 = store 288 284, state: 289":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "291 = alloc with size 8":
+	leaq -440(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "292 = store 291 285, state: 290":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "293 = alloc with size 4":
+	leaq -444(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "294 = store 293 286, state: 292":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "295 = alloc with size 8":
+	leaq -452(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "296 = store 295 287, state: 294":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "297 = constant(1)":
+	leaq -240(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "298 = constant(0)":
+	leaq -248(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "299 = load part address of 288 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "300 = proj0 299":
+	#instruction start "301 = proj1 299":
+	#instruction start "302 = load part address of 291 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "303 = proj0 302":
+	#instruction start "304 = proj1 302":
+	#instruction start "305 = load part address of 293 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "306 = proj0 305":
+	#instruction start "307 = proj1 305":
+	#instruction start "308 = load part address of 295 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "309 = proj0 308":
+	#instruction start "310 = proj1 308":
+	#instruction start "311 = allocate_call_stack 0":
+	#instruction start "312 = set_reg %rdi 301":
+	#instruction start "313 = set_reg %rsi 304 state: 312":
+	#instruction start "314 = set_reg %rdx 307 state: 313":
+	#instruction start "315 = set_reg %rcx 310 state: 314":
+	#instruction start "316 = set_reg %rax 298 state: 315":
+	#instruction start "317 = call 297":
+	addq $0, %rsp
+	movq -248(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -240(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "318 = proj0 317":
+	#instruction start "319 = proj1 317":
+	#Block jump
+	jmp .L32
+.L31:
+	#Block jump elided
+.L32:
+	#instruction start "320 = constant(0)":
+	movl $0, %ebx
+	#instruction start "321 = set_reg %rax 320":
+	#instruction start "322 = phi (region: 280) 289 318":
+	#instruction start "323 = return 280, 321, 322":
+	movq %rbx, %rax
+	#Block return.
+	movq -460(%rbp), %rbx
+	movq -468(%rbp), %r12
+	movq -476(%rbp), %r13
+	movq -484(%rbp), %r14
+	movq -492(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls0:
+	.string "x\000"
+.Ls2:
+	.string "pair.a == 1 && pair.b == 7\000"
+.Ls3:
+	.string "/root/repo/tests/comparison_size.c\000"
+.Ls4:
+	.string "main"
+.Ls5:
+	.string "sizeof (p == 0) == sizeof (int)\000"
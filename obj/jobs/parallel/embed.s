@@ -0,0 +1,503 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $704, %rsp
+	movq %rbx, -660(%rbp)
+	movq %r12, -668(%rbp)
+	movq %r13, -676(%rbp)
+	movq %r14, -684(%rbp)
+	movq %r15, -692(%rbp)
+	movq %rdi, -652(%rbp)
+	movq %rsi, -644(%rbp)
+	movq %rdx, -636(%rbp)
+	movq %rcx, -628(%rbp)
+	movq %r8, -620(%rbp)
+	movq %r9, -612(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "8 = constant(10)":
+	leaq -4(%rbp), %rdi
+	movl $10, (%rdi)
+	#instruction start "11 = constant(10)":
+	movl $10, %r12d
+	#instruction start "12 = 8 == 11":
+	movl -4(%rbp), %eax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "14 = if 2 12":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "17 = constant(1)":
+	movq $.Ls1, %r12
+	#instruction start "18 = constant(2)":
+	movq $.Ls2, %r13
+	#instruction start "19 = constant(8)":
+	movl $8, %r14d
+	#instruction start "20 = constant(3)":
+	movq $.Ls3, %r15
+	#instruction start "21 = alloc with size 8":
+	leaq -244(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "22 = store 21 17, state: 3":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "23 = alloc with size 8":
+	leaq -252(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "24 = store 23 18, state: 22":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "25 = alloc with size 4":
+	leaq -256(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "26 = store 25 19, state: 24":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "27 = alloc with size 8":
+	leaq -264(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "28 = store 27 20, state: 26":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "29 = constant(0)":
+	leaq -12(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "30 = constant(0)":
+	leaq -20(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "31 = load part address of 21 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "32 = proj0 31":
+	#instruction start "33 = proj1 31":
+	#instruction start "34 = load part address of 23 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "35 = proj0 34":
+	#instruction start "36 = proj1 34":
+	#instruction start "37 = load part address of 25 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "38 = proj0 37":
+	#instruction start "39 = proj1 37":
+	#instruction start "40 = load part address of 27 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "41 = proj0 40":
+	#instruction start "42 = proj1 40":
+	#instruction start "43 = allocate_call_stack 0":
+	#instruction start "44 = set_reg %rdi 33":
+	#instruction start "45 = set_reg %rsi 36 state: 44":
+	#instruction start "46 = set_reg %rdx 39 state: 45":
+	#instruction start "47 = set_reg %rcx 42 state: 46":
+	#instruction start "48 = set_reg %rax 30 state: 47":
+	#instruction start "49 = call 29":
+	addq $0, %rsp
+	movq -20(%rbp), %rax
+	movq %r13, %rcx
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq -12(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "50 = proj0 49":
+	#instruction start "51 = proj1 49":
+	#Phi node to 206 (13 8 8)
+	movl -4(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump
+	jmp .L5
+.L4:
+	#Phi node to 206 (13 8 8)
+	movl -4(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump elided
+.L5:
+	#instruction start "53 = phi (region: 13) 3 50":
+	#instruction start "55 = constant(10)":
+	movl $10, %r12d
+	#instruction start "206 = phi (region: 13) 8 8":
+	#instruction start "59 = 55 == 206":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "61 = if 13 59":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "64 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "65 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "66 = constant(13)":
+	movl $13, %r13d
+	#instruction start "67 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "68 = alloc with size 8":
+	leaq -272(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "69 = store 68 64, state: 53":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "70 = alloc with size 8":
+	leaq -280(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "71 = store 70 65, state: 69":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "72 = alloc with size 4":
+	leaq -284(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "73 = store 72 66, state: 71":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "74 = alloc with size 8":
+	leaq -292(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "75 = store 74 67, state: 73":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "76 = constant(0)":
+	leaq -68(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "77 = constant(0)":
+	leaq -76(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "78 = load part address of 68 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "79 = proj0 78":
+	#instruction start "80 = proj1 78":
+	#instruction start "81 = load part address of 70 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "82 = proj0 81":
+	#instruction start "83 = proj1 81":
+	#instruction start "84 = load part address of 72 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "85 = proj0 84":
+	#instruction start "86 = proj1 84":
+	#instruction start "87 = load part address of 74 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "88 = proj0 87":
+	#instruction start "89 = proj1 87":
+	#instruction start "90 = allocate_call_stack 0":
+	#instruction start "91 = set_reg %rdi 80":
+	#instruction start "92 = set_reg %rsi 83 state: 91":
+	#instruction start "93 = set_reg %rdx 86 state: 92":
+	#instruction start "94 = set_reg %rcx 89 state: 93":
+	#instruction start "95 = set_reg %rax 77 state: 94":
+	#instruction start "96 = call 76":
+	addq $0, %rsp
+	movq -76(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -68(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "97 = proj0 96":
+	#instruction start "98 = proj1 96":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "99 = constant(5)":
+	movq $.LVAR0array, %rbx
+	#instruction start "100 = phi (region: 60) 53 97":
+	#instruction start "101 = load_volatile 99, state: 100":
+	movq %rbx, %rdi
+	movzbl (%rdi), %r12d
+	#instruction start "102 = proj0 101":
+	#instruction start "103 = proj1 101":
+	#instruction start "104 = int_cast_zero 103":
+	movq %r12, %rax
+	movl %eax, %ebx
+	#instruction start "105 = constant(65)":
+	movl $65, %r12d
+	#instruction start "106 = 104 == 105":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "108 = if 60 106":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "111 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "112 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "113 = constant(21)":
+	movl $21, %r13d
+	#instruction start "114 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "115 = alloc with size 8":
+	leaq -300(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "116 = store 115 111, state: 102":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "117 = alloc with size 8":
+	leaq -308(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "118 = store 117 112, state: 116":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "119 = alloc with size 4":
+	leaq -312(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "120 = store 119 113, state: 118":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "121 = alloc with size 8":
+	leaq -320(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "122 = store 121 114, state: 120":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "123 = constant(0)":
+	leaq -124(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "124 = constant(0)":
+	leaq -132(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "125 = load part address of 115 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "126 = proj0 125":
+	#instruction start "127 = proj1 125":
+	#instruction start "128 = load part address of 117 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "129 = proj0 128":
+	#instruction start "130 = proj1 128":
+	#instruction start "131 = load part address of 119 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "132 = proj0 131":
+	#instruction start "133 = proj1 131":
+	#instruction start "134 = load part address of 121 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "135 = proj0 134":
+	#instruction start "136 = proj1 134":
+	#instruction start "137 = allocate_call_stack 0":
+	#instruction start "138 = set_reg %rdi 127":
+	#instruction start "139 = set_reg %rsi 130 state: 138":
+	#instruction start "140 = set_reg %rdx 133 state: 139":
+	#instruction start "141 = set_reg %rcx 136 state: 140":
+	#instruction start "142 = set_reg %rax 124 state: 141":
+	#instruction start "143 = call 123":
+	addq $0, %rsp
+	movq -132(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -124(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "144 = proj0 143":
+	#instruction start "145 = proj1 143":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "146 = constant(5)":
+	movq $.LVAR0array, %rbx
+	#instruction start "147 = constant(5)":
+	movq $5, %r12
+	#instruction start "148 = constant(1)":
+	movq $1, %r13
+	#instruction start "149 = 147 * 148":
+	movq %r12, %rax
+	movq %r13, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "150 = 146 + 149":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "151 = phi (region: 107) 102 144":
+	#instruction start "152 = load_volatile 150, state: 151":
+	movq %r12, %rdi
+	movzbl (%rdi), %ebx
+	#instruction start "153 = proj0 152":
+	#instruction start "154 = proj1 152":
+	#instruction start "155 = int_cast_zero 154":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "156 = constant(70)":
+	movl $70, %ebx
+	#instruction start "157 = 155 == 156":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "159 = if 107 157":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "162 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "163 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "164 = constant(22)":
+	movl $22, %r13d
+	#instruction start "165 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "166 = alloc with size 8":
+	leaq -328(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "167 = store 166 162, state: 153":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "168 = alloc with size 8":
+	leaq -336(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "169 = store 168 163, state: 167":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "170 = alloc with size 4":
+	leaq -340(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "171 = store 170 164, state: 169":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "172 = alloc with size 8":
+	leaq -348(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "173 = store 172 165, state: 171":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "174 = constant(0)":
+	leaq -180(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "175 = constant(0)":
+	leaq -188(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "176 = load part address of 166 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "177 = proj0 176":
+	#instruction start "178 = proj1 176":
+	#instruction start "179 = load part address of 168 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "180 = proj0 179":
+	#instruction start "181 = proj1 179":
+	#instruction start "182 = load part address of 170 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "183 = proj0 182":
+	#instruction start "184 = proj1 182":
+	#instruction start "185 = load part address of 172 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "186 = proj0 185":
+	#instruction start "187 = proj1 185":
+	#instruction start "188 = allocate_call_stack 0":
+	#instruction start "189 = set_reg %rdi 178":
+	#instruction start "190 = set_reg %rsi 181 state: 189":
+	#instruction start "191 = set_reg %rdx 184 state: 190":
+	#instruction start "192 = set_reg %rcx 187 state: 191":
+	#instruction start "193 = set_reg %rax 175 state: 192":
+	#instruction start "194 = call 174":
+	addq $0, %rsp
+	movq -188(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -180(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "195 = proj0 194":
+	#instruction start "196 = proj1 194":
+	#Block jump
+	jmp .L14
+.L13:
+	#Block jump elided
+.L14:
+	#instruction start "197 = constant(0)":
+	movl $0, %ebx
+	#instruction start "198 = set_reg %rax 197":
+	#instruction start "199 = phi (region: 158) 153 195":
+	#instruction start "200 = return 158, 198, 199":
+	movq %rbx, %rax
+	#Block return.
+	movq -660(%rbp), %rbx
+	movq -668(%rbp), %r12
+	movq -676(%rbp), %r13
+	movq -684(%rbp), %r14
+	movq -692(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "i == 10\000"
+.Ls2:
+	.string "/root/repo/tests/embed.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "i2 == i\000"
+.Ls6:
+	.string "array[0] == 'A'\000"
+.Ls7:
+	.string "array[sizeof array - 2] == 'F'\000"
+.section .data
+.align 1
+.LVAR0array:
+.byte 65
+.byte 66
+.byte 67
+.byte 68
+.byte 69
+.byte 70
+.byte 10
+.section .text
@@ -0,0 +1,18 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rbx, -16(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(0)":
+	movl $0, %ebx
+	#instruction start "7 = set_reg %rax 6":
+	#instruction start "8 = return 2, 7, 3":
+	movq %rbx, %rax
+	#Block return.
+	movq -16(%rbp), %rbx
+	leave 
+	ret 
+.section .rodata
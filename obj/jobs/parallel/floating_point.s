@@ -0,0 +1,2536 @@
+.global add
+add:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -32(%rbp)
+	movq %r12, -40(%rbp)
+	movq %r13, -48(%rbp)
+	movq %r14, -56(%rbp)
+	movq %xmm0, %rbx
+	movq %xmm1, %r12
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rax":
+	#instruction start "7 = %rbx":
+	#instruction start "8 = alloc with size 8":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "9 = alloc with size 8":
+	leaq -24(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "10 = store part of 8 with offset 0":
+	movq %r13, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "11 = store part of 9 with offset 0":
+	movq %r14, %rsi
+	leaq (%rsi), %rsi
+	movq %r12, (%rsi)
+	#instruction start "12 = load 8, state: 11":
+	movq %r13, %rdi
+	movq (%rdi), %rbx
+	#instruction start "13 = load 9, state: 11":
+	movq %r14, %rdi
+	movq (%rdi), %r12
+	#instruction start "14 = 12 + 13 (float)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	addsd %xmm1, %xmm0
+	movq %xmm0, %rax
+	movq %rax, %r13
+	#instruction start "15 = set_reg %rax 14":
+	#instruction start "16 = return 2, 15, 11":
+	movq %r13, %xmm0
+	#Block return.
+	movq -32(%rbp), %rbx
+	movq -40(%rbp), %r12
+	movq -48(%rbp), %r13
+	movq -56(%rbp), %r14
+	leave 
+	ret 
+.global fcmp
+fcmp:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movq %rbx, -24(%rbp)
+	movq %r12, -32(%rbp)
+	movq %r13, -40(%rbp)
+	movq %r14, -48(%rbp)
+	movd %xmm0, %ebx
+	movd %xmm1, %r12d
+.L3:
+	#instruction start "20 = proj3 18":
+	#instruction start "21 = proj1 18":
+	#instruction start "23 = %rax":
+	#instruction start "24 = %rbx":
+	#instruction start "25 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "26 = alloc with size 4":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "27 = store part of 25 with offset 0":
+	movq %r13, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "28 = store part of 26 with offset 0":
+	movq %r14, %rsi
+	leaq (%rsi), %rsi
+	movl %r12d, (%rsi)
+	#instruction start "29 = load 25, state: 28":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "30 = load 26, state: 28":
+	movq %r14, %rdi
+	movl (%rdi), %r12d
+	#instruction start "31 = 29 == 30 (float)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	movd %eax, %xmm0
+	movd %ecx, %xmm1
+	xorq %rax, %rax
+	ucomiss %xmm1, %xmm0
+	sete %al
+	movl %eax, %r13d
+	#instruction start "32 = bool_cast 31":
+	movq %r13, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %ebx
+	#instruction start "33 = set_reg %rax 32":
+	#instruction start "34 = return 19, 33, 28":
+	movq %rbx, %rax
+	#Block return.
+	movq -24(%rbp), %rbx
+	movq -32(%rbp), %r12
+	movq -40(%rbp), %r13
+	movq -48(%rbp), %r14
+	leave 
+	ret 
+.global conv
+conv:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movl %edi, %ebx
+.L4:
+	#instruction start "38 = proj3 36":
+	#instruction start "39 = proj1 36":
+	#instruction start "41 = %rdi":
+	#instruction start "42 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "43 = store part of 42 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "44 = load 42, state: 43":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "45 = int_float_cast 44":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	cvtsi2sd %rax, %xmm0
+	movq %xmm0, %rax
+	movq %rax, %r12
+	#instruction start "46 = set_reg %rax 45":
+	#instruction start "47 = return 37, 46, 43":
+	movq %r12, %xmm0
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $1616, %rsp
+	movq %rbx, -1572(%rbp)
+	movq %r12, -1580(%rbp)
+	movq %r13, -1588(%rbp)
+	movq %r14, -1596(%rbp)
+	movq %r15, -1604(%rbp)
+.L5:
+	#instruction start "51 = proj3 49":
+	#instruction start "54 = alloc with size 8":
+	leaq -1012(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "55 = constant(4612361558371493478)":
+	movabsq $4612361558371493478, %r12
+	#instruction start "56 = store 54 55, state: 51":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "57 = alloc with size 8":
+	leaq -1020(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "58 = constant(4616752568008179712)":
+	movabsq $4616752568008179712, %r13
+	#instruction start "59 = store 57 58, state: 56":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "60 = constant(0)":
+	movq $add, %r13
+	#instruction start "61 = constant(2)":
+	movq $2, %r14
+	#instruction start "62 = load part address of 54 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "63 = proj0 62":
+	#instruction start "64 = proj1 62":
+	#instruction start "65 = load part address of 57 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "66 = proj0 65":
+	#instruction start "67 = proj1 65":
+	#instruction start "68 = allocate_call_stack 0":
+	#instruction start "69 = set_reg %rax 64":
+	#instruction start "70 = set_reg %rbx 67 state: 69":
+	#instruction start "71 = set_reg %rax 61 state: 70":
+	#instruction start "72 = call 60":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %rbx, %xmm1
+	movq %r15, %xmm0
+	movq %r13, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %xmm0, %r12
+	#instruction start "73 = proj0 72":
+	#instruction start "74 = proj1 72":
+	#instruction start "75 = %rax":
+	#instruction start "76 = int_cast_zero 75":
+	movq %r12, %rax
+	movq %rax, %rbx
+	#instruction start "77 = constant(4619454727784602010)":
+	movabsq $4619454727784602010, %r12
+	#instruction start "78 = 76 < 77 (float)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	ucomisd %xmm1, %xmm0
+	setb %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "80 = if 50 78":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "83 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "84 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "85 = constant(19)":
+	movl $19, %r13d
+	#instruction start "86 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "87 = alloc with size 8":
+	leaq -1028(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "88 = store 87 83, state: 73":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "89 = alloc with size 8":
+	leaq -1036(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "90 = store 89 84, state: 88":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "91 = alloc with size 4":
+	leaq -1040(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "92 = store 91 85, state: 90":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "93 = alloc with size 8":
+	leaq -1048(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "94 = store 93 86, state: 92":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "95 = constant(1)":
+	leaq -32(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "96 = constant(0)":
+	leaq -40(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "97 = load part address of 87 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "98 = proj0 97":
+	#instruction start "99 = proj1 97":
+	#instruction start "100 = load part address of 89 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "101 = proj0 100":
+	#instruction start "102 = proj1 100":
+	#instruction start "103 = load part address of 91 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "104 = proj0 103":
+	#instruction start "105 = proj1 103":
+	#instruction start "106 = load part address of 93 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "107 = proj0 106":
+	#instruction start "108 = proj1 106":
+	#instruction start "109 = allocate_call_stack 0":
+	#instruction start "110 = set_reg %rdi 99":
+	#instruction start "111 = set_reg %rsi 102 state: 110":
+	#instruction start "112 = set_reg %rdx 105 state: 111":
+	#instruction start "113 = set_reg %rcx 108 state: 112":
+	#instruction start "114 = set_reg %rax 96 state: 113":
+	#instruction start "115 = call 95":
+	addq $0, %rsp
+	movq -40(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -32(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "116 = proj0 115":
+	#instruction start "117 = proj1 115":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "118 = alloc with size 8":
+	leaq -1056(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "119 = constant(4612361558371493478)":
+	movabsq $4612361558371493478, %r12
+	#instruction start "120 = phi (region: 79) 73 116":
+	#instruction start "121 = store 118 119, state: 120":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "122 = alloc with size 8":
+	leaq -1064(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "123 = constant(4616752568008179712)":
+	movabsq $4616752568008179712, %r13
+	#instruction start "124 = store 122 123, state: 121":
+	movq %r12, %rsi
+	movq %r13, (%rsi)
+	#instruction start "125 = constant(0)":
+	movq $add, %r13
+	#instruction start "126 = constant(2)":
+	movq $2, %r14
+	#instruction start "127 = load part address of 118 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "128 = proj0 127":
+	#instruction start "129 = proj1 127":
+	#instruction start "130 = load part address of 122 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "131 = proj0 130":
+	#instruction start "132 = proj1 130":
+	#instruction start "133 = allocate_call_stack 0":
+	#instruction start "134 = set_reg %rax 129":
+	#instruction start "135 = set_reg %rbx 132 state: 134":
+	#instruction start "136 = set_reg %rax 126 state: 135":
+	#instruction start "137 = call 125":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %rbx, %xmm1
+	movq %r15, %xmm0
+	movq %r13, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %xmm0, %r12
+	#instruction start "138 = proj0 137":
+	#instruction start "139 = proj1 137":
+	#instruction start "140 = %rax":
+	#instruction start "141 = int_cast_zero 140":
+	movq %r12, %rax
+	movq %rax, %rbx
+	#instruction start "142 = constant(4619229547803233485)":
+	movabsq $4619229547803233485, %r12
+	#instruction start "143 = 141 > 142 (float)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	ucomisd %xmm1, %xmm0
+	seta %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "145 = if 79 143":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "148 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "149 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "150 = constant(20)":
+	movl $20, %r13d
+	#instruction start "151 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "152 = alloc with size 8":
+	leaq -1072(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "153 = store 152 148, state: 138":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "154 = alloc with size 8":
+	leaq -1080(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "155 = store 154 149, state: 153":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "156 = alloc with size 4":
+	leaq -1084(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "157 = store 156 150, state: 155":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "158 = alloc with size 8":
+	leaq -1092(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "159 = store 158 151, state: 157":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "160 = constant(1)":
+	leaq -112(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "161 = constant(0)":
+	leaq -120(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "162 = load part address of 152 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "163 = proj0 162":
+	#instruction start "164 = proj1 162":
+	#instruction start "165 = load part address of 154 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "166 = proj0 165":
+	#instruction start "167 = proj1 165":
+	#instruction start "168 = load part address of 156 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "169 = proj0 168":
+	#instruction start "170 = proj1 168":
+	#instruction start "171 = load part address of 158 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "172 = proj0 171":
+	#instruction start "173 = proj1 171":
+	#instruction start "174 = allocate_call_stack 0":
+	#instruction start "175 = set_reg %rdi 164":
+	#instruction start "176 = set_reg %rsi 167 state: 175":
+	#instruction start "177 = set_reg %rdx 170 state: 176":
+	#instruction start "178 = set_reg %rcx 173 state: 177":
+	#instruction start "179 = set_reg %rax 161 state: 178":
+	#instruction start "180 = call 160":
+	addq $0, %rsp
+	movq -120(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -112(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "181 = proj0 180":
+	#instruction start "182 = proj1 180":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "184 = phi (region: 144) 138 181":
+	#instruction start "186 = constant(4616752568008179712)":
+	movabsq $4616752568008179712, %rbx
+	#instruction start "189 = constant(4607182418800017408)":
+	movabsq $4607182418800017408, %r12
+	#instruction start "190 = 186 + 189 (float)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	addsd %xmm1, %xmm0
+	movq %xmm0, %rax
+	movq %rax, %r13
+	#instruction start "193 = constant(4607182418800017408)":
+	movabsq $4607182418800017408, %rbx
+	#instruction start "194 = 190 - 193 (float)":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	subsd %xmm1, %xmm0
+	movq %xmm0, %rax
+	movq %rax, %r12
+	#instruction start "197 = constant(4607182418800017408)":
+	movabsq $4607182418800017408, %rbx
+	#instruction start "198 = 194 + 197 (float)":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	addsd %xmm1, %xmm0
+	movq %xmm0, %rax
+	movq %rax, %r13
+	#instruction start "201 = constant(4617765877924338074)":
+	movabsq $4617765877924338074, %rbx
+	#instruction start "202 = 198 >= 201 (float)":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	ucomisd %xmm1, %xmm0
+	setnb %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "203 = if 144 202":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "220 = alloc with size 4":
+	leaq -1096(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "221 = constant(0)":
+	movl $0, %r12d
+	#instruction start "222 = store 220 221, state: 184":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 224 (223 219 220)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L17
+.L13:
+	#instruction start "207 = constant(4617991057905706598)":
+	movabsq $4617991057905706598, %rbx
+	#instruction start "208 = 198 <= 207 (float)":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	ucomisd %xmm1, %xmm0
+	setbe %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "209 = if 205 208":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L15
+.L14:
+	#instruction start "215 = alloc with size 4":
+	leaq -1100(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "216 = constant(0)":
+	movl $0, %r13d
+	#instruction start "217 = store 215 216, state: 184":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 219 (218 212 215)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L16
+.L15:
+	#instruction start "212 = alloc with size 4":
+	leaq -1104(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "213 = constant(1)":
+	movl $1, %r14d
+	#instruction start "214 = store 212 213, state: 184":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 219 (218 212 215)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L16:
+	#instruction start "219 = phi (region: 218) 212 215":
+	#instruction start "226 = phi (region: 218) 214 217":
+	#Phi node to 224 (223 219 220)
+	movq %r13, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L17:
+	#instruction start "224 = phi (region: 223) 219 220":
+	#instruction start "225 = phi (region: 223) 226 222":
+	#instruction start "227 = load_volatile 224, state: 225":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "228 = proj0 227":
+	#instruction start "229 = proj1 227":
+	#instruction start "231 = if 223 229":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "234 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "235 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "236 = constant(26)":
+	movl $26, %r13d
+	#instruction start "237 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "238 = alloc with size 8":
+	leaq -1112(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "239 = store 238 234, state: 228":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "240 = alloc with size 8":
+	leaq -1120(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "241 = store 240 235, state: 239":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "242 = alloc with size 4":
+	leaq -1124(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "243 = store 242 236, state: 241":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "244 = alloc with size 8":
+	leaq -1132(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "245 = store 244 237, state: 243":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "246 = constant(1)":
+	leaq -168(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "247 = constant(0)":
+	leaq -176(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "248 = load part address of 238 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "249 = proj0 248":
+	#instruction start "250 = proj1 248":
+	#instruction start "251 = load part address of 240 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "252 = proj0 251":
+	#instruction start "253 = proj1 251":
+	#instruction start "254 = load part address of 242 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "255 = proj0 254":
+	#instruction start "256 = proj1 254":
+	#instruction start "257 = load part address of 244 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "258 = proj0 257":
+	#instruction start "259 = proj1 257":
+	#instruction start "260 = allocate_call_stack 0":
+	#instruction start "261 = set_reg %rdi 250":
+	#instruction start "262 = set_reg %rsi 253 state: 261":
+	#instruction start "263 = set_reg %rdx 256 state: 262":
+	#instruction start "264 = set_reg %rcx 259 state: 263":
+	#instruction start "265 = set_reg %rax 247 state: 264":
+	#instruction start "266 = call 246":
+	addq $0, %rsp
+	movq -176(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -168(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "267 = proj0 266":
+	#instruction start "268 = proj1 266":
+	#Block jump
+	jmp .L20
+.L19:
+	#Block jump elided
+.L20:
+	#instruction start "270 = phi (region: 230) 228 267":
+	#instruction start "272 = constant(4616752568008179712)":
+	movabsq $4616752568008179712, %rbx
+	#instruction start "275 = constant(4616639978017495450)":
+	movabsq $4616639978017495450, %r12
+	#instruction start "276 = 272 >= 275 (float)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	ucomisd %xmm1, %xmm0
+	setnb %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "277 = if 230 276":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "294 = alloc with size 4":
+	leaq -1136(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "295 = constant(0)":
+	movl $0, %r13d
+	#instruction start "296 = store 294 295, state: 270":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 298 (297 293 294)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L26
+.L22:
+	#instruction start "281 = constant(4616865157998863974)":
+	movabsq $4616865157998863974, %r12
+	#instruction start "282 = 272 <= 281 (float)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	ucomisd %xmm1, %xmm0
+	setbe %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "283 = if 279 282":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L24
+.L23:
+	#instruction start "289 = alloc with size 4":
+	leaq -1140(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "290 = constant(0)":
+	movl $0, %r12d
+	#instruction start "291 = store 289 290, state: 270":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 293 (292 286 289)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L25
+.L24:
+	#instruction start "286 = alloc with size 4":
+	leaq -1144(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "287 = constant(1)":
+	movl $1, %r14d
+	#instruction start "288 = store 286 287, state: 270":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 293 (292 286 289)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L25:
+	#instruction start "293 = phi (region: 292) 286 289":
+	#instruction start "300 = phi (region: 292) 288 291":
+	#Phi node to 298 (297 293 294)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L26:
+	#instruction start "298 = phi (region: 297) 293 294":
+	#instruction start "299 = phi (region: 297) 300 296":
+	#instruction start "301 = load_volatile 298, state: 299":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "302 = proj0 301":
+	#instruction start "303 = proj1 301":
+	#instruction start "305 = if 297 303":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L28
+.L27:
+	#instruction start "308 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "309 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "310 = constant(29)":
+	movl $29, %r13d
+	#instruction start "311 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "312 = alloc with size 8":
+	leaq -1152(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "313 = store 312 308, state: 302":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "314 = alloc with size 8":
+	leaq -1160(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "315 = store 314 309, state: 313":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "316 = alloc with size 4":
+	leaq -1164(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "317 = store 316 310, state: 315":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "318 = alloc with size 8":
+	leaq -1172(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "319 = store 318 311, state: 317":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "320 = constant(1)":
+	leaq -224(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "321 = constant(0)":
+	leaq -232(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "322 = load part address of 312 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "323 = proj0 322":
+	#instruction start "324 = proj1 322":
+	#instruction start "325 = load part address of 314 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "326 = proj0 325":
+	#instruction start "327 = proj1 325":
+	#instruction start "328 = load part address of 316 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "329 = proj0 328":
+	#instruction start "330 = proj1 328":
+	#instruction start "331 = load part address of 318 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "332 = proj0 331":
+	#instruction start "333 = proj1 331":
+	#instruction start "334 = allocate_call_stack 0":
+	#instruction start "335 = set_reg %rdi 324":
+	#instruction start "336 = set_reg %rsi 327 state: 335":
+	#instruction start "337 = set_reg %rdx 330 state: 336":
+	#instruction start "338 = set_reg %rcx 333 state: 337":
+	#instruction start "339 = set_reg %rax 321 state: 338":
+	#instruction start "340 = call 320":
+	addq $0, %rsp
+	movq -232(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -224(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "341 = proj0 340":
+	#instruction start "342 = proj1 340":
+	#Block jump
+	jmp .L29
+.L28:
+	#Block jump elided
+.L29:
+	#instruction start "344 = phi (region: 304) 302 341":
+	#instruction start "346 = constant(88)":
+	movl $88, %ebx
+	#instruction start "351 = int_float_cast 346":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	cvtsi2ss %rax, %xmm0
+	movd %xmm0, %eax
+	movl %eax, %r12d
+	#instruction start "354 = constant(1118699520)":
+	movl $1118699520, %ebx
+	#instruction start "355 = 351 >= 354 (float)":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	movd %eax, %xmm0
+	movd %ecx, %xmm1
+	xorq %rax, %rax
+	ucomiss %xmm1, %xmm0
+	setnb %al
+	movl %eax, %r13d
+	#instruction start "356 = if 304 355":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L31
+.L30:
+	#instruction start "373 = alloc with size 4":
+	leaq -1176(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "374 = constant(0)":
+	movl $0, %r13d
+	#instruction start "375 = store 373 374, state: 344":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 377 (376 372 373)
+	movq %rbx, %rax
+	movq %rax, -280(%rbp)
+	#Phi node to 1048 (376 1049 351)
+	movq %r12, %rax
+	movl %eax, -284(%rbp)
+	#Block jump
+	jmp .L35
+.L31:
+	#instruction start "360 = constant(1118961664)":
+	movl $1118961664, %ebx
+	#instruction start "361 = 351 <= 360 (float)":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	movd %eax, %xmm0
+	movd %ecx, %xmm1
+	xorq %rax, %rax
+	ucomiss %xmm1, %xmm0
+	setbe %al
+	movl %eax, %r15d
+	#instruction start "362 = if 358 361":
+	movq %r15, %rdi
+	testq %rdi, %rdi
+	jne .L33
+.L32:
+	#instruction start "368 = alloc with size 4":
+	leaq -1180(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "369 = constant(0)":
+	movl $0, %r15d
+	#instruction start "370 = store 368 369, state: 344":
+	movq %rbx, %rsi
+	movl %r15d, (%rsi)
+	#Phi node to 372 (371 365 368)
+	movq %rbx, %rax
+	movq %rax, %r15
+	#Phi node to 1049 (371 351 351)
+	movq %r12, %rax
+	movl %eax, %r14d
+	#Block jump
+	jmp .L34
+.L33:
+	#instruction start "365 = alloc with size 4":
+	leaq -1184(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "366 = constant(1)":
+	movl $1, %r13d
+	#instruction start "367 = store 365 366, state: 344":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 372 (371 365 368)
+	movq %rbx, %rax
+	movq %rax, %r15
+	#Phi node to 1049 (371 351 351)
+	movq %r12, %rax
+	movl %eax, %r14d
+	#Block jump elided
+.L34:
+	#instruction start "372 = phi (region: 371) 365 368":
+	#instruction start "379 = phi (region: 371) 367 370":
+	#instruction start "1049 = phi (region: 371) 351 351":
+	#Phi node to 377 (376 372 373)
+	movq %r15, %rax
+	movq %rax, -280(%rbp)
+	#Phi node to 1048 (376 1049 351)
+	movq %r14, %rax
+	movl %eax, -284(%rbp)
+	#Block jump elided
+.L35:
+	#instruction start "377 = phi (region: 376) 372 373":
+	#instruction start "378 = phi (region: 376) 379 375":
+	#instruction start "380 = load_volatile 377, state: 378":
+	movq -280(%rbp), %rdi
+	movl (%rdi), %ebx
+	#instruction start "381 = proj0 380":
+	#instruction start "382 = proj1 380":
+	#instruction start "384 = if 376 382":
+	#instruction start "1048 = phi (region: 376) 1049 351":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L37
+.L36:
+	#instruction start "387 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "388 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "389 = constant(34)":
+	movl $34, %r13d
+	#instruction start "390 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "391 = alloc with size 8":
+	leaq -1192(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "392 = store 391 387, state: 381":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "393 = alloc with size 8":
+	leaq -1200(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "394 = store 393 388, state: 392":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "395 = alloc with size 4":
+	leaq -1204(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "396 = store 395 389, state: 394":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "397 = alloc with size 8":
+	leaq -1212(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "398 = store 397 390, state: 396":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "399 = constant(1)":
+	leaq -292(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "400 = constant(0)":
+	leaq -300(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "401 = load part address of 391 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "402 = proj0 401":
+	#instruction start "403 = proj1 401":
+	#instruction start "404 = load part address of 393 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "405 = proj0 404":
+	#instruction start "406 = proj1 404":
+	#instruction start "407 = load part address of 395 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "408 = proj0 407":
+	#instruction start "409 = proj1 407":
+	#instruction start "410 = load part address of 397 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "411 = proj0 410":
+	#instruction start "412 = proj1 410":
+	#instruction start "413 = allocate_call_stack 0":
+	#instruction start "414 = set_reg %rdi 403":
+	#instruction start "415 = set_reg %rsi 406 state: 414":
+	#instruction start "416 = set_reg %rdx 409 state: 415":
+	#instruction start "417 = set_reg %rcx 412 state: 416":
+	#instruction start "418 = set_reg %rax 400 state: 417":
+	#instruction start "419 = call 399":
+	addq $0, %rsp
+	movq -300(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -292(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "420 = proj0 419":
+	#instruction start "421 = proj1 419":
+	#Phi node to 1047 (383 1048 1048)
+	movl -284(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump
+	jmp .L38
+.L37:
+	#Phi node to 1047 (383 1048 1048)
+	movl -284(%rbp), %eax
+	movl %eax, %ebx
+	#Block jump elided
+.L38:
+	#instruction start "422 = phi (region: 383) 381 420":
+	#instruction start "424 = constant(1073741824)":
+	movl $1073741824, %r12d
+	#instruction start "1047 = phi (region: 383) 1048 1048":
+	#instruction start "425 = 1047 / 424 (float)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	movd %eax, %xmm0
+	movd %ecx, %xmm1
+	divss %xmm1, %xmm0
+	movd %xmm0, %eax
+	movl %eax, %r13d
+	#instruction start "426 = float_int_cast 425":
+	movq %r13, %rax
+	movd %eax, %xmm0
+	cvttss2si %xmm0, %rax
+	movl %eax, %ebx
+	#instruction start "429 = constant(43)":
+	movl $43, %r12d
+	#instruction start "430 = 426 >= 429 (signed)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "431 = if 383 430":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L40
+.L39:
+	#instruction start "448 = alloc with size 4":
+	leaq -1216(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "449 = constant(0)":
+	movl $0, %r13d
+	#instruction start "450 = store 448 449, state: 422":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 452 (451 447 448)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L44
+.L40:
+	#instruction start "435 = constant(45)":
+	movl $45, %r12d
+	#instruction start "436 = 426 <= 435 (signed)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "437 = if 433 436":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L42
+.L41:
+	#instruction start "443 = alloc with size 4":
+	leaq -1220(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "444 = constant(0)":
+	movl $0, %r12d
+	#instruction start "445 = store 443 444, state: 422":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 447 (446 440 443)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L43
+.L42:
+	#instruction start "440 = alloc with size 4":
+	leaq -1224(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "441 = constant(1)":
+	movl $1, %r14d
+	#instruction start "442 = store 440 441, state: 422":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 447 (446 440 443)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L43:
+	#instruction start "447 = phi (region: 446) 440 443":
+	#instruction start "454 = phi (region: 446) 442 445":
+	#Phi node to 452 (451 447 448)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L44:
+	#instruction start "452 = phi (region: 451) 447 448":
+	#instruction start "453 = phi (region: 451) 454 450":
+	#instruction start "455 = load_volatile 452, state: 453":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "456 = proj0 455":
+	#instruction start "457 = proj1 455":
+	#instruction start "459 = if 451 457":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L46
+.L45:
+	#instruction start "462 = constant(9)":
+	movq $.Ls9, %rbx
+	#instruction start "463 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "464 = constant(37)":
+	movl $37, %r13d
+	#instruction start "465 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "466 = alloc with size 8":
+	leaq -1232(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "467 = store 466 462, state: 456":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "468 = alloc with size 8":
+	leaq -1240(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "469 = store 468 463, state: 467":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "470 = alloc with size 4":
+	leaq -1244(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "471 = store 470 464, state: 469":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "472 = alloc with size 8":
+	leaq -1252(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "473 = store 472 465, state: 471":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "474 = constant(1)":
+	leaq -348(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "475 = constant(0)":
+	leaq -356(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "476 = load part address of 466 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "477 = proj0 476":
+	#instruction start "478 = proj1 476":
+	#instruction start "479 = load part address of 468 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "480 = proj0 479":
+	#instruction start "481 = proj1 479":
+	#instruction start "482 = load part address of 470 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "483 = proj0 482":
+	#instruction start "484 = proj1 482":
+	#instruction start "485 = load part address of 472 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "486 = proj0 485":
+	#instruction start "487 = proj1 485":
+	#instruction start "488 = allocate_call_stack 0":
+	#instruction start "489 = set_reg %rdi 478":
+	#instruction start "490 = set_reg %rsi 481 state: 489":
+	#instruction start "491 = set_reg %rdx 484 state: 490":
+	#instruction start "492 = set_reg %rcx 487 state: 491":
+	#instruction start "493 = set_reg %rax 475 state: 492":
+	#instruction start "494 = call 474":
+	addq $0, %rsp
+	movq -356(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -348(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "495 = proj0 494":
+	#instruction start "496 = proj1 494":
+	#Block jump
+	jmp .L47
+.L46:
+	#Block jump elided
+.L47:
+	#instruction start "497 = constant(999999999)":
+	movl $999999999, %ebx
+	#instruction start "498 = int_float_cast 497":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	cvtsi2sd %rax, %xmm0
+	movq %xmm0, %rax
+	movq %rax, %r12
+	#instruction start "499 = phi (region: 458) 456 495":
+	#instruction start "504 = float_int_cast 498":
+	movq %r12, %rax
+	movd %rax, %xmm0
+	cvttsd2si %xmm0, %rax
+	movq %rax, %rbx
+	#instruction start "507 = constant(999999998)":
+	movq $999999998, %r12
+	#instruction start "508 = 504 >= 507":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	setnb %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "509 = if 458 508":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L49
+.L48:
+	#instruction start "526 = alloc with size 4":
+	leaq -1256(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "527 = constant(0)":
+	movl $0, %r13d
+	#instruction start "528 = store 526 527, state: 499":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 530 (529 525 526)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L53
+.L49:
+	#instruction start "513 = constant(1000000000)":
+	movq $1000000000, %r12
+	#instruction start "514 = 504 <= 513":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "515 = if 511 514":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L51
+.L50:
+	#instruction start "521 = alloc with size 4":
+	leaq -1260(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "522 = constant(0)":
+	movl $0, %r12d
+	#instruction start "523 = store 521 522, state: 499":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 525 (524 518 521)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L52
+.L51:
+	#instruction start "518 = alloc with size 4":
+	leaq -1264(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "519 = constant(1)":
+	movl $1, %r14d
+	#instruction start "520 = store 518 519, state: 499":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 525 (524 518 521)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L52:
+	#instruction start "525 = phi (region: 524) 518 521":
+	#instruction start "532 = phi (region: 524) 520 523":
+	#Phi node to 530 (529 525 526)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L53:
+	#instruction start "530 = phi (region: 529) 525 526":
+	#instruction start "531 = phi (region: 529) 532 528":
+	#instruction start "533 = load_volatile 530, state: 531":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "534 = proj0 533":
+	#instruction start "535 = proj1 533":
+	#instruction start "537 = if 529 535":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L55
+.L54:
+	#instruction start "540 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "541 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "542 = constant(41)":
+	movl $41, %r13d
+	#instruction start "543 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "544 = alloc with size 8":
+	leaq -1272(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "545 = store 544 540, state: 534":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "546 = alloc with size 8":
+	leaq -1280(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "547 = store 546 541, state: 545":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "548 = alloc with size 4":
+	leaq -1284(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "549 = store 548 542, state: 547":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "550 = alloc with size 8":
+	leaq -1292(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "551 = store 550 543, state: 549":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "552 = constant(1)":
+	leaq -404(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "553 = constant(0)":
+	leaq -412(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "554 = load part address of 544 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "555 = proj0 554":
+	#instruction start "556 = proj1 554":
+	#instruction start "557 = load part address of 546 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "558 = proj0 557":
+	#instruction start "559 = proj1 557":
+	#instruction start "560 = load part address of 548 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "561 = proj0 560":
+	#instruction start "562 = proj1 560":
+	#instruction start "563 = load part address of 550 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "564 = proj0 563":
+	#instruction start "565 = proj1 563":
+	#instruction start "566 = allocate_call_stack 0":
+	#instruction start "567 = set_reg %rdi 556":
+	#instruction start "568 = set_reg %rsi 559 state: 567":
+	#instruction start "569 = set_reg %rdx 562 state: 568":
+	#instruction start "570 = set_reg %rcx 565 state: 569":
+	#instruction start "571 = set_reg %rax 553 state: 570":
+	#instruction start "572 = call 552":
+	addq $0, %rsp
+	movq -412(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -404(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "573 = proj0 572":
+	#instruction start "574 = proj1 572":
+	#Block jump
+	jmp .L56
+.L55:
+	#Block jump elided
+.L56:
+	#instruction start "576 = phi (region: 536) 534 573":
+	#instruction start "578 = constant(4636737291354636288)":
+	movabsq $4636737291354636288, %rbx
+	#instruction start "581 = -578 (float)":
+	movq %rbx, %rax
+	btcq $63, %rax
+	movq %rax, %r12
+	#instruction start "582 = constant(-4586634745500139520)":
+	movabsq $-4586634745500139520, %rbx
+	#instruction start "583 = 581 == 582 (float)":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	ucomisd %xmm1, %xmm0
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "585 = if 536 583":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L58
+.L57:
+	#instruction start "588 = constant(11)":
+	movq $.Ls11, %rbx
+	#instruction start "589 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "590 = constant(45)":
+	movl $45, %r13d
+	#instruction start "591 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "592 = alloc with size 8":
+	leaq -1300(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "593 = store 592 588, state: 576":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "594 = alloc with size 8":
+	leaq -1308(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "595 = store 594 589, state: 593":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "596 = alloc with size 4":
+	leaq -1312(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "597 = store 596 590, state: 595":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "598 = alloc with size 8":
+	leaq -1320(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "599 = store 598 591, state: 597":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "600 = constant(1)":
+	leaq -460(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "601 = constant(0)":
+	leaq -468(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "602 = load part address of 592 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "603 = proj0 602":
+	#instruction start "604 = proj1 602":
+	#instruction start "605 = load part address of 594 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "606 = proj0 605":
+	#instruction start "607 = proj1 605":
+	#instruction start "608 = load part address of 596 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "609 = proj0 608":
+	#instruction start "610 = proj1 608":
+	#instruction start "611 = load part address of 598 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "612 = proj0 611":
+	#instruction start "613 = proj1 611":
+	#instruction start "614 = allocate_call_stack 0":
+	#instruction start "615 = set_reg %rdi 604":
+	#instruction start "616 = set_reg %rsi 607 state: 615":
+	#instruction start "617 = set_reg %rdx 610 state: 616":
+	#instruction start "618 = set_reg %rcx 613 state: 617":
+	#instruction start "619 = set_reg %rax 601 state: 618":
+	#instruction start "620 = call 600":
+	addq $0, %rsp
+	movq -468(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -460(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "621 = proj0 620":
+	#instruction start "622 = proj1 620":
+	#Block jump
+	jmp .L59
+.L58:
+	#Block jump elided
+.L59:
+	#instruction start "623 = constant(1)":
+	movl $1, %ebx
+	#instruction start "625 = if 584 623":
+	#instruction start "633 = phi (region: 584) 576 621":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L61
+.L60:
+	#instruction start "628 = constant(12)":
+	movq $.Ls12, %rbx
+	#instruction start "629 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "630 = constant(48)":
+	movl $48, %r13d
+	#instruction start "631 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "632 = alloc with size 8":
+	leaq -1328(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "634 = store 632 628, state: 633":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "635 = alloc with size 8":
+	leaq -1336(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "636 = store 635 629, state: 634":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "637 = alloc with size 4":
+	leaq -1340(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "638 = store 637 630, state: 636":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "639 = alloc with size 8":
+	leaq -1348(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "640 = store 639 631, state: 638":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "641 = constant(1)":
+	leaq -516(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "642 = constant(0)":
+	leaq -524(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "643 = load part address of 632 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "644 = proj0 643":
+	#instruction start "645 = proj1 643":
+	#instruction start "646 = load part address of 635 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "647 = proj0 646":
+	#instruction start "648 = proj1 646":
+	#instruction start "649 = load part address of 637 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "650 = proj0 649":
+	#instruction start "651 = proj1 649":
+	#instruction start "652 = load part address of 639 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "653 = proj0 652":
+	#instruction start "654 = proj1 652":
+	#instruction start "655 = allocate_call_stack 0":
+	#instruction start "656 = set_reg %rdi 645":
+	#instruction start "657 = set_reg %rsi 648 state: 656":
+	#instruction start "658 = set_reg %rdx 651 state: 657":
+	#instruction start "659 = set_reg %rcx 654 state: 658":
+	#instruction start "660 = set_reg %rax 642 state: 659":
+	#instruction start "661 = call 641":
+	addq $0, %rsp
+	movq -524(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -516(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "662 = proj0 661":
+	#instruction start "663 = proj1 661":
+	#Block jump
+	jmp .L62
+.L61:
+	#Block jump elided
+.L62:
+	#instruction start "664 = constant(1)":
+	movl $1, %ebx
+	#instruction start "666 = if 624 664":
+	#instruction start "674 = phi (region: 624) 633 662":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L64
+.L63:
+	#instruction start "669 = constant(13)":
+	movq $.Ls13, %rbx
+	#instruction start "670 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "671 = constant(49)":
+	movl $49, %r13d
+	#instruction start "672 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "673 = alloc with size 8":
+	leaq -1356(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "675 = store 673 669, state: 674":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "676 = alloc with size 8":
+	leaq -1364(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "677 = store 676 670, state: 675":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "678 = alloc with size 4":
+	leaq -1368(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "679 = store 678 671, state: 677":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "680 = alloc with size 8":
+	leaq -1376(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "681 = store 680 672, state: 679":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "682 = constant(1)":
+	leaq -572(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "683 = constant(0)":
+	leaq -580(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "684 = load part address of 673 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "685 = proj0 684":
+	#instruction start "686 = proj1 684":
+	#instruction start "687 = load part address of 676 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "688 = proj0 687":
+	#instruction start "689 = proj1 687":
+	#instruction start "690 = load part address of 678 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "691 = proj0 690":
+	#instruction start "692 = proj1 690":
+	#instruction start "693 = load part address of 680 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "694 = proj0 693":
+	#instruction start "695 = proj1 693":
+	#instruction start "696 = allocate_call_stack 0":
+	#instruction start "697 = set_reg %rdi 686":
+	#instruction start "698 = set_reg %rsi 689 state: 697":
+	#instruction start "699 = set_reg %rdx 692 state: 698":
+	#instruction start "700 = set_reg %rcx 695 state: 699":
+	#instruction start "701 = set_reg %rax 683 state: 700":
+	#instruction start "702 = call 682":
+	addq $0, %rsp
+	movq -580(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -572(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "703 = proj0 702":
+	#instruction start "704 = proj1 702":
+	#Block jump
+	jmp .L65
+.L64:
+	#Block jump elided
+.L65:
+	#instruction start "705 = constant(1)":
+	movl $1, %ebx
+	#instruction start "707 = if 665 705":
+	#instruction start "715 = phi (region: 665) 674 703":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L67
+.L66:
+	#instruction start "710 = constant(14)":
+	movq $.Ls14, %rbx
+	#instruction start "711 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "712 = constant(50)":
+	movl $50, %r13d
+	#instruction start "713 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "714 = alloc with size 8":
+	leaq -1384(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "716 = store 714 710, state: 715":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "717 = alloc with size 8":
+	leaq -1392(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "718 = store 717 711, state: 716":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "719 = alloc with size 4":
+	leaq -1396(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "720 = store 719 712, state: 718":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "721 = alloc with size 8":
+	leaq -1404(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "722 = store 721 713, state: 720":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "723 = constant(1)":
+	leaq -628(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "724 = constant(0)":
+	leaq -636(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "725 = load part address of 714 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "726 = proj0 725":
+	#instruction start "727 = proj1 725":
+	#instruction start "728 = load part address of 717 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "729 = proj0 728":
+	#instruction start "730 = proj1 728":
+	#instruction start "731 = load part address of 719 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "732 = proj0 731":
+	#instruction start "733 = proj1 731":
+	#instruction start "734 = load part address of 721 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "735 = proj0 734":
+	#instruction start "736 = proj1 734":
+	#instruction start "737 = allocate_call_stack 0":
+	#instruction start "738 = set_reg %rdi 727":
+	#instruction start "739 = set_reg %rsi 730 state: 738":
+	#instruction start "740 = set_reg %rdx 733 state: 739":
+	#instruction start "741 = set_reg %rcx 736 state: 740":
+	#instruction start "742 = set_reg %rax 724 state: 741":
+	#instruction start "743 = call 723":
+	addq $0, %rsp
+	movq -636(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -628(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "744 = proj0 743":
+	#instruction start "745 = proj1 743":
+	#Block jump
+	jmp .L68
+.L67:
+	#Block jump elided
+.L68:
+	#instruction start "746 = constant(1)":
+	movl $1, %ebx
+	#instruction start "748 = if 706 746":
+	#instruction start "756 = phi (region: 706) 715 744":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L70
+.L69:
+	#instruction start "751 = constant(15)":
+	movq $.Ls15, %rbx
+	#instruction start "752 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "753 = constant(51)":
+	movl $51, %r13d
+	#instruction start "754 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "755 = alloc with size 8":
+	leaq -1412(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "757 = store 755 751, state: 756":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "758 = alloc with size 8":
+	leaq -1420(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "759 = store 758 752, state: 757":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "760 = alloc with size 4":
+	leaq -1424(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "761 = store 760 753, state: 759":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "762 = alloc with size 8":
+	leaq -1432(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "763 = store 762 754, state: 761":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "764 = constant(1)":
+	leaq -684(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "765 = constant(0)":
+	leaq -692(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "766 = load part address of 755 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "767 = proj0 766":
+	#instruction start "768 = proj1 766":
+	#instruction start "769 = load part address of 758 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "770 = proj0 769":
+	#instruction start "771 = proj1 769":
+	#instruction start "772 = load part address of 760 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "773 = proj0 772":
+	#instruction start "774 = proj1 772":
+	#instruction start "775 = load part address of 762 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "776 = proj0 775":
+	#instruction start "777 = proj1 775":
+	#instruction start "778 = allocate_call_stack 0":
+	#instruction start "779 = set_reg %rdi 768":
+	#instruction start "780 = set_reg %rsi 771 state: 779":
+	#instruction start "781 = set_reg %rdx 774 state: 780":
+	#instruction start "782 = set_reg %rcx 777 state: 781":
+	#instruction start "783 = set_reg %rax 765 state: 782":
+	#instruction start "784 = call 764":
+	addq $0, %rsp
+	movq -692(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -684(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "785 = proj0 784":
+	#instruction start "786 = proj1 784":
+	#Block jump
+	jmp .L71
+.L70:
+	#Block jump elided
+.L71:
+	#instruction start "788 = phi (region: 747) 756 785":
+	#instruction start "796 = constant(0)":
+	movq $0, %rbx
+	#instruction start "797 = float_cast 796":
+	movq %rbx, %rax
+	movq %rax, %xmm0
+	cvtsd2ss %xmm0, %xmm0
+	movd %xmm0, %eax
+	movl %eax, %r12d
+	#instruction start "798 = constant(4607182418800017408)":
+	movabsq $4607182418800017408, %rbx
+	#instruction start "799 = float_cast 798":
+	movq %rbx, %rax
+	movq %rax, %xmm0
+	cvtsd2ss %xmm0, %xmm0
+	movd %xmm0, %eax
+	movl %eax, %r13d
+	#instruction start "800 = alloc with size 4":
+	leaq -1436(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "801 = store 800 797, state: 788":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "802 = alloc with size 4":
+	leaq -1440(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "803 = store 802 799, state: 801":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "804 = constant(16)":
+	movq $fcmp, %r13
+	#instruction start "805 = constant(2)":
+	movq $2, %r14
+	#instruction start "806 = load part address of 800 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r15d
+	#instruction start "807 = proj0 806":
+	#instruction start "808 = proj1 806":
+	#instruction start "809 = load part address of 802 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "810 = proj0 809":
+	#instruction start "811 = proj1 809":
+	#instruction start "812 = allocate_call_stack 0":
+	#instruction start "813 = set_reg %rax 808":
+	#instruction start "814 = set_reg %rbx 811 state: 813":
+	#instruction start "815 = set_reg %rax 805 state: 814":
+	#instruction start "816 = call 804":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %rbx, %xmm1
+	movq %r15, %xmm0
+	movq %r13, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r12
+	#instruction start "817 = proj0 816":
+	#instruction start "818 = proj1 816":
+	#instruction start "819 = %rax":
+	#instruction start "820 = int_cast_zero 819":
+	movq %r12, %rax
+	movzbl %al, %ebx
+	#instruction start "821 = int_cast_zero 820":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "822 = if 747 821":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L73
+.L72:
+	#instruction start "828 = alloc with size 4":
+	leaq -1444(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "829 = constant(1)":
+	movl $1, %r12d
+	#instruction start "830 = store 828 829, state: 817":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 832 (831 825 828)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L74
+.L73:
+	#instruction start "825 = alloc with size 4":
+	leaq -1448(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "826 = constant(0)":
+	movl $0, %r13d
+	#instruction start "827 = store 825 826, state: 817":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 832 (831 825 828)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L74:
+	#instruction start "832 = phi (region: 831) 825 828":
+	#instruction start "833 = phi (region: 831) 827 830":
+	#instruction start "834 = load_volatile 832, state: 833":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "835 = proj0 834":
+	#instruction start "836 = proj1 834":
+	#instruction start "838 = if 831 836":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L76
+.L75:
+	#instruction start "841 = constant(17)":
+	movq $.Ls17, %rbx
+	#instruction start "842 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "843 = constant(59)":
+	movl $59, %r13d
+	#instruction start "844 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "845 = alloc with size 8":
+	leaq -1456(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "846 = store 845 841, state: 835":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "847 = alloc with size 8":
+	leaq -1464(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "848 = store 847 842, state: 846":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "849 = alloc with size 4":
+	leaq -1468(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "850 = store 849 843, state: 848":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "851 = alloc with size 8":
+	leaq -1476(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "852 = store 851 844, state: 850":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "853 = constant(1)":
+	leaq -764(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "854 = constant(0)":
+	leaq -772(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "855 = load part address of 845 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "856 = proj0 855":
+	#instruction start "857 = proj1 855":
+	#instruction start "858 = load part address of 847 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "859 = proj0 858":
+	#instruction start "860 = proj1 858":
+	#instruction start "861 = load part address of 849 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "862 = proj0 861":
+	#instruction start "863 = proj1 861":
+	#instruction start "864 = load part address of 851 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "865 = proj0 864":
+	#instruction start "866 = proj1 864":
+	#instruction start "867 = allocate_call_stack 0":
+	#instruction start "868 = set_reg %rdi 857":
+	#instruction start "869 = set_reg %rsi 860 state: 868":
+	#instruction start "870 = set_reg %rdx 863 state: 869":
+	#instruction start "871 = set_reg %rcx 866 state: 870":
+	#instruction start "872 = set_reg %rax 854 state: 871":
+	#instruction start "873 = call 853":
+	addq $0, %rsp
+	movq -772(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -764(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "874 = proj0 873":
+	#instruction start "875 = proj1 873":
+	#Block jump
+	jmp .L77
+.L76:
+	#Block jump elided
+.L77:
+	#instruction start "877 = phi (region: 837) 835 874":
+	#instruction start "881 = alloc with size 4":
+	leaq -1480(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "882 = constant(-1)":
+	movl $4294967295, %r12d
+	#instruction start "883 = store 881 882, state: 877":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "884 = constant(18)":
+	movq $conv, %r12
+	#instruction start "885 = constant(0)":
+	movq $0, %r13
+	#instruction start "886 = load part address of 881 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "887 = proj0 886":
+	#instruction start "888 = proj1 886":
+	#instruction start "889 = allocate_call_stack 0":
+	#instruction start "890 = set_reg %rdi 888":
+	#instruction start "891 = set_reg %rax 885 state: 890":
+	#instruction start "892 = call 884":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %xmm0, %rbx
+	#instruction start "893 = proj0 892":
+	#instruction start "894 = proj1 892":
+	#instruction start "895 = %rax":
+	#instruction start "896 = int_cast_zero 895":
+	movq %rbx, %rax
+	movq %rax, %r12
+	#instruction start "897 = constant(-4616189618054758400)":
+	movabsq $-4616189618054758400, %rbx
+	#instruction start "898 = 896 == 897 (float)":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	ucomisd %xmm1, %xmm0
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "900 = if 837 898":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L79
+.L78:
+	#instruction start "903 = constant(19)":
+	movq $.Ls19, %rbx
+	#instruction start "904 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "905 = constant(63)":
+	movl $63, %r13d
+	#instruction start "906 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "907 = alloc with size 8":
+	leaq -1488(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "908 = store 907 903, state: 893":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "909 = alloc with size 8":
+	leaq -1496(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "910 = store 909 904, state: 908":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "911 = alloc with size 4":
+	leaq -1500(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "912 = store 911 905, state: 910":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "913 = alloc with size 8":
+	leaq -1508(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "914 = store 913 906, state: 912":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "915 = constant(1)":
+	leaq -836(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "916 = constant(0)":
+	leaq -844(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "917 = load part address of 907 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "918 = proj0 917":
+	#instruction start "919 = proj1 917":
+	#instruction start "920 = load part address of 909 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "921 = proj0 920":
+	#instruction start "922 = proj1 920":
+	#instruction start "923 = load part address of 911 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "924 = proj0 923":
+	#instruction start "925 = proj1 923":
+	#instruction start "926 = load part address of 913 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "927 = proj0 926":
+	#instruction start "928 = proj1 926":
+	#instruction start "929 = allocate_call_stack 0":
+	#instruction start "930 = set_reg %rdi 919":
+	#instruction start "931 = set_reg %rsi 922 state: 930":
+	#instruction start "932 = set_reg %rdx 925 state: 931":
+	#instruction start "933 = set_reg %rcx 928 state: 932":
+	#instruction start "934 = set_reg %rax 916 state: 933":
+	#instruction start "935 = call 915":
+	addq $0, %rsp
+	movq -844(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -836(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "936 = proj0 935":
+	#instruction start "937 = proj1 935":
+	#Block jump
+	jmp .L80
+.L79:
+	#Block jump elided
+.L80:
+	#instruction start "939 = phi (region: 899) 893 936":
+	#instruction start "941 = constant(1082130432)":
+	movl $1082130432, %ebx
+	#instruction start "944 = -941 (float)":
+	movq %rbx, %rax
+	leal -2147483648(%rax), %eax
+	movl %eax, %r12d
+	#instruction start "947 = constant(-1065353216)":
+	movl $3229614080, %ebx
+	#instruction start "948 = 944 == 947 (float)":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	movd %eax, %xmm0
+	movd %ecx, %xmm1
+	xorq %rax, %rax
+	ucomiss %xmm1, %xmm0
+	sete %al
+	movl %eax, %r13d
+	#instruction start "950 = if 899 948":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L82
+.L81:
+	#instruction start "953 = constant(20)":
+	movq $.Ls20, %rbx
+	#instruction start "954 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "955 = constant(68)":
+	movl $68, %r13d
+	#instruction start "956 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "957 = alloc with size 8":
+	leaq -1516(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "958 = store 957 953, state: 939":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "959 = alloc with size 8":
+	leaq -1524(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "960 = store 959 954, state: 958":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "961 = alloc with size 4":
+	leaq -1528(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "962 = store 961 955, state: 960":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "963 = alloc with size 8":
+	leaq -1536(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "964 = store 963 956, state: 962":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "965 = constant(1)":
+	leaq -892(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "966 = constant(0)":
+	leaq -900(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "967 = load part address of 957 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "968 = proj0 967":
+	#instruction start "969 = proj1 967":
+	#instruction start "970 = load part address of 959 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "971 = proj0 970":
+	#instruction start "972 = proj1 970":
+	#instruction start "973 = load part address of 961 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "974 = proj0 973":
+	#instruction start "975 = proj1 973":
+	#instruction start "976 = load part address of 963 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "977 = proj0 976":
+	#instruction start "978 = proj1 976":
+	#instruction start "979 = allocate_call_stack 0":
+	#instruction start "980 = set_reg %rdi 969":
+	#instruction start "981 = set_reg %rsi 972 state: 980":
+	#instruction start "982 = set_reg %rdx 975 state: 981":
+	#instruction start "983 = set_reg %rcx 978 state: 982":
+	#instruction start "984 = set_reg %rax 966 state: 983":
+	#instruction start "985 = call 965":
+	addq $0, %rsp
+	movq -900(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -892(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "986 = proj0 985":
+	#instruction start "987 = proj1 985":
+	#Block jump
+	jmp .L83
+.L82:
+	#Block jump elided
+.L83:
+	#instruction start "989 = phi (region: 949) 939 986":
+	#instruction start "991 = constant(4616189618054758400)":
+	movabsq $4616189618054758400, %rbx
+	#instruction start "994 = -991 (float)":
+	movq %rbx, %rax
+	btcq $63, %rax
+	movq %rax, %r12
+	#instruction start "997 = constant(-4607182418800017408)":
+	movabsq $-4607182418800017408, %rbx
+	#instruction start "998 = 994 == 997 (float)":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	movq %rax, %xmm0
+	movq %rcx, %xmm1
+	ucomisd %xmm1, %xmm0
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "1000 = if 949 998":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L85
+.L84:
+	#instruction start "1003 = constant(21)":
+	movq $.Ls21, %rbx
+	#instruction start "1004 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "1005 = constant(74)":
+	movl $74, %r13d
+	#instruction start "1006 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "1007 = alloc with size 8":
+	leaq -1544(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1008 = store 1007 1003, state: 989":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1009 = alloc with size 8":
+	leaq -1552(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1010 = store 1009 1004, state: 1008":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1011 = alloc with size 4":
+	leaq -1556(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1012 = store 1011 1005, state: 1010":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1013 = alloc with size 8":
+	leaq -1564(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1014 = store 1013 1006, state: 1012":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1015 = constant(1)":
+	leaq -948(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1016 = constant(0)":
+	leaq -956(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1017 = load part address of 1007 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1018 = proj0 1017":
+	#instruction start "1019 = proj1 1017":
+	#instruction start "1020 = load part address of 1009 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1021 = proj0 1020":
+	#instruction start "1022 = proj1 1020":
+	#instruction start "1023 = load part address of 1011 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1024 = proj0 1023":
+	#instruction start "1025 = proj1 1023":
+	#instruction start "1026 = load part address of 1013 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1027 = proj0 1026":
+	#instruction start "1028 = proj1 1026":
+	#instruction start "1029 = allocate_call_stack 0":
+	#instruction start "1030 = set_reg %rdi 1019":
+	#instruction start "1031 = set_reg %rsi 1022 state: 1030":
+	#instruction start "1032 = set_reg %rdx 1025 state: 1031":
+	#instruction start "1033 = set_reg %rcx 1028 state: 1032":
+	#instruction start "1034 = set_reg %rax 1016 state: 1033":
+	#instruction start "1035 = call 1015":
+	addq $0, %rsp
+	movq -956(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -948(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1036 = proj0 1035":
+	#instruction start "1037 = proj1 1035":
+	#Block jump
+	jmp .L86
+.L85:
+	#Block jump elided
+.L86:
+	#instruction start "1038 = constant(0)":
+	movl $0, %ebx
+	#instruction start "1039 = set_reg %rax 1038":
+	#instruction start "1040 = phi (region: 999) 989 1036":
+	#instruction start "1041 = return 999, 1039, 1040":
+	movq %rbx, %rax
+	#Block return.
+	movq -1572(%rbp), %rbx
+	movq -1580(%rbp), %r12
+	movq -1588(%rbp), %r13
+	movq -1596(%rbp), %r14
+	movq -1604(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls2:
+	.string "add(2.3, 4.5) < 6.9\000"
+.Ls3:
+	.string "/root/repo/tests/floating_point.c\000"
+.Ls4:
+	.string "main"
+.Ls5:
+	.string "add(2.3, 4.5) > 6.7\000"
+.Ls6:
+	.string "d >= 5.4 && d <= 5.6\000"
+.Ls7:
+	.string "ld >= 4.4 && ld <= 4.6\000"
+.Ls8:
+	.string "f >= 87 && f <= 89\000"
+.Ls9:
+	.string "integer >= 43 && integer <= 45\000"
+.Ls10:
+	.string "ul >= 999999998 && ul <= 1000000000\000"
+.Ls11:
+	.string "-f == -100.0\000"
+.Ls12:
+	.string "1 && 1\000"
+.Ls13:
+	.string "1e+6 > 999999 && 1e+6 < 1000001\000"
+.Ls14:
+	.string "1e-6 > 0.0000009 && 1e-6 < 0.0000011\000"
+.Ls15:
+	.string "1e6 > 999999 && 1e6 < 1000001\000"
+.Ls17:
+	.string "!fcmp(0.0, 1.0)\000"
+.Ls19:
+	.string "conv(-1) == (double)-1\000"
+.Ls20:
+	.string "f == -4\000"
+.Ls21:
+	.string "d == -4\000"
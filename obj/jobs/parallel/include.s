@@ -0,0 +1,51 @@
+.global func_A
+func_A:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $304, %rsp
+	movq %rdi, -304(%rbp)
+	movq %rsi, -296(%rbp)
+	movq %rdx, -288(%rbp)
+	movq %rcx, -280(%rbp)
+	movq %r8, -272(%rbp)
+	movq %r9, -264(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = return 2, -1, 3":
+	#Block return.
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -24(%rbp)
+	movq %r12, -32(%rbp)
+.L3:
+	#instruction start "9 = proj3 7":
+	#instruction start "12 = constant(0)":
+	movq $func_A, %rbx
+	#instruction start "13 = constant(0)":
+	movq $0, %r12
+	#instruction start "14 = allocate_call_stack 0":
+	#instruction start "15 = set_reg %rax 13":
+	#instruction start "16 = call 12":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "17 = proj0 16":
+	#instruction start "18 = proj1 16":
+	#instruction start "19 = constant(0)":
+	movl $0, %ebx
+	#instruction start "20 = set_reg %rax 19":
+	#instruction start "21 = return 8, 20, 17":
+	movq %rbx, %rax
+	#Block return.
+	movq -24(%rbp), %rbx
+	movq -32(%rbp), %r12
+	leave 
+	ret 
+.section .rodata
@@ -0,0 +1,666 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $592, %rsp
+	movq %rbx, -560(%rbp)
+	movq %r12, -568(%rbp)
+	movq %r13, -576(%rbp)
+	movq %r14, -584(%rbp)
+	movq %r15, -592(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(1)":
+	movl $1, %ebx
+	#instruction start "8 = if 2 6":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "11 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "12 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "13 = constant(6)":
+	movl $6, %r13d
+	#instruction start "14 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "15 = alloc with size 8":
+	leaq -376(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "16 = store 15 11, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "17 = alloc with size 8":
+	leaq -384(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "18 = store 17 12, state: 16":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "19 = alloc with size 4":
+	leaq -388(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "20 = store 19 13, state: 18":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "21 = alloc with size 8":
+	leaq -396(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "22 = store 21 14, state: 20":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "23 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "24 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "25 = load part address of 15 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "26 = proj0 25":
+	#instruction start "27 = proj1 25":
+	#instruction start "28 = load part address of 17 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "29 = proj0 28":
+	#instruction start "30 = proj1 28":
+	#instruction start "31 = load part address of 19 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "32 = proj0 31":
+	#instruction start "33 = proj1 31":
+	#instruction start "34 = load part address of 21 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "35 = proj0 34":
+	#instruction start "36 = proj1 34":
+	#instruction start "37 = allocate_call_stack 0":
+	#instruction start "38 = set_reg %rdi 27":
+	#instruction start "39 = set_reg %rsi 30 state: 38":
+	#instruction start "40 = set_reg %rdx 33 state: 39":
+	#instruction start "41 = set_reg %rcx 36 state: 40":
+	#instruction start "42 = set_reg %rax 24 state: 41":
+	#instruction start "43 = call 23":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "44 = proj0 43":
+	#instruction start "45 = proj1 43":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "46 = constant(1)":
+	movl $1, %ebx
+	#instruction start "48 = if 7 46":
+	#instruction start "56 = phi (region: 7) 3 44":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "51 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "52 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "53 = constant(7)":
+	movl $7, %r13d
+	#instruction start "54 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "55 = alloc with size 8":
+	leaq -404(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "57 = store 55 51, state: 56":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "58 = alloc with size 8":
+	leaq -412(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "59 = store 58 52, state: 57":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "60 = alloc with size 4":
+	leaq -416(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "61 = store 60 53, state: 59":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "62 = alloc with size 8":
+	leaq -424(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "63 = store 62 54, state: 61":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "64 = constant(0)":
+	leaq -64(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "65 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "66 = load part address of 55 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "67 = proj0 66":
+	#instruction start "68 = proj1 66":
+	#instruction start "69 = load part address of 58 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "70 = proj0 69":
+	#instruction start "71 = proj1 69":
+	#instruction start "72 = load part address of 60 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "73 = proj0 72":
+	#instruction start "74 = proj1 72":
+	#instruction start "75 = load part address of 62 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "76 = proj0 75":
+	#instruction start "77 = proj1 75":
+	#instruction start "78 = allocate_call_stack 0":
+	#instruction start "79 = set_reg %rdi 68":
+	#instruction start "80 = set_reg %rsi 71 state: 79":
+	#instruction start "81 = set_reg %rdx 74 state: 80":
+	#instruction start "82 = set_reg %rcx 77 state: 81":
+	#instruction start "83 = set_reg %rax 65 state: 82":
+	#instruction start "84 = call 64":
+	addq $0, %rsp
+	movq -72(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -64(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "85 = proj0 84":
+	#instruction start "86 = proj1 84":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "87 = constant(1)":
+	movl $1, %ebx
+	#instruction start "89 = if 47 87":
+	#instruction start "97 = phi (region: 47) 56 85":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "92 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "93 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "94 = constant(9)":
+	movl $9, %r13d
+	#instruction start "95 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "96 = alloc with size 8":
+	leaq -432(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "98 = store 96 92, state: 97":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "99 = alloc with size 8":
+	leaq -440(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "100 = store 99 93, state: 98":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "101 = alloc with size 4":
+	leaq -444(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "102 = store 101 94, state: 100":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "103 = alloc with size 8":
+	leaq -452(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "104 = store 103 95, state: 102":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "105 = constant(0)":
+	leaq -120(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "106 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "107 = load part address of 96 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "108 = proj0 107":
+	#instruction start "109 = proj1 107":
+	#instruction start "110 = load part address of 99 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "111 = proj0 110":
+	#instruction start "112 = proj1 110":
+	#instruction start "113 = load part address of 101 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "114 = proj0 113":
+	#instruction start "115 = proj1 113":
+	#instruction start "116 = load part address of 103 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "117 = proj0 116":
+	#instruction start "118 = proj1 116":
+	#instruction start "119 = allocate_call_stack 0":
+	#instruction start "120 = set_reg %rdi 109":
+	#instruction start "121 = set_reg %rsi 112 state: 120":
+	#instruction start "122 = set_reg %rdx 115 state: 121":
+	#instruction start "123 = set_reg %rcx 118 state: 122":
+	#instruction start "124 = set_reg %rax 106 state: 123":
+	#instruction start "125 = call 105":
+	addq $0, %rsp
+	movq -128(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -120(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "126 = proj0 125":
+	#instruction start "127 = proj1 125":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "128 = constant(1)":
+	movl $1, %ebx
+	#instruction start "130 = if 88 128":
+	#instruction start "138 = phi (region: 88) 97 126":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "133 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "134 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "135 = constant(10)":
+	movl $10, %r13d
+	#instruction start "136 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "137 = alloc with size 8":
+	leaq -460(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "139 = store 137 133, state: 138":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "140 = alloc with size 8":
+	leaq -468(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "141 = store 140 134, state: 139":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "142 = alloc with size 4":
+	leaq -472(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "143 = store 142 135, state: 141":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "144 = alloc with size 8":
+	leaq -480(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "145 = store 144 136, state: 143":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "146 = constant(0)":
+	leaq -176(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "147 = constant(0)":
+	leaq -184(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "148 = load part address of 137 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "149 = proj0 148":
+	#instruction start "150 = proj1 148":
+	#instruction start "151 = load part address of 140 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "152 = proj0 151":
+	#instruction start "153 = proj1 151":
+	#instruction start "154 = load part address of 142 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "155 = proj0 154":
+	#instruction start "156 = proj1 154":
+	#instruction start "157 = load part address of 144 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "158 = proj0 157":
+	#instruction start "159 = proj1 157":
+	#instruction start "160 = allocate_call_stack 0":
+	#instruction start "161 = set_reg %rdi 150":
+	#instruction start "162 = set_reg %rsi 153 state: 161":
+	#instruction start "163 = set_reg %rdx 156 state: 162":
+	#instruction start "164 = set_reg %rcx 159 state: 163":
+	#instruction start "165 = set_reg %rax 147 state: 164":
+	#instruction start "166 = call 146":
+	addq $0, %rsp
+	movq -184(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -176(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "167 = proj0 166":
+	#instruction start "168 = proj1 166":
+	#Block jump
+	jmp .L14
+.L13:
+	#Block jump elided
+.L14:
+	#instruction start "169 = constant(1)":
+	movl $1, %ebx
+	#instruction start "171 = if 129 169":
+	#instruction start "179 = phi (region: 129) 138 167":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#instruction start "174 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "175 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "176 = constant(4)":
+	movl $4, %r13d
+	#instruction start "177 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "178 = alloc with size 8":
+	leaq -488(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "180 = store 178 174, state: 179":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "181 = alloc with size 8":
+	leaq -496(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "182 = store 181 175, state: 180":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "183 = alloc with size 4":
+	leaq -500(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "184 = store 183 176, state: 182":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "185 = alloc with size 8":
+	leaq -508(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "186 = store 185 177, state: 184":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "187 = constant(0)":
+	leaq -232(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "188 = constant(0)":
+	leaq -240(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "189 = load part address of 178 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "190 = proj0 189":
+	#instruction start "191 = proj1 189":
+	#instruction start "192 = load part address of 181 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "193 = proj0 192":
+	#instruction start "194 = proj1 192":
+	#instruction start "195 = load part address of 183 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "196 = proj0 195":
+	#instruction start "197 = proj1 195":
+	#instruction start "198 = load part address of 185 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "199 = proj0 198":
+	#instruction start "200 = proj1 198":
+	#instruction start "201 = allocate_call_stack 0":
+	#instruction start "202 = set_reg %rdi 191":
+	#instruction start "203 = set_reg %rsi 194 state: 202":
+	#instruction start "204 = set_reg %rdx 197 state: 203":
+	#instruction start "205 = set_reg %rcx 200 state: 204":
+	#instruction start "206 = set_reg %rax 188 state: 205":
+	#instruction start "207 = call 187":
+	addq $0, %rsp
+	movq -240(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -232(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "208 = proj0 207":
+	#instruction start "209 = proj1 207":
+	#Block jump
+	jmp .L17
+.L16:
+	#Block jump elided
+.L17:
+	#instruction start "210 = constant(9)":
+	movq $.Ls9, %rbx
+	#instruction start "211 = constant(9)":
+	movq $.Ls9, %r12
+	#instruction start "212 = alloc with size 8":
+	leaq -516(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "213 = phi (region: 170) 179 208":
+	#instruction start "214 = store 212 210, state: 213":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "215 = alloc with size 8":
+	leaq -524(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "216 = store 215 211, state: 214":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "217 = constant(8)":
+	movq $strcmp, %r12
+	#instruction start "218 = constant(0)":
+	movq $0, %r14
+	#instruction start "219 = load part address of 212 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "220 = proj0 219":
+	#instruction start "221 = proj1 219":
+	#instruction start "222 = load part address of 215 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "223 = proj0 222":
+	#instruction start "224 = proj1 222":
+	#instruction start "225 = allocate_call_stack 0":
+	#instruction start "226 = set_reg %rdi 221":
+	#instruction start "227 = set_reg %rsi 224 state: 226":
+	#instruction start "228 = set_reg %rax 218 state: 227":
+	#instruction start "229 = call 217":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "230 = proj0 229":
+	#instruction start "231 = proj1 229":
+	#instruction start "232 = %rax":
+	#instruction start "233 = int_cast_zero 232":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "234 = constant(0)":
+	movl $0, %ebx
+	#instruction start "235 = 233 == 234":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "237 = if 170 235":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "240 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "241 = constant(9)":
+	movq $.Ls9, %r12
+	#instruction start "242 = constant(4)":
+	movl $4, %r13d
+	#instruction start "243 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "244 = alloc with size 8":
+	leaq -532(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "245 = store 244 240, state: 230":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "246 = alloc with size 8":
+	leaq -540(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "247 = store 246 241, state: 245":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "248 = alloc with size 4":
+	leaq -544(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "249 = store 248 242, state: 247":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "250 = alloc with size 8":
+	leaq -552(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "251 = store 250 243, state: 249":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "252 = constant(0)":
+	leaq -312(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "253 = constant(0)":
+	leaq -320(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "254 = load part address of 244 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "255 = proj0 254":
+	#instruction start "256 = proj1 254":
+	#instruction start "257 = load part address of 246 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "258 = proj0 257":
+	#instruction start "259 = proj1 257":
+	#instruction start "260 = load part address of 248 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "261 = proj0 260":
+	#instruction start "262 = proj1 260":
+	#instruction start "263 = load part address of 250 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "264 = proj0 263":
+	#instruction start "265 = proj1 263":
+	#instruction start "266 = allocate_call_stack 0":
+	#instruction start "267 = set_reg %rdi 256":
+	#instruction start "268 = set_reg %rsi 259 state: 267":
+	#instruction start "269 = set_reg %rdx 262 state: 268":
+	#instruction start "270 = set_reg %rcx 265 state: 269":
+	#instruction start "271 = set_reg %rax 253 state: 270":
+	#instruction start "272 = call 252":
+	addq $0, %rsp
+	movq -320(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -312(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "273 = proj0 272":
+	#instruction start "274 = proj1 272":
+	#Block jump
+	jmp .L20
+.L19:
+	#Block jump elided
+.L20:
+	#instruction start "275 = constant(0)":
+	movl $0, %ebx
+	#instruction start "276 = set_reg %rax 275":
+	#instruction start "277 = phi (region: 236) 230 273":
+	#instruction start "278 = return 236, 276, 277":
+	movq %rbx, %rax
+	#Block return.
+	movq -560(%rbp), %rbx
+	movq -568(%rbp), %r12
+	movq -576(%rbp), %r13
+	movq -584(%rbp), %r14
+	movq -592(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "__LINE__ == 6\000"
+.Ls2:
+	.string "/root/repo/tests/line.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "MACRO == 7\000"
+.Ls5:
+	.string "FUNC_MACRO(MACRO, MACRO) == 18\000"
+.Ls6:
+	.string "FUNC_MACRO(MACRO, MACRO) == 21\000"
+.Ls7:
+	.string "__LINE__ == 4\000"
+.Ls9:
+	.string "notline.c\000"
+.Ls10:
+	.string "strcmp(__FILE__, \"notline.c\") == 0\000"
@@ -0,0 +1,57 @@
+.global function
+function:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rbx, -16(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(100)":
+	movl $100, %ebx
+	#instruction start "7 = set_reg %rax 6":
+	#instruction start "8 = return 2, 7, 3":
+	movq %rbx, %rax
+	#Block return.
+	movq -16(%rbp), %rbx
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $336, %rsp
+	movq %rbx, -328(%rbp)
+	movq %r12, -336(%rbp)
+	movq %rdi, -320(%rbp)
+	movq %rsi, -312(%rbp)
+	movq %rdx, -304(%rbp)
+	movq %rcx, -296(%rbp)
+	movq %r8, -288(%rbp)
+	movq %r9, -280(%rbp)
+.L3:
+	#instruction start "12 = proj3 10":
+	#instruction start "15 = constant(0)":
+	movq $function, %rbx
+	#instruction start "16 = constant(0)":
+	movq $0, %r12
+	#instruction start "17 = allocate_call_stack 0":
+	#instruction start "18 = set_reg %rax 16":
+	#instruction start "19 = call 15":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "20 = proj0 19":
+	#instruction start "21 = proj1 19":
+	#instruction start "24 = constant(0)":
+	movl $0, %ebx
+	#instruction start "25 = set_reg %rax 24":
+	#instruction start "26 = return 11, 25, 20":
+	movq %rbx, %rax
+	#Block return.
+	movq -328(%rbp), %rbx
+	movq -336(%rbp), %r12
+	leave 
+	ret 
+.section .rodata
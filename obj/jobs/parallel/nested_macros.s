@@ -0,0 +1,408 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $320, %rsp
+	movq %rbx, -280(%rbp)
+	movq %r12, -288(%rbp)
+	movq %r13, -296(%rbp)
+	movq %r14, -304(%rbp)
+	movq %r15, -312(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(1)":
+	movl $1, %ebx
+	#instruction start "8 = if 2 6":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "11 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "12 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "13 = constant(84)":
+	movl $84, %r13d
+	#instruction start "14 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "15 = alloc with size 8":
+	leaq -184(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "16 = store 15 11, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "17 = alloc with size 8":
+	leaq -192(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "18 = store 17 12, state: 16":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "19 = alloc with size 4":
+	leaq -196(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "20 = store 19 13, state: 18":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "21 = alloc with size 8":
+	leaq -204(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "22 = store 21 14, state: 20":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "23 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "24 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "25 = load part address of 15 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "26 = proj0 25":
+	#instruction start "27 = proj1 25":
+	#instruction start "28 = load part address of 17 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "29 = proj0 28":
+	#instruction start "30 = proj1 28":
+	#instruction start "31 = load part address of 19 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "32 = proj0 31":
+	#instruction start "33 = proj1 31":
+	#instruction start "34 = load part address of 21 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "35 = proj0 34":
+	#instruction start "36 = proj1 34":
+	#instruction start "37 = allocate_call_stack 0":
+	#instruction start "38 = set_reg %rdi 27":
+	#instruction start "39 = set_reg %rsi 30 state: 38":
+	#instruction start "40 = set_reg %rdx 33 state: 39":
+	#instruction start "41 = set_reg %rcx 36 state: 40":
+	#instruction start "42 = set_reg %rax 24 state: 41":
+	#instruction start "43 = call 23":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "44 = proj0 43":
+	#instruction start "45 = proj1 43":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "46 = constant(1)":
+	movl $1, %ebx
+	#instruction start "48 = if 7 46":
+	#instruction start "56 = phi (region: 7) 3 44":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "51 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "52 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "53 = constant(85)":
+	movl $85, %r13d
+	#instruction start "54 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "55 = alloc with size 8":
+	leaq -212(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "57 = store 55 51, state: 56":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "58 = alloc with size 8":
+	leaq -220(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "59 = store 58 52, state: 57":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "60 = alloc with size 4":
+	leaq -224(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "61 = store 60 53, state: 59":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "62 = alloc with size 8":
+	leaq -232(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "63 = store 62 54, state: 61":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "64 = constant(0)":
+	leaq -64(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "65 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "66 = load part address of 55 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "67 = proj0 66":
+	#instruction start "68 = proj1 66":
+	#instruction start "69 = load part address of 58 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "70 = proj0 69":
+	#instruction start "71 = proj1 69":
+	#instruction start "72 = load part address of 60 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "73 = proj0 72":
+	#instruction start "74 = proj1 72":
+	#instruction start "75 = load part address of 62 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "76 = proj0 75":
+	#instruction start "77 = proj1 75":
+	#instruction start "78 = allocate_call_stack 0":
+	#instruction start "79 = set_reg %rdi 68":
+	#instruction start "80 = set_reg %rsi 71 state: 79":
+	#instruction start "81 = set_reg %rdx 74 state: 80":
+	#instruction start "82 = set_reg %rcx 77 state: 81":
+	#instruction start "83 = set_reg %rax 65 state: 82":
+	#instruction start "84 = call 64":
+	addq $0, %rsp
+	movq -72(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -64(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "85 = proj0 84":
+	#instruction start "86 = proj1 84":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "88 = phi (region: 47) 56 85":
+	#instruction start "90 = constant(0)":
+	movl $0, %ebx
+	#instruction start "96 = constant(0)":
+	movl $0, %r12d
+	#instruction start "97 = 90 == 96":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "98 = if 47 97":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "115 = alloc with size 4":
+	leaq -236(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "116 = constant(0)":
+	movl $0, %r13d
+	#instruction start "117 = store 115 116, state: 88":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 119 (118 114 115)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L14
+.L10:
+	#instruction start "93 = constant(1)":
+	movl $1, %r12d
+	#instruction start "94 = 90 + 93":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "102 = constant(1)":
+	movl $1, %ebx
+	#instruction start "103 = 94 == 102":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "104 = if 100 103":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L12
+.L11:
+	#instruction start "110 = alloc with size 4":
+	leaq -240(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "111 = constant(0)":
+	movl $0, %r12d
+	#instruction start "112 = store 110 111, state: 88":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 114 (113 107 110)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L13
+.L12:
+	#instruction start "107 = alloc with size 4":
+	leaq -244(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "108 = constant(1)":
+	movl $1, %r14d
+	#instruction start "109 = store 107 108, state: 88":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 114 (113 107 110)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L13:
+	#instruction start "114 = phi (region: 113) 107 110":
+	#instruction start "121 = phi (region: 113) 109 112":
+	#Phi node to 119 (118 114 115)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L14:
+	#instruction start "119 = phi (region: 118) 114 115":
+	#instruction start "120 = phi (region: 118) 121 117":
+	#instruction start "122 = load_volatile 119, state: 120":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "123 = proj0 122":
+	#instruction start "124 = proj1 122":
+	#instruction start "126 = if 118 124":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#instruction start "129 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "130 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "131 = constant(88)":
+	movl $88, %r13d
+	#instruction start "132 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "133 = alloc with size 8":
+	leaq -252(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "134 = store 133 129, state: 123":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "135 = alloc with size 8":
+	leaq -260(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "136 = store 135 130, state: 134":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "137 = alloc with size 4":
+	leaq -264(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "138 = store 137 131, state: 136":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "139 = alloc with size 8":
+	leaq -272(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "140 = store 139 132, state: 138":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "141 = constant(0)":
+	leaq -120(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "142 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "143 = load part address of 133 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "144 = proj0 143":
+	#instruction start "145 = proj1 143":
+	#instruction start "146 = load part address of 135 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "147 = proj0 146":
+	#instruction start "148 = proj1 146":
+	#instruction start "149 = load part address of 137 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "150 = proj0 149":
+	#instruction start "151 = proj1 149":
+	#instruction start "152 = load part address of 139 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "153 = proj0 152":
+	#instruction start "154 = proj1 152":
+	#instruction start "155 = allocate_call_stack 0":
+	#instruction start "156 = set_reg %rdi 145":
+	#instruction start "157 = set_reg %rsi 148 state: 156":
+	#instruction start "158 = set_reg %rdx 151 state: 157":
+	#instruction start "159 = set_reg %rcx 154 state: 158":
+	#instruction start "160 = set_reg %rax 142 state: 159":
+	#instruction start "161 = call 141":
+	addq $0, %rsp
+	movq -128(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -120(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "162 = proj0 161":
+	#instruction start "163 = proj1 161":
+	#Block jump
+	jmp .L17
+.L16:
+	#Block jump elided
+.L17:
+	#instruction start "164 = constant(0)":
+	movl $0, %ebx
+	#instruction start "165 = set_reg %rax 164":
+	#instruction start "166 = phi (region: 125) 123 162":
+	#instruction start "167 = return 125, 165, 166":
+	movq %rbx, %rax
+	#Block return.
+	movq -280(%rbp), %rbx
+	movq -288(%rbp), %r12
+	movq -296(%rbp), %r13
+	movq -304(%rbp), %r14
+	movq -312(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "NESTED(7) == 7\000"
+.Ls2:
+	.string "/root/repo/tests/nested_macros.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "MAX(MAX(1, 4), MAX(3, 2)) == 4\000"
+.Ls5:
+	.string "TWICE(i++) == 0 && i == 1\000"
@@ -0,0 +1,52 @@
+.global func_A
+func_A:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $304, %rsp
+	movq %rdi, -304(%rbp)
+	movq %rsi, -296(%rbp)
+	movq %rdx, -288(%rbp)
+	movq %rcx, -280(%rbp)
+	movq %r8, -272(%rbp)
+	movq %r9, -264(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = return 2, -1, 3":
+	#Block return.
+	leave 
+	ret 
+.global func_B
+func_B:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $304, %rsp
+	movq %rdi, -304(%rbp)
+	movq %rsi, -296(%rbp)
+	movq %rdx, -288(%rbp)
+	movq %rcx, -280(%rbp)
+	movq %r8, -272(%rbp)
+	movq %r9, -264(%rbp)
+.L3:
+	#instruction start "9 = proj3 7":
+	#instruction start "12 = return 8, -1, 9":
+	#Block return.
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rbx, -16(%rbp)
+.L4:
+	#instruction start "15 = proj3 13":
+	#instruction start "18 = constant(0)":
+	movl $0, %ebx
+	#instruction start "19 = set_reg %rax 18":
+	#instruction start "20 = return 14, 19, 15":
+	movq %rbx, %rax
+	#Block return.
+	movq -16(%rbp), %rbx
+	leave 
+	ret 
+.section .rodata
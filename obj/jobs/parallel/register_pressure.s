@@ -0,0 +1,1289 @@
+identity:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movl %edi, %ebx
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "8 = store part of 7 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "9 = load 7, state: 8":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "10 = set_reg %rax 9":
+	#instruction start "11 = return 2, 10, 8":
+	movq %rbx, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	leave 
+	ret 
+sum_live:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $176, %rsp
+	movq %rbx, -140(%rbp)
+	movq %r12, -148(%rbp)
+	movq %r13, -156(%rbp)
+	movq %r14, -164(%rbp)
+	movq %r15, -172(%rbp)
+	movq %rdi, %rbx
+.L3:
+	#instruction start "15 = proj3 13":
+	#instruction start "16 = proj1 13":
+	#instruction start "18 = %rdi":
+	#instruction start "19 = alloc with size 8":
+	leaq -128(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "20 = store part of 19 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "23 = load 19, state: 20":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "24 = constant(1)":
+	movq $1, %r13
+	#instruction start "25 = 23 + 24":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	#instruction start "29 = load 19, state: 20":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "30 = constant(2)":
+	movq $2, %r13
+	#instruction start "31 = 29 * 30 (signed)":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	imulq %rcx, %rax
+	movq %rax, -16(%rbp)
+	#instruction start "35 = load 19, state: 20":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "36 = constant(3)":
+	movq $3, %r13
+	#instruction start "37 = 35 - 36":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	subq %rcx, %rax
+	movq %rax, -24(%rbp)
+	#instruction start "41 = load 19, state: 20":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "42 = constant(4)":
+	movq $4, %r13
+	#instruction start "43 = 41 ^ 42":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	xorq %rcx, %rax
+	movq %rax, -32(%rbp)
+	#instruction start "47 = load 19, state: 20":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "48 = constant(5)":
+	movq $5, %r13
+	#instruction start "49 = 47 + 48":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, -40(%rbp)
+	#instruction start "53 = load 19, state: 20":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "54 = constant(6)":
+	movq $6, %r13
+	#instruction start "55 = 53 * 54 (signed)":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	imulq %rcx, %rax
+	movq %rax, -48(%rbp)
+	#instruction start "59 = load 19, state: 20":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "60 = constant(7)":
+	movq $7, %r13
+	#instruction start "61 = 59 - 60":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	subq %rcx, %rax
+	movq %rax, -56(%rbp)
+	#instruction start "65 = load 19, state: 20":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "66 = constant(8)":
+	movq $8, %r13
+	#instruction start "67 = 65 ^ 66":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	xorq %rcx, %rax
+	movq %rax, -64(%rbp)
+	#instruction start "71 = load 19, state: 20":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "72 = constant(9)":
+	movq $9, %r13
+	#instruction start "73 = 71 + 72":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, -72(%rbp)
+	#instruction start "77 = load 19, state: 20":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "78 = constant(10)":
+	movq $10, %r13
+	#instruction start "79 = 77 * 78 (signed)":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	imulq %rcx, %rax
+	movq %rax, -80(%rbp)
+	#instruction start "83 = load 19, state: 20":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "84 = constant(11)":
+	movq $11, %r13
+	#instruction start "85 = 83 - 84":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	subq %rcx, %rax
+	movq %rax, -88(%rbp)
+	#instruction start "89 = load 19, state: 20":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "90 = constant(12)":
+	movq $12, %r13
+	#instruction start "91 = 89 ^ 90":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	xorq %rcx, %rax
+	movq %rax, -96(%rbp)
+	#instruction start "93 = load 19, state: 20":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "94 = int_cast_zero 93":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "95 = alloc with size 4":
+	leaq -132(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "96 = store 95 94, state: 20":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "97 = constant(0)":
+	movq $identity, %r13
+	#instruction start "98 = constant(0)":
+	movq $0, %r14
+	#instruction start "99 = load part address of 95 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r15d
+	#instruction start "100 = proj0 99":
+	#instruction start "101 = proj1 99":
+	#instruction start "102 = allocate_call_stack 0":
+	#instruction start "103 = set_reg %rdi 101":
+	#instruction start "104 = set_reg %rax 98 state: 103":
+	#instruction start "105 = call 97":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r15, %rdi
+	movq %r13, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "106 = proj0 105":
+	#instruction start "107 = proj1 105":
+	#instruction start "108 = %rax":
+	#instruction start "109 = int_cast_zero 108":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "110 = int_cast_zero 109":
+	movq %r13, %rax
+	movslq %eax, %rax
+	movq %rax, %rbx
+	#instruction start "111 = store 19 110, state: 106":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "114 = 25 + 31":
+	movq -8(%rbp), %rax
+	movq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "116 = 114 + 37":
+	movq %rbx, %rax
+	movq -24(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "118 = 116 + 43":
+	movq %r13, %rax
+	movq -32(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "120 = 118 + 49":
+	movq %rbx, %rax
+	movq -40(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "122 = 120 + 55":
+	movq %r13, %rax
+	movq -48(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "124 = 122 + 61":
+	movq %rbx, %rax
+	movq -56(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "126 = 124 + 67":
+	movq %r13, %rax
+	movq -64(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "128 = 126 + 73":
+	movq %rbx, %rax
+	movq -72(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "130 = 128 + 79":
+	movq %r13, %rax
+	movq -80(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "132 = 130 + 85":
+	movq %rbx, %rax
+	movq -88(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "134 = 132 + 91":
+	movq %r13, %rax
+	movq -96(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "135 = load 19, state: 111":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "136 = 134 + 135":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "137 = set_reg %rax 136":
+	#instruction start "138 = return 14, 137, 111":
+	movq %r12, %rax
+	#Block return.
+	movq -140(%rbp), %rbx
+	movq -148(%rbp), %r12
+	movq -156(%rbp), %r13
+	movq -164(%rbp), %r14
+	movq -172(%rbp), %r15
+	leave 
+	ret 
+loop_live:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $176, %rsp
+	movq %rbx, -144(%rbp)
+	movq %r12, -152(%rbp)
+	movq %r13, -160(%rbp)
+	movq %r14, -168(%rbp)
+	movq %r15, -176(%rbp)
+	movl %edi, %ebx
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "142 = proj3 140":
+	#instruction start "143 = proj1 140":
+	#instruction start "145 = %rdi":
+	#instruction start "146 = alloc with size 4":
+	leaq -132(%rbp), %rsi
+	movq %rsi, -8(%rbp)
+	#instruction start "147 = store part of 146 with offset 0":
+	movq -8(%rbp), %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "150 = constant(0)":
+	leaq -12(%rbp), %rdi
+	movl $0, (%rdi)
+	#instruction start "154 = constant(1)":
+	leaq -16(%rbp), %rdi
+	movl $1, (%rdi)
+	#instruction start "158 = constant(2)":
+	leaq -20(%rbp), %rdi
+	movl $2, (%rdi)
+	#instruction start "162 = constant(3)":
+	leaq -24(%rbp), %rdi
+	movl $3, (%rdi)
+	#instruction start "166 = constant(4)":
+	leaq -28(%rbp), %rdi
+	movl $4, (%rdi)
+	#instruction start "170 = constant(5)":
+	leaq -32(%rbp), %rdi
+	movl $5, (%rdi)
+	#instruction start "174 = constant(6)":
+	leaq -36(%rbp), %rdi
+	movl $6, (%rdi)
+	#instruction start "178 = constant(7)":
+	leaq -40(%rbp), %rdi
+	movl $7, (%rdi)
+	#instruction start "185 = alloc with size 4":
+	leaq -136(%rbp), %rsi
+	movq %rsi, -48(%rbp)
+	#instruction start "187 = set_zero_ptr 185, size: 4":
+	movq -48(%rbp), %rdi
+	movl $0, (%rdi)
+	#instruction start "188 = constant(0)":
+	movl $0, %ebx
+	#instruction start "189 = store 185 188, state: 187":
+	movq -48(%rbp), %rsi
+	movl %ebx, (%rsi)
+	#Phi node to 566 (181 150 205)
+	movl -12(%rbp), %eax
+	movl %eax, -52(%rbp)
+	#Phi node to 571 (181 154 209)
+	movl -16(%rbp), %eax
+	movl %eax, -56(%rbp)
+	#Phi node to 576 (181 158 213)
+	movl -20(%rbp), %eax
+	movl %eax, -60(%rbp)
+	#Phi node to 581 (181 162 217)
+	movl -24(%rbp), %eax
+	movl %eax, -64(%rbp)
+	#Phi node to 586 (181 166 221)
+	movl -28(%rbp), %eax
+	movl %eax, -68(%rbp)
+	#Phi node to 591 (181 170 225)
+	movl -32(%rbp), %eax
+	movl %eax, -72(%rbp)
+	#Phi node to 596 (181 174 229)
+	movl -36(%rbp), %eax
+	movl %eax, -76(%rbp)
+	#Phi node to 601 (181 178 245)
+	movl -40(%rbp), %eax
+	movl %eax, -80(%rbp)
+	#Block jump elided
+.L6:
+	#instruction start "190 = phi (region: 181) 189 201":
+	#instruction start "191 = load 185, state: 190":
+	movq -48(%rbp), %rdi
+	movl (%rdi), %r12d
+	#instruction start "192 = load 146, state: 190":
+	movq -8(%rbp), %rdi
+	movl (%rdi), %r15d
+	#instruction start "193 = 191 < 192 (signed)":
+	movq %r12, %rax
+	movq %r15, %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "194 = if 181 193":
+	#instruction start "566 = phi (region: 181) 150 205":
+	#instruction start "571 = phi (region: 181) 154 209":
+	#instruction start "576 = phi (region: 181) 158 213":
+	#instruction start "581 = phi (region: 181) 162 217":
+	#instruction start "586 = phi (region: 181) 166 221":
+	#instruction start "591 = phi (region: 181) 170 225":
+	#instruction start "596 = phi (region: 181) 174 229":
+	#instruction start "601 = phi (region: 181) 178 245":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L9
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "250 = 566 ^ 571":
+	movl -52(%rbp), %eax
+	movl -56(%rbp), %ecx
+	xorl %ecx, %eax
+	movl %eax, %r12d
+	#instruction start "252 = 250 ^ 576":
+	movq %r12, %rax
+	movl -60(%rbp), %ecx
+	xorl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "254 = 252 ^ 581":
+	movq %r13, %rax
+	movl -64(%rbp), %ecx
+	xorl %ecx, %eax
+	movl %eax, %r12d
+	#instruction start "256 = 254 ^ 586":
+	movq %r12, %rax
+	movl -68(%rbp), %ecx
+	xorl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "258 = 256 ^ 591":
+	movq %r13, %rax
+	movl -72(%rbp), %ecx
+	xorl %ecx, %eax
+	movl %eax, %r12d
+	#instruction start "260 = 258 ^ 596":
+	movq %r12, %rax
+	movl -76(%rbp), %ecx
+	xorl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "262 = 260 ^ 601":
+	movq %r13, %rax
+	movl -80(%rbp), %ecx
+	xorl %ecx, %eax
+	movl %eax, %r12d
+	#instruction start "263 = set_reg %rax 262":
+	#instruction start "264 = return 184, 263, 190":
+	movq %r12, %rax
+	#Block return.
+	movq -144(%rbp), %rbx
+	movq -152(%rbp), %r12
+	movq -160(%rbp), %r13
+	movq -168(%rbp), %r14
+	movq -176(%rbp), %r15
+	leave 
+	ret 
+.L9:
+	#Block jump elided
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "231 = constant(0)":
+	movq $identity, %r12
+	#instruction start "233 = load part address of 185 with offset 0":
+	movq -48(%rbp), %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r13d
+	#instruction start "234 = proj0 233":
+	#instruction start "232 = constant(0)":
+	movq $0, %r15
+	#instruction start "235 = proj1 233":
+	#instruction start "237 = set_reg %rdi 235":
+	#instruction start "238 = set_reg %rax 232 state: 237":
+	#instruction start "236 = allocate_call_stack 0":
+	#instruction start "239 = call 231":
+	addq $0, %rsp
+	movq %r15, %rax
+	movq %r13, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, -128(%rbp)
+	#instruction start "240 = proj0 239":
+	#instruction start "198 = load 185, state: 240":
+	movq -48(%rbp), %rdi
+	movl (%rdi), %r12d
+	#instruction start "199 = constant(1)":
+	movl $1, %r13d
+	#instruction start "200 = 198 + 199":
+	movq %r12, %rax
+	movq %r13, %rcx
+	addl %ecx, %eax
+	movl %eax, %r15d
+	#instruction start "201 = store 185 200, state: 240":
+	movq -48(%rbp), %rsi
+	movl %r15d, (%rsi)
+	#instruction start "205 = 566 + 571":
+	movl -52(%rbp), %eax
+	movl -56(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, -108(%rbp)
+	#instruction start "209 = 571 + 576":
+	movl -56(%rbp), %eax
+	movl -60(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, -112(%rbp)
+	#instruction start "213 = 576 + 581":
+	movl -60(%rbp), %eax
+	movl -64(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, -116(%rbp)
+	#instruction start "217 = 581 + 586":
+	movl -64(%rbp), %eax
+	movl -68(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, -120(%rbp)
+	#instruction start "221 = 586 + 591":
+	movl -68(%rbp), %eax
+	movl -72(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "225 = 591 + 596":
+	movl -72(%rbp), %eax
+	movl -76(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, %r12d
+	#instruction start "229 = 596 + 601":
+	movl -76(%rbp), %eax
+	movl -80(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "241 = proj1 239":
+	#instruction start "242 = %rax":
+	#instruction start "243 = int_cast_zero 242":
+	movq -128(%rbp), %rax
+	movl %eax, %r15d
+	#instruction start "245 = 601 + 243":
+	movl -80(%rbp), %eax
+	movq %r15, %rcx
+	addl %ecx, %eax
+	movl %eax, %r14d
+	#Phi node to 566 (181 150 205)
+	movl -108(%rbp), %eax
+	movl %eax, -52(%rbp)
+	#Phi node to 571 (181 154 209)
+	movl -112(%rbp), %eax
+	movl %eax, -56(%rbp)
+	#Phi node to 576 (181 158 213)
+	movl -116(%rbp), %eax
+	movl %eax, -60(%rbp)
+	#Phi node to 581 (181 162 217)
+	movl -120(%rbp), %eax
+	movl %eax, -64(%rbp)
+	#Phi node to 586 (181 166 221)
+	movq %rbx, %rax
+	movl %eax, -68(%rbp)
+	#Phi node to 591 (181 170 225)
+	movq %r12, %rax
+	movl %eax, -72(%rbp)
+	#Phi node to 596 (181 174 229)
+	movq %r13, %rax
+	movl %eax, -76(%rbp)
+	#Phi node to 601 (181 178 245)
+	movq %r14, %rax
+	movl %eax, -80(%rbp)
+	#Block jump
+	jmp .L6
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $352, %rsp
+	movq %rbx, -312(%rbp)
+	movq %r12, -320(%rbp)
+	movq %r13, -328(%rbp)
+	movq %r14, -336(%rbp)
+	movq %r15, -344(%rbp)
+.L12:
+	#Block jump elided
+.L13:
+	#instruction start "268 = proj3 266":
+	#instruction start "276 = alloc with size 8":
+	leaq -244(%rbp), %rsi
+	movq %rsi, -8(%rbp)
+	#instruction start "278 = set_zero_ptr 276, size: 8":
+	movq -8(%rbp), %rdi
+	movq $0, (%rdi)
+	#instruction start "279 = constant(-20)":
+	movq $-20, %r12
+	#instruction start "280 = store 276 279, state: 278":
+	movq -8(%rbp), %rsi
+	movq %r12, (%rsi)
+	#Block jump elided
+.L14:
+	#instruction start "281 = phi (region: 272) 280 292":
+	#instruction start "282 = load 276, state: 281":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %r12
+	#instruction start "283 = constant(20)":
+	movq $20, %r13
+	#instruction start "284 = 282 <= 283 (signed)":
+	movq %r12, %rax
+	movq %r13, %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "285 = if 272 284":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L27
+.L15:
+	#Block jump elided
+.L16:
+	#Block jump elided
+.L17:
+	#instruction start "403 = constant(0)":
+	leaq -12(%rbp), %rdi
+	movl $0, (%rdi)
+	#instruction start "407 = constant(1)":
+	leaq -16(%rbp), %rdi
+	movl $1, (%rdi)
+	#instruction start "411 = constant(2)":
+	leaq -20(%rbp), %rdi
+	movl $2, (%rdi)
+	#instruction start "415 = constant(3)":
+	leaq -24(%rbp), %rdi
+	movl $3, (%rdi)
+	#instruction start "419 = constant(4)":
+	leaq -28(%rbp), %rdi
+	movl $4, (%rdi)
+	#instruction start "423 = constant(5)":
+	leaq -32(%rbp), %rdi
+	movl $5, (%rdi)
+	#instruction start "427 = constant(6)":
+	movl $6, %r13d
+	#instruction start "431 = constant(7)":
+	movl $7, %r14d
+	#instruction start "441 = constant(0)":
+	movl $0, %r15d
+	#Phi node to 606 (434 403 458)
+	movl -12(%rbp), %eax
+	movl %eax, -40(%rbp)
+	#Phi node to 611 (434 407 462)
+	movl -16(%rbp), %eax
+	movl %eax, -44(%rbp)
+	#Phi node to 616 (434 411 466)
+	movl -20(%rbp), %eax
+	movl %eax, -48(%rbp)
+	#Phi node to 621 (434 415 470)
+	movl -24(%rbp), %eax
+	movl %eax, -52(%rbp)
+	#Phi node to 626 (434 419 474)
+	movl -28(%rbp), %eax
+	movl %eax, -56(%rbp)
+	#Phi node to 631 (434 423 478)
+	movl -32(%rbp), %eax
+	movl %eax, -60(%rbp)
+	#Phi node to 636 (434 427 482)
+	movq %r13, %rax
+	movl %eax, -64(%rbp)
+	#Phi node to 641 (434 431 486)
+	movq %r14, %rax
+	movl %eax, -68(%rbp)
+	#Phi node to 645 (434 441 453)
+	movq %r15, %rax
+	movl %eax, -36(%rbp)
+	#Block jump elided
+.L18:
+	#instruction start "443 = phi (region: 434) 281 443":
+	#instruction start "445 = constant(10)":
+	movl $10, %r13d
+	#instruction start "645 = phi (region: 434) 441 453":
+	#instruction start "446 = 645 < 445 (signed)":
+	movl -36(%rbp), %eax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "447 = if 434 446":
+	#instruction start "606 = phi (region: 434) 403 458":
+	#instruction start "611 = phi (region: 434) 407 462":
+	#instruction start "616 = phi (region: 434) 411 466":
+	#instruction start "621 = phi (region: 434) 415 470":
+	#instruction start "626 = phi (region: 434) 419 474":
+	#instruction start "631 = phi (region: 434) 423 478":
+	#instruction start "636 = phi (region: 434) 427 482":
+	#instruction start "641 = phi (region: 434) 431 486":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L24
+.L19:
+	#Block jump elided
+.L20:
+	#instruction start "488 = alloc with size 4":
+	leaq -248(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "489 = constant(10)":
+	movl $10, %r14d
+	#instruction start "491 = store 488 489, state: 443":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "492 = constant(6)":
+	movq $loop_live, %r14
+	#instruction start "493 = constant(0)":
+	movq $0, %r15
+	#instruction start "494 = load part address of 488 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "495 = proj0 494":
+	#instruction start "496 = proj1 494":
+	#instruction start "497 = allocate_call_stack 0":
+	#instruction start "498 = set_reg %rdi 496":
+	#instruction start "499 = set_reg %rax 493 state: 498":
+	#instruction start "500 = call 492":
+	addq $0, %rsp
+	movq %r15, %rax
+	movq %rbx, %rdi
+	movq %r14, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "501 = proj0 500":
+	#instruction start "502 = proj1 500":
+	#instruction start "503 = %rax":
+	#instruction start "504 = int_cast_zero 503":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "507 = 606 ^ 611":
+	movl -40(%rbp), %eax
+	movl -44(%rbp), %ecx
+	xorl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "509 = 507 ^ 616":
+	movq %r13, %rax
+	movl -48(%rbp), %ecx
+	xorl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "511 = 509 ^ 621":
+	movq %r14, %rax
+	movl -52(%rbp), %ecx
+	xorl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "513 = 511 ^ 626":
+	movq %r13, %rax
+	movl -56(%rbp), %ecx
+	xorl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "515 = 513 ^ 631":
+	movq %r14, %rax
+	movl -60(%rbp), %ecx
+	xorl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "517 = 515 ^ 636":
+	movq %r13, %rax
+	movl -64(%rbp), %ecx
+	xorl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "519 = 517 ^ 641":
+	movq %r14, %rax
+	movl -68(%rbp), %ecx
+	xorl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "520 = 504 == 519":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "522 = if 437 520":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "525 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "526 = constant(4)":
+	movq $.Ls4, %r13
+	#instruction start "527 = constant(42)":
+	movl $42, %r14d
+	#instruction start "528 = constant(5)":
+	movq $.Ls5, %r15
+	#instruction start "529 = alloc with size 8":
+	leaq -256(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "530 = store 529 525, state: 501":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "531 = alloc with size 8":
+	leaq -264(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "532 = store 531 526, state: 530":
+	movq %rbx, %rsi
+	movq %r13, (%rsi)
+	#instruction start "533 = alloc with size 4":
+	leaq -268(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "534 = store 533 527, state: 532":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "535 = alloc with size 8":
+	leaq -276(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "536 = store 535 528, state: 534":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "537 = constant(2)":
+	leaq -92(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "538 = constant(0)":
+	leaq -100(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "539 = load part address of 529 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "540 = proj0 539":
+	#instruction start "541 = proj1 539":
+	#instruction start "542 = load part address of 531 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "543 = proj0 542":
+	#instruction start "544 = proj1 542":
+	#instruction start "545 = load part address of 533 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "546 = proj0 545":
+	#instruction start "547 = proj1 545":
+	#instruction start "548 = load part address of 535 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "549 = proj0 548":
+	#instruction start "550 = proj1 548":
+	#instruction start "551 = allocate_call_stack 0":
+	#instruction start "552 = set_reg %rdi 541":
+	#instruction start "553 = set_reg %rsi 544 state: 552":
+	#instruction start "554 = set_reg %rdx 547 state: 553":
+	#instruction start "555 = set_reg %rcx 550 state: 554":
+	#instruction start "556 = set_reg %rax 538 state: 555":
+	#instruction start "557 = call 537":
+	addq $0, %rsp
+	movq -100(%rbp), %rax
+	movq %r13, %rcx
+	movq %rbx, %rdx
+	movq %r12, %rsi
+	movq %r15, %rdi
+	movq -92(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "558 = proj0 557":
+	#instruction start "559 = proj1 557":
+	#Block jump
+	jmp .L23
+.L22:
+	#Block jump elided
+.L23:
+	#instruction start "560 = constant(0)":
+	movl $0, %ebx
+	#instruction start "561 = set_reg %rax 560":
+	#instruction start "562 = phi (region: 521) 501 558":
+	#instruction start "563 = return 521, 561, 562":
+	movq %rbx, %rax
+	#Block return.
+	movq -312(%rbp), %rbx
+	movq -320(%rbp), %r12
+	movq -328(%rbp), %r13
+	movq -336(%rbp), %r14
+	movq -344(%rbp), %r15
+	leave 
+	ret 
+.L24:
+	#Block jump elided
+.L25:
+	#Block jump elided
+.L26:
+	#instruction start "452 = constant(1)":
+	movl $1, %ebx
+	#instruction start "453 = 645 + 452":
+	movl -36(%rbp), %eax
+	movq %rbx, %rcx
+	addl %ecx, %eax
+	movl %eax, -152(%rbp)
+	#instruction start "458 = 606 + 611":
+	movl -40(%rbp), %eax
+	movl -44(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, -156(%rbp)
+	#instruction start "462 = 611 + 616":
+	movl -44(%rbp), %eax
+	movl -48(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, -160(%rbp)
+	#instruction start "466 = 616 + 621":
+	movl -48(%rbp), %eax
+	movl -52(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, -164(%rbp)
+	#instruction start "470 = 621 + 626":
+	movl -52(%rbp), %eax
+	movl -56(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, %r15d
+	#instruction start "474 = 626 + 631":
+	movl -56(%rbp), %eax
+	movl -60(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, %r12d
+	#instruction start "478 = 631 + 636":
+	movl -60(%rbp), %eax
+	movl -64(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "482 = 636 + 641":
+	movl -64(%rbp), %eax
+	movl -68(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "486 = 641 + 645":
+	movl -68(%rbp), %eax
+	movl -36(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, %r14d
+	#Phi node to 606 (434 403 458)
+	movl -156(%rbp), %eax
+	movl %eax, -40(%rbp)
+	#Phi node to 611 (434 407 462)
+	movl -160(%rbp), %eax
+	movl %eax, -44(%rbp)
+	#Phi node to 616 (434 411 466)
+	movl -164(%rbp), %eax
+	movl %eax, -48(%rbp)
+	#Phi node to 621 (434 415 470)
+	movq %r15, %rax
+	movl %eax, -52(%rbp)
+	#Phi node to 626 (434 419 474)
+	movq %r12, %rax
+	movl %eax, -56(%rbp)
+	#Phi node to 631 (434 423 478)
+	movq %rbx, %rax
+	movl %eax, -60(%rbp)
+	#Phi node to 636 (434 427 482)
+	movq %r13, %rax
+	movl %eax, -64(%rbp)
+	#Phi node to 641 (434 431 486)
+	movq %r14, %rax
+	movl %eax, -68(%rbp)
+	#Phi node to 645 (434 441 453)
+	movl -152(%rbp), %eax
+	movl %eax, -36(%rbp)
+	#Block jump
+	jmp .L18
+.L27:
+	#Block jump elided
+.L28:
+	#instruction start "296 = load 276, state: 281":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %rbx
+	#instruction start "297 = constant(1)":
+	movq $1, %r12
+	#instruction start "298 = 296 + 297":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "299 = load 276, state: 281":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %rbx
+	#instruction start "300 = constant(2)":
+	movq $2, %r12
+	#instruction start "301 = 299 * 300 (signed)":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "302 = 298 + 301":
+	movq %r13, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "303 = load 276, state: 281":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %r12
+	#instruction start "304 = constant(3)":
+	movq $3, %r13
+	#instruction start "305 = 303 - 304":
+	movq %r12, %rax
+	movq %r13, %rcx
+	subq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "306 = 302 + 305":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "307 = load 276, state: 281":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %rbx
+	#instruction start "308 = constant(4)":
+	movq $4, %r13
+	#instruction start "309 = 307 ^ 308":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	xorq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "310 = 306 + 309":
+	movq %r12, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "311 = load 276, state: 281":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %r12
+	#instruction start "312 = constant(5)":
+	movq $5, %r13
+	#instruction start "313 = 311 + 312":
+	movq %r12, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "314 = 310 + 313":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "315 = load 276, state: 281":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %rbx
+	#instruction start "316 = constant(6)":
+	movq $6, %r13
+	#instruction start "317 = 315 * 316 (signed)":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "318 = 314 + 317":
+	movq %r12, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "319 = load 276, state: 281":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %r12
+	#instruction start "320 = constant(7)":
+	movq $7, %r13
+	#instruction start "321 = 319 - 320":
+	movq %r12, %rax
+	movq %r13, %rcx
+	subq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "322 = 318 + 321":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "323 = load 276, state: 281":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %rbx
+	#instruction start "324 = constant(8)":
+	movq $8, %r13
+	#instruction start "325 = 323 ^ 324":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	xorq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "326 = 322 + 325":
+	movq %r12, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "327 = load 276, state: 281":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %r12
+	#instruction start "328 = constant(9)":
+	movq $9, %r13
+	#instruction start "329 = 327 + 328":
+	movq %r12, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "330 = 326 + 329":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "331 = load 276, state: 281":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %rbx
+	#instruction start "332 = constant(10)":
+	movq $10, %r13
+	#instruction start "333 = 331 * 332 (signed)":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "334 = 330 + 333":
+	movq %r12, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "335 = load 276, state: 281":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %r12
+	#instruction start "336 = constant(11)":
+	movq $11, %r13
+	#instruction start "337 = 335 - 336":
+	movq %r12, %rax
+	movq %r13, %rcx
+	subq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "338 = 334 + 337":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "339 = load 276, state: 281":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %rbx
+	#instruction start "340 = constant(12)":
+	movq $12, %r13
+	#instruction start "341 = 339 ^ 340":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	xorq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "342 = 338 + 341":
+	movq %r12, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "343 = load 276, state: 281":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %r12
+	#instruction start "344 = 342 + 343":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "346 = constant(1)":
+	movq $sum_live, %rbx
+	#instruction start "347 = constant(0)":
+	movq $0, %r12
+	#instruction start "348 = load part address of 276 with offset 0":
+	movq -8(%rbp), %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "349 = proj0 348":
+	#instruction start "350 = proj1 348":
+	#instruction start "351 = allocate_call_stack 0":
+	#instruction start "352 = set_reg %rdi 350":
+	#instruction start "353 = set_reg %rax 347 state: 352":
+	#instruction start "354 = call 346":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %r14, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r15
+	#instruction start "355 = proj0 354":
+	#instruction start "356 = proj1 354":
+	#instruction start "357 = %rax":
+	#instruction start "358 = int_cast_zero 357":
+	movq %r15, %rax
+	movq %rax, %rbx
+	#instruction start "360 = 358 == 344":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "362 = if 274 360":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L30
+.L29:
+	#instruction start "365 = constant(3)":
+	movq $.Ls3, %rbx
+	#instruction start "366 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "367 = constant(34)":
+	movl $34, %r13d
+	#instruction start "368 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "369 = alloc with size 8":
+	leaq -284(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "370 = store 369 365, state: 355":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "371 = alloc with size 8":
+	leaq -292(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "372 = store 371 366, state: 370":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "373 = alloc with size 4":
+	leaq -296(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "374 = store 373 367, state: 372":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "375 = alloc with size 8":
+	leaq -304(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "376 = store 375 368, state: 374":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "377 = constant(2)":
+	leaq -188(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "378 = constant(0)":
+	leaq -196(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "379 = load part address of 369 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "380 = proj0 379":
+	#instruction start "381 = proj1 379":
+	#instruction start "382 = load part address of 371 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "383 = proj0 382":
+	#instruction start "384 = proj1 382":
+	#instruction start "385 = load part address of 373 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "386 = proj0 385":
+	#instruction start "387 = proj1 385":
+	#instruction start "388 = load part address of 375 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "389 = proj0 388":
+	#instruction start "390 = proj1 388":
+	#instruction start "391 = allocate_call_stack 0":
+	#instruction start "392 = set_reg %rdi 381":
+	#instruction start "393 = set_reg %rsi 384 state: 392":
+	#instruction start "394 = set_reg %rdx 387 state: 393":
+	#instruction start "395 = set_reg %rcx 390 state: 394":
+	#instruction start "396 = set_reg %rax 378 state: 395":
+	#instruction start "397 = call 377":
+	addq $0, %rsp
+	movq -196(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -188(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "398 = proj0 397":
+	#instruction start "399 = proj1 397":
+	#Block jump
+	jmp .L31
+.L30:
+	#Block jump elided
+.L31:
+	#instruction start "564 = phi (region: 361) 355 398":
+	#Block jump elided
+.L32:
+	#instruction start "289 = load 276, state: 564":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %rbx
+	#instruction start "290 = constant(1)":
+	movq $1, %r12
+	#instruction start "291 = 289 + 290":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "292 = store 276 291, state: 564":
+	movq -8(%rbp), %rsi
+	movq %r13, (%rsi)
+	#Block jump
+	jmp .L14
+.section .rodata
+.Ls3:
+	.string "sum_live(seed) == expected\000"
+.Ls4:
+	.string "/root/repo/tests/register_pressure.c\000"
+.Ls5:
+	.string "main"
+.Ls7:
+	.string "loop_live(10) == (a ^ b ^ c ^ d ^ e ^ f ^ g ^ h)\000"
@@ -0,0 +1,148 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rbx, -100(%rbp)
+	movq %r12, -108(%rbp)
+	movq %r13, -116(%rbp)
+	movq %r14, -124(%rbp)
+	movq %r15, -132(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "8 = constant(1)":
+	movq $1, %rbx
+	#instruction start "11 = constant(2)":
+	movq $2, %r12
+	#instruction start "12 = 8 << 11":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	salq %cl, %rax
+	movq %rax, %r13
+	#instruction start "13 = constant(4)":
+	movq $4, %rbx
+	#instruction start "14 = 12 == 13":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "16 = if 2 14":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "19 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "20 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "21 = constant(7)":
+	movl $7, %r13d
+	#instruction start "22 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "23 = alloc with size 8":
+	leaq -72(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "24 = store 23 19, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "25 = alloc with size 8":
+	leaq -80(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "26 = store 25 20, state: 24":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "27 = alloc with size 4":
+	leaq -84(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "28 = store 27 21, state: 26":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "29 = alloc with size 8":
+	leaq -92(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "30 = store 29 22, state: 28":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "31 = constant(1)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "32 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "33 = load part address of 23 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "34 = proj0 33":
+	#instruction start "35 = proj1 33":
+	#instruction start "36 = load part address of 25 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "37 = proj0 36":
+	#instruction start "38 = proj1 36":
+	#instruction start "39 = load part address of 27 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "40 = proj0 39":
+	#instruction start "41 = proj1 39":
+	#instruction start "42 = load part address of 29 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "43 = proj0 42":
+	#instruction start "44 = proj1 42":
+	#instruction start "45 = allocate_call_stack 0":
+	#instruction start "46 = set_reg %rdi 35":
+	#instruction start "47 = set_reg %rsi 38 state: 46":
+	#instruction start "48 = set_reg %rdx 41 state: 47":
+	#instruction start "49 = set_reg %rcx 44 state: 48":
+	#instruction start "50 = set_reg %rax 32 state: 49":
+	#instruction start "51 = call 31":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "52 = proj0 51":
+	#instruction start "53 = proj1 51":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "54 = constant(0)":
+	movl $0, %ebx
+	#instruction start "55 = set_reg %rax 54":
+	#instruction start "56 = phi (region: 15) 3 52":
+	#instruction start "57 = return 15, 55, 56":
+	movq %rbx, %rax
+	#Block return.
+	movq -100(%rbp), %rbx
+	movq -108(%rbp), %r12
+	movq -116(%rbp), %r13
+	movq -124(%rbp), %r14
+	movq -132(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls2:
+	.string "a << 2 == 4\000"
+.Ls3:
+	.string "/root/repo/tests/rvalue_conversion.c\000"
+.Ls4:
+	.string "main"
+.section .data
+.align 8
+.global ptr
+ptr:
+.quad ptr
+.section .text
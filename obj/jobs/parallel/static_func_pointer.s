@@ -0,0 +1,371 @@
+.global function
+function:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movl %edi, %ebx
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "8 = store part of 7 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "9 = load 7, state: 8":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "10 = set_reg %rax 9":
+	#instruction start "11 = return 2, 10, 8":
+	movq %rbx, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movq %rbx, -224(%rbp)
+	movq %r12, -232(%rbp)
+	movq %r13, -240(%rbp)
+	movq %r14, -248(%rbp)
+	movq %r15, -256(%rbp)
+.L3:
+	#instruction start "15 = proj3 13":
+	#instruction start "18 = constant(1)":
+	movq $new_func, %rbx
+	#instruction start "19 = alloc with size 4":
+	leaq -156(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "20 = constant(10)":
+	movl $10, %r13d
+	#instruction start "21 = store 19 20, state: 15":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "22 = load_volatile 18, state: 21":
+	movq %rbx, %rdi
+	movq (%rdi), %r13
+	#instruction start "23 = proj0 22":
+	#instruction start "24 = proj1 22":
+	#instruction start "25 = constant(0)":
+	movq $0, %rbx
+	#instruction start "26 = load part address of 19 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "27 = proj0 26":
+	#instruction start "28 = proj1 26":
+	#instruction start "29 = allocate_call_stack 0":
+	#instruction start "30 = set_reg %rdi 28":
+	#instruction start "31 = set_reg %rax 25 state: 30":
+	#instruction start "32 = call 24":
+	addq $0, %rsp
+	movq %rbx, %rax
+	movq %r14, %rdi
+	movq %r13, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r12
+	#instruction start "33 = proj0 32":
+	#instruction start "34 = proj1 32":
+	#instruction start "35 = %rax":
+	#instruction start "36 = int_cast_zero 35":
+	movq %r12, %rax
+	movl %eax, %ebx
+	#instruction start "37 = constant(10)":
+	movl $10, %r12d
+	#instruction start "38 = 36 == 37":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "40 = if 14 38":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L5
+.L4:
+	#instruction start "43 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "44 = constant(6)":
+	movq $.Ls6, %r12
+	#instruction start "45 = constant(21)":
+	movl $21, %r13d
+	#instruction start "46 = constant(7)":
+	movq $.Ls7, %r14
+	#instruction start "47 = alloc with size 8":
+	leaq -164(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "48 = store 47 43, state: 33":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "49 = alloc with size 8":
+	leaq -172(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "50 = store 49 44, state: 48":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "51 = alloc with size 4":
+	leaq -176(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "52 = store 51 45, state: 50":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "53 = alloc with size 8":
+	leaq -184(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "54 = store 53 46, state: 52":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "55 = constant(4)":
+	leaq -24(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "56 = constant(0)":
+	leaq -32(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "57 = load part address of 47 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "58 = proj0 57":
+	#instruction start "59 = proj1 57":
+	#instruction start "60 = load part address of 49 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "61 = proj0 60":
+	#instruction start "62 = proj1 60":
+	#instruction start "63 = load part address of 51 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "64 = proj0 63":
+	#instruction start "65 = proj1 63":
+	#instruction start "66 = load part address of 53 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "67 = proj0 66":
+	#instruction start "68 = proj1 66":
+	#instruction start "69 = allocate_call_stack 0":
+	#instruction start "70 = set_reg %rdi 59":
+	#instruction start "71 = set_reg %rsi 62 state: 70":
+	#instruction start "72 = set_reg %rdx 65 state: 71":
+	#instruction start "73 = set_reg %rcx 68 state: 72":
+	#instruction start "74 = set_reg %rax 56 state: 73":
+	#instruction start "75 = call 55":
+	addq $0, %rsp
+	movq -32(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -24(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "76 = proj0 75":
+	#instruction start "77 = proj1 75":
+	#Block jump
+	jmp .L6
+.L5:
+	#Block jump elided
+.L6:
+	#instruction start "78 = constant(3)":
+	movq $table, %rbx
+	#instruction start "79 = phi (region: 39) 33 76":
+	#instruction start "80 = load_volatile 78, state: 79":
+	movq %rbx, %rdi
+	movq (%rdi), %r12
+	#instruction start "81 = proj0 80":
+	#instruction start "82 = proj1 80":
+	#instruction start "83 = alloc with size 4":
+	leaq -188(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "84 = constant(10)":
+	movl $10, %r13d
+	#instruction start "85 = store 83 84, state: 81":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "86 = constant(0)":
+	movq $0, %r13
+	#instruction start "87 = load part address of 83 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "88 = proj0 87":
+	#instruction start "89 = proj1 87":
+	#instruction start "90 = allocate_call_stack 0":
+	#instruction start "91 = set_reg %rdi 89":
+	#instruction start "92 = set_reg %rax 86 state: 91":
+	#instruction start "93 = call 82":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "94 = proj0 93":
+	#instruction start "95 = proj1 93":
+	#instruction start "96 = %rax":
+	#instruction start "97 = int_cast_zero 96":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "98 = constant(10)":
+	movl $10, %ebx
+	#instruction start "99 = 97 == 98":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "101 = if 39 99":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L8
+.L7:
+	#instruction start "104 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "105 = constant(6)":
+	movq $.Ls6, %r12
+	#instruction start "106 = constant(22)":
+	movl $22, %r13d
+	#instruction start "107 = constant(7)":
+	movq $.Ls7, %r14
+	#instruction start "108 = alloc with size 8":
+	leaq -196(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "109 = store 108 104, state: 94":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "110 = alloc with size 8":
+	leaq -204(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "111 = store 110 105, state: 109":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "112 = alloc with size 4":
+	leaq -208(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "113 = store 112 106, state: 111":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "114 = alloc with size 8":
+	leaq -216(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "115 = store 114 107, state: 113":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "116 = constant(4)":
+	leaq -96(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "117 = constant(0)":
+	leaq -104(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "118 = load part address of 108 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "119 = proj0 118":
+	#instruction start "120 = proj1 118":
+	#instruction start "121 = load part address of 110 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "122 = proj0 121":
+	#instruction start "123 = proj1 121":
+	#instruction start "124 = load part address of 112 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "125 = proj0 124":
+	#instruction start "126 = proj1 124":
+	#instruction start "127 = load part address of 114 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "128 = proj0 127":
+	#instruction start "129 = proj1 127":
+	#instruction start "130 = allocate_call_stack 0":
+	#instruction start "131 = set_reg %rdi 120":
+	#instruction start "132 = set_reg %rsi 123 state: 131":
+	#instruction start "133 = set_reg %rdx 126 state: 132":
+	#instruction start "134 = set_reg %rcx 129 state: 133":
+	#instruction start "135 = set_reg %rax 117 state: 134":
+	#instruction start "136 = call 116":
+	addq $0, %rsp
+	movq -104(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -96(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "137 = proj0 136":
+	#instruction start "138 = proj1 136":
+	#Block jump
+	jmp .L9
+.L8:
+	#Block jump elided
+.L9:
+	#instruction start "139 = constant(0)":
+	movl $0, %ebx
+	#instruction start "140 = set_reg %rax 139":
+	#instruction start "141 = phi (region: 100) 94 137":
+	#instruction start "142 = return 100, 140, 141":
+	movq %rbx, %rax
+	#Block return.
+	movq -224(%rbp), %rbx
+	movq -232(%rbp), %r12
+	movq -240(%rbp), %r13
+	movq -248(%rbp), %r14
+	movq -256(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls5:
+	.string "new_func(10) == 10\000"
+.Ls6:
+	.string "/root/repo/tests/static_func_pointer.c\000"
+.Ls7:
+	.string "main"
+.Ls8:
+	.string "((func_type)table[0])(10) == 10\000"
+.section .data
+.align 8
+.global new_func
+new_func:
+.quad function
+.section .text
+.section .data
+.align 4
+.global arr
+arr:
+.quad 8589934593
+.byte 3
+.byte 0
+.byte 0
+.byte 0
+.section .text
+.section .data
+.align 8
+.global table
+table:
+.quad function
+.quad arr
+.quad arr+8
+.quad arr+12
+.section .text
@@ -0,0 +1,3456 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $2784, %rsp
+	movq %rbx, -2744(%rbp)
+	movq %r12, -2752(%rbp)
+	movq %r13, -2760(%rbp)
+	movq %r14, -2768(%rbp)
+	movq %r15, -2776(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "7 = constant(1)":
+	movq $.Ls1, %r12
+	#instruction start "8 = alloc with size 8":
+	leaq -1776(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "9 = store 8 6, state: 3":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "10 = alloc with size 8":
+	leaq -1784(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "11 = store 10 7, state: 9":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "12 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "13 = constant(0)":
+	movq $0, %r14
+	#instruction start "14 = load part address of 8 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "15 = proj0 14":
+	#instruction start "16 = proj1 14":
+	#instruction start "17 = load part address of 10 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "18 = proj0 17":
+	#instruction start "19 = proj1 17":
+	#instruction start "20 = allocate_call_stack 0":
+	#instruction start "21 = set_reg %rdi 16":
+	#instruction start "22 = set_reg %rsi 19 state: 21":
+	#instruction start "23 = set_reg %rax 13 state: 22":
+	#instruction start "24 = call 12":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "25 = proj0 24":
+	#instruction start "26 = proj1 24":
+	#instruction start "27 = %rax":
+	#instruction start "28 = int_cast_zero 27":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "29 = constant(0)":
+	movl $0, %ebx
+	#instruction start "30 = 28 == 29":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "32 = if 2 30":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "35 = constant(3)":
+	movq $.Ls3, %rbx
+	#instruction start "36 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "37 = constant(12)":
+	movl $12, %r13d
+	#instruction start "38 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "39 = alloc with size 8":
+	leaq -1792(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "40 = store 39 35, state: 25":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "41 = alloc with size 8":
+	leaq -1800(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "42 = store 41 36, state: 40":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "43 = alloc with size 4":
+	leaq -1804(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "44 = store 43 37, state: 42":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "45 = alloc with size 8":
+	leaq -1812(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "46 = store 45 38, state: 44":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "47 = constant(2)":
+	leaq -32(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "48 = constant(0)":
+	leaq -40(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "49 = load part address of 39 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "50 = proj0 49":
+	#instruction start "51 = proj1 49":
+	#instruction start "52 = load part address of 41 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "53 = proj0 52":
+	#instruction start "54 = proj1 52":
+	#instruction start "55 = load part address of 43 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "56 = proj0 55":
+	#instruction start "57 = proj1 55":
+	#instruction start "58 = load part address of 45 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "59 = proj0 58":
+	#instruction start "60 = proj1 58":
+	#instruction start "61 = allocate_call_stack 0":
+	#instruction start "62 = set_reg %rdi 51":
+	#instruction start "63 = set_reg %rsi 54 state: 62":
+	#instruction start "64 = set_reg %rdx 57 state: 63":
+	#instruction start "65 = set_reg %rcx 60 state: 64":
+	#instruction start "66 = set_reg %rax 48 state: 65":
+	#instruction start "67 = call 47":
+	addq $0, %rsp
+	movq -40(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -32(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "68 = proj0 67":
+	#instruction start "69 = proj1 67":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "70 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "71 = constant(6)":
+	movq $.Ls6, %r12
+	#instruction start "72 = alloc with size 8":
+	leaq -1820(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "73 = phi (region: 31) 25 68":
+	#instruction start "74 = store 72 70, state: 73":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "75 = alloc with size 8":
+	leaq -1828(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "76 = store 75 71, state: 74":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "77 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "78 = constant(0)":
+	movq $0, %r14
+	#instruction start "79 = load part address of 72 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "80 = proj0 79":
+	#instruction start "81 = proj1 79":
+	#instruction start "82 = load part address of 75 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "83 = proj0 82":
+	#instruction start "84 = proj1 82":
+	#instruction start "85 = allocate_call_stack 0":
+	#instruction start "86 = set_reg %rdi 81":
+	#instruction start "87 = set_reg %rsi 84 state: 86":
+	#instruction start "88 = set_reg %rax 78 state: 87":
+	#instruction start "89 = call 77":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "90 = proj0 89":
+	#instruction start "91 = proj1 89":
+	#instruction start "92 = %rax":
+	#instruction start "93 = int_cast_zero 92":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "94 = constant(0)":
+	movl $0, %ebx
+	#instruction start "95 = 93 == 94":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "97 = if 31 95":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "100 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "101 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "102 = constant(13)":
+	movl $13, %r13d
+	#instruction start "103 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "104 = alloc with size 8":
+	leaq -1836(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "105 = store 104 100, state: 90":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "106 = alloc with size 8":
+	leaq -1844(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "107 = store 106 101, state: 105":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "108 = alloc with size 4":
+	leaq -1848(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "109 = store 108 102, state: 107":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "110 = alloc with size 8":
+	leaq -1856(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "111 = store 110 103, state: 109":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "112 = constant(2)":
+	leaq -112(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "113 = constant(0)":
+	leaq -120(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "114 = load part address of 104 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "115 = proj0 114":
+	#instruction start "116 = proj1 114":
+	#instruction start "117 = load part address of 106 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "118 = proj0 117":
+	#instruction start "119 = proj1 117":
+	#instruction start "120 = load part address of 108 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "121 = proj0 120":
+	#instruction start "122 = proj1 120":
+	#instruction start "123 = load part address of 110 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "124 = proj0 123":
+	#instruction start "125 = proj1 123":
+	#instruction start "126 = allocate_call_stack 0":
+	#instruction start "127 = set_reg %rdi 116":
+	#instruction start "128 = set_reg %rsi 119 state: 127":
+	#instruction start "129 = set_reg %rdx 122 state: 128":
+	#instruction start "130 = set_reg %rcx 125 state: 129":
+	#instruction start "131 = set_reg %rax 113 state: 130":
+	#instruction start "132 = call 112":
+	addq $0, %rsp
+	movq -120(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -112(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "133 = proj0 132":
+	#instruction start "134 = proj1 132":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "135 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "136 = constant(8)":
+	movq $.Ls8, %r12
+	#instruction start "137 = alloc with size 8":
+	leaq -1864(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "138 = phi (region: 96) 90 133":
+	#instruction start "139 = store 137 135, state: 138":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "140 = alloc with size 8":
+	leaq -1872(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "141 = store 140 136, state: 139":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "142 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "143 = constant(0)":
+	movq $0, %r14
+	#instruction start "144 = load part address of 137 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "145 = proj0 144":
+	#instruction start "146 = proj1 144":
+	#instruction start "147 = load part address of 140 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "148 = proj0 147":
+	#instruction start "149 = proj1 147":
+	#instruction start "150 = allocate_call_stack 0":
+	#instruction start "151 = set_reg %rdi 146":
+	#instruction start "152 = set_reg %rsi 149 state: 151":
+	#instruction start "153 = set_reg %rax 143 state: 152":
+	#instruction start "154 = call 142":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "155 = proj0 154":
+	#instruction start "156 = proj1 154":
+	#instruction start "157 = %rax":
+	#instruction start "158 = int_cast_zero 157":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "159 = constant(0)":
+	movl $0, %ebx
+	#instruction start "160 = 158 == 159":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "162 = if 96 160":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "165 = constant(9)":
+	movq $.Ls9, %rbx
+	#instruction start "166 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "167 = constant(15)":
+	movl $15, %r13d
+	#instruction start "168 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "169 = alloc with size 8":
+	leaq -1880(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "170 = store 169 165, state: 155":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "171 = alloc with size 8":
+	leaq -1888(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "172 = store 171 166, state: 170":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "173 = alloc with size 4":
+	leaq -1892(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "174 = store 173 167, state: 172":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "175 = alloc with size 8":
+	leaq -1900(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "176 = store 175 168, state: 174":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "177 = constant(2)":
+	leaq -192(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "178 = constant(0)":
+	leaq -200(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "179 = load part address of 169 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "180 = proj0 179":
+	#instruction start "181 = proj1 179":
+	#instruction start "182 = load part address of 171 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "183 = proj0 182":
+	#instruction start "184 = proj1 182":
+	#instruction start "185 = load part address of 173 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "186 = proj0 185":
+	#instruction start "187 = proj1 185":
+	#instruction start "188 = load part address of 175 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "189 = proj0 188":
+	#instruction start "190 = proj1 188":
+	#instruction start "191 = allocate_call_stack 0":
+	#instruction start "192 = set_reg %rdi 181":
+	#instruction start "193 = set_reg %rsi 184 state: 192":
+	#instruction start "194 = set_reg %rdx 187 state: 193":
+	#instruction start "195 = set_reg %rcx 190 state: 194":
+	#instruction start "196 = set_reg %rax 178 state: 195":
+	#instruction start "197 = call 177":
+	addq $0, %rsp
+	movq -200(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -192(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "198 = proj0 197":
+	#instruction start "199 = proj1 197":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "200 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "201 = constant(10)":
+	movq $.Ls10, %r12
+	#instruction start "202 = alloc with size 8":
+	leaq -1908(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "203 = phi (region: 161) 155 198":
+	#instruction start "204 = store 202 200, state: 203":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "205 = alloc with size 8":
+	leaq -1916(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "206 = store 205 201, state: 204":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "207 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "208 = constant(0)":
+	movq $0, %r14
+	#instruction start "209 = load part address of 202 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "210 = proj0 209":
+	#instruction start "211 = proj1 209":
+	#instruction start "212 = load part address of 205 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "213 = proj0 212":
+	#instruction start "214 = proj1 212":
+	#instruction start "215 = allocate_call_stack 0":
+	#instruction start "216 = set_reg %rdi 211":
+	#instruction start "217 = set_reg %rsi 214 state: 216":
+	#instruction start "218 = set_reg %rax 208 state: 217":
+	#instruction start "219 = call 207":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "220 = proj0 219":
+	#instruction start "221 = proj1 219":
+	#instruction start "222 = %rax":
+	#instruction start "223 = int_cast_zero 222":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "224 = constant(0)":
+	movl $0, %ebx
+	#instruction start "225 = 223 == 224":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "227 = if 161 225":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "230 = constant(11)":
+	movq $.Ls11, %rbx
+	#instruction start "231 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "232 = constant(16)":
+	movl $16, %r13d
+	#instruction start "233 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "234 = alloc with size 8":
+	leaq -1924(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "235 = store 234 230, state: 220":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "236 = alloc with size 8":
+	leaq -1932(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "237 = store 236 231, state: 235":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "238 = alloc with size 4":
+	leaq -1936(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "239 = store 238 232, state: 237":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "240 = alloc with size 8":
+	leaq -1944(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "241 = store 240 233, state: 239":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "242 = constant(2)":
+	leaq -272(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "243 = constant(0)":
+	leaq -280(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "244 = load part address of 234 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "245 = proj0 244":
+	#instruction start "246 = proj1 244":
+	#instruction start "247 = load part address of 236 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "248 = proj0 247":
+	#instruction start "249 = proj1 247":
+	#instruction start "250 = load part address of 238 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "251 = proj0 250":
+	#instruction start "252 = proj1 250":
+	#instruction start "253 = load part address of 240 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "254 = proj0 253":
+	#instruction start "255 = proj1 253":
+	#instruction start "256 = allocate_call_stack 0":
+	#instruction start "257 = set_reg %rdi 246":
+	#instruction start "258 = set_reg %rsi 249 state: 257":
+	#instruction start "259 = set_reg %rdx 252 state: 258":
+	#instruction start "260 = set_reg %rcx 255 state: 259":
+	#instruction start "261 = set_reg %rax 243 state: 260":
+	#instruction start "262 = call 242":
+	addq $0, %rsp
+	movq -280(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -272(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "263 = proj0 262":
+	#instruction start "264 = proj1 262":
+	#Block jump
+	jmp .L14
+.L13:
+	#Block jump elided
+.L14:
+	#instruction start "265 = constant(12)":
+	movq $.Ls12, %rbx
+	#instruction start "266 = constant(12)":
+	movq $.Ls12, %r12
+	#instruction start "267 = alloc with size 8":
+	leaq -1952(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "268 = phi (region: 226) 220 263":
+	#instruction start "269 = store 267 265, state: 268":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "270 = alloc with size 8":
+	leaq -1960(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "271 = store 270 266, state: 269":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "272 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "273 = constant(0)":
+	movq $0, %r14
+	#instruction start "274 = load part address of 267 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "275 = proj0 274":
+	#instruction start "276 = proj1 274":
+	#instruction start "277 = load part address of 270 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "278 = proj0 277":
+	#instruction start "279 = proj1 277":
+	#instruction start "280 = allocate_call_stack 0":
+	#instruction start "281 = set_reg %rdi 276":
+	#instruction start "282 = set_reg %rsi 279 state: 281":
+	#instruction start "283 = set_reg %rax 273 state: 282":
+	#instruction start "284 = call 272":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "285 = proj0 284":
+	#instruction start "286 = proj1 284":
+	#instruction start "287 = %rax":
+	#instruction start "288 = int_cast_zero 287":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "289 = constant(0)":
+	movl $0, %ebx
+	#instruction start "290 = 288 == 289":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "292 = if 226 290":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#instruction start "295 = constant(13)":
+	movq $.Ls13, %rbx
+	#instruction start "296 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "297 = constant(18)":
+	movl $18, %r13d
+	#instruction start "298 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "299 = alloc with size 8":
+	leaq -1968(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "300 = store 299 295, state: 285":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "301 = alloc with size 8":
+	leaq -1976(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "302 = store 301 296, state: 300":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "303 = alloc with size 4":
+	leaq -1980(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "304 = store 303 297, state: 302":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "305 = alloc with size 8":
+	leaq -1988(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "306 = store 305 298, state: 304":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "307 = constant(2)":
+	leaq -352(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "308 = constant(0)":
+	leaq -360(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "309 = load part address of 299 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "310 = proj0 309":
+	#instruction start "311 = proj1 309":
+	#instruction start "312 = load part address of 301 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "313 = proj0 312":
+	#instruction start "314 = proj1 312":
+	#instruction start "315 = load part address of 303 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "316 = proj0 315":
+	#instruction start "317 = proj1 315":
+	#instruction start "318 = load part address of 305 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "319 = proj0 318":
+	#instruction start "320 = proj1 318":
+	#instruction start "321 = allocate_call_stack 0":
+	#instruction start "322 = set_reg %rdi 311":
+	#instruction start "323 = set_reg %rsi 314 state: 322":
+	#instruction start "324 = set_reg %rdx 317 state: 323":
+	#instruction start "325 = set_reg %rcx 320 state: 324":
+	#instruction start "326 = set_reg %rax 308 state: 325":
+	#instruction start "327 = call 307":
+	addq $0, %rsp
+	movq -360(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -352(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "328 = proj0 327":
+	#instruction start "329 = proj1 327":
+	#Block jump
+	jmp .L17
+.L16:
+	#Block jump elided
+.L17:
+	#instruction start "330 = constant(14)":
+	movq $.Ls14, %rbx
+	#instruction start "331 = constant(14)":
+	movq $.Ls14, %r12
+	#instruction start "332 = alloc with size 8":
+	leaq -1996(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "333 = phi (region: 291) 285 328":
+	#instruction start "334 = store 332 330, state: 333":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "335 = alloc with size 8":
+	leaq -2004(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "336 = store 335 331, state: 334":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "337 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "338 = constant(0)":
+	movq $0, %r14
+	#instruction start "339 = load part address of 332 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "340 = proj0 339":
+	#instruction start "341 = proj1 339":
+	#instruction start "342 = load part address of 335 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "343 = proj0 342":
+	#instruction start "344 = proj1 342":
+	#instruction start "345 = allocate_call_stack 0":
+	#instruction start "346 = set_reg %rdi 341":
+	#instruction start "347 = set_reg %rsi 344 state: 346":
+	#instruction start "348 = set_reg %rax 338 state: 347":
+	#instruction start "349 = call 337":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "350 = proj0 349":
+	#instruction start "351 = proj1 349":
+	#instruction start "352 = %rax":
+	#instruction start "353 = int_cast_zero 352":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "354 = constant(0)":
+	movl $0, %ebx
+	#instruction start "355 = 353 == 354":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "357 = if 291 355":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "360 = constant(15)":
+	movq $.Ls15, %rbx
+	#instruction start "361 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "362 = constant(21)":
+	movl $21, %r13d
+	#instruction start "363 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "364 = alloc with size 8":
+	leaq -2012(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "365 = store 364 360, state: 350":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "366 = alloc with size 8":
+	leaq -2020(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "367 = store 366 361, state: 365":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "368 = alloc with size 4":
+	leaq -2024(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "369 = store 368 362, state: 367":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "370 = alloc with size 8":
+	leaq -2032(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "371 = store 370 363, state: 369":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "372 = constant(2)":
+	leaq -432(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "373 = constant(0)":
+	leaq -440(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "374 = load part address of 364 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "375 = proj0 374":
+	#instruction start "376 = proj1 374":
+	#instruction start "377 = load part address of 366 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "378 = proj0 377":
+	#instruction start "379 = proj1 377":
+	#instruction start "380 = load part address of 368 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "381 = proj0 380":
+	#instruction start "382 = proj1 380":
+	#instruction start "383 = load part address of 370 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "384 = proj0 383":
+	#instruction start "385 = proj1 383":
+	#instruction start "386 = allocate_call_stack 0":
+	#instruction start "387 = set_reg %rdi 376":
+	#instruction start "388 = set_reg %rsi 379 state: 387":
+	#instruction start "389 = set_reg %rdx 382 state: 388":
+	#instruction start "390 = set_reg %rcx 385 state: 389":
+	#instruction start "391 = set_reg %rax 373 state: 390":
+	#instruction start "392 = call 372":
+	addq $0, %rsp
+	movq -440(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -432(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "393 = proj0 392":
+	#instruction start "394 = proj1 392":
+	#Block jump
+	jmp .L20
+.L19:
+	#Block jump elided
+.L20:
+	#instruction start "395 = constant(16)":
+	movq $.Ls16, %rbx
+	#instruction start "396 = constant(16)":
+	movq $.Ls16, %r12
+	#instruction start "397 = alloc with size 8":
+	leaq -2040(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "398 = phi (region: 356) 350 393":
+	#instruction start "399 = store 397 395, state: 398":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "400 = alloc with size 8":
+	leaq -2048(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "401 = store 400 396, state: 399":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "402 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "403 = constant(0)":
+	movq $0, %r14
+	#instruction start "404 = load part address of 397 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "405 = proj0 404":
+	#instruction start "406 = proj1 404":
+	#instruction start "407 = load part address of 400 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "408 = proj0 407":
+	#instruction start "409 = proj1 407":
+	#instruction start "410 = allocate_call_stack 0":
+	#instruction start "411 = set_reg %rdi 406":
+	#instruction start "412 = set_reg %rsi 409 state: 411":
+	#instruction start "413 = set_reg %rax 403 state: 412":
+	#instruction start "414 = call 402":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "415 = proj0 414":
+	#instruction start "416 = proj1 414":
+	#instruction start "417 = %rax":
+	#instruction start "418 = int_cast_zero 417":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "419 = constant(0)":
+	movl $0, %ebx
+	#instruction start "420 = 418 == 419":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "422 = if 356 420":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "425 = constant(17)":
+	movq $.Ls17, %rbx
+	#instruction start "426 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "427 = constant(23)":
+	movl $23, %r13d
+	#instruction start "428 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "429 = alloc with size 8":
+	leaq -2056(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "430 = store 429 425, state: 415":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "431 = alloc with size 8":
+	leaq -2064(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "432 = store 431 426, state: 430":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "433 = alloc with size 4":
+	leaq -2068(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "434 = store 433 427, state: 432":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "435 = alloc with size 8":
+	leaq -2076(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "436 = store 435 428, state: 434":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "437 = constant(2)":
+	leaq -512(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "438 = constant(0)":
+	leaq -520(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "439 = load part address of 429 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "440 = proj0 439":
+	#instruction start "441 = proj1 439":
+	#instruction start "442 = load part address of 431 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "443 = proj0 442":
+	#instruction start "444 = proj1 442":
+	#instruction start "445 = load part address of 433 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "446 = proj0 445":
+	#instruction start "447 = proj1 445":
+	#instruction start "448 = load part address of 435 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "449 = proj0 448":
+	#instruction start "450 = proj1 448":
+	#instruction start "451 = allocate_call_stack 0":
+	#instruction start "452 = set_reg %rdi 441":
+	#instruction start "453 = set_reg %rsi 444 state: 452":
+	#instruction start "454 = set_reg %rdx 447 state: 453":
+	#instruction start "455 = set_reg %rcx 450 state: 454":
+	#instruction start "456 = set_reg %rax 438 state: 455":
+	#instruction start "457 = call 437":
+	addq $0, %rsp
+	movq -520(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -512(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "458 = proj0 457":
+	#instruction start "459 = proj1 457":
+	#Block jump
+	jmp .L23
+.L22:
+	#Block jump elided
+.L23:
+	#instruction start "460 = constant(18)":
+	movq $.Ls18, %rbx
+	#instruction start "461 = constant(18)":
+	movq $.Ls18, %r12
+	#instruction start "462 = alloc with size 8":
+	leaq -2084(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "463 = phi (region: 421) 415 458":
+	#instruction start "464 = store 462 460, state: 463":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "465 = alloc with size 8":
+	leaq -2092(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "466 = store 465 461, state: 464":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "467 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "468 = constant(0)":
+	movq $0, %r14
+	#instruction start "469 = load part address of 462 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "470 = proj0 469":
+	#instruction start "471 = proj1 469":
+	#instruction start "472 = load part address of 465 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "473 = proj0 472":
+	#instruction start "474 = proj1 472":
+	#instruction start "475 = allocate_call_stack 0":
+	#instruction start "476 = set_reg %rdi 471":
+	#instruction start "477 = set_reg %rsi 474 state: 476":
+	#instruction start "478 = set_reg %rax 468 state: 477":
+	#instruction start "479 = call 467":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "480 = proj0 479":
+	#instruction start "481 = proj1 479":
+	#instruction start "482 = %rax":
+	#instruction start "483 = int_cast_zero 482":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "484 = constant(0)":
+	movl $0, %ebx
+	#instruction start "485 = 483 == 484":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "487 = if 421 485":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L25
+.L24:
+	#instruction start "490 = constant(19)":
+	movq $.Ls19, %rbx
+	#instruction start "491 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "492 = constant(24)":
+	movl $24, %r13d
+	#instruction start "493 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "494 = alloc with size 8":
+	leaq -2100(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "495 = store 494 490, state: 480":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "496 = alloc with size 8":
+	leaq -2108(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "497 = store 496 491, state: 495":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "498 = alloc with size 4":
+	leaq -2112(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "499 = store 498 492, state: 497":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "500 = alloc with size 8":
+	leaq -2120(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "501 = store 500 493, state: 499":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "502 = constant(2)":
+	leaq -592(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "503 = constant(0)":
+	leaq -600(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "504 = load part address of 494 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "505 = proj0 504":
+	#instruction start "506 = proj1 504":
+	#instruction start "507 = load part address of 496 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "508 = proj0 507":
+	#instruction start "509 = proj1 507":
+	#instruction start "510 = load part address of 498 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "511 = proj0 510":
+	#instruction start "512 = proj1 510":
+	#instruction start "513 = load part address of 500 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "514 = proj0 513":
+	#instruction start "515 = proj1 513":
+	#instruction start "516 = allocate_call_stack 0":
+	#instruction start "517 = set_reg %rdi 506":
+	#instruction start "518 = set_reg %rsi 509 state: 517":
+	#instruction start "519 = set_reg %rdx 512 state: 518":
+	#instruction start "520 = set_reg %rcx 515 state: 519":
+	#instruction start "521 = set_reg %rax 503 state: 520":
+	#instruction start "522 = call 502":
+	addq $0, %rsp
+	movq -600(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -592(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "523 = proj0 522":
+	#instruction start "524 = proj1 522":
+	#Block jump
+	jmp .L26
+.L25:
+	#Block jump elided
+.L26:
+	#instruction start "525 = constant(20)":
+	movq $.Ls20, %rbx
+	#instruction start "526 = constant(20)":
+	movq $.Ls20, %r12
+	#instruction start "527 = alloc with size 8":
+	leaq -2128(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "528 = phi (region: 486) 480 523":
+	#instruction start "529 = store 527 525, state: 528":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "530 = alloc with size 8":
+	leaq -2136(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "531 = store 530 526, state: 529":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "532 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "533 = constant(0)":
+	movq $0, %r14
+	#instruction start "534 = load part address of 527 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "535 = proj0 534":
+	#instruction start "536 = proj1 534":
+	#instruction start "537 = load part address of 530 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "538 = proj0 537":
+	#instruction start "539 = proj1 537":
+	#instruction start "540 = allocate_call_stack 0":
+	#instruction start "541 = set_reg %rdi 536":
+	#instruction start "542 = set_reg %rsi 539 state: 541":
+	#instruction start "543 = set_reg %rax 533 state: 542":
+	#instruction start "544 = call 532":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "545 = proj0 544":
+	#instruction start "546 = proj1 544":
+	#instruction start "547 = %rax":
+	#instruction start "548 = int_cast_zero 547":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "549 = constant(0)":
+	movl $0, %ebx
+	#instruction start "550 = 548 == 549":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "552 = if 486 550":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L28
+.L27:
+	#instruction start "555 = constant(21)":
+	movq $.Ls21, %rbx
+	#instruction start "556 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "557 = constant(26)":
+	movl $26, %r13d
+	#instruction start "558 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "559 = alloc with size 8":
+	leaq -2144(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "560 = store 559 555, state: 545":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "561 = alloc with size 8":
+	leaq -2152(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "562 = store 561 556, state: 560":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "563 = alloc with size 4":
+	leaq -2156(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "564 = store 563 557, state: 562":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "565 = alloc with size 8":
+	leaq -2164(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "566 = store 565 558, state: 564":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "567 = constant(2)":
+	leaq -672(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "568 = constant(0)":
+	leaq -680(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "569 = load part address of 559 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "570 = proj0 569":
+	#instruction start "571 = proj1 569":
+	#instruction start "572 = load part address of 561 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "573 = proj0 572":
+	#instruction start "574 = proj1 572":
+	#instruction start "575 = load part address of 563 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "576 = proj0 575":
+	#instruction start "577 = proj1 575":
+	#instruction start "578 = load part address of 565 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "579 = proj0 578":
+	#instruction start "580 = proj1 578":
+	#instruction start "581 = allocate_call_stack 0":
+	#instruction start "582 = set_reg %rdi 571":
+	#instruction start "583 = set_reg %rsi 574 state: 582":
+	#instruction start "584 = set_reg %rdx 577 state: 583":
+	#instruction start "585 = set_reg %rcx 580 state: 584":
+	#instruction start "586 = set_reg %rax 568 state: 585":
+	#instruction start "587 = call 567":
+	addq $0, %rsp
+	movq -680(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -672(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "588 = proj0 587":
+	#instruction start "589 = proj1 587":
+	#Block jump
+	jmp .L29
+.L28:
+	#Block jump elided
+.L29:
+	#instruction start "590 = constant(20)":
+	movq $.Ls20, %rbx
+	#instruction start "591 = constant(20)":
+	movq $.Ls20, %r12
+	#instruction start "592 = alloc with size 8":
+	leaq -2172(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "593 = phi (region: 551) 545 588":
+	#instruction start "594 = store 592 590, state: 593":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "595 = alloc with size 8":
+	leaq -2180(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "596 = store 595 591, state: 594":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "597 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "598 = constant(0)":
+	movq $0, %r14
+	#instruction start "599 = load part address of 592 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "600 = proj0 599":
+	#instruction start "601 = proj1 599":
+	#instruction start "602 = load part address of 595 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "603 = proj0 602":
+	#instruction start "604 = proj1 602":
+	#instruction start "605 = allocate_call_stack 0":
+	#instruction start "606 = set_reg %rdi 601":
+	#instruction start "607 = set_reg %rsi 604 state: 606":
+	#instruction start "608 = set_reg %rax 598 state: 607":
+	#instruction start "609 = call 597":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "610 = proj0 609":
+	#instruction start "611 = proj1 609":
+	#instruction start "612 = %rax":
+	#instruction start "613 = int_cast_zero 612":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "614 = constant(0)":
+	movl $0, %ebx
+	#instruction start "615 = 613 == 614":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "617 = if 551 615":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L31
+.L30:
+	#instruction start "620 = constant(21)":
+	movq $.Ls21, %rbx
+	#instruction start "621 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "622 = constant(27)":
+	movl $27, %r13d
+	#instruction start "623 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "624 = alloc with size 8":
+	leaq -2188(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "625 = store 624 620, state: 610":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "626 = alloc with size 8":
+	leaq -2196(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "627 = store 626 621, state: 625":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "628 = alloc with size 4":
+	leaq -2200(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "629 = store 628 622, state: 627":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "630 = alloc with size 8":
+	leaq -2208(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "631 = store 630 623, state: 629":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "632 = constant(2)":
+	leaq -752(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "633 = constant(0)":
+	leaq -760(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "634 = load part address of 624 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "635 = proj0 634":
+	#instruction start "636 = proj1 634":
+	#instruction start "637 = load part address of 626 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "638 = proj0 637":
+	#instruction start "639 = proj1 637":
+	#instruction start "640 = load part address of 628 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "641 = proj0 640":
+	#instruction start "642 = proj1 640":
+	#instruction start "643 = load part address of 630 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "644 = proj0 643":
+	#instruction start "645 = proj1 643":
+	#instruction start "646 = allocate_call_stack 0":
+	#instruction start "647 = set_reg %rdi 636":
+	#instruction start "648 = set_reg %rsi 639 state: 647":
+	#instruction start "649 = set_reg %rdx 642 state: 648":
+	#instruction start "650 = set_reg %rcx 645 state: 649":
+	#instruction start "651 = set_reg %rax 633 state: 650":
+	#instruction start "652 = call 632":
+	addq $0, %rsp
+	movq -760(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -752(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "653 = proj0 652":
+	#instruction start "654 = proj1 652":
+	#Block jump
+	jmp .L32
+.L31:
+	#Block jump elided
+.L32:
+	#instruction start "655 = constant(22)":
+	movq $.Ls22, %rbx
+	#instruction start "656 = constant(22)":
+	movq $.Ls22, %r12
+	#instruction start "657 = alloc with size 8":
+	leaq -2216(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "658 = phi (region: 616) 610 653":
+	#instruction start "659 = store 657 655, state: 658":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "660 = alloc with size 8":
+	leaq -2224(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "661 = store 660 656, state: 659":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "662 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "663 = constant(0)":
+	movq $0, %r14
+	#instruction start "664 = load part address of 657 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "665 = proj0 664":
+	#instruction start "666 = proj1 664":
+	#instruction start "667 = load part address of 660 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "668 = proj0 667":
+	#instruction start "669 = proj1 667":
+	#instruction start "670 = allocate_call_stack 0":
+	#instruction start "671 = set_reg %rdi 666":
+	#instruction start "672 = set_reg %rsi 669 state: 671":
+	#instruction start "673 = set_reg %rax 663 state: 672":
+	#instruction start "674 = call 662":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "675 = proj0 674":
+	#instruction start "676 = proj1 674":
+	#instruction start "677 = %rax":
+	#instruction start "678 = int_cast_zero 677":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "679 = constant(0)":
+	movl $0, %ebx
+	#instruction start "680 = 678 == 679":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "682 = if 616 680":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L34
+.L33:
+	#instruction start "685 = constant(23)":
+	movq $.Ls23, %rbx
+	#instruction start "686 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "687 = constant(28)":
+	movl $28, %r13d
+	#instruction start "688 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "689 = alloc with size 8":
+	leaq -2232(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "690 = store 689 685, state: 675":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "691 = alloc with size 8":
+	leaq -2240(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "692 = store 691 686, state: 690":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "693 = alloc with size 4":
+	leaq -2244(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "694 = store 693 687, state: 692":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "695 = alloc with size 8":
+	leaq -2252(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "696 = store 695 688, state: 694":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "697 = constant(2)":
+	leaq -832(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "698 = constant(0)":
+	leaq -840(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "699 = load part address of 689 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "700 = proj0 699":
+	#instruction start "701 = proj1 699":
+	#instruction start "702 = load part address of 691 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "703 = proj0 702":
+	#instruction start "704 = proj1 702":
+	#instruction start "705 = load part address of 693 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "706 = proj0 705":
+	#instruction start "707 = proj1 705":
+	#instruction start "708 = load part address of 695 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "709 = proj0 708":
+	#instruction start "710 = proj1 708":
+	#instruction start "711 = allocate_call_stack 0":
+	#instruction start "712 = set_reg %rdi 701":
+	#instruction start "713 = set_reg %rsi 704 state: 712":
+	#instruction start "714 = set_reg %rdx 707 state: 713":
+	#instruction start "715 = set_reg %rcx 710 state: 714":
+	#instruction start "716 = set_reg %rax 698 state: 715":
+	#instruction start "717 = call 697":
+	addq $0, %rsp
+	movq -840(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -832(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "718 = proj0 717":
+	#instruction start "719 = proj1 717":
+	#Block jump
+	jmp .L35
+.L34:
+	#Block jump elided
+.L35:
+	#instruction start "720 = constant(24)":
+	movq $.Ls24, %rbx
+	#instruction start "721 = constant(24)":
+	movq $.Ls24, %r12
+	#instruction start "722 = alloc with size 8":
+	leaq -2260(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "723 = phi (region: 681) 675 718":
+	#instruction start "724 = store 722 720, state: 723":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "725 = alloc with size 8":
+	leaq -2268(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "726 = store 725 721, state: 724":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "727 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "728 = constant(0)":
+	movq $0, %r14
+	#instruction start "729 = load part address of 722 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "730 = proj0 729":
+	#instruction start "731 = proj1 729":
+	#instruction start "732 = load part address of 725 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "733 = proj0 732":
+	#instruction start "734 = proj1 732":
+	#instruction start "735 = allocate_call_stack 0":
+	#instruction start "736 = set_reg %rdi 731":
+	#instruction start "737 = set_reg %rsi 734 state: 736":
+	#instruction start "738 = set_reg %rax 728 state: 737":
+	#instruction start "739 = call 727":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "740 = proj0 739":
+	#instruction start "741 = proj1 739":
+	#instruction start "742 = %rax":
+	#instruction start "743 = int_cast_zero 742":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "744 = constant(0)":
+	movl $0, %ebx
+	#instruction start "745 = 743 == 744":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "747 = if 681 745":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L37
+.L36:
+	#instruction start "750 = constant(25)":
+	movq $.Ls25, %rbx
+	#instruction start "751 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "752 = constant(31)":
+	movl $31, %r13d
+	#instruction start "753 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "754 = alloc with size 8":
+	leaq -2276(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "755 = store 754 750, state: 740":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "756 = alloc with size 8":
+	leaq -2284(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "757 = store 756 751, state: 755":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "758 = alloc with size 4":
+	leaq -2288(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "759 = store 758 752, state: 757":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "760 = alloc with size 8":
+	leaq -2296(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "761 = store 760 753, state: 759":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "762 = constant(2)":
+	leaq -912(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "763 = constant(0)":
+	leaq -920(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "764 = load part address of 754 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "765 = proj0 764":
+	#instruction start "766 = proj1 764":
+	#instruction start "767 = load part address of 756 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "768 = proj0 767":
+	#instruction start "769 = proj1 767":
+	#instruction start "770 = load part address of 758 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "771 = proj0 770":
+	#instruction start "772 = proj1 770":
+	#instruction start "773 = load part address of 760 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "774 = proj0 773":
+	#instruction start "775 = proj1 773":
+	#instruction start "776 = allocate_call_stack 0":
+	#instruction start "777 = set_reg %rdi 766":
+	#instruction start "778 = set_reg %rsi 769 state: 777":
+	#instruction start "779 = set_reg %rdx 772 state: 778":
+	#instruction start "780 = set_reg %rcx 775 state: 779":
+	#instruction start "781 = set_reg %rax 763 state: 780":
+	#instruction start "782 = call 762":
+	addq $0, %rsp
+	movq -920(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -912(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "783 = proj0 782":
+	#instruction start "784 = proj1 782":
+	#Block jump
+	jmp .L38
+.L37:
+	#Block jump elided
+.L38:
+	#instruction start "785 = constant(26)":
+	movq $.Ls26, %rbx
+	#instruction start "786 = constant(26)":
+	movq $.Ls26, %r12
+	#instruction start "787 = alloc with size 8":
+	leaq -2304(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "788 = phi (region: 746) 740 783":
+	#instruction start "789 = store 787 785, state: 788":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "790 = alloc with size 8":
+	leaq -2312(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "791 = store 790 786, state: 789":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "792 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "793 = constant(0)":
+	movq $0, %r14
+	#instruction start "794 = load part address of 787 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "795 = proj0 794":
+	#instruction start "796 = proj1 794":
+	#instruction start "797 = load part address of 790 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "798 = proj0 797":
+	#instruction start "799 = proj1 797":
+	#instruction start "800 = allocate_call_stack 0":
+	#instruction start "801 = set_reg %rdi 796":
+	#instruction start "802 = set_reg %rsi 799 state: 801":
+	#instruction start "803 = set_reg %rax 793 state: 802":
+	#instruction start "804 = call 792":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "805 = proj0 804":
+	#instruction start "806 = proj1 804":
+	#instruction start "807 = %rax":
+	#instruction start "808 = int_cast_zero 807":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "809 = constant(0)":
+	movl $0, %ebx
+	#instruction start "810 = 808 == 809":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "812 = if 746 810":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L40
+.L39:
+	#instruction start "815 = constant(27)":
+	movq $.Ls27, %rbx
+	#instruction start "816 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "817 = constant(34)":
+	movl $34, %r13d
+	#instruction start "818 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "819 = alloc with size 8":
+	leaq -2320(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "820 = store 819 815, state: 805":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "821 = alloc with size 8":
+	leaq -2328(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "822 = store 821 816, state: 820":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "823 = alloc with size 4":
+	leaq -2332(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "824 = store 823 817, state: 822":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "825 = alloc with size 8":
+	leaq -2340(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "826 = store 825 818, state: 824":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "827 = constant(2)":
+	leaq -992(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "828 = constant(0)":
+	leaq -1000(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "829 = load part address of 819 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "830 = proj0 829":
+	#instruction start "831 = proj1 829":
+	#instruction start "832 = load part address of 821 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "833 = proj0 832":
+	#instruction start "834 = proj1 832":
+	#instruction start "835 = load part address of 823 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "836 = proj0 835":
+	#instruction start "837 = proj1 835":
+	#instruction start "838 = load part address of 825 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "839 = proj0 838":
+	#instruction start "840 = proj1 838":
+	#instruction start "841 = allocate_call_stack 0":
+	#instruction start "842 = set_reg %rdi 831":
+	#instruction start "843 = set_reg %rsi 834 state: 842":
+	#instruction start "844 = set_reg %rdx 837 state: 843":
+	#instruction start "845 = set_reg %rcx 840 state: 844":
+	#instruction start "846 = set_reg %rax 828 state: 845":
+	#instruction start "847 = call 827":
+	addq $0, %rsp
+	movq -1000(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -992(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "848 = proj0 847":
+	#instruction start "849 = proj1 847":
+	#Block jump
+	jmp .L41
+.L40:
+	#Block jump elided
+.L41:
+	#instruction start "850 = constant(28)":
+	movq $.Ls28, %rbx
+	#instruction start "851 = constant(28)":
+	movq $.Ls28, %r12
+	#instruction start "852 = alloc with size 8":
+	leaq -2348(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "853 = phi (region: 811) 805 848":
+	#instruction start "854 = store 852 850, state: 853":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "855 = alloc with size 8":
+	leaq -2356(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "856 = store 855 851, state: 854":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "857 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "858 = constant(0)":
+	movq $0, %r14
+	#instruction start "859 = load part address of 852 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "860 = proj0 859":
+	#instruction start "861 = proj1 859":
+	#instruction start "862 = load part address of 855 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "863 = proj0 862":
+	#instruction start "864 = proj1 862":
+	#instruction start "865 = allocate_call_stack 0":
+	#instruction start "866 = set_reg %rdi 861":
+	#instruction start "867 = set_reg %rsi 864 state: 866":
+	#instruction start "868 = set_reg %rax 858 state: 867":
+	#instruction start "869 = call 857":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "870 = proj0 869":
+	#instruction start "871 = proj1 869":
+	#instruction start "872 = %rax":
+	#instruction start "873 = int_cast_zero 872":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "874 = constant(0)":
+	movl $0, %ebx
+	#instruction start "875 = 873 == 874":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "877 = if 811 875":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L43
+.L42:
+	#instruction start "880 = constant(29)":
+	movq $.Ls29, %rbx
+	#instruction start "881 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "882 = constant(37)":
+	movl $37, %r13d
+	#instruction start "883 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "884 = alloc with size 8":
+	leaq -2364(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "885 = store 884 880, state: 870":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "886 = alloc with size 8":
+	leaq -2372(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "887 = store 886 881, state: 885":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "888 = alloc with size 4":
+	leaq -2376(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "889 = store 888 882, state: 887":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "890 = alloc with size 8":
+	leaq -2384(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "891 = store 890 883, state: 889":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "892 = constant(2)":
+	leaq -1072(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "893 = constant(0)":
+	leaq -1080(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "894 = load part address of 884 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "895 = proj0 894":
+	#instruction start "896 = proj1 894":
+	#instruction start "897 = load part address of 886 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "898 = proj0 897":
+	#instruction start "899 = proj1 897":
+	#instruction start "900 = load part address of 888 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "901 = proj0 900":
+	#instruction start "902 = proj1 900":
+	#instruction start "903 = load part address of 890 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "904 = proj0 903":
+	#instruction start "905 = proj1 903":
+	#instruction start "906 = allocate_call_stack 0":
+	#instruction start "907 = set_reg %rdi 896":
+	#instruction start "908 = set_reg %rsi 899 state: 907":
+	#instruction start "909 = set_reg %rdx 902 state: 908":
+	#instruction start "910 = set_reg %rcx 905 state: 909":
+	#instruction start "911 = set_reg %rax 893 state: 910":
+	#instruction start "912 = call 892":
+	addq $0, %rsp
+	movq -1080(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1072(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "913 = proj0 912":
+	#instruction start "914 = proj1 912":
+	#Block jump
+	jmp .L44
+.L43:
+	#Block jump elided
+.L44:
+	#instruction start "915 = constant(30)":
+	movq $.Ls30, %rbx
+	#instruction start "916 = constant(30)":
+	movq $.Ls30, %r12
+	#instruction start "917 = alloc with size 8":
+	leaq -2392(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "918 = phi (region: 876) 870 913":
+	#instruction start "919 = store 917 915, state: 918":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "920 = alloc with size 8":
+	leaq -2400(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "921 = store 920 916, state: 919":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "922 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "923 = constant(0)":
+	movq $0, %r14
+	#instruction start "924 = load part address of 917 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "925 = proj0 924":
+	#instruction start "926 = proj1 924":
+	#instruction start "927 = load part address of 920 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "928 = proj0 927":
+	#instruction start "929 = proj1 927":
+	#instruction start "930 = allocate_call_stack 0":
+	#instruction start "931 = set_reg %rdi 926":
+	#instruction start "932 = set_reg %rsi 929 state: 931":
+	#instruction start "933 = set_reg %rax 923 state: 932":
+	#instruction start "934 = call 922":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "935 = proj0 934":
+	#instruction start "936 = proj1 934":
+	#instruction start "937 = %rax":
+	#instruction start "938 = int_cast_zero 937":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "939 = constant(0)":
+	movl $0, %ebx
+	#instruction start "940 = 938 == 939":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "942 = if 876 940":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L46
+.L45:
+	#instruction start "945 = constant(31)":
+	movq $.Ls31, %rbx
+	#instruction start "946 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "947 = constant(40)":
+	movl $40, %r13d
+	#instruction start "948 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "949 = alloc with size 8":
+	leaq -2408(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "950 = store 949 945, state: 935":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "951 = alloc with size 8":
+	leaq -2416(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "952 = store 951 946, state: 950":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "953 = alloc with size 4":
+	leaq -2420(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "954 = store 953 947, state: 952":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "955 = alloc with size 8":
+	leaq -2428(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "956 = store 955 948, state: 954":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "957 = constant(2)":
+	leaq -1152(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "958 = constant(0)":
+	leaq -1160(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "959 = load part address of 949 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "960 = proj0 959":
+	#instruction start "961 = proj1 959":
+	#instruction start "962 = load part address of 951 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "963 = proj0 962":
+	#instruction start "964 = proj1 962":
+	#instruction start "965 = load part address of 953 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "966 = proj0 965":
+	#instruction start "967 = proj1 965":
+	#instruction start "968 = load part address of 955 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "969 = proj0 968":
+	#instruction start "970 = proj1 968":
+	#instruction start "971 = allocate_call_stack 0":
+	#instruction start "972 = set_reg %rdi 961":
+	#instruction start "973 = set_reg %rsi 964 state: 972":
+	#instruction start "974 = set_reg %rdx 967 state: 973":
+	#instruction start "975 = set_reg %rcx 970 state: 974":
+	#instruction start "976 = set_reg %rax 958 state: 975":
+	#instruction start "977 = call 957":
+	addq $0, %rsp
+	movq -1160(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1152(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "978 = proj0 977":
+	#instruction start "979 = proj1 977":
+	#Block jump
+	jmp .L47
+.L46:
+	#Block jump elided
+.L47:
+	#instruction start "980 = constant(30)":
+	movq $.Ls30, %rbx
+	#instruction start "981 = constant(30)":
+	movq $.Ls30, %r12
+	#instruction start "982 = alloc with size 8":
+	leaq -2436(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "983 = phi (region: 941) 935 978":
+	#instruction start "984 = store 982 980, state: 983":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "985 = alloc with size 8":
+	leaq -2444(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "986 = store 985 981, state: 984":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "987 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "988 = constant(0)":
+	movq $0, %r14
+	#instruction start "989 = load part address of 982 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "990 = proj0 989":
+	#instruction start "991 = proj1 989":
+	#instruction start "992 = load part address of 985 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "993 = proj0 992":
+	#instruction start "994 = proj1 992":
+	#instruction start "995 = allocate_call_stack 0":
+	#instruction start "996 = set_reg %rdi 991":
+	#instruction start "997 = set_reg %rsi 994 state: 996":
+	#instruction start "998 = set_reg %rax 988 state: 997":
+	#instruction start "999 = call 987":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "1000 = proj0 999":
+	#instruction start "1001 = proj1 999":
+	#instruction start "1002 = %rax":
+	#instruction start "1003 = int_cast_zero 1002":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "1004 = constant(0)":
+	movl $0, %ebx
+	#instruction start "1005 = 1003 == 1004":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "1007 = if 941 1005":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L49
+.L48:
+	#instruction start "1010 = constant(32)":
+	movq $.Ls32, %rbx
+	#instruction start "1011 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "1012 = constant(41)":
+	movl $41, %r13d
+	#instruction start "1013 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "1014 = alloc with size 8":
+	leaq -2452(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1015 = store 1014 1010, state: 1000":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1016 = alloc with size 8":
+	leaq -2460(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1017 = store 1016 1011, state: 1015":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1018 = alloc with size 4":
+	leaq -2464(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1019 = store 1018 1012, state: 1017":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1020 = alloc with size 8":
+	leaq -2472(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1021 = store 1020 1013, state: 1019":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1022 = constant(2)":
+	leaq -1232(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1023 = constant(0)":
+	leaq -1240(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1024 = load part address of 1014 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1025 = proj0 1024":
+	#instruction start "1026 = proj1 1024":
+	#instruction start "1027 = load part address of 1016 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1028 = proj0 1027":
+	#instruction start "1029 = proj1 1027":
+	#instruction start "1030 = load part address of 1018 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1031 = proj0 1030":
+	#instruction start "1032 = proj1 1030":
+	#instruction start "1033 = load part address of 1020 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1034 = proj0 1033":
+	#instruction start "1035 = proj1 1033":
+	#instruction start "1036 = allocate_call_stack 0":
+	#instruction start "1037 = set_reg %rdi 1026":
+	#instruction start "1038 = set_reg %rsi 1029 state: 1037":
+	#instruction start "1039 = set_reg %rdx 1032 state: 1038":
+	#instruction start "1040 = set_reg %rcx 1035 state: 1039":
+	#instruction start "1041 = set_reg %rax 1023 state: 1040":
+	#instruction start "1042 = call 1022":
+	addq $0, %rsp
+	movq -1240(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1232(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1043 = proj0 1042":
+	#instruction start "1044 = proj1 1042":
+	#Block jump
+	jmp .L50
+.L49:
+	#Block jump elided
+.L50:
+	#instruction start "1045 = constant(33)":
+	movq $.Ls33, %rbx
+	#instruction start "1046 = constant(33)":
+	movq $.Ls33, %r12
+	#instruction start "1047 = alloc with size 8":
+	leaq -2480(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1048 = phi (region: 1006) 1000 1043":
+	#instruction start "1049 = store 1047 1045, state: 1048":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1050 = alloc with size 8":
+	leaq -2488(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1051 = store 1050 1046, state: 1049":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1052 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "1053 = constant(0)":
+	movq $0, %r14
+	#instruction start "1054 = load part address of 1047 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1055 = proj0 1054":
+	#instruction start "1056 = proj1 1054":
+	#instruction start "1057 = load part address of 1050 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "1058 = proj0 1057":
+	#instruction start "1059 = proj1 1057":
+	#instruction start "1060 = allocate_call_stack 0":
+	#instruction start "1061 = set_reg %rdi 1056":
+	#instruction start "1062 = set_reg %rsi 1059 state: 1061":
+	#instruction start "1063 = set_reg %rax 1053 state: 1062":
+	#instruction start "1064 = call 1052":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "1065 = proj0 1064":
+	#instruction start "1066 = proj1 1064":
+	#instruction start "1067 = %rax":
+	#instruction start "1068 = int_cast_zero 1067":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "1069 = constant(0)":
+	movl $0, %ebx
+	#instruction start "1070 = 1068 == 1069":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "1072 = if 1006 1070":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L52
+.L51:
+	#instruction start "1075 = constant(34)":
+	movq $.Ls34, %rbx
+	#instruction start "1076 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "1077 = constant(42)":
+	movl $42, %r13d
+	#instruction start "1078 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "1079 = alloc with size 8":
+	leaq -2496(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1080 = store 1079 1075, state: 1065":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1081 = alloc with size 8":
+	leaq -2504(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1082 = store 1081 1076, state: 1080":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1083 = alloc with size 4":
+	leaq -2508(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1084 = store 1083 1077, state: 1082":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1085 = alloc with size 8":
+	leaq -2516(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1086 = store 1085 1078, state: 1084":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1087 = constant(2)":
+	leaq -1312(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1088 = constant(0)":
+	leaq -1320(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1089 = load part address of 1079 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1090 = proj0 1089":
+	#instruction start "1091 = proj1 1089":
+	#instruction start "1092 = load part address of 1081 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1093 = proj0 1092":
+	#instruction start "1094 = proj1 1092":
+	#instruction start "1095 = load part address of 1083 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1096 = proj0 1095":
+	#instruction start "1097 = proj1 1095":
+	#instruction start "1098 = load part address of 1085 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1099 = proj0 1098":
+	#instruction start "1100 = proj1 1098":
+	#instruction start "1101 = allocate_call_stack 0":
+	#instruction start "1102 = set_reg %rdi 1091":
+	#instruction start "1103 = set_reg %rsi 1094 state: 1102":
+	#instruction start "1104 = set_reg %rdx 1097 state: 1103":
+	#instruction start "1105 = set_reg %rcx 1100 state: 1104":
+	#instruction start "1106 = set_reg %rax 1088 state: 1105":
+	#instruction start "1107 = call 1087":
+	addq $0, %rsp
+	movq -1320(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1312(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1108 = proj0 1107":
+	#instruction start "1109 = proj1 1107":
+	#Block jump
+	jmp .L53
+.L52:
+	#Block jump elided
+.L53:
+	#instruction start "1110 = constant(35)":
+	movq $.Ls35, %rbx
+	#instruction start "1111 = constant(35)":
+	movq $.Ls35, %r12
+	#instruction start "1112 = alloc with size 8":
+	leaq -2524(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1113 = phi (region: 1071) 1065 1108":
+	#instruction start "1114 = store 1112 1110, state: 1113":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1115 = alloc with size 8":
+	leaq -2532(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1116 = store 1115 1111, state: 1114":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1117 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "1118 = constant(0)":
+	movq $0, %r14
+	#instruction start "1119 = load part address of 1112 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1120 = proj0 1119":
+	#instruction start "1121 = proj1 1119":
+	#instruction start "1122 = load part address of 1115 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "1123 = proj0 1122":
+	#instruction start "1124 = proj1 1122":
+	#instruction start "1125 = allocate_call_stack 0":
+	#instruction start "1126 = set_reg %rdi 1121":
+	#instruction start "1127 = set_reg %rsi 1124 state: 1126":
+	#instruction start "1128 = set_reg %rax 1118 state: 1127":
+	#instruction start "1129 = call 1117":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "1130 = proj0 1129":
+	#instruction start "1131 = proj1 1129":
+	#instruction start "1132 = %rax":
+	#instruction start "1133 = int_cast_zero 1132":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "1134 = constant(0)":
+	movl $0, %ebx
+	#instruction start "1135 = 1133 == 1134":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "1137 = if 1071 1135":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L55
+.L54:
+	#instruction start "1140 = constant(36)":
+	movq $.Ls36, %rbx
+	#instruction start "1141 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "1142 = constant(43)":
+	movl $43, %r13d
+	#instruction start "1143 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "1144 = alloc with size 8":
+	leaq -2540(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1145 = store 1144 1140, state: 1130":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1146 = alloc with size 8":
+	leaq -2548(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1147 = store 1146 1141, state: 1145":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1148 = alloc with size 4":
+	leaq -2552(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1149 = store 1148 1142, state: 1147":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1150 = alloc with size 8":
+	leaq -2560(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1151 = store 1150 1143, state: 1149":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1152 = constant(2)":
+	leaq -1392(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1153 = constant(0)":
+	leaq -1400(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1154 = load part address of 1144 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1155 = proj0 1154":
+	#instruction start "1156 = proj1 1154":
+	#instruction start "1157 = load part address of 1146 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1158 = proj0 1157":
+	#instruction start "1159 = proj1 1157":
+	#instruction start "1160 = load part address of 1148 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1161 = proj0 1160":
+	#instruction start "1162 = proj1 1160":
+	#instruction start "1163 = load part address of 1150 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1164 = proj0 1163":
+	#instruction start "1165 = proj1 1163":
+	#instruction start "1166 = allocate_call_stack 0":
+	#instruction start "1167 = set_reg %rdi 1156":
+	#instruction start "1168 = set_reg %rsi 1159 state: 1167":
+	#instruction start "1169 = set_reg %rdx 1162 state: 1168":
+	#instruction start "1170 = set_reg %rcx 1165 state: 1169":
+	#instruction start "1171 = set_reg %rax 1153 state: 1170":
+	#instruction start "1172 = call 1152":
+	addq $0, %rsp
+	movq -1400(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1392(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1173 = proj0 1172":
+	#instruction start "1174 = proj1 1172":
+	#Block jump
+	jmp .L56
+.L55:
+	#Block jump elided
+.L56:
+	#instruction start "1175 = constant(37)":
+	movq $.Ls37, %rbx
+	#instruction start "1176 = constant(37)":
+	movq $.Ls37, %r12
+	#instruction start "1177 = alloc with size 8":
+	leaq -2568(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1178 = phi (region: 1136) 1130 1173":
+	#instruction start "1179 = store 1177 1175, state: 1178":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1180 = alloc with size 8":
+	leaq -2576(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1181 = store 1180 1176, state: 1179":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1182 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "1183 = constant(0)":
+	movq $0, %r14
+	#instruction start "1184 = load part address of 1177 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1185 = proj0 1184":
+	#instruction start "1186 = proj1 1184":
+	#instruction start "1187 = load part address of 1180 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "1188 = proj0 1187":
+	#instruction start "1189 = proj1 1187":
+	#instruction start "1190 = allocate_call_stack 0":
+	#instruction start "1191 = set_reg %rdi 1186":
+	#instruction start "1192 = set_reg %rsi 1189 state: 1191":
+	#instruction start "1193 = set_reg %rax 1183 state: 1192":
+	#instruction start "1194 = call 1182":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "1195 = proj0 1194":
+	#instruction start "1196 = proj1 1194":
+	#instruction start "1197 = %rax":
+	#instruction start "1198 = int_cast_zero 1197":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "1199 = constant(0)":
+	movl $0, %ebx
+	#instruction start "1200 = 1198 == 1199":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "1202 = if 1136 1200":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L58
+.L57:
+	#instruction start "1205 = constant(38)":
+	movq $.Ls38, %rbx
+	#instruction start "1206 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "1207 = constant(46)":
+	movl $46, %r13d
+	#instruction start "1208 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "1209 = alloc with size 8":
+	leaq -2584(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1210 = store 1209 1205, state: 1195":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1211 = alloc with size 8":
+	leaq -2592(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1212 = store 1211 1206, state: 1210":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1213 = alloc with size 4":
+	leaq -2596(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1214 = store 1213 1207, state: 1212":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1215 = alloc with size 8":
+	leaq -2604(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1216 = store 1215 1208, state: 1214":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1217 = constant(2)":
+	leaq -1472(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1218 = constant(0)":
+	leaq -1480(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1219 = load part address of 1209 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1220 = proj0 1219":
+	#instruction start "1221 = proj1 1219":
+	#instruction start "1222 = load part address of 1211 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1223 = proj0 1222":
+	#instruction start "1224 = proj1 1222":
+	#instruction start "1225 = load part address of 1213 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1226 = proj0 1225":
+	#instruction start "1227 = proj1 1225":
+	#instruction start "1228 = load part address of 1215 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1229 = proj0 1228":
+	#instruction start "1230 = proj1 1228":
+	#instruction start "1231 = allocate_call_stack 0":
+	#instruction start "1232 = set_reg %rdi 1221":
+	#instruction start "1233 = set_reg %rsi 1224 state: 1232":
+	#instruction start "1234 = set_reg %rdx 1227 state: 1233":
+	#instruction start "1235 = set_reg %rcx 1230 state: 1234":
+	#instruction start "1236 = set_reg %rax 1218 state: 1235":
+	#instruction start "1237 = call 1217":
+	addq $0, %rsp
+	movq -1480(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1472(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1238 = proj0 1237":
+	#instruction start "1239 = proj1 1237":
+	#Block jump
+	jmp .L59
+.L58:
+	#Block jump elided
+.L59:
+	#instruction start "1240 = constant(39)":
+	movq $.Ls39, %rbx
+	#instruction start "1241 = constant(39)":
+	movq $.Ls39, %r12
+	#instruction start "1242 = alloc with size 8":
+	leaq -2612(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1243 = phi (region: 1201) 1195 1238":
+	#instruction start "1244 = store 1242 1240, state: 1243":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1245 = alloc with size 8":
+	leaq -2620(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1246 = store 1245 1241, state: 1244":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1247 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "1248 = constant(0)":
+	movq $0, %r14
+	#instruction start "1249 = load part address of 1242 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1250 = proj0 1249":
+	#instruction start "1251 = proj1 1249":
+	#instruction start "1252 = load part address of 1245 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "1253 = proj0 1252":
+	#instruction start "1254 = proj1 1252":
+	#instruction start "1255 = allocate_call_stack 0":
+	#instruction start "1256 = set_reg %rdi 1251":
+	#instruction start "1257 = set_reg %rsi 1254 state: 1256":
+	#instruction start "1258 = set_reg %rax 1248 state: 1257":
+	#instruction start "1259 = call 1247":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "1260 = proj0 1259":
+	#instruction start "1261 = proj1 1259":
+	#instruction start "1262 = %rax":
+	#instruction start "1263 = int_cast_zero 1262":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "1264 = constant(0)":
+	movl $0, %ebx
+	#instruction start "1265 = 1263 == 1264":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "1267 = if 1201 1265":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L61
+.L60:
+	#instruction start "1270 = constant(40)":
+	movq $.Ls40, %rbx
+	#instruction start "1271 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "1272 = constant(47)":
+	movl $47, %r13d
+	#instruction start "1273 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "1274 = alloc with size 8":
+	leaq -2628(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1275 = store 1274 1270, state: 1260":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1276 = alloc with size 8":
+	leaq -2636(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1277 = store 1276 1271, state: 1275":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1278 = alloc with size 4":
+	leaq -2640(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1279 = store 1278 1272, state: 1277":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1280 = alloc with size 8":
+	leaq -2648(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1281 = store 1280 1273, state: 1279":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1282 = constant(2)":
+	leaq -1552(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1283 = constant(0)":
+	leaq -1560(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1284 = load part address of 1274 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1285 = proj0 1284":
+	#instruction start "1286 = proj1 1284":
+	#instruction start "1287 = load part address of 1276 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1288 = proj0 1287":
+	#instruction start "1289 = proj1 1287":
+	#instruction start "1290 = load part address of 1278 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1291 = proj0 1290":
+	#instruction start "1292 = proj1 1290":
+	#instruction start "1293 = load part address of 1280 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1294 = proj0 1293":
+	#instruction start "1295 = proj1 1293":
+	#instruction start "1296 = allocate_call_stack 0":
+	#instruction start "1297 = set_reg %rdi 1286":
+	#instruction start "1298 = set_reg %rsi 1289 state: 1297":
+	#instruction start "1299 = set_reg %rdx 1292 state: 1298":
+	#instruction start "1300 = set_reg %rcx 1295 state: 1299":
+	#instruction start "1301 = set_reg %rax 1283 state: 1300":
+	#instruction start "1302 = call 1282":
+	addq $0, %rsp
+	movq -1560(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1552(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1303 = proj0 1302":
+	#instruction start "1304 = proj1 1302":
+	#Block jump
+	jmp .L62
+.L61:
+	#Block jump elided
+.L62:
+	#instruction start "1305 = constant(41)":
+	movq $.Ls41, %rbx
+	#instruction start "1306 = constant(41)":
+	movq $.Ls41, %r12
+	#instruction start "1307 = alloc with size 8":
+	leaq -2656(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1308 = phi (region: 1266) 1260 1303":
+	#instruction start "1309 = store 1307 1305, state: 1308":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1310 = alloc with size 8":
+	leaq -2664(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1311 = store 1310 1306, state: 1309":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1312 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "1313 = constant(0)":
+	movq $0, %r14
+	#instruction start "1314 = load part address of 1307 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1315 = proj0 1314":
+	#instruction start "1316 = proj1 1314":
+	#instruction start "1317 = load part address of 1310 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "1318 = proj0 1317":
+	#instruction start "1319 = proj1 1317":
+	#instruction start "1320 = allocate_call_stack 0":
+	#instruction start "1321 = set_reg %rdi 1316":
+	#instruction start "1322 = set_reg %rsi 1319 state: 1321":
+	#instruction start "1323 = set_reg %rax 1313 state: 1322":
+	#instruction start "1324 = call 1312":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "1325 = proj0 1324":
+	#instruction start "1326 = proj1 1324":
+	#instruction start "1327 = %rax":
+	#instruction start "1328 = int_cast_zero 1327":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "1329 = constant(0)":
+	movl $0, %ebx
+	#instruction start "1330 = 1328 == 1329":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "1332 = if 1266 1330":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L64
+.L63:
+	#instruction start "1335 = constant(42)":
+	movq $.Ls42, %rbx
+	#instruction start "1336 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "1337 = constant(51)":
+	movl $51, %r13d
+	#instruction start "1338 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "1339 = alloc with size 8":
+	leaq -2672(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1340 = store 1339 1335, state: 1325":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1341 = alloc with size 8":
+	leaq -2680(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1342 = store 1341 1336, state: 1340":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1343 = alloc with size 4":
+	leaq -2684(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1344 = store 1343 1337, state: 1342":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1345 = alloc with size 8":
+	leaq -2692(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1346 = store 1345 1338, state: 1344":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1347 = constant(2)":
+	leaq -1632(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1348 = constant(0)":
+	leaq -1640(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1349 = load part address of 1339 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1350 = proj0 1349":
+	#instruction start "1351 = proj1 1349":
+	#instruction start "1352 = load part address of 1341 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1353 = proj0 1352":
+	#instruction start "1354 = proj1 1352":
+	#instruction start "1355 = load part address of 1343 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1356 = proj0 1355":
+	#instruction start "1357 = proj1 1355":
+	#instruction start "1358 = load part address of 1345 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1359 = proj0 1358":
+	#instruction start "1360 = proj1 1358":
+	#instruction start "1361 = allocate_call_stack 0":
+	#instruction start "1362 = set_reg %rdi 1351":
+	#instruction start "1363 = set_reg %rsi 1354 state: 1362":
+	#instruction start "1364 = set_reg %rdx 1357 state: 1363":
+	#instruction start "1365 = set_reg %rcx 1360 state: 1364":
+	#instruction start "1366 = set_reg %rax 1348 state: 1365":
+	#instruction start "1367 = call 1347":
+	addq $0, %rsp
+	movq -1640(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1632(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1368 = proj0 1367":
+	#instruction start "1369 = proj1 1367":
+	#Block jump
+	jmp .L65
+.L64:
+	#Block jump elided
+.L65:
+	#instruction start "1370 = constant(43)":
+	movq $.Ls43, %rbx
+	#instruction start "1371 = constant(43)":
+	movq $.Ls43, %r12
+	#instruction start "1372 = alloc with size 8":
+	leaq -2700(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1373 = phi (region: 1331) 1325 1368":
+	#instruction start "1374 = store 1372 1370, state: 1373":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1375 = alloc with size 8":
+	leaq -2708(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1376 = store 1375 1371, state: 1374":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1377 = constant(0)":
+	movq $strcmp, %r12
+	#instruction start "1378 = constant(0)":
+	movq $0, %r14
+	#instruction start "1379 = load part address of 1372 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1380 = proj0 1379":
+	#instruction start "1381 = proj1 1379":
+	#instruction start "1382 = load part address of 1375 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "1383 = proj0 1382":
+	#instruction start "1384 = proj1 1382":
+	#instruction start "1385 = allocate_call_stack 0":
+	#instruction start "1386 = set_reg %rdi 1381":
+	#instruction start "1387 = set_reg %rsi 1384 state: 1386":
+	#instruction start "1388 = set_reg %rax 1378 state: 1387":
+	#instruction start "1389 = call 1377":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "1390 = proj0 1389":
+	#instruction start "1391 = proj1 1389":
+	#instruction start "1392 = %rax":
+	#instruction start "1393 = int_cast_zero 1392":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "1394 = constant(0)":
+	movl $0, %ebx
+	#instruction start "1395 = 1393 == 1394":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "1397 = if 1331 1395":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L67
+.L66:
+	#instruction start "1400 = constant(44)":
+	movq $.Ls44, %rbx
+	#instruction start "1401 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "1402 = constant(53)":
+	movl $53, %r13d
+	#instruction start "1403 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "1404 = alloc with size 8":
+	leaq -2716(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "1405 = store 1404 1400, state: 1390":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "1406 = alloc with size 8":
+	leaq -2724(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "1407 = store 1406 1401, state: 1405":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "1408 = alloc with size 4":
+	leaq -2728(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "1409 = store 1408 1402, state: 1407":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "1410 = alloc with size 8":
+	leaq -2736(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "1411 = store 1410 1403, state: 1409":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "1412 = constant(2)":
+	leaq -1712(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "1413 = constant(0)":
+	leaq -1720(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "1414 = load part address of 1404 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "1415 = proj0 1414":
+	#instruction start "1416 = proj1 1414":
+	#instruction start "1417 = load part address of 1406 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "1418 = proj0 1417":
+	#instruction start "1419 = proj1 1417":
+	#instruction start "1420 = load part address of 1408 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "1421 = proj0 1420":
+	#instruction start "1422 = proj1 1420":
+	#instruction start "1423 = load part address of 1410 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "1424 = proj0 1423":
+	#instruction start "1425 = proj1 1423":
+	#instruction start "1426 = allocate_call_stack 0":
+	#instruction start "1427 = set_reg %rdi 1416":
+	#instruction start "1428 = set_reg %rsi 1419 state: 1427":
+	#instruction start "1429 = set_reg %rdx 1422 state: 1428":
+	#instruction start "1430 = set_reg %rcx 1425 state: 1429":
+	#instruction start "1431 = set_reg %rax 1413 state: 1430":
+	#instruction start "1432 = call 1412":
+	addq $0, %rsp
+	movq -1720(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -1712(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "1433 = proj0 1432":
+	#instruction start "1434 = proj1 1432":
+	#Block jump
+	jmp .L68
+.L67:
+	#Block jump elided
+.L68:
+	#instruction start "1435 = constant(0)":
+	movl $0, %ebx
+	#instruction start "1436 = set_reg %rax 1435":
+	#instruction start "1437 = phi (region: 1396) 1390 1433":
+	#instruction start "1438 = return 1396, 1436, 1437":
+	movq %rbx, %rax
+	#Block return.
+	movq -2744(%rbp), %rbx
+	movq -2752(%rbp), %r12
+	movq -2760(%rbp), %r13
+	movq -2768(%rbp), %r14
+	movq -2776(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "Hello\000"
+.Ls3:
+	.string "strcmp(\"Hello\", \"Hello\") == 0\000"
+.Ls4:
+	.string "/root/repo/tests/stringify.c\000"
+.Ls5:
+	.string "main"
+.Ls6:
+	.string "Fr5tlPS93T\000"
+.Ls7:
+	.string "strcmp(\"Fr5tlPS93T\", \"Fr5tlPS93T\") == 0\000"
+.Ls8:
+	.string "HELLO THERE!\000"
+.Ls9:
+	.string "strcmp(STR(HELLO THERE!), \"HELLO THERE!\") == 0\000"
+.Ls10:
+	.string "GLUE(AAA, BBB)\000"
+.Ls11:
+	.string "strcmp(STR(GLUE(AAA, BBB)), \"GLUE(AAA, BBB)\") == 0\000"
+.Ls12:
+	.string "\"Hello World!\\n\"\000"
+.Ls13:
+	.string "strcmp(STR(\"Hello World!\\n\"), \"\\\"Hello World!\\\\n\\\"\") == 0\000"
+.Ls14:
+	.string "A70\000"
+.Ls15:
+	.string "strcmp(STR(A) STR(70), \"A70\") == 0\000"
+.Ls16:
+	.string "A, B\000"
+.Ls17:
+	.string "strcmp(VA_STR(A, B), \"A, B\") == 0\000"
+.Ls18:
+	.string "\000"
+.Ls19:
+	.string "strcmp(VA_STR(), \"\") == 0\000"
+.Ls20:
+	.string ", AB\000"
+.Ls21:
+	.string "strcmp(VA_STR(, GLUE(A, B)), \", AB\") == 0\000"
+.Ls22:
+	.string ",AB\000"
+.Ls23:
+	.string "strcmp(VA_STR(,GLUE(A, B)), \",AB\") == 0\000"
+.Ls24:
+	.string "A 31\000"
+.Ls25:
+	.string "strcmp(VA_STR(F2(A)), \"A 31\") == 0\000"
+.Ls26:
+	.string "A B\000"
+.Ls27:
+	.string "strcmp(VA_STR(F(A)), \"A B\") == 0\000"
+.Ls28:
+	.string "XXX YYY XXX YYY\000"
+.Ls29:
+	.string "strcmp(VA_STR(F3 F3), \"XXX YYY XXX YYY\") == 0\000"
+.Ls30:
+	.string "(M)\000"
+.Ls31:
+	.string "strcmp(VA_STR(F4( M)), \"(M)\") == 0\000"
+.Ls32:
+	.string "strcmp(VA_STR(F4(M )), \"(M)\") == 0\000"
+.Ls33:
+	.string "(M .)\000"
+.Ls34:
+	.string "strcmp(VA_STR(F4( M .)), \"(M .)\") == 0\000"
+.Ls35:
+	.string "(M.)\000"
+.Ls36:
+	.string "strcmp(VA_STR(F4( M.)), \"(M.)\") == 0\000"
+.Ls37:
+	.string "f.\000"
+.Ls38:
+	.string "strcmp(VA_STR(F5 (f).), \"f.\") == 0\000"
+.Ls39:
+	.string "f .\000"
+.Ls40:
+	.string "strcmp(VA_STR(F5(f) .), \"f .\") == 0\000"
+.Ls41:
+	.string "x ## y\000"
+.Ls42:
+	.string "strcmp(VA_STR(x hash_glue y), \"x ## y\") == 0\000"
+.Ls43:
+	.string "\"\\\"Hello\\\"\"\000"
+.Ls44:
+	.string "strcmp(VA_STR(VA_STR(\"Hello\")), \"\\\"\\\\\\\"Hello\\\\\\\"\\\"\") == 0\000"
@@ -0,0 +1,493 @@
+.global func
+func:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -26(%rbp)
+	movq %r12, -34(%rbp)
+	movq %r13, -42(%rbp)
+	movq %r14, -50(%rbp)
+	movq %r15, -58(%rbp)
+	movl %edi, %ebx
+	movl %esi, %r12d
+	movb %dl, -1(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = %rsi":
+	#instruction start "8 = %rdx":
+	#instruction start "9 = alloc with size 4":
+	leaq -13(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "10 = alloc with size 4":
+	leaq -17(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "11 = alloc with size 1":
+	leaq -18(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "12 = store part of 9 with offset 0":
+	movq %r14, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "13 = store part of 10 with offset 0":
+	movq %r15, %rsi
+	leaq (%rsi), %rsi
+	movl %r12d, (%rsi)
+	#instruction start "14 = store part of 11 with offset 0":
+	movq %r13, %rsi
+	leaq (%rsi), %rsi
+	leaq -1(%rbp), %rdi
+	movb (%rdi), %al
+	movb %al, (%rsi)
+	#instruction start "15 = load 10, state: 14":
+	movq %r15, %rdi
+	movl (%rdi), %ebx
+	#instruction start "16 = set_reg %rax 15":
+	#instruction start "17 = return 2, 16, 14":
+	movq %rbx, %rax
+	#Block return.
+	movq -26(%rbp), %rbx
+	movq -34(%rbp), %r12
+	movq -42(%rbp), %r13
+	movq -50(%rbp), %r14
+	movq -58(%rbp), %r15
+	leave 
+	ret 
+.global func2
+func2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -26(%rbp)
+	movq %r12, -34(%rbp)
+	movq %r13, -42(%rbp)
+	movq %r14, -50(%rbp)
+	movq %r15, -58(%rbp)
+	movl %edi, %ebx
+	movl %esi, %r12d
+	movb %dl, -1(%rbp)
+.L3:
+	#instruction start "21 = proj3 19":
+	#instruction start "22 = proj1 19":
+	#instruction start "24 = %rdi":
+	#instruction start "25 = %rsi":
+	#instruction start "26 = %rdx":
+	#instruction start "27 = alloc with size 4":
+	leaq -13(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "28 = alloc with size 4":
+	leaq -17(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "29 = alloc with size 1":
+	leaq -18(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "30 = store part of 27 with offset 0":
+	movq %r14, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "31 = store part of 28 with offset 0":
+	movq %r15, %rsi
+	leaq (%rsi), %rsi
+	movl %r12d, (%rsi)
+	#instruction start "32 = store part of 29 with offset 0":
+	movq %r13, %rsi
+	leaq (%rsi), %rsi
+	leaq -1(%rbp), %rdi
+	movb (%rdi), %al
+	movb %al, (%rsi)
+	#instruction start "33 = constant(10)":
+	movl $10, %ebx
+	#instruction start "34 = set_reg %rax 33":
+	#instruction start "35 = return 20, 34, 32":
+	movq %rbx, %rax
+	#Block return.
+	movq -26(%rbp), %rbx
+	movq -34(%rbp), %r12
+	movq -42(%rbp), %r13
+	movq -50(%rbp), %r14
+	movq -58(%rbp), %r15
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $320, %rsp
+	movq %rbx, -282(%rbp)
+	movq %r12, -290(%rbp)
+	movq %r13, -298(%rbp)
+	movq %r14, -306(%rbp)
+	movq %r15, -314(%rbp)
+.L4:
+	#instruction start "39 = proj3 37":
+	#instruction start "42 = constant(1)":
+	movl $1, %ebx
+	#instruction start "43 = bool_cast 42":
+	movq %rbx, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %r12d
+	#instruction start "44 = alloc with size 4":
+	leaq -204(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "45 = constant(3)":
+	movl $3, %r13d
+	#instruction start "46 = store 44 45, state: 39":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "47 = alloc with size 4":
+	leaq -208(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "48 = constant(4)":
+	movl $4, %r14d
+	#instruction start "49 = store 47 48, state: 46":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "50 = alloc with size 1":
+	leaq -209(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "51 = store 50 43, state: 49":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "52 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $func, (%rdi)
+	#instruction start "53 = constant(0)":
+	movq $0, %r15
+	#instruction start "54 = load part address of 44 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "55 = proj0 54":
+	#instruction start "56 = proj1 54":
+	#instruction start "57 = load part address of 47 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "58 = proj0 57":
+	#instruction start "59 = proj1 57":
+	#instruction start "60 = load part address of 50 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movzbl (%rdi), %r13d
+	#instruction start "61 = proj0 60":
+	#instruction start "62 = proj1 60":
+	#instruction start "63 = allocate_call_stack 0":
+	#instruction start "64 = set_reg %rdi 56":
+	#instruction start "65 = set_reg %rsi 59 state: 64":
+	#instruction start "66 = set_reg %rdx 62 state: 65":
+	#instruction start "67 = set_reg %rax 53 state: 66":
+	#instruction start "68 = call 52":
+	addq $0, %rsp
+	movq %r15, %rax
+	movq %r13, %rdx
+	movq %rbx, %rsi
+	movq %r12, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r14
+	#instruction start "69 = proj0 68":
+	#instruction start "70 = proj1 68":
+	#instruction start "71 = %rax":
+	#instruction start "72 = int_cast_zero 71":
+	movq %r14, %rax
+	movl %eax, %ebx
+	#instruction start "73 = constant(4)":
+	movl $4, %r12d
+	#instruction start "74 = 72 == 73":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "76 = if 38 74":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L6
+.L5:
+	#instruction start "79 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "80 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "81 = constant(14)":
+	movl $14, %r13d
+	#instruction start "82 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "83 = alloc with size 8":
+	leaq -217(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "84 = store 83 79, state: 69":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "85 = alloc with size 8":
+	leaq -225(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "86 = store 85 80, state: 84":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "87 = alloc with size 4":
+	leaq -229(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "88 = store 87 81, state: 86":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "89 = alloc with size 8":
+	leaq -237(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "90 = store 89 82, state: 88":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "91 = constant(1)":
+	leaq -48(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "92 = constant(0)":
+	leaq -56(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "93 = load part address of 83 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "94 = proj0 93":
+	#instruction start "95 = proj1 93":
+	#instruction start "96 = load part address of 85 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "97 = proj0 96":
+	#instruction start "98 = proj1 96":
+	#instruction start "99 = load part address of 87 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "100 = proj0 99":
+	#instruction start "101 = proj1 99":
+	#instruction start "102 = load part address of 89 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "103 = proj0 102":
+	#instruction start "104 = proj1 102":
+	#instruction start "105 = allocate_call_stack 0":
+	#instruction start "106 = set_reg %rdi 95":
+	#instruction start "107 = set_reg %rsi 98 state: 106":
+	#instruction start "108 = set_reg %rdx 101 state: 107":
+	#instruction start "109 = set_reg %rcx 104 state: 108":
+	#instruction start "110 = set_reg %rax 92 state: 109":
+	#instruction start "111 = call 91":
+	addq $0, %rsp
+	movq -56(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -48(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "112 = proj0 111":
+	#instruction start "113 = proj1 111":
+	#Block jump
+	jmp .L7
+.L6:
+	#Block jump elided
+.L7:
+	#instruction start "114 = constant(0)":
+	movl $0, %ebx
+	#instruction start "115 = bool_cast 114":
+	movq %rbx, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %r12d
+	#instruction start "116 = alloc with size 4":
+	leaq -241(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "117 = constant(1)":
+	movl $1, %r13d
+	#instruction start "118 = phi (region: 75) 69 112":
+	#instruction start "119 = store 116 117, state: 118":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "120 = alloc with size 4":
+	leaq -245(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "121 = constant(1)":
+	movl $1, %r14d
+	#instruction start "122 = store 120 121, state: 119":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "123 = alloc with size 1":
+	leaq -246(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "124 = store 123 115, state: 122":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "125 = constant(5)":
+	leaq -104(%rbp), %rdi
+	movq $func2, (%rdi)
+	#instruction start "126 = constant(0)":
+	movq $0, %r15
+	#instruction start "127 = load part address of 116 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "128 = proj0 127":
+	#instruction start "129 = proj1 127":
+	#instruction start "130 = load part address of 120 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "131 = proj0 130":
+	#instruction start "132 = proj1 130":
+	#instruction start "133 = load part address of 123 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movzbl (%rdi), %r13d
+	#instruction start "134 = proj0 133":
+	#instruction start "135 = proj1 133":
+	#instruction start "136 = allocate_call_stack 0":
+	#instruction start "137 = set_reg %rdi 129":
+	#instruction start "138 = set_reg %rsi 132 state: 137":
+	#instruction start "139 = set_reg %rdx 135 state: 138":
+	#instruction start "140 = set_reg %rax 126 state: 139":
+	#instruction start "141 = call 125":
+	addq $0, %rsp
+	movq %r15, %rax
+	movq %r13, %rdx
+	movq %rbx, %rsi
+	movq %r12, %rdi
+	movq -104(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r14
+	#instruction start "142 = proj0 141":
+	#instruction start "143 = proj1 141":
+	#instruction start "144 = %rax":
+	#instruction start "145 = int_cast_zero 144":
+	movq %r14, %rax
+	movl %eax, %ebx
+	#instruction start "146 = constant(10)":
+	movl $10, %r12d
+	#instruction start "147 = 145 == 146":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "149 = if 75 147":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L9
+.L8:
+	#instruction start "152 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "153 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "154 = constant(15)":
+	movl $15, %r13d
+	#instruction start "155 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "156 = alloc with size 8":
+	leaq -254(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "157 = store 156 152, state: 142":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "158 = alloc with size 8":
+	leaq -262(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "159 = store 158 153, state: 157":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "160 = alloc with size 4":
+	leaq -266(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "161 = store 160 154, state: 159":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "162 = alloc with size 8":
+	leaq -274(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "163 = store 162 155, state: 161":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "164 = constant(1)":
+	leaq -144(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "165 = constant(0)":
+	leaq -152(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "166 = load part address of 156 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "167 = proj0 166":
+	#instruction start "168 = proj1 166":
+	#instruction start "169 = load part address of 158 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "170 = proj0 169":
+	#instruction start "171 = proj1 169":
+	#instruction start "172 = load part address of 160 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "173 = proj0 172":
+	#instruction start "174 = proj1 172":
+	#instruction start "175 = load part address of 162 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "176 = proj0 175":
+	#instruction start "177 = proj1 175":
+	#instruction start "178 = allocate_call_stack 0":
+	#instruction start "179 = set_reg %rdi 168":
+	#instruction start "180 = set_reg %rsi 171 state: 179":
+	#instruction start "181 = set_reg %rdx 174 state: 180":
+	#instruction start "182 = set_reg %rcx 177 state: 181":
+	#instruction start "183 = set_reg %rax 165 state: 182":
+	#instruction start "184 = call 164":
+	addq $0, %rsp
+	movq -152(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -144(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "185 = proj0 184":
+	#instruction start "186 = proj1 184":
+	#Block jump
+	jmp .L10
+.L9:
+	#Block jump elided
+.L10:
+	#instruction start "187 = constant(0)":
+	movl $0, %ebx
+	#instruction start "188 = set_reg %rax 187":
+	#instruction start "189 = phi (region: 148) 142 185":
+	#instruction start "190 = return 148, 188, 189":
+	movq %rbx, %rax
+	#Block return.
+	movq -282(%rbp), %rbx
+	movq -290(%rbp), %r12
+	movq -298(%rbp), %r13
+	movq -306(%rbp), %r14
+	movq -314(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls2:
+	.string "func(3, 4, 1) == 4\000"
+.Ls3:
+	.string "/root/repo/tests/unnamed_paramters.c\000"
+.Ls4:
+	.string "main"
+.Ls6:
+	.string "func2(1, 1, 0) == 10\000"
@@ -0,0 +1,228 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rbx, -112(%rbp)
+	movq %r12, -120(%rbp)
+	movq %r13, -128(%rbp)
+	movq %r14, -136(%rbp)
+	movq %r15, -144(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(0)":
+	movq $t+8, %rbx
+	#instruction start "7 = load_volatile 6, state: 3":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "8 = proj0 7":
+	#instruction start "9 = proj1 7":
+	#instruction start "10 = constant(1)":
+	movl $1, %ebx
+	#instruction start "11 = 9 == 10":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "12 = if 2 11":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "32 = alloc with size 4":
+	leaq -68(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "33 = constant(0)":
+	movl $0, %r12d
+	#instruction start "34 = store 32 33, state: 8":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 36 (35 31 32)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L8
+.L4:
+	#instruction start "15 = constant(0)":
+	movq $t+12, %rbx
+	#instruction start "16 = load_volatile 15, state: 8":
+	movq %rbx, %rdi
+	movl (%rdi), %r13d
+	#instruction start "17 = proj0 16":
+	#instruction start "18 = proj1 16":
+	#instruction start "19 = constant(2)":
+	movl $2, %ebx
+	#instruction start "20 = 18 == 19":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "21 = if 14 20":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L6
+.L5:
+	#instruction start "27 = alloc with size 4":
+	leaq -72(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "28 = constant(0)":
+	movl $0, %r13d
+	#instruction start "29 = store 27 28, state: 17":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 31 (30 24 27)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L7
+.L6:
+	#instruction start "24 = alloc with size 4":
+	leaq -76(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "25 = constant(1)":
+	movl $1, %r14d
+	#instruction start "26 = store 24 25, state: 17":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 31 (30 24 27)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L7:
+	#instruction start "31 = phi (region: 30) 24 27":
+	#instruction start "38 = phi (region: 30) 26 29":
+	#Phi node to 36 (35 31 32)
+	movq %r13, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L8:
+	#instruction start "36 = phi (region: 35) 31 32":
+	#instruction start "37 = phi (region: 35) 38 34":
+	#instruction start "39 = load_volatile 36, state: 37":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "40 = proj0 39":
+	#instruction start "41 = proj1 39":
+	#instruction start "43 = if 35 41":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "46 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "47 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "48 = constant(11)":
+	movl $11, %r13d
+	#instruction start "49 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "50 = alloc with size 8":
+	leaq -84(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "51 = store 50 46, state: 40":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "52 = alloc with size 8":
+	leaq -92(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "53 = store 52 47, state: 51":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "54 = alloc with size 4":
+	leaq -96(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "55 = store 54 48, state: 53":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "56 = alloc with size 8":
+	leaq -104(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "57 = store 56 49, state: 55":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "58 = constant(1)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "59 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "60 = load part address of 50 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "61 = proj0 60":
+	#instruction start "62 = proj1 60":
+	#instruction start "63 = load part address of 52 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "64 = proj0 63":
+	#instruction start "65 = proj1 63":
+	#instruction start "66 = load part address of 54 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "67 = proj0 66":
+	#instruction start "68 = proj1 66":
+	#instruction start "69 = load part address of 56 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "70 = proj0 69":
+	#instruction start "71 = proj1 69":
+	#instruction start "72 = allocate_call_stack 0":
+	#instruction start "73 = set_reg %rdi 62":
+	#instruction start "74 = set_reg %rsi 65 state: 73":
+	#instruction start "75 = set_reg %rdx 68 state: 74":
+	#instruction start "76 = set_reg %rcx 71 state: 75":
+	#instruction start "77 = set_reg %rax 59 state: 76":
+	#instruction start "78 = call 58":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "79 = proj0 78":
+	#instruction start "80 = proj1 78":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "81 = constant(0)":
+	movl $0, %ebx
+	#instruction start "82 = set_reg %rax 81":
+	#instruction start "83 = phi (region: 42) 40 79":
+	#instruction start "84 = return 42, 82, 83":
+	movq %rbx, %rax
+	#Block return.
+	movq -112(%rbp), %rbx
+	movq -120(%rbp), %r12
+	movq -128(%rbp), %r13
+	movq -136(%rbp), %r14
+	movq -144(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls2:
+	.string "t.c == 1 && t.d == 2\000"
+.Ls3:
+	.string "/root/repo/tests/anonymous_struct.c\000"
+.Ls4:
+	.string "main"
+.section .data
+.align 4
+.global t
+t:
+.quad 0
+.quad 8589934593
+.section .text
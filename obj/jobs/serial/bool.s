@@ -0,0 +1,1023 @@
+.global ret_true
+ret_true:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rbx, -16(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(1)":
+	movl $1, %ebx
+	#instruction start "7 = set_reg %rax 6":
+	#instruction start "8 = return 2, 7, 3":
+	movq %rbx, %rax
+	#Block return.
+	movq -16(%rbp), %rbx
+	leave 
+	ret 
+.global ret_false
+ret_false:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rbx, -16(%rbp)
+.L3:
+	#instruction start "12 = proj3 10":
+	#instruction start "15 = constant(0)":
+	movl $0, %ebx
+	#instruction start "16 = set_reg %rax 15":
+	#instruction start "17 = return 11, 16, 12":
+	movq %rbx, %rax
+	#Block return.
+	movq -16(%rbp), %rbx
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $592, %rsp
+	movq %rbx, -552(%rbp)
+	movq %r12, -560(%rbp)
+	movq %r13, -568(%rbp)
+	movq %r14, -576(%rbp)
+	movq %r15, -584(%rbp)
+.L4:
+	#instruction start "21 = proj3 19":
+	#instruction start "24 = constant(1)":
+	movq $ret_true, %rbx
+	#instruction start "25 = constant(0)":
+	movq $0, %r12
+	#instruction start "26 = allocate_call_stack 0":
+	#instruction start "27 = set_reg %rax 25":
+	#instruction start "28 = call 24":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "29 = proj0 28":
+	#instruction start "30 = proj1 28":
+	#instruction start "31 = %rax":
+	#instruction start "32 = int_cast_zero 31":
+	movq %r13, %rax
+	movzbl %al, %ebx
+	#instruction start "33 = int_cast_zero 32":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "34 = if 20 33":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L9
+.L5:
+	#instruction start "40 = constant(2)":
+	movq $ret_false, %rbx
+	#instruction start "41 = constant(0)":
+	movq $0, %r12
+	#instruction start "42 = allocate_call_stack 0":
+	#instruction start "43 = set_reg %rax 41":
+	#instruction start "44 = call 40":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "45 = proj0 44":
+	#instruction start "46 = proj1 44":
+	#instruction start "47 = %rax":
+	#instruction start "48 = int_cast_zero 47":
+	movq %r13, %rax
+	movzbl %al, %ebx
+	#instruction start "49 = int_cast_zero 48":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "50 = if 35 49":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "56 = alloc with size 4":
+	leaq -348(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "57 = constant(0)":
+	movl $0, %r12d
+	#instruction start "58 = store 56 57, state: 45":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 60 (59 53 56)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L8
+.L7:
+	#instruction start "53 = alloc with size 4":
+	leaq -352(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "54 = constant(1)":
+	movl $1, %r13d
+	#instruction start "55 = store 53 54, state: 45":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 60 (59 53 56)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L8:
+	#instruction start "60 = phi (region: 59) 53 56":
+	#instruction start "64 = phi (region: 59) 55 58":
+	#Phi node to 62 (61 37 60)
+	movq %r12, %rax
+	movq %rax, %rbx
+	#Block jump
+	jmp .L10
+.L9:
+	#instruction start "37 = alloc with size 4":
+	leaq -356(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "38 = constant(1)":
+	movl $1, %r13d
+	#instruction start "39 = store 37 38, state: 29":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 62 (61 37 60)
+	movq %r12, %rax
+	movq %rax, %rbx
+	#Block jump elided
+.L10:
+	#instruction start "62 = phi (region: 61) 37 60":
+	#instruction start "63 = phi (region: 61) 39 64":
+	#instruction start "65 = load_volatile 62, state: 63":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "66 = proj0 65":
+	#instruction start "67 = proj1 65":
+	#instruction start "69 = if 61 67":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L12
+.L11:
+	#instruction start "72 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "73 = constant(5)":
+	movq $.Ls5, %r12
+	#instruction start "74 = constant(25)":
+	movl $25, %r13d
+	#instruction start "75 = constant(6)":
+	movq $.Ls6, %r14
+	#instruction start "76 = alloc with size 8":
+	leaq -364(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "77 = store 76 72, state: 66":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "78 = alloc with size 8":
+	leaq -372(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "79 = store 78 73, state: 77":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "80 = alloc with size 4":
+	leaq -376(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "81 = store 80 74, state: 79":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "82 = alloc with size 8":
+	leaq -384(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "83 = store 82 75, state: 81":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "84 = constant(3)":
+	leaq -24(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "85 = constant(0)":
+	leaq -32(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "86 = load part address of 76 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "87 = proj0 86":
+	#instruction start "88 = proj1 86":
+	#instruction start "89 = load part address of 78 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "90 = proj0 89":
+	#instruction start "91 = proj1 89":
+	#instruction start "92 = load part address of 80 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "93 = proj0 92":
+	#instruction start "94 = proj1 92":
+	#instruction start "95 = load part address of 82 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "96 = proj0 95":
+	#instruction start "97 = proj1 95":
+	#instruction start "98 = allocate_call_stack 0":
+	#instruction start "99 = set_reg %rdi 88":
+	#instruction start "100 = set_reg %rsi 91 state: 99":
+	#instruction start "101 = set_reg %rdx 94 state: 100":
+	#instruction start "102 = set_reg %rcx 97 state: 101":
+	#instruction start "103 = set_reg %rax 85 state: 102":
+	#instruction start "104 = call 84":
+	addq $0, %rsp
+	movq -32(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -24(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "105 = proj0 104":
+	#instruction start "106 = proj1 104":
+	#Block jump
+	jmp .L13
+.L12:
+	#Block jump elided
+.L13:
+	#instruction start "107 = constant(2)":
+	movq $ret_false, %rbx
+	#instruction start "108 = constant(0)":
+	movq $0, %r12
+	#instruction start "109 = allocate_call_stack 0":
+	#instruction start "110 = set_reg %rax 108":
+	#instruction start "111 = phi (region: 68) 66 105":
+	#instruction start "112 = call 107":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "113 = proj0 112":
+	#instruction start "114 = proj1 112":
+	#instruction start "115 = %rax":
+	#instruction start "116 = int_cast_zero 115":
+	movq %r13, %rax
+	movzbl %al, %ebx
+	#instruction start "117 = int_cast_zero 116":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "118 = if 68 117":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L15
+.L14:
+	#instruction start "124 = alloc with size 4":
+	leaq -388(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "125 = constant(1)":
+	movl $1, %r12d
+	#instruction start "126 = store 124 125, state: 113":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 128 (127 121 124)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L16
+.L15:
+	#instruction start "121 = alloc with size 4":
+	leaq -392(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "122 = constant(0)":
+	movl $0, %r13d
+	#instruction start "123 = store 121 122, state: 113":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 128 (127 121 124)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L16:
+	#instruction start "128 = phi (region: 127) 121 124":
+	#instruction start "129 = phi (region: 127) 123 126":
+	#instruction start "130 = load_volatile 128, state: 129":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "131 = proj0 130":
+	#instruction start "132 = proj1 130":
+	#instruction start "134 = if 127 132":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L18
+.L17:
+	#instruction start "137 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "138 = constant(5)":
+	movq $.Ls5, %r12
+	#instruction start "139 = constant(26)":
+	movl $26, %r13d
+	#instruction start "140 = constant(6)":
+	movq $.Ls6, %r14
+	#instruction start "141 = alloc with size 8":
+	leaq -400(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "142 = store 141 137, state: 131":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "143 = alloc with size 8":
+	leaq -408(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "144 = store 143 138, state: 142":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "145 = alloc with size 4":
+	leaq -412(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "146 = store 145 139, state: 144":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "147 = alloc with size 8":
+	leaq -420(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "148 = store 147 140, state: 146":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "149 = constant(3)":
+	leaq -88(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "150 = constant(0)":
+	leaq -96(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "151 = load part address of 141 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "152 = proj0 151":
+	#instruction start "153 = proj1 151":
+	#instruction start "154 = load part address of 143 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "155 = proj0 154":
+	#instruction start "156 = proj1 154":
+	#instruction start "157 = load part address of 145 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "158 = proj0 157":
+	#instruction start "159 = proj1 157":
+	#instruction start "160 = load part address of 147 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "161 = proj0 160":
+	#instruction start "162 = proj1 160":
+	#instruction start "163 = allocate_call_stack 0":
+	#instruction start "164 = set_reg %rdi 153":
+	#instruction start "165 = set_reg %rsi 156 state: 164":
+	#instruction start "166 = set_reg %rdx 159 state: 165":
+	#instruction start "167 = set_reg %rcx 162 state: 166":
+	#instruction start "168 = set_reg %rax 150 state: 167":
+	#instruction start "169 = call 149":
+	addq $0, %rsp
+	movq -96(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -88(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "170 = proj0 169":
+	#instruction start "171 = proj1 169":
+	#Block jump
+	jmp .L19
+.L18:
+	#Block jump elided
+.L19:
+	#instruction start "172 = constant(1)":
+	movq $ret_true, %rbx
+	#instruction start "173 = constant(0)":
+	movq $0, %r12
+	#instruction start "174 = allocate_call_stack 0":
+	#instruction start "175 = set_reg %rax 173":
+	#instruction start "176 = phi (region: 133) 131 170":
+	#instruction start "177 = call 172":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "178 = proj0 177":
+	#instruction start "179 = proj1 177":
+	#instruction start "180 = %rax":
+	#instruction start "181 = int_cast_zero 180":
+	movq %r13, %rax
+	movzbl %al, %ebx
+	#instruction start "182 = int_cast_zero 181":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "183 = if 133 182":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L21
+.L20:
+	#instruction start "207 = alloc with size 4":
+	leaq -424(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "208 = constant(0)":
+	movl $0, %r12d
+	#instruction start "209 = store 207 208, state: 178":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 211 (210 206 207)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L25
+.L21:
+	#instruction start "186 = constant(2)":
+	movq $ret_false, %rbx
+	#instruction start "187 = constant(0)":
+	movq $0, %r13
+	#instruction start "188 = allocate_call_stack 0":
+	#instruction start "189 = set_reg %rax 187":
+	#instruction start "190 = call 186":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r14
+	#instruction start "191 = proj0 190":
+	#instruction start "192 = proj1 190":
+	#instruction start "193 = %rax":
+	#instruction start "194 = int_cast_zero 193":
+	movq %r14, %rax
+	movzbl %al, %ebx
+	#instruction start "195 = int_cast_zero 194":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "196 = if 185 195":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L23
+.L22:
+	#instruction start "202 = alloc with size 4":
+	leaq -428(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "203 = constant(0)":
+	movl $0, %r13d
+	#instruction start "204 = store 202 203, state: 191":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 206 (205 199 202)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L24
+.L23:
+	#instruction start "199 = alloc with size 4":
+	leaq -432(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "200 = constant(1)":
+	movl $1, %r14d
+	#instruction start "201 = store 199 200, state: 191":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 206 (205 199 202)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L24:
+	#instruction start "206 = phi (region: 205) 199 202":
+	#instruction start "213 = phi (region: 205) 201 204":
+	#Phi node to 211 (210 206 207)
+	movq %r13, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L25:
+	#instruction start "211 = phi (region: 210) 206 207":
+	#instruction start "212 = phi (region: 210) 213 209":
+	#instruction start "214 = load_volatile 211, state: 212":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "215 = proj0 214":
+	#instruction start "216 = proj1 214":
+	#instruction start "217 = if 210 216":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L27
+.L26:
+	#instruction start "223 = alloc with size 4":
+	leaq -436(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "224 = constant(1)":
+	movl $1, %r12d
+	#instruction start "225 = store 223 224, state: 215":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 227 (226 220 223)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L28
+.L27:
+	#instruction start "220 = alloc with size 4":
+	leaq -440(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "221 = constant(0)":
+	movl $0, %r13d
+	#instruction start "222 = store 220 221, state: 215":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 227 (226 220 223)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L28:
+	#instruction start "227 = phi (region: 226) 220 223":
+	#instruction start "228 = phi (region: 226) 222 225":
+	#instruction start "229 = load_volatile 227, state: 228":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "230 = proj0 229":
+	#instruction start "231 = proj1 229":
+	#instruction start "233 = if 226 231":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L30
+.L29:
+	#instruction start "236 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "237 = constant(5)":
+	movq $.Ls5, %r12
+	#instruction start "238 = constant(27)":
+	movl $27, %r13d
+	#instruction start "239 = constant(6)":
+	movq $.Ls6, %r14
+	#instruction start "240 = alloc with size 8":
+	leaq -448(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "241 = store 240 236, state: 230":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "242 = alloc with size 8":
+	leaq -456(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "243 = store 242 237, state: 241":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "244 = alloc with size 4":
+	leaq -460(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "245 = store 244 238, state: 243":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "246 = alloc with size 8":
+	leaq -468(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "247 = store 246 239, state: 245":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "248 = constant(3)":
+	leaq -160(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "249 = constant(0)":
+	leaq -168(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "250 = load part address of 240 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "251 = proj0 250":
+	#instruction start "252 = proj1 250":
+	#instruction start "253 = load part address of 242 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "254 = proj0 253":
+	#instruction start "255 = proj1 253":
+	#instruction start "256 = load part address of 244 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "257 = proj0 256":
+	#instruction start "258 = proj1 256":
+	#instruction start "259 = load part address of 246 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "260 = proj0 259":
+	#instruction start "261 = proj1 259":
+	#instruction start "262 = allocate_call_stack 0":
+	#instruction start "263 = set_reg %rdi 252":
+	#instruction start "264 = set_reg %rsi 255 state: 263":
+	#instruction start "265 = set_reg %rdx 258 state: 264":
+	#instruction start "266 = set_reg %rcx 261 state: 265":
+	#instruction start "267 = set_reg %rax 249 state: 266":
+	#instruction start "268 = call 248":
+	addq $0, %rsp
+	movq -168(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -160(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "269 = proj0 268":
+	#instruction start "270 = proj1 268":
+	#Block jump
+	jmp .L31
+.L30:
+	#Block jump elided
+.L31:
+	#instruction start "271 = constant(1)":
+	movq $ret_true, %rbx
+	#instruction start "272 = constant(0)":
+	movq $0, %r12
+	#instruction start "273 = allocate_call_stack 0":
+	#instruction start "274 = set_reg %rax 272":
+	#instruction start "275 = phi (region: 232) 230 269":
+	#instruction start "276 = call 271":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "277 = proj0 276":
+	#instruction start "278 = proj1 276":
+	#instruction start "279 = %rax":
+	#instruction start "280 = int_cast_zero 279":
+	movq %r13, %rax
+	movzbl %al, %ebx
+	#instruction start "281 = int_cast_zero 280":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "282 = if 232 281":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L33
+.L32:
+	#instruction start "306 = alloc with size 4":
+	leaq -472(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "307 = constant(0)":
+	movl $0, %r12d
+	#instruction start "308 = store 306 307, state: 277":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 310 (309 305 306)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L37
+.L33:
+	#instruction start "285 = constant(2)":
+	movq $ret_false, %rbx
+	#instruction start "286 = constant(0)":
+	movq $0, %r13
+	#instruction start "287 = allocate_call_stack 0":
+	#instruction start "288 = set_reg %rax 286":
+	#instruction start "289 = call 285":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r14
+	#instruction start "290 = proj0 289":
+	#instruction start "291 = proj1 289":
+	#instruction start "292 = %rax":
+	#instruction start "293 = int_cast_zero 292":
+	movq %r14, %rax
+	movzbl %al, %ebx
+	#instruction start "294 = int_cast_zero 293":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "295 = if 284 294":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L35
+.L34:
+	#instruction start "301 = alloc with size 4":
+	leaq -476(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "302 = constant(0)":
+	movl $0, %r13d
+	#instruction start "303 = store 301 302, state: 290":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 305 (304 298 301)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L36
+.L35:
+	#instruction start "298 = alloc with size 4":
+	leaq -480(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "299 = constant(1)":
+	movl $1, %r14d
+	#instruction start "300 = store 298 299, state: 290":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 305 (304 298 301)
+	movq %rbx, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L36:
+	#instruction start "305 = phi (region: 304) 298 301":
+	#instruction start "312 = phi (region: 304) 300 303":
+	#Phi node to 310 (309 305 306)
+	movq %r13, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L37:
+	#instruction start "310 = phi (region: 309) 305 306":
+	#instruction start "311 = phi (region: 309) 312 308":
+	#instruction start "313 = load_volatile 310, state: 311":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "314 = proj0 313":
+	#instruction start "315 = proj1 313":
+	#instruction start "316 = if 309 315":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L39
+.L38:
+	#instruction start "322 = alloc with size 4":
+	leaq -484(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "323 = constant(1)":
+	movl $1, %r12d
+	#instruction start "324 = store 322 323, state: 314":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 326 (325 319 322)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L40
+.L39:
+	#instruction start "319 = alloc with size 4":
+	leaq -488(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "320 = constant(0)":
+	movl $0, %r13d
+	#instruction start "321 = store 319 320, state: 314":
+	movq %rbx, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 326 (325 319 322)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L40:
+	#instruction start "326 = phi (region: 325) 319 322":
+	#instruction start "327 = phi (region: 325) 321 324":
+	#instruction start "328 = load_volatile 326, state: 327":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "329 = proj0 328":
+	#instruction start "330 = proj1 328":
+	#instruction start "332 = if 325 330":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L42
+.L41:
+	#instruction start "335 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "336 = constant(5)":
+	movq $.Ls5, %r12
+	#instruction start "337 = constant(28)":
+	movl $28, %r13d
+	#instruction start "338 = constant(6)":
+	movq $.Ls6, %r14
+	#instruction start "339 = alloc with size 8":
+	leaq -496(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "340 = store 339 335, state: 329":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "341 = alloc with size 8":
+	leaq -504(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "342 = store 341 336, state: 340":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "343 = alloc with size 4":
+	leaq -508(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "344 = store 343 337, state: 342":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "345 = alloc with size 8":
+	leaq -516(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "346 = store 345 338, state: 344":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "347 = constant(3)":
+	leaq -232(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "348 = constant(0)":
+	leaq -240(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "349 = load part address of 339 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "350 = proj0 349":
+	#instruction start "351 = proj1 349":
+	#instruction start "352 = load part address of 341 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "353 = proj0 352":
+	#instruction start "354 = proj1 352":
+	#instruction start "355 = load part address of 343 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "356 = proj0 355":
+	#instruction start "357 = proj1 355":
+	#instruction start "358 = load part address of 345 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "359 = proj0 358":
+	#instruction start "360 = proj1 358":
+	#instruction start "361 = allocate_call_stack 0":
+	#instruction start "362 = set_reg %rdi 351":
+	#instruction start "363 = set_reg %rsi 354 state: 362":
+	#instruction start "364 = set_reg %rdx 357 state: 363":
+	#instruction start "365 = set_reg %rcx 360 state: 364":
+	#instruction start "366 = set_reg %rax 348 state: 365":
+	#instruction start "367 = call 347":
+	addq $0, %rsp
+	movq -240(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -232(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "368 = proj0 367":
+	#instruction start "369 = proj1 367":
+	#Block jump
+	jmp .L43
+.L42:
+	#Block jump elided
+.L43:
+	#instruction start "371 = phi (region: 331) 329 368":
+	#instruction start "373 = constant(2)":
+	movl $2, %ebx
+	#instruction start "378 = bool_cast 373":
+	movq %rbx, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %r12d
+	#instruction start "381 = int_cast_zero 378":
+	movq %r12, %rax
+	movl %eax, %ebx
+	#instruction start "382 = constant(1)":
+	movl $1, %r12d
+	#instruction start "383 = 381 == 382":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "385 = if 331 383":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L45
+.L44:
+	#instruction start "388 = constant(9)":
+	movq $.Ls9, %rbx
+	#instruction start "389 = constant(5)":
+	movq $.Ls5, %r12
+	#instruction start "390 = constant(32)":
+	movl $32, %r13d
+	#instruction start "391 = constant(6)":
+	movq $.Ls6, %r14
+	#instruction start "392 = alloc with size 8":
+	leaq -524(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "393 = store 392 388, state: 371":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "394 = alloc with size 8":
+	leaq -532(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "395 = store 394 389, state: 393":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "396 = alloc with size 4":
+	leaq -536(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "397 = store 396 390, state: 395":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "398 = alloc with size 8":
+	leaq -544(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "399 = store 398 391, state: 397":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "400 = constant(3)":
+	leaq -288(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "401 = constant(0)":
+	leaq -296(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "402 = load part address of 392 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "403 = proj0 402":
+	#instruction start "404 = proj1 402":
+	#instruction start "405 = load part address of 394 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "406 = proj0 405":
+	#instruction start "407 = proj1 405":
+	#instruction start "408 = load part address of 396 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "409 = proj0 408":
+	#instruction start "410 = proj1 408":
+	#instruction start "411 = load part address of 398 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "412 = proj0 411":
+	#instruction start "413 = proj1 411":
+	#instruction start "414 = allocate_call_stack 0":
+	#instruction start "415 = set_reg %rdi 404":
+	#instruction start "416 = set_reg %rsi 407 state: 415":
+	#instruction start "417 = set_reg %rdx 410 state: 416":
+	#instruction start "418 = set_reg %rcx 413 state: 417":
+	#instruction start "419 = set_reg %rax 401 state: 418":
+	#instruction start "420 = call 400":
+	addq $0, %rsp
+	movq -296(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -288(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "421 = proj0 420":
+	#instruction start "422 = proj1 420":
+	#Block jump
+	jmp .L46
+.L45:
+	#Block jump elided
+.L46:
+	#instruction start "423 = constant(0)":
+	movl $0, %ebx
+	#instruction start "424 = set_reg %rax 423":
+	#instruction start "425 = phi (region: 384) 371 421":
+	#instruction start "426 = return 384, 424, 425":
+	movq %rbx, %rax
+	#Block return.
+	movq -552(%rbp), %rbx
+	movq -560(%rbp), %r12
+	movq -568(%rbp), %r13
+	movq -576(%rbp), %r14
+	movq -584(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls4:
+	.string "ret_true() || ret_false()\000"
+.Ls5:
+	.string "/root/repo/tests/bool.c\000"
+.Ls6:
+	.string "main"
+.Ls7:
+	.string "!ret_false()\000"
+.Ls8:
+	.string "!(ret_true() && ret_false())\000"
+.Ls9:
+	.string "b == 1\000"
+.section .data
+.align 1
+.global S
+S:
+.byte 1
+.section .text
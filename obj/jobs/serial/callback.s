@@ -0,0 +1,1002 @@
+__bswap_16:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movq %rbx, -18(%rbp)
+	movq %r12, -26(%rbp)
+	movq %r13, -34(%rbp)
+	movq %r14, -42(%rbp)
+	movzwl %di, %ebx
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = alloc with size 2":
+	leaq -10(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "8 = store part of 7 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movw %bx, (%rsi)
+	#instruction start "9 = load 7, state: 8":
+	movq %r12, %rdi
+	movzwl (%rdi), %ebx
+	#instruction start "10 = int_cast_zero 9":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "11 = constant(8)":
+	movl $8, %ebx
+	#instruction start "12 = 10 >> 11 (signed)":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	sarl %cl, %eax
+	movl %eax, %r14d
+	#instruction start "13 = constant(255)":
+	movl $255, %ebx
+	#instruction start "14 = 12 & 13":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	andl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "15 = load 7, state: 8":
+	movq %r12, %rdi
+	movzwl (%rdi), %ebx
+	#instruction start "16 = int_cast_zero 15":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "17 = constant(255)":
+	movl $255, %ebx
+	#instruction start "18 = 16 & 17":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	andl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "19 = constant(8)":
+	movl $8, %ebx
+	#instruction start "20 = 18 << 19":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	sall %cl, %eax
+	movl %eax, %r12d
+	#instruction start "21 = 14 | 20":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "22 = int_cast_zero 21":
+	movq %rbx, %rax
+	movzwl %ax, %r12d
+	#instruction start "23 = set_reg %rax 22":
+	#instruction start "24 = return 2, 23, 8":
+	movq %r12, %rax
+	#Block return.
+	movq -18(%rbp), %rbx
+	movq -26(%rbp), %r12
+	movq -34(%rbp), %r13
+	movq -42(%rbp), %r14
+	leave 
+	ret 
+__bswap_32:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movq %r13, -36(%rbp)
+	movq %r14, -44(%rbp)
+	movq %r15, -52(%rbp)
+	movl %edi, %ebx
+.L3:
+	#instruction start "28 = proj3 26":
+	#instruction start "29 = proj1 26":
+	#instruction start "31 = %rdi":
+	#instruction start "32 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "33 = store part of 32 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "34 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "35 = constant(4278190080)":
+	movl $4278190080, %r13d
+	#instruction start "36 = 34 & 35":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	andl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "37 = constant(24)":
+	movl $24, %ebx
+	#instruction start "38 = 36 >> 37":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	shrl %cl, %eax
+	movl %eax, %r13d
+	#instruction start "39 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "40 = constant(16711680)":
+	movl $16711680, %r14d
+	#instruction start "41 = 39 & 40":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andl %ecx, %eax
+	movl %eax, %r15d
+	#instruction start "42 = constant(8)":
+	movl $8, %ebx
+	#instruction start "43 = 41 >> 42":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	shrl %cl, %eax
+	movl %eax, %r14d
+	#instruction start "44 = 38 | 43":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "45 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %r13d
+	#instruction start "46 = constant(65280)":
+	movl $65280, %r14d
+	#instruction start "47 = 45 & 46":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andl %ecx, %eax
+	movl %eax, %r15d
+	#instruction start "48 = constant(8)":
+	movl $8, %r13d
+	#instruction start "49 = 47 << 48":
+	movq %r15, %rax
+	movq %r13, %rcx
+	sall %cl, %eax
+	movl %eax, %r14d
+	#instruction start "50 = 44 | 49":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "51 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "52 = constant(255)":
+	movl $255, %r12d
+	#instruction start "53 = 51 & 52":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	andl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "54 = constant(24)":
+	movl $24, %ebx
+	#instruction start "55 = 53 << 54":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	sall %cl, %eax
+	movl %eax, %r12d
+	#instruction start "56 = 50 | 55":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "57 = set_reg %rax 56":
+	#instruction start "58 = return 27, 57, 33":
+	movq %rbx, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	movq -36(%rbp), %r13
+	movq -44(%rbp), %r14
+	movq -52(%rbp), %r15
+	leave 
+	ret 
+__bswap_64:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -24(%rbp)
+	movq %r12, -32(%rbp)
+	movq %r13, -40(%rbp)
+	movq %r14, -48(%rbp)
+	movq %r15, -56(%rbp)
+	movq %rdi, %rbx
+.L4:
+	#instruction start "62 = proj3 60":
+	#instruction start "63 = proj1 60":
+	#instruction start "65 = %rdi":
+	#instruction start "66 = alloc with size 8":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "67 = store part of 66 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "68 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "69 = constant(-72057594037927936)":
+	movabsq $-72057594037927936, %r13
+	#instruction start "70 = 68 & 69":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "71 = constant(56)":
+	movq $56, %rbx
+	#instruction start "72 = 70 >> 71":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r13
+	#instruction start "73 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "74 = constant(71776119061217280)":
+	movabsq $71776119061217280, %r14
+	#instruction start "75 = 73 & 74":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "76 = constant(40)":
+	movq $40, %rbx
+	#instruction start "77 = 75 >> 76":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "78 = 72 | 77":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "79 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "80 = constant(280375465082880)":
+	movabsq $280375465082880, %r14
+	#instruction start "81 = 79 & 80":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "82 = constant(24)":
+	movq $24, %r13
+	#instruction start "83 = 81 >> 82":
+	movq %r15, %rax
+	movq %r13, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "84 = 78 | 83":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "85 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "86 = constant(1095216660480)":
+	movabsq $1095216660480, %r14
+	#instruction start "87 = 85 & 86":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "88 = constant(8)":
+	movq $8, %rbx
+	#instruction start "89 = 87 >> 88":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "90 = 84 | 89":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "91 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "92 = constant(4278190080)":
+	movabsq $4278190080, %r14
+	#instruction start "93 = 91 & 92":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "94 = constant(8)":
+	movq $8, %r13
+	#instruction start "95 = 93 << 94":
+	movq %r15, %rax
+	movq %r13, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "96 = 90 | 95":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "97 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "98 = constant(16711680)":
+	movq $16711680, %r14
+	#instruction start "99 = 97 & 98":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "100 = constant(24)":
+	movq $24, %rbx
+	#instruction start "101 = 99 << 100":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "102 = 96 | 101":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "103 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "104 = constant(65280)":
+	movq $65280, %r14
+	#instruction start "105 = 103 & 104":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "106 = constant(40)":
+	movq $40, %r13
+	#instruction start "107 = 105 << 106":
+	movq %r15, %rax
+	movq %r13, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "108 = 102 | 107":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "109 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "110 = constant(255)":
+	movq $255, %r12
+	#instruction start "111 = 109 & 110":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "112 = constant(56)":
+	movq $56, %rbx
+	#instruction start "113 = 111 << 112":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r12
+	#instruction start "114 = 108 | 113":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "115 = set_reg %rax 114":
+	#instruction start "116 = return 61, 115, 67":
+	movq %rbx, %rax
+	#Block return.
+	movq -24(%rbp), %rbx
+	movq -32(%rbp), %r12
+	movq -40(%rbp), %r13
+	movq -48(%rbp), %r14
+	movq -56(%rbp), %r15
+	leave 
+	ret 
+__uint16_identity:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -18(%rbp)
+	movq %r12, -26(%rbp)
+	movzwl %di, %ebx
+.L5:
+	#instruction start "120 = proj3 118":
+	#instruction start "121 = proj1 118":
+	#instruction start "123 = %rdi":
+	#instruction start "124 = alloc with size 2":
+	leaq -10(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "125 = store part of 124 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movw %bx, (%rsi)
+	#instruction start "126 = load 124, state: 125":
+	movq %r12, %rdi
+	movzwl (%rdi), %ebx
+	#instruction start "127 = set_reg %rax 126":
+	#instruction start "128 = return 119, 127, 125":
+	movq %rbx, %rax
+	#Block return.
+	movq -18(%rbp), %rbx
+	movq -26(%rbp), %r12
+	leave 
+	ret 
+__uint32_identity:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movl %edi, %ebx
+.L6:
+	#instruction start "132 = proj3 130":
+	#instruction start "133 = proj1 130":
+	#instruction start "135 = %rdi":
+	#instruction start "136 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "137 = store part of 136 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "138 = load 136, state: 137":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "139 = set_reg %rax 138":
+	#instruction start "140 = return 131, 139, 137":
+	movq %rbx, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	leave 
+	ret 
+__uint64_identity:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -24(%rbp)
+	movq %r12, -32(%rbp)
+	movq %rdi, %rbx
+.L7:
+	#instruction start "144 = proj3 142":
+	#instruction start "145 = proj1 142":
+	#instruction start "147 = %rdi":
+	#instruction start "148 = alloc with size 8":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "149 = store part of 148 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "150 = load 148, state: 149":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "151 = set_reg %rax 150":
+	#instruction start "152 = return 143, 151, 149":
+	movq %rbx, %rax
+	#Block return.
+	movq -24(%rbp), %rbx
+	movq -32(%rbp), %r12
+	leave 
+	ret 
+.global atexit_func
+atexit_func:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -32(%rbp)
+	movq %r12, -40(%rbp)
+	movq %r13, -48(%rbp)
+	movq %r14, -56(%rbp)
+.L8:
+	#instruction start "156 = proj3 154":
+	#instruction start "159 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "160 = alloc with size 8":
+	leaq -24(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "161 = store 160 159, state: 156":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "162 = constant(0)":
+	movq $printf, %rbx
+	#instruction start "163 = constant(0)":
+	movq $0, %r13
+	#instruction start "164 = load part address of 160 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "165 = proj0 164":
+	#instruction start "166 = proj1 164":
+	#instruction start "167 = allocate_call_stack 0":
+	#instruction start "168 = set_reg %rdi 166":
+	#instruction start "169 = set_reg %rax 163 state: 168":
+	#instruction start "170 = call 162":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "171 = proj0 170":
+	#instruction start "172 = proj1 170":
+	#instruction start "175 = return 155, -1, 171":
+	#Block return.
+	movq -32(%rbp), %rbx
+	movq -40(%rbp), %r12
+	movq -48(%rbp), %r13
+	movq -56(%rbp), %r14
+	leave 
+	ret 
+.global compare_strings
+compare_strings:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $96, %rsp
+	movq %rbx, -56(%rbp)
+	movq %r12, -64(%rbp)
+	movq %r13, -72(%rbp)
+	movq %r14, -80(%rbp)
+	movq %r15, -88(%rbp)
+	movq %rdi, %rbx
+	movq %rsi, %r12
+.L9:
+	#instruction start "178 = proj3 176":
+	#instruction start "179 = proj1 176":
+	#instruction start "181 = %rdi":
+	#instruction start "182 = %rsi":
+	#instruction start "183 = alloc with size 8":
+	leaq -40(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "184 = alloc with size 8":
+	leaq -48(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "185 = store part of 183 with offset 0":
+	movq %r13, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "186 = store part of 184 with offset 0":
+	movq %r14, %rsi
+	leaq (%rsi), %rsi
+	movq %r12, (%rsi)
+	#instruction start "187 = load 183, state: 186":
+	movq %r13, %rdi
+	movq (%rdi), %rbx
+	#instruction start "188 = load 184, state: 186":
+	movq %r14, %rdi
+	movq (%rdi), %r12
+	#instruction start "189 = constant(2)":
+	movq $strcmp, %r13
+	#instruction start "190 = constant(0)":
+	movq $0, %r14
+	#instruction start "191 = load part address of 187 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "192 = proj0 191":
+	#instruction start "193 = proj1 191":
+	#instruction start "194 = load part address of 188 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "195 = proj0 194":
+	#instruction start "196 = proj1 194":
+	#instruction start "197 = allocate_call_stack 0":
+	#instruction start "198 = set_reg %rdi 193":
+	#instruction start "199 = set_reg %rsi 196 state: 198":
+	#instruction start "200 = set_reg %rax 190 state: 199":
+	#instruction start "201 = call 189":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq %r13, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r12
+	#instruction start "202 = proj0 201":
+	#instruction start "203 = proj1 201":
+	#instruction start "204 = %rax":
+	#instruction start "205 = int_cast_zero 204":
+	movq %r12, %rax
+	movl %eax, %ebx
+	#instruction start "206 = set_reg %rax 205":
+	#instruction start "207 = return 177, 206, 202":
+	movq %rbx, %rax
+	#Block return.
+	movq -56(%rbp), %rbx
+	movq -64(%rbp), %r12
+	movq -72(%rbp), %r13
+	movq -80(%rbp), %r14
+	movq -88(%rbp), %r15
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $336, %rsp
+	movq %rbx, -292(%rbp)
+	movq %r12, -300(%rbp)
+	movq %r13, -308(%rbp)
+	movq %r14, -316(%rbp)
+	movq %r15, -324(%rbp)
+.L10:
+	#instruction start "211 = proj3 209":
+	#instruction start "214 = alloc with size 8":
+	leaq -176(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "215 = constant(4)":
+	movq $atexit_func, %r12
+	#instruction start "216 = store 214 215, state: 211":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "217 = constant(3)":
+	movq $atexit, %r12
+	#instruction start "218 = constant(0)":
+	movq $0, %r13
+	#instruction start "219 = load part address of 214 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "220 = proj0 219":
+	#instruction start "221 = proj1 219":
+	#instruction start "222 = allocate_call_stack 0":
+	#instruction start "223 = set_reg %rdi 221":
+	#instruction start "224 = set_reg %rax 218 state: 223":
+	#instruction start "225 = call 217":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "226 = proj0 225":
+	#instruction start "227 = proj1 225":
+	#instruction start "230 = alloc with size 40":
+	leaq -216(%rbp), %rsi
+	movq %rsi, -24(%rbp)
+	#instruction start "231 = set_zero_ptr 230, size: 40":
+	movq -24(%rbp), %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	movq $0, 16(%rdi)
+	movq $0, 24(%rdi)
+	movq $0, 32(%rdi)
+	#instruction start "232 = constant(0)":
+	movq $0, %r12
+	#instruction start "233 = 230 + 232":
+	movq -24(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "234 = constant(5)":
+	movq $.Ls5, %r12
+	#instruction start "235 = store 233 234, state: 231":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "236 = constant(8)":
+	movq $8, %r12
+	#instruction start "237 = 230 + 236":
+	movq -24(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "238 = constant(6)":
+	movq $.Ls6, %r12
+	#instruction start "239 = store 237 238, state: 235":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "240 = constant(16)":
+	movq $16, %r12
+	#instruction start "241 = 230 + 240":
+	movq -24(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "242 = constant(7)":
+	movq $.Ls7, %r12
+	#instruction start "243 = store 241 242, state: 239":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "244 = constant(24)":
+	movq $24, %r12
+	#instruction start "245 = 230 + 244":
+	movq -24(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "246 = constant(8)":
+	movq $.Ls8, %r12
+	#instruction start "247 = store 245 246, state: 243":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "248 = constant(32)":
+	movq $32, %r12
+	#instruction start "249 = 230 + 248":
+	movq -24(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "250 = constant(9)":
+	movq $.Ls9, %r12
+	#instruction start "251 = store 249 250, state: 247":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "252 = alloc with size 8":
+	leaq -224(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "253 = store 252 230, state: 251":
+	movq %r12, %rsi
+	leaq -24(%rbp), %rdi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	#instruction start "254 = alloc with size 8":
+	leaq -232(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "255 = constant(5)":
+	movq $5, %r14
+	#instruction start "256 = store 254 255, state: 253":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "257 = alloc with size 8":
+	leaq -240(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "258 = constant(8)":
+	movq $8, %r15
+	#instruction start "259 = store 257 258, state: 256":
+	movq %r14, %rsi
+	movq %r15, (%rsi)
+	#instruction start "260 = alloc with size 8":
+	leaq -248(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "261 = constant(11)":
+	movq $compare_strings, %rbx
+	#instruction start "262 = store 260 261, state: 259":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "263 = constant(10)":
+	leaq -32(%rbp), %rdi
+	movq $qsort, (%rdi)
+	#instruction start "264 = constant(0)":
+	leaq -40(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "265 = load part address of 252 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "266 = proj0 265":
+	#instruction start "267 = proj1 265":
+	#instruction start "268 = load part address of 254 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "269 = proj0 268":
+	#instruction start "270 = proj1 268":
+	#instruction start "271 = load part address of 257 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "272 = proj0 271":
+	#instruction start "273 = proj1 271":
+	#instruction start "274 = load part address of 260 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "275 = proj0 274":
+	#instruction start "276 = proj1 274":
+	#instruction start "277 = allocate_call_stack 0":
+	#instruction start "278 = set_reg %rdi 267":
+	#instruction start "279 = set_reg %rsi 270 state: 278":
+	#instruction start "280 = set_reg %rdx 273 state: 279":
+	#instruction start "281 = set_reg %rcx 276 state: 280":
+	#instruction start "282 = set_reg %rax 264 state: 281":
+	#instruction start "283 = call 263":
+	addq $0, %rsp
+	movq -40(%rbp), %rax
+	movq %r14, %rcx
+	movq %r13, %rdx
+	movq %r12, %rsi
+	movq %rbx, %rdi
+	movq -32(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "284 = proj0 283":
+	#instruction start "285 = proj1 283":
+	#instruction start "286 = constant(0)":
+	movl $0, %ebx
+	#instruction start "287 = int_cast_zero 286":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "288 = constant(8)":
+	movq $8, %rbx
+	#instruction start "289 = 287 * 288":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "290 = 230 + 289":
+	movq -24(%rbp), %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "291 = constant(9)":
+	movq $.Ls9, %r12
+	#instruction start "292 = alloc with size 8":
+	leaq -256(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "293 = store 292 291, state: 284":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "294 = constant(2)":
+	movq $strcmp, %r12
+	#instruction start "295 = constant(0)":
+	movq $0, %r14
+	#instruction start "296 = load part address of 290 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "297 = proj0 296":
+	#instruction start "298 = proj1 296":
+	#instruction start "299 = load part address of 292 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "300 = proj0 299":
+	#instruction start "301 = proj1 299":
+	#instruction start "302 = allocate_call_stack 0":
+	#instruction start "303 = set_reg %rdi 298":
+	#instruction start "304 = set_reg %rsi 301 state: 303":
+	#instruction start "305 = set_reg %rax 295 state: 304":
+	#instruction start "306 = call 294":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "307 = proj0 306":
+	#instruction start "308 = proj1 306":
+	#instruction start "309 = %rax":
+	#instruction start "310 = int_cast_zero 309":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "311 = constant(0)":
+	movl $0, %r12d
+	#instruction start "312 = 310 == 311":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "314 = if 210 312":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L12
+.L11:
+	#instruction start "317 = constant(13)":
+	movq $.Ls13, %rbx
+	#instruction start "318 = constant(14)":
+	movq $.Ls14, %r12
+	#instruction start "319 = constant(31)":
+	movl $31, %r13d
+	#instruction start "320 = constant(15)":
+	movq $.Ls15, %r14
+	#instruction start "321 = alloc with size 8":
+	leaq -264(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "322 = store 321 317, state: 307":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "323 = alloc with size 8":
+	leaq -272(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "324 = store 323 318, state: 322":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "325 = alloc with size 4":
+	leaq -276(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "326 = store 325 319, state: 324":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "327 = alloc with size 8":
+	leaq -284(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "328 = store 327 320, state: 326":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "329 = constant(12)":
+	leaq -112(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "330 = constant(0)":
+	leaq -120(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "331 = load part address of 321 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "332 = proj0 331":
+	#instruction start "333 = proj1 331":
+	#instruction start "334 = load part address of 323 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "335 = proj0 334":
+	#instruction start "336 = proj1 334":
+	#instruction start "337 = load part address of 325 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "338 = proj0 337":
+	#instruction start "339 = proj1 337":
+	#instruction start "340 = load part address of 327 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "341 = proj0 340":
+	#instruction start "342 = proj1 340":
+	#instruction start "343 = allocate_call_stack 0":
+	#instruction start "344 = set_reg %rdi 333":
+	#instruction start "345 = set_reg %rsi 336 state: 344":
+	#instruction start "346 = set_reg %rdx 339 state: 345":
+	#instruction start "347 = set_reg %rcx 342 state: 346":
+	#instruction start "348 = set_reg %rax 330 state: 347":
+	#instruction start "349 = call 329":
+	addq $0, %rsp
+	movq -120(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -112(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "350 = proj0 349":
+	#instruction start "351 = proj1 349":
+	#Block jump
+	jmp .L13
+.L12:
+	#Block jump elided
+.L13:
+	#instruction start "352 = constant(0)":
+	movl $0, %ebx
+	#instruction start "353 = set_reg %rax 352":
+	#instruction start "354 = phi (region: 313) 307 350":
+	#instruction start "355 = return 313, 353, 354":
+	movq %rbx, %rax
+	#Block return.
+	movq -292(%rbp), %rbx
+	movq -300(%rbp), %r12
+	movq -308(%rbp), %r13
+	movq -316(%rbp), %r14
+	movq -324(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "\000"
+.Ls5:
+	.string "Tok\000"
+.Ls6:
+	.string "oAj\000"
+.Ls7:
+	.string "yOa\000"
+.Ls8:
+	.string "byX\000"
+.Ls9:
+	.string "EL0\000"
+.Ls13:
+	.string "strcmp(strings[0], \"EL0\") == 0\000"
+.Ls14:
+	.string "/root/repo/tests/callback.c\000"
+.Ls15:
+	.string "main"
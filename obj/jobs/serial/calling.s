@@ -0,0 +1,1068 @@
+.global ret_struct
+ret_struct:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $352, %rsp
+	movq %rbx, -324(%rbp)
+	movq %r12, -332(%rbp)
+	movq %r13, -340(%rbp)
+	movq %rdi, -316(%rbp)
+	movq %rsi, -308(%rbp)
+	movq %rdx, -300(%rbp)
+	movq %rcx, -292(%rbp)
+	movq %r8, -284(%rbp)
+	movq %r9, -276(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "7 = set_zero_ptr 6, size: 4":
+	movq %rbx, %rdi
+	movl $0, (%rdi)
+	#instruction start "8 = constant(0)":
+	movq $0, %r12
+	#instruction start "9 = 6 + 8":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "10 = constant(1)":
+	movl $1, %r12d
+	#instruction start "11 = store 9 10, state: 7":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "12 = load 6, state: 11":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "13 = set_reg %rax 12":
+	#instruction start "14 = return 2, 13, 11":
+	movq %r12, %rax
+	#Block return.
+	movq -324(%rbp), %rbx
+	movq -332(%rbp), %r12
+	movq -340(%rbp), %r13
+	leave 
+	ret 
+.global sum_a
+sum_a:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movq %rbx, -22(%rbp)
+	movq %r12, -30(%rbp)
+	movq %r13, -38(%rbp)
+	movq %r14, -46(%rbp)
+	movw %di, -3(%rbp)
+	shrq $16, %rdi
+	movb %dil, -1(%rbp)
+.L3:
+	#instruction start "18 = proj3 16":
+	#instruction start "19 = proj1 16":
+	#instruction start "21 = %rdi":
+	#instruction start "22 = alloc with size 3":
+	leaq -14(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "23 = store part of 22 with offset 0":
+	movq %rbx, %rsi
+	leaq (%rsi), %rsi
+	leaq -3(%rbp), %rdi
+	movw (%rdi), %ax
+	movw %ax, (%rsi)
+	movb 2(%rdi), %al
+	movb %al, 2(%rsi)
+	#instruction start "24 = constant(0)":
+	movq $0, %r12
+	#instruction start "25 = 22 + 24":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "26 = load_volatile 25, state: 23":
+	movq %r13, %rdi
+	movzbl (%rdi), %r12d
+	#instruction start "27 = proj0 26":
+	#instruction start "28 = proj1 26":
+	#instruction start "29 = int_cast_zero 28":
+	movq %r12, %rax
+	movsbq %al, %rax
+	movl %eax, %r13d
+	#instruction start "30 = constant(1)":
+	movq $1, %r12
+	#instruction start "31 = 22 + 30":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "32 = load_volatile 31, state: 27":
+	movq %r14, %rdi
+	movzbl (%rdi), %r12d
+	#instruction start "33 = proj0 32":
+	#instruction start "34 = proj1 32":
+	#instruction start "35 = int_cast_zero 34":
+	movq %r12, %rax
+	movsbq %al, %rax
+	movl %eax, %r14d
+	#instruction start "36 = 29 + 35":
+	movq %r13, %rax
+	movq %r14, %rcx
+	addl %ecx, %eax
+	movl %eax, %r12d
+	#instruction start "37 = constant(2)":
+	movq $2, %r13
+	#instruction start "38 = 22 + 37":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "39 = load_volatile 38, state: 33":
+	movq %r14, %rdi
+	movzbl (%rdi), %ebx
+	#instruction start "40 = proj0 39":
+	#instruction start "41 = proj1 39":
+	#instruction start "42 = int_cast_zero 41":
+	movq %rbx, %rax
+	movsbq %al, %rax
+	movl %eax, %r13d
+	#instruction start "43 = 36 + 42":
+	movq %r12, %rax
+	movq %r13, %rcx
+	addl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "44 = set_reg %rax 43":
+	#instruction start "45 = return 17, 44, 40":
+	movq %rbx, %rax
+	#Block return.
+	movq -22(%rbp), %rbx
+	movq -30(%rbp), %r12
+	movq -38(%rbp), %r13
+	movq -46(%rbp), %r14
+	leave 
+	ret 
+.global ret
+ret:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -34(%rbp)
+	movq %r12, -42(%rbp)
+	movq %r13, -50(%rbp)
+	movq %r14, -58(%rbp)
+.L4:
+	#instruction start "49 = proj3 47":
+	#instruction start "52 = alloc with size 10":
+	leaq -26(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "53 = set_zero_ptr 52, size: 10":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movw $0, 8(%rdi)
+	#instruction start "54 = constant(0)":
+	movq $0, %r12
+	#instruction start "55 = 52 + 54":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "56 = constant(0)":
+	movq $0, %r12
+	#instruction start "57 = 55 + 56":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "58 = constant(10)":
+	movl $10, %r12d
+	#instruction start "59 = store 57 58, state: 53":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "60 = constant(1)":
+	movq $1, %r12
+	#instruction start "61 = 55 + 60":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "62 = constant(20)":
+	movl $20, %r12d
+	#instruction start "63 = store 61 62, state: 59":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "64 = constant(2)":
+	movq $2, %r12
+	#instruction start "65 = 55 + 64":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "66 = constant(30)":
+	movl $30, %r12d
+	#instruction start "67 = store 65 66, state: 63":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "68 = constant(3)":
+	movq $3, %r12
+	#instruction start "69 = 55 + 68":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "70 = constant(40)":
+	movl $40, %r12d
+	#instruction start "71 = store 69 70, state: 67":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "72 = constant(4)":
+	movq $4, %r12
+	#instruction start "73 = 55 + 72":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "74 = constant(50)":
+	movl $50, %r12d
+	#instruction start "75 = store 73 74, state: 71":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "76 = constant(5)":
+	movq $5, %r12
+	#instruction start "77 = 55 + 76":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "78 = constant(60)":
+	movl $60, %r12d
+	#instruction start "79 = store 77 78, state: 75":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "80 = constant(6)":
+	movq $6, %r12
+	#instruction start "81 = 55 + 80":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "82 = constant(70)":
+	movl $70, %r12d
+	#instruction start "83 = store 81 82, state: 79":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "84 = constant(7)":
+	movq $7, %r12
+	#instruction start "85 = 55 + 84":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "86 = constant(80)":
+	movl $80, %r12d
+	#instruction start "87 = store 85 86, state: 83":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "88 = constant(8)":
+	movq $8, %r12
+	#instruction start "89 = 55 + 88":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "90 = constant(90)":
+	movl $90, %r12d
+	#instruction start "91 = store 89 90, state: 87":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "92 = constant(9)":
+	movq $9, %r12
+	#instruction start "93 = 55 + 92":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "94 = constant(100)":
+	movl $100, %r12d
+	#instruction start "95 = store 93 94, state: 91":
+	movq %r14, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "96 = load part address of 52 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "97 = proj0 96":
+	#instruction start "98 = proj1 96":
+	#instruction start "99 = load part address of 52 with offset 8":
+	movq %rbx, %rdi
+	leaq 8(%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "100 = proj0 99":
+	#instruction start "101 = proj1 99":
+	#instruction start "102 = set_reg %rax 98":
+	#instruction start "103 = set_reg %rdx 101 state: 102":
+	#instruction start "104 = return 48, 103, 100":
+	movq %r13, %rdx
+	movq %r12, %rax
+	#Block return.
+	movq -34(%rbp), %rbx
+	movq -42(%rbp), %r12
+	movq -50(%rbp), %r13
+	movq -58(%rbp), %r14
+	leave 
+	ret 
+.global ret3
+ret3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -40(%rbp)
+	movq %r12, -48(%rbp)
+	movq %r13, -56(%rbp)
+.L5:
+	#instruction start "108 = proj3 106":
+	#instruction start "111 = alloc with size 16":
+	leaq -32(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "112 = set_zero_ptr 111, size: 16":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	#instruction start "113 = constant(0)":
+	movq $0, %r12
+	#instruction start "114 = 111 + 113":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "115 = constant(10)":
+	movq $10, %r12
+	#instruction start "116 = store 114 115, state: 112":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "117 = constant(8)":
+	movq $8, %r12
+	#instruction start "118 = 111 + 117":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "119 = constant(20)":
+	movq $20, %r12
+	#instruction start "120 = store 118 119, state: 116":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "121 = load part address of 111 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "122 = proj0 121":
+	#instruction start "123 = proj1 121":
+	#instruction start "124 = load part address of 111 with offset 8":
+	movq %rbx, %rdi
+	leaq 8(%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "125 = proj0 124":
+	#instruction start "126 = proj1 124":
+	#instruction start "127 = set_reg %rax 123":
+	#instruction start "128 = set_reg %rdx 126 state: 127":
+	#instruction start "129 = return 107, 128, 125":
+	movq %r13, %rdx
+	movq %r12, %rax
+	#Block return.
+	movq -40(%rbp), %rbx
+	movq -48(%rbp), %r12
+	movq -56(%rbp), %r13
+	leave 
+	ret 
+.global ret4
+ret4:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -32(%rbp)
+	movq %r12, -40(%rbp)
+	movq %r13, -48(%rbp)
+	movq %r14, -56(%rbp)
+	movq %rdi, %rbx
+.L6:
+	#instruction start "133 = proj3 131":
+	#instruction start "134 = proj1 131":
+	#instruction start "136 = %rdi":
+	#instruction start "137 = alloc with size 24":
+	leaq -24(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "138 = set_zero_ptr 137, size: 24":
+	movq %r12, %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	movq $0, 16(%rdi)
+	#instruction start "139 = constant(0)":
+	movq $0, %r13
+	#instruction start "140 = 137 + 139":
+	movq %r12, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "141 = constant(1)":
+	movl $1, %r13d
+	#instruction start "142 = store 140 141, state: 138":
+	movq %r14, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "143 = memcpy from 136 to 137":
+	movq %rbx, %rsi
+	movq %r12, %rdi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	movq 8(%rdi), %rax
+	movq %rax, 8(%rsi)
+	movq 16(%rdi), %rax
+	movq %rax, 16(%rsi)
+	#instruction start "144 = return 132, -1, 143":
+	#Block return.
+	movq -32(%rbp), %rbx
+	movq -40(%rbp), %r12
+	movq -48(%rbp), %r13
+	movq -56(%rbp), %r14
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $512, %rsp
+	movq %rbx, -470(%rbp)
+	movq %r12, -478(%rbp)
+	movq %r13, -486(%rbp)
+	movq %r14, -494(%rbp)
+	movq %r15, -502(%rbp)
+.L7:
+	#instruction start "148 = proj3 146":
+	#instruction start "151 = alloc with size 3":
+	leaq -294(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "152 = set_zero_ptr 151, size: 3":
+	movq %rbx, %rdi
+	movw $0, (%rdi)
+	movb $0, 2(%rdi)
+	#instruction start "153 = constant(0)":
+	movq $0, %r12
+	#instruction start "154 = 151 + 153":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "155 = constant(1)":
+	movl $1, %r12d
+	#instruction start "156 = store 154 155, state: 152":
+	movq %r13, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "157 = constant(1)":
+	movq $1, %r12
+	#instruction start "158 = 151 + 157":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "159 = constant(2)":
+	movl $2, %r12d
+	#instruction start "160 = store 158 159, state: 156":
+	movq %r13, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "161 = constant(2)":
+	movq $2, %r12
+	#instruction start "162 = 151 + 161":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "163 = constant(3)":
+	movl $3, %r12d
+	#instruction start "164 = store 162 163, state: 160":
+	movq %r13, %rsi
+	movb %r12b, (%rsi)
+	#instruction start "165 = constant(0)":
+	movq $sum_a, %r12
+	#instruction start "166 = constant(0)":
+	movq $0, %r13
+	#instruction start "167 = load part address of 151 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	leaq -3(%rbp), %rsi
+	movw (%rdi), %ax
+	movw %ax, (%rsi)
+	movb 2(%rdi), %al
+	movb %al, 2(%rsi)
+	#instruction start "168 = proj0 167":
+	#instruction start "169 = proj1 167":
+	#instruction start "170 = allocate_call_stack 0":
+	#instruction start "171 = set_reg %rdi 169":
+	#instruction start "172 = set_reg %rax 166 state: 171":
+	#instruction start "173 = call 165":
+	addq $0, %rsp
+	movq %r13, %rax
+	movl -3(%rbp), %edi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "174 = proj0 173":
+	#instruction start "175 = proj1 173":
+	#instruction start "176 = %rax":
+	#instruction start "177 = int_cast_zero 176":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "178 = constant(6)":
+	movl $6, %ebx
+	#instruction start "179 = 177 == 178":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "181 = if 147 179":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L9
+.L8:
+	#instruction start "184 = constant(2)":
+	movq $.Ls2, %rbx
+	#instruction start "185 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "186 = constant(44)":
+	movl $44, %r13d
+	#instruction start "187 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "188 = alloc with size 8":
+	leaq -302(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "189 = store 188 184, state: 174":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "190 = alloc with size 8":
+	leaq -310(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "191 = store 190 185, state: 189":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "192 = alloc with size 4":
+	leaq -314(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "193 = store 192 186, state: 191":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "194 = alloc with size 8":
+	leaq -322(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "195 = store 194 187, state: 193":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "196 = constant(1)":
+	leaq -27(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "197 = constant(0)":
+	leaq -35(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "198 = load part address of 188 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "199 = proj0 198":
+	#instruction start "200 = proj1 198":
+	#instruction start "201 = load part address of 190 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "202 = proj0 201":
+	#instruction start "203 = proj1 201":
+	#instruction start "204 = load part address of 192 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "205 = proj0 204":
+	#instruction start "206 = proj1 204":
+	#instruction start "207 = load part address of 194 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "208 = proj0 207":
+	#instruction start "209 = proj1 207":
+	#instruction start "210 = allocate_call_stack 0":
+	#instruction start "211 = set_reg %rdi 200":
+	#instruction start "212 = set_reg %rsi 203 state: 211":
+	#instruction start "213 = set_reg %rdx 206 state: 212":
+	#instruction start "214 = set_reg %rcx 209 state: 213":
+	#instruction start "215 = set_reg %rax 197 state: 214":
+	#instruction start "216 = call 196":
+	addq $0, %rsp
+	movq -35(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -27(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "217 = proj0 216":
+	#instruction start "218 = proj1 216":
+	#Block jump
+	jmp .L10
+.L9:
+	#Block jump elided
+.L10:
+	#instruction start "219 = constant(5)":
+	movq $ret_struct, %rbx
+	#instruction start "220 = constant(0)":
+	movq $0, %r12
+	#instruction start "221 = allocate_call_stack 0":
+	#instruction start "222 = set_reg %rax 220":
+	#instruction start "223 = phi (region: 180) 174 217":
+	#instruction start "224 = call 219":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "225 = proj0 224":
+	#instruction start "226 = proj1 224":
+	#instruction start "229 = constant(6)":
+	movq $ret3, %rbx
+	#instruction start "230 = constant(0)":
+	movq $0, %r12
+	#instruction start "231 = allocate_call_stack 0":
+	#instruction start "232 = set_reg %rax 230":
+	#instruction start "233 = call 229":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	movq %rdx, %r14
+	#instruction start "234 = proj0 233":
+	#instruction start "235 = proj1 233":
+	#instruction start "236 = %rax":
+	#instruction start "237 = %rdx":
+	#instruction start "238 = alloc with size 16":
+	leaq -338(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "239 = store part of 238 with offset 0":
+	movq %rbx, %rsi
+	leaq (%rsi), %rsi
+	movq %r13, (%rsi)
+	#instruction start "240 = store part of 238 with offset 8":
+	movq %rbx, %rsi
+	leaq 8(%rsi), %rsi
+	movq %r14, (%rsi)
+	#instruction start "241 = constant(0)":
+	movq $0, %r12
+	#instruction start "242 = 238 + 241":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "243 = load_volatile 242, state: 240":
+	movq %r13, %rdi
+	movq (%rdi), %rbx
+	#instruction start "244 = proj0 243":
+	#instruction start "245 = proj1 243":
+	#instruction start "246 = constant(10)":
+	movq $10, %r12
+	#instruction start "247 = 245 == 246":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "249 = if 180 247":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L12
+.L11:
+	#instruction start "252 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "253 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "254 = constant(47)":
+	movl $47, %r13d
+	#instruction start "255 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "256 = alloc with size 8":
+	leaq -346(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "257 = store 256 252, state: 244":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "258 = alloc with size 8":
+	leaq -354(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "259 = store 258 253, state: 257":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "260 = alloc with size 4":
+	leaq -358(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "261 = store 260 254, state: 259":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "262 = alloc with size 8":
+	leaq -366(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "263 = store 262 255, state: 261":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "264 = constant(1)":
+	leaq -99(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "265 = constant(0)":
+	leaq -107(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "266 = load part address of 256 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "267 = proj0 266":
+	#instruction start "268 = proj1 266":
+	#instruction start "269 = load part address of 258 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "270 = proj0 269":
+	#instruction start "271 = proj1 269":
+	#instruction start "272 = load part address of 260 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "273 = proj0 272":
+	#instruction start "274 = proj1 272":
+	#instruction start "275 = load part address of 262 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "276 = proj0 275":
+	#instruction start "277 = proj1 275":
+	#instruction start "278 = allocate_call_stack 0":
+	#instruction start "279 = set_reg %rdi 268":
+	#instruction start "280 = set_reg %rsi 271 state: 279":
+	#instruction start "281 = set_reg %rdx 274 state: 280":
+	#instruction start "282 = set_reg %rcx 277 state: 281":
+	#instruction start "283 = set_reg %rax 265 state: 282":
+	#instruction start "284 = call 264":
+	addq $0, %rsp
+	movq -107(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -99(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "285 = proj0 284":
+	#instruction start "286 = proj1 284":
+	#Block jump
+	jmp .L13
+.L12:
+	#Block jump elided
+.L13:
+	#instruction start "287 = constant(6)":
+	movq $ret3, %rbx
+	#instruction start "288 = constant(0)":
+	movq $0, %r12
+	#instruction start "289 = allocate_call_stack 0":
+	#instruction start "290 = set_reg %rax 288":
+	#instruction start "291 = phi (region: 248) 244 285":
+	#instruction start "292 = call 287":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	movq %rdx, %r14
+	#instruction start "293 = proj0 292":
+	#instruction start "294 = proj1 292":
+	#instruction start "295 = %rax":
+	#instruction start "296 = %rdx":
+	#instruction start "297 = alloc with size 16":
+	leaq -382(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "298 = store part of 297 with offset 0":
+	movq %rbx, %rsi
+	leaq (%rsi), %rsi
+	movq %r13, (%rsi)
+	#instruction start "299 = store part of 297 with offset 8":
+	movq %rbx, %rsi
+	leaq 8(%rsi), %rsi
+	movq %r14, (%rsi)
+	#instruction start "300 = constant(8)":
+	movq $8, %r12
+	#instruction start "301 = 297 + 300":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "302 = load_volatile 301, state: 299":
+	movq %r13, %rdi
+	movq (%rdi), %rbx
+	#instruction start "303 = proj0 302":
+	#instruction start "304 = proj1 302":
+	#instruction start "305 = constant(20)":
+	movq $20, %r12
+	#instruction start "306 = 304 == 305":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "308 = if 248 306":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L15
+.L14:
+	#instruction start "311 = constant(8)":
+	movq $.Ls8, %rbx
+	#instruction start "312 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "313 = constant(48)":
+	movl $48, %r13d
+	#instruction start "314 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "315 = alloc with size 8":
+	leaq -390(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "316 = store 315 311, state: 303":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "317 = alloc with size 8":
+	leaq -398(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "318 = store 317 312, state: 316":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "319 = alloc with size 4":
+	leaq -402(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "320 = store 319 313, state: 318":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "321 = alloc with size 8":
+	leaq -410(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "322 = store 321 314, state: 320":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "323 = constant(1)":
+	leaq -163(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "324 = constant(0)":
+	leaq -171(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "325 = load part address of 315 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "326 = proj0 325":
+	#instruction start "327 = proj1 325":
+	#instruction start "328 = load part address of 317 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "329 = proj0 328":
+	#instruction start "330 = proj1 328":
+	#instruction start "331 = load part address of 319 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "332 = proj0 331":
+	#instruction start "333 = proj1 331":
+	#instruction start "334 = load part address of 321 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "335 = proj0 334":
+	#instruction start "336 = proj1 334":
+	#instruction start "337 = allocate_call_stack 0":
+	#instruction start "338 = set_reg %rdi 327":
+	#instruction start "339 = set_reg %rsi 330 state: 338":
+	#instruction start "340 = set_reg %rdx 333 state: 339":
+	#instruction start "341 = set_reg %rcx 336 state: 340":
+	#instruction start "342 = set_reg %rax 324 state: 341":
+	#instruction start "343 = call 323":
+	addq $0, %rsp
+	movq -171(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -163(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "344 = proj0 343":
+	#instruction start "345 = proj1 343":
+	#Block jump
+	jmp .L16
+.L15:
+	#Block jump elided
+.L16:
+	#instruction start "346 = constant(9)":
+	movq $ret4, %rbx
+	#instruction start "347 = alloc with size 24":
+	leaq -434(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "348 = constant(0)":
+	movq $0, %r13
+	#instruction start "349 = allocate_call_stack 0":
+	#instruction start "350 = set_reg %rdi 347":
+	#instruction start "351 = set_reg %rax 348 state: 350":
+	#instruction start "352 = phi (region: 307) 303 344":
+	#instruction start "353 = call 346":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r12, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "354 = proj0 353":
+	#instruction start "355 = proj1 353":
+	#instruction start "356 = constant(0)":
+	movq $0, %rbx
+	#instruction start "357 = 347 + 356":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "358 = load_volatile 357, state: 354":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "359 = proj0 358":
+	#instruction start "360 = proj1 358":
+	#instruction start "361 = constant(1)":
+	movl $1, %r12d
+	#instruction start "362 = 360 == 361":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "364 = if 307 362":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L18
+.L17:
+	#instruction start "367 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "368 = constant(3)":
+	movq $.Ls3, %r12
+	#instruction start "369 = constant(50)":
+	movl $50, %r13d
+	#instruction start "370 = constant(4)":
+	movq $.Ls4, %r14
+	#instruction start "371 = alloc with size 8":
+	leaq -442(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "372 = store 371 367, state: 359":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "373 = alloc with size 8":
+	leaq -450(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "374 = store 373 368, state: 372":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "375 = alloc with size 4":
+	leaq -454(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "376 = store 375 369, state: 374":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "377 = alloc with size 8":
+	leaq -462(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "378 = store 377 370, state: 376":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "379 = constant(1)":
+	leaq -235(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "380 = constant(0)":
+	leaq -243(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "381 = load part address of 371 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "382 = proj0 381":
+	#instruction start "383 = proj1 381":
+	#instruction start "384 = load part address of 373 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "385 = proj0 384":
+	#instruction start "386 = proj1 384":
+	#instruction start "387 = load part address of 375 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "388 = proj0 387":
+	#instruction start "389 = proj1 387":
+	#instruction start "390 = load part address of 377 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "391 = proj0 390":
+	#instruction start "392 = proj1 390":
+	#instruction start "393 = allocate_call_stack 0":
+	#instruction start "394 = set_reg %rdi 383":
+	#instruction start "395 = set_reg %rsi 386 state: 394":
+	#instruction start "396 = set_reg %rdx 389 state: 395":
+	#instruction start "397 = set_reg %rcx 392 state: 396":
+	#instruction start "398 = set_reg %rax 380 state: 397":
+	#instruction start "399 = call 379":
+	addq $0, %rsp
+	movq -243(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -235(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "400 = proj0 399":
+	#instruction start "401 = proj1 399":
+	#Block jump
+	jmp .L19
+.L18:
+	#Block jump elided
+.L19:
+	#instruction start "402 = constant(0)":
+	movl $0, %ebx
+	#instruction start "403 = set_reg %rax 402":
+	#instruction start "404 = phi (region: 363) 359 400":
+	#instruction start "405 = return 363, 403, 404":
+	movq %rbx, %rax
+	#Block return.
+	movq -470(%rbp), %rbx
+	movq -478(%rbp), %r12
+	movq -486(%rbp), %r13
+	movq -494(%rbp), %r14
+	movq -502(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls2:
+	.string "sum_a((struct a) { 1, 2, 3 }) == 6\000"
+.Ls3:
+	.string "/root/repo/tests/calling.c\000"
+.Ls4:
+	.string "main"
+.Ls7:
+	.string "ret3().a == 10\000"
+.Ls8:
+	.string "ret3().b == 20\000"
+.Ls10:
+	.string "ret4().d == 1\000"
@@ -0,0 +1,453 @@
+.global func
+func:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -32(%rbp)
+	movq %r12, -40(%rbp)
+	movq %r13, -48(%rbp)
+	movq %r14, -56(%rbp)
+	movq %r15, -64(%rbp)
+	movq %rdi, %rbx
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = alloc with size 8":
+	leaq -24(%rbp), %rsi
+	movq %rsi, -8(%rbp)
+	#instruction start "8 = store part of 7 with offset 0":
+	movq -8(%rbp), %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "9 = constant(0)":
+	movl $0, %ebx
+	#instruction start "10 = int_cast_zero 9":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "11 = load 7, state: 8":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %rbx
+	#instruction start "12 = constant(4)":
+	movq $4, %r14
+	#instruction start "13 = 10 * 12":
+	movq %r13, %rax
+	movq %r14, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "14 = 11 + 13":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "15 = constant(1)":
+	movl $1, %ebx
+	#instruction start "16 = int_cast_zero 15":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r14
+	#instruction start "17 = load 7, state: 8":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %rbx
+	#instruction start "18 = constant(4)":
+	movq $4, %r15
+	#instruction start "19 = 16 * 18":
+	movq %r14, %rax
+	movq %r15, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "20 = 17 + 19":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "21 = load_volatile 14, state: 8":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "22 = proj0 21":
+	#instruction start "23 = proj1 21":
+	#instruction start "24 = load_volatile 20, state: 22":
+	movq %r14, %rdi
+	movl (%rdi), %r12d
+	#instruction start "25 = proj0 24":
+	#instruction start "26 = proj1 24":
+	#instruction start "27 = 23 + 26":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "28 = constant(2)":
+	movl $2, %ebx
+	#instruction start "29 = int_cast_zero 28":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "30 = load 7, state: 25":
+	movq -8(%rbp), %rdi
+	movq (%rdi), %rbx
+	#instruction start "31 = constant(4)":
+	movq $4, %r14
+	#instruction start "32 = 29 * 31":
+	movq %r12, %rax
+	movq %r14, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "33 = 30 + 32":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "34 = load_volatile 33, state: 25":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "35 = proj0 34":
+	#instruction start "36 = proj1 34":
+	#instruction start "37 = 27 + 36":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addl %ecx, %eax
+	movl %eax, %r12d
+	#instruction start "38 = set_reg %rax 37":
+	#instruction start "39 = return 2, 38, 35":
+	movq %r12, %rax
+	#Block return.
+	movq -32(%rbp), %rbx
+	movq -40(%rbp), %r12
+	movq -48(%rbp), %r13
+	movq -56(%rbp), %r14
+	movq -64(%rbp), %r15
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movq %rbx, -220(%rbp)
+	movq %r12, -228(%rbp)
+	movq %r13, -236(%rbp)
+	movq %r14, -244(%rbp)
+	movq %r15, -252(%rbp)
+.L3:
+	#instruction start "43 = proj3 41":
+	#instruction start "46 = alloc with size 12":
+	leaq -148(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "47 = set_zero_ptr 46, size: 12":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movl $0, 8(%rdi)
+	#instruction start "48 = constant(0)":
+	movq $0, %r12
+	#instruction start "49 = 46 + 48":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "50 = constant(1)":
+	movl $1, %r12d
+	#instruction start "51 = store 49 50, state: 47":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "52 = constant(4)":
+	movq $4, %r12
+	#instruction start "53 = 46 + 52":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "54 = constant(2)":
+	movl $2, %r12d
+	#instruction start "55 = store 53 54, state: 51":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "56 = constant(8)":
+	movq $8, %r12
+	#instruction start "57 = 46 + 56":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "58 = constant(3)":
+	movl $3, %r12d
+	#instruction start "59 = store 57 58, state: 55":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "60 = alloc with size 8":
+	leaq -156(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "61 = store 60 46, state: 59":
+	movq %r12, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "62 = constant(1)":
+	movq $func, %rbx
+	#instruction start "63 = constant(0)":
+	movq $0, %r13
+	#instruction start "64 = load part address of 60 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "65 = proj0 64":
+	#instruction start "66 = proj1 64":
+	#instruction start "67 = allocate_call_stack 0":
+	#instruction start "68 = set_reg %rdi 66":
+	#instruction start "69 = set_reg %rax 63 state: 68":
+	#instruction start "70 = call 62":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r12
+	#instruction start "71 = proj0 70":
+	#instruction start "72 = proj1 70":
+	#instruction start "73 = %rax":
+	#instruction start "74 = int_cast_zero 73":
+	movq %r12, %rax
+	movl %eax, %ebx
+	#instruction start "75 = constant(6)":
+	movl $6, %r12d
+	#instruction start "76 = 74 == 75":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "78 = if 42 76":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L5
+.L4:
+	#instruction start "81 = constant(3)":
+	movq $.Ls3, %rbx
+	#instruction start "82 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "83 = constant(10)":
+	movl $10, %r13d
+	#instruction start "84 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "85 = alloc with size 8":
+	leaq -164(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "86 = store 85 81, state: 71":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "87 = alloc with size 8":
+	leaq -172(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "88 = store 87 82, state: 86":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "89 = alloc with size 4":
+	leaq -176(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "90 = store 89 83, state: 88":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "91 = alloc with size 8":
+	leaq -184(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "92 = store 91 84, state: 90":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "93 = constant(2)":
+	leaq -24(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "94 = constant(0)":
+	leaq -32(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "95 = load part address of 85 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "96 = proj0 95":
+	#instruction start "97 = proj1 95":
+	#instruction start "98 = load part address of 87 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "99 = proj0 98":
+	#instruction start "100 = proj1 98":
+	#instruction start "101 = load part address of 89 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "102 = proj0 101":
+	#instruction start "103 = proj1 101":
+	#instruction start "104 = load part address of 91 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "105 = proj0 104":
+	#instruction start "106 = proj1 104":
+	#instruction start "107 = allocate_call_stack 0":
+	#instruction start "108 = set_reg %rdi 97":
+	#instruction start "109 = set_reg %rsi 100 state: 108":
+	#instruction start "110 = set_reg %rdx 103 state: 109":
+	#instruction start "111 = set_reg %rcx 106 state: 110":
+	#instruction start "112 = set_reg %rax 94 state: 111":
+	#instruction start "113 = call 93":
+	addq $0, %rsp
+	movq -32(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -24(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "114 = proj0 113":
+	#instruction start "115 = proj1 113":
+	#Block jump
+	jmp .L6
+.L5:
+	#Block jump elided
+.L6:
+	#instruction start "116 = constant(0)":
+	movq $a, %rbx
+	#instruction start "117 = phi (region: 77) 71 114":
+	#instruction start "118 = load_volatile 116, state: 117":
+	movq %rbx, %rdi
+	movq (%rdi), %r12
+	#instruction start "119 = proj0 118":
+	#instruction start "120 = proj1 118":
+	#instruction start "121 = load_volatile 120, state: 119":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "122 = proj0 121":
+	#instruction start "123 = proj1 121":
+	#instruction start "124 = constant(1)":
+	movl $1, %r12d
+	#instruction start "125 = 123 == 124":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "127 = if 77 125":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L8
+.L7:
+	#instruction start "130 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "131 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "132 = constant(11)":
+	movl $11, %r13d
+	#instruction start "133 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "134 = alloc with size 8":
+	leaq -192(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "135 = store 134 130, state: 122":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "136 = alloc with size 8":
+	leaq -200(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "137 = store 136 131, state: 135":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "138 = alloc with size 4":
+	leaq -204(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "139 = store 138 132, state: 137":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "140 = alloc with size 8":
+	leaq -212(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "141 = store 140 133, state: 139":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "142 = constant(2)":
+	leaq -80(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "143 = constant(0)":
+	leaq -88(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "144 = load part address of 134 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "145 = proj0 144":
+	#instruction start "146 = proj1 144":
+	#instruction start "147 = load part address of 136 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "148 = proj0 147":
+	#instruction start "149 = proj1 147":
+	#instruction start "150 = load part address of 138 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "151 = proj0 150":
+	#instruction start "152 = proj1 150":
+	#instruction start "153 = load part address of 140 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "154 = proj0 153":
+	#instruction start "155 = proj1 153":
+	#instruction start "156 = allocate_call_stack 0":
+	#instruction start "157 = set_reg %rdi 146":
+	#instruction start "158 = set_reg %rsi 149 state: 157":
+	#instruction start "159 = set_reg %rdx 152 state: 158":
+	#instruction start "160 = set_reg %rcx 155 state: 159":
+	#instruction start "161 = set_reg %rax 143 state: 160":
+	#instruction start "162 = call 142":
+	addq $0, %rsp
+	movq -88(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -80(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "163 = proj0 162":
+	#instruction start "164 = proj1 162":
+	#Block jump
+	jmp .L9
+.L8:
+	#Block jump elided
+.L9:
+	#instruction start "165 = constant(0)":
+	movl $0, %ebx
+	#instruction start "166 = set_reg %rax 165":
+	#instruction start "167 = phi (region: 126) 122 163":
+	#instruction start "168 = return 126, 166, 167":
+	movq %rbx, %rax
+	#Block return.
+	movq -220(%rbp), %rbx
+	movq -228(%rbp), %r12
+	movq -236(%rbp), %r13
+	movq -244(%rbp), %r14
+	movq -252(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls3:
+	.string "func((int[]){1, 2, 3}) == 6\000"
+.Ls4:
+	.string "/root/repo/tests/compound_literals.c\000"
+.Ls5:
+	.string "main"
+.Ls6:
+	.string "*a == 1\000"
+.section .data
+.align 8
+.L10:
+.quad 8589934593
+.global a
+a:
+.quad .L10
+.section .text
@@ -0,0 +1,143 @@
+.global f
+f:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -40(%rbp)
+	movq %r12, -48(%rbp)
+	movq %r13, -56(%rbp)
+	movq %r14, -64(%rbp)
+	movq %rdi, %rbx
+	movq %rsi, %r12
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = %rsi":
+	#instruction start "8 = alloc with size 8":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "9 = alloc with size 8":
+	leaq -24(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "10 = store part of 8 with offset 0":
+	movq %r13, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "11 = store part of 9 with offset 0":
+	movq %r14, %rsi
+	leaq (%rsi), %rsi
+	movq %r12, (%rsi)
+	#instruction start "12 = load 8, state: 11":
+	movq %r13, %rdi
+	movq (%rdi), %rbx
+	#instruction start "13 = if 2 12":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#Phi node to 20 (19 17 9)
+	movq %r14, %rax
+	movq %rax, %rbx
+	#Block jump
+	jmp .L5
+.L4:
+	#instruction start "16 = load 8, state: 11":
+	movq %r13, %rdi
+	movq (%rdi), %r12
+	#instruction start "17 = alloc with size 8":
+	leaq -32(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "18 = store 17 16, state: 11":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#Phi node to 20 (19 17 9)
+	movq %r13, %rax
+	movq %rax, %rbx
+	#Block jump elided
+.L5:
+	#instruction start "20 = phi (region: 19) 17 9":
+	#instruction start "21 = phi (region: 19) 18 11":
+	#instruction start "22 = load_volatile 20, state: 21":
+	movq %rbx, %rdi
+	movq (%rdi), %r12
+	#instruction start "23 = proj0 22":
+	#instruction start "24 = proj1 22":
+	#instruction start "25 = set_reg %rax 24":
+	#instruction start "26 = return 19, 25, 23":
+	movq %r12, %rax
+	#Block return.
+	movq -40(%rbp), %rbx
+	movq -48(%rbp), %r12
+	movq -56(%rbp), %r13
+	movq -64(%rbp), %r14
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movq %rbx, -32(%rbp)
+	movq %r12, -40(%rbp)
+	movq %r13, -48(%rbp)
+.L6:
+	#instruction start "30 = proj3 28":
+	#instruction start "33 = alloc with size 8":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "34 = set_zero_ptr 33, size: 8":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	#instruction start "35 = constant(0)":
+	movq $.Ls0, %r12
+	#instruction start "36 = store 33 35, state: 34":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "43 = constant(0)":
+	movl $0, %r12d
+	#instruction start "44 = if 29 43":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L8
+.L7:
+	#instruction start "39 = constant(0)":
+	movq $.Ls0, %r12
+	#instruction start "48 = alloc with size 8":
+	leaq -24(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "49 = store 48 39, state: 36":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#Phi node to 51 (50 33 48)
+	movq %r13, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L9
+.L8:
+	#Phi node to 51 (50 33 48)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L9:
+	#instruction start "51 = phi (region: 50) 33 48":
+	#instruction start "52 = phi (region: 50) 36 49":
+	#instruction start "53 = load_volatile 51, state: 52":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "54 = proj0 53":
+	#instruction start "55 = proj1 53":
+	#instruction start "57 = constant(0)":
+	movl $0, %ebx
+	#instruction start "58 = set_reg %rax 57":
+	#instruction start "59 = return 50, 58, 54":
+	movq %rbx, %rax
+	#Block return.
+	movq -32(%rbp), %rbx
+	movq -40(%rbp), %r12
+	movq -48(%rbp), %r13
+	leave 
+	ret 
+.section .rodata
+.Ls0:
+	.string "Hello\000"
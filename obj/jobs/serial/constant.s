@@ -0,0 +1,302 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movq %rbx, -128(%rbp)
+	movq %r12, -136(%rbp)
+	movq %r13, -144(%rbp)
+	movq %r14, -152(%rbp)
+	movq %r15, -160(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = alloc with size 4":
+	leaq -68(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "7 = set_zero_ptr 6, size: 4":
+	movq %rbx, %rdi
+	movl $0, (%rdi)
+	#instruction start "8 = constant(0)":
+	movl $0, %r12d
+	#instruction start "9 = if 2 8":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "21 = alloc with size 4":
+	leaq -72(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "22 = constant(1)":
+	movl $1, %r13d
+	#instruction start "23 = store 21 22, state: 7":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 25 (24 19 21)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L5
+.L4:
+	#instruction start "12 = constant(0)":
+	movl $0, %r12d
+	#instruction start "13 = constant(0)":
+	movl $0, %r14d
+	#instruction start "14 = 12 / 13 (signed)":
+	movq %r12, %rax
+	movq %r14, %rcx
+	cltd 
+	idivl %ecx
+	movl %eax, %r15d
+	#instruction start "15 = proj1 14":
+	#instruction start "16 = proj0 14":
+	#instruction start "17 = constant(10)":
+	movl $10, %r12d
+	#instruction start "18 = 17 * 16 (signed)":
+	movq %r12, %rax
+	movq %r15, %rcx
+	imull %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "19 = alloc with size 4":
+	leaq -76(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "20 = store 19 18, state: 15":
+	movq %r12, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 25 (24 19 21)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L5:
+	#instruction start "25 = phi (region: 24) 19 21":
+	#instruction start "26 = phi (region: 24) 20 23":
+	#instruction start "27 = memcpy from 6 to 25":
+	movq %rbx, %rsi
+	movq %r13, %rdi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "30 = constant(1)":
+	movl $1, %ebx
+	#instruction start "31 = if 24 30":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "37 = alloc with size 8":
+	leaq -84(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "38 = constant(2)":
+	movq $.LVAR0xx, %r12
+	#instruction start "39 = store 37 38, state: 27":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#Phi node to 41 (40 34 37)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L8
+.L7:
+	#instruction start "34 = alloc with size 8":
+	leaq -92(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "35 = constant(2)":
+	movq $.LVAR0xx, %r13
+	#instruction start "36 = store 34 35, state: 27":
+	movq %rbx, %rsi
+	movq %r13, (%rsi)
+	#Phi node to 41 (40 34 37)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L8:
+	#instruction start "41 = phi (region: 40) 34 37":
+	#instruction start "42 = phi (region: 40) 36 39":
+	#instruction start "43 = load_volatile 41, state: 42":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "44 = proj0 43":
+	#instruction start "45 = proj1 43":
+	#instruction start "48 = constant(4)":
+	movq $.LVAR2tok, %rbx
+	#instruction start "49 = load_volatile 48, state: 44":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "50 = proj0 49":
+	#instruction start "51 = proj1 49":
+	#instruction start "52 = int_cast_zero 51":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %rbx
+	#instruction start "53 = constant(3)":
+	movq $.LVAR1prec, %r12
+	#instruction start "54 = constant(1)":
+	movq $1, %r13
+	#instruction start "55 = 52 * 54":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "56 = 53 + 55":
+	movq %r12, %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "57 = constant(3)":
+	movq $.LVAR1prec+42, %r12
+	#instruction start "58 = 56 == 57":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "60 = if 40 58":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "63 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "64 = constant(7)":
+	movq $.Ls7, %r12
+	#instruction start "65 = constant(18)":
+	movl $18, %r13d
+	#instruction start "66 = constant(8)":
+	movq $.Ls8, %r14
+	#instruction start "67 = alloc with size 8":
+	leaq -100(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "68 = store 67 63, state: 50":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "69 = alloc with size 8":
+	leaq -108(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "70 = store 69 64, state: 68":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "71 = alloc with size 4":
+	leaq -112(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "72 = store 71 65, state: 70":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "73 = alloc with size 8":
+	leaq -120(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "74 = store 73 66, state: 72":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "75 = constant(5)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "76 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "77 = load part address of 67 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "78 = proj0 77":
+	#instruction start "79 = proj1 77":
+	#instruction start "80 = load part address of 69 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "81 = proj0 80":
+	#instruction start "82 = proj1 80":
+	#instruction start "83 = load part address of 71 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "84 = proj0 83":
+	#instruction start "85 = proj1 83":
+	#instruction start "86 = load part address of 73 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "87 = proj0 86":
+	#instruction start "88 = proj1 86":
+	#instruction start "89 = allocate_call_stack 0":
+	#instruction start "90 = set_reg %rdi 79":
+	#instruction start "91 = set_reg %rsi 82 state: 90":
+	#instruction start "92 = set_reg %rdx 85 state: 91":
+	#instruction start "93 = set_reg %rcx 88 state: 92":
+	#instruction start "94 = set_reg %rax 76 state: 93":
+	#instruction start "95 = call 75":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "96 = proj0 95":
+	#instruction start "97 = proj1 95":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "98 = constant(0)":
+	movl $0, %ebx
+	#instruction start "99 = set_reg %rax 98":
+	#instruction start "100 = phi (region: 59) 50 96":
+	#instruction start "101 = return 59, 99, 100":
+	movq %rbx, %rax
+	#Block return.
+	movq -128(%rbp), %rbx
+	movq -136(%rbp), %r12
+	movq -144(%rbp), %r13
+	movq -152(%rbp), %r14
+	movq -160(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls6:
+	.string "prec + tok == prec + (int)'*'\000"
+.Ls7:
+	.string "/root/repo/tests/constant.c\000"
+.Ls8:
+	.string "main"
+.section .data
+.align 4
+.global f1
+f1:
+.byte 0
+.byte 0
+.byte 192
+.byte 63
+.section .text
+.section .data
+.align 4
+.global f3
+f3:
+.byte 205
+.byte 204
+.byte 12
+.byte 64
+.section .text
+.section .data
+.align 4
+.LVAR0xx:
+.byte 3
+.byte 0
+.byte 0
+.byte 0
+.section .text
+.section .data
+.align 1
+.LVAR1prec:
+.zero 256
+.section .text
+.section .data
+.align 4
+.LVAR2tok:
+.byte 42
+.byte 0
+.byte 0
+.byte 0
+.section .text
@@ -0,0 +1,661 @@
+.global if_goto
+if_goto:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -28(%rbp)
+	movq %r12, -36(%rbp)
+	movq %r13, -44(%rbp)
+	movq %r14, -52(%rbp)
+	movl %edi, %ebx
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = alloc with size 4":
+	leaq -20(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "8 = store part of 7 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "9 = load 7, state: 8":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "10 = constant(1)":
+	movl $1, %r13d
+	#instruction start "11 = 9 == 10":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "12 = if 2 11":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L8
+.L3:
+	#Block jump elided
+.L4:
+	#instruction start "19 = phi (region: 18) 20 8":
+	#instruction start "21 = load 7, state: 19":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "22 = constant(2)":
+	movl $2, %r12d
+	#instruction start "23 = 21 == 22":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "24 = if 18 23":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L5:
+	#Block jump elided
+.L6:
+	#instruction start "34 = constant(0)":
+	movl $0, %ebx
+	#instruction start "35 = set_reg %rax 34":
+	#instruction start "36 = phi (region: 33) 37 19":
+	#instruction start "38 = return 33, 35, 36":
+	movq %rbx, %rax
+	#Block return.
+	movq -28(%rbp), %rbx
+	movq -36(%rbp), %r12
+	movq -44(%rbp), %r13
+	movq -52(%rbp), %r14
+	leave 
+	ret 
+.L7:
+	#Block jump
+	jmp .L10
+.L8:
+	#Block jump elided
+.L9:
+	#Block jump elided
+.L10:
+	#instruction start "27 = constant(1)":
+	movl $1, %ebx
+	#instruction start "28 = set_reg %rax 27":
+	#instruction start "29 = phi (region: 15) 8 19":
+	#instruction start "31 = return 15, 28, 29":
+	movq %rbx, %rax
+	#Block return.
+	movq -28(%rbp), %rbx
+	movq -36(%rbp), %r12
+	movq -44(%rbp), %r13
+	movq -52(%rbp), %r14
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $448, %rsp
+	movq %rbx, -412(%rbp)
+	movq %r12, -420(%rbp)
+	movq %r13, -428(%rbp)
+	movq %r14, -436(%rbp)
+	movq %r15, -444(%rbp)
+.L11:
+	#Block jump elided
+.L12:
+	#instruction start "42 = proj3 40":
+	#instruction start "47 = constant(1)":
+	movl $1, %ebx
+	#Phi node to 283 (49 47 52)
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#Block jump elided
+.L13:
+	#instruction start "55 = phi (region: 49) 42 53":
+	#instruction start "283 = phi (region: 49) 47 52":
+	#Block jump elided
+.L14:
+	#instruction start "58 = constant(2)":
+	movl $2, %ebx
+	#instruction start "59 = 283 * 58 (signed)":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	imull %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "64 = constant(2)":
+	movl $2, %ebx
+	#instruction start "65 = 59 == 64":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "67 = if 61 65":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#instruction start "70 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "71 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "72 = constant(19)":
+	movl $19, %r13d
+	#instruction start "73 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "74 = alloc with size 8":
+	leaq -288(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "75 = store 74 70, state: 55":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "76 = alloc with size 8":
+	leaq -296(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "77 = store 76 71, state: 75":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "78 = alloc with size 4":
+	leaq -300(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "79 = store 78 72, state: 77":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "80 = alloc with size 8":
+	leaq -308(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "81 = store 80 73, state: 79":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "82 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "83 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "84 = load part address of 74 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "85 = proj0 84":
+	#instruction start "86 = proj1 84":
+	#instruction start "87 = load part address of 76 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "88 = proj0 87":
+	#instruction start "89 = proj1 87":
+	#instruction start "90 = load part address of 78 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "91 = proj0 90":
+	#instruction start "92 = proj1 90":
+	#instruction start "93 = load part address of 80 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "94 = proj0 93":
+	#instruction start "95 = proj1 93":
+	#instruction start "96 = allocate_call_stack 0":
+	#instruction start "97 = set_reg %rdi 86":
+	#instruction start "98 = set_reg %rsi 89 state: 97":
+	#instruction start "99 = set_reg %rdx 92 state: 98":
+	#instruction start "100 = set_reg %rcx 95 state: 99":
+	#instruction start "101 = set_reg %rax 83 state: 100":
+	#instruction start "102 = call 82":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "103 = proj0 102":
+	#instruction start "104 = proj1 102":
+	#Block jump
+	jmp .L17
+.L16:
+	#Block jump elided
+.L17:
+	#instruction start "105 = alloc with size 4":
+	leaq -312(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "106 = constant(1)":
+	movl $1, %r12d
+	#instruction start "107 = phi (region: 66) 55 103":
+	#instruction start "108 = store 105 106, state: 107":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "109 = constant(4)":
+	movq $if_goto, %r12
+	#instruction start "110 = constant(0)":
+	movq $0, %r13
+	#instruction start "111 = load part address of 105 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "112 = proj0 111":
+	#instruction start "113 = proj1 111":
+	#instruction start "114 = allocate_call_stack 0":
+	#instruction start "115 = set_reg %rdi 113":
+	#instruction start "116 = set_reg %rax 110 state: 115":
+	#instruction start "117 = call 109":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "118 = proj0 117":
+	#instruction start "119 = proj1 117":
+	#instruction start "120 = %rax":
+	#instruction start "121 = int_cast_zero 120":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "122 = constant(1)":
+	movl $1, %ebx
+	#instruction start "123 = 121 == 122":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "125 = if 66 123":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "128 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "129 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "130 = constant(21)":
+	movl $21, %r13d
+	#instruction start "131 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "132 = alloc with size 8":
+	leaq -320(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "133 = store 132 128, state: 118":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "134 = alloc with size 8":
+	leaq -328(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "135 = store 134 129, state: 133":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "136 = alloc with size 4":
+	leaq -332(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "137 = store 136 130, state: 135":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "138 = alloc with size 8":
+	leaq -340(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "139 = store 138 131, state: 137":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "140 = constant(0)":
+	leaq -80(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "141 = constant(0)":
+	leaq -88(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "142 = load part address of 132 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "143 = proj0 142":
+	#instruction start "144 = proj1 142":
+	#instruction start "145 = load part address of 134 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "146 = proj0 145":
+	#instruction start "147 = proj1 145":
+	#instruction start "148 = load part address of 136 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "149 = proj0 148":
+	#instruction start "150 = proj1 148":
+	#instruction start "151 = load part address of 138 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "152 = proj0 151":
+	#instruction start "153 = proj1 151":
+	#instruction start "154 = allocate_call_stack 0":
+	#instruction start "155 = set_reg %rdi 144":
+	#instruction start "156 = set_reg %rsi 147 state: 155":
+	#instruction start "157 = set_reg %rdx 150 state: 156":
+	#instruction start "158 = set_reg %rcx 153 state: 157":
+	#instruction start "159 = set_reg %rax 141 state: 158":
+	#instruction start "160 = call 140":
+	addq $0, %rsp
+	movq -88(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -80(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "161 = proj0 160":
+	#instruction start "162 = proj1 160":
+	#Block jump
+	jmp .L20
+.L19:
+	#Block jump elided
+.L20:
+	#instruction start "163 = alloc with size 4":
+	leaq -344(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "164 = constant(2)":
+	movl $2, %r12d
+	#instruction start "165 = phi (region: 124) 118 161":
+	#instruction start "166 = store 163 164, state: 165":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "167 = constant(4)":
+	movq $if_goto, %r12
+	#instruction start "168 = constant(0)":
+	movq $0, %r13
+	#instruction start "169 = load part address of 163 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "170 = proj0 169":
+	#instruction start "171 = proj1 169":
+	#instruction start "172 = allocate_call_stack 0":
+	#instruction start "173 = set_reg %rdi 171":
+	#instruction start "174 = set_reg %rax 168 state: 173":
+	#instruction start "175 = call 167":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "176 = proj0 175":
+	#instruction start "177 = proj1 175":
+	#instruction start "178 = %rax":
+	#instruction start "179 = int_cast_zero 178":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "180 = constant(1)":
+	movl $1, %ebx
+	#instruction start "181 = 179 == 180":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "183 = if 124 181":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "186 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "187 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "188 = constant(22)":
+	movl $22, %r13d
+	#instruction start "189 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "190 = alloc with size 8":
+	leaq -352(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "191 = store 190 186, state: 176":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "192 = alloc with size 8":
+	leaq -360(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "193 = store 192 187, state: 191":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "194 = alloc with size 4":
+	leaq -364(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "195 = store 194 188, state: 193":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "196 = alloc with size 8":
+	leaq -372(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "197 = store 196 189, state: 195":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "198 = constant(0)":
+	leaq -152(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "199 = constant(0)":
+	leaq -160(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "200 = load part address of 190 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "201 = proj0 200":
+	#instruction start "202 = proj1 200":
+	#instruction start "203 = load part address of 192 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "204 = proj0 203":
+	#instruction start "205 = proj1 203":
+	#instruction start "206 = load part address of 194 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "207 = proj0 206":
+	#instruction start "208 = proj1 206":
+	#instruction start "209 = load part address of 196 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "210 = proj0 209":
+	#instruction start "211 = proj1 209":
+	#instruction start "212 = allocate_call_stack 0":
+	#instruction start "213 = set_reg %rdi 202":
+	#instruction start "214 = set_reg %rsi 205 state: 213":
+	#instruction start "215 = set_reg %rdx 208 state: 214":
+	#instruction start "216 = set_reg %rcx 211 state: 215":
+	#instruction start "217 = set_reg %rax 199 state: 216":
+	#instruction start "218 = call 198":
+	addq $0, %rsp
+	movq -160(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -152(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "219 = proj0 218":
+	#instruction start "220 = proj1 218":
+	#Block jump
+	jmp .L23
+.L22:
+	#Block jump elided
+.L23:
+	#instruction start "221 = alloc with size 4":
+	leaq -376(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "222 = constant(3)":
+	movl $3, %r12d
+	#instruction start "223 = phi (region: 182) 176 219":
+	#instruction start "224 = store 221 222, state: 223":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "225 = constant(4)":
+	movq $if_goto, %r12
+	#instruction start "226 = constant(0)":
+	movq $0, %r13
+	#instruction start "227 = load part address of 221 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "228 = proj0 227":
+	#instruction start "229 = proj1 227":
+	#instruction start "230 = allocate_call_stack 0":
+	#instruction start "231 = set_reg %rdi 229":
+	#instruction start "232 = set_reg %rax 226 state: 231":
+	#instruction start "233 = call 225":
+	addq $0, %rsp
+	movq %r13, %rax
+	movq %r14, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "234 = proj0 233":
+	#instruction start "235 = proj1 233":
+	#instruction start "236 = %rax":
+	#instruction start "237 = int_cast_zero 236":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "238 = constant(0)":
+	movl $0, %ebx
+	#instruction start "239 = 237 == 238":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "241 = if 182 239":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L25
+.L24:
+	#instruction start "244 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "245 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "246 = constant(23)":
+	movl $23, %r13d
+	#instruction start "247 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "248 = alloc with size 8":
+	leaq -384(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "249 = store 248 244, state: 234":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "250 = alloc with size 8":
+	leaq -392(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "251 = store 250 245, state: 249":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "252 = alloc with size 4":
+	leaq -396(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "253 = store 252 246, state: 251":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "254 = alloc with size 8":
+	leaq -404(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "255 = store 254 247, state: 253":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "256 = constant(0)":
+	leaq -224(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "257 = constant(0)":
+	leaq -232(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "258 = load part address of 248 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "259 = proj0 258":
+	#instruction start "260 = proj1 258":
+	#instruction start "261 = load part address of 250 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "262 = proj0 261":
+	#instruction start "263 = proj1 261":
+	#instruction start "264 = load part address of 252 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "265 = proj0 264":
+	#instruction start "266 = proj1 264":
+	#instruction start "267 = load part address of 254 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "268 = proj0 267":
+	#instruction start "269 = proj1 267":
+	#instruction start "270 = allocate_call_stack 0":
+	#instruction start "271 = set_reg %rdi 260":
+	#instruction start "272 = set_reg %rsi 263 state: 271":
+	#instruction start "273 = set_reg %rdx 266 state: 272":
+	#instruction start "274 = set_reg %rcx 269 state: 273":
+	#instruction start "275 = set_reg %rax 257 state: 274":
+	#instruction start "276 = call 256":
+	addq $0, %rsp
+	movq -232(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -224(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "277 = proj0 276":
+	#instruction start "278 = proj1 276":
+	#Block jump
+	jmp .L26
+.L25:
+	#Block jump elided
+.L26:
+	#instruction start "279 = constant(0)":
+	movl $0, %ebx
+	#instruction start "280 = set_reg %rax 279":
+	#instruction start "281 = phi (region: 240) 234 277":
+	#instruction start "282 = return 240, 280, 281":
+	movq %rbx, %rax
+	#Block return.
+	movq -412(%rbp), %rbx
+	movq -420(%rbp), %r12
+	movq -428(%rbp), %r13
+	movq -436(%rbp), %r14
+	movq -444(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "var == 2\000"
+.Ls2:
+	.string "/root/repo/tests/goto.c\000"
+.Ls3:
+	.string "main"
+.Ls5:
+	.string "if_goto(1) == 1\000"
+.Ls6:
+	.string "if_goto(2) == 1\000"
+.Ls7:
+	.string "if_goto(3) == 0\000"
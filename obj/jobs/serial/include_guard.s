@@ -0,0 +1,427 @@
+.global guarded_function
+guarded_function:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rbx, -16(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(1)":
+	movl $1, %ebx
+	#instruction start "7 = set_reg %rax 6":
+	#instruction start "8 = return 2, 7, 3":
+	movq %rbx, %rax
+	#Block return.
+	movq -16(%rbp), %rbx
+	leave 
+	ret 
+.global guarded_function_again
+guarded_function_again:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rbx, -16(%rbp)
+.L3:
+	#instruction start "12 = proj3 10":
+	#instruction start "15 = constant(1)":
+	movl $1, %ebx
+	#instruction start "16 = set_reg %rax 15":
+	#instruction start "17 = return 11, 16, 12":
+	movq %rbx, %rax
+	#Block return.
+	movq -16(%rbp), %rbx
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $320, %rsp
+	movq %rbx, -284(%rbp)
+	movq %r12, -292(%rbp)
+	movq %r13, -300(%rbp)
+	movq %r14, -308(%rbp)
+	movq %r15, -316(%rbp)
+.L4:
+	#instruction start "21 = proj3 19":
+	#instruction start "26 = constant(0)":
+	movl $0, %ebx
+	#instruction start "29 = constant(1)":
+	movl $1, %r12d
+	#instruction start "30 = 26 + 29":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "33 = constant(1)":
+	movl $1, %ebx
+	#instruction start "34 = 30 + 33":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addl %ecx, %eax
+	movl %eax, %r12d
+	#instruction start "37 = constant(2)":
+	movl $2, %ebx
+	#instruction start "38 = 34 == 37":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "40 = if 20 38":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L6
+.L5:
+	#instruction start "43 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "44 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "45 = constant(17)":
+	movl $17, %r13d
+	#instruction start "46 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "47 = alloc with size 8":
+	leaq -200(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "48 = store 47 43, state: 21":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "49 = alloc with size 8":
+	leaq -208(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "50 = store 49 44, state: 48":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "51 = alloc with size 4":
+	leaq -212(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "52 = store 51 45, state: 50":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "53 = alloc with size 8":
+	leaq -220(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "54 = store 53 46, state: 52":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "55 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "56 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "57 = load part address of 47 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "58 = proj0 57":
+	#instruction start "59 = proj1 57":
+	#instruction start "60 = load part address of 49 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "61 = proj0 60":
+	#instruction start "62 = proj1 60":
+	#instruction start "63 = load part address of 51 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "64 = proj0 63":
+	#instruction start "65 = proj1 63":
+	#instruction start "66 = load part address of 53 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "67 = proj0 66":
+	#instruction start "68 = proj1 66":
+	#instruction start "69 = allocate_call_stack 0":
+	#instruction start "70 = set_reg %rdi 59":
+	#instruction start "71 = set_reg %rsi 62 state: 70":
+	#instruction start "72 = set_reg %rdx 65 state: 71":
+	#instruction start "73 = set_reg %rcx 68 state: 72":
+	#instruction start "74 = set_reg %rax 56 state: 73":
+	#instruction start "75 = call 55":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "76 = proj0 75":
+	#instruction start "77 = proj1 75":
+	#Block jump
+	jmp .L7
+.L6:
+	#Block jump elided
+.L7:
+	#instruction start "78 = constant(4)":
+	movq $guarded_function, %rbx
+	#instruction start "79 = constant(0)":
+	movq $0, %r12
+	#instruction start "80 = allocate_call_stack 0":
+	#instruction start "81 = set_reg %rax 79":
+	#instruction start "82 = phi (region: 39) 21 76":
+	#instruction start "83 = call 78":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "84 = proj0 83":
+	#instruction start "85 = proj1 83":
+	#instruction start "86 = %rax":
+	#instruction start "87 = int_cast_zero 86":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "88 = constant(1)":
+	movl $1, %r12d
+	#instruction start "89 = 87 == 88":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "91 = if 39 89":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L9
+.L8:
+	#instruction start "94 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "95 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "96 = constant(19)":
+	movl $19, %r13d
+	#instruction start "97 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "98 = alloc with size 8":
+	leaq -228(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "99 = store 98 94, state: 84":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "100 = alloc with size 8":
+	leaq -236(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "101 = store 100 95, state: 99":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "102 = alloc with size 4":
+	leaq -240(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "103 = store 102 96, state: 101":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "104 = alloc with size 8":
+	leaq -248(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "105 = store 104 97, state: 103":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "106 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "107 = constant(0)":
+	leaq -80(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "108 = load part address of 98 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "109 = proj0 108":
+	#instruction start "110 = proj1 108":
+	#instruction start "111 = load part address of 100 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "112 = proj0 111":
+	#instruction start "113 = proj1 111":
+	#instruction start "114 = load part address of 102 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "115 = proj0 114":
+	#instruction start "116 = proj1 114":
+	#instruction start "117 = load part address of 104 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "118 = proj0 117":
+	#instruction start "119 = proj1 117":
+	#instruction start "120 = allocate_call_stack 0":
+	#instruction start "121 = set_reg %rdi 110":
+	#instruction start "122 = set_reg %rsi 113 state: 121":
+	#instruction start "123 = set_reg %rdx 116 state: 122":
+	#instruction start "124 = set_reg %rcx 119 state: 123":
+	#instruction start "125 = set_reg %rax 107 state: 124":
+	#instruction start "126 = call 106":
+	addq $0, %rsp
+	movq -80(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -72(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "127 = proj0 126":
+	#instruction start "128 = proj1 126":
+	#Block jump
+	jmp .L10
+.L9:
+	#Block jump elided
+.L10:
+	#instruction start "129 = constant(6)":
+	movq $guarded_function_again, %rbx
+	#instruction start "130 = constant(0)":
+	movq $0, %r12
+	#instruction start "131 = allocate_call_stack 0":
+	#instruction start "132 = set_reg %rax 130":
+	#instruction start "133 = phi (region: 90) 84 127":
+	#instruction start "134 = call 129":
+	addq $0, %rsp
+	movq %r12, %rax
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "135 = proj0 134":
+	#instruction start "136 = proj1 134":
+	#instruction start "137 = %rax":
+	#instruction start "138 = int_cast_zero 137":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "139 = constant(1)":
+	movl $1, %r12d
+	#instruction start "140 = 138 == 139":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "142 = if 90 140":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L12
+.L11:
+	#instruction start "145 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "146 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "147 = constant(20)":
+	movl $20, %r13d
+	#instruction start "148 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "149 = alloc with size 8":
+	leaq -256(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "150 = store 149 145, state: 135":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "151 = alloc with size 8":
+	leaq -264(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "152 = store 151 146, state: 150":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "153 = alloc with size 4":
+	leaq -268(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "154 = store 153 147, state: 152":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "155 = alloc with size 8":
+	leaq -276(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "156 = store 155 148, state: 154":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "157 = constant(0)":
+	leaq -136(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "158 = constant(0)":
+	leaq -144(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "159 = load part address of 149 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "160 = proj0 159":
+	#instruction start "161 = proj1 159":
+	#instruction start "162 = load part address of 151 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "163 = proj0 162":
+	#instruction start "164 = proj1 162":
+	#instruction start "165 = load part address of 153 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "166 = proj0 165":
+	#instruction start "167 = proj1 165":
+	#instruction start "168 = load part address of 155 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "169 = proj0 168":
+	#instruction start "170 = proj1 168":
+	#instruction start "171 = allocate_call_stack 0":
+	#instruction start "172 = set_reg %rdi 161":
+	#instruction start "173 = set_reg %rsi 164 state: 172":
+	#instruction start "174 = set_reg %rdx 167 state: 173":
+	#instruction start "175 = set_reg %rcx 170 state: 174":
+	#instruction start "176 = set_reg %rax 158 state: 175":
+	#instruction start "177 = call 157":
+	addq $0, %rsp
+	movq -144(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -136(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "178 = proj0 177":
+	#instruction start "179 = proj1 177":
+	#Block jump
+	jmp .L13
+.L12:
+	#Block jump elided
+.L13:
+	#instruction start "180 = constant(0)":
+	movl $0, %ebx
+	#instruction start "181 = set_reg %rax 180":
+	#instruction start "182 = phi (region: 141) 135 178":
+	#instruction start "183 = return 141, 181, 182":
+	movq %rbx, %rax
+	#Block return.
+	movq -284(%rbp), %rbx
+	movq -292(%rbp), %r12
+	movq -300(%rbp), %r13
+	movq -308(%rbp), %r14
+	movq -316(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "count == 2\000"
+.Ls2:
+	.string "/root/repo/tests/include_guard.c\000"
+.Ls3:
+	.string "main"
+.Ls5:
+	.string "guarded_function() == 1\000"
+.Ls7:
+	.string "guarded_function_again() == 1\000"
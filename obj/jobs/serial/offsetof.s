@@ -0,0 +1,1069 @@
+__bswap_16:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movq %rbx, -18(%rbp)
+	movq %r12, -26(%rbp)
+	movq %r13, -34(%rbp)
+	movq %r14, -42(%rbp)
+	movzwl %di, %ebx
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = alloc with size 2":
+	leaq -10(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "8 = store part of 7 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movw %bx, (%rsi)
+	#instruction start "9 = load 7, state: 8":
+	movq %r12, %rdi
+	movzwl (%rdi), %ebx
+	#instruction start "10 = int_cast_zero 9":
+	movq %rbx, %rax
+	movl %eax, %r13d
+	#instruction start "11 = constant(8)":
+	movl $8, %ebx
+	#instruction start "12 = 10 >> 11 (signed)":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	sarl %cl, %eax
+	movl %eax, %r14d
+	#instruction start "13 = constant(255)":
+	movl $255, %ebx
+	#instruction start "14 = 12 & 13":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	andl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "15 = load 7, state: 8":
+	movq %r12, %rdi
+	movzwl (%rdi), %ebx
+	#instruction start "16 = int_cast_zero 15":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "17 = constant(255)":
+	movl $255, %ebx
+	#instruction start "18 = 16 & 17":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	andl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "19 = constant(8)":
+	movl $8, %ebx
+	#instruction start "20 = 18 << 19":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	sall %cl, %eax
+	movl %eax, %r12d
+	#instruction start "21 = 14 | 20":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "22 = int_cast_zero 21":
+	movq %rbx, %rax
+	movzwl %ax, %r12d
+	#instruction start "23 = set_reg %rax 22":
+	#instruction start "24 = return 2, 23, 8":
+	movq %r12, %rax
+	#Block return.
+	movq -18(%rbp), %rbx
+	movq -26(%rbp), %r12
+	movq -34(%rbp), %r13
+	movq -42(%rbp), %r14
+	leave 
+	ret 
+__bswap_32:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movq %r13, -36(%rbp)
+	movq %r14, -44(%rbp)
+	movq %r15, -52(%rbp)
+	movl %edi, %ebx
+.L3:
+	#instruction start "28 = proj3 26":
+	#instruction start "29 = proj1 26":
+	#instruction start "31 = %rdi":
+	#instruction start "32 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "33 = store part of 32 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "34 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "35 = constant(4278190080)":
+	movl $4278190080, %r13d
+	#instruction start "36 = 34 & 35":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	andl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "37 = constant(24)":
+	movl $24, %ebx
+	#instruction start "38 = 36 >> 37":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	shrl %cl, %eax
+	movl %eax, %r13d
+	#instruction start "39 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "40 = constant(16711680)":
+	movl $16711680, %r14d
+	#instruction start "41 = 39 & 40":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andl %ecx, %eax
+	movl %eax, %r15d
+	#instruction start "42 = constant(8)":
+	movl $8, %ebx
+	#instruction start "43 = 41 >> 42":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	shrl %cl, %eax
+	movl %eax, %r14d
+	#instruction start "44 = 38 | 43":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "45 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %r13d
+	#instruction start "46 = constant(65280)":
+	movl $65280, %r14d
+	#instruction start "47 = 45 & 46":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andl %ecx, %eax
+	movl %eax, %r15d
+	#instruction start "48 = constant(8)":
+	movl $8, %r13d
+	#instruction start "49 = 47 << 48":
+	movq %r15, %rax
+	movq %r13, %rcx
+	sall %cl, %eax
+	movl %eax, %r14d
+	#instruction start "50 = 44 | 49":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "51 = load 32, state: 33":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "52 = constant(255)":
+	movl $255, %r12d
+	#instruction start "53 = 51 & 52":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	andl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "54 = constant(24)":
+	movl $24, %ebx
+	#instruction start "55 = 53 << 54":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	sall %cl, %eax
+	movl %eax, %r12d
+	#instruction start "56 = 50 | 55":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "57 = set_reg %rax 56":
+	#instruction start "58 = return 27, 57, 33":
+	movq %rbx, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	movq -36(%rbp), %r13
+	movq -44(%rbp), %r14
+	movq -52(%rbp), %r15
+	leave 
+	ret 
+__bswap_64:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rbx, -24(%rbp)
+	movq %r12, -32(%rbp)
+	movq %r13, -40(%rbp)
+	movq %r14, -48(%rbp)
+	movq %r15, -56(%rbp)
+	movq %rdi, %rbx
+.L4:
+	#instruction start "62 = proj3 60":
+	#instruction start "63 = proj1 60":
+	#instruction start "65 = %rdi":
+	#instruction start "66 = alloc with size 8":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "67 = store part of 66 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "68 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "69 = constant(-72057594037927936)":
+	movabsq $-72057594037927936, %r13
+	#instruction start "70 = 68 & 69":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "71 = constant(56)":
+	movq $56, %rbx
+	#instruction start "72 = 70 >> 71":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r13
+	#instruction start "73 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "74 = constant(71776119061217280)":
+	movabsq $71776119061217280, %r14
+	#instruction start "75 = 73 & 74":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "76 = constant(40)":
+	movq $40, %rbx
+	#instruction start "77 = 75 >> 76":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "78 = 72 | 77":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "79 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "80 = constant(280375465082880)":
+	movabsq $280375465082880, %r14
+	#instruction start "81 = 79 & 80":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "82 = constant(24)":
+	movq $24, %r13
+	#instruction start "83 = 81 >> 82":
+	movq %r15, %rax
+	movq %r13, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "84 = 78 | 83":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "85 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "86 = constant(1095216660480)":
+	movabsq $1095216660480, %r14
+	#instruction start "87 = 85 & 86":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "88 = constant(8)":
+	movq $8, %rbx
+	#instruction start "89 = 87 >> 88":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	shrq %cl, %rax
+	movq %rax, %r14
+	#instruction start "90 = 84 | 89":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "91 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "92 = constant(4278190080)":
+	movabsq $4278190080, %r14
+	#instruction start "93 = 91 & 92":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "94 = constant(8)":
+	movq $8, %r13
+	#instruction start "95 = 93 << 94":
+	movq %r15, %rax
+	movq %r13, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "96 = 90 | 95":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "97 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "98 = constant(16711680)":
+	movq $16711680, %r14
+	#instruction start "99 = 97 & 98":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "100 = constant(24)":
+	movq $24, %rbx
+	#instruction start "101 = 99 << 100":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "102 = 96 | 101":
+	movq %r13, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "103 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %r13
+	#instruction start "104 = constant(65280)":
+	movq $65280, %r14
+	#instruction start "105 = 103 & 104":
+	movq %r13, %rax
+	movq %r14, %rcx
+	andq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "106 = constant(40)":
+	movq $40, %r13
+	#instruction start "107 = 105 << 106":
+	movq %r15, %rax
+	movq %r13, %rcx
+	salq %cl, %rax
+	movq %rax, %r14
+	#instruction start "108 = 102 | 107":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	orq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "109 = load 66, state: 67":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "110 = constant(255)":
+	movq $255, %r12
+	#instruction start "111 = 109 & 110":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	andq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "112 = constant(56)":
+	movq $56, %rbx
+	#instruction start "113 = 111 << 112":
+	movq %r14, %rax
+	movq %rbx, %rcx
+	salq %cl, %rax
+	movq %rax, %r12
+	#instruction start "114 = 108 | 113":
+	movq %r13, %rax
+	movq %r12, %rcx
+	orq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "115 = set_reg %rax 114":
+	#instruction start "116 = return 61, 115, 67":
+	movq %rbx, %rax
+	#Block return.
+	movq -24(%rbp), %rbx
+	movq -32(%rbp), %r12
+	movq -40(%rbp), %r13
+	movq -48(%rbp), %r14
+	movq -56(%rbp), %r15
+	leave 
+	ret 
+__uint16_identity:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -18(%rbp)
+	movq %r12, -26(%rbp)
+	movzwl %di, %ebx
+.L5:
+	#instruction start "120 = proj3 118":
+	#instruction start "121 = proj1 118":
+	#instruction start "123 = %rdi":
+	#instruction start "124 = alloc with size 2":
+	leaq -10(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "125 = store part of 124 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movw %bx, (%rsi)
+	#instruction start "126 = load 124, state: 125":
+	movq %r12, %rdi
+	movzwl (%rdi), %ebx
+	#instruction start "127 = set_reg %rax 126":
+	#instruction start "128 = return 119, 127, 125":
+	movq %rbx, %rax
+	#Block return.
+	movq -18(%rbp), %rbx
+	movq -26(%rbp), %r12
+	leave 
+	ret 
+__uint32_identity:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -20(%rbp)
+	movq %r12, -28(%rbp)
+	movl %edi, %ebx
+.L6:
+	#instruction start "132 = proj3 130":
+	#instruction start "133 = proj1 130":
+	#instruction start "135 = %rdi":
+	#instruction start "136 = alloc with size 4":
+	leaq -12(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "137 = store part of 136 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "138 = load 136, state: 137":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "139 = set_reg %rax 138":
+	#instruction start "140 = return 131, 139, 137":
+	movq %rbx, %rax
+	#Block return.
+	movq -20(%rbp), %rbx
+	movq -28(%rbp), %r12
+	leave 
+	ret 
+__uint64_identity:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rbx, -24(%rbp)
+	movq %r12, -32(%rbp)
+	movq %rdi, %rbx
+.L7:
+	#instruction start "144 = proj3 142":
+	#instruction start "145 = proj1 142":
+	#instruction start "147 = %rdi":
+	#instruction start "148 = alloc with size 8":
+	leaq -16(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "149 = store part of 148 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movq %rbx, (%rsi)
+	#instruction start "150 = load 148, state: 149":
+	movq %r12, %rdi
+	movq (%rdi), %rbx
+	#instruction start "151 = set_reg %rax 150":
+	#instruction start "152 = return 143, 151, 149":
+	movq %rbx, %rax
+	#Block return.
+	movq -24(%rbp), %rbx
+	movq -32(%rbp), %r12
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $480, %rsp
+	movq %rbx, -436(%rbp)
+	movq %r12, -444(%rbp)
+	movq %r13, -452(%rbp)
+	movq %r14, -460(%rbp)
+	movq %r15, -468(%rbp)
+.L8:
+	#instruction start "156 = proj3 154":
+	#instruction start "159 = constant(0)":
+	movq $0, %rbx
+	#instruction start "160 = constant(16)":
+	movq $16, %r12
+	#instruction start "161 = 159 + 160":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "162 = constant(0)":
+	movq $0, %rbx
+	#instruction start "163 = constant(1)":
+	movq $1, %r12
+	#instruction start "164 = 161 - 162":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	subq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "165 = 164 / 163 (signed)":
+	movq %r14, %rax
+	movq %r12, %rcx
+	cqto 
+	idivq %rcx
+	movq %rax, %rbx
+	#instruction start "166 = proj1 165":
+	#instruction start "167 = proj0 165":
+	#instruction start "168 = constant(16)":
+	movq $16, %r12
+	#instruction start "169 = 167 == 168":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "171 = if 155 169":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "174 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "175 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "176 = constant(27)":
+	movl $27, %r13d
+	#instruction start "177 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "178 = alloc with size 8":
+	leaq -296(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "179 = store 178 174, state: 166":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "180 = alloc with size 8":
+	leaq -304(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "181 = store 180 175, state: 179":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "182 = alloc with size 4":
+	leaq -308(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "183 = store 182 176, state: 181":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "184 = alloc with size 8":
+	leaq -316(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "185 = store 184 177, state: 183":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "186 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "187 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "188 = load part address of 178 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "189 = proj0 188":
+	#instruction start "190 = proj1 188":
+	#instruction start "191 = load part address of 180 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "192 = proj0 191":
+	#instruction start "193 = proj1 191":
+	#instruction start "194 = load part address of 182 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "195 = proj0 194":
+	#instruction start "196 = proj1 194":
+	#instruction start "197 = load part address of 184 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "198 = proj0 197":
+	#instruction start "199 = proj1 197":
+	#instruction start "200 = allocate_call_stack 0":
+	#instruction start "201 = set_reg %rdi 190":
+	#instruction start "202 = set_reg %rsi 193 state: 201":
+	#instruction start "203 = set_reg %rdx 196 state: 202":
+	#instruction start "204 = set_reg %rcx 199 state: 203":
+	#instruction start "205 = set_reg %rax 187 state: 204":
+	#instruction start "206 = call 186":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "207 = proj0 206":
+	#instruction start "208 = proj1 206":
+	#Block jump
+	jmp .L11
+.L10:
+	#Block jump elided
+.L11:
+	#instruction start "209 = constant(1)":
+	movl $1, %ebx
+	#instruction start "211 = if 170 209":
+	#instruction start "219 = phi (region: 170) 166 207":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L13
+.L12:
+	#instruction start "214 = constant(4)":
+	movq $.Ls4, %rbx
+	#instruction start "215 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "216 = constant(28)":
+	movl $28, %r13d
+	#instruction start "217 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "218 = alloc with size 8":
+	leaq -324(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "220 = store 218 214, state: 219":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "221 = alloc with size 8":
+	leaq -332(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "222 = store 221 215, state: 220":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "223 = alloc with size 4":
+	leaq -336(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "224 = store 223 216, state: 222":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "225 = alloc with size 8":
+	leaq -344(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "226 = store 225 217, state: 224":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "227 = constant(0)":
+	leaq -64(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "228 = constant(0)":
+	leaq -72(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "229 = load part address of 218 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "230 = proj0 229":
+	#instruction start "231 = proj1 229":
+	#instruction start "232 = load part address of 221 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "233 = proj0 232":
+	#instruction start "234 = proj1 232":
+	#instruction start "235 = load part address of 223 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "236 = proj0 235":
+	#instruction start "237 = proj1 235":
+	#instruction start "238 = load part address of 225 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "239 = proj0 238":
+	#instruction start "240 = proj1 238":
+	#instruction start "241 = allocate_call_stack 0":
+	#instruction start "242 = set_reg %rdi 231":
+	#instruction start "243 = set_reg %rsi 234 state: 242":
+	#instruction start "244 = set_reg %rdx 237 state: 243":
+	#instruction start "245 = set_reg %rcx 240 state: 244":
+	#instruction start "246 = set_reg %rax 228 state: 245":
+	#instruction start "247 = call 227":
+	addq $0, %rsp
+	movq -72(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -64(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "248 = proj0 247":
+	#instruction start "249 = proj1 247":
+	#Block jump
+	jmp .L14
+.L13:
+	#Block jump elided
+.L14:
+	#instruction start "250 = constant(1)":
+	movl $1, %ebx
+	#instruction start "252 = if 210 250":
+	#instruction start "260 = phi (region: 210) 219 248":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#instruction start "255 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "256 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "257 = constant(29)":
+	movl $29, %r13d
+	#instruction start "258 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "259 = alloc with size 8":
+	leaq -352(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "261 = store 259 255, state: 260":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "262 = alloc with size 8":
+	leaq -360(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "263 = store 262 256, state: 261":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "264 = alloc with size 4":
+	leaq -364(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "265 = store 264 257, state: 263":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "266 = alloc with size 8":
+	leaq -372(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "267 = store 266 258, state: 265":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "268 = constant(0)":
+	leaq -120(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "269 = constant(0)":
+	leaq -128(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "270 = load part address of 259 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "271 = proj0 270":
+	#instruction start "272 = proj1 270":
+	#instruction start "273 = load part address of 262 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "274 = proj0 273":
+	#instruction start "275 = proj1 273":
+	#instruction start "276 = load part address of 264 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "277 = proj0 276":
+	#instruction start "278 = proj1 276":
+	#instruction start "279 = load part address of 266 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "280 = proj0 279":
+	#instruction start "281 = proj1 279":
+	#instruction start "282 = allocate_call_stack 0":
+	#instruction start "283 = set_reg %rdi 272":
+	#instruction start "284 = set_reg %rsi 275 state: 283":
+	#instruction start "285 = set_reg %rdx 278 state: 284":
+	#instruction start "286 = set_reg %rcx 281 state: 285":
+	#instruction start "287 = set_reg %rax 269 state: 286":
+	#instruction start "288 = call 268":
+	addq $0, %rsp
+	movq -128(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -120(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "289 = proj0 288":
+	#instruction start "290 = proj1 288":
+	#Block jump
+	jmp .L17
+.L16:
+	#Block jump elided
+.L17:
+	#instruction start "291 = constant(1)":
+	movl $1, %ebx
+	#instruction start "293 = if 251 291":
+	#instruction start "301 = phi (region: 251) 260 289":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L19
+.L18:
+	#instruction start "296 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "297 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "298 = constant(30)":
+	movl $30, %r13d
+	#instruction start "299 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "300 = alloc with size 8":
+	leaq -380(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "302 = store 300 296, state: 301":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "303 = alloc with size 8":
+	leaq -388(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "304 = store 303 297, state: 302":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "305 = alloc with size 4":
+	leaq -392(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "306 = store 305 298, state: 304":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "307 = alloc with size 8":
+	leaq -400(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "308 = store 307 299, state: 306":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "309 = constant(0)":
+	leaq -176(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "310 = constant(0)":
+	leaq -184(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "311 = load part address of 300 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "312 = proj0 311":
+	#instruction start "313 = proj1 311":
+	#instruction start "314 = load part address of 303 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "315 = proj0 314":
+	#instruction start "316 = proj1 314":
+	#instruction start "317 = load part address of 305 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "318 = proj0 317":
+	#instruction start "319 = proj1 317":
+	#instruction start "320 = load part address of 307 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "321 = proj0 320":
+	#instruction start "322 = proj1 320":
+	#instruction start "323 = allocate_call_stack 0":
+	#instruction start "324 = set_reg %rdi 313":
+	#instruction start "325 = set_reg %rsi 316 state: 324":
+	#instruction start "326 = set_reg %rdx 319 state: 325":
+	#instruction start "327 = set_reg %rcx 322 state: 326":
+	#instruction start "328 = set_reg %rax 310 state: 327":
+	#instruction start "329 = call 309":
+	addq $0, %rsp
+	movq -184(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -176(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "330 = proj0 329":
+	#instruction start "331 = proj1 329":
+	#Block jump
+	jmp .L20
+.L19:
+	#Block jump elided
+.L20:
+	#instruction start "333 = phi (region: 292) 301 330":
+	#instruction start "335 = constant(2)":
+	movl $2, %ebx
+	#instruction start "338 = int_cast_zero 335":
+	movq %rbx, %rax
+	movslq %eax, %rax
+	movq %rax, %r12
+	#instruction start "339 = constant(4294967295)":
+	movq $4, %r13
+	#instruction start "340 = constant(4)":
+	movq $4, %r14
+	#instruction start "341 = 338 * 340":
+	movq %r12, %rax
+	movq %r14, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "342 = 339 + 341":
+	movq %r13, %rax
+	movq %r15, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "344 = constant(4)":
+	movl $4, %r13d
+	#instruction start "345 = 335 * 344 (signed)":
+	movq %rbx, %rax
+	movq %r13, %rcx
+	imull %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "346 = constant(4)":
+	movl $4, %ebx
+	#instruction start "347 = 346 + 345":
+	movq %rbx, %rax
+	movq %r14, %rcx
+	addl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "348 = int_cast_zero 347":
+	movq %r13, %rax
+	movslq %eax, %rax
+	movq %rax, %rbx
+	#instruction start "349 = 342 == 348":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "351 = if 292 349":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "354 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "355 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "356 = constant(32)":
+	movl $32, %r13d
+	#instruction start "357 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "358 = alloc with size 8":
+	leaq -408(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "359 = store 358 354, state: 333":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "360 = alloc with size 8":
+	leaq -416(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "361 = store 360 355, state: 359":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "362 = alloc with size 4":
+	leaq -420(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "363 = store 362 356, state: 361":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "364 = alloc with size 8":
+	leaq -428(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "365 = store 364 357, state: 363":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "366 = constant(0)":
+	leaq -232(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "367 = constant(0)":
+	leaq -240(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "368 = load part address of 358 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "369 = proj0 368":
+	#instruction start "370 = proj1 368":
+	#instruction start "371 = load part address of 360 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "372 = proj0 371":
+	#instruction start "373 = proj1 371":
+	#instruction start "374 = load part address of 362 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "375 = proj0 374":
+	#instruction start "376 = proj1 374":
+	#instruction start "377 = load part address of 364 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "378 = proj0 377":
+	#instruction start "379 = proj1 377":
+	#instruction start "380 = allocate_call_stack 0":
+	#instruction start "381 = set_reg %rdi 370":
+	#instruction start "382 = set_reg %rsi 373 state: 381":
+	#instruction start "383 = set_reg %rdx 376 state: 382":
+	#instruction start "384 = set_reg %rcx 379 state: 383":
+	#instruction start "385 = set_reg %rax 367 state: 384":
+	#instruction start "386 = call 366":
+	addq $0, %rsp
+	movq -240(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -232(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "387 = proj0 386":
+	#instruction start "388 = proj1 386":
+	#Block jump
+	jmp .L23
+.L22:
+	#Block jump elided
+.L23:
+	#instruction start "389 = constant(0)":
+	movl $0, %ebx
+	#instruction start "390 = set_reg %rax 389":
+	#instruction start "391 = phi (region: 350) 333 387":
+	#instruction start "392 = return 350, 390, 391":
+	movq %rbx, %rax
+	#Block return.
+	movq -436(%rbp), %rbx
+	movq -444(%rbp), %r12
+	movq -452(%rbp), %r13
+	movq -460(%rbp), %r14
+	movq -468(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "offsetof_macro(struct T, e) == 16\000"
+.Ls2:
+	.string "/root/repo/tests/offsetof.c\000"
+.Ls3:
+	.string "main"
+.Ls4:
+	.string "offsetof_builtin(struct T, e) == 16\000"
+.Ls5:
+	.string "offsetof_builtin(struct T2, inner.a) == 0\000"
+.Ls6:
+	.string "offsetof_builtin(struct T2, inner.arr[0]) == 4\000"
+.Ls7:
+	.string "offsetof_builtin(struct T2, inner.arr[idx]) == 4 + idx * 4\000"
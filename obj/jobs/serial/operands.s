@@ -0,0 +1,157 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rbx, -100(%rbp)
+	movq %r12, -108(%rbp)
+	movq %r13, -116(%rbp)
+	movq %r14, -124(%rbp)
+	movq %r15, -132(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "8 = constant(10)":
+	movl $10, %ebx
+	#instruction start "12 = constant(20)":
+	movl $20, %r12d
+	#instruction start "15 = int_cast_zero 12":
+	movq %r12, %rax
+	movsbq %al, %rax
+	movl %eax, %r13d
+	#instruction start "17 = int_cast_zero 8":
+	movq %rbx, %rax
+	movsbq %al, %rax
+	movl %eax, %r12d
+	#instruction start "18 = 17 ^ 15":
+	movq %r12, %rax
+	movq %r13, %rcx
+	xorl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "19 = int_cast_zero 18":
+	movq %rbx, %rax
+	movzbl %al, %r12d
+	#instruction start "22 = int_cast_zero 19":
+	movq %r12, %rax
+	movsbq %al, %rax
+	movl %eax, %ebx
+	#instruction start "23 = constant(30)":
+	movl $30, %r12d
+	#instruction start "24 = 22 == 23":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "26 = if 2 24":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "29 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "30 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "31 = constant(8)":
+	movl $8, %r13d
+	#instruction start "32 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "33 = alloc with size 8":
+	leaq -72(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "34 = store 33 29, state: 3":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "35 = alloc with size 8":
+	leaq -80(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "36 = store 35 30, state: 34":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "37 = alloc with size 4":
+	leaq -84(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "38 = store 37 31, state: 36":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "39 = alloc with size 8":
+	leaq -92(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "40 = store 39 32, state: 38":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "41 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "42 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "43 = load part address of 33 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "44 = proj0 43":
+	#instruction start "45 = proj1 43":
+	#instruction start "46 = load part address of 35 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "47 = proj0 46":
+	#instruction start "48 = proj1 46":
+	#instruction start "49 = load part address of 37 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "50 = proj0 49":
+	#instruction start "51 = proj1 49":
+	#instruction start "52 = load part address of 39 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "53 = proj0 52":
+	#instruction start "54 = proj1 52":
+	#instruction start "55 = allocate_call_stack 0":
+	#instruction start "56 = set_reg %rdi 45":
+	#instruction start "57 = set_reg %rsi 48 state: 56":
+	#instruction start "58 = set_reg %rdx 51 state: 57":
+	#instruction start "59 = set_reg %rcx 54 state: 58":
+	#instruction start "60 = set_reg %rax 42 state: 59":
+	#instruction start "61 = call 41":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "62 = proj0 61":
+	#instruction start "63 = proj1 61":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "64 = constant(0)":
+	movl $0, %ebx
+	#instruction start "65 = set_reg %rax 64":
+	#instruction start "66 = phi (region: 25) 3 62":
+	#instruction start "67 = return 25, 65, 66":
+	movq %rbx, %rax
+	#Block return.
+	movq -100(%rbp), %rbx
+	movq -108(%rbp), %r12
+	movq -116(%rbp), %r13
+	movq -124(%rbp), %r14
+	movq -132(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "a == (10 ^ 20)\000"
+.Ls2:
+	.string "/root/repo/tests/operands.c\000"
+.Ls3:
+	.string "main"
@@ -0,0 +1,156 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rbx, -108(%rbp)
+	movq %r12, -116(%rbp)
+	movq %r13, -124(%rbp)
+	movq %r14, -132(%rbp)
+	movq %r15, -140(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = alloc with size 8":
+	leaq -72(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "7 = set_zero_ptr 6, size: 8":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	#instruction start "8 = constant(0)":
+	movq $0, %r12
+	#instruction start "9 = 6 + 8":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "10 = constant(1)":
+	movl $1, %r12d
+	#instruction start "11 = store 9 10, state: 7":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "12 = constant(4)":
+	movq $4, %r12
+	#instruction start "13 = 6 + 12":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "14 = constant(2)":
+	movl $2, %ebx
+	#instruction start "15 = store 13 14, state: 11":
+	movq %r13, %rsi
+	movl %ebx, (%rsi)
+	#instruction start "16 = constant(1)":
+	movl $1, %ebx
+	#instruction start "18 = if 2 16":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "21 = constant(1)":
+	movq $.Ls1, %rbx
+	#instruction start "22 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "23 = constant(5)":
+	movl $5, %r13d
+	#instruction start "24 = constant(3)":
+	movq $.Ls3, %r14
+	#instruction start "25 = alloc with size 8":
+	leaq -80(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "26 = store 25 21, state: 15":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "27 = alloc with size 8":
+	leaq -88(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "28 = store 27 22, state: 26":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "29 = alloc with size 4":
+	leaq -92(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "30 = store 29 23, state: 28":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "31 = alloc with size 8":
+	leaq -100(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "32 = store 31 24, state: 30":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "33 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "34 = constant(0)":
+	leaq -16(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "35 = load part address of 25 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "36 = proj0 35":
+	#instruction start "37 = proj1 35":
+	#instruction start "38 = load part address of 27 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "39 = proj0 38":
+	#instruction start "40 = proj1 38":
+	#instruction start "41 = load part address of 29 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "42 = proj0 41":
+	#instruction start "43 = proj1 41":
+	#instruction start "44 = load part address of 31 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "45 = proj0 44":
+	#instruction start "46 = proj1 44":
+	#instruction start "47 = allocate_call_stack 0":
+	#instruction start "48 = set_reg %rdi 37":
+	#instruction start "49 = set_reg %rsi 40 state: 48":
+	#instruction start "50 = set_reg %rdx 43 state: 49":
+	#instruction start "51 = set_reg %rcx 46 state: 50":
+	#instruction start "52 = set_reg %rax 34 state: 51":
+	#instruction start "53 = call 33":
+	addq $0, %rsp
+	movq -16(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "54 = proj0 53":
+	#instruction start "55 = proj1 53":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "56 = constant(0)":
+	movl $0, %ebx
+	#instruction start "57 = set_reg %rax 56":
+	#instruction start "58 = phi (region: 17) 15 54":
+	#instruction start "59 = return 17, 57, 58":
+	movq %rbx, %rax
+	#Block return.
+	movq -108(%rbp), %rbx
+	movq -116(%rbp), %r12
+	movq -124(%rbp), %r13
+	movq -132(%rbp), %r14
+	movq -140(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "sizeof(arr)[0] == 4\000"
+.Ls2:
+	.string "/root/repo/tests/sizeof.c\000"
+.Ls3:
+	.string "main"
@@ -0,0 +1,2397 @@
+.global sum
+sum:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $400, %rsp
+	movq %rbx, -368(%rbp)
+	movq %r12, -376(%rbp)
+	movq %r13, -384(%rbp)
+	movq %r14, -392(%rbp)
+	movq %r15, -400(%rbp)
+	movq %rdi, -360(%rbp)
+	movq %rsi, -352(%rbp)
+	movq %rdx, -344(%rbp)
+	movq %rcx, -336(%rbp)
+	movq %r8, -328(%rbp)
+	movq %r9, -320(%rbp)
+	movl %edi, %ebx
+.L2:
+	#Block jump elided
+.L3:
+	#instruction start "3 = proj3 1":
+	#instruction start "4 = proj1 1":
+	#instruction start "6 = %rdi":
+	#instruction start "7 = alloc with size 4":
+	leaq -28(%rbp), %rsi
+	movq %rsi, -8(%rbp)
+	#instruction start "8 = store part of 7 with offset 0":
+	movq -8(%rbp), %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "9 = alloc with size 24":
+	leaq -52(%rbp), %rsi
+	movq %rsi, -16(%rbp)
+	#instruction start "10 = va_start 9":
+	movq -16(%rbp), %rax
+	movl $8, (%rax)
+	movl $0, 4(%rax)
+	leaq 16(%rbp), %rdi
+	movq %rdi, 8(%rax)
+	leaq -360(%rbp), %rdi
+	movq %rdi, 16(%rax)
+	#instruction start "13 = constant(0)":
+	movl $0, %r13d
+	#instruction start "23 = constant(0)":
+	movl $0, %r14d
+	#Phi node to 894 (16 13 42)
+	movq %r13, %rax
+	movl %eax, %r15d
+	#Phi node to 898 (16 23 35)
+	movq %r14, %rax
+	movl %eax, %r12d
+	#Block jump elided
+.L4:
+	#instruction start "25 = phi (region: 16) 10 39":
+	#instruction start "27 = load 7, state: 25":
+	movq -8(%rbp), %rdi
+	movl (%rdi), %r13d
+	#instruction start "898 = phi (region: 16) 23 35":
+	#instruction start "28 = 898 < 27 (signed)":
+	movq %r12, %rax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "29 = if 16 28":
+	#instruction start "894 = phi (region: 16) 13 42":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L5:
+	#Block jump elided
+.L6:
+	#instruction start "46 = set_reg %rax 894":
+	#instruction start "47 = return 19, 46, 25":
+	movq %r15, %rax
+	#Block return.
+	movq -368(%rbp), %rbx
+	movq -376(%rbp), %r12
+	movq -384(%rbp), %r13
+	movq -392(%rbp), %r14
+	movq -400(%rbp), %r15
+	leave 
+	ret 
+.L7:
+	#Block jump elided
+.L8:
+	#Block jump elided
+.L9:
+	#instruction start "34 = constant(1)":
+	movl $1, %r13d
+	#instruction start "35 = 898 + 34":
+	movq %r12, %rax
+	movq %r13, %rcx
+	addl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "37 = alloc with size 4":
+	leaq -56(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "39 = v_arg 37 9":
+	movq -16(%rbp), %rdi
+	movl (%rdi), %eax
+	cmpl $40, %eax
+	ja .L10
+	leal 8(%rax), %edx
+	addq 16(%rdi), %rax
+	movl %edx, (%rdi)
+	jmp .L11
+.L10:
+	movq 8(%rdi), %rax
+	leaq 8(%rax), %rdx
+	movq %rdx, 8(%rdi)
+.L11:
+	movq %rax, %rdi
+	movq %r13, %rsi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "41 = load 37, state: 39":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "42 = 894 + 41":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	addl %ecx, %eax
+	movl %eax, %r13d
+	#Phi node to 894 (16 13 42)
+	movq %r13, %rax
+	movl %eax, %r15d
+	#Phi node to 898 (16 23 35)
+	movq %r14, %rax
+	movl %eax, %r12d
+	#Block jump
+	jmp .L4
+.global sum_8p
+sum_8p:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $512, %rsp
+	movq %rbx, -472(%rbp)
+	movq %r12, -480(%rbp)
+	movq %r13, -488(%rbp)
+	movq %r14, -496(%rbp)
+	movq %r15, -504(%rbp)
+	movq %rdi, -464(%rbp)
+	movq %rsi, -456(%rbp)
+	movq %rdx, -448(%rbp)
+	movq %rcx, -440(%rbp)
+	movq %r8, -432(%rbp)
+	movq %r9, -424(%rbp)
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movl %edx, -12(%rbp)
+	movl %ecx, -16(%rbp)
+	movl %r8d, -20(%rbp)
+	movl %r9d, -24(%rbp)
+.L12:
+	#Block jump elided
+.L13:
+	#instruction start "51 = proj3 49":
+	#instruction start "52 = proj1 49":
+	#instruction start "53 = proj2 49":
+	#instruction start "54 = %rdi":
+	#instruction start "55 = %rsi":
+	#instruction start "56 = %rdx":
+	#instruction start "57 = %rcx":
+	#instruction start "58 = %r8":
+	#instruction start "59 = %r9":
+	#instruction start "60 = alloc with size 4":
+	leaq -100(%rbp), %rsi
+	movq %rsi, -32(%rbp)
+	#instruction start "61 = alloc with size 4":
+	leaq -104(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "62 = alloc with size 4":
+	leaq -108(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "63 = alloc with size 4":
+	leaq -112(%rbp), %rsi
+	movq %rsi, -40(%rbp)
+	#instruction start "64 = alloc with size 4":
+	leaq -116(%rbp), %rsi
+	movq %rsi, -48(%rbp)
+	#instruction start "65 = alloc with size 4":
+	leaq -120(%rbp), %rsi
+	movq %rsi, -56(%rbp)
+	#instruction start "66 = alloc with size 4":
+	leaq -124(%rbp), %rsi
+	movq %rsi, -64(%rbp)
+	#instruction start "67 = alloc with size 4":
+	leaq -128(%rbp), %rsi
+	movq %rsi, -72(%rbp)
+	#instruction start "68 = alloc with size 4":
+	leaq -132(%rbp), %rsi
+	movq %rsi, -80(%rbp)
+	#instruction start "69 = load 66 relative to base":
+	leaq 16(%rbp), %rdi
+	movq -64(%rbp), %rsi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "70 = load 67 relative to base":
+	leaq 24(%rbp), %rdi
+	movq -72(%rbp), %rsi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "71 = load 68 relative to base":
+	leaq 32(%rbp), %rdi
+	movq -80(%rbp), %rsi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "72 = store part of 60 with offset 0":
+	movq -32(%rbp), %rsi
+	leaq (%rsi), %rsi
+	leaq -4(%rbp), %rdi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "73 = store part of 61 with offset 0":
+	movq %r14, %rsi
+	leaq (%rsi), %rsi
+	leaq -8(%rbp), %rdi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "74 = store part of 62 with offset 0":
+	movq %r13, %rsi
+	leaq (%rsi), %rsi
+	leaq -12(%rbp), %rdi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "75 = store part of 63 with offset 0":
+	movq -40(%rbp), %rsi
+	leaq (%rsi), %rsi
+	leaq -16(%rbp), %rdi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "76 = store part of 64 with offset 0":
+	movq -48(%rbp), %rsi
+	leaq (%rsi), %rsi
+	leaq -20(%rbp), %rdi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "77 = store part of 65 with offset 0":
+	movq -56(%rbp), %rsi
+	leaq (%rsi), %rsi
+	leaq -24(%rbp), %rdi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "78 = alloc with size 24":
+	leaq -156(%rbp), %rsi
+	movq %rsi, -88(%rbp)
+	#instruction start "79 = va_start 78":
+	movq -88(%rbp), %rax
+	movl $48, (%rax)
+	movl $0, 4(%rax)
+	leaq 40(%rbp), %rdi
+	movq %rdi, 8(%rax)
+	leaq -464(%rbp), %rdi
+	movq %rdi, 16(%rax)
+	#instruction start "82 = load 61, state: 79":
+	movq %r14, %rdi
+	movl (%rdi), %r12d
+	#instruction start "83 = load 62, state: 79":
+	movq %r13, %rdi
+	movl (%rdi), %r14d
+	#instruction start "84 = 82 + 83":
+	movq %r12, %rax
+	movq %r14, %rcx
+	addl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "85 = load 63, state: 79":
+	movq -40(%rbp), %rdi
+	movl (%rdi), %r12d
+	#instruction start "86 = 84 + 85":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "87 = load 64, state: 79":
+	movq -48(%rbp), %rdi
+	movl (%rdi), %r12d
+	#instruction start "88 = 86 + 87":
+	movq %r14, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "89 = load 65, state: 79":
+	movq -56(%rbp), %rdi
+	movl (%rdi), %r12d
+	#instruction start "90 = 88 + 89":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "91 = load 66, state: 79":
+	movq -64(%rbp), %rdi
+	movl (%rdi), %r12d
+	#instruction start "92 = 90 + 91":
+	movq %r14, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "93 = load 67, state: 79":
+	movq -72(%rbp), %rdi
+	movl (%rdi), %r12d
+	#instruction start "94 = 92 + 93":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "95 = load 68, state: 79":
+	movq -80(%rbp), %rdi
+	movl (%rdi), %r12d
+	#instruction start "96 = 94 + 95":
+	movq %r14, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %r13d
+	#instruction start "106 = constant(0)":
+	movl $0, %r12d
+	#Phi node to 902 (99 96 127)
+	movq %r13, %rax
+	movl %eax, %r14d
+	#Phi node to 906 (99 106 120)
+	movq %r12, %rax
+	movl %eax, %r15d
+	#Block jump elided
+.L14:
+	#instruction start "108 = phi (region: 99) 79 124":
+	#instruction start "109 = load 60, state: 108":
+	movq -32(%rbp), %rdi
+	movl (%rdi), %r12d
+	#instruction start "110 = constant(8)":
+	movl $8, %r13d
+	#instruction start "111 = 109 - 110":
+	movq %r12, %rax
+	movq %r13, %rcx
+	subl %ecx, %eax
+	movl %eax, %ebx
+	#instruction start "906 = phi (region: 99) 106 120":
+	#instruction start "113 = 906 < 111 (signed)":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, %r12d
+	#instruction start "114 = if 99 113":
+	#instruction start "902 = phi (region: 99) 96 127":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L17
+.L15:
+	#Block jump elided
+.L16:
+	#instruction start "131 = set_reg %rax 902":
+	#instruction start "132 = return 102, 131, 108":
+	movq %r14, %rax
+	#Block return.
+	movq -472(%rbp), %rbx
+	movq -480(%rbp), %r12
+	movq -488(%rbp), %r13
+	movq -496(%rbp), %r14
+	movq -504(%rbp), %r15
+	leave 
+	ret 
+.L17:
+	#Block jump elided
+.L18:
+	#Block jump elided
+.L19:
+	#instruction start "119 = constant(1)":
+	movl $1, %ebx
+	#instruction start "120 = 906 + 119":
+	movq %r15, %rax
+	movq %rbx, %rcx
+	addl %ecx, %eax
+	movl %eax, %r12d
+	#instruction start "122 = alloc with size 4":
+	leaq -160(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "124 = v_arg 122 78":
+	movq -88(%rbp), %rdi
+	movl (%rdi), %eax
+	cmpl $40, %eax
+	ja .L20
+	leal 8(%rax), %edx
+	addq 16(%rdi), %rax
+	movl %edx, (%rdi)
+	jmp .L21
+.L20:
+	movq 8(%rdi), %rax
+	leaq 8(%rax), %rdx
+	movq %rdx, 8(%rdi)
+.L21:
+	movq %rax, %rdi
+	movq %rbx, %rsi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "126 = load 122, state: 124":
+	movq %rbx, %rdi
+	movl (%rdi), %r13d
+	#instruction start "127 = 902 + 126":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addl %ecx, %eax
+	movl %eax, %ebx
+	#Phi node to 902 (99 96 127)
+	movq %rbx, %rax
+	movl %eax, %r14d
+	#Phi node to 906 (99 106 120)
+	movq %r12, %rax
+	movl %eax, %r15d
+	#Block jump
+	jmp .L14
+.global sum_structs
+sum_structs:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $512, %rsp
+	movq %rbx, -476(%rbp)
+	movq %r12, -484(%rbp)
+	movq %r13, -492(%rbp)
+	movq %r14, -500(%rbp)
+	movq %r15, -508(%rbp)
+	movq %rdi, -468(%rbp)
+	movq %rsi, -460(%rbp)
+	movq %rdx, -452(%rbp)
+	movq %rcx, -444(%rbp)
+	movq %r8, -436(%rbp)
+	movq %r9, -428(%rbp)
+	movl %edi, %ebx
+.L22:
+	#Block jump elided
+.L23:
+	#instruction start "136 = proj3 134":
+	#instruction start "137 = proj1 134":
+	#instruction start "139 = %rdi":
+	#instruction start "140 = alloc with size 4":
+	leaq -60(%rbp), %rsi
+	movq %rsi, -8(%rbp)
+	#instruction start "141 = store part of 140 with offset 0":
+	movq -8(%rbp), %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "142 = alloc with size 24":
+	leaq -84(%rbp), %rsi
+	movq %rsi, -16(%rbp)
+	#instruction start "143 = va_start 142":
+	movq -16(%rbp), %rax
+	movl $8, (%rax)
+	movl $0, 4(%rax)
+	leaq 16(%rbp), %rdi
+	movq %rdi, 8(%rax)
+	leaq -468(%rbp), %rdi
+	movq %rdi, 16(%rax)
+	#instruction start "146 = constant(0)":
+	movl $0, %r13d
+	#instruction start "156 = constant(0)":
+	movl $0, %r14d
+	#Phi node to 913 (149 146 910)
+	movq %r13, %rax
+	movl %eax, -24(%rbp)
+	#Phi node to 919 (149 156 168)
+	movq %r14, %rax
+	movl %eax, -20(%rbp)
+	#Block jump elided
+.L24:
+	#instruction start "158 = phi (region: 149) 143 186":
+	#instruction start "160 = load 140, state: 158":
+	movq -8(%rbp), %rdi
+	movl (%rdi), %r13d
+	#instruction start "919 = phi (region: 149) 156 168":
+	#instruction start "161 = 919 < 160 (signed)":
+	movl -20(%rbp), %eax
+	movq %r13, %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "162 = if 149 161":
+	#instruction start "913 = phi (region: 149) 146 910":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L27
+.L25:
+	#Block jump elided
+.L26:
+	#instruction start "214 = set_reg %rax 913":
+	#instruction start "215 = return 152, 214, 158":
+	movl -24(%rbp), %eax
+	#Block return.
+	movq -476(%rbp), %rbx
+	movq -484(%rbp), %r12
+	movq -492(%rbp), %r13
+	movq -500(%rbp), %r14
+	movq -508(%rbp), %r15
+	leave 
+	ret 
+.L27:
+	#Block jump elided
+.L28:
+	#Block jump elided
+.L29:
+	#instruction start "170 = alloc with size 40":
+	leaq -124(%rbp), %rsi
+	movq %rsi, -40(%rbp)
+	#instruction start "172 = set_zero_ptr 170, size: 40":
+	movq -40(%rbp), %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	movq $0, 16(%rdi)
+	movq $0, 24(%rdi)
+	movq $0, 32(%rdi)
+	#instruction start "173 = alloc with size 40":
+	leaq -164(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "174 = v_arg 173 142":
+	movq -16(%rbp), %rdi
+.L37:
+	movq 8(%rdi), %rax
+	leaq 40(%rax), %rdx
+	movq %rdx, 8(%rdi)
+.L38:
+	movq %rax, %rdi
+	movq %r14, %rsi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	movq 8(%rdi), %rax
+	movq %rax, 8(%rsi)
+	movq 16(%rdi), %rax
+	movq %rax, 16(%rsi)
+	movq 24(%rdi), %rax
+	movq %rax, 24(%rsi)
+	movq 32(%rdi), %rax
+	movq %rax, 32(%rsi)
+	#instruction start "175 = memcpy from 170 to 173":
+	movq -40(%rbp), %rsi
+	movq %r14, %rdi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	movq 8(%rdi), %rax
+	movq %rax, 8(%rsi)
+	movq 16(%rdi), %rax
+	movq %rax, 16(%rsi)
+	movq 24(%rdi), %rax
+	movq %rax, 24(%rsi)
+	movq 32(%rdi), %rax
+	movq %rax, 32(%rsi)
+	#instruction start "184 = constant(0)":
+	movl $0, %r14d
+	#Phi node to 910 (177 913 210)
+	movl -24(%rbp), %eax
+	movl %eax, -44(%rbp)
+	#Phi node to 922 (177 919 922)
+	movl -20(%rbp), %eax
+	movl %eax, %r13d
+	#Phi node to 927 (177 184 196)
+	movq %r14, %rax
+	movl %eax, %r12d
+	#Block jump elided
+.L30:
+	#instruction start "186 = phi (region: 177) 175 208":
+	#instruction start "188 = constant(10)":
+	movl $10, %r14d
+	#instruction start "927 = phi (region: 177) 184 196":
+	#instruction start "189 = 927 < 188 (signed)":
+	movq %r12, %rax
+	movq %r14, %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, %r15d
+	#instruction start "190 = if 177 189":
+	#instruction start "910 = phi (region: 177) 913 210":
+	#instruction start "922 = phi (region: 177) 919 922":
+	movq %r15, %rdi
+	testq %rdi, %rdi
+	jne .L34
+.L31:
+	#Block jump elided
+.L32:
+	#Block jump elided
+.L33:
+	#instruction start "167 = constant(1)":
+	movl $1, %r14d
+	#instruction start "168 = 922 + 167":
+	movq %r13, %rax
+	movq %r14, %rcx
+	addl %ecx, %eax
+	movl %eax, %r15d
+	#Phi node to 913 (149 146 910)
+	movl -44(%rbp), %eax
+	movl %eax, -24(%rbp)
+	#Phi node to 919 (149 156 168)
+	movq %r15, %rax
+	movl %eax, -20(%rbp)
+	#Block jump
+	jmp .L24
+.L34:
+	#Block jump elided
+.L35:
+	#Block jump elided
+.L36:
+	#instruction start "195 = constant(1)":
+	movl $1, %r14d
+	#instruction start "196 = 927 + 195":
+	movq %r12, %rax
+	movq %r14, %rcx
+	addl %ecx, %eax
+	movl %eax, -48(%rbp)
+	#instruction start "198 = constant(0)":
+	movq $0, %r14
+	#instruction start "199 = 170 + 198":
+	movq -40(%rbp), %rax
+	movq %r14, %rcx
+	addq %rcx, %rax
+	movq %rax, -56(%rbp)
+	#instruction start "202 = int_cast_zero 927":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r14
+	#instruction start "203 = constant(4)":
+	movq $4, %r15
+	#instruction start "204 = 202 * 203":
+	movq %r14, %rax
+	movq %r15, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rbx
+	#instruction start "205 = 199 + 204":
+	movq -56(%rbp), %rax
+	movq %rbx, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "207 = load_volatile 205, state: 186":
+	movq %r14, %rdi
+	movl (%rdi), %ebx
+	#instruction start "208 = proj0 207":
+	#instruction start "209 = proj1 207":
+	#instruction start "210 = 910 + 209":
+	movl -44(%rbp), %eax
+	movq %rbx, %rcx
+	addl %ecx, %eax
+	movl %eax, %r14d
+	#Phi node to 910 (177 913 210)
+	movq %r14, %rax
+	movl %eax, -44(%rbp)
+	#Phi node to 922 (177 919 922)
+	movq %r13, %rax
+	movl %eax, %r13d
+	#Phi node to 927 (177 184 196)
+	movl -48(%rbp), %eax
+	movl %eax, %r12d
+	#Block jump
+	jmp .L30
+.global vsum
+vsum:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $112, %rsp
+	movq %rbx, -72(%rbp)
+	movq %r12, -80(%rbp)
+	movq %r13, -88(%rbp)
+	movq %r14, -96(%rbp)
+	movq %r15, -104(%rbp)
+	movl %edi, %ebx
+	movq %rsi, %r12
+.L39:
+	#Block jump elided
+.L40:
+	#instruction start "219 = proj3 217":
+	#instruction start "220 = proj1 217":
+	#instruction start "222 = %rdi":
+	#instruction start "223 = %rsi":
+	#instruction start "224 = alloc with size 4":
+	leaq -28(%rbp), %rsi
+	movq %rsi, -8(%rbp)
+	#instruction start "225 = alloc with size 8":
+	leaq -36(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "226 = store part of 224 with offset 0":
+	movq -8(%rbp), %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "227 = store part of 225 with offset 0":
+	movq %r14, %rsi
+	leaq (%rsi), %rsi
+	movq %r12, (%rsi)
+	#instruction start "230 = constant(0)":
+	movl $0, %ebx
+	#instruction start "232 = alloc with size 24":
+	leaq -60(%rbp), %rsi
+	movq %rsi, -16(%rbp)
+	#instruction start "233 = load 225, state: 227":
+	movq %r14, %rdi
+	movq (%rdi), %r15
+	#instruction start "234 = memcpy from 232 to 233":
+	movq -16(%rbp), %rsi
+	movq %r15, %rdi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	movq 8(%rdi), %rax
+	movq %rax, 8(%rsi)
+	movq 16(%rdi), %rax
+	movq %rax, 16(%rsi)
+	#instruction start "243 = constant(0)":
+	movl $0, %r14d
+	#Phi node to 931 (236 230 262)
+	movq %rbx, %rax
+	movl %eax, %r15d
+	#Phi node to 935 (236 243 255)
+	movq %r14, %rax
+	movl %eax, %r13d
+	#Block jump elided
+.L41:
+	#instruction start "245 = phi (region: 236) 234 259":
+	#instruction start "247 = load 224, state: 245":
+	movq -8(%rbp), %rdi
+	movl (%rdi), %ebx
+	#instruction start "935 = phi (region: 236) 243 255":
+	#instruction start "248 = 935 < 247 (signed)":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "249 = if 236 248":
+	#instruction start "931 = phi (region: 236) 230 262":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L44
+.L42:
+	#Block jump elided
+.L43:
+	#instruction start "266 = set_reg %rax 931":
+	#instruction start "267 = return 239, 266, 245":
+	movq %r15, %rax
+	#Block return.
+	movq -72(%rbp), %rbx
+	movq -80(%rbp), %r12
+	movq -88(%rbp), %r13
+	movq -96(%rbp), %r14
+	movq -104(%rbp), %r15
+	leave 
+	ret 
+.L44:
+	#Block jump elided
+.L45:
+	#Block jump elided
+.L46:
+	#instruction start "254 = constant(1)":
+	movl $1, %ebx
+	#instruction start "255 = 935 + 254":
+	movq %r13, %rax
+	movq %rbx, %rcx
+	addl %ecx, %eax
+	movl %eax, %r14d
+	#instruction start "257 = alloc with size 4":
+	leaq -64(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "259 = v_arg 257 232":
+	movq -16(%rbp), %rdi
+	movl (%rdi), %eax
+	cmpl $40, %eax
+	ja .L47
+	leal 8(%rax), %edx
+	addq 16(%rdi), %rax
+	movl %edx, (%rdi)
+	jmp .L48
+.L47:
+	movq 8(%rdi), %rax
+	leaq 8(%rax), %rdx
+	movq %rdx, 8(%rdi)
+.L48:
+	movq %rax, %rdi
+	movq %rbx, %rsi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "261 = load 257, state: 259":
+	movq %rbx, %rdi
+	movl (%rdi), %r12d
+	#instruction start "262 = 931 + 261":
+	movq %r15, %rax
+	movq %r12, %rcx
+	addl %ecx, %eax
+	movl %eax, %ebx
+	#Phi node to 931 (236 230 262)
+	movq %rbx, %rax
+	movl %eax, %r15d
+	#Phi node to 935 (236 243 255)
+	movq %r14, %rax
+	movl %eax, %r13d
+	#Block jump
+	jmp .L41
+.global asum
+asum:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $416, %rsp
+	movq %rbx, -380(%rbp)
+	movq %r12, -388(%rbp)
+	movq %r13, -396(%rbp)
+	movq %r14, -404(%rbp)
+	movq %r15, -412(%rbp)
+	movq %rdi, -372(%rbp)
+	movq %rsi, -364(%rbp)
+	movq %rdx, -356(%rbp)
+	movq %rcx, -348(%rbp)
+	movq %r8, -340(%rbp)
+	movq %r9, -332(%rbp)
+	movl %edi, %ebx
+.L49:
+	#instruction start "271 = proj3 269":
+	#instruction start "272 = proj1 269":
+	#instruction start "274 = %rdi":
+	#instruction start "275 = alloc with size 4":
+	leaq -36(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "276 = store part of 275 with offset 0":
+	movq %r12, %rsi
+	leaq (%rsi), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "277 = alloc with size 24":
+	leaq -60(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "278 = va_start 277":
+	movq %rbx, %rax
+	movl $8, (%rax)
+	movl $0, 4(%rax)
+	leaq 16(%rbp), %rdi
+	movq %rdi, 8(%rax)
+	leaq -372(%rbp), %rdi
+	movq %rdi, 16(%rax)
+	#instruction start "283 = alloc with size 8":
+	leaq -68(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "284 = store 283 277, state: 278":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "285 = constant(0)":
+	movq $vsum, %rbx
+	#instruction start "286 = constant(0)":
+	movq $0, %r14
+	#instruction start "287 = load part address of 275 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r15d
+	#instruction start "288 = proj0 287":
+	#instruction start "289 = proj1 287":
+	#instruction start "290 = load part address of 283 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "291 = proj0 290":
+	#instruction start "292 = proj1 290":
+	#instruction start "293 = allocate_call_stack 0":
+	#instruction start "294 = set_reg %rdi 289":
+	#instruction start "295 = set_reg %rsi 292 state: 294":
+	#instruction start "296 = set_reg %rax 286 state: 295":
+	#instruction start "297 = call 285":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r12, %rsi
+	movq %r15, %rdi
+	movq %rbx, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "298 = proj0 297":
+	#instruction start "299 = proj1 297":
+	#instruction start "300 = %rax":
+	#instruction start "301 = int_cast_zero 300":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "304 = set_reg %rax 301":
+	#instruction start "305 = return 270, 304, 298":
+	movq %rbx, %rax
+	#Block return.
+	movq -380(%rbp), %rbx
+	movq -388(%rbp), %r12
+	movq -396(%rbp), %r13
+	movq -404(%rbp), %r14
+	movq -412(%rbp), %r15
+	leave 
+	ret 
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $1136, %rsp
+	movq %rbx, -1104(%rbp)
+	movq %r12, -1112(%rbp)
+	movq %r13, -1120(%rbp)
+	movq %r14, -1128(%rbp)
+	movq %r15, -1136(%rbp)
+.L50:
+	#instruction start "309 = proj3 307":
+	#instruction start "312 = alloc with size 4":
+	leaq -740(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "313 = constant(2)":
+	movl $2, %r12d
+	#instruction start "314 = store 312 313, state: 309":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "315 = alloc with size 4":
+	leaq -744(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "316 = constant(100)":
+	movl $100, %r13d
+	#instruction start "317 = store 315 316, state: 314":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "318 = alloc with size 4":
+	leaq -748(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "319 = constant(200)":
+	movl $200, %r14d
+	#instruction start "320 = store 318 319, state: 317":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "321 = constant(1)":
+	leaq -8(%rbp), %rdi
+	movq $sum, (%rdi)
+	#instruction start "322 = constant(0)":
+	movq $0, %r15
+	#instruction start "323 = load part address of 312 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "324 = proj0 323":
+	#instruction start "325 = proj1 323":
+	#instruction start "326 = load part address of 315 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "327 = proj0 326":
+	#instruction start "328 = proj1 326":
+	#instruction start "329 = load part address of 318 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "330 = proj0 329":
+	#instruction start "331 = proj1 329":
+	#instruction start "332 = allocate_call_stack 0":
+	#instruction start "333 = set_reg %rdi 325":
+	#instruction start "334 = set_reg %rsi 328 state: 333":
+	#instruction start "335 = set_reg %rdx 331 state: 334":
+	#instruction start "336 = set_reg %rax 322 state: 335":
+	#instruction start "337 = call 321":
+	addq $0, %rsp
+	movq %r15, %rax
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r14, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "338 = proj0 337":
+	#instruction start "339 = proj1 337":
+	#instruction start "340 = %rax":
+	#instruction start "341 = int_cast_zero 340":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "342 = constant(300)":
+	movl $300, %r12d
+	#instruction start "343 = 341 == 342":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "345 = if 308 343":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L52
+.L51:
+	#instruction start "348 = constant(3)":
+	movq $.Ls3, %rbx
+	#instruction start "349 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "350 = constant(68)":
+	movl $68, %r13d
+	#instruction start "351 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "352 = alloc with size 8":
+	leaq -756(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "353 = store 352 348, state: 338":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "354 = alloc with size 8":
+	leaq -764(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "355 = store 354 349, state: 353":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "356 = alloc with size 4":
+	leaq -768(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "357 = store 356 350, state: 355":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "358 = alloc with size 8":
+	leaq -776(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "359 = store 358 351, state: 357":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "360 = constant(2)":
+	leaq -48(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "361 = constant(0)":
+	leaq -56(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "362 = load part address of 352 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "363 = proj0 362":
+	#instruction start "364 = proj1 362":
+	#instruction start "365 = load part address of 354 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "366 = proj0 365":
+	#instruction start "367 = proj1 365":
+	#instruction start "368 = load part address of 356 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "369 = proj0 368":
+	#instruction start "370 = proj1 368":
+	#instruction start "371 = load part address of 358 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "372 = proj0 371":
+	#instruction start "373 = proj1 371":
+	#instruction start "374 = allocate_call_stack 0":
+	#instruction start "375 = set_reg %rdi 364":
+	#instruction start "376 = set_reg %rsi 367 state: 375":
+	#instruction start "377 = set_reg %rdx 370 state: 376":
+	#instruction start "378 = set_reg %rcx 373 state: 377":
+	#instruction start "379 = set_reg %rax 361 state: 378":
+	#instruction start "380 = call 360":
+	addq $0, %rsp
+	movq -56(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -48(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "381 = proj0 380":
+	#instruction start "382 = proj1 380":
+	#Block jump
+	jmp .L53
+.L52:
+	#Block jump elided
+.L53:
+	#instruction start "383 = alloc with size 4":
+	leaq -780(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "384 = constant(3)":
+	movl $3, %r12d
+	#instruction start "385 = phi (region: 344) 338 381":
+	#instruction start "386 = store 383 384, state: 385":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "387 = alloc with size 4":
+	leaq -784(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "388 = constant(100)":
+	movl $100, %r13d
+	#instruction start "389 = store 387 388, state: 386":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "390 = alloc with size 4":
+	leaq -788(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "391 = constant(200)":
+	movl $200, %r14d
+	#instruction start "392 = store 390 391, state: 389":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "393 = alloc with size 4":
+	leaq -792(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "394 = constant(300)":
+	movl $300, %r15d
+	#instruction start "395 = store 393 394, state: 392":
+	movq %r14, %rsi
+	movl %r15d, (%rsi)
+	#instruction start "396 = constant(1)":
+	leaq -104(%rbp), %rdi
+	movq $sum, (%rdi)
+	#instruction start "397 = constant(0)":
+	leaq -112(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "398 = load part address of 383 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r15d
+	#instruction start "399 = proj0 398":
+	#instruction start "400 = proj1 398":
+	#instruction start "401 = load part address of 387 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "402 = proj0 401":
+	#instruction start "403 = proj1 401":
+	#instruction start "404 = load part address of 390 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "405 = proj0 404":
+	#instruction start "406 = proj1 404":
+	#instruction start "407 = load part address of 393 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r13d
+	#instruction start "408 = proj0 407":
+	#instruction start "409 = proj1 407":
+	#instruction start "410 = allocate_call_stack 0":
+	#instruction start "411 = set_reg %rdi 400":
+	#instruction start "412 = set_reg %rsi 403 state: 411":
+	#instruction start "413 = set_reg %rdx 406 state: 412":
+	#instruction start "414 = set_reg %rcx 409 state: 413":
+	#instruction start "415 = set_reg %rax 397 state: 414":
+	#instruction start "416 = call 396":
+	addq $0, %rsp
+	movq -112(%rbp), %rax
+	movq %r13, %rcx
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r15, %rdi
+	movq -104(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r14
+	#instruction start "417 = proj0 416":
+	#instruction start "418 = proj1 416":
+	#instruction start "419 = %rax":
+	#instruction start "420 = int_cast_zero 419":
+	movq %r14, %rax
+	movl %eax, %ebx
+	#instruction start "421 = constant(600)":
+	movl $600, %r12d
+	#instruction start "422 = 420 == 421":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "424 = if 344 422":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L55
+.L54:
+	#instruction start "427 = constant(6)":
+	movq $.Ls6, %rbx
+	#instruction start "428 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "429 = constant(69)":
+	movl $69, %r13d
+	#instruction start "430 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "431 = alloc with size 8":
+	leaq -800(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "432 = store 431 427, state: 417":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "433 = alloc with size 8":
+	leaq -808(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "434 = store 433 428, state: 432":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "435 = alloc with size 4":
+	leaq -812(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "436 = store 435 429, state: 434":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "437 = alloc with size 8":
+	leaq -820(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "438 = store 437 430, state: 436":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "439 = constant(2)":
+	leaq -160(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "440 = constant(0)":
+	leaq -168(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "441 = load part address of 431 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "442 = proj0 441":
+	#instruction start "443 = proj1 441":
+	#instruction start "444 = load part address of 433 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "445 = proj0 444":
+	#instruction start "446 = proj1 444":
+	#instruction start "447 = load part address of 435 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "448 = proj0 447":
+	#instruction start "449 = proj1 447":
+	#instruction start "450 = load part address of 437 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "451 = proj0 450":
+	#instruction start "452 = proj1 450":
+	#instruction start "453 = allocate_call_stack 0":
+	#instruction start "454 = set_reg %rdi 443":
+	#instruction start "455 = set_reg %rsi 446 state: 454":
+	#instruction start "456 = set_reg %rdx 449 state: 455":
+	#instruction start "457 = set_reg %rcx 452 state: 456":
+	#instruction start "458 = set_reg %rax 440 state: 457":
+	#instruction start "459 = call 439":
+	addq $0, %rsp
+	movq -168(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -160(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "460 = proj0 459":
+	#instruction start "461 = proj1 459":
+	#Block jump
+	jmp .L56
+.L55:
+	#Block jump elided
+.L56:
+	#instruction start "462 = alloc with size 4":
+	leaq -824(%rbp), %rsi
+	movq %rsi, -216(%rbp)
+	#instruction start "463 = constant(6)":
+	movl $6, %r12d
+	#instruction start "464 = phi (region: 423) 417 460":
+	#instruction start "465 = store 462 463, state: 464":
+	movq -216(%rbp), %rsi
+	movl %r12d, (%rsi)
+	#instruction start "466 = alloc with size 4":
+	leaq -828(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "467 = constant(100)":
+	movl $100, %r13d
+	#instruction start "468 = store 466 467, state: 465":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "469 = alloc with size 4":
+	leaq -832(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "470 = constant(200)":
+	movl $200, %r14d
+	#instruction start "471 = store 469 470, state: 468":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "472 = alloc with size 4":
+	leaq -836(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "473 = constant(300)":
+	movl $300, %r15d
+	#instruction start "474 = store 472 473, state: 471":
+	movq %r14, %rsi
+	movl %r15d, (%rsi)
+	#instruction start "475 = alloc with size 4":
+	leaq -840(%rbp), %rsi
+	movq %rsi, -224(%rbp)
+	#instruction start "476 = constant(400)":
+	movl $400, %ebx
+	#instruction start "477 = store 475 476, state: 474":
+	movq -224(%rbp), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "478 = alloc with size 4":
+	leaq -844(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "479 = constant(500)":
+	movl $500, %r15d
+	#instruction start "480 = store 478 479, state: 477":
+	movq %rbx, %rsi
+	movl %r15d, (%rsi)
+	#instruction start "481 = alloc with size 4":
+	leaq -848(%rbp), %rsi
+	movq %rsi, -232(%rbp)
+	#instruction start "482 = constant(600)":
+	movl $600, %r15d
+	#instruction start "483 = store 481 482, state: 480":
+	movq -232(%rbp), %rsi
+	movl %r15d, (%rsi)
+	#instruction start "484 = constant(1)":
+	leaq -240(%rbp), %rdi
+	movq $sum, (%rdi)
+	#instruction start "485 = constant(0)":
+	leaq -248(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "486 = load part address of 462 with offset 0":
+	movq -216(%rbp), %rdi
+	leaq (%rdi), %rdi
+	leaq -252(%rbp), %rsi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "487 = proj0 486":
+	#instruction start "488 = proj1 486":
+	#instruction start "489 = load part address of 466 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	leaq -256(%rbp), %rsi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "490 = proj0 489":
+	#instruction start "491 = proj1 489":
+	#instruction start "492 = load part address of 469 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "493 = proj0 492":
+	#instruction start "494 = proj1 492":
+	#instruction start "495 = load part address of 472 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r13d
+	#instruction start "496 = proj0 495":
+	#instruction start "497 = proj1 495":
+	#instruction start "498 = load part address of 475 with offset 0":
+	movq -224(%rbp), %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "499 = proj0 498":
+	#instruction start "500 = proj1 498":
+	#instruction start "501 = load part address of 478 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r15d
+	#instruction start "502 = proj0 501":
+	#instruction start "503 = proj1 501":
+	#instruction start "504 = allocate_call_stack -16":
+	#instruction start "505 = store address 481 into 504 relative to stack":
+	#instruction start "506 = set_reg %rdi 488":
+	#instruction start "507 = set_reg %rsi 491 state: 506":
+	#instruction start "508 = set_reg %rdx 494 state: 507":
+	#instruction start "509 = set_reg %rcx 497 state: 508":
+	#instruction start "510 = set_reg %r8 500 state: 509":
+	#instruction start "511 = set_reg %r9 503 state: 510":
+	#instruction start "512 = set_reg %rax 485 state: 511":
+	#instruction start "513 = call 484":
+	addq $-16, %rsp
+	leaq (%rsp), %rsi
+	movq -232(%rbp), %rdi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	movq -248(%rbp), %rax
+	movq %r15, %r9
+	movq %r14, %r8
+	movq %r13, %rcx
+	movq %r12, %rdx
+	movl -256(%rbp), %esi
+	movl -252(%rbp), %edi
+	movq -240(%rbp), %r11
+	callq *%r11
+	addq $-16, %rsp
+	movq %rax, %rbx
+	#instruction start "514 = proj0 513":
+	#instruction start "515 = proj1 513":
+	#instruction start "516 = %rax":
+	#instruction start "517 = int_cast_zero 516":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "518 = constant(2100)":
+	movl $2100, %ebx
+	#instruction start "519 = 517 == 518":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "521 = if 423 519":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L58
+.L57:
+	#instruction start "524 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "525 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "526 = constant(70)":
+	movl $70, %r13d
+	#instruction start "527 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "528 = alloc with size 8":
+	leaq -856(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "529 = store 528 524, state: 514":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "530 = alloc with size 8":
+	leaq -864(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "531 = store 530 525, state: 529":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "532 = alloc with size 4":
+	leaq -868(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "533 = store 532 526, state: 531":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "534 = alloc with size 8":
+	leaq -876(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "535 = store 534 527, state: 533":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "536 = constant(2)":
+	leaq -320(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "537 = constant(0)":
+	leaq -328(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "538 = load part address of 528 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "539 = proj0 538":
+	#instruction start "540 = proj1 538":
+	#instruction start "541 = load part address of 530 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "542 = proj0 541":
+	#instruction start "543 = proj1 541":
+	#instruction start "544 = load part address of 532 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "545 = proj0 544":
+	#instruction start "546 = proj1 544":
+	#instruction start "547 = load part address of 534 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "548 = proj0 547":
+	#instruction start "549 = proj1 547":
+	#instruction start "550 = allocate_call_stack 0":
+	#instruction start "551 = set_reg %rdi 540":
+	#instruction start "552 = set_reg %rsi 543 state: 551":
+	#instruction start "553 = set_reg %rdx 546 state: 552":
+	#instruction start "554 = set_reg %rcx 549 state: 553":
+	#instruction start "555 = set_reg %rax 537 state: 554":
+	#instruction start "556 = call 536":
+	addq $0, %rsp
+	movq -328(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -320(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "557 = proj0 556":
+	#instruction start "558 = proj1 556":
+	#Block jump
+	jmp .L59
+.L58:
+	#Block jump elided
+.L59:
+	#instruction start "559 = alloc with size 4":
+	leaq -880(%rbp), %rsi
+	movq %rsi, -376(%rbp)
+	#instruction start "560 = constant(9)":
+	movl $9, %r12d
+	#instruction start "561 = phi (region: 520) 514 557":
+	#instruction start "562 = store 559 560, state: 561":
+	movq -376(%rbp), %rsi
+	movl %r12d, (%rsi)
+	#instruction start "563 = alloc with size 4":
+	leaq -884(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "564 = constant(1)":
+	movl $1, %r13d
+	#instruction start "565 = store 563 564, state: 562":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "566 = alloc with size 4":
+	leaq -888(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "567 = constant(2)":
+	movl $2, %r14d
+	#instruction start "568 = store 566 567, state: 565":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "569 = alloc with size 4":
+	leaq -892(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "570 = constant(3)":
+	movl $3, %r15d
+	#instruction start "571 = store 569 570, state: 568":
+	movq %r14, %rsi
+	movl %r15d, (%rsi)
+	#instruction start "572 = alloc with size 4":
+	leaq -896(%rbp), %rsi
+	movq %rsi, -384(%rbp)
+	#instruction start "573 = constant(4)":
+	movl $4, %ebx
+	#instruction start "574 = store 572 573, state: 571":
+	movq -384(%rbp), %rsi
+	movl %ebx, (%rsi)
+	#instruction start "575 = alloc with size 4":
+	leaq -900(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "576 = constant(5)":
+	movl $5, %r15d
+	#instruction start "577 = store 575 576, state: 574":
+	movq %rbx, %rsi
+	movl %r15d, (%rsi)
+	#instruction start "578 = alloc with size 4":
+	leaq -904(%rbp), %rsi
+	movq %rsi, -392(%rbp)
+	#instruction start "579 = constant(6)":
+	movl $6, %r15d
+	#instruction start "580 = store 578 579, state: 577":
+	movq -392(%rbp), %rsi
+	movl %r15d, (%rsi)
+	#instruction start "581 = alloc with size 4":
+	leaq -908(%rbp), %rsi
+	movq %rsi, -400(%rbp)
+	#instruction start "582 = constant(7)":
+	movl $7, %r15d
+	#instruction start "583 = store 581 582, state: 580":
+	movq -400(%rbp), %rsi
+	movl %r15d, (%rsi)
+	#instruction start "584 = alloc with size 4":
+	leaq -912(%rbp), %rsi
+	movq %rsi, -408(%rbp)
+	#instruction start "585 = constant(8)":
+	movl $8, %r15d
+	#instruction start "586 = store 584 585, state: 583":
+	movq -408(%rbp), %rsi
+	movl %r15d, (%rsi)
+	#instruction start "587 = alloc with size 4":
+	leaq -916(%rbp), %rsi
+	movq %rsi, -416(%rbp)
+	#instruction start "588 = constant(-36)":
+	movl $4294967260, %r15d
+	#instruction start "589 = store 587 588, state: 586":
+	movq -416(%rbp), %rsi
+	movl %r15d, (%rsi)
+	#instruction start "590 = constant(8)":
+	leaq -424(%rbp), %rdi
+	movq $sum_8p, (%rdi)
+	#instruction start "591 = constant(0)":
+	leaq -432(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "592 = load part address of 559 with offset 0":
+	movq -376(%rbp), %rdi
+	leaq (%rdi), %rdi
+	leaq -436(%rbp), %rsi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "593 = proj0 592":
+	#instruction start "594 = proj1 592":
+	#instruction start "595 = load part address of 563 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	leaq -440(%rbp), %rsi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	#instruction start "596 = proj0 595":
+	#instruction start "597 = proj1 595":
+	#instruction start "598 = load part address of 566 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "599 = proj0 598":
+	#instruction start "600 = proj1 598":
+	#instruction start "601 = load part address of 569 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r13d
+	#instruction start "602 = proj0 601":
+	#instruction start "603 = proj1 601":
+	#instruction start "604 = load part address of 572 with offset 0":
+	movq -384(%rbp), %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "605 = proj0 604":
+	#instruction start "606 = proj1 604":
+	#instruction start "607 = load part address of 575 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r15d
+	#instruction start "608 = proj0 607":
+	#instruction start "609 = proj1 607":
+	#instruction start "610 = allocate_call_stack -32":
+	#instruction start "611 = store address 578 into 610 relative to stack":
+	#instruction start "612 = store address 581 into 611 relative to stack":
+	#instruction start "613 = store address 584 into 612 relative to stack":
+	#instruction start "614 = store address 587 into 613 relative to stack":
+	#instruction start "615 = set_reg %rdi 594":
+	#instruction start "616 = set_reg %rsi 597 state: 615":
+	#instruction start "617 = set_reg %rdx 600 state: 616":
+	#instruction start "618 = set_reg %rcx 603 state: 617":
+	#instruction start "619 = set_reg %r8 606 state: 618":
+	#instruction start "620 = set_reg %r9 609 state: 619":
+	#instruction start "621 = set_reg %rax 591 state: 620":
+	#instruction start "622 = call 590":
+	addq $-32, %rsp
+	leaq 24(%rsp), %rsi
+	movq -416(%rbp), %rdi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	leaq 16(%rsp), %rsi
+	movq -408(%rbp), %rdi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	leaq 8(%rsp), %rsi
+	movq -400(%rbp), %rdi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	leaq (%rsp), %rsi
+	movq -392(%rbp), %rdi
+	movl (%rdi), %eax
+	movl %eax, (%rsi)
+	movq -432(%rbp), %rax
+	movq %r15, %r9
+	movq %r14, %r8
+	movq %r13, %rcx
+	movq %r12, %rdx
+	movl -440(%rbp), %esi
+	movl -436(%rbp), %edi
+	movq -424(%rbp), %r11
+	callq *%r11
+	addq $-32, %rsp
+	movq %rax, %rbx
+	#instruction start "623 = proj0 622":
+	#instruction start "624 = proj1 622":
+	#instruction start "625 = %rax":
+	#instruction start "626 = int_cast_zero 625":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "627 = constant(0)":
+	movl $0, %ebx
+	#instruction start "628 = 626 == 627":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "630 = if 520 628":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L61
+.L60:
+	#instruction start "633 = constant(9)":
+	movq $.Ls9, %rbx
+	#instruction start "634 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "635 = constant(71)":
+	movl $71, %r13d
+	#instruction start "636 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "637 = alloc with size 8":
+	leaq -924(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "638 = store 637 633, state: 623":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "639 = alloc with size 8":
+	leaq -932(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "640 = store 639 634, state: 638":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "641 = alloc with size 4":
+	leaq -936(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "642 = store 641 635, state: 640":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "643 = alloc with size 8":
+	leaq -944(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "644 = store 643 636, state: 642":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "645 = constant(2)":
+	leaq -504(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "646 = constant(0)":
+	leaq -512(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "647 = load part address of 637 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "648 = proj0 647":
+	#instruction start "649 = proj1 647":
+	#instruction start "650 = load part address of 639 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "651 = proj0 650":
+	#instruction start "652 = proj1 650":
+	#instruction start "653 = load part address of 641 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "654 = proj0 653":
+	#instruction start "655 = proj1 653":
+	#instruction start "656 = load part address of 643 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "657 = proj0 656":
+	#instruction start "658 = proj1 656":
+	#instruction start "659 = allocate_call_stack 0":
+	#instruction start "660 = set_reg %rdi 649":
+	#instruction start "661 = set_reg %rsi 652 state: 660":
+	#instruction start "662 = set_reg %rdx 655 state: 661":
+	#instruction start "663 = set_reg %rcx 658 state: 662":
+	#instruction start "664 = set_reg %rax 646 state: 663":
+	#instruction start "665 = call 645":
+	addq $0, %rsp
+	movq -512(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -504(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "666 = proj0 665":
+	#instruction start "667 = proj1 665":
+	#Block jump
+	jmp .L62
+.L61:
+	#Block jump elided
+.L62:
+	#instruction start "668 = alloc with size 40":
+	leaq -984(%rbp), %rsi
+	movq %rsi, -560(%rbp)
+	#instruction start "669 = phi (region: 629) 623 666":
+	#instruction start "670 = set_zero_ptr 668, size: 40":
+	movq -560(%rbp), %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	movq $0, 16(%rdi)
+	movq $0, 24(%rdi)
+	movq $0, 32(%rdi)
+	#instruction start "671 = constant(0)":
+	movq $0, %r12
+	#instruction start "672 = 668 + 671":
+	movq -560(%rbp), %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "673 = constant(0)":
+	movq $0, %r12
+	#instruction start "674 = 672 + 673":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "675 = constant(1)":
+	movl $1, %r12d
+	#instruction start "676 = store 674 675, state: 670":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "677 = constant(4)":
+	movq $4, %r12
+	#instruction start "678 = 672 + 677":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "679 = constant(2)":
+	movl $2, %r12d
+	#instruction start "680 = store 678 679, state: 676":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "681 = constant(8)":
+	movq $8, %r12
+	#instruction start "682 = 672 + 681":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "683 = constant(3)":
+	movl $3, %r12d
+	#instruction start "684 = store 682 683, state: 680":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "685 = constant(12)":
+	movq $12, %r12
+	#instruction start "686 = 672 + 685":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "687 = constant(4)":
+	movl $4, %r12d
+	#instruction start "688 = store 686 687, state: 684":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "689 = constant(16)":
+	movq $16, %r12
+	#instruction start "690 = 672 + 689":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "691 = constant(5)":
+	movl $5, %r12d
+	#instruction start "692 = store 690 691, state: 688":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "693 = constant(20)":
+	movq $20, %r12
+	#instruction start "694 = 672 + 693":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "695 = constant(6)":
+	movl $6, %r12d
+	#instruction start "696 = store 694 695, state: 692":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "697 = constant(24)":
+	movq $24, %r12
+	#instruction start "698 = 672 + 697":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "699 = constant(7)":
+	movl $7, %r12d
+	#instruction start "700 = store 698 699, state: 696":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "701 = constant(28)":
+	movq $28, %r12
+	#instruction start "702 = 672 + 701":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "703 = constant(8)":
+	movl $8, %r12d
+	#instruction start "704 = store 702 703, state: 700":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "705 = constant(32)":
+	movq $32, %r12
+	#instruction start "706 = 672 + 705":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "707 = constant(9)":
+	movl $9, %r12d
+	#instruction start "708 = store 706 707, state: 704":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "709 = constant(36)":
+	movq $36, %r12
+	#instruction start "710 = 672 + 709":
+	movq %r13, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "711 = constant(10)":
+	movl $10, %r12d
+	#instruction start "712 = store 710 711, state: 708":
+	movq %r14, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "713 = alloc with size 40":
+	leaq -1024(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "714 = set_zero_ptr 713, size: 40":
+	movq %r12, %rdi
+	movq $0, (%rdi)
+	movq $0, 8(%rdi)
+	movq $0, 16(%rdi)
+	movq $0, 24(%rdi)
+	movq $0, 32(%rdi)
+	#instruction start "715 = constant(0)":
+	movq $0, %r13
+	#instruction start "716 = 713 + 715":
+	movq %r12, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r14
+	#instruction start "717 = constant(0)":
+	movq $0, %r13
+	#instruction start "718 = 716 + 717":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "719 = constant(1)":
+	movl $1, %r13d
+	#instruction start "720 = store 718 719, state: 714":
+	movq %r15, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "721 = constant(4)":
+	movq $4, %r13
+	#instruction start "722 = 716 + 721":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "723 = constant(2)":
+	movl $2, %r13d
+	#instruction start "724 = store 722 723, state: 720":
+	movq %r15, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "725 = constant(8)":
+	movq $8, %r13
+	#instruction start "726 = 716 + 725":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "727 = constant(3)":
+	movl $3, %r13d
+	#instruction start "728 = store 726 727, state: 724":
+	movq %r15, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "729 = constant(12)":
+	movq $12, %r13
+	#instruction start "730 = 716 + 729":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "731 = constant(4)":
+	movl $4, %r13d
+	#instruction start "732 = store 730 731, state: 728":
+	movq %r15, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "733 = constant(16)":
+	movq $16, %r13
+	#instruction start "734 = 716 + 733":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "735 = constant(5)":
+	movl $5, %r13d
+	#instruction start "736 = store 734 735, state: 732":
+	movq %r15, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "737 = constant(20)":
+	movq $20, %r13
+	#instruction start "738 = 716 + 737":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "739 = constant(6)":
+	movl $6, %r13d
+	#instruction start "740 = store 738 739, state: 736":
+	movq %r15, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "741 = constant(24)":
+	movq $24, %r13
+	#instruction start "742 = 716 + 741":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "743 = constant(7)":
+	movl $7, %r13d
+	#instruction start "744 = store 742 743, state: 740":
+	movq %r15, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "745 = constant(28)":
+	movq $28, %r13
+	#instruction start "746 = 716 + 745":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "747 = constant(8)":
+	movl $8, %r13d
+	#instruction start "748 = store 746 747, state: 744":
+	movq %r15, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "749 = constant(32)":
+	movq $32, %r13
+	#instruction start "750 = 716 + 749":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "751 = constant(9)":
+	movl $9, %r13d
+	#instruction start "752 = store 750 751, state: 748":
+	movq %r15, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "753 = constant(36)":
+	movq $36, %r13
+	#instruction start "754 = 716 + 753":
+	movq %r14, %rax
+	movq %r13, %rcx
+	addq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "755 = constant(10)":
+	movl $10, %r13d
+	#instruction start "756 = store 754 755, state: 752":
+	movq %r15, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "757 = alloc with size 4":
+	leaq -1028(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "758 = constant(2)":
+	movl $2, %r14d
+	#instruction start "759 = store 757 758, state: 756":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "760 = constant(10)":
+	movq $sum_structs, %r14
+	#instruction start "761 = constant(0)":
+	movq $0, %r15
+	#instruction start "762 = load part address of 757 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "763 = proj0 762":
+	#instruction start "764 = proj1 762":
+	#instruction start "765 = allocate_call_stack -80":
+	#instruction start "766 = store address 668 into 765 relative to stack":
+	#instruction start "767 = store address 713 into 766 relative to stack":
+	#instruction start "768 = set_reg %rdi 764":
+	#instruction start "769 = set_reg %rax 761 state: 768":
+	#instruction start "770 = call 760":
+	addq $-80, %rsp
+	leaq 40(%rsp), %rsi
+	movq %r12, %rdi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	movq 8(%rdi), %rax
+	movq %rax, 8(%rsi)
+	movq 16(%rdi), %rax
+	movq %rax, 16(%rsi)
+	movq 24(%rdi), %rax
+	movq %rax, 24(%rsi)
+	movq 32(%rdi), %rax
+	movq %rax, 32(%rsi)
+	leaq (%rsp), %rsi
+	movq -560(%rbp), %rdi
+	movq (%rdi), %rax
+	movq %rax, (%rsi)
+	movq 8(%rdi), %rax
+	movq %rax, 8(%rsi)
+	movq 16(%rdi), %rax
+	movq %rax, 16(%rsi)
+	movq 24(%rdi), %rax
+	movq %rax, 24(%rsi)
+	movq 32(%rdi), %rax
+	movq %rax, 32(%rsi)
+	movq %r15, %rax
+	movq %rbx, %rdi
+	movq %r14, %r11
+	callq *%r11
+	addq $-80, %rsp
+	movq %rax, %r13
+	#instruction start "771 = proj0 770":
+	#instruction start "772 = proj1 770":
+	#instruction start "773 = %rax":
+	#instruction start "774 = int_cast_zero 773":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "775 = constant(110)":
+	movl $110, %r12d
+	#instruction start "776 = 774 == 775":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "778 = if 629 776":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L64
+.L63:
+	#instruction start "781 = constant(11)":
+	movq $.Ls11, %rbx
+	#instruction start "782 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "783 = constant(72)":
+	movl $72, %r13d
+	#instruction start "784 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "785 = alloc with size 8":
+	leaq -1036(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "786 = store 785 781, state: 771":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "787 = alloc with size 8":
+	leaq -1044(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "788 = store 787 782, state: 786":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "789 = alloc with size 4":
+	leaq -1048(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "790 = store 789 783, state: 788":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "791 = alloc with size 8":
+	leaq -1056(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "792 = store 791 784, state: 790":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "793 = constant(2)":
+	leaq -584(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "794 = constant(0)":
+	leaq -592(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "795 = load part address of 785 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "796 = proj0 795":
+	#instruction start "797 = proj1 795":
+	#instruction start "798 = load part address of 787 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "799 = proj0 798":
+	#instruction start "800 = proj1 798":
+	#instruction start "801 = load part address of 789 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "802 = proj0 801":
+	#instruction start "803 = proj1 801":
+	#instruction start "804 = load part address of 791 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "805 = proj0 804":
+	#instruction start "806 = proj1 804":
+	#instruction start "807 = allocate_call_stack 0":
+	#instruction start "808 = set_reg %rdi 797":
+	#instruction start "809 = set_reg %rsi 800 state: 808":
+	#instruction start "810 = set_reg %rdx 803 state: 809":
+	#instruction start "811 = set_reg %rcx 806 state: 810":
+	#instruction start "812 = set_reg %rax 794 state: 811":
+	#instruction start "813 = call 793":
+	addq $0, %rsp
+	movq -592(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -584(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "814 = proj0 813":
+	#instruction start "815 = proj1 813":
+	#Block jump
+	jmp .L65
+.L64:
+	#Block jump elided
+.L65:
+	#instruction start "816 = alloc with size 4":
+	leaq -1060(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "817 = constant(2)":
+	movl $2, %r12d
+	#instruction start "818 = phi (region: 777) 771 814":
+	#instruction start "819 = store 816 817, state: 818":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "820 = alloc with size 4":
+	leaq -1064(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "821 = constant(100)":
+	movl $100, %r13d
+	#instruction start "822 = store 820 821, state: 819":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "823 = alloc with size 4":
+	leaq -1068(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "824 = constant(200)":
+	movl $200, %r14d
+	#instruction start "825 = store 823 824, state: 822":
+	movq %r13, %rsi
+	movl %r14d, (%rsi)
+	#instruction start "826 = constant(12)":
+	leaq -640(%rbp), %rdi
+	movq $asum, (%rdi)
+	#instruction start "827 = constant(0)":
+	movq $0, %r15
+	#instruction start "828 = load part address of 816 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r14d
+	#instruction start "829 = proj0 828":
+	#instruction start "830 = proj1 828":
+	#instruction start "831 = load part address of 820 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "832 = proj0 831":
+	#instruction start "833 = proj1 831":
+	#instruction start "834 = load part address of 823 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %r12d
+	#instruction start "835 = proj0 834":
+	#instruction start "836 = proj1 834":
+	#instruction start "837 = allocate_call_stack 0":
+	#instruction start "838 = set_reg %rdi 830":
+	#instruction start "839 = set_reg %rsi 833 state: 838":
+	#instruction start "840 = set_reg %rdx 836 state: 839":
+	#instruction start "841 = set_reg %rax 827 state: 840":
+	#instruction start "842 = call 826":
+	addq $0, %rsp
+	movq %r15, %rax
+	movq %r12, %rdx
+	movq %rbx, %rsi
+	movq %r14, %rdi
+	movq -640(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %r13
+	#instruction start "843 = proj0 842":
+	#instruction start "844 = proj1 842":
+	#instruction start "845 = %rax":
+	#instruction start "846 = int_cast_zero 845":
+	movq %r13, %rax
+	movl %eax, %ebx
+	#instruction start "847 = constant(300)":
+	movl $300, %r12d
+	#instruction start "848 = 846 == 847":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "850 = if 777 848":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L67
+.L66:
+	#instruction start "853 = constant(13)":
+	movq $.Ls13, %rbx
+	#instruction start "854 = constant(4)":
+	movq $.Ls4, %r12
+	#instruction start "855 = constant(77)":
+	movl $77, %r13d
+	#instruction start "856 = constant(5)":
+	movq $.Ls5, %r14
+	#instruction start "857 = alloc with size 8":
+	leaq -1076(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "858 = store 857 853, state: 843":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "859 = alloc with size 8":
+	leaq -1084(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "860 = store 859 854, state: 858":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "861 = alloc with size 4":
+	leaq -1088(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "862 = store 861 855, state: 860":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "863 = alloc with size 8":
+	leaq -1096(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "864 = store 863 856, state: 862":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "865 = constant(2)":
+	leaq -680(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "866 = constant(0)":
+	leaq -688(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "867 = load part address of 857 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "868 = proj0 867":
+	#instruction start "869 = proj1 867":
+	#instruction start "870 = load part address of 859 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "871 = proj0 870":
+	#instruction start "872 = proj1 870":
+	#instruction start "873 = load part address of 861 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "874 = proj0 873":
+	#instruction start "875 = proj1 873":
+	#instruction start "876 = load part address of 863 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "877 = proj0 876":
+	#instruction start "878 = proj1 876":
+	#instruction start "879 = allocate_call_stack 0":
+	#instruction start "880 = set_reg %rdi 869":
+	#instruction start "881 = set_reg %rsi 872 state: 880":
+	#instruction start "882 = set_reg %rdx 875 state: 881":
+	#instruction start "883 = set_reg %rcx 878 state: 882":
+	#instruction start "884 = set_reg %rax 866 state: 883":
+	#instruction start "885 = call 865":
+	addq $0, %rsp
+	movq -688(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -680(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "886 = proj0 885":
+	#instruction start "887 = proj1 885":
+	#Block jump
+	jmp .L68
+.L67:
+	#Block jump elided
+.L68:
+	#instruction start "888 = constant(0)":
+	movl $0, %ebx
+	#instruction start "889 = set_reg %rax 888":
+	#instruction start "890 = phi (region: 849) 843 886":
+	#instruction start "891 = return 849, 889, 890":
+	movq %rbx, %rax
+	#Block return.
+	movq -1104(%rbp), %rbx
+	movq -1112(%rbp), %r12
+	movq -1120(%rbp), %r13
+	movq -1128(%rbp), %r14
+	movq -1136(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls3:
+	.string "sum(2, 100, 200) == 300\000"
+.Ls4:
+	.string "/root/repo/tests/variadic_functions.c\000"
+.Ls5:
+	.string "main"
+.Ls6:
+	.string "sum(3, 100, 200, 300) == 600\000"
+.Ls7:
+	.string "sum(6, 100, 200, 300, 400, 500, 600) == 2100\000"
+.Ls9:
+	.string "sum_8p(9, 1, 2, 3, 4, 5, 6, 7, 8, -36) == 0\000"
+.Ls11:
+	.string "sum_structs(2, (struct large_struct) { {1, 2, 3, 4, 5, 6, 7, 8, 9, 10} }, (struct large_struct) { {1, 2, 3, 4, 5, 6, 7, 8, 9, 10} }) == 110\000"
+.Ls13:
+	.string "asum(2, 100, 200) == 300\000"
@@ -0,0 +1,930 @@
+.global main
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $592, %rsp
+	movq %rbx, -548(%rbp)
+	movq %r12, -556(%rbp)
+	movq %r13, -564(%rbp)
+	movq %r14, -572(%rbp)
+	movq %r15, -580(%rbp)
+.L2:
+	#instruction start "3 = proj3 1":
+	#instruction start "6 = constant(0)":
+	movq $0, %rbx
+	#instruction start "7 = constant(0)":
+	movl $0, %r12d
+	#instruction start "8 = int_cast_zero 7":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "9 = constant(1)":
+	movq $.Ls1, %r12
+	#instruction start "10 = alloc with size 8":
+	leaq -328(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "11 = store 10 6, state: 3":
+	movq %r14, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "12 = alloc with size 8":
+	leaq -336(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "13 = store 12 8, state: 11":
+	movq %rbx, %rsi
+	movq %r13, (%rsi)
+	#instruction start "14 = alloc with size 8":
+	leaq -344(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "15 = store 14 9, state: 13":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "16 = constant(0)":
+	leaq -8(%rbp), %rdi
+	movq $snprintf, (%rdi)
+	#instruction start "17 = constant(0)":
+	movq $0, %r15
+	#instruction start "18 = load part address of 10 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "19 = proj0 18":
+	#instruction start "20 = proj1 18":
+	#instruction start "21 = load part address of 12 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "22 = proj0 21":
+	#instruction start "23 = proj1 21":
+	#instruction start "24 = load part address of 14 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "25 = proj0 24":
+	#instruction start "26 = proj1 24":
+	#instruction start "27 = allocate_call_stack 0":
+	#instruction start "28 = set_reg %rdi 20":
+	#instruction start "29 = set_reg %rsi 23 state: 28":
+	#instruction start "30 = set_reg %rdx 26 state: 29":
+	#instruction start "31 = set_reg %rax 17 state: 30":
+	#instruction start "32 = call 16":
+	addq $0, %rsp
+	movq %r15, %rax
+	movq %rbx, %rdx
+	movq %r14, %rsi
+	movq %r12, %rdi
+	movq -8(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "33 = proj0 32":
+	#instruction start "34 = proj1 32":
+	#instruction start "37 = constant(0)":
+	movq $0, %rbx
+	#instruction start "38 = constant(0)":
+	movl $0, %r12d
+	#instruction start "39 = int_cast_zero 38":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r13
+	#instruction start "40 = constant(2)":
+	movq $.Ls2, %r12
+	#instruction start "41 = alloc with size 8":
+	leaq -352(%rbp), %rsi
+	movq %rsi, %r14
+	#instruction start "42 = store 41 37, state: 33":
+	movq %r14, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "43 = alloc with size 8":
+	leaq -360(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "44 = store 43 39, state: 42":
+	movq %rbx, %rsi
+	movq %r13, (%rsi)
+	#instruction start "45 = alloc with size 8":
+	leaq -368(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "46 = store 45 40, state: 44":
+	movq %r13, %rsi
+	movq %r12, (%rsi)
+	#instruction start "47 = alloc with size 8":
+	leaq -376(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "48 = constant(3)":
+	movq $.Ls3, %r15
+	#instruction start "49 = store 47 48, state: 46":
+	movq %r12, %rsi
+	movq %r15, (%rsi)
+	#instruction start "50 = constant(0)":
+	leaq -48(%rbp), %rdi
+	movq $snprintf, (%rdi)
+	#instruction start "51 = constant(0)":
+	leaq -56(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "52 = load part address of 41 with offset 0":
+	movq %r14, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "53 = proj0 52":
+	#instruction start "54 = proj1 52":
+	#instruction start "55 = load part address of 43 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "56 = proj0 55":
+	#instruction start "57 = proj1 55":
+	#instruction start "58 = load part address of 45 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %rbx
+	#instruction start "59 = proj0 58":
+	#instruction start "60 = proj1 58":
+	#instruction start "61 = load part address of 47 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "62 = proj0 61":
+	#instruction start "63 = proj1 61":
+	#instruction start "64 = allocate_call_stack 0":
+	#instruction start "65 = set_reg %rdi 54":
+	#instruction start "66 = set_reg %rsi 57 state: 65":
+	#instruction start "67 = set_reg %rdx 60 state: 66":
+	#instruction start "68 = set_reg %rcx 63 state: 67":
+	#instruction start "69 = set_reg %rax 51 state: 68":
+	#instruction start "70 = call 50":
+	addq $0, %rsp
+	movq -56(%rbp), %rax
+	movq %r13, %rcx
+	movq %rbx, %rdx
+	movq %r14, %rsi
+	movq %r15, %rdi
+	movq -48(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "71 = proj0 70":
+	#instruction start "72 = proj1 70":
+	#instruction start "75 = constant(5)":
+	movq $.Ls5, %rbx
+	#instruction start "76 = constant(5)":
+	movq $.Ls5, %r12
+	#instruction start "77 = alloc with size 8":
+	leaq -384(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "78 = store 77 75, state: 71":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "79 = alloc with size 8":
+	leaq -392(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "80 = store 79 76, state: 78":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "81 = constant(4)":
+	movq $strcmp, %r12
+	#instruction start "82 = constant(0)":
+	movq $0, %r14
+	#instruction start "83 = load part address of 77 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "84 = proj0 83":
+	#instruction start "85 = proj1 83":
+	#instruction start "86 = load part address of 79 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "87 = proj0 86":
+	#instruction start "88 = proj1 86":
+	#instruction start "89 = allocate_call_stack 0":
+	#instruction start "90 = set_reg %rdi 85":
+	#instruction start "91 = set_reg %rsi 88 state: 90":
+	#instruction start "92 = set_reg %rax 82 state: 91":
+	#instruction start "93 = call 81":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "94 = proj0 93":
+	#instruction start "95 = proj1 93":
+	#instruction start "96 = %rax":
+	#instruction start "97 = int_cast_zero 96":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "98 = constant(0)":
+	movl $0, %ebx
+	#instruction start "99 = 97 == 98":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "101 = if 2 99":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L4
+.L3:
+	#instruction start "104 = constant(7)":
+	movq $.Ls7, %rbx
+	#instruction start "105 = constant(8)":
+	movq $.Ls8, %r12
+	#instruction start "106 = constant(15)":
+	movl $15, %r13d
+	#instruction start "107 = constant(9)":
+	movq $.Ls9, %r14
+	#instruction start "108 = alloc with size 8":
+	leaq -400(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "109 = store 108 104, state: 94":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "110 = alloc with size 8":
+	leaq -408(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "111 = store 110 105, state: 109":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "112 = alloc with size 4":
+	leaq -412(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "113 = store 112 106, state: 111":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "114 = alloc with size 8":
+	leaq -420(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "115 = store 114 107, state: 113":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "116 = constant(6)":
+	leaq -128(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "117 = constant(0)":
+	leaq -136(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "118 = load part address of 108 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "119 = proj0 118":
+	#instruction start "120 = proj1 118":
+	#instruction start "121 = load part address of 110 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "122 = proj0 121":
+	#instruction start "123 = proj1 121":
+	#instruction start "124 = load part address of 112 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "125 = proj0 124":
+	#instruction start "126 = proj1 124":
+	#instruction start "127 = load part address of 114 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "128 = proj0 127":
+	#instruction start "129 = proj1 127":
+	#instruction start "130 = allocate_call_stack 0":
+	#instruction start "131 = set_reg %rdi 120":
+	#instruction start "132 = set_reg %rsi 123 state: 131":
+	#instruction start "133 = set_reg %rdx 126 state: 132":
+	#instruction start "134 = set_reg %rcx 129 state: 133":
+	#instruction start "135 = set_reg %rax 117 state: 134":
+	#instruction start "136 = call 116":
+	addq $0, %rsp
+	movq -136(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -128(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "137 = proj0 136":
+	#instruction start "138 = proj1 136":
+	#Block jump
+	jmp .L5
+.L4:
+	#Block jump elided
+.L5:
+	#instruction start "139 = constant(10)":
+	movq $.Ls10, %rbx
+	#instruction start "140 = constant(10)":
+	movq $.Ls10, %r12
+	#instruction start "141 = alloc with size 8":
+	leaq -428(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "142 = phi (region: 100) 94 137":
+	#instruction start "143 = store 141 139, state: 142":
+	movq %r13, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "144 = alloc with size 8":
+	leaq -436(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "145 = store 144 140, state: 143":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "146 = constant(4)":
+	movq $strcmp, %r12
+	#instruction start "147 = constant(0)":
+	movq $0, %r14
+	#instruction start "148 = load part address of 141 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "149 = proj0 148":
+	#instruction start "150 = proj1 148":
+	#instruction start "151 = load part address of 144 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r13
+	#instruction start "152 = proj0 151":
+	#instruction start "153 = proj1 151":
+	#instruction start "154 = allocate_call_stack 0":
+	#instruction start "155 = set_reg %rdi 150":
+	#instruction start "156 = set_reg %rsi 153 state: 155":
+	#instruction start "157 = set_reg %rax 147 state: 156":
+	#instruction start "158 = call 146":
+	addq $0, %rsp
+	movq %r14, %rax
+	movq %r13, %rsi
+	movq %r15, %rdi
+	movq %r12, %r11
+	callq *%r11
+	addq $0, %rsp
+	movq %rax, %rbx
+	#instruction start "159 = proj0 158":
+	#instruction start "160 = proj1 158":
+	#instruction start "161 = %rax":
+	#instruction start "162 = int_cast_zero 161":
+	movq %rbx, %rax
+	movl %eax, %r12d
+	#instruction start "163 = constant(0)":
+	movl $0, %ebx
+	#instruction start "164 = 162 == 163":
+	movq %r12, %rax
+	movq %rbx, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r13d
+	#instruction start "166 = if 100 164":
+	movq %r13, %rdi
+	testq %rdi, %rdi
+	jne .L7
+.L6:
+	#instruction start "169 = constant(11)":
+	movq $.Ls11, %rbx
+	#instruction start "170 = constant(8)":
+	movq $.Ls8, %r12
+	#instruction start "171 = constant(16)":
+	movl $16, %r13d
+	#instruction start "172 = constant(9)":
+	movq $.Ls9, %r14
+	#instruction start "173 = alloc with size 8":
+	leaq -444(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "174 = store 173 169, state: 159":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "175 = alloc with size 8":
+	leaq -452(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "176 = store 175 170, state: 174":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "177 = alloc with size 4":
+	leaq -456(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "178 = store 177 171, state: 176":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "179 = alloc with size 8":
+	leaq -464(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "180 = store 179 172, state: 178":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "181 = constant(6)":
+	leaq -208(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "182 = constant(0)":
+	leaq -216(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "183 = load part address of 173 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "184 = proj0 183":
+	#instruction start "185 = proj1 183":
+	#instruction start "186 = load part address of 175 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "187 = proj0 186":
+	#instruction start "188 = proj1 186":
+	#instruction start "189 = load part address of 177 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "190 = proj0 189":
+	#instruction start "191 = proj1 189":
+	#instruction start "192 = load part address of 179 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "193 = proj0 192":
+	#instruction start "194 = proj1 192":
+	#instruction start "195 = allocate_call_stack 0":
+	#instruction start "196 = set_reg %rdi 185":
+	#instruction start "197 = set_reg %rsi 188 state: 196":
+	#instruction start "198 = set_reg %rdx 191 state: 197":
+	#instruction start "199 = set_reg %rcx 194 state: 198":
+	#instruction start "200 = set_reg %rax 182 state: 199":
+	#instruction start "201 = call 181":
+	addq $0, %rsp
+	movq -216(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -208(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "202 = proj0 201":
+	#instruction start "203 = proj1 201":
+	#Block jump
+	jmp .L8
+.L7:
+	#Block jump elided
+.L8:
+	#instruction start "204 = alloc with size 12":
+	leaq -476(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "205 = phi (region: 165) 159 202":
+	#instruction start "206 = set_zero_ptr 204, size: 12":
+	movq %rbx, %rdi
+	movq $0, (%rdi)
+	movl $0, 8(%rdi)
+	#instruction start "207 = constant(0)":
+	movq $0, %r12
+	#instruction start "208 = 204 + 207":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "209 = constant(4)":
+	movl $4, %r12d
+	#instruction start "210 = store 208 209, state: 206":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "211 = constant(4)":
+	movq $4, %r12
+	#instruction start "212 = 204 + 211":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "213 = constant(5)":
+	movl $5, %r12d
+	#instruction start "214 = store 212 213, state: 210":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "215 = constant(8)":
+	movq $8, %r12
+	#instruction start "216 = 204 + 215":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	addq %rcx, %rax
+	movq %rax, %r13
+	#instruction start "217 = constant(4)":
+	movl $4, %r12d
+	#instruction start "218 = store 216 217, state: 214":
+	movq %r13, %rsi
+	movl %r12d, (%rsi)
+	#instruction start "219 = constant(1)":
+	movl $1, %r12d
+	#instruction start "220 = if 165 219":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L10
+.L9:
+	#instruction start "244 = alloc with size 4":
+	leaq -480(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "245 = constant(0)":
+	movl $0, %r13d
+	#instruction start "246 = store 244 245, state: 218":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 248 (247 243 244)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L14
+.L10:
+	#instruction start "223 = constant(0)":
+	movl $0, %r12d
+	#instruction start "224 = int_cast_zero 223":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r14
+	#instruction start "225 = constant(4)":
+	movq $4, %r12
+	#instruction start "226 = 224 * 225":
+	movq %r14, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "227 = 204 + 226":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "228 = load_volatile 227, state: 218":
+	movq %r12, %rdi
+	movl (%rdi), %r14d
+	#instruction start "229 = proj0 228":
+	#instruction start "230 = proj1 228":
+	#instruction start "231 = constant(4)":
+	movl $4, %r12d
+	#instruction start "232 = 230 == 231":
+	movq %r14, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r15d
+	#instruction start "233 = if 222 232":
+	movq %r15, %rdi
+	testq %rdi, %rdi
+	jne .L12
+.L11:
+	#instruction start "239 = alloc with size 4":
+	leaq -484(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "240 = constant(0)":
+	movl $0, %r14d
+	#instruction start "241 = store 239 240, state: 229":
+	movq %r12, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 243 (242 236 239)
+	movq %r12, %rax
+	movq %rax, %r14
+	#Block jump
+	jmp .L13
+.L12:
+	#instruction start "236 = alloc with size 4":
+	leaq -488(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "237 = constant(1)":
+	movl $1, %r15d
+	#instruction start "238 = store 236 237, state: 229":
+	movq %r12, %rsi
+	movl %r15d, (%rsi)
+	#Phi node to 243 (242 236 239)
+	movq %r12, %rax
+	movq %rax, %r14
+	#Block jump elided
+.L13:
+	#instruction start "243 = phi (region: 242) 236 239":
+	#instruction start "250 = phi (region: 242) 238 241":
+	#Phi node to 248 (247 243 244)
+	movq %r14, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L14:
+	#instruction start "248 = phi (region: 247) 243 244":
+	#instruction start "249 = phi (region: 247) 250 246":
+	#instruction start "251 = load_volatile 248, state: 249":
+	movq %r13, %rdi
+	movl (%rdi), %r12d
+	#instruction start "252 = proj0 251":
+	#instruction start "253 = proj1 251":
+	#instruction start "254 = if 247 253":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L16
+.L15:
+	#instruction start "278 = alloc with size 4":
+	leaq -492(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "279 = constant(0)":
+	movl $0, %r13d
+	#instruction start "280 = store 278 279, state: 252":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 282 (281 277 278)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L20
+.L16:
+	#instruction start "257 = constant(1)":
+	movl $1, %r12d
+	#instruction start "258 = int_cast_zero 257":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r14
+	#instruction start "259 = constant(4)":
+	movq $4, %r12
+	#instruction start "260 = 258 * 259":
+	movq %r14, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "261 = 204 + 260":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "262 = load_volatile 261, state: 252":
+	movq %r12, %rdi
+	movl (%rdi), %r14d
+	#instruction start "263 = proj0 262":
+	#instruction start "264 = proj1 262":
+	#instruction start "265 = constant(5)":
+	movl $5, %r12d
+	#instruction start "266 = 264 == 265":
+	movq %r14, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r15d
+	#instruction start "267 = if 256 266":
+	movq %r15, %rdi
+	testq %rdi, %rdi
+	jne .L18
+.L17:
+	#instruction start "273 = alloc with size 4":
+	leaq -496(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "274 = constant(0)":
+	movl $0, %r14d
+	#instruction start "275 = store 273 274, state: 263":
+	movq %r12, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 277 (276 270 273)
+	movq %r12, %rax
+	movq %rax, %r14
+	#Block jump
+	jmp .L19
+.L18:
+	#instruction start "270 = alloc with size 4":
+	leaq -500(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "271 = constant(1)":
+	movl $1, %r15d
+	#instruction start "272 = store 270 271, state: 263":
+	movq %r12, %rsi
+	movl %r15d, (%rsi)
+	#Phi node to 277 (276 270 273)
+	movq %r12, %rax
+	movq %rax, %r14
+	#Block jump elided
+.L19:
+	#instruction start "277 = phi (region: 276) 270 273":
+	#instruction start "284 = phi (region: 276) 272 275":
+	#Phi node to 282 (281 277 278)
+	movq %r14, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L20:
+	#instruction start "282 = phi (region: 281) 277 278":
+	#instruction start "283 = phi (region: 281) 284 280":
+	#instruction start "285 = load_volatile 282, state: 283":
+	movq %r13, %rdi
+	movl (%rdi), %r12d
+	#instruction start "286 = proj0 285":
+	#instruction start "287 = proj1 285":
+	#instruction start "288 = if 281 287":
+	movq %r12, %rdi
+	testq %rdi, %rdi
+	jne .L22
+.L21:
+	#instruction start "312 = alloc with size 4":
+	leaq -504(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "313 = constant(0)":
+	movl $0, %r13d
+	#instruction start "314 = store 312 313, state: 286":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#Phi node to 316 (315 311 312)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump
+	jmp .L26
+.L22:
+	#instruction start "291 = constant(2)":
+	movl $2, %r12d
+	#instruction start "292 = int_cast_zero 291":
+	movq %r12, %rax
+	movslq %eax, %rax
+	movq %rax, %r14
+	#instruction start "293 = constant(4)":
+	movq $4, %r12
+	#instruction start "294 = 292 * 293":
+	movq %r14, %rax
+	movq %r12, %rcx
+	imulq %rcx, %rax
+	movq %rax, %r15
+	#instruction start "295 = 204 + 294":
+	movq %rbx, %rax
+	movq %r15, %rcx
+	addq %rcx, %rax
+	movq %rax, %r12
+	#instruction start "296 = load_volatile 295, state: 286":
+	movq %r12, %rdi
+	movl (%rdi), %ebx
+	#instruction start "297 = proj0 296":
+	#instruction start "298 = proj1 296":
+	#instruction start "299 = constant(4)":
+	movl $4, %r12d
+	#instruction start "300 = 298 == 299":
+	movq %rbx, %rax
+	movq %r12, %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, %r14d
+	#instruction start "301 = if 290 300":
+	movq %r14, %rdi
+	testq %rdi, %rdi
+	jne .L24
+.L23:
+	#instruction start "307 = alloc with size 4":
+	leaq -508(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "308 = constant(0)":
+	movl $0, %r12d
+	#instruction start "309 = store 307 308, state: 297":
+	movq %rbx, %rsi
+	movl %r12d, (%rsi)
+	#Phi node to 311 (310 304 307)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump
+	jmp .L25
+.L24:
+	#instruction start "304 = alloc with size 4":
+	leaq -512(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "305 = constant(1)":
+	movl $1, %r14d
+	#instruction start "306 = store 304 305, state: 297":
+	movq %rbx, %rsi
+	movl %r14d, (%rsi)
+	#Phi node to 311 (310 304 307)
+	movq %rbx, %rax
+	movq %rax, %r12
+	#Block jump elided
+.L25:
+	#instruction start "311 = phi (region: 310) 304 307":
+	#instruction start "318 = phi (region: 310) 306 309":
+	#Phi node to 316 (315 311 312)
+	movq %r12, %rax
+	movq %rax, %r13
+	#Block jump elided
+.L26:
+	#instruction start "316 = phi (region: 315) 311 312":
+	#instruction start "317 = phi (region: 315) 318 314":
+	#instruction start "319 = load_volatile 316, state: 317":
+	movq %r13, %rdi
+	movl (%rdi), %ebx
+	#instruction start "320 = proj0 319":
+	#instruction start "321 = proj1 319":
+	#instruction start "323 = if 315 321":
+	movq %rbx, %rdi
+	testq %rdi, %rdi
+	jne .L28
+.L27:
+	#instruction start "326 = constant(12)":
+	movq $.Ls12, %rbx
+	#instruction start "327 = constant(8)":
+	movq $.Ls8, %r12
+	#instruction start "328 = constant(19)":
+	movl $19, %r13d
+	#instruction start "329 = constant(9)":
+	movq $.Ls9, %r14
+	#instruction start "330 = alloc with size 8":
+	leaq -520(%rbp), %rsi
+	movq %rsi, %r15
+	#instruction start "331 = store 330 326, state: 320":
+	movq %r15, %rsi
+	movq %rbx, (%rsi)
+	#instruction start "332 = alloc with size 8":
+	leaq -528(%rbp), %rsi
+	movq %rsi, %rbx
+	#instruction start "333 = store 332 327, state: 331":
+	movq %rbx, %rsi
+	movq %r12, (%rsi)
+	#instruction start "334 = alloc with size 4":
+	leaq -532(%rbp), %rsi
+	movq %rsi, %r12
+	#instruction start "335 = store 334 328, state: 333":
+	movq %r12, %rsi
+	movl %r13d, (%rsi)
+	#instruction start "336 = alloc with size 8":
+	leaq -540(%rbp), %rsi
+	movq %rsi, %r13
+	#instruction start "337 = store 336 329, state: 335":
+	movq %r13, %rsi
+	movq %r14, (%rsi)
+	#instruction start "338 = constant(6)":
+	leaq -264(%rbp), %rdi
+	movq $__assert_fail, (%rdi)
+	#instruction start "339 = constant(0)":
+	leaq -272(%rbp), %rdi
+	movabsq $0, %rax
+	movq %rax, (%rdi)
+	#instruction start "340 = load part address of 330 with offset 0":
+	movq %r15, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r14
+	#instruction start "341 = proj0 340":
+	#instruction start "342 = proj1 340":
+	#instruction start "343 = load part address of 332 with offset 0":
+	movq %rbx, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r15
+	#instruction start "344 = proj0 343":
+	#instruction start "345 = proj1 343":
+	#instruction start "346 = load part address of 334 with offset 0":
+	movq %r12, %rdi
+	leaq (%rdi), %rdi
+	movl (%rdi), %ebx
+	#instruction start "347 = proj0 346":
+	#instruction start "348 = proj1 346":
+	#instruction start "349 = load part address of 336 with offset 0":
+	movq %r13, %rdi
+	leaq (%rdi), %rdi
+	movq (%rdi), %r12
+	#instruction start "350 = proj0 349":
+	#instruction start "351 = proj1 349":
+	#instruction start "352 = allocate_call_stack 0":
+	#instruction start "353 = set_reg %rdi 342":
+	#instruction start "354 = set_reg %rsi 345 state: 353":
+	#instruction start "355 = set_reg %rdx 348 state: 354":
+	#instruction start "356 = set_reg %rcx 351 state: 355":
+	#instruction start "357 = set_reg %rax 339 state: 356":
+	#instruction start "358 = call 338":
+	addq $0, %rsp
+	movq -272(%rbp), %rax
+	movq %r12, %rcx
+	movq %rbx, %rdx
+	movq %r15, %rsi
+	movq %r14, %rdi
+	movq -264(%rbp), %r11
+	callq *%r11
+	addq $0, %rsp
+	#instruction start "359 = proj0 358":
+	#instruction start "360 = proj1 358":
+	#Block jump
+	jmp .L29
+.L28:
+	#Block jump elided
+.L29:
+	#instruction start "361 = constant(0)":
+	movl $0, %ebx
+	#instruction start "362 = set_reg %rax 361":
+	#instruction start "363 = phi (region: 322) 320 359":
+	#instruction start "364 = return 322, 362, 363":
+	movq %rbx, %rax
+	#Block return.
+	movq -548(%rbp), %rbx
+	movq -556(%rbp), %r12
+	movq -564(%rbp), %r13
+	movq -572(%rbp), %r14
+	movq -580(%rbp), %r15
+	leave 
+	ret 
+.section .rodata
+.Ls1:
+	.string "Test\000"
+.Ls2:
+	.string "Test %s\000"
+.Ls3:
+	.string "Test2\000"
+.Ls5:
+	.string "{ 1 , 1 }\000"
+.Ls7:
+	.string "strcmp(STR(LIST(1)), \"{ 1 , 1 }\") == 0\000"
+.Ls8:
+	.string "/root/repo/tests/variadic_macros.c\000"
+.Ls9:
+	.string "main"
+.Ls10:
+	.string "{ 1 , 2, 3 , 1 }\000"
+.Ls11:
+	.string "strcmp(STR(LIST(1, 2, 3)), \"{ 1 , 2, 3 , 1 }\") == 0\000"
+.Ls12:
+	.string "sizeof list / sizeof *list == 3 && list[0] == 4 && list[1] == 5 && list[2] == 4\000"
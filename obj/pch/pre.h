@@ -0,0 +1,5 @@
+#include "value.h"
+
+enum { FIRST = __COUNTER__, SECOND = __COUNTER__ };
+#undef VALUE
+#define VALUE 3
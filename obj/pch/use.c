@@ -0,0 +1,10 @@
+#include "pre.h"
+#include "value.h"
+
+int main(void) {
+	// __COUNTER__ continues after the values used in the header.
+	if (FIRST != 0 || SECOND != 1 || __COUNTER__ != 2)
+		return 100;
+
+	return VALUE;
+}
@@ -0,0 +1,23 @@
+# 1 "tests/nested_macros.c"
+# 69 "/usr/include//assert.h"
+extern void __assert_fail (const char *__assertion, const char *__file,
+unsigned int __line, const char *__function) ;
+
+
+
+extern void __assert_perror_fail (int __errnum, const char *__file,
+unsigned int __line, const char *__function) ;
+
+
+
+
+
+extern void __assert (const char *__assertion, const char *__file, int __line) ;
+# 83 "tests/nested_macros.c"
+int main(void) {
+((7 == 7) ? (void) (0) : __assert_fail ("NESTED(7) == 7", "tests/nested_macros.c", 84, __func__));
+((((((1) > (4) ? (1) : (4))) > (((3) > (2) ? (3) : (2))) ? (((1) > (4) ? (1) : (4))) : (((3) > (2) ? (3) : (2)))) == 4) ? (void) (0) : __assert_fail ("MAX(MAX(1, 4), MAX(3, 2)) == 4", "tests/nested_macros.c", 85, __func__));
+
+int i = 0;
+((i++ == 0 && i == 1) ? (void) (0) : __assert_fail ("TWICE(i++) == 0 && i == 1", "tests/nested_macros.c", 88, __func__));
+}
@@ -22,7 +22,7 @@ struct ms_data {
 	int returns_address;
 	struct node *ret_address;
 
-	struct node *rbx_store, *rdi_store, *rsi_store;
+	struct node *rdi_store, *rsi_store;
 };
 
 static int fits_into_reg(struct type *type) {
@@ -91,7 +91,7 @@ static struct evaluated_expression ms_expr_call(struct evaluated_expression *cal
 	}
 
 	struct node *reg_source = NULL;
-	ir_call(callee_var, reg_state, call_stack, REG_RBX, &reg_source);
+	ir_call(callee_var, reg_state, call_stack, REG_R11, &reg_source);
 
 	struct evaluated_expression result;
 	if (ret_in_register) {
@@ -143,7 +143,6 @@ static void ms_expr_function(struct node *func, struct type *function_type, stru
 		abi_data.n_args = n_args;
 	}
 
-	abi_data.rbx_store = ir_get_reg(reg_source, 8, REG_RBX, 0);
 	abi_data.rdi_store = ir_get_reg(reg_source, 8, REG_RDI, 0);
 	abi_data.rsi_store = ir_get_reg(reg_source, 8, REG_RSI, 0);
 
@@ -202,7 +201,6 @@ static void ms_expr_return(struct node *func, struct evaluated_expression *value
 		}
 	}
 
-	*reg_state = ir_set_reg(abi_data->rbx_store, *reg_state, REG_RBX, 0);
 	*reg_state = ir_set_reg(abi_data->rdi_store, *reg_state, REG_RDI, 0);
 	*reg_state = ir_set_reg(abi_data->rsi_store, *reg_state, REG_RSI, 0);
 }
@@ -228,10 +226,10 @@ static void ms_emit_va_start(struct node *result, struct node *func) {
 }
 
 static void ms_emit_va_arg(struct node *address, struct node *va_list, struct type *type) {
-	scalar_to_reg(va_list, REG_RBX); // va_list is a pointer to the actual va_list.
-	asm_ins2("movq", MEM(0, REG_RBX), R8(REG_RAX));
+	scalar_to_reg(va_list, REG_R11); // va_list is a pointer to the actual va_list.
+	asm_ins2("movq", MEM(0, REG_R11), R8(REG_RAX));
 	asm_ins2("leaq", MEM(8, REG_RAX), R8(REG_RDX));
-	asm_ins2("movq", R8(REG_RDX), MEM(0, REG_RBX));
+	asm_ins2("movq", R8(REG_RDX), MEM(0, REG_R11));
 	asm_ins2("movq", MEM(0, REG_RAX), R8(REG_RAX));
 	if (fits_into_reg(type)) {
 		scalar_to_reg(address, REG_RSI);
@@ -278,7 +276,7 @@ void abi_init_microsoft(void) {
 
 	// Initialize the __builtin_va_list typedef.
 	struct symbol_typedef *sym =
-		symbols_add_typedef(sv_from_str("__builtin_va_list"));
+		symbols_add_typedef(atom_intern(sv_from_str("__builtin_va_list")));
 
 	sym->data_type = type_pointer(type_simple(ST_VOID));
 
@@ -292,7 +290,7 @@ void abi_init_mingw_workarounds(void) {
 	// compilation with the mingw libc headers.
 	// It is very annoying that they require va_list to be typedeffed.
 	define_string("_VA_LIST_DEFINED", "1");
-	symbols_add_typedef(sv_from_str("va_list"))->data_type = type_pointer(type_simple(ST_VOID));
+	symbols_add_typedef(atom_intern(sv_from_str("va_list")))->data_type = type_pointer(type_simple(ST_VOID));
 	define_string("_crt_va_start", "__builtin_va_start");
 	define_string("_crt_va_end", "__builtin_va_end");
 	define_string("_crt_va_arg", "__builtin_va_arg");
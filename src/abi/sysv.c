@@ -24,8 +24,6 @@ struct sysv_data {
 
 	int returns_address;
 	struct node *ret_address;
-
-	struct node *rbx_store;
 };
 
 struct reg_info {
@@ -251,7 +249,7 @@ static struct evaluated_expression sysv_expr_call(struct evaluated_expression *c
 		reg_state = ir_set_reg(rax_constant, reg_state, REG_RAX, 0);
 
 	struct node *reg_source = NULL;
-	ir_call(callee_var, reg_state, call_stack, REG_RBX, &reg_source);
+	ir_call(callee_var, reg_state, call_stack, REG_R11, &reg_source);
 
 	for (int i = 0; i < c.ret_regs_size; i++)
 		ret_reg_variables[i] = ir_get_reg(reg_source, c.ret_regs[i].size, c.ret_regs[i].register_idx, c.ret_regs[i].is_sse);
@@ -305,8 +303,6 @@ static void sysv_expr_function(struct node *func, struct type *type, struct symb
 
 	struct call_info c = get_calling_convention(type, n_args, type->children + 1);
 
-	abi_data.rbx_store = ir_get_reg(reg_source, 8, REG_RBX, 0);
-
 	for (int i = 0; i < c.regs_size; i++)
 		reg_variables[i] = ir_get_reg(reg_source, c.regs[i].size, c.regs[i].register_idx, c.regs[i].is_sse);
 	
@@ -369,7 +365,7 @@ static void sysv_expr_return(struct node *func, struct evaluated_expression *val
 	int n_parts = 0;
 
 	if (value->type == EE_VOID)
-		goto unclobber;
+		return;
 
 	classify(value->data_type, &n_parts, classes);
 
@@ -393,9 +389,6 @@ static void sysv_expr_return(struct node *func, struct evaluated_expression *val
 	} else {
 		NOTIMP();
 	}
-
-unclobber:
-	*reg_state = ir_set_reg(abi_data->rbx_store, *reg_state, REG_RBX, 0);
 }
 
 static void sysv_emit_function_preamble(struct node *func) {
@@ -542,7 +535,7 @@ void abi_init_sysv(void) {
 
 	// Initialize the __builtin_va_list typedef.
 	struct symbol_typedef *sym =
-		symbols_add_typedef(sv_from_str("__builtin_va_list"));
+		symbols_add_typedef(atom_intern(sv_from_str("__builtin_va_list")));
 
 	struct type *uint = type_simple(ST_UINT);
 	struct type *vptr = type_pointer(type_simple(ST_VOID));
@@ -0,0 +1,104 @@
+#include "arena.h"
+
+#include "common.h"
+
+#include <string.h>
+
+#define ARENA_ALIGNMENT 16
+#define ARENA_CHUNK_SIZE (64 * 1024)
+
+struct arena_chunk {
+	struct arena_chunk *prev;
+	size_t size, top;
+	void *last; // Last allocation, can be grown in place.
+	unsigned char data[];
+};
+
+static struct arena *registered_arenas;
+
+static size_t align_size(size_t size) {
+	return (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+}
+
+static void register_arena(struct arena *arena) {
+	if (arena->is_registered)
+		return;
+
+	arena->is_registered = 1;
+	arena->next_registered = registered_arenas;
+	registered_arenas = arena;
+}
+
+static void new_chunk(struct arena *arena, size_t min_size) {
+	size_t size = MAX(min_size, ARENA_CHUNK_SIZE);
+	struct arena_chunk *chunk = cc_malloc(sizeof *chunk + size);
+
+	chunk->prev = arena->chunk;
+	chunk->size = size;
+	chunk->top = 0;
+	chunk->last = NULL;
+	arena->chunk = chunk;
+
+	register_arena(arena);
+}
+
+void *arena_alloc(struct arena *arena, size_t size) {
+	size = align_size(size);
+
+	if (!arena->chunk || arena->chunk->top + size > arena->chunk->size)
+		new_chunk(arena, size);
+
+	struct arena_chunk *chunk = arena->chunk;
+	void *ret = chunk->data + chunk->top;
+	chunk->top += size;
+	chunk->last = ret;
+
+	arena->used += size;
+	arena->peak = MAX(arena->peak, arena->used);
+
+	return ret;
+}
+
+void *arena_grow(struct arena *arena, void *ptr, size_t old_size, size_t new_size) {
+	if (!ptr)
+		return arena_alloc(arena, new_size);
+
+	struct arena_chunk *chunk = arena->chunk;
+	old_size = align_size(old_size);
+	new_size = align_size(new_size);
+
+	if (ptr == chunk->last && chunk->top - old_size + new_size <= chunk->size) {
+		chunk->top += new_size - old_size;
+		arena->used += new_size - old_size;
+		arena->peak = MAX(arena->peak, arena->used);
+		return ptr;
+	}
+
+	void *ret = arena_alloc(arena, new_size);
+	memcpy(ret, ptr, old_size);
+	return ret;
+}
+
+void arena_free(struct arena *arena) {
+	struct arena_chunk *chunk = arena->chunk;
+	while (chunk) {
+		struct arena_chunk *prev = chunk->prev;
+		free(chunk);
+		chunk = prev;
+	}
+
+	arena->chunk = NULL;
+	arena->used = 0;
+}
+
+void arena_track(struct arena *arena, size_t old_size, size_t new_size) {
+	register_arena(arena);
+
+	arena->used += new_size - old_size;
+	arena->peak = MAX(arena->peak, arena->used);
+}
+
+void arena_report(FILE *fp) {
+	for (struct arena *arena = registered_arenas; arena; arena = arena->next_registered)
+		fprintf(fp, "%-16s %10zu bytes peak\n", arena->name, arena->peak);
+}
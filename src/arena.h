@@ -0,0 +1,44 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+// Bump-pointer allocator. Everything allocated in an arena
+// is released at once with arena_free.
+struct arena {
+	const char *name;
+
+	struct arena_chunk *chunk;
+	size_t used, peak; // Bytes handed out, for -fmem-report.
+
+	struct arena *next_registered;
+	int is_registered;
+};
+
+#define ARENA(NAME) { .name = (NAME) }
+
+void *arena_alloc(struct arena *arena, size_t size);
+
+// Grow an allocation from old_size to new_size bytes.
+// The last allocation of an arena is grown in place if possible.
+void *arena_grow(struct arena *arena, void *ptr, size_t old_size, size_t new_size);
+
+void arena_free(struct arena *arena);
+
+// Count heap memory that belongs with ARENA but is allocated outside of
+// it towards its usage, when it grows from old_size to new_size bytes.
+// Used for memory that has to be freed piecewise.
+void arena_track(struct arena *arena, size_t old_size, size_t new_size);
+
+// Print peak usage of all arenas that have been used.
+void arena_report(FILE *fp);
+
+// Same as ALLOC, but the copy is allocated in ARENA.
+#define ARENA_ALLOC(ARENA, ...) memcpy(arena_alloc((ARENA), sizeof (__VA_ARGS__)), &(__VA_ARGS__), sizeof (__VA_ARGS__))
+
+// Same as ADD_ELEMENT, but the array is allocated in ARENA.
+#define ARENA_ADD_ELEMENT(ARENA, SIZE, CAP, PTR) (*((void)((SIZE) >= (CAP) ? (PTR = arena_grow((ARENA), PTR, sizeof *PTR * (CAP), sizeof *PTR * MAX((CAP) * 2, 1)), CAP = MAX((CAP) * 2, 1)) : 0), PTR + (SIZE)++))
+
+#endif
@@ -38,6 +38,8 @@ struct arguments arguments_parse(int argc, char **argv) {
 		S_FLAG,
 		S_OUTFILE,
 		S_OPTLEVEL,
+		S_JOBS,
+		S_LANGUAGE,
 
 		S_MT, S_MF
 	} state = S_OPERAND;
@@ -103,6 +105,8 @@ struct arguments arguments_parse(int argc, char **argv) {
 				case 'L': next_state = S_LIBRARY_DIR; break;
 				case 'l': next_state = S_LIBRARY; break;
 				case 'f': next_state = S_FLAG; break;
+				case 'j': next_state = S_JOBS; break;
+				case 'x': next_state = S_LANGUAGE; break;
 				}
 
 				arg++;
@@ -137,6 +141,10 @@ struct arguments arguments_parse(int argc, char **argv) {
 			ret.mf_path = arg;
 		} else if (state == S_OPTLEVEL) {
 			ret.optlevel = atoi(arg);
+		} else if (state == S_JOBS) {
+			ret.jobs = atoi(arg);
+		} else if (state == S_LANGUAGE) {
+			ret.language = arg;
 		}
 
 		state = next_state;
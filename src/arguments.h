@@ -4,8 +4,10 @@
 struct arguments {
 	int flag_c, flag_g, flag_s, flag_E, flag_S, flag_MD;
 	int optlevel;
+	int jobs;
 
 	const char *outfile;
+	const char *language; // Set by -x.
 
 	int n_operand;
 	const char **operands;
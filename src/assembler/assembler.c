@@ -11,8 +11,8 @@
 
 #include <stdarg.h>
 
-// TODO: Handle short jumps differently.
-// Right now all jumps are treated as 32 bit offsets.
+// Jumps are assembled with 32 bit offsets, and are shortened
+// to 8 bit offsets by the object writer when possible.
 
 static int assemble_to_text = 0;
 
@@ -172,6 +172,14 @@ static void asm_emit_operand(struct operand op) {
 	}
 }
 
+static int is_jump_rel32(uint8_t *output, int len, struct relocation *relocations, int n_relocations) {
+	if (n_relocations != 1 || !relocations[0].relative)
+		return 0;
+
+	return (len == 5 && output[0] == 0xe9) ||
+		(len == 6 && output[0] == 0x0f && (output[1] & 0xf0) == 0x80);
+}
+
 static void asm_ins_impl(const char *mnemonic, struct operand ops[4]) {
 	if (!assemble_to_text) {
 		// Swap order of instructions.
@@ -198,6 +206,11 @@ static void asm_ins_impl(const char *mnemonic, struct operand ops[4]) {
 			ICE("Assembler error.");
 		}
 
+		if (is_jump_rel32(output, len, relocations, n_relocations)) {
+			object_write_jump(output, len, relocations[0].label);
+			return;
+		}
+
 		for (int i = 0; i < n_relocations; i++) {
 			struct relocation *rel = relocations + i;
 
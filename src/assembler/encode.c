@@ -239,16 +239,14 @@ static void assemble_encoding(uint8_t *output, int *len, struct encoding *encodi
 				modrm_mod = 3;
 
 				modrm_rm = register_index(o->reg.reg);
-				if (has_rex)
-					rex_b = (modrm_rm & 0x8) >> 3;
+				rex_b = (modrm_rm & 0x8) >> 3;
 				break;
 
 			case OPERAND_SSE_REG:
 				modrm_mod = 3;
 
 				modrm_rm = o->sse_reg;
-				if (has_rex)
-					rex_b = (modrm_rm & 0x8) >> 3;
+				rex_b = (modrm_rm & 0x8) >> 3;
 				break;
 
 			case OPERAND_MEM: {
@@ -283,7 +281,8 @@ static void assemble_encoding(uint8_t *output, int *len, struct encoding *encodi
 			break;
 
 		case OE_OPEXT:
-			op_ext = register_index(o->reg.reg);
+			op_ext = register_index(o->reg.reg) & 0x7;
+			rex_b = (register_index(o->reg.reg) & 0x8) >> 3;
 			break;
 
 		case OE_NONE:
@@ -569,17 +568,111 @@ static int does_match(struct operand *o, struct operand_accepts *oa) {
 	return 1;
 }
 
+#define N_ENCODINGS (int)(sizeof encodings / sizeof *encodings)
+#define MNEMONIC_TABLE_SIZE 256
+
+// Encodings grouped by mnemonic. Each group is sorted by the minimum
+// length of the encoding. Operands can only add bytes (REX, SIB,
+// displacement) on top of the minimum, so the search can stop as soon as
+// the next candidate can not be shorter than the best one found.
+static struct mnemonic_entry {
+	const char *mnemonic;
+	int n, cap;
+	int *encodings;
+} mnemonic_table[MNEMONIC_TABLE_SIZE];
+
+static int encoding_min_len[N_ENCODINGS];
+
+static int minimum_length(struct encoding *encoding) {
+	int len = 1;
+
+	len += encoding->op_size_prefix + encoding->repne_prefix + encoding->repe_prefix;
+
+	if (encoding->rex || encoding->rexw)
+		len++;
+
+	if (encoding->opcode == 0x0f) {
+		len++;
+		if (encoding->op2 == 0x38 || encoding->op2 == 0x3a)
+			len++;
+	}
+
+	int has_modrm = 0, has_rel32 = 0;
+	int has_imm8 = 0, has_imm16 = 0, has_imm32 = 0, has_imm64 = 0;
+	for (int i = 0; i < 4; i++) {
+		switch (encoding->operand_encoding[i].type) {
+		case OE_MODRM_RM: has_modrm = 1; break;
+		case OE_IMM8: has_imm8 = 1; break;
+		case OE_IMM16: has_imm16 = 1; break;
+		case OE_IMM32: has_imm32 = 1; break;
+		case OE_IMM64: has_imm64 = 1; break;
+		case OE_REL32: has_rel32 = 1; break;
+		default: break;
+		}
+	}
+
+	// Only one immediate is written, see assemble_encoding.
+	if (has_imm8)
+		len += 1;
+	else if (has_imm16)
+		len += 2;
+	else if (has_imm32)
+		len += 4;
+	else if (has_imm64)
+		len += 8;
+
+	return len + has_modrm + has_rel32 * 4;
+}
+
+static struct mnemonic_entry *mnemonic_lookup(const char *mnemonic) {
+	uint32_t idx = sv_hash(sv_from_str((char *)mnemonic)) % MNEMONIC_TABLE_SIZE;
+
+	while (mnemonic_table[idx].mnemonic &&
+		   strcmp(mnemonic_table[idx].mnemonic, mnemonic) != 0)
+		idx = (idx + 1) % MNEMONIC_TABLE_SIZE;
+
+	return mnemonic_table + idx;
+}
+
+// Lookups probe until they reach an empty slot, so the table must never
+// fill up. Keeping it at most half full also keeps the probes short.
+static void build_mnemonic_table(void) {
+	int n_mnemonics = 0;
+	for (int i = 0; i < N_ENCODINGS; i++) {
+		struct mnemonic_entry *entry = mnemonic_lookup(encodings[i].mnemonic);
+		if (!entry->mnemonic && ++n_mnemonics * 2 > MNEMONIC_TABLE_SIZE)
+			ICE("More than %d mnemonics, increase MNEMONIC_TABLE_SIZE.", MNEMONIC_TABLE_SIZE / 2);
+		entry->mnemonic = encodings[i].mnemonic;
+		encoding_min_len[i] = minimum_length(encodings + i);
+
+		// Insertion sort, keeps the table order for encodings of equal length.
+		ADD_ELEMENT(entry->n, entry->cap, entry->encodings) = i;
+		for (int j = entry->n - 1; j > 0 &&
+				 encoding_min_len[entry->encodings[j - 1]] > encoding_min_len[i]; j--) {
+			entry->encodings[j] = entry->encodings[j - 1];
+			entry->encodings[j - 1] = i;
+		}
+	}
+}
+
 void assemble_instruction(uint8_t *output, int *len, const char *mnemonic, struct operand ops[4],
 						  struct relocation relocations[], int *n_relocations) {
+	static int table_built = 0;
+	if (!table_built) {
+		build_mnemonic_table();
+		table_built = 1;
+	}
+
 	int best_len = 16;
 	uint8_t best_output[15] = { 0 };
 
-	// TODO: Just order the instructions in such a way that we can just take the first one that appears.
-	for (unsigned i = 0; i < sizeof encodings / sizeof *encodings; i++) {
-		struct encoding *encoding = encodings + i;
+	struct mnemonic_entry *entry = mnemonic_lookup(mnemonic);
 
-		if (strcmp(encoding->mnemonic, mnemonic) != 0)
-			continue;
+	for (int i = 0; i < entry->n; i++) {
+		struct encoding *encoding = encodings + entry->encodings[i];
+
+		if (encoding_min_len[entry->encodings[i]] >= best_len)
+			break;
 
 		int matches = 1;
 		for (int j = 0; j < 4; j++) {
@@ -0,0 +1,75 @@
+#include "atom.h"
+
+#include "common.h"
+#include "arena.h"
+
+#include <string.h>
+
+static struct arena atom_arena = ARENA("atoms");
+
+static struct atom_entry {
+	struct string_view str;
+	uint32_t hash;
+} *atoms;
+static size_t atoms_size, atoms_cap;
+
+// Open addressing with linear probing, the slots hold atoms.
+// Atom 0 is never stored, so it marks empty slots.
+static atom *table;
+static size_t table_cap;
+
+static atom *find_slot(struct string_view str, uint32_t hash) {
+	size_t idx = hash & (table_cap - 1);
+
+	while (table[idx] && (atoms[table[idx]].hash != hash ||
+						  !sv_cmp(atoms[table[idx]].str, str)))
+		idx = (idx + 1) & (table_cap - 1);
+
+	return table + idx;
+}
+
+static void resize(size_t cap) {
+	free(table);
+	table_cap = cap;
+	table = cc_malloc(sizeof *table * table_cap);
+	memset(table, 0, sizeof *table * table_cap);
+
+	for (size_t i = 1; i < atoms_size; i++)
+		*find_slot(atoms[i].str, atoms[i].hash) = i;
+}
+
+atom atom_intern(struct string_view str) {
+	if (str.len == 0)
+		return 0;
+
+	if (!atoms_size)
+		ADD_ELEMENT(atoms_size, atoms_cap, atoms) = (struct atom_entry) { 0 };
+
+	if (atoms_size * 2 >= table_cap)
+		resize(MAX(table_cap * 2, 1024));
+
+	uint32_t hash = sv_hash(str);
+	atom *slot = find_slot(str, hash);
+
+	if (*slot)
+		return *slot;
+
+	char *copy = arena_alloc(&atom_arena, str.len);
+	memcpy(copy, str.str, str.len);
+
+	*slot = atoms_size;
+	ADD_ELEMENT(atoms_size, atoms_cap, atoms) = (struct atom_entry) {
+		.str = { .len = str.len, .str = copy },
+		.hash = hash,
+	};
+
+	return *slot;
+}
+
+struct string_view atom_str(atom a) {
+	return a ? atoms[a].str : (struct string_view) { 0 };
+}
+
+uint32_t atom_hash(atom a) {
+	return a ? atoms[a].hash : sv_hash((struct string_view) { 0 });
+}
@@ -0,0 +1,17 @@
+#ifndef ATOM_H
+#define ATOM_H
+
+#include "string_view.h"
+
+#include <stdint.h>
+
+// Interned strings. Equal strings get the same atom, so they can be compared
+// as integers, and their hash is only computed once.
+// Atoms are kept for the whole run. The empty string is always atom 0.
+typedef int atom;
+
+atom atom_intern(struct string_view str);
+struct string_view atom_str(atom a);
+uint32_t atom_hash(atom a);
+
+#endif
@@ -2,6 +2,7 @@
 #include "assembler/assembler.h"
 #include "ir/ir.h"
 #include "registers.h"
+#include "linear_scan.h"
 #include "binary_operators.h"
 
 #include <common.h>
@@ -15,7 +16,8 @@
 
 struct codegen_flags codegen_flags = {
 	.code_model = CODE_MODEL_SMALL,
-	.debug_stack_size = 0
+	.debug_stack_size = 0,
+	.register_allocation = 1
 };
 
 struct vla_info {
@@ -29,6 +31,12 @@ struct rbp_save_info {
 	int offset;
 } rbp_save_info;
 
+struct callee_saved_info {
+	int size;
+	int registers[MAX_ALLOCATABLE_REGISTERS];
+	int offsets[MAX_ALLOCATABLE_REGISTERS];
+} callee_saved_info;
+
 static void codegen_call(struct node *variable, int non_clobbered_register) {
 	scalar_to_reg(variable, non_clobbered_register);
 	asm_ins1("callq", R8S(non_clobbered_register));
@@ -134,10 +142,34 @@ static void codegen_constant_to_rdi(struct constant *constant) {
 	}
 }
 
+static void codegen_constant_to_reg(struct constant *constant, int size, int reg) {
+	if (constant->type == CONSTANT_LABEL_POINTER) {
+		if (codegen_flags.code_model == CODE_MODEL_LARGE) {
+			asm_ins2("movabsq", IMML(constant->label.label, constant->label.offset), R8(reg));
+		} else if (codegen_flags.code_model == CODE_MODEL_SMALL) {
+			asm_ins2("movq", IMML(constant->label.label, constant->label.offset), R8(reg));
+		}
+		return;
+	}
+
+	uint64_t value = constant_to_u64(*constant);
+	if (size < 8) {
+		value &= ((uint64_t)1 << (size * 8)) - 1;
+		asm_ins2("movl", IMM(value), R4(reg));
+	} else if ((int64_t)value >= INT32_MIN && (int64_t)value <= INT32_MAX) {
+		asm_ins2("movq", IMM(value), R8(reg));
+	} else {
+		asm_ins2("movabsq", IMM(value), R8(reg));
+	}
+}
+
 static void codegen_set_reg_chain(struct node *start) {
 	while (start) {
-		if (start->set_reg.is_sse) {
-			asm_ins2("movsd", MEM(-start->arguments[0]->cg_info.stack_location, REG_RBP),
+		struct node *variable = start->arguments[0];
+		if (start->set_reg.is_sse && variable->cg_info.storage == VAR_STOR_REGISTER) {
+			asm_ins2("movq", R8(variable->cg_info.reg), XMM(start->set_reg.register_index));
+		} else if (start->set_reg.is_sse) {
+			asm_ins2("movsd", MEM(-variable->cg_info.stack_location, REG_RBP),
 					 XMM(start->set_reg.register_index));
 		} else {
 			scalar_to_reg(start->arguments[0], start->set_reg.register_index);
@@ -161,9 +193,7 @@ static int codegen_call_stack_chain(struct node *start) {
 	while (ins->type != IR_ALLOCATE_CALL_STACK) {
 		if (ins->type == IR_STORE_STACK_RELATIVE) {
 			asm_ins2("leaq", MEM(ins->store_stack_relative.offset, REG_RSP), R8(REG_RSI));
-			asm_ins2("leaq", MEM(-ins->arguments[0]->cg_info.stack_location, REG_RBP), R8(REG_RDI));
-
-			codegen_memcpy(ins->arguments[0]->size);
+			scalar_to_memory(ins->arguments[0]);
 		} else if (ins->type == IR_STORE_STACK_RELATIVE_ADDRESS) {
 			asm_ins2("leaq", MEM(ins->store_stack_relative_address.offset, REG_RSP), R8(REG_RSI));
 			scalar_to_reg(ins->arguments[0], REG_RDI);
@@ -184,7 +214,12 @@ static void codegen_get_reg_uses(struct node *reg_source) {
 		if (ins->type != IR_GET_REG || ins->block == NULL)
 			continue;
 
-		if (ins->get_reg.is_sse) {
+		if (ins->get_reg.is_sse && ins->cg_info.storage == VAR_STOR_REGISTER) {
+			if (ins->size == 4)
+				asm_ins2("movd", XMM(ins->get_reg.register_index), R4(ins->cg_info.reg));
+			else
+				asm_ins2("movq", XMM(ins->get_reg.register_index), R8(ins->cg_info.reg));
+		} else if (ins->get_reg.is_sse) {
 			if (ins->size == 4) {
 				asm_ins2("movss", XMM(ins->get_reg.register_index),
 						 MEM(-ins->cg_info.stack_location, REG_RBP));
@@ -228,8 +263,12 @@ static void codegen_instruction(struct node *ins, struct node *func) {
 
 	switch (ins->type) {
 	case IR_CONSTANT:
-		asm_ins2("leaq", MEM(-ins->cg_info.stack_location, REG_RBP), R8(REG_RDI));
-		codegen_constant_to_rdi(&ins->constant.constant);
+		if (ins->cg_info.storage == VAR_STOR_REGISTER) {
+			codegen_constant_to_reg(&ins->constant.constant, ins->size, ins->cg_info.reg);
+		} else {
+			asm_ins2("leaq", MEM(-ins->cg_info.stack_location, REG_RBP), R8(REG_RDI));
+			codegen_constant_to_rdi(&ins->constant.constant);
+		}
 		break;
 
 	case IR_BINARY_NOT:
@@ -266,44 +305,31 @@ static void codegen_instruction(struct node *ins, struct node *func) {
 			codegen_get_reg_uses(reg_source);
 	} break;
 
-	case IR_LOAD: {
-		struct node *value = ins;
+	case IR_LOAD:
 		scalar_to_reg(ins->arguments[0], REG_RDI);
-		asm_ins2("leaq", MEM(-value->cg_info.stack_location, REG_RBP), R8(REG_RSI));
-
-		codegen_memcpy(value->size);
-	} break;
+		memory_to_scalar(ins);
+		break;
 
-	case IR_LOAD_VOLATILE: {
-		struct node *value = ins->projects[1];
+	case IR_LOAD_VOLATILE:
 		scalar_to_reg(ins->arguments[0], REG_RDI);
-		asm_ins2("leaq", MEM(-value->cg_info.stack_location, REG_RBP), R8(REG_RSI));
-
-		codegen_memcpy(value->size);
-	} break;
+		memory_to_scalar(ins->projects[1]);
+		break;
 
-	case IR_LOAD_PART_ADDRESS: {
-		struct node *value = ins->projects[1];
+	case IR_LOAD_PART_ADDRESS:
 		scalar_to_reg(ins->arguments[0], REG_RDI);
 		asm_ins2("leaq", MEM(ins->load_part.offset, REG_RDI), R8(REG_RDI));
-		asm_ins2("leaq", MEM(-value->cg_info.stack_location, REG_RBP), R8(REG_RSI));
-
-		codegen_memcpy(value->size);
-	} break;
+		memory_to_scalar(ins->projects[1]);
+		break;
 
 	case IR_STORE:
 		scalar_to_reg(ins->arguments[0], REG_RSI);
-		asm_ins2("leaq", MEM(-ins->arguments[1]->cg_info.stack_location, REG_RBP), R8(REG_RDI));
-
-		codegen_memcpy(ins->arguments[1]->size);
+		scalar_to_memory(ins->arguments[1]);
 		break;
 
 	case IR_STORE_PART_ADDRESS:
 		scalar_to_reg(ins->arguments[0], REG_RSI);
 		asm_ins2("leaq", MEM(+ins->store_part.offset, REG_RSI), R8(REG_RSI));
-		asm_ins2("leaq", MEM(-ins->arguments[1]->cg_info.stack_location, REG_RBP), R8(REG_RDI));
-
-		codegen_memcpy(ins->arguments[1]->size);
+		scalar_to_memory(ins->arguments[1]);
 		break;
 
 	case IR_INT_CAST_ZERO:
@@ -474,9 +500,7 @@ static void codegen_instruction(struct node *ins, struct node *func) {
 
 	case IR_LOAD_BASE_RELATIVE:
 		asm_ins2("leaq", MEM(ins->load_base_relative.offset, REG_RBP), R8(REG_RDI));
-		asm_ins2("leaq", MEM(-ins->cg_info.stack_location, REG_RBP), R8(REG_RSI));
-
-		codegen_memcpy(ins->size);
+		memory_to_scalar(ins);
 		break;
 
 	case IR_LOAD_BASE_RELATIVE_ADDRESS:
@@ -552,6 +576,8 @@ static void codegen_block(struct node *block, struct node *func) {
 	} else if (end->type == IR_RETURN) {
 		codegen_set_reg_chain(end->arguments[1]);
 		asm_comment("Block return.");
+		for (int i = 0; i < callee_saved_info.size; i++)
+			asm_ins2("movq", MEM(-callee_saved_info.offsets[i], REG_RBP), R8(callee_saved_info.registers[i]));
 		if (rbp_save_info.has_saved_rsp) {
 			asm_ins2("movq", MEM(-rbp_save_info.offset, REG_RBP), R8(REG_RBP));
 		}
@@ -569,8 +595,15 @@ static void codegen_block(struct node *block, struct node *func) {
 		struct node *cond = end->arguments[1];
 		scalar_to_reg(cond, REG_RDI);
 		asm_ins2("testq", R8(REG_RDI), R8(REG_RDI));
-		asm_ins1("je", IMML_ABS(end->if_info.block_false->block_info.label, 0));
-		asm_ins1("jmp", IMML_ABS(end->if_info.block_true->block_info.label, 0));
+		struct node *block_true = end->if_info.block_true, *block_false = end->if_info.block_false;
+		if (block_true == block->next) {
+			asm_ins1("je", IMML_ABS(block_false->block_info.label, 0));
+		} else if (block_false == block->next) {
+			asm_ins1("jne", IMML_ABS(block_true->block_info.label, 0));
+		} else {
+			asm_ins1("je", IMML_ABS(block_false->block_info.label, 0));
+			asm_ins1("jmp", IMML_ABS(block_true->block_info.label, 0));
+		}
 	} else {
 		printf("Ending node on %d %d\n", end->type, IR_IF);
 		NOTIMP();
@@ -586,12 +619,16 @@ static void codegen_function(struct node *func) {
 		block->block_info.label = register_label();
 	}
 
+	callee_saved_info.size = 0;
+	if (codegen_flags.register_allocation)
+		callee_saved_info.size = linear_scan_allocate(func, callee_saved_info.registers);
+
 	// Allocate variables that spans multiple blocks.
 	for (struct node *block = func->child; block; block = block->next) {
 		for (struct node *ins = block->child; ins; ins = ins->next) {
 			/* if (!ins->spans_block || ins->size == 0) */
 			/* 	continue; */
-			if (ins->size == 0)
+			if (ins->size == 0 || ins->cg_info.storage == VAR_STOR_REGISTER)
 				continue;
 			
 			perm_stack_count += ins->size;
@@ -639,6 +676,11 @@ static void codegen_function(struct node *func) {
 		vla_info.alloc_preamble = perm_stack_count;
 	}
 
+	for (int i = 0; i < callee_saved_info.size; i++) {
+		perm_stack_count += 8;
+		callee_saved_info.offsets[i] = perm_stack_count;
+	}
+
 	// Allocate variables that are local to one block.
 	for (struct node *block = func->child; block; block = block->next) {
 		for (struct node *ins = block->child; ins; ins = ins->next) {
@@ -682,6 +724,9 @@ static void codegen_function(struct node *func) {
 	if (stack_sub)
 		asm_ins2("subq", IMM(stack_sub), R8(REG_RSP));
 
+	for (int i = 0; i < callee_saved_info.size; i++)
+		asm_ins2("movq", R8(callee_saved_info.registers[i]), MEM(-callee_saved_info.offsets[i], REG_RBP));
+
 	abi_emit_function_preamble(func);
 
 	for (int i = 0; i < vla_info.count; i++)
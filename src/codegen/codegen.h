@@ -12,6 +12,7 @@ extern struct codegen_flags {
 	enum code_model code_model;
 	int debug_stack_size;
 	int debug_stack_min;
+	int register_allocation;
 } codegen_flags;
 
 void codegen(void);
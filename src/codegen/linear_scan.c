@@ -0,0 +1,431 @@
+#include "linear_scan.h"
+
+#include <common.h>
+#include <arena.h>
+#include <types.h>
+#include <assembler/assembler.h>
+
+#include <string.h>
+#include <limits.h>
+
+// Algorithm taken from "Linear Scan Register Allocation" by Poletto and Sarkar.
+// Intervals are built over the block order given by ir_schedule_blocks,
+// and the instruction order given by ir_local_schedule. An interval either
+// gets a register for its whole lifetime, or stays on the stack.
+
+// Only callee-saved registers are handed out, codegen uses the
+// caller-saved registers as scratch, and calls won't clobber these.
+static const int allocatable_registers[MAX_ALLOCATABLE_REGISTERS] = {
+	REG_RBX, REG_R12, REG_R13, REG_R14, REG_R15
+};
+
+struct interval {
+	struct node *node;
+	int start, end;
+	uint64_t cost, weight;
+	int reg;
+};
+
+struct block_liveness {
+	struct node *block;
+	int start, end, depth;
+	uint64_t *use, *def, *live_in, *live_out;
+};
+
+// Everything below is rebuilt for each function.
+static struct arena scan_arena = ARENA("register-alloc");
+
+static size_t interval_size, interval_cap;
+static struct interval *intervals;
+
+static size_t block_size, block_cap;
+static struct block_liveness *blocks;
+
+static size_t set_words;
+
+static int can_be_register(struct node *node) {
+	if (node->size != 1 && node->size != 2 &&
+		node->size != 4 && node->size != 8)
+		return 0;
+
+	switch (node->type) {
+	case IR_SET_REG:
+		return 0;
+
+	case IR_CONSTANT: {
+		struct constant *c = &node->constant.constant;
+		if (c->type == CONSTANT_LABEL_POINTER)
+			return 1;
+		return c->type == CONSTANT_TYPE &&
+			(c->data_type->type == TY_SIMPLE || type_is_pointer(c->data_type));
+	}
+
+	default:
+		return 1;
+	}
+}
+
+static int block_index(struct node *block) {
+	return block_size - 1 - block->block_info.post_idx;
+}
+
+static int get_successors(struct node *block, struct node *successors[2]) {
+	struct node *end = block->block_info.end;
+
+	if (!end || end->type == IR_DEAD || end->type == IR_RETURN)
+		return 0;
+
+	if (end->type == IR_IF) {
+		successors[0] = end->if_info.block_true;
+		successors[1] = end->if_info.block_false;
+		return 2;
+	}
+
+	successors[0] = end;
+	return 1;
+}
+
+static void set_bit(uint64_t *set, int idx) {
+	set[idx / 64] |= (uint64_t)1 << (idx % 64);
+}
+
+static void extend(struct interval *interval, int position) {
+	interval->start = MIN(interval->start, position);
+	interval->end = MAX(interval->end, position);
+}
+
+// Register a read or write of node. set is either the use or def set of
+// the block, or NULL if the point only extends the interval.
+static void add_point(struct node *node, int block, int position, uint64_t *set) {
+	if (!node || node->size == 0 || node->cg_info.storage != VAR_STOR_STACK ||
+		node->cg_info.interval < 0)
+		return;
+
+	struct interval *interval = intervals + node->cg_info.interval;
+	extend(interval, position);
+
+	uint64_t cost = 1;
+	for (int i = 0; i < MIN(blocks[block].depth, 5); i++)
+		cost *= 10;
+	interval->cost += cost;
+
+	if (set)
+		set_bit(set, node->cg_info.interval);
+}
+
+static void add_instruction_uses(struct node *ins, int block, int position) {
+	uint64_t *use = blocks[block].use;
+
+	switch (ins->type) {
+	case IR_CALL:
+		add_point(ins->arguments[0], block, position, use);
+		for (struct node *reg = ins->arguments[2]; reg; reg = reg->arguments[1])
+			add_point(reg->arguments[0], block, position, use);
+		for (struct node *stack = ins->arguments[3]; stack->type != IR_ALLOCATE_CALL_STACK;
+			 stack = stack->arguments[1])
+			add_point(stack->arguments[0], block, position, use);
+		break;
+
+	// These are read at the call or at the end of the block.
+	case IR_PHI:
+	case IR_SET_REG:
+	case IR_GET_REG:
+	case IR_PROJECT:
+	case IR_ALLOCATE_CALL_STACK:
+	case IR_STORE_STACK_RELATIVE:
+	case IR_STORE_STACK_RELATIVE_ADDRESS:
+	case IR_IF:
+	case IR_RETURN:
+		break;
+
+	default:
+		for (int i = 0; i < IR_MAX; i++)
+			add_point(ins->arguments[i], block, position, use);
+	}
+}
+
+static void add_get_reg_definitions(struct node *reg_source, int block, int position) {
+	if (!reg_source)
+		return;
+
+	for (unsigned i = 0; i < reg_source->use_size; i++) {
+		struct node *get_reg = reg_source->uses[i];
+		if (get_reg->type == IR_GET_REG && get_reg->block)
+			add_point(get_reg, block, position, blocks[block].def);
+	}
+}
+
+static void add_instruction_definitions(struct node *ins, int block, int position) {
+	uint64_t *def = blocks[block].def;
+
+	switch (ins->type) {
+	case IR_CALL:
+		add_get_reg_definitions(ins->projects[1], block, position);
+		break;
+
+	case IR_DIV:
+	case IR_IDIV:
+	case IR_MOD:
+	case IR_IMOD:
+		add_point(ins->projects[0], block, position, def);
+		break;
+
+	case IR_LOAD_VOLATILE:
+	case IR_LOAD_PART_ADDRESS:
+		add_point(ins->projects[1], block, position, def);
+		break;
+
+	case IR_PHI:
+		// Written at the end of the predecessors, but live from the start of the block.
+		add_point(ins, block, blocks[block].start, def);
+		break;
+
+	case IR_GET_REG:
+	case IR_PROJECT:
+		break;
+
+	default:
+		add_point(ins, block, position, def);
+	}
+}
+
+static void add_block_end(int block) {
+	struct node *b = blocks[block].block, *end = b->block_info.end;
+	int position = blocks[block].end;
+	uint64_t *use = blocks[block].use;
+
+	if (!end || end->type == IR_DEAD)
+		return;
+
+	if (end->type == IR_RETURN) {
+		for (struct node *reg = end->arguments[1]; reg; reg = reg->arguments[1])
+			add_point(reg->arguments[0], block, position, use);
+	} else if (end->type == IR_IF) {
+		add_point(end->arguments[1], block, position, use);
+	} else if (end->type == IR_REGION) {
+		for (unsigned i = 0; i < end->use_size; i++) {
+			struct node *phi = end->uses[i];
+
+			if (phi->type != IR_PHI || phi->size == 0)
+				continue;
+
+			struct node *source = NULL;
+			if (b == end->arguments[0])
+				source = phi->arguments[1];
+			else if (b == end->arguments[1])
+				source = phi->arguments[2];
+
+			if (!source)
+				continue;
+
+			// All copies happen at the same position, so the
+			// phi nodes and their sources will not share registers.
+			add_point(source, block, position, use);
+			add_point(phi, block, position, NULL);
+		}
+	}
+}
+
+static void calculate_loop_depth(void) {
+	for (unsigned i = 0; i < block_size; i++) {
+		struct node *successors[2];
+		int n = get_successors(blocks[i].block, successors);
+
+		for (int j = 0; j < n; j++) {
+			unsigned header = block_index(successors[j]);
+			if (header > i)
+				continue;
+
+			// Back edge, everything in between is approximated to be in the loop.
+			for (unsigned k = header; k <= i; k++)
+				blocks[k].depth++;
+		}
+	}
+}
+
+static void calculate_liveness(void) {
+	int changed = 1;
+	while (changed) {
+		changed = 0;
+
+		for (int i = block_size - 1; i >= 0; i--) {
+			struct block_liveness *b = blocks + i;
+			struct node *successors[2];
+			int n = get_successors(b->block, successors);
+
+			for (int j = 0; j < n; j++) {
+				uint64_t *live_in = blocks[block_index(successors[j])].live_in;
+				for (size_t k = 0; k < set_words; k++)
+					b->live_out[k] |= live_in[k];
+			}
+
+			for (size_t k = 0; k < set_words; k++) {
+				uint64_t live_in = (b->use[k] | b->live_out[k]) & ~b->def[k];
+				if (live_in != b->live_in[k]) {
+					b->live_in[k] = live_in;
+					changed = 1;
+				}
+			}
+		}
+	}
+
+	for (unsigned i = 0; i < block_size; i++) {
+		struct block_liveness *b = blocks + i;
+		for (size_t k = 0; k < set_words; k++) {
+			if (!(b->live_in[k] | b->live_out[k]))
+				continue;
+
+			for (int bit = 0; bit < 64; bit++) {
+				uint64_t mask = (uint64_t)1 << bit;
+				if (b->live_in[k] & mask)
+					extend(intervals + k * 64 + bit, b->start);
+				if (b->live_out[k] & mask)
+					extend(intervals + k * 64 + bit, b->end);
+			}
+		}
+	}
+}
+
+static int compare_intervals(const void *a, const void *b) {
+	const struct interval *ia = a, *ib = b;
+	if (ia->start != ib->start)
+		return ia->start < ib->start ? -1 : 1;
+	return ia->node->index - ib->node->index;
+}
+
+static int allocate_intervals(int used_registers[MAX_ALLOCATABLE_REGISTERS]) {
+	struct interval *active[MAX_ALLOCATABLE_REGISTERS];
+	int n_active = 0;
+	int register_used[MAX_ALLOCATABLE_REGISTERS] = { 0 };
+
+	qsort(intervals, interval_size, sizeof *intervals, compare_intervals);
+
+	for (unsigned i = 0; i < interval_size; i++) {
+		struct interval *current = intervals + i;
+		current->reg = -1;
+		current->weight = current->cost * 1024 / (current->end - current->start + 1);
+
+		for (int j = 0; j < n_active;) {
+			if (active[j]->end < current->start)
+				active[j] = active[--n_active];
+			else
+				j++;
+		}
+
+		if (n_active < MAX_ALLOCATABLE_REGISTERS) {
+			int taken[MAX_ALLOCATABLE_REGISTERS] = { 0 };
+			for (int j = 0; j < n_active; j++)
+				taken[active[j]->reg] = 1;
+
+			int reg = 0;
+			while (taken[reg])
+				reg++;
+
+			current->reg = reg;
+			active[n_active++] = current;
+		} else {
+			// Spill whichever interval is cheapest to keep on the stack.
+			int victim = 0;
+			for (int j = 1; j < n_active; j++) {
+				if (active[j]->weight < active[victim]->weight)
+					victim = j;
+			}
+
+			if (active[victim]->weight >= current->weight)
+				continue;
+
+			current->reg = active[victim]->reg;
+			active[victim]->reg = -1;
+			active[victim] = current;
+		}
+	}
+
+	for (unsigned i = 0; i < interval_size; i++) {
+		struct interval *interval = intervals + i;
+		if (interval->reg == -1)
+			continue;
+
+		interval->node->cg_info.storage = VAR_STOR_REGISTER;
+		interval->node->cg_info.reg = allocatable_registers[interval->reg];
+		register_used[interval->reg] = 1;
+	}
+
+	int n_used = 0;
+	for (int i = 0; i < MAX_ALLOCATABLE_REGISTERS; i++) {
+		if (register_used[i])
+			used_registers[n_used++] = allocatable_registers[i];
+	}
+
+	return n_used;
+}
+
+int linear_scan_allocate(struct node *func, int used_registers[MAX_ALLOCATABLE_REGISTERS]) {
+	arena_free(&scan_arena);
+	interval_size = interval_cap = 0;
+	intervals = NULL;
+	block_size = block_cap = 0;
+	blocks = NULL;
+
+	// Number instructions, and create one interval per candidate.
+	int position = 1;
+	for (struct node *block = func->child; block; block = block->next) {
+		ARENA_ADD_ELEMENT(&scan_arena, block_size, block_cap, blocks) = (struct block_liveness) {
+			.block = block,
+			.start = position++,
+		};
+
+		for (struct node *ins = block->child; ins; ins = ins->next) {
+			int ins_position = position++;
+
+			if (ins->size == 0)
+				continue;
+
+			ins->cg_info.storage = VAR_STOR_STACK;
+			ins->cg_info.interval = -1;
+
+			if (!can_be_register(ins))
+				continue;
+
+			ins->cg_info.interval = interval_size;
+			ARENA_ADD_ELEMENT(&scan_arena, interval_size, interval_cap, intervals) = (struct interval) {
+				.node = ins,
+				.start = ins_position,
+				.end = ins_position,
+			};
+		}
+
+		blocks[block_size - 1].end = position++;
+	}
+
+	if (interval_size == 0)
+		return 0;
+
+	set_words = (interval_size + 63) / 64;
+	uint64_t *sets = arena_alloc(&scan_arena, sizeof *sets * set_words * 4 * block_size);
+	memset(sets, 0, sizeof *sets * set_words * 4 * block_size);
+	for (unsigned i = 0; i < block_size; i++) {
+		blocks[i].use = sets + set_words * (4 * i + 0);
+		blocks[i].def = sets + set_words * (4 * i + 1);
+		blocks[i].live_in = sets + set_words * (4 * i + 2);
+		blocks[i].live_out = sets + set_words * (4 * i + 3);
+	}
+
+	calculate_loop_depth();
+
+	// Arguments are written to their variables before the first block.
+	add_get_reg_definitions(func->projects[1], 0, 0);
+
+	for (unsigned i = 0; i < block_size; i++) {
+		int ins_position = blocks[i].start + 1;
+		for (struct node *ins = blocks[i].block->child; ins; ins = ins->next, ins_position++) {
+			add_instruction_uses(ins, i, ins_position);
+			add_instruction_definitions(ins, i, ins_position);
+		}
+
+		add_block_end(i);
+	}
+
+	calculate_liveness();
+
+	return allocate_intervals(used_registers);
+}
@@ -0,0 +1,13 @@
+#ifndef LINEAR_SCAN_H
+#define LINEAR_SCAN_H
+
+#include <ir/ir.h>
+
+#define MAX_ALLOCATABLE_REGISTERS 5
+
+// Assign callee-saved registers to values in func.
+// Values that don't get a register are left as VAR_STOR_STACK.
+// The registers that need to be saved in the prologue are written to used_registers.
+int linear_scan_allocate(struct node *func, int used_registers[MAX_ALLOCATABLE_REGISTERS]);
+
+#endif
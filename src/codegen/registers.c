@@ -38,9 +38,7 @@ const char *get_reg_name(int id, int size) {
 	return registers[id][size_to_idx(size)];
 }
 
-void scalar_to_reg(struct node *scalar, int reg) {
-	int size = scalar->size;
-	struct operand mem = MEM(-scalar->cg_info.stack_location, REG_RBP);
+static void memory_operand_to_reg(struct operand mem, int size, int reg) {
 	switch (size) {
 	case 1:
 		asm_ins2("movzbl", mem, R4(reg));
@@ -63,8 +61,35 @@ void scalar_to_reg(struct node *scalar, int reg) {
 	}
 }
 
+void scalar_to_reg(struct node *scalar, int reg) {
+	if (scalar->cg_info.storage == VAR_STOR_REGISTER) {
+		if (scalar->cg_info.reg != reg)
+			asm_ins2("movq", R8(scalar->cg_info.reg), R8(reg));
+		return;
+	}
+
+	memory_operand_to_reg(MEM(-scalar->cg_info.stack_location, REG_RBP), scalar->size, reg);
+}
+
 void reg_to_scalar(int reg, struct node *scalar) {
 	int size = scalar->size;
+
+	if (scalar->cg_info.storage == VAR_STOR_REGISTER) {
+		// Registers always hold the value zero extended to 64 bits.
+		int target = scalar->cg_info.reg;
+		switch (size) {
+		case 1: asm_ins2("movzbl", R1(reg), R4(target)); break;
+		case 2: asm_ins2("movzwl", R2(reg), R4(target)); break;
+		case 4: asm_ins2("movl", R4(reg), R4(target)); break;
+		case 8:
+			if (reg != target)
+				asm_ins2("movq", R8(reg), R8(target));
+			break;
+		default: ICE("Invalid register variable size, %d", size);
+		}
+		return;
+	}
+
 	int msize = 0;
 	for (int i = 0; i < size;) {
 		if (msize)
@@ -113,3 +138,25 @@ void reg_to_memory(int reg, int size) {
 		i += msize;
 	}
 }
+
+void memory_to_reg(int reg, int size) {
+	memory_operand_to_reg(MEM(0, REG_RDI), size, reg);
+}
+
+void scalar_to_memory(struct node *scalar) {
+	if (scalar->cg_info.storage == VAR_STOR_REGISTER) {
+		reg_to_memory(scalar->cg_info.reg, scalar->size);
+	} else {
+		asm_ins2("leaq", MEM(-scalar->cg_info.stack_location, REG_RBP), R8(REG_RDI));
+		codegen_memcpy(scalar->size);
+	}
+}
+
+void memory_to_scalar(struct node *scalar) {
+	if (scalar->cg_info.storage == VAR_STOR_REGISTER) {
+		memory_to_reg(scalar->cg_info.reg, scalar->size);
+	} else {
+		asm_ins2("leaq", MEM(-scalar->cg_info.stack_location, REG_RBP), R8(REG_RSI));
+		codegen_memcpy(scalar->size);
+	}
+}
@@ -5,7 +5,16 @@
 
 void scalar_to_reg(struct node *scalar, int reg);
 void reg_to_scalar(int reg, struct node *scalar);
+// From register to address in rsi.
 void reg_to_memory(int reg, int size);
+// From address in rdi to register, zero extended.
+void memory_to_reg(int reg, int size);
+
+// These use rdi, rsi, and rax as scratch.
+// From scalar to address in rsi.
+void scalar_to_memory(struct node *scalar);
+// From address in rdi to scalar.
+void memory_to_scalar(struct node *scalar);
 
 const char *get_reg_name(int id, int size);
 
@@ -4,6 +4,7 @@
 #include "types.h"
 
 #include <common.h>
+#include <atom.h>
 #include <arch/x64.h>
 #include <parser/expression.h>
 
@@ -16,30 +17,44 @@
 struct entry {
 	enum entry_type {
 		ENTRY_STR,
-		ENTRY_LABEL_NAME
+		ENTRY_LABEL_NAME,
+		ENTRY_TYPE_COUNT
 	} type;
-	struct string_view name;
+	atom name;
 	label_id id;
 };
 
 static struct entry *entries = NULL;
 static int entries_size = 0, entries_cap = 0;
 
+// Label of each name, indexed by atom. -1 if not registered.
+static struct label_index {
+	size_t size, cap;
+	label_id *ids;
+} label_index[ENTRY_TYPE_COUNT];
+
+static label_id *find_label(enum entry_type type, atom name) {
+	struct label_index *index = &label_index[type];
+	while (index->size <= (size_t)name)
+		ADD_ELEMENT(index->size, index->cap, index->ids) = -1;
+	return index->ids + name;
+}
+
 static label_id label_register(enum entry_type type, struct string_view str) {
-	for (int i = 0; i < entries_size; i++) {
-		if (sv_cmp(entries[i].name, str) &&
-			entries[i].type == type) {
-			return entries[i].id;
-		}
-	}
+	atom name = atom_intern(str);
+	label_id *label = find_label(type, name);
+
+	if (*label >= 0)
+		return *label;
 
 	int id = entries_size;
 	ADD_ELEMENT(entries_size, entries_cap, entries) = (struct entry) {
 		.type = type,
-		.name = str,
+		.name = name,
 		.id = id
 	};
 
+	*label = id;
 	return id;
 }
 
@@ -54,7 +69,8 @@ void rodata_get_label(label_id id, int n, char buffer[]) {
 	} else if (entries[id].type == ENTRY_STR) {
 		res = snprintf(buffer, n, ".Ls%d", id);
 	} else if (entries[id].type == ENTRY_LABEL_NAME) {
-		res = snprintf(buffer, n, "%.*s", entries[id].name.len, entries[id].name.str);
+		struct string_view name = atom_str(entries[id].name);
+		res = snprintf(buffer, n, "%.*s", name.len, name.str);
 	} else {
 		NOTIMP();
 	}
@@ -71,7 +87,7 @@ void rodata_codegen(void) {
 
 		asm_label(0, entries[i].id);
 
-		asm_string(entries[i].name);
+		asm_string(atom_str(entries[i].name));
 	}
 }
 
@@ -207,7 +207,7 @@ _Noreturn void impl_error_ice(const char *file, int line, const char *fmt, ...)
 _Noreturn void impl_error(struct position pos, const char *file, int line, const char *fmt, ...) {
 	va_list va;
 	va_start(va, fmt);
-	printf("\nError: %s:%d:%d: ", pos.path, pos.line, pos.column);
+	printf("\nError: %s:%d:%d: ", position_path(pos), position_line(pos), position_column(pos));
 	vprintf(fmt, va);
 	printf("\n");
 	printf("Compiler source: %s:%d\n", file, line);
@@ -237,7 +237,7 @@ void impl_warning(struct position pos, const char *fmt, ...) {
 	va_list va;
 	va_start(va, fmt);
 
-	printf("\nWarning, %s:%d:%d: ", pos.path, pos.line, pos.column);
+	printf("\nWarning, %s:%d:%d: ", position_path(pos), position_line(pos), position_column(pos));
 	vprintf(fmt, va);
 	printf("\n");
 
@@ -3,6 +3,7 @@
 #include "global_code_motion.h"
 
 #include <common.h>
+#include <arena.h>
 #include <abi/abi.h>
 
 #include <assert.h>
@@ -20,8 +21,13 @@ struct node **seals;
 static size_t nodes_size, nodes_cap;
 struct node **nodes;
 
+// Nodes and their arrays live until the end of the translation unit.
+static struct arena node_arena = ARENA("ir-nodes");
+static struct arena list_arena = ARENA("ir-lists");
+
 struct node *ir_new(int type, int size) {
-	struct node *next = ALLOC((struct node) { .type = type });
+	struct node *next = arena_alloc(&node_arena, sizeof *next);
+	*next = (struct node) { .type = type };
 
 	static int counter;
 	next->index = ++counter;
@@ -82,6 +88,13 @@ void ir_reset(void) {
 	free(seals);
 	seal_size = seal_cap = 0;
 	seals = NULL;
+
+	free(nodes);
+	nodes_size = nodes_cap = 0;
+	nodes = NULL;
+
+	arena_free(&node_arena);
+	arena_free(&list_arena);
 }
 
 static void set_state(struct node *node);
@@ -114,7 +127,7 @@ void node_set_argument(struct node *node, int index, struct node *argument) {
 	}
 
 	if (argument)
-		ADD_ELEMENT(argument->use_size, argument->use_cap, argument->uses) = node;
+		ARENA_ADD_ELEMENT(&list_arena, argument->use_size, argument->use_cap, argument->uses) = node;
 	node->arguments[index] = argument;
 
 	if (node->type == IR_PROJECT) {
@@ -549,7 +562,7 @@ struct node *ir_imod(struct node *lhs, struct node *rhs) {
 }
 
 struct node *ir_equal(struct node *lhs, struct node *rhs) {
-	return ir_new2(IR_EQUAL, lhs, rhs, lhs->size);
+	return ir_new2(IR_EQUAL, lhs, rhs, 4);
 }
 
 struct node *ir_binary_op(int type, struct node *lhs, struct node *rhs) {
@@ -561,6 +574,10 @@ struct node *ir_binary_op(int type, struct node *lhs, struct node *rhs) {
 		return ir_mod(lhs, rhs);
 	if (type == IR_IMOD)
 		return ir_imod(lhs, rhs);
+	// Comparisons result in an int, regardless of the operand size.
+	if ((type >= IR_LESS && type <= IR_NOT_EQUAL) ||
+		(type >= IR_FLT_LESS && type <= IR_FLT_NOT_EQUAL))
+		return ir_new2(type, lhs, rhs, 4);
 	return ir_new2(type, lhs, rhs, lhs->size);
 }
 
@@ -775,9 +792,9 @@ static void ir_add_instructions_to_block_children(void) {
 		struct node *node = nodes[i];
 		struct node *block = node->block;
 		if (node_is_instruction(node) && block) {
-			ADD_ELEMENT(block->block_info.children_size,
-						block->block_info.children_cap,
-						block->block_info.children) = node;
+			ARENA_ADD_ELEMENT(&list_arena, block->block_info.children_size,
+							  block->block_info.children_cap,
+							  block->block_info.children) = node;
 		}
 	}
 }
@@ -186,10 +186,13 @@ struct node {
 		struct {
 			enum {
 				VAR_STOR_NONE,
-				VAR_STOR_STACK
+				VAR_STOR_STACK,
+				VAR_STOR_REGISTER
 			} storage;
 
 			int stack_location;
+			int reg; // Used if storage is VAR_STOR_REGISTER.
+			int interval; // Index used by the register allocator.
 		} cg_info;
 
 		struct {
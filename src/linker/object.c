@@ -42,7 +42,125 @@ void object_start(void) {
 	object_set_section(".text");
 }
 
+// Bytes removed before offset, removed[i] is the number of bytes removed
+// by shortening jumps 0 to i - 1.
+static uint64_t removed_before(struct section *section, uint64_t *removed, uint64_t offset) {
+	size_t low = 0, high = section->jump_size;
+	while (low < high) {
+		size_t mid = (low + high) / 2;
+		if (section->jumps[mid].offset < offset)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return removed[low];
+}
+
+static void calculate_removed(struct section *section, uint64_t *removed) {
+	removed[0] = 0;
+	for (unsigned i = 0; i < section->jump_size; i++) {
+		struct object_jump *jump = section->jumps + i;
+		removed[i + 1] = removed[i] + (jump->is_short ? jump->size - 2 : 0);
+	}
+}
+
+static int jump_target(struct section *section, int section_idx, struct object_jump *jump) {
+	struct symbol *symbol = &current_object.symbols[section->relocations[jump->relocation].idx];
+	if (symbol->section != section_idx || symbol->global)
+		return -1;
+	return symbol->value;
+}
+
+// Shortening a jump never increases the distance of another jump,
+// so jumps are shortened until a fixpoint is reached.
+static void relax_jumps(int section_idx) {
+	struct section *section = &current_object.sections[section_idx];
+
+	// Alignment padding could grow when code before it shrinks.
+	if (section->jump_size == 0 || section->has_padding)
+		return;
+
+	uint64_t *removed = cc_malloc(sizeof *removed * (section->jump_size + 1));
+
+	int changed = 1;
+	while (changed) {
+		changed = 0;
+		calculate_removed(section, removed);
+
+		for (unsigned i = 0; i < section->jump_size; i++) {
+			struct object_jump *jump = section->jumps + i;
+			if (jump->is_short)
+				continue;
+
+			int target = jump_target(section, section_idx, jump);
+			if (target == -1)
+				continue;
+
+			int64_t end = jump->offset - removed[i] + 2;
+			int64_t disp = target - removed_before(section, removed, target) - end;
+
+			if (disp >= INT8_MIN && disp <= INT8_MAX) {
+				jump->is_short = 1;
+				changed = 1;
+			}
+		}
+	}
+
+	calculate_removed(section, removed);
+
+	uint8_t *data = cc_malloc(section->size);
+	size_t size = 0, prev = 0;
+	for (unsigned i = 0; i < section->jump_size; i++) {
+		struct object_jump *jump = section->jumps + i;
+		if (!jump->is_short)
+			continue;
+
+		memcpy(data + size, section->data + prev, jump->offset - prev);
+		size += jump->offset - prev;
+
+		int64_t target = jump_target(section, section_idx, jump);
+		int64_t disp = target - removed_before(section, removed, target) - (int64_t)(size + 2);
+
+		uint8_t *ins = section->data + jump->offset;
+		data[size++] = ins[0] == 0xe9 ? 0xeb : 0x70 | (ins[1] & 0xf);
+		data[size++] = disp;
+		prev = jump->offset + jump->size;
+	}
+	memcpy(data + size, section->data + prev, section->size - prev);
+	size += section->size - prev;
+
+	free(section->data);
+	section->data = data;
+	section->size = section->cap = size;
+
+	for (unsigned i = 0; i < current_object.symbol_size; i++) {
+		struct symbol *symbol = &current_object.symbols[i];
+		if (symbol->section == section_idx)
+			symbol->value -= removed_before(section, removed, symbol->value);
+	}
+
+	// Relocations of shortened jumps are resolved, and can be removed.
+	size_t relocation_size = 0;
+	for (unsigned i = 0, j = 0; i < section->relocation_size; i++) {
+		while (j < section->jump_size && section->jumps[j].relocation < (int)i)
+			j++;
+
+		if (j < section->jump_size && section->jumps[j].relocation == (int)i && section->jumps[j].is_short)
+			continue;
+
+		struct object_relocation relocation = section->relocations[i];
+		relocation.offset -= removed_before(section, removed, relocation.offset);
+		section->relocations[relocation_size++] = relocation;
+	}
+	section->relocation_size = relocation_size;
+
+	free(removed);
+}
+
 struct object *object_finish(void) {
+	for (unsigned i = 0; i < current_object.section_size; i++)
+		relax_jumps(i);
+
 	struct object *object = ALLOC(current_object);
 	current_object = (struct object) { 0 };
 
@@ -102,12 +220,17 @@ void object_write_zero(size_t size) {
 
 void object_align(size_t alignment) {
 	struct section *section = &current_object.sections[current_section];
+
+	// Set even if no padding is needed now, the offset can
+	// change when jumps before it are shortened.
+	section->has_padding = 1;
+	section->alignment = MAX(section->alignment, alignment);
+
 	size_t remainder = section->size % alignment;
 	if (remainder == 0)
 		return;
 
 	object_write_zero(alignment - remainder);
-	section->alignment = MAX(section->alignment, alignment);
 }
 
 void object_symbol_relocate(label_id label, int64_t offset, int64_t add, enum relocation_type type) {
@@ -137,3 +260,16 @@ void object_symbol_set(label_id label, int global) {
 	symbol->value = section->size;
 	symbol->global = global;
 }
+
+void object_write_jump(uint8_t *data, size_t size, label_id label) {
+	struct section *section = &current_object.sections[current_section];
+
+	ADD_ELEMENT(section->jump_size, section->jump_cap, section->jumps) = (struct object_jump) {
+		.offset = section->size,
+		.size = size,
+		.relocation = section->relocation_size
+	};
+
+	object_symbol_relocate(label, size - 4, -4, RELOCATE_32_RELATIVE);
+	object_write(data, size);
+}
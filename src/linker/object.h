@@ -17,6 +17,14 @@ struct object_relocation {
 	int64_t add;
 };
 
+// A jmp/jcc with a rel32 operand, which might be shortened to rel8.
+struct object_jump {
+	uint64_t offset; // Offset of the instruction.
+	int size; // 5 for jmp, 6 for jcc.
+	int relocation; // Index of the rel32 relocation.
+	int is_short;
+};
+
 struct section {
 	char *name;
 
@@ -26,6 +34,10 @@ struct section {
 
 	size_t relocation_size, relocation_cap;
 	struct object_relocation *relocations;
+
+	size_t jump_size, jump_cap;
+	struct object_jump *jumps;
+	int has_padding; // An alignment was requested inside the section.
 };
 
 struct symbol {
@@ -60,4 +72,8 @@ void object_align(size_t alignment);
 void object_symbol_relocate(label_id label, int64_t offset, int64_t add, enum relocation_type type);
 void object_symbol_set(label_id label, int global);
 
+// Write a jmp or jcc instruction with a rel32 operand to label.
+// It is shortened to rel8 in object_finish if the label is close enough.
+void object_write_jump(uint8_t *data, size_t size, label_id label);
+
 #endif
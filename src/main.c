@@ -1,6 +1,7 @@
 #include "ir/ir.h"
 #include "ir/export_dot.h"
 #include "preprocessor/preprocessor.h"
+#include "preprocessor/tokenizer.h"
 #include "parser/parser.h"
 #include "parser/symbols.h"
 #include "codegen/codegen.h"
@@ -11,6 +12,7 @@
 #include "abi/abi.h"
 #include "arguments.h"
 #include "escape_sequence.h"
+#include "arena.h"
 
 #ifdef CONFIG_PATH
 #include CONFIG_PATH
@@ -27,7 +29,13 @@
 #include <stdlib.h>
 #include <assert.h>
 
+#include <unistd.h>
+#include <sys/wait.h>
+
 static const char *dump_ir_path = NULL;
+static int mem_report = 0;
+static int benchmark_tokenizer = 0;
+static int preprocessor_stats = 0;
 
 static void add_implementation_defs(void) {
 	define_string("NULL", "(void*)0");
@@ -103,12 +111,22 @@ static void set_flags(struct arguments *arguments) {
 				codegen_flags.debug_stack_min = atoi(flag + 17);
 				printf("DBG STACK MIN: %d\n", codegen_flags.debug_stack_min);
 			}
+		} else if (strcmp(flag, "no-register-allocation") == 0) {
+			codegen_flags.register_allocation = 0;
 		} else if (strcmp(flag, "abi=ms") == 0) {
 			abi = ABI_MICROSOFT;
 		} else if (strcmp(flag, "abi=sysv") == 0) {
 			abi = ABI_SYSV;
 		} else if (strcmp(flag, "mingw-workarounds") == 0) {
 			mingw_workarounds = 1;
+		} else if (strcmp(flag, "mem-report") == 0) {
+			mem_report = 1;
+		} else if (strcmp(flag, "benchmark-tokenizer") == 0) {
+			benchmark_tokenizer = 1;
+		} else if (strcmp(flag, "preprocessor-stats") == 0) {
+			preprocessor_stats = 1;
+		} else if (strncmp(flag, "token-cache=", 12) == 0) {
+			preprocessor_set_token_cache(strdup(flag + 12));
 		} else if (strncmp(flag, "dump-ir=", 8) == 0) {
 			dump_ir_path = strdup(flag + 8);
 			printf("Dumping to %s\n", dump_ir_path);
@@ -224,6 +242,100 @@ static void compile_file(const char *path,
 	parser_reset();
 }
 
+// Compile each operand in a forked process, with at most arguments->jobs
+// processes running at the same time. Only used with -c and -S, where each
+// file is written separately and nothing has to be sent back to the parent.
+// Returns the number of files that failed to compile.
+static int compile_files_parallel(struct arguments *arguments) {
+	int running = 0, failed = 0;
+
+	for (int i = 0; i < arguments->n_operand || running; ) {
+		if (i < arguments->n_operand && running < arguments->jobs) {
+			// Anything still buffered would be written again by the child.
+			fflush(stdout);
+			fflush(stderr);
+			pid_t pid = fork();
+
+			if (pid == -1)
+				ERROR_NO_POS("Could not start process for %s.", arguments->operands[i]);
+
+			if (pid == 0) {
+				compile_file(arguments->operands[i], arguments);
+				if (preprocessor_stats)
+					preprocessor_print_conditionals(stderr);
+				if (mem_report) {
+					printf("Memory report for %s:\n", arguments->operands[i]);
+					arena_report(stdout);
+					preprocessor_print_defines(stdout);
+				}
+				exit(EXIT_SUCCESS);
+			}
+
+			running++;
+			i++;
+			continue;
+		}
+
+		int status;
+		if (wait(&status) == -1)
+			ICE("Could not wait for child process.");
+
+		running--;
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+			failed++;
+	}
+
+	return failed;
+}
+
+static int is_header(const char *path, struct arguments *arguments) {
+	if (arguments->language)
+		return strcmp(arguments->language, "c-header") == 0;
+	return is_ext_file(get_basename(path), 'h');
+}
+
+// Writes path.pch, or the output file if given.
+static void precompile_file(const char *path, struct arguments *arguments) {
+	symbols_init();
+
+	if (mingw_workarounds) {
+		abi_init_mingw_workarounds();
+	}
+
+	switch (abi) {
+	case ABI_SYSV: abi_init_sysv(); break;
+	case ABI_MICROSOFT: abi_init_microsoft(); break;
+	}
+
+	add_implementation_defs();
+
+	for (int i = 0; i < arguments->n_include; i++)
+		input_add_include_path(arguments->includes[i]);
+
+	for (unsigned i = 0; default_include[i]; i++)
+		input_add_include_path(default_include[i]);
+
+	for (int i = 0; default_defs[i]; i++)
+		add_definition(default_defs[i]);
+
+	for (int i = 0; i < arguments->n_define; i++)
+		add_definition(arguments->defines[i]);
+
+	for (int i = 0; i < arguments->n_undefine; i++)
+		define_remove(arguments->undefines[i]);
+
+	const char *outfile = arguments->outfile;
+	if (!outfile)
+		outfile = allocate_printf("%s.pch", path);
+
+	precompile_header(path, outfile);
+
+	preprocessor_reset();
+	ir_reset();
+	asm_reset();
+	parser_reset();
+}
+
 // This function is only called when -E flag is passed.
 // That is: preprocess, but don't compile.
 static void preprocess_file(const char *path, struct arguments *arguments) {
@@ -258,21 +370,19 @@ static void preprocess_file(const char *path, struct arguments *arguments) {
 	if (arguments->flag_MD)
 		preprocessor_write_dependencies();
 
-	preprocessor_init(path);
-
-	while (T0->type != T_EOI) {
-		if (T0->first_of_line)
-			printf("\n");
-		else if (T0->whitespace)
-			printf(" ");
-
-		printf("%s", dbg_token(T0));
+	FILE *fp = stdout;
+	if (arguments->outfile) {
+		fp = fopen(arguments->outfile, "w");
+		if (!fp)
+			ERROR_NO_POS("Could not open %s for writing.", arguments->outfile);
+	}
 
-		if (T0->whitespace_after)
-			printf(" ");
+	preprocess_to_file(path, fp);
 
-		t_next();
-	}
+	if (fp != stdout)
+		fclose(fp);
+	else
+		fflush(stdout);
 
 	preprocessor_reset();
 	ir_reset();
@@ -280,10 +390,58 @@ static void preprocess_file(const char *path, struct arguments *arguments) {
 	parser_reset();
 }
 
+// Tokenize the operands without preprocessing them, and report the throughput.
+static void run_tokenizer_benchmark(struct arguments *arguments) {
+	struct input *inputs = cc_malloc(sizeof *inputs * arguments->n_operand);
+	size_t bytes = 0, tokens = 0;
+
+	for (int i = 0; i < arguments->n_operand; i++) {
+		inputs[i] = input_open(arguments->operands[i]);
+		bytes += strlen(inputs[i].contents);
+	}
+
+	clock_t start = clock();
+
+	for (int i = 0; i < arguments->n_operand; i++) {
+		struct token_list list = tokenize_input(inputs[i].contents, inputs[i].path);
+		tokens += list.size;
+		token_list_free(&list);
+	}
+
+	double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	if (seconds <= 0)
+		seconds = 1e-6;
+
+	printf("Files:           %d\n", arguments->n_operand);
+	printf("Input:           %zu bytes\n", bytes);
+	printf("Tokens:          %zu\n", tokens);
+	printf("Token size:      %zu bytes\n", sizeof (struct token));
+	printf("Token storage:   %zu bytes, %.2f per input byte\n", tokens * sizeof (struct token),
+		   bytes ? (double)(tokens * sizeof (struct token)) / bytes : 0.0);
+	printf("Time:            %.3f s\n", seconds);
+	printf("Throughput:      %.2f MB/s, %.0f tokens/s\n", bytes / seconds / 1e6, tokens / seconds);
+
+	free(inputs);
+}
+
 int main(int argc, char **argv) {
 	struct arguments arguments = arguments_parse(argc, argv);
 
-	int will_link = !(arguments.flag_S || arguments.flag_c || arguments.flag_E);
+	set_flags(&arguments);
+
+	if (benchmark_tokenizer) {
+		run_tokenizer_benchmark(&arguments);
+		arguments_free(&arguments);
+		return 0;
+	}
+
+	int only_headers = arguments.n_operand > 0;
+	for (int i = 0; i < arguments.n_operand; i++) {
+		if (!is_header(arguments.operands[i], &arguments))
+			only_headers = 0;
+	}
+
+	int will_link = !(arguments.flag_S || arguments.flag_c || arguments.flag_E || only_headers);
 
 	if (will_link) {
 		printf("Warning! Emitting executables is still work in progress.\n");
@@ -300,11 +458,23 @@ int main(int argc, char **argv) {
 		ERROR_NO_POS("Can't have multiple input files with -o.");
 	}
 
-	set_flags(&arguments);
+	if (arguments.jobs > 1 && (arguments.flag_S || arguments.flag_c) && !arguments.flag_E) {
+		for (int i = 0; i < arguments.n_operand; i++) {
+			if (!is_ext_file(get_basename(arguments.operands[i]), 'c'))
+				ERROR_NO_POS("Can't compile %s.", arguments.operands[i]);
+		}
+
+		int failed = compile_files_parallel(&arguments);
+		arguments_free(&arguments);
+		return failed ? EXIT_FAILURE : 0;
+	}
 
 	for (int i = 0; i < arguments.n_operand; i++) {
 		struct string_view basename = get_basename(arguments.operands[i]);
 
+		if (i + 1 < arguments.n_operand)
+			preprocessor_keep_tokens();
+
 		if (arguments.flag_E) {
 			if (is_ext_file(basename, 'c')) {
 				preprocess_file(arguments.operands[i], &arguments);
@@ -314,7 +484,9 @@ int main(int argc, char **argv) {
 			continue;
 		}
 
-		if (is_ext_file(basename, 'c')) {
+		if (is_header(arguments.operands[i], &arguments)) {
+			precompile_file(arguments.operands[i], &arguments);
+		} else if (is_ext_file(basename, 'c')) {
 			compile_file(arguments.operands[i], &arguments);
 		} else if (is_ext_file(basename, 'o')) {
 			assert(!(arguments.flag_S || arguments.flag_c));
@@ -333,6 +505,15 @@ int main(int argc, char **argv) {
 		elf_write_executable(arguments.outfile ? arguments.outfile : "a.out", executable);
 	}
 
+	if (preprocessor_stats)
+		preprocessor_print_conditionals(stderr);
+
+	if (mem_report) {
+		printf("Memory report:\n");
+		arena_report(stdout);
+		preprocessor_print_defines(stdout);
+	}
+
 	arguments_free(&arguments);
 
 	return 0;
@@ -8,6 +8,7 @@
 #include "function_parser.h"
 #include "types.h"
 
+#include <arena.h>
 #include <preprocessor/preprocessor.h>
 #include <abi/abi.h>
 
@@ -157,9 +158,8 @@ static int parse_specifier(struct type_specifiers *ts,
 
 		if (T0->type == T_IDENT && !*got_ts) {
 			*got_ts = 1;
-			struct string_view name = T0->str;
 
-			struct symbol_typedef *sym = symbols_get_typedef(name);
+			struct symbol_typedef *sym = symbols_get_typedef(T0->id);
 
 			if (sym) {
 				ts->data_type = sym->data_type;
@@ -258,7 +258,7 @@ static int parse_enumerator(struct constant *prev, int first) {
 	}
 
 	struct symbol_identifier *sym =
-		symbols_add_identifier(name);
+		symbols_add_identifier(atom_intern(name));
 
 	sym->type = IDENT_CONSTANT;
 	sym->constant = val;
@@ -296,13 +296,13 @@ int parse_enum(struct type_specifiers *ts) {
 		TEXPECT(T_RBRACE);
 
 		struct enum_data *data = NULL;
-		struct symbol_struct *def = symbols_get_struct_in_current_scope(name);
+		struct symbol_struct *def = symbols_get_struct_in_current_scope(atom_intern(name));
 
 		if (def && def->type != STRUCT_ENUM)
 			ERROR(T0->pos, "Name not declared as enum.");
 
 		if (!def) {
-			def = symbols_add_struct(name);
+			def = symbols_add_struct(atom_intern(name));
 			def->type = STRUCT_ENUM;
 			data = register_enum();
 			def->enum_data = data;
@@ -319,10 +319,10 @@ int parse_enum(struct type_specifiers *ts) {
 		ts->data_type = type_simple(ST_INT);
 		return 1;
 	} else {
-		struct symbol_struct *def = symbols_get_struct(name);
+		struct symbol_struct *def = symbols_get_struct(atom_intern(name));
 
 		if(!def) {
-			def = symbols_add_struct(name);
+			def = symbols_add_struct(atom_intern(name));
 
 			def->enum_data = register_enum();
 			def->enum_data->is_complete = 0;
@@ -431,7 +431,7 @@ int parse_struct(struct type_specifiers *ts) {
 		accept_attribute(&is_packed);
 
 		struct struct_data *data = NULL;
-		struct symbol_struct *def = symbols_get_struct_in_current_scope(name);
+		struct symbol_struct *def = symbols_get_struct_in_current_scope(atom_intern(name));
 
 		if (is_union) {
 			if (def && def->type != STRUCT_UNION)
@@ -442,7 +442,7 @@ int parse_struct(struct type_specifiers *ts) {
 		}
 
 		if (!def) {
-			def = symbols_add_struct(name);
+			def = symbols_add_struct(atom_intern(name));
 			def->type = is_union ? STRUCT_UNION : STRUCT_STRUCT;
 			data = register_struct();
 			def->struct_data = data;
@@ -480,10 +480,10 @@ int parse_struct(struct type_specifiers *ts) {
 
 		return 1;
 	} else {
-		struct symbol_struct *def = symbols_get_struct(name);
+		struct symbol_struct *def = symbols_get_struct(atom_intern(name));
 
 		if(!def) {
-			def = symbols_add_struct(name);
+			def = symbols_add_struct(atom_intern(name));
 
 			def->struct_data = register_struct();
 			*def->struct_data = (struct struct_data) {
@@ -540,9 +540,11 @@ static void ast_get_parameters(struct type_ast *ast,
 	ICE("Did not find parameter names");
 }
 
+static struct arena type_ast_arena = ARENA("declarators");
+
 static struct type_ast *type_ast_new(struct type_ast ast) {
 	ast.pos = T0->pos;
-	return ALLOC(ast);
+	return ARENA_ALLOC(&type_ast_arena, ast);
 }
 
 static struct type *specifiers_to_type(const struct type_specifiers *ts) {
@@ -745,9 +747,7 @@ static struct parameter_list parse_parameter_list(void) {
 
 		ret.arguments = cc_realloc(ret.arguments, ret.n * sizeof(*ret.arguments));
 		struct symbol_identifier *ident =
-			symbols_add_identifier(was_abstract
-								   ? (struct string_view) { 0 }
-								   : name);
+			symbols_add_identifier(was_abstract ? 0 : atom_intern(name));
 
 		ident->type = IDENT_PARAMETER;
 		ident->parameter.type = type;
@@ -817,7 +817,7 @@ struct type_ast *parse_declarator(int *was_abstract, int *has_symbols) {
 			*was_abstract = 0;
 		TNEXT();
 	} else if (TACCEPT(T_LPAR)) {
-		if (!(T0->type == T_IDENT && symbols_get_typedef(T0->str)))
+		if (!(T0->type == T_IDENT && symbols_get_typedef(T0->id)))
 			ast = parse_declarator(was_abstract, has_symbols);
 		if (!ast) {
 			*was_abstract = 1;
@@ -1253,12 +1253,12 @@ static int parse_init_declarator(struct specifiers s, int external, int *was_fun
 	}
 
 	if (s.scs.typedef_n) {
-		symbols_add_typedef(name)->data_type = type;
+		symbols_add_typedef(atom_intern(name))->data_type = type;
 		return 1;
 	}
 
 	// Check for agreement with previous declarations.
-	struct symbol_identifier *symbol = symbols_get_identifier_in_current_scope(name);
+	struct symbol_identifier *symbol = symbols_get_identifier_in_current_scope(atom_intern(name));
 	int prev_definition = 0;
 
 	if (symbol) {
@@ -1272,7 +1272,7 @@ static int parse_init_declarator(struct specifiers s, int external, int *was_fun
 
 		type = composite_type;
 	} else {
-		symbol = symbols_add_identifier(name);
+		symbol = symbols_add_identifier(atom_intern(name));
 	}
 	
 	int has_init = TACCEPT(T_A);
@@ -1444,7 +1444,7 @@ void generate_tentative_definitions(void) {
 	for (size_t i = 0; i < potentially_tentative.size; i++) {
 		struct string_view name = potentially_tentative.names[i];
 
-		struct symbol_identifier *symbol = symbols_get_identifier_global(name);
+		struct symbol_identifier *symbol = symbols_get_identifier_global(atom_intern(name));
 
 		if (symbol && symbol->is_tentative) {
 			struct type *type = symbols_get_identifier_type(symbol);
@@ -5,6 +5,7 @@
 #include "expression_to_ir.h"
 
 #include <common.h>
+#include <arena.h>
 #include <codegen/rodata.h>
 #include <precedence.h>
 #include <abi/abi.h>
@@ -401,6 +402,9 @@ static struct expr *expr_dot_operator(struct expr *lhs, struct token *name) {
 	return lhs;
 }
 
+// Expressions can be referenced from types, which live for the whole run.
+static struct arena expr_arena = ARENA("expressions");
+
 struct expr *expr_new(struct expr expr) {
 	for (int i = 0; i < num_args[expr.type]; i++) {
 		if (!expr.args[i])
@@ -464,10 +468,10 @@ struct expr *expr_new(struct expr expr) {
 
 	check_const_correctness(&expr);
 
-	if (!expr.pos.path)
+	if (!expr.pos.source)
 		expr.pos = T0->pos; // If no position is supplied, at least take something close to it.
 
-	return ALLOC(expr);
+	return ARENA_ALLOC(&expr_arena, expr);
 }
 
 // Parsing.
@@ -498,7 +502,7 @@ static void parse_call_parameters(struct expr ***args, int *n_args) {
 
 	*args = NULL;
 	if (pos) {
-		*args = cc_malloc(sizeof **args * pos);
+		*args = arena_alloc(&expr_arena, sizeof **args * pos);
 		memcpy(*args, buffer, sizeof **args * pos);
 	}
 
@@ -588,7 +592,7 @@ static struct expr *parse_prefix(void) {
 
 		return type_alignof(type);
 	} else if (T0->type == T_IDENT) {
-		struct symbol_identifier *sym = symbols_get_identifier(T0->str);
+		struct symbol_identifier *sym = symbols_get_identifier(T0->id);
 
 		if (!sym)
 			ERROR(T0->pos, "Could not find identifier %.*s", T0->str.len, T0->str.str);
@@ -240,7 +240,7 @@ static struct evaluated_expression evaluate_indirection(struct expr *expr) {
 		break;
 
 	default:
-		ICE("Invalid evaluated type %d %s:%d", rhs.type, expr->pos.path, expr->pos.line);
+		ICE("Invalid evaluated type %d %s:%d", rhs.type, position_path(expr->pos), position_line(expr->pos));
 	}
 }
 
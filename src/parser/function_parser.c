@@ -499,14 +499,14 @@ struct string_view get_current_function_name(void) {
 void parse_function(struct string_view name, struct type *type, int arg_n, struct symbol_identifier **args, int global) {
 	(void)arg_n;
 	current_function = name;
-	struct symbol_identifier *symbol = symbols_get_identifier_global(name);
+	struct symbol_identifier *symbol = symbols_get_identifier_global(atom_intern(name));
 
 	function_scope.size = 0;
 
 	current_ret_val = type->children[0];
 
 	if (!symbol)
-		symbol = symbols_add_identifier_global(name);
+		symbol = symbols_add_identifier_global(atom_intern(name));
 
 	symbol->type = IDENT_LABEL;
 	symbol->label.type = type;
@@ -1,6 +1,7 @@
 #include "symbols.h"
 
 #include <common.h>
+#include <arena.h>
 
 #include <string.h>
 
@@ -15,7 +16,7 @@ struct entry_id {
 		ENTRY_STRUCT,
 		ENTRY_IDENTIFIER
 	} type;
-	struct string_view name;
+	atom name;
 };
 
 struct table_entry {
@@ -42,12 +43,22 @@ static struct table {
 
 static int current_block = 0;
 
+// Identifier data is referenced from expressions, so it is kept after
+// symbols_reset. The tables are heap allocated and tracked in this arena.
+static struct arena symbol_arena = ARENA("symbols");
+
+static void add_table_element(void) {
+	size_t old_cap = table.cap;
+	(void)ADD_ELEMENT(table.size, table.cap, table.entries);
+	arena_track(&symbol_arena, sizeof *table.entries * old_cap, sizeof *table.entries * table.cap);
+}
+
 static uint32_t hash_entry(struct entry_id id) {
-	return hash32(id.type) ^ sv_hash(id.name);
+	return hash32(id.type) ^ atom_hash(id.name);
 }
 
 static int compare_entry(struct entry_id a, struct entry_id b) {
-	return a.type == b.type && sv_cmp(a.name, b.name);
+	return a.type == b.type && a.name == b.name;
 }
 
 void symbols_push_scope(void) {
@@ -86,7 +97,7 @@ static struct table_entry *get_entry(struct entry_id id, int global) {
 
 static struct table_entry *add_entry_with_block(struct entry_id id, int block) {
 	// Move entire table one step down for entry->block > block.
-	(void)ADD_ELEMENT(table.size, table.cap, table.entries);
+	add_table_element();
 
 	int i;
 	for (i = table.size - 2; i >= 0; i--) {
@@ -130,7 +141,8 @@ static struct table_entry *add_entry_with_block(struct entry_id id, int block) {
 static struct table_entry *add_entry(struct entry_id id) {
 	uint32_t hash = hash_entry(id) % hash_table.size;
 
-	struct table_entry *new_entry = &ADD_ELEMENT(table.size, table.cap, table.entries);
+	add_table_element();
+	struct table_entry *new_entry = table.entries + table.size - 1;
 
 	*new_entry = (struct table_entry) {
 		.id.name = id.name,
@@ -145,58 +157,58 @@ static struct table_entry *add_entry(struct entry_id id) {
 }
 
 // table_entry querying.
-static struct table_entry *symbols_add(enum entry_type type, struct string_view name) {
+static struct table_entry *symbols_add(enum entry_type type, atom name) {
 	struct table_entry *entry = get_entry((struct entry_id) { type, name }, 0);
 
 	if (entry && entry->block == current_block)
-		ICE("Name already declared, %.*s", name.len, name.str);
+		ICE("Name already declared, %.*s", atom_str(name).len, atom_str(name).str);
 
 	return add_entry((struct entry_id) { type, name });
 }
 
-static struct table_entry *symbols_get(enum entry_type type, struct string_view name) {
+static struct table_entry *symbols_get(enum entry_type type, atom name) {
 	return get_entry((struct entry_id) { type, name }, 0);
 }
 
-static struct table_entry *symbols_get_in_current_scope(enum entry_type type, struct string_view name) {
+static struct table_entry *symbols_get_in_current_scope(enum entry_type type, atom name) {
 	struct table_entry *entry = get_entry((struct entry_id) { type, name }, 0);
 
 	return (entry && entry->block == current_block) ? entry : NULL;
 }
 
 // Identifier help functions.
-struct symbol_identifier *symbols_add_identifier(struct string_view name) {
-	if (name.len == 0) {
+struct symbol_identifier *symbols_add_identifier(atom name) {
+	if (!name) {
 		// Anonymous identifier.
-		return ALLOC((struct symbol_identifier) { 0 });
+		return ARENA_ALLOC(&symbol_arena, (struct symbol_identifier) { 0 });
 	}
 	struct table_entry *entry = symbols_add(ENTRY_IDENTIFIER, name);
-	entry->identifier_data = ALLOC((struct symbol_identifier) { 0 });
+	entry->identifier_data = ARENA_ALLOC(&symbol_arena, (struct symbol_identifier) { 0 });
 	return entry->identifier_data;
 }
 
-struct symbol_identifier *symbols_get_identifier(struct string_view name) {
+struct symbol_identifier *symbols_get_identifier(atom name) {
 	struct table_entry *entry = symbols_get(ENTRY_IDENTIFIER, name);
 	return entry ? entry->identifier_data : NULL;
 }
 
-struct symbol_identifier *symbols_get_identifier_in_current_scope(struct string_view name) {
+struct symbol_identifier *symbols_get_identifier_in_current_scope(atom name) {
 	struct table_entry *entry = symbols_get_in_current_scope(ENTRY_IDENTIFIER, name);
 	return entry ? entry->identifier_data : NULL;
 }
 
-struct symbol_identifier *symbols_add_identifier_global(struct string_view name) {
+struct symbol_identifier *symbols_add_identifier_global(atom name) {
 	struct table_entry *entry = get_entry((struct entry_id) { ENTRY_IDENTIFIER, name }, 1);
 
 	if (entry && entry->block == current_block)
-		ICE("Name already declared, %.*s", name.len, name.str);
+		ICE("Name already declared, %.*s", atom_str(name).len, atom_str(name).str);
 
 	entry = add_entry_with_block((struct entry_id) { ENTRY_IDENTIFIER, name }, 0);
-	entry->identifier_data = ALLOC((struct symbol_identifier) { 0 });
+	entry->identifier_data = ARENA_ALLOC(&symbol_arena, (struct symbol_identifier) { 0 });
 	return entry->identifier_data;
 }
 
-struct symbol_identifier *symbols_get_identifier_global(struct string_view name) {
+struct symbol_identifier *symbols_get_identifier_global(atom name) {
 	struct table_entry *entry = get_entry((struct entry_id) { ENTRY_IDENTIFIER, name }, 1);
 	return entry ? entry->identifier_data : NULL;
 }
@@ -212,22 +224,22 @@ struct type *symbols_get_identifier_type(struct symbol_identifier *symbol) {
 }
 
 // Struct help functions.
-struct symbol_struct *symbols_add_struct(struct string_view name) {
+struct symbol_struct *symbols_add_struct(atom name) {
 	return &symbols_add(ENTRY_STRUCT, name)->struct_data;
 }
 
-struct symbol_struct *symbols_get_struct(struct string_view name) {
+struct symbol_struct *symbols_get_struct(atom name) {
 	struct table_entry *entry = symbols_get(ENTRY_STRUCT, name);
 	return entry ? &entry->struct_data : NULL;
 }
 
-struct symbol_struct *symbols_get_struct_in_current_scope(struct string_view name) {
+struct symbol_struct *symbols_get_struct_in_current_scope(atom name) {
 	struct table_entry *entry = symbols_get_in_current_scope(ENTRY_STRUCT, name);
 	return entry ? &entry->struct_data : NULL;
 }
 
 // Typedef help functions.
-struct symbol_typedef *symbols_add_typedef(struct string_view name) {
+struct symbol_typedef *symbols_add_typedef(atom name) {
 	struct entry_id id = {ENTRY_TYPEDEF, name};
 	struct table_entry *entry = get_entry(id, 0);
 
@@ -237,7 +249,7 @@ struct symbol_typedef *symbols_add_typedef(struct string_view name) {
 	return &add_entry(id)->typedef_data;
 }
 
-struct symbol_typedef *symbols_get_typedef(struct string_view name) {
+struct symbol_typedef *symbols_get_typedef(atom name) {
 	struct table_entry *entry = symbols_get(ENTRY_TYPEDEF, name);
 	return entry ? &entry->typedef_data : NULL;
 }
@@ -246,11 +258,15 @@ struct symbol_typedef *symbols_get_typedef(struct string_view name) {
 void symbols_init(void) {
 	hash_table.size = 1024;
 	hash_table.entries = cc_malloc(sizeof *hash_table.entries * hash_table.size);
+	arena_track(&symbol_arena, 0, sizeof *hash_table.entries * hash_table.size);
 	for (int i = 0; i < hash_table.size; i++)
 		hash_table.entries[i] = -1;
 }
 
 void symbols_reset(void) {
+	arena_track(&symbol_arena, sizeof *hash_table.entries * hash_table.size, 0);
+	arena_track(&symbol_arena, sizeof *table.entries * table.cap, 0);
+
 	free(hash_table.entries);
 	hash_table = (struct hash_table) { 0 };
 
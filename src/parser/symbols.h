@@ -4,6 +4,7 @@
 #include "parser.h"
 
 #include <string_view.h>
+#include <atom.h>
 
 // This is the symbol table used in the compiler.
 // It holds variables (including functions), structs/unions, and typedefs.
@@ -47,12 +48,12 @@ struct symbol_identifier {
 
 struct type *symbols_get_identifier_type(struct symbol_identifier *symbol);
 
-struct symbol_identifier *symbols_add_identifier_global(struct string_view name);
-struct symbol_identifier *symbols_get_identifier_global(struct string_view name);
+struct symbol_identifier *symbols_add_identifier_global(atom name);
+struct symbol_identifier *symbols_get_identifier_global(atom name);
 
-struct symbol_identifier *symbols_add_identifier(struct string_view name);
-struct symbol_identifier *symbols_get_identifier(struct string_view);
-struct symbol_identifier *symbols_get_identifier_in_current_scope(struct string_view name);
+struct symbol_identifier *symbols_add_identifier(atom name);
+struct symbol_identifier *symbols_get_identifier(atom name);
+struct symbol_identifier *symbols_get_identifier_in_current_scope(atom name);
 
 struct symbol_struct {
 	enum {
@@ -65,15 +66,15 @@ struct symbol_struct {
 	struct enum_data *enum_data;
 };
 
-struct symbol_struct *symbols_add_struct(struct string_view name);
-struct symbol_struct *symbols_get_struct(struct string_view name);
-struct symbol_struct *symbols_get_struct_in_current_scope(struct string_view name);
+struct symbol_struct *symbols_add_struct(atom name);
+struct symbol_struct *symbols_get_struct(atom name);
+struct symbol_struct *symbols_get_struct_in_current_scope(atom name);
 
 struct symbol_typedef {
 	struct type *data_type;
 };
 
-struct symbol_typedef *symbols_add_typedef(struct string_view name);
-struct symbol_typedef *symbols_get_typedef(struct string_view name);
+struct symbol_typedef *symbols_add_typedef(atom name);
+struct symbol_typedef *symbols_get_typedef(atom name);
 
 #endif
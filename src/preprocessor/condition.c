@@ -0,0 +1,246 @@
+#include "condition.h"
+#include "macro_expander.h"
+#include "string_concat.h"
+
+#include <common.h>
+#include <precedence.h>
+#include <arch/x64.h>
+
+#include <assert.h>
+
+struct result {
+	int is_signed;
+	union {
+		intmax_t i;
+		uintmax_t u;
+	};
+};
+
+static struct result result_signed(intmax_t val) {
+	return (struct result) { .is_signed = 1, .i = val };
+}
+
+static struct result result_unsigned(intmax_t val) {
+	return (struct result) { .is_signed = 0, .u = val };
+}
+
+static int result_is_zero(struct result result) {
+	return result.is_signed ? (result.i == 0) : (result.u == 0);
+}
+
+static void check_div_overflow(struct token *t,
+							   struct result lhs, struct result rhs) {
+	if (result_is_zero(rhs))
+		ERROR(t->pos, "Division by zero");
+	if (lhs.is_signed && lhs.i == INTMAX_MIN && rhs.i == -1)
+		ERROR(t->pos, "Division will overflow");
+}
+
+#define RESULT_UNARY(OP, EXPR) ((EXPR).is_signed				\
+								? result_signed(OP (EXPR).i)	\
+								: result_unsigned(OP (EXPR).u))
+
+#define RESULT_BINARY(OP, LHS, RHS) ((LHS).is_signed					\
+									 ? result_signed((LHS).i OP (RHS).i) \
+									 : result_unsigned((LHS).u OP (RHS).u))
+
+// Conditionals always returns signed integers.
+#define RESULT_BINARY_COND(OP, LHS, RHS) ((LHS).is_signed				\
+										  ? result_signed((LHS).i OP (RHS).i) \
+										  : result_signed((LHS).u OP (RHS).u))
+
+static atom defined_atom;
+
+// True if the expansion of def is a single operand that can't interact
+// with the tokens around it, so that it can be skipped when not evaluated.
+static int expands_to_operand(struct define *def) {
+	struct token_list *body = &def->def;
+
+	if (body->size == 1)
+		return body->list[0].type == T_NUM || body->list[0].type == T_CHARACTER_CONSTANT;
+
+	if (body->size < 2 || body->list[0].type != T_LPAR)
+		return 0;
+
+	int depth = 0;
+	for (int i = 0; i < body->size; i++) {
+		if (body->list[i].type == T_LPAR)
+			depth++;
+		else if (body->list[i].type == T_RPAR && --depth == 0)
+			return i == body->size - 1;
+	}
+
+	return 0;
+}
+
+// Takes the next operand in an unevaluated part of the expression. Macros
+// that expand to a single operand are replaced by 0 without expanding
+// them, together with their arguments.
+static struct token next_unevaluated(void) {
+	struct token *top = expand_lazy_peek();
+	struct define *def = NULL;
+
+	if (top->type != T_IDENT || top->id == defined_atom || hide_set_contains(top->hs, top->id) ||
+		!(def = define_map_get(top->id)) || !expands_to_operand(def))
+		return expand_lazy_next();
+
+	struct token name = expand_lazy_take();
+
+	if (def->func && expand_lazy_peek()->type == T_LPAR) {
+		int depth = 0;
+		do {
+			struct token t = expand_lazy_take();
+			if (t.type == T_EOI)
+				ERROR(name.pos, "Unterminated argument list to %.*s", name.str.len, name.str.str);
+			if (t.type == T_LPAR)
+				depth++;
+			else if (t.type == T_RPAR)
+				depth--;
+		} while (depth);
+	}
+
+	return (struct token) { .type = T_NUM, .str = sv_from_str("0"), .pos = name.pos };
+}
+
+// The operand of defined is taken without expanding it.
+static struct result evaluate_defined(int evaluate) {
+	struct token t = expand_lazy_take();
+	int has_lpar = t.type == T_LPAR;
+	if (has_lpar)
+		t = expand_lazy_take();
+
+	if (t.type != T_IDENT)
+		ERROR(t.pos, "Expected identifier after defined, got %s", dbg_token_type(t.type));
+
+	int is_defined = evaluate && define_map_get(t.id) != NULL;
+
+	if (has_lpar) {
+		struct token rpar = expand_lazy_take();
+		EXPECT(&rpar, T_RPAR);
+	}
+
+	return result_signed(is_defined);
+}
+
+// TODO: Ensure no UB. Don't allow operators to overflow.
+static struct result evaluate_expression(int prec, int evaluate) {
+	struct result expr = result_signed(0);
+	struct token t = evaluate ? expand_lazy_next() : next_unevaluated();
+
+	if (t.type == T_ADD) {
+		expr = evaluate_expression(PREFIX_PREC, evaluate);
+	} else if (t.type == T_SUB) {
+		struct result rhs = evaluate_expression(PREFIX_PREC, evaluate);
+		expr = RESULT_UNARY(-, rhs);
+	} else if (t.type == T_NOT) {
+		struct result rhs = evaluate_expression(PREFIX_PREC, evaluate);
+		expr = RESULT_UNARY(!, rhs);
+	} else if (t.type == T_LPAR) {
+		expr = evaluate_expression(0, evaluate);
+		struct token rpar = expand_lazy_next();
+		if (rpar.type != T_RPAR)
+			ERROR(rpar.pos, "Expected ), got %s", dbg_token_type(rpar.type));
+	} else if (t.type == T_IDENT && t.id == defined_atom) {
+		expr = evaluate_defined(evaluate);
+	} else if (t.type == T_IDENT) {
+		// Identifiers left after expansion are 0.
+	} else if (t.type == T_NUM && !evaluate) {
+		// The value is not used.
+	} else if (t.type == T_NUM) {
+		struct constant c = constant_from_string(t.str);
+		assert(c.type == CONSTANT_TYPE);
+		if (type_is_floating(c.data_type))
+			ERROR(t.pos, "Floating point arithmetic in the preprocessor is not allowed.");
+		if (!type_is_integer(c.data_type))
+			ERROR(t.pos, "Preprocessor variables must be of integer type.");
+		if (is_signed(c.data_type->simple))
+			expr = result_signed(c.int_d);
+		else
+			expr = result_unsigned(c.uint_d);
+	} else if (t.type == T_CHARACTER_CONSTANT) {
+		expr = result_signed(escaped_character_constant_to_int(t));
+	} else {
+		ERROR(t.pos, "Invalid token in preprocessor expression. %s", dbg_token(&t));
+	}
+
+	t = expand_lazy_next();
+
+	while (prec < precedence_get(t.type, 1)) {
+		int new_prec = precedence_get(t.type, 0);
+
+		if (t.type == T_QUEST) {
+			struct result mid = evaluate_expression(0, !result_is_zero(expr) ? evaluate : 0);
+			struct token colon = expand_lazy_next();
+			EXPECT(&colon, T_COLON);
+			struct result rhs = evaluate_expression(new_prec, result_is_zero(expr) ? evaluate : 0);
+			expr = !result_is_zero(expr) ? mid : rhs;
+		} else if (t.type == T_AND) {
+			struct result rhs = evaluate_expression(new_prec, !result_is_zero(expr) ? evaluate : 0);
+			expr = result_signed(!result_is_zero(expr) && !result_is_zero(rhs));
+		} else if (t.type == T_OR) {
+			struct result rhs = evaluate_expression(new_prec, result_is_zero(expr) ? evaluate : 0);
+			expr = result_signed(!result_is_zero(expr) || !result_is_zero(rhs));
+		} else {
+			// Standard binary operator.
+			struct result rhs = evaluate_expression(new_prec, evaluate);
+
+			// Integer -> Unsigned integer promotion.
+			if (rhs.is_signed && !expr.is_signed)
+				rhs = result_unsigned(rhs.i);
+			else if (!rhs.is_signed && expr.is_signed)
+				expr = result_unsigned(expr.i);
+
+			if (evaluate) {
+				switch (t.type) {
+				case T_BOR: expr = RESULT_BINARY(|, expr, rhs); break;
+				case T_XOR: expr = RESULT_BINARY(^, expr, rhs); break;
+				case T_AMP: expr = RESULT_BINARY(&, expr, rhs); break;
+				case T_EQ: expr = RESULT_BINARY_COND(==, expr, rhs); break;
+				case T_NEQ: expr = RESULT_BINARY_COND(!=, expr, rhs); break;
+				case T_LEQ: expr = RESULT_BINARY_COND(<=, expr, rhs); break;
+				case T_GEQ: expr = RESULT_BINARY_COND(>=, expr, rhs); break;
+				case T_L: expr = RESULT_BINARY_COND(<, expr, rhs); break;
+				case T_G: expr = RESULT_BINARY_COND(>, expr, rhs); break;
+				case T_LSHIFT: expr = RESULT_BINARY(<<, expr, rhs); break;
+				case T_RSHIFT: expr = RESULT_BINARY(>>, expr, rhs); break;
+				case T_ADD: expr = RESULT_BINARY(+, expr, rhs); break;
+				case T_SUB: expr = RESULT_BINARY(-, expr, rhs); break;
+				case T_STAR: expr = RESULT_BINARY(*, expr, rhs); break;
+				case T_DIV:
+					check_div_overflow(&t, expr, rhs);
+					expr = RESULT_BINARY(/, expr, rhs);
+					break;
+				case T_MOD:
+					check_div_overflow(&t, expr, rhs);
+					expr = RESULT_BINARY(%, expr, rhs);
+					break;
+				default:
+					ERROR(t.pos, "Invalid infix %s", dbg_token(&t));
+				}
+			}
+		}
+
+		t = expand_lazy_next();
+	}
+
+	expand_lazy_push(t);
+
+	return expr;
+}
+
+int condition_evaluate(struct token_list *tokens) {
+	if (!defined_atom)
+		defined_atom = atom_intern(sv_from_str("defined"));
+
+	expand_lazy_begin(tokens);
+
+	struct result result = evaluate_expression(0, 1);
+
+	struct token t = expand_lazy_next();
+	if (t.type != T_EOI)
+		ERROR(t.pos, "Unexpected %s in preprocessor expression.", dbg_token(&t));
+
+	expand_lazy_end();
+
+	return !result_is_zero(result);
+}
@@ -0,0 +1,12 @@
+#ifndef CONDITION_H
+#define CONDITION_H
+
+#include "token_list.h"
+
+// Evaluates the controlling expression of #if and #elif, given the tokens
+// of the directive line before macro expansion. Macros are expanded as the
+// evaluator reaches them, and operands that are not evaluated, like the
+// right side of 0 && X, are skipped without expansion where possible.
+int condition_evaluate(struct token_list *tokens);
+
+#endif
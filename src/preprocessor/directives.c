@@ -1,29 +1,284 @@
 #include "directives.h"
 #include "macro_expander.h"
 #include "tokenizer.h"
-#include "string_concat.h"
+#include "condition.h"
+#include "precompiled.h"
 
 #include <common.h>
-#include <precedence.h>
-#include <arch/x64.h>
 
 #include <assert.h>
 
+// For each conditional directive, the next #elif, #else or #endif
+// at the same level. Lets skipped groups be passed over without
+// reading their tokens.
+struct conditional_jumps {
+	int size, cap;
+	struct conditional_jump {
+		int offset; // Of the # token, unique within the file.
+		int to; // Index of the # token of the next directive, -1 if none.
+		int nested; // Directives with conditions in between.
+	} *list;
+};
+
+// Finds the include guard of a file as its tokens are read,
+// see find_include_guard for the form it must have.
+#define GUARD_OPENING_SIZE 8
+
+struct guard_detector {
+	enum {
+		GUARD_OPENING, GUARD_INSIDE, GUARD_CLOSED, GUARD_NONE
+	} state;
+
+	// The opening directive, and the token after it.
+	int size;
+	struct token opening[GUARD_OPENING_SIZE];
+
+	int depth;
+	struct token prev;
+	atom macro;
+};
+
 struct tokenized_file {
-	int token_idx;
+	int token_idx; // Tokens taken so far.
+	// Tokens read so far if the file is read from stream and keep_tokens is set.
 	struct token_list tokens;
 
+	int is_stream, keep_tokens;
+	struct tokenizer stream;
+	int is_cached; // The stream is read from the token cache directory.
+	struct token_cache_cursor cached;
+	int ahead_size; // Tokens read from stream, but not taken.
+	struct token ahead[4];
+
+	int find_guard;
+	struct guard_detector guard;
+
 	int pushed_idx;
 	struct token pushed[3];
 
 	const char *path;
 	struct tokenized_file *parent;
+
+	int line_source; // Source given by the last #line, 0 if none.
+
+	struct conditional_count *conditionals;
+	struct conditional_jumps jumps;
 };
 
 static struct tokenized_file *current_file;
 
-static const char *new_path = NULL;
-static int line_diff = 0;
+// Every file that has been read, by path. Kept for the whole run like the
+// path cache in input.c. A file is tokenized as a stream the first time it
+// is read, so that only the files that are open take up memory. If more
+// translation units follow, the tokens of an included file are kept when the
+// stream reaches its end, unless a skipped group was passed over without
+// tokenizing it. Other files that are read again are tokenized in full and
+// the tokens are kept. Tokens are never modified
+// after tokenization, so the lists are shared.
+// Kept tokens are checked against the size and hash of the file once per
+// translation unit, and read again if the file has changed.
+// With a token cache directory, files whose tokens are in the directory
+// are streamed from there instead of being tokenized. Other files are
+// tokenized in full the first time they are read, and saved to it.
+static struct cached_tokens {
+	char *path;
+	int is_tokenized, is_cached;
+	struct token_list tokens;
+	struct token_cache_cursor cached; // At the start of the file.
+	struct conditional_count *conditionals;
+	struct conditional_jumps jumps;
+
+	uint64_t size, hash; // Of the contents the tokens were read from.
+	int checked_unit; // Last translation unit the file was checked in.
+} *token_cache;
+static size_t token_cache_size, token_cache_cap;
+
+static int translation_unit;
+
+// Set by directiver_keep_tokens for the current translation unit.
+static int keep_streamed_tokens;
+
+static const char *token_cache_dir;
+static int token_cache_loaded, token_cache_saved; // Files, over the whole run.
+
+// Conditional directives seen in each file over the whole run, in the
+// order the files were first read. Directives are skipped when they are
+// inside a skipped group, or follow a group that was taken.
+static struct conditional_count {
+	const char *path;
+	int evaluated, skipped;
+} **conditional_counts;
+static size_t conditional_counts_size, conditional_counts_cap;
+
+static int is_directive(struct token_list *tokens, int idx, const char *name) {
+	return idx + 1 < tokens->size &&
+		tokens->list[idx].type == PP_DIRECTIVE &&
+		!tokens->list[idx + 1].first_of_line &&
+		sv_string_cmp(tokens->list[idx + 1].str, name);
+}
+
+// Sets whether the directive at idx ends the previous group, starts a new
+// group and has a condition. Returns 0 if it is not a conditional directive.
+static int is_conditional(struct token_list *tokens, int idx, int *ends, int *starts, int *has_condition) {
+	static const char *names[] = { "if", "ifdef", "ifndef", "elif", "elifdef", "elifndef", "else", "endif" };
+
+	for (int i = 0; i < (int)(sizeof names / sizeof *names); i++) {
+		if (is_directive(tokens, idx, names[i])) {
+			*ends = i >= 3;
+			*starts = i != 7;
+			*has_condition = i < 6;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static struct conditional_jumps find_conditional_jumps(struct token_list *tokens) {
+	struct conditional_jumps jumps = { 0 };
+
+	// Groups that are still open, innermost last.
+	int open_size = 0, open_cap = 0;
+	int *open = NULL;
+
+	int conditions = 0;
+	for (int i = 0; i < tokens->size; i++) {
+		int ends, starts, has_condition;
+		if (tokens->list[i].type != PP_DIRECTIVE ||
+			!is_conditional(tokens, i, &ends, &starts, &has_condition))
+			continue;
+
+		if (ends && open_size) {
+			struct conditional_jump *group = jumps.list + open[--open_size];
+			group->to = i;
+			group->nested = conditions - group->nested;
+		}
+
+		conditions += has_condition;
+
+		if (starts) {
+			ADD_ELEMENT(open_size, open_cap, open) = jumps.size;
+			ADD_ELEMENT(jumps.size, jumps.cap, jumps.list) = (struct conditional_jump) {
+				.offset = tokens->list[i].pos.offset,
+				.to = -1,
+				.nested = conditions,
+			};
+		}
+	}
+
+	free(open);
+
+	return jumps;
+}
+
+static struct conditional_jump *find_jump(struct conditional_jumps *jumps, int offset) {
+	int low = 0, high = jumps->size;
+	while (low < high) {
+		int mid = (low + high) / 2;
+		if (jumps->list[mid].offset == offset)
+			return jumps->list[mid].to == -1 ? NULL : jumps->list + mid;
+		if (jumps->list[mid].offset < offset)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	return NULL;
+}
+
+static struct cached_tokens *token_cache_find(const char *path) {
+	if (token_cache_size * 2 >= token_cache_cap) {
+		struct cached_tokens *old = token_cache;
+		size_t old_cap = token_cache_cap;
+
+		token_cache_cap = MAX(token_cache_cap * 2, 256);
+		token_cache = cc_malloc(sizeof *token_cache * token_cache_cap);
+		memset(token_cache, 0, sizeof *token_cache * token_cache_cap);
+
+		for (size_t i = 0; i < old_cap; i++) {
+			if (old[i].path)
+				*token_cache_find(old[i].path) = old[i];
+		}
+
+		free(old);
+	}
+
+	size_t idx = sv_hash(sv_from_str((char *)path)) & (token_cache_cap - 1);
+	while (token_cache[idx].path && strcmp(token_cache[idx].path, path) != 0)
+		idx = (idx + 1) & (token_cache_cap - 1);
+
+	return token_cache + idx;
+}
+
+static int has_changed(struct cached_tokens *entry) {
+	uint64_t size, hash;
+	return !input_stamp(entry->path, &size, &hash) ||
+		size != entry->size || hash != entry->hash;
+}
+
+// Unless the file is tokenized or its cached tokens are open, it is opened
+// and input is set. The first time a file is read it is left to be read as
+// a stream.
+static struct cached_tokens get_tokens(const char *path, struct input *input) {
+	struct cached_tokens *entry = token_cache_find(path);
+
+	int is_new = !entry->path;
+	if (is_new) {
+		entry->path = strdup(path);
+		entry->conditionals = ALLOC((struct conditional_count) { .path = entry->path });
+		ADD_ELEMENT(conditional_counts_size, conditional_counts_cap, conditional_counts) = entry->conditionals;
+		token_cache_size++;
+	} else if ((entry->is_tokenized || entry->is_cached) &&
+			   entry->checked_unit != translation_unit && has_changed(entry)) {
+		// The old tokens can still be in use by an open file, so they are not freed.
+		entry->is_tokenized = 0;
+		entry->is_cached = 0;
+		entry->tokens = (struct token_list) { 0 };
+		entry->jumps = (struct conditional_jumps) { 0 };
+		input_set_guard(path, 0);
+	}
+
+	entry->checked_unit = translation_unit;
+
+	if (entry->is_tokenized || entry->is_cached)
+		return *entry;
+
+	*input = input_open(path);
+	entry->size = input->size;
+	entry->hash = input_hash(input->contents, input->size);
+
+	if (token_cache_dir &&
+		precompiled_open_tokens(token_cache_dir, entry->path, input->contents, entry->size, entry->hash, &entry->cached)) {
+		entry->is_cached = 1;
+		token_cache_loaded++;
+	} else if (!is_new || token_cache_dir) {
+		entry->tokens = tokenize_input(input->contents, entry->path);
+		entry->jumps = find_conditional_jumps(&entry->tokens);
+		entry->is_tokenized = 1;
+
+		if (token_cache_dir)
+			token_cache_saved += precompiled_save_tokens(token_cache_dir, entry->path, entry->size, entry->hash, &entry->tokens);
+	}
+
+	return *entry;
+}
+
+void directiver_print_conditionals(FILE *fp) {
+	int evaluated = 0, skipped = 0;
+
+	fprintf(fp, "Conditional directives:\n");
+	fprintf(fp, "%10s %10s  %s\n", "evaluated", "skipped", "file");
+	for (size_t i = 0; i < conditional_counts_size; i++) {
+		struct conditional_count *count = conditional_counts[i];
+		fprintf(fp, "%10d %10d  %s\n", count->evaluated, count->skipped, count->path);
+		evaluated += count->evaluated;
+		skipped += count->skipped;
+	}
+	fprintf(fp, "%10d %10d  total\n", evaluated, skipped);
+
+	if (token_cache_dir)
+		fprintf(fp, "Token cache: %d loaded, %d saved\n", token_cache_loaded, token_cache_saved);
+}
 
 struct macro_stack {
 	size_t size, cap;
@@ -39,6 +294,14 @@ static char **deps;
 
 static struct token_list buffered_tokens = { 0 };
 
+void directiver_keep_tokens(void) {
+	keep_streamed_tokens = 1;
+}
+
+void directiver_set_token_cache(const char *dir) {
+	token_cache_dir = dir;
+}
+
 void directiver_write_dependencies(void) {
 	write_dependencies = 1;
 }
@@ -56,11 +319,27 @@ void directiver_finish_writing_dependencies(const char *mt, const char *mf) {
 	fclose(fp);
 }
 
+void directiver_add_dependency(const char *path) {
+	if (write_dependencies)
+		ADD_ELEMENT(dep_size, dep_cap, deps) = strdup(path);
+}
+
+char **directiver_get_dependencies(size_t *count) {
+	*count = dep_size;
+	return deps;
+}
+
 // Resets all global state. Not very elegant.
 void directiver_reset(void) {
-	new_path = NULL;
-	line_diff = 0;
 	current_file = NULL;
+	translation_unit++;
+	keep_streamed_tokens = 0;
+
+	for (size_t i = 0; i < macro_stack_size; i++) {
+		for (size_t j = 0; j < macro_stacks[i].size; j++)
+			define_free(&macro_stacks[i].defines[j]);
+		free(macro_stacks[i].defines);
+	}
 
 	macro_stack_size = macro_stack_cap = 0;
 	free(macro_stacks);
@@ -73,22 +352,226 @@ void directiver_reset(void) {
 	deps = NULL;
 }
 
+// Returns the controlling macro if tokens start with
+// #ifndef X / #if !defined X / #if !defined(X)
+// followed by a new line, and sets idx to the token after it.
+// Otherwise returns 0.
+static atom match_guard_opening(struct token_list *tokens, int *idx) {
+	atom none = 0;
+	struct token *list = tokens->list;
+
+	struct token macro;
+	if (is_directive(tokens, 0, "ifndef") && tokens->size > 2) {
+		macro = list[2];
+		*idx = 3;
+	} else if (is_directive(tokens, 0, "if") && tokens->size > 4 &&
+			   list[2].type == T_NOT && sv_string_cmp(list[3].str, "defined")) {
+		if (list[4].type == T_LPAR) {
+			if (tokens->size <= 6 || list[6].type != T_RPAR)
+				return none;
+			macro = list[5];
+			*idx = 7;
+		} else {
+			macro = list[4];
+			*idx = 5;
+		}
+	} else {
+		return none;
+	}
+
+	// The whole directive is on one line, and nothing follows it.
+	for (int i = 2; i < *idx; i++) {
+		if (list[i].first_of_line)
+			return none;
+	}
+
+	if (macro.type != T_IDENT || (*idx < tokens->size && !list[*idx].first_of_line))
+		return none;
+
+	return macro.id;
+}
+
+static void guard_inside(struct guard_detector *guard, struct token t) {
+	if (guard->state == GUARD_CLOSED) {
+		// Only tokens on the same line as the last #endif are allowed.
+		if (t.first_of_line)
+			guard->state = GUARD_NONE;
+	} else if (guard->prev.type == PP_DIRECTIVE && !t.first_of_line) {
+		if (sv_string_cmp(t.str, "if") ||
+			sv_string_cmp(t.str, "ifdef") ||
+			sv_string_cmp(t.str, "ifndef")) {
+			guard->depth++;
+		} else if (guard->depth == 1 &&
+				   (sv_string_cmp(t.str, "else") ||
+					sv_string_cmp(t.str, "elif") ||
+					sv_string_cmp(t.str, "elifdef") ||
+					sv_string_cmp(t.str, "elifndef"))) {
+			guard->state = GUARD_NONE;
+		} else if (sv_string_cmp(t.str, "endif") && --guard->depth == 0) {
+			guard->state = GUARD_CLOSED;
+		}
+	}
+
+	guard->prev = t;
+}
+
+static void guard_match_opening(struct guard_detector *guard) {
+	struct token_list opening = { .size = guard->size, .list = guard->opening };
+
+	int idx = 0;
+	guard->macro = match_guard_opening(&opening, &idx);
+	if (!guard->macro) {
+		guard->state = GUARD_NONE;
+		return;
+	}
+
+	guard->state = GUARD_INSIDE;
+	guard->depth = 1;
+	for (int i = idx; i < guard->size; i++)
+		guard_inside(guard, guard->opening[i]);
+}
+
+static void guard_add(struct guard_detector *guard, struct token t) {
+	if (guard->state == GUARD_OPENING) {
+		guard->opening[guard->size++] = t;
+		if (guard->size == GUARD_OPENING_SIZE)
+			guard_match_opening(guard);
+	} else if (guard->state != GUARD_NONE) {
+		guard_inside(guard, t);
+	}
+}
+
+// Returns the controlling macro if the file has the form
+// #ifndef X / #if !defined X / #if !defined(X)
+// ...
+// #endif
+// with nothing outside of the conditional. Otherwise returns 0.
+static atom guard_finish(struct guard_detector *guard) {
+	if (guard->state == GUARD_OPENING)
+		guard_match_opening(guard);
+
+	return guard->state == GUARD_CLOSED ? guard->macro : 0;
+}
+
+static atom find_include_guard(struct token_list *tokens) {
+	struct guard_detector guard = { 0 };
+
+	for (int i = 0; i < tokens->size && guard.state != GUARD_NONE; i++)
+		guard_add(&guard, tokens->list[i]);
+
+	return guard_finish(&guard);
+}
+
 void directiver_push_input(const char *path, int system) {
 	const char *parent_path = current_file ? current_file->path : ".";
-	struct input new_input = input_open(parent_path, path, system);
+	const char *opened_path = input_find(parent_path, path, system);
 
-	if (!new_input.path)
+	if (!opened_path)
 		return;
 
-	if (write_dependencies)
-		ADD_ELEMENT(dep_size, dep_cap, deps) = strdup(new_input.path);
+	// Multiple-include optimization, skip the file without
+	// opening it if the include guard is already defined.
+	atom guard = input_get_guard(opened_path);
+	if (guard && define_map_get(guard))
+		return;
+
+	directiver_add_dependency(opened_path);
+
+	struct input input;
+	struct cached_tokens cached = get_tokens(opened_path, &input);
 
-	current_file = ALLOC((struct tokenized_file) {
+	// The guard is forgotten if the file has changed.
+	guard = input_get_guard(opened_path);
+
+	struct tokenized_file *file = ALLOC((struct tokenized_file) {
 			.parent = current_file,
 			.token_idx = 0,
-			.tokens = tokenize_input(new_input.contents, new_input.path),
-			.path = strdup(new_input.path),
+			.tokens = cached.tokens,
+			.is_stream = !cached.is_tokenized,
+			.path = strdup(opened_path),
+			.conditionals = cached.conditionals,
+			.jumps = cached.jumps,
 		});
+
+	if (file->is_stream) {
+		// The guard is found when the end of the file is reached.
+		file->is_cached = cached.is_cached;
+		if (file->is_cached)
+			file->cached = cached.cached;
+		else
+			tokenizer_open(&file->stream, input.contents, cached.path);
+		file->find_guard = !guard;
+		file->keep_tokens = keep_streamed_tokens && file->parent != NULL;
+	} else if (!guard) {
+		atom macro = find_include_guard(&file->tokens);
+		if (macro)
+			input_set_guard(opened_path, macro);
+	}
+
+	current_file = file;
+}
+
+static struct token read_stream(struct tokenized_file *file) {
+	struct token t = file->is_cached ? precompiled_read_token(&file->cached) : tokenizer_read(&file->stream);
+
+	if (file->find_guard && t.type != T_EOI)
+		guard_add(&file->guard, t);
+
+	if (file->keep_tokens && t.type != T_EOI)
+		token_list_add(&file->tokens, t);
+
+	return t;
+}
+
+// Token n places ahead in the file, without taking it.
+static struct token *peek_raw(struct tokenized_file *file, int n) {
+	static struct token end = { .type = T_EOI, .first_of_line = 1 };
+
+	if (!file->is_stream)
+		return file->token_idx + n < file->tokens.size ? file->tokens.list + file->token_idx + n : &end;
+
+	assert(n < (int)(sizeof file->ahead / sizeof *file->ahead));
+	while (file->ahead_size <= n)
+		file->ahead[file->ahead_size++] = read_stream(file);
+
+	return file->ahead + n;
+}
+
+static void skip_raw(struct tokenized_file *file, int n) {
+	if (file->is_stream) {
+		peek_raw(file, n - 1);
+		file->ahead_size -= n;
+		memmove(file->ahead, file->ahead + n, sizeof *file->ahead * file->ahead_size);
+	}
+
+	file->token_idx += n;
+}
+
+const char *directiver_first_include(void) {
+	if (current_file->token_idx != 0)
+		return NULL;
+
+	// The end of the file counts as the start of a line.
+	struct token *hash = peek_raw(current_file, 0), *name = peek_raw(current_file, 1),
+		*after = peek_raw(current_file, 3);
+	if (hash->type != PP_DIRECTIVE || name->first_of_line || !sv_string_cmp(name->str, "include") ||
+		peek_raw(current_file, 2)->first_of_line || !after->first_of_line)
+		return NULL;
+
+	struct token path_tok = *peek_raw(current_file, 2);
+	if (path_tok.type != PP_HEADER_NAME_H && path_tok.type != PP_HEADER_NAME_Q &&
+		(path_tok.type != T_STRING || path_tok.str.str[0] != '"'))
+		return NULL;
+
+	struct string_view path = path_tok.str;
+	path.len -= 2;
+	path.str++;
+
+	return input_find(current_file->path, sv_to_str(path), path_tok.type == PP_HEADER_NAME_H);
+}
+
+void directiver_skip_first_include(void) {
+	skip_raw(current_file, 3);
 }
 
 static char *get_digit_string(int num) {
@@ -125,17 +608,60 @@ static void directiver_embed(const char *path, int system) {
 
 static struct token next(void);
 
-static struct token next_from_stack(void) {
-	if (current_file->token_idx == current_file->tokens.size) {
-		if (current_file->parent) {
-			token_list_free(&current_file->tokens);
-			current_file = current_file->parent;
-			return next();
-		}
+static struct token end_of_file(void) {
+	if (current_file->parent) {
+		current_file = current_file->parent;
+		return next();
+	}
+
+	// Ends the line, so that directives at the end of the input terminate.
+	return (struct token) { .type = T_EOI, .first_of_line = 1 };
+}
+
+static struct token next_from_stream(struct tokenized_file *file) {
+	struct token t;
+	if (file->ahead_size) {
+		t = file->ahead[0];
+		skip_raw(file, 1);
+	} else {
+		t = read_stream(file);
+		file->token_idx++;
+	}
+
+	if (t.type != T_EOI)
+		return t;
 
-		return (struct token ) { .type = T_EOI };
+	if (file->find_guard) {
+		atom macro = guard_finish(&file->guard);
+		if (macro)
+			input_set_guard(file->path, macro);
+		file->find_guard = 0;
+	}
+
+	if (file->keep_tokens) {
+		// The file may have been tokenized in full by an #include of itself.
+		struct cached_tokens *entry = token_cache_find(file->path);
+		if (entry->is_tokenized) {
+			token_list_free(&file->tokens);
+			file->tokens = (struct token_list) { 0 };
+		} else {
+			entry->tokens = file->tokens;
+			entry->jumps = find_conditional_jumps(&entry->tokens);
+			entry->is_tokenized = 1;
+		}
+		file->keep_tokens = 0;
 	}
 
+	return end_of_file();
+}
+
+static struct token next_from_stack(void) {
+	if (current_file->is_stream)
+		return next_from_stream(current_file);
+
+	if (current_file->token_idx == current_file->tokens.size)
+		return end_of_file();
+
 	return current_file->tokens.list[current_file->token_idx++];
 }
 
@@ -153,9 +679,8 @@ static struct token next(void) {
 	} else {
 		t = next_from_stack();
 	}
-	t.pos.line += line_diff;
-	if (new_path)
-		t.pos.path = new_path;
+	if (current_file->line_source && t.pos.source)
+		t.pos.source = current_file->line_source;
 	return t;
 }
 
@@ -205,196 +730,17 @@ static void directiver_define(void) {
 }
 
 static struct token_list buffer;
-static int buffer_pos;
-
-static struct token buffer_next(void) {
-	if (buffer_pos >= buffer.size)
-		return (struct token) { .type = T_EOI, .str = { 0 } };
-	struct token *t = buffer.list + buffer_pos;
-	if (t->type == T_IDENT) {
-		buffer_pos++;
-		return (struct token) { .type = T_NUM, .str = sv_from_str("0") };
-	} else {
-		return buffer.list[buffer_pos++];
-	}
-}
-
-struct result {
-	int is_signed;
-	union {
-		intmax_t i;
-		uintmax_t u;
-	};
-};
-
-static struct result result_signed(intmax_t val) {
-	return (struct result) { .is_signed = 1, .i = val };
-}
-
-static struct result result_unsigned(intmax_t val) {
-	return (struct result) { .is_signed = 0, .u = val };
-}
-
-int result_is_zero(struct result result) {
-	return result.is_signed ? (result.i == 0) : (result.u == 0);
-}
-
-void check_div_overflow(struct token *t,
-						struct result lhs, struct result rhs) {
-	if (result_is_zero(rhs))
-		ERROR(t->pos, "Division by zero");
-	if (lhs.is_signed && lhs.i == INTMAX_MIN && rhs.i == -1)
-		ERROR(t->pos, "Division will overflow");
-}
-
-#define RESULT_UNARY(OP, EXPR) ((EXPR).is_signed				\
-								? result_signed(OP (EXPR).i)	\
-								: result_unsigned(OP (EXPR).u))
-
-#define RESULT_BINARY(OP, LHS, RHS) ((LHS).is_signed					\
-									 ? result_signed((LHS).i OP (RHS).i) \
-									 : result_unsigned((LHS).u OP (RHS).u))
-
-// Conditionals always returns signed integers.
-#define RESULT_BINARY_COND(OP, LHS, RHS) ((LHS).is_signed				\
-										  ? result_signed((LHS).i OP (RHS).i) \
-										  : result_signed((LHS).u OP (RHS).u))
 
-// TODO: Ensure no UB. Don't allow operators to overflow.
-static struct result evaluate_expression(int prec, int evaluate) {
-	struct result expr = result_signed(0);
-	struct token t = buffer_next();
-
-	if (t.type == T_ADD) {
-		expr = evaluate_expression(PREFIX_PREC, evaluate);
-	} else if (t.type == T_SUB) {
-		struct result rhs = evaluate_expression(PREFIX_PREC, evaluate);
-		expr = RESULT_UNARY(-, rhs);
-	} else if (t.type == T_NOT) {
-		struct result rhs = evaluate_expression(PREFIX_PREC, evaluate);
-		expr = RESULT_UNARY(!, rhs);
-	} else if (t.type == T_LPAR) {
-		expr = evaluate_expression(0, evaluate);
-		struct token rpar = buffer_next();
-		if (rpar.type != T_RPAR)
-			ERROR(rpar.pos, "Expected ), got %s", dbg_token_type(rpar.type));
-	} else if (t.type == T_NUM) {
-		struct constant c = constant_from_string(t.str);
-		assert(c.type == CONSTANT_TYPE);
-		if (type_is_floating(c.data_type))
-			ERROR(t.pos, "Floating point arithmetic in the preprocessor is not allowed.");
-		if (!type_is_integer(c.data_type))
-			ERROR(t.pos, "Preprocessor variables must be of integer type.");
-		if (is_signed(c.data_type->simple))
-			expr = result_signed(c.int_d);
-		else
-			expr = result_unsigned(c.uint_d);
-	} else if (t.type == T_CHARACTER_CONSTANT) {
-		expr = result_signed(escaped_character_constant_to_int(t));
-	} else {
-		ERROR(t.pos, "Invalid token in preprocessor expression. %s", dbg_token(&t));
-	}
-
-	t = buffer_next();
-
-	while (prec < precedence_get(t.type, 1)) {
-		int new_prec = precedence_get(t.type, 0);
-
-		if (t.type == T_QUEST) {
-			struct result mid = evaluate_expression(0, !result_is_zero(expr) ? evaluate : 0);
-			struct token colon = buffer_next();
-			assert(colon.type == T_COLON);
-			struct result rhs = evaluate_expression(new_prec, result_is_zero(expr) ? evaluate : 0);
-			expr = !result_is_zero(expr) ? mid : rhs;
-		} else if (t.type == T_AND) {
-			struct result rhs = evaluate_expression(new_prec, !result_is_zero(expr) ? evaluate : 0);
-			expr = result_signed(!result_is_zero(expr) && !result_is_zero(rhs));
-		} else if (t.type == T_OR) {
-			struct result rhs = evaluate_expression(new_prec, result_is_zero(expr) ? evaluate : 0);
-			expr = result_signed(!result_is_zero(expr) || !result_is_zero(rhs));
-		} else {
-			// Standard binary operator.
-			struct result rhs = evaluate_expression(new_prec, evaluate);
-
-			// Integer -> Unsigned integer promotion.
-			if (rhs.is_signed && !expr.is_signed)
-				rhs = result_unsigned(rhs.i);
-			else if (!rhs.is_signed && expr.is_signed)
-				expr = result_unsigned(expr.i);
-
-			if (evaluate) {
-				switch (t.type) {
-				case T_BOR: expr = RESULT_BINARY(|, expr, rhs); break;
-				case T_XOR: expr = RESULT_BINARY(^, expr, rhs); break;
-				case T_AMP: expr = RESULT_BINARY(&, expr, rhs); break;
-				case T_EQ: expr = RESULT_BINARY_COND(==, expr, rhs); break;
-				case T_NEQ: expr = RESULT_BINARY_COND(!=, expr, rhs); break;
-				case T_LEQ: expr = RESULT_BINARY_COND(<=, expr, rhs); break;
-				case T_GEQ: expr = RESULT_BINARY_COND(>=, expr, rhs); break;
-				case T_L: expr = RESULT_BINARY_COND(<, expr, rhs); break;
-				case T_G: expr = RESULT_BINARY_COND(>, expr, rhs); break;
-				case T_LSHIFT: expr = RESULT_BINARY(<<, expr, rhs); break;
-				case T_RSHIFT: expr = RESULT_BINARY(>>, expr, rhs); break;
-				case T_ADD: expr = RESULT_BINARY(+, expr, rhs); break;
-				case T_SUB: expr = RESULT_BINARY(-, expr, rhs); break;
-				case T_STAR: expr = RESULT_BINARY(*, expr, rhs); break;
-				case T_DIV:
-					check_div_overflow(&t, expr, rhs);
-					expr = RESULT_BINARY(/, expr, rhs);
-					break;
-				case T_MOD:
-					check_div_overflow(&t, expr, rhs);
-					expr = RESULT_BINARY(%, expr, rhs);
-					break;
-				default:
-					ERROR(t.pos, "Invalid infix %s", dbg_token(&t));
-				}
-			}
-		}
-
-		t = buffer_next();
-	}
-
-	if (buffer_pos == 0)
-		ICE("Buffer should not be empty.");
-	buffer.list[--buffer_pos] = t;
-
-	return expr;
-}
-
-static struct result evaluate_until_newline(void) {
+static int evaluate_until_newline(void) {
 	buffer.size = 0;
 	struct token t = next();
 	while (!t.first_of_line) {
-		if (sv_string_cmp(t.str, "defined")) {
-			t = next();
-			int has_lpar = t.type == T_LPAR;
-			if (has_lpar)
-				t = next();
-
-			int is_defined = define_map_get(t.str) != NULL;
-			token_list_add(&buffer, (struct token) {.type = T_NUM, .str = is_defined ? sv_from_str("1") :
-					sv_from_str("0")});
-
-			t = next();
-
-			if (has_lpar) {
-				EXPECT(&t, T_RPAR);
-				t = next();
-			}
-		} else {
-			token_list_add(&buffer, t);
-
-			t = next();
-		}
+		token_list_add(&buffer, t);
+		t = next();
 	}
 	push(t);
 
-	expand_token_list(&buffer);
-	token_list_add(&buffer, (struct token) { .type = T_EOI });
-
-	buffer_pos = 0;
-	return evaluate_expression(0, 1);
+	return condition_evaluate(&buffer);
 }
 
 static struct string_view get_include_path(struct token dir, struct token t, int *system) {
@@ -416,20 +762,19 @@ static struct string_view get_include_path(struct token dir, struct token t, int
 	path.len -= 2;
 	path.str++;
 
-	buffer_pos = 0;
 	return path;
 }
 
 static int directiver_evaluate_conditional(struct token dir) {
 	if (sv_string_cmp(dir.str, "ifdef") ||
 		sv_string_cmp(dir.str, "elifdef")) {
-		return (define_map_get(next().str) != NULL);
+		return (define_map_get(next().id) != NULL);
 	} else if (sv_string_cmp(dir.str, "ifndef") ||
 			   sv_string_cmp(dir.str, "elifndef")) {
-		return !(define_map_get(next().str) != NULL);
+		return !(define_map_get(next().id) != NULL);
 	} else if (sv_string_cmp(dir.str, "if") ||
 			   sv_string_cmp(dir.str, "elif")) {
-		return !result_is_zero(evaluate_until_newline());
+		return evaluate_until_newline();
 	} else if (sv_string_cmp(dir.str, "else")) {
 		return 1;
 	}
@@ -451,9 +796,9 @@ static void push_macro(struct string_view name) {
 		*stack = (struct macro_stack) { 0 };
 	}
 
-	struct define *current_define = define_map_get(name);
+	struct define *current_define = define_map_get(atom_intern(name));
 	if (current_define)
-		ADD_ELEMENT(stack->size, stack->cap, stack->defines) = *current_define;
+		ADD_ELEMENT(stack->size, stack->cap, stack->defines) = define_copy(current_define);
 }
 
 static void pop_macro(struct string_view name) {
@@ -470,8 +815,10 @@ static void pop_macro(struct string_view name) {
 
 	define_map_add(stack->defines[--stack->size]);
 
-	if (!stack->size)
+	if (!stack->size) {
+		free(stack->defines);
 		REMOVE_ELEMENT(macro_stack_size, macro_stacks, stack - macro_stacks);
+	}
 }
 
 static int directiver_handle_pragma(void) {
@@ -519,20 +866,66 @@ static int directiver_handle_pragma(void) {
 	return 0;
 }
 
+// Continue at the #elif, #else or #endif that ends the group started by
+// the directive at hash, without reading the tokens in between.
+static void skip_group(struct tokenized_file *file, struct token hash) {
+	if (file != current_file)
+		return;
+
+	if (file->is_stream) {
+		// The group starts at the first token that has not been taken.
+		struct token *from = file->pushed_idx ? file->pushed + file->pushed_idx - 1 :
+			file->ahead_size ? file->ahead : file->is_cached ? &file->cached.next : &file->stream.next;
+		if (from->type == T_EOI)
+			return;
+
+		if (file->is_cached)
+			file->conditionals->skipped += precompiled_skip_group(&file->cached, from);
+		else
+			file->conditionals->skipped += tokenizer_skip_group(&file->stream, from);
+		file->pushed_idx = 0;
+		file->ahead_size = 0;
+
+		// The tokens of the group are missing.
+		if (file->keep_tokens) {
+			token_list_free(&file->tokens);
+			file->tokens = (struct token_list) { 0 };
+			file->keep_tokens = 0;
+		}
+		return;
+	}
+
+	struct conditional_jump *jump = find_jump(&file->jumps, hash.pos.offset);
+	if (!jump)
+		return;
+
+	file->token_idx = jump->to;
+	file->pushed_idx = 0;
+	file->conditionals->skipped += jump->nested;
+}
+
 struct token directiver_next(void) {
+	// Conditionals that are open, 1 if the current group is taken, 0 if a
+	// later group can be taken, and -1 otherwise.
 	static int cond_stack_n = 0, cond_stack_cap = 0;
-	static int *cond_stack = NULL;
+	static struct conditional {
+		int state;
+		struct position pos; // Of the #if.
+	} *cond_stack = NULL;
 
 	if (buffered_tokens.size)
 		return token_list_take_first(&buffered_tokens);
 
 	if (cond_stack_n == 0)
-		ADD_ELEMENT(cond_stack_n, cond_stack_cap, cond_stack) = 1;
+		ADD_ELEMENT(cond_stack_n, cond_stack_cap, cond_stack) = (struct conditional) { .state = 1 };
 
 	struct token t = next();
 	int pass_directive = 0;
-	while ((t.type == PP_DIRECTIVE || cond_stack[cond_stack_n - 1] != 1) &&
+	while ((t.type == PP_DIRECTIVE || cond_stack[cond_stack_n - 1].state != 1) &&
 		!pass_directive) {
+		if (t.type == T_EOI)
+			break;
+
 		if (t.type != PP_DIRECTIVE) {
 			t = next();
 			continue;
@@ -545,41 +938,52 @@ struct token directiver_next(void) {
 		}
 
 		if (directive.type != T_IDENT &&
-			cond_stack[cond_stack_n - 1] != 1) {
+			cond_stack[cond_stack_n - 1].state != 1) {
 			t = directive;
 			continue;
 		}
 
 		struct string_view name = directive.str;
+		struct tokenized_file *file = current_file;
 
 		assert(directive.type == T_IDENT);
 
 		if (sv_string_cmp(name, "ifndef") ||
 			sv_string_cmp(name, "ifdef") ||
 			sv_string_cmp(name, "if")) {
-			if (cond_stack[cond_stack_n - 1] == 1) {
+			if (cond_stack[cond_stack_n - 1].state == 1) {
 				int result = directiver_evaluate_conditional(directive);
-				ADD_ELEMENT(cond_stack_n, cond_stack_cap, cond_stack) = result ? 1 : 0;
+				ADD_ELEMENT(cond_stack_n, cond_stack_cap, cond_stack) = (struct conditional) { result ? 1 : 0, t.pos };
+				current_file->conditionals->evaluated++;
+				if (!result)
+					skip_group(file, t);
 			} else {
-				ADD_ELEMENT(cond_stack_n, cond_stack_cap, cond_stack) = -1;
+				ADD_ELEMENT(cond_stack_n, cond_stack_cap, cond_stack) = (struct conditional) { -1, t.pos };
+				current_file->conditionals->skipped++;
 			}
 		} else if (sv_string_cmp(name, "elif") ||
 				   sv_string_cmp(name, "else") ||
 				   sv_string_cmp(name, "elifndef") ||
 				   sv_string_cmp(name, "elifdef")) {
-			if (cond_stack[cond_stack_n - 1] == 0) {
+			int has_condition = !sv_string_cmp(name, "else");
+			if (cond_stack[cond_stack_n - 1].state == 0) {
 				int result = directiver_evaluate_conditional(directive);
-				cond_stack[cond_stack_n - 1] = result;
+				cond_stack[cond_stack_n - 1].state = result;
+				current_file->conditionals->evaluated += has_condition;
 			} else {
-				cond_stack[cond_stack_n - 1] = -1;
+				cond_stack[cond_stack_n - 1].state = -1;
+				current_file->conditionals->skipped += has_condition;
 			}
+
+			if (cond_stack[cond_stack_n - 1].state != 1)
+				skip_group(file, t);
 		} else if (sv_string_cmp(name, "endif")) {
 			cond_stack_n--;
-		} else if (cond_stack[cond_stack_n - 1] == 1) {
+		} else if (cond_stack[cond_stack_n - 1].state == 1) {
 			if (sv_string_cmp(name, "define")) {
 				directiver_define();
 			} else if (sv_string_cmp(name, "undef")) {
-				define_map_remove(next().str);
+				define_map_remove(next().id);
 			} else if (sv_string_cmp(name, "error")) {
 				struct token msg = next();
 				if (msg.type == T_STRING)
@@ -587,10 +991,6 @@ struct token directiver_next(void) {
 				else
 					ERROR(directive.pos, "#error directive was invoked.");
 			} else if (sv_string_cmp(name, "include")) {
-				// There is an issue with just resetting after include. But
-				// I'm interpreting the standard liberally to allow for this.
-				new_path = NULL;
-				line_diff = 0;
 				struct string_view path;
 				struct token path_tok = next();
 				int system;
@@ -672,8 +1072,7 @@ struct token directiver_next(void) {
 				if (digit_seq.first_of_line || digit_seq.type != T_NUM)
 					ERROR(digit_seq.pos, "Expected digit sequence after #line");
 
-				line_diff += atoi(sv_to_str(digit_seq.str)) - directive.pos.line - 1;
-
+				const char *new_path = NULL;
 				if (has_s_char_seq) {
 					if (s_char_seq.type != T_STRING)
 						ERROR(s_char_seq.pos, "Expected s char sequence as second argument to #line");
@@ -681,6 +1080,8 @@ struct token directiver_next(void) {
 					s_char_seq.str.str++;
 					new_path = sv_to_str(s_char_seq.str);
 				}
+
+				current_file->line_source = input_line_directive(directive.pos, atoi(sv_to_str(digit_seq.str)), new_path);
 			} else {
 				ERROR(directive.pos, "#%s not implemented", dbg_token(&directive));
 			}
@@ -689,5 +1090,8 @@ struct token directiver_next(void) {
 		t = next();
 	}
 
+	if (t.type == T_EOI && cond_stack_n > 1)
+		ERROR(cond_stack[cond_stack_n - 1].pos, "Conditional directive is not terminated by #endif.");
+
 	return t;
 }
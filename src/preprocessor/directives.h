@@ -7,7 +7,19 @@ struct token directiver_next(void);
 void directiver_push_input(const char *path, int system);
 void directiver_reset(void);
 
+// Path of the header if the input starts with an #include of it.
+const char *directiver_first_include(void);
+void directiver_skip_first_include(void);
+
+void directiver_add_dependency(const char *path);
+char **directiver_get_dependencies(size_t *count);
+
+void directiver_keep_tokens(void);
+void directiver_set_token_cache(const char *dir);
+
 void directiver_write_dependencies(void);
 void directiver_finish_writing_dependencies(const char *mt, const char *mf);
 
+void directiver_print_conditionals(FILE *fp);
+
 #endif
@@ -0,0 +1,242 @@
+#include "hide_set.h"
+
+#include <common.h>
+
+#include <string.h>
+
+// Each set is a sorted range of atoms in a shared pool.
+// Sets are hash-consed, so equal sets have the same handle.
+static struct set {
+	int start, size;
+	uint32_t hash;
+} *sets;
+static size_t sets_size, sets_cap;
+
+static size_t pool_size, pool_cap;
+static atom *pool;
+
+// Open addressing with linear probing, the slots hold handles.
+// The empty set is never stored, so 0 marks empty slots.
+static hide_set *table;
+static size_t table_cap;
+
+// Results of previous operations. Direct mapped, a colliding entry
+// replaces the old one.
+#define CACHE_SIZE 4096
+
+enum {
+	CACHE_EMPTY,
+	CACHE_ADD,
+	CACHE_UNION,
+	CACHE_INTERSECTION,
+};
+
+static struct cache_entry {
+	int op, a, b;
+	hide_set result;
+} *cache;
+
+static uint32_t hash_elements(const atom *elements, int size) {
+	uint32_t hash = 2166136261u;
+	for (int i = 0; i < size; i++)
+		hash = (hash ^ (uint32_t)elements[i]) * 16777619u;
+	return hash;
+}
+
+static hide_set *find_slot(const atom *elements, int size, uint32_t hash) {
+	size_t idx = hash & (table_cap - 1);
+
+	while (table[idx]) {
+		struct set *s = sets + table[idx];
+		if (s->hash == hash && s->size == size &&
+			memcmp(pool + s->start, elements, sizeof *elements * size) == 0)
+			break;
+		idx = (idx + 1) & (table_cap - 1);
+	}
+
+	return table + idx;
+}
+
+static void resize(size_t cap) {
+	free(table);
+	table_cap = cap;
+	table = cc_malloc(sizeof *table * table_cap);
+	memset(table, 0, sizeof *table * table_cap);
+
+	for (size_t i = 1; i < sets_size; i++)
+		*find_slot(pool + sets[i].start, sets[i].size, sets[i].hash) = i;
+}
+
+// The new set is built at the end of the pool, with space for max_size atoms.
+static atom *begin_set(int max_size) {
+	return ADD_ELEMENTS(pool_size, pool_cap, pool, max_size);
+}
+
+// Intern the size first atoms of the set started by begin_set(max_size).
+static hide_set end_set(int max_size, int size) {
+	pool_size -= max_size;
+
+	if (!size)
+		return 0;
+
+	if (!sets_size) // Set 0 is the empty set.
+		ADD_ELEMENT(sets_size, sets_cap, sets) = (struct set) { 0 };
+
+	if (sets_size * 2 >= table_cap)
+		resize(MAX(table_cap * 2, 256));
+
+	const atom *elements = pool + pool_size;
+	uint32_t hash = hash_elements(elements, size);
+	hide_set *slot = find_slot(elements, size, hash);
+
+	if (*slot)
+		return *slot;
+
+	pool_size += size;
+	*slot = sets_size;
+	ADD_ELEMENT(sets_size, sets_cap, sets) = (struct set) { pool_size - size, size, hash };
+
+	return *slot;
+}
+
+static struct cache_entry *cache_find(int op, int a, int b) {
+	if (!cache) {
+		cache = cc_malloc(sizeof *cache * CACHE_SIZE);
+		memset(cache, 0, sizeof *cache * CACHE_SIZE);
+	}
+
+	uint32_t idx = ((uint32_t)a * 31 + (uint32_t)b) * 4 + op;
+	return cache + (idx * 2654435769u >> 20) % CACHE_SIZE;
+}
+
+int hide_set_contains(hide_set hs, atom name) {
+	if (!hs)
+		return 0;
+
+	const atom *elements = pool + sets[hs].start;
+	int low = 0, high = sets[hs].size;
+	while (low < high) {
+		int mid = (low + high) / 2;
+		if (elements[mid] == name)
+			return 1;
+		if (elements[mid] < name)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	return 0;
+}
+
+hide_set hide_set_add(hide_set hs, atom name) {
+	if (hide_set_contains(hs, name))
+		return hs;
+
+	struct cache_entry *entry = cache_find(CACHE_ADD, hs, name);
+	if (entry->op == CACHE_ADD && entry->a == hs && entry->b == name)
+		return entry->result;
+
+	int size = hs ? sets[hs].size : 0;
+	atom *elements = begin_set(size + 1);
+	const atom *old = pool + (hs ? sets[hs].start : 0);
+
+	int i = 0;
+	for (; i < size && old[i] < name; i++)
+		elements[i] = old[i];
+	elements[i] = name;
+	for (; i < size; i++)
+		elements[i + 1] = old[i];
+
+	hide_set ret = end_set(size + 1, size + 1);
+	*entry = (struct cache_entry) { CACHE_ADD, hs, name, ret };
+	return ret;
+}
+
+hide_set hide_set_union(hide_set a, hide_set b) {
+	if (!a || a == b)
+		return b;
+	if (!b)
+		return a;
+
+	if (a > b) { // Commutative, only cache one order.
+		hide_set tmp = a;
+		a = b;
+		b = tmp;
+	}
+
+	struct cache_entry *entry = cache_find(CACHE_UNION, a, b);
+	if (entry->op == CACHE_UNION && entry->a == a && entry->b == b)
+		return entry->result;
+
+	int a_size = sets[a].size, b_size = sets[b].size;
+	atom *elements = begin_set(a_size + b_size);
+	const atom *a_elements = pool + sets[a].start, *b_elements = pool + sets[b].start;
+
+	int i = 0, j = 0, size = 0;
+	while (i < a_size || j < b_size) {
+		if (j == b_size || (i < a_size && a_elements[i] < b_elements[j])) {
+			elements[size++] = a_elements[i++];
+		} else if (i == a_size || b_elements[j] < a_elements[i]) {
+			elements[size++] = b_elements[j++];
+		} else {
+			elements[size++] = a_elements[i++];
+			j++;
+		}
+	}
+
+	hide_set ret = end_set(a_size + b_size, size);
+	*entry = (struct cache_entry) { CACHE_UNION, a, b, ret };
+	return ret;
+}
+
+hide_set hide_set_intersection(hide_set a, hide_set b) {
+	if (!a || !b)
+		return 0;
+	if (a == b)
+		return a;
+
+	if (a > b) {
+		hide_set tmp = a;
+		a = b;
+		b = tmp;
+	}
+
+	struct cache_entry *entry = cache_find(CACHE_INTERSECTION, a, b);
+	if (entry->op == CACHE_INTERSECTION && entry->a == a && entry->b == b)
+		return entry->result;
+
+	int a_size = sets[a].size, b_size = sets[b].size;
+	int max_size = MIN(a_size, b_size);
+	atom *elements = begin_set(max_size);
+	const atom *a_elements = pool + sets[a].start, *b_elements = pool + sets[b].start;
+
+	int i = 0, j = 0, size = 0;
+	while (i < a_size && j < b_size) {
+		if (a_elements[i] < b_elements[j]) {
+			i++;
+		} else if (b_elements[j] < a_elements[i]) {
+			j++;
+		} else {
+			elements[size++] = a_elements[i++];
+			j++;
+		}
+	}
+
+	hide_set ret = end_set(max_size, size);
+	*entry = (struct cache_entry) { CACHE_INTERSECTION, a, b, ret };
+	return ret;
+}
+
+void hide_set_reset(void) {
+	free(sets);
+	free(pool);
+	free(table);
+	free(cache);
+	sets = NULL;
+	pool = NULL;
+	table = NULL;
+	cache = NULL;
+	sets_size = sets_cap = 0;
+	pool_size = pool_cap = 0;
+	table_cap = 0;
+}
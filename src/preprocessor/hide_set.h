@@ -0,0 +1,20 @@
+#ifndef HIDE_SET_H
+#define HIDE_SET_H
+
+#include <atom.h>
+
+// Set of macro names that may not be expanded again, see the
+// Prosser algorithm. Sets are immutable and interned, so tokens only
+// hold a handle, and equal sets have equal handles. The results of the
+// operations are cached, since the same sets are combined over and over.
+// The empty set is always 0. Handles are valid until hide_set_reset.
+typedef int hide_set;
+
+hide_set hide_set_add(hide_set hs, atom name);
+hide_set hide_set_union(hide_set a, hide_set b);
+hide_set hide_set_intersection(hide_set a, hide_set b);
+int hide_set_contains(hide_set hs, atom name);
+
+void hide_set_reset(void);
+
+#endif
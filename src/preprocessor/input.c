@@ -5,22 +5,157 @@
 #include <assert.h>
 #include <errno.h>
 
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/mman.h>
+
+// The tokenizer reads a few bytes past the terminating NUL.
+#define INPUT_SENTINEL_SIZE 16
+
 static size_t paths_size = 0, paths_cap;
 static const char **paths = NULL;
 
 // Used for #pragma once.
 static struct string_set disabled_headers;
 
+// Files are mapped directly when the zero-filled tail of the last page
+// is large enough to act as the NUL sentinel, otherwise they are copied.
+// The contents are never freed, tokens point into them.
 static struct input input_create(const char *path, FILE *fp) {
-	fseek(fp, 0, SEEK_END);
-	size_t size = ftell(fp);
+	off_t end = lseek(fileno(fp), 0, SEEK_END);
+	if (end == -1)
+		ICE("Could not get size of %s", path);
+
+	size_t size = end;
+	size_t page_size = sysconf(_SC_PAGESIZE);
+
+	size_t tail = size % page_size ? page_size - size % page_size : 0;
+
+	if (size != 0 && tail >= INPUT_SENTINEL_SIZE) {
+		void *contents = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(fp), 0);
+		if (contents != MAP_FAILED)
+			return (struct input) { .path = path, .contents = contents, .size = size };
+	}
+
 	rewind(fp);
+	char *contents = cc_malloc(size + INPUT_SENTINEL_SIZE);
+	if (size && fread(contents, size, 1, fp) != 1)
+		ICE("Could not read %s", path);
+	memset(contents + size, 0, INPUT_SENTINEL_SIZE);
+
+	return (struct input) { .path = path, .contents = contents, .size = size };
+}
+
+static struct source {
+	const char *path, *contents;
+	int base; // Source that owns the line table, differs from itself after #line.
+	int line_diff;
+
+	int has_lines;
+	int line_size, line_cap;
+	int *lines; // Offsets of the start of each line after the first.
+} *sources;
+static int sources_size, sources_cap;
+
+int input_new_source(const char *path, const char *contents) {
+	if (!sources_size) // Source 0 is for tokens without position.
+		ADD_ELEMENT(sources_size, sources_cap, sources) = (struct source) { 0 };
+
+	int id = sources_size;
+	ADD_ELEMENT(sources_size, sources_cap, sources) = (struct source) {
+		.path = path,
+		.contents = contents,
+		.base = id,
+	};
+
+	return id;
+}
+
+static void add_line(struct source *s, int offset) {
+	ADD_ELEMENT(s->line_size, s->line_cap, s->lines) = offset;
+}
+
+// Line splices are newlines as well, so every '\n' starts a line.
+static struct source *get_lines(int source) {
+	struct source *base = sources + sources[source].base;
+	if (base->has_lines)
+		return base;
+
+	base->has_lines = 1;
+
+	const char *start = base->contents, *end = start + strlen(start), *p = start;
+	while ((p = memchr(p, '\n', end - p)))
+		add_line(base, ++p - start);
+
+	return base;
+}
+
+const int *input_source_lines(int source, int *count, int *line_diff) {
+	struct source *base = get_lines(source);
+	*count = base->line_size;
+	*line_diff = sources[source].line_diff;
+	return base->lines;
+}
 
-	char *contents = cc_malloc(size + 1);
-	fread(contents, size, 1, fp);
-	contents[size] = '\0';
+int input_add_source(const char *path, int line_diff, const int *lines, int count) {
+	int id = input_new_source(path, NULL);
+	struct source *s = sources + id;
+	s->line_diff = line_diff;
+	s->has_lines = 1;
+	for (int i = 0; i < count; i++)
+		add_line(s, lines[i]);
+	return id;
+}
+
+// Line in the file itself, not taking #line into account.
+static int physical_line(struct position pos, int *line_start) {
+	struct source *base = get_lines(pos.source);
+
+	int low = 0, high = base->line_size;
+	while (low < high) {
+		int mid = (low + high) / 2;
+		if (base->lines[mid] <= pos.offset)
+			low = mid + 1;
+		else
+			high = mid;
+	}
 
-	return (struct input) { .path = path, .contents = contents };
+	*line_start = low ? base->lines[low - 1] : 0;
+	return low + 1;
+}
+
+const char *position_path(struct position pos) {
+	return sources_size ? sources[pos.source].path : NULL;
+}
+
+int position_line(struct position pos) {
+	if (!pos.source)
+		return 0;
+
+	int line_start;
+	return physical_line(pos, &line_start) + sources[pos.source].line_diff;
+}
+
+int position_column(struct position pos) {
+	if (!pos.source)
+		return 0;
+
+	int line_start;
+	physical_line(pos, &line_start);
+	return pos.offset - line_start + 1;
+}
+
+int input_line_directive(struct position pos, int line, const char *path) {
+	int line_start;
+	int diff = line - physical_line(pos, &line_start) - 1;
+
+	struct source remapped = sources[pos.source];
+	int id = input_new_source(path ? path : remapped.path, remapped.contents);
+
+	sources[id].base = remapped.base;
+	sources[id].line_diff = diff;
+
+	return id;
 }
 
 static int length_of_path_without_filename(const char *str) {
@@ -32,15 +167,130 @@ static int length_of_path_without_filename(const char *str) {
 	return slash_pos;
 }
 
-static FILE *try_open_file(const char *path, const char *modes) {
+// Results of previous lookups, both found and missing files.
+// Kept for the whole run, since the file system is not expected to change.
+static struct path_entry {
+	char *path;
+	int exists;
+	atom guard; // Include guard macro of the file, 0 if it has none.
+} *path_cache;
+static size_t path_cache_size, path_cache_cap;
+
+static struct path_entry *path_cache_find(const char *path) {
+	if (path_cache_size * 2 >= path_cache_cap) {
+		struct path_entry *old = path_cache;
+		size_t old_cap = path_cache_cap;
+
+		path_cache_cap = MAX(path_cache_cap * 2, 256);
+		path_cache = cc_malloc(sizeof *path_cache * path_cache_cap);
+		memset(path_cache, 0, sizeof *path_cache * path_cache_cap);
+
+		for (size_t i = 0; i < old_cap; i++) {
+			if (old[i].path)
+				*path_cache_find(old[i].path) = old[i];
+		}
+
+		free(old);
+	}
+
+	size_t idx = sv_hash(sv_from_str((char *)path)) & (path_cache_cap - 1);
+	while (path_cache[idx].path && strcmp(path_cache[idx].path, path) != 0)
+		idx = (idx + 1) & (path_cache_cap - 1);
+
+	return path_cache + idx;
+}
+
+// Check if path exists, and remember the result.
+static int file_exists(const char *path) {
+	struct path_entry *entry = path_cache_find(path);
+
+	if (!entry->path) {
+		entry->path = strdup(path);
+		entry->exists = access(path, F_OK) == 0;
+		path_cache_size++;
+	}
+
+	return entry->exists;
+}
+
+static FILE *open_file(const char *path, const char *modes) {
 	FILE *fp = fopen(path, modes);
-	if (!fp && errno != ENOENT) {
+	if (!fp) {
 		char *str = strerror(errno);
 		ICE("Error opening file %s, %s", path, str);
 	}
 	return fp;
 }
 
+// Listing of the entries in an include directory, read once per run.
+// Used to skip directories that can't contain the first component of a path.
+static struct directory_listing {
+	char *directory;
+	int is_listed; // 0 if the directory could not be read, then every path is tried.
+	int size, cap;
+	char **names;
+} *listings;
+static size_t listings_size, listings_cap;
+
+static int compare_names(const void *a, const void *b) {
+	return strcmp(*(char **)a, *(char **)b);
+}
+
+static struct directory_listing *get_listing(const char *directory) {
+	for (size_t i = 0; i < listings_size; i++) {
+		if (strcmp(listings[i].directory, directory) == 0)
+			return listings + i;
+	}
+
+	struct directory_listing *listing = &ADD_ELEMENT(listings_size, listings_cap, listings);
+	*listing = (struct directory_listing) { .directory = strdup(directory) };
+
+	// A directory that exists but can't be listed, like one that is execute-only,
+	// might still contain the path. A missing directory contains nothing.
+	DIR *dir = opendir(directory);
+	if (!dir) {
+		listing->is_listed = errno == ENOENT || errno == ENOTDIR;
+		return listing;
+	}
+
+	listing->is_listed = 1;
+
+	struct dirent *entry;
+	while ((entry = readdir(dir)))
+		ADD_ELEMENT(listing->size, listing->cap, listing->names) = strdup(entry->d_name);
+
+	closedir(dir);
+
+	qsort(listing->names, listing->size, sizeof *listing->names, compare_names);
+
+	return listing;
+}
+
+static int directory_might_contain(const char *directory, const char *path) {
+	while (*path == '/')
+		path++;
+
+	int length = 0;
+	while (path[length] && path[length] != '/')
+		length++;
+
+	if (length == 0)
+		return 1;
+
+	struct directory_listing *listing = get_listing(directory);
+	if (!listing->is_listed)
+		return 1;
+
+	if (!listing->size) // bsearch can't be given a NULL array.
+		return 0;
+
+	char *first = sv_to_str(sv_slice_string((char *)path, 0, length));
+	int found = bsearch(&first, listing->names, listing->size, sizeof *listing->names, compare_names) != NULL;
+	free(first);
+
+	return found;
+}
+
 void input_reset(void) {
 	paths_size = paths_cap = 0;
 	free(paths);
@@ -56,9 +306,15 @@ void input_disable_path(const char *path) {
 	string_set_insert(&disabled_headers, strdup(path));
 }
 
-FILE *input_search_path(const char *parent_path, const char *path, int system, int is_embed, char **opened_path) {
-	FILE *fp = NULL;
+struct string_set input_disabled_paths(void) {
+	return disabled_headers;
+}
 
+const char *input_include_path(size_t idx) {
+	return idx < paths_size ? paths[idx] : NULL;
+}
+
+static char *find_file(const char *parent_path, const char *path, int system) {
 	static char *path_buffer = NULL;
 	static size_t path_capacity = 0;
 
@@ -66,32 +322,101 @@ FILE *input_search_path(const char *parent_path, const char *path, int system, i
 		int length = length_of_path_without_filename(parent_path);
 
 		expand_printf(&path_buffer, &path_capacity, "%.*s%s", length, parent_path, path);
-		fp = try_open_file(path_buffer, is_embed ? "rb" : "r");
+		if (file_exists(path_buffer))
+			return path_buffer;
 	}
 
-	for (unsigned i = 0; !fp && i < paths_size; i++) {
+	for (unsigned i = 0; i < paths_size; i++) {
+		if (!directory_might_contain(paths[i], path))
+			continue;
+
 		expand_printf(&path_buffer, &path_capacity, "%s/%s", paths[i], path);
-		fp = try_open_file(path_buffer, is_embed ? "rb" : "r");
+		if (file_exists(path_buffer))
+			return path_buffer;
 	}
 
-	if (!fp)
-		ICE("\"%s\" not found in search path, with origin %s", path, parent_path);
-
-	*opened_path = path_buffer;
+	ICE("\"%s\" not found in search path, with origin %s", path, parent_path);
+}
 
-	return fp;
+FILE *input_search_path(const char *parent_path, const char *path, int system, int is_embed, char **opened_path) {
+	*opened_path = find_file(parent_path, path, system);
+	return open_file(*opened_path, is_embed ? "rb" : "r");
 }
 
-struct input input_open(const char *parent_path, const char *path, int system) {
-	char *opened_path = NULL;
-	FILE *fp = input_search_path(parent_path, path, system, 0, &opened_path);
+const char *input_find(const char *parent_path, const char *path, int system) {
+	char *opened_path = find_file(parent_path, path, system);
 
-	struct input input = { 0 };
+	if (string_set_contains(disabled_headers, sv_from_str(opened_path)))
+		return NULL;
 
-	if (!string_set_contains(disabled_headers, sv_from_str(opened_path)))
-		input = input_create(strdup(opened_path), fp);
+	return strdup(opened_path);
+}
 
+struct input input_open(const char *path) {
+	FILE *fp = open_file(path, "r");
+	struct input input = input_create(path, fp);
 	fclose(fp);
 
 	return input;
 }
+
+#define HASH_SEED 14695981039346656037ull
+
+// Gives the same result when data is split at multiples of 8 bytes.
+static uint64_t hash_update(uint64_t hash, const char *data, size_t size) {
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8) {
+		uint64_t word;
+		memcpy(&word, data + i, sizeof word);
+		hash = (hash ^ word) * 1099511628211ull;
+		hash ^= hash >> 32;
+	}
+
+	for (; i < size; i++)
+		hash = (hash ^ (unsigned char)data[i]) * 1099511628211ull;
+
+	return hash;
+}
+
+uint64_t input_hash(const char *contents, size_t size) {
+	return hash_update(HASH_SEED, contents, size);
+}
+
+int input_stamp(const char *path, uint64_t *size, uint64_t *hash) {
+	FILE *fp = fopen(path, "rb");
+	if (!fp)
+		return 0;
+
+	// Most headers are small, reading them is cheaper than mapping them.
+	static char buffer[64 * 1024];
+	setvbuf(fp, NULL, _IONBF, 0);
+
+	*size = 0;
+	*hash = HASH_SEED;
+
+	size_t read_size;
+	while ((read_size = fread(buffer, 1, sizeof buffer, fp)) > 0) {
+		*hash = hash_update(*hash, buffer, read_size);
+		*size += read_size;
+	}
+
+	int ok = !ferror(fp);
+	fclose(fp);
+	return ok;
+}
+
+// Files with an include guard have been read, so they exist.
+void input_set_guard(const char *path, atom macro) {
+	struct path_entry *entry = path_cache_find(path);
+	if (!entry->path) {
+		entry->path = strdup(path);
+		entry->exists = 1;
+		path_cache_size++;
+	}
+	entry->guard = macro;
+}
+
+atom input_get_guard(const char *path) {
+	struct path_entry *entry = path_cache_find(path);
+	return entry->path ? entry->guard : 0;
+}
@@ -2,22 +2,60 @@
 #define INPUT_H
 
 #include <stdio.h>
+#include <stdint.h>
 
+#include "string_set.h"
+
+#include <string_view.h>
+#include <atom.h>
+
+// A byte offset into a source. Line and column are looked up when needed.
 struct position {
-	const char *path;
-	int line, column;
+	int source; // 0 if the token has no position.
+	int offset;
 };
 
+const char *position_path(struct position pos);
+int position_line(struct position pos);
+int position_column(struct position pos);
+
+// Every tokenized input gets a source. Sources are kept for the whole run,
+// and so must the contents. The line table is built the first time a
+// line or column is asked for, which is rare.
+int input_new_source(const char *path, const char *contents);
+
+// #line, tokens after the directive at pos are given the returned source.
+int input_line_directive(struct position pos, int line, const char *path);
+
+// Line table of source, and the difference added by #line. Used by precompiled headers.
+const int *input_source_lines(int source, int *count, int *line_diff);
+int input_add_source(const char *path, int line_diff, const int *lines, int count);
+
 struct input {
 	const char *path, *contents;
+	size_t size;
 };
 
 void input_add_include_path(const char *path);
 void input_disable_path(const char *path);
+struct string_set input_disabled_paths(void);
+const char *input_include_path(size_t idx); // NULL when idx is past the last path.
 
-struct input input_open(const char *parent_path, const char *path, int system);
+// Returns the path of the file to include, or NULL if it has been
+// disabled by #pragma once.
+const char *input_find(const char *parent_path, const char *path, int system);
+struct input input_open(const char *path);
+
+// Size and hash of the contents of a file, to tell if it has changed.
+// input_stamp returns 0 if path can't be read.
+uint64_t input_hash(const char *contents, size_t size);
+int input_stamp(const char *path, uint64_t *size, uint64_t *hash);
 FILE *input_search_path(const char *parent_path, const char *path, int system, int is_embed, char **opened_path);
 
+// Include guards, the macro that controls the whole file at path.
+void input_set_guard(const char *path, atom macro);
+atom input_get_guard(const char *path);
+
 void input_reset(void);
 
 #endif
@@ -5,80 +5,241 @@
 
 #include <common.h>
 #include <escape_sequence.h>
+#include <arena.h>
 
 #include <assert.h>
 
-#define MAP_SIZE 1024
-struct define_map {
+// Open addressing with linear probing, indexed by the hash of the interned
+// name. Removed entries are replaced by a tombstone, so that entries placed
+// after them in the probe sequence can still be found.
+#define DEFINE_MAP_MIN_CAP 1024
+
+static struct define_map {
+	size_t size, tombstones, cap; // cap is a power of two.
 	struct define **entries;
-};
+} define_map;
 
-static struct define_map *define_map = NULL;
+static struct define tombstone;
+#define TOMBSTONE (&tombstone)
 
-void macro_expander_reset(void) {
-	free(define_map->entries);
-	free(define_map);
-	define_map = NULL;
-}
+// Kept for the whole run, for -fmem-report.
+static struct define_map_stats {
+	size_t peak_size, peak_used, peak_cap, rebuilds;
+	size_t lookups, probes;
+} define_map_stats;
+
+// Definitions that were replaced or removed while a macro was expanded.
+// Directives can appear in the arguments of a function-like macro, and the
+// expansion continues with the definition it started with.
+static int expansion_depth;
+static size_t retired_size, retired_cap;
+static struct define **retired;
+
+// Spellings of pasted tokens that are not identifiers, identifiers use the
+// spelling of their atom. Freed with the rest of the translation unit.
+static struct arena paste_arena = ARENA("pasted-tokens");
 
 void expand_buffer(int input, int return_output, struct token *t);
+static void define_compile(struct define *def);
+
+void define_free(struct define *def) {
+	token_list_free(&def->def);
+	token_list_free(&def->par);
+	free(def->ops);
+}
+
+static void define_retire(struct define *def) {
+	if (expansion_depth) {
+		ADD_ELEMENT(retired_size, retired_cap, retired) = def;
+	} else {
+		define_free(def);
+		free(def);
+	}
+}
 
-static void define_map_init(void) {
-	define_map = cc_malloc(sizeof *define_map);
+static void expansion_end(void) {
+	if (--expansion_depth)
+		return;
 
-	define_map->entries = cc_malloc(sizeof *define_map->entries * MAP_SIZE);
-	for (size_t i = 0; i < MAP_SIZE; i++) {
-		define_map->entries[i] = NULL;
+	for (size_t i = 0; i < retired_size; i++) {
+		define_free(retired[i]);
+		free(retired[i]);
 	}
+	retired_size = 0;
 }
 
-static struct define **define_map_find(struct string_view name) {
-	if (!define_map)
-		define_map_init();
+// Value of the next __COUNTER__.
+static int counter;
 
-	uint32_t hash_idx = sv_hash(name) % MAP_SIZE;
+int macro_expander_get_counter(void) {
+	return counter;
+}
 
-	struct define **it = &define_map->entries[hash_idx];
+void macro_expander_set_counter(int value) {
+	counter = value;
+}
 
-	while (*it && !sv_cmp((*it)->name, name)) {
-		it = &(*it)->next;
+void macro_expander_reset(void) {
+	for (size_t i = 0; i < define_map.cap; i++) {
+		struct define *def = define_map.entries[i];
+		if (def && def != TOMBSTONE) {
+			define_free(def);
+			free(def);
+		}
 	}
 
-	return it;
+	free(define_map.entries);
+	define_map = (struct define_map) { 0 };
+
+	arena_free(&paste_arena);
+	counter = 0;
+}
+
+// Returns the entry of name if it exists. Otherwise the first free entry
+// of the probe sequence is returned, which is a tombstone only if insert.
+static struct define **define_map_find(atom name, int insert) {
+	size_t mask = define_map.cap - 1;
+	struct define **free_entry = NULL;
+
+	define_map_stats.lookups++;
+	for (size_t idx = atom_hash(name) & mask;; idx = (idx + 1) & mask) {
+		struct define **entry = define_map.entries + idx;
+		define_map_stats.probes++;
+
+		if (!*entry)
+			return free_entry ? free_entry : entry;
+
+		if (*entry == TOMBSTONE) {
+			if (insert && !free_entry)
+				free_entry = entry;
+		} else if ((*entry)->id == name) {
+			return entry;
+		}
+	}
+}
+
+// Rebuilds the table without tombstones, doubling the size if more than
+// a quarter of it would be taken by live entries. Most lookups are for
+// identifiers that are not macros, and those probe until an empty entry,
+// so the table is kept at most half full.
+static void define_map_rebuild(void) {
+	struct define_map old = define_map;
+
+	size_t cap = MAX(old.cap, DEFINE_MAP_MIN_CAP);
+	if ((old.size + 1) * 4 > cap)
+		cap *= 2;
+
+	define_map = (struct define_map) {
+		.size = old.size,
+		.cap = cap,
+		.entries = cc_malloc(sizeof *define_map.entries * cap),
+	};
+	memset(define_map.entries, 0, sizeof *define_map.entries * cap);
+
+	for (size_t i = 0; i < old.cap; i++) {
+		if (old.entries[i] && old.entries[i] != TOMBSTONE)
+			*define_map_find(old.entries[i]->id, 1) = old.entries[i];
+	}
+
+	free(old.entries);
+
+	define_map_stats.rebuilds++;
+	define_map_stats.peak_cap = MAX(define_map_stats.peak_cap, cap);
 }
 
 void define_map_add(struct define define) {
-	struct define **elem = define_map_find(define.name);
+	define.id = atom_intern(define.name);
+
+	if ((define_map.size + define_map.tombstones + 1) * 2 > define_map.cap)
+		define_map_rebuild();
+
+	struct define **elem = define_map_find(define.id, 1);
+
+	if (!define.ops)
+		define_compile(&define);
 
 	if (define.def.size) { // Initial and ending whitespace of definition is ignored.
 		define.def.list[0].whitespace = 0;
 		define.def.list[define.def.size - 1].whitespace_after = 0;
 	}
 
-	if (*elem) {
-		define.next = (*elem)->next;
-		**elem = define;
+	if (!*elem) {
+		define_map.size++;
+	} else if (*elem == TOMBSTONE) {
+		define_map.size++;
+		define_map.tombstones--;
 	} else {
-		define.next = NULL;
-		*elem = cc_malloc(sizeof define);
-		**elem = define;
+		define_retire(*elem);
 	}
+
+	*elem = cc_malloc(sizeof define);
+	**elem = define;
+
+	struct define_map_stats *stats = &define_map_stats;
+	stats->peak_size = MAX(stats->peak_size, define_map.size);
+	stats->peak_used = MAX(stats->peak_used, define_map.size + define_map.tombstones);
 }
 
-struct define *define_map_get(struct string_view str) {
-	return *define_map_find(str);
+struct define *define_map_get(atom name) {
+	if (!define_map.cap)
+		return NULL;
+
+	return *define_map_find(name, 0);
 }
 
-void define_map_remove(struct string_view str) {
-	struct define **elem = define_map_find(str);
+void define_map_remove(atom name) {
+	if (!define_map.cap)
+		return;
+
+	struct define **elem = define_map_find(name, 0);
 	if (*elem) {
-		struct define *next = (*elem)->next;
-		free(*elem);
-		*elem = next;
-		// TODO: Free contents of elem as well.
+		define_retire(*elem);
+		*elem = TOMBSTONE;
+		define_map.size--;
+		define_map.tombstones++;
 	}
 }
 
+void define_map_for_each(void (*callback)(struct define *def, void *data), void *data) {
+	for (size_t i = 0; i < define_map.cap; i++) {
+		struct define *def = define_map.entries[i];
+		if (def && def != TOMBSTONE)
+			callback(def, data);
+	}
+}
+
+void define_map_print_stats(FILE *fp) {
+	struct define_map_stats *stats = &define_map_stats;
+	size_t probes = stats->lookups ? stats->probes * 100 / stats->lookups : 0;
+
+	fprintf(fp, "Define map:\n");
+	fprintf(fp, "%-16s %10zu\n", "peak defines", stats->peak_size);
+	fprintf(fp, "%-16s %10zu\n", "peak slots", stats->peak_cap);
+	fprintf(fp, "%-16s %9zu%%\n", "peak load",
+			stats->peak_cap ? stats->peak_used * 100 / stats->peak_cap : 0);
+	fprintf(fp, "%-16s %10zu\n", "rebuilds", stats->rebuilds);
+	fprintf(fp, "%-16s %7zu.%02zu\n", "probes/lookup", probes / 100, probes % 100);
+}
+
+struct define define_copy(struct define *def) {
+	struct define copy = *def;
+
+	copy.def = (struct token_list) { 0 };
+	copy.par = (struct token_list) { 0 };
+
+	if (def->def.size)
+		token_list_append(&copy.def, def->def.list, def->def.size);
+
+	if (def->par.size)
+		token_list_append(&copy.par, def->par.list, def->par.size);
+
+	// Compiled again when the copy is added to the map.
+	copy.ops = NULL;
+	copy.ops_size = copy.ops_cap = 0;
+
+	return copy;
+}
+
 struct define define_init(struct string_view name) {
 	return (struct define) {
 		.name = name,
@@ -107,55 +268,34 @@ void define_string(char *name, char *value) {
 	define_map_add(def);
 }
 
-// Hopefully sufficiant table for
-// combining two token types to
-// get another. The strings are simply
-// concatenated in all these cases.
-ttype paste_table[][3] = {
-	{T_IDENT, T_IDENT, T_IDENT},
-	{T_IDENT, T_NUM, T_IDENT},
-	{T_IDENT, T_IDENT, T_IDENT},
-	{T_LSHIFT, T_A, T_LSHIFTA},
-	{T_RSHIFT, T_A, T_RSHIFTA},
-	{T_NUM, T_NUM, T_NUM},
-	{T_NUM, T_IDENT, T_NUM},
-	{T_ADD, T_ADD, T_INC},
-	{T_ADD, T_A, T_ADDA},
-	{T_SUB, T_SUB, T_DEC},
-	{T_SUB, T_G, T_ARROW},
-	{T_SUB, T_A, T_SUBA},
-	{T_DIV, T_A, T_DIVA},
-	{T_MOD, T_A, T_MODA},
-	{T_G, T_GEQ, T_RSHIFTA},
-	{T_G, T_G, T_RSHIFT},
-	{T_G, T_A, T_GEQ},
-	{T_L, T_LEQ, T_LSHIFTA},
-	{T_L, T_L, T_LSHIFT},
-	{T_L, T_A, T_LEQ},
-	{T_NOT, T_A, T_NEQ},
-	{T_BOR, T_BOR, T_OR},
-	{T_BOR, T_A, T_BORA},
-	{T_XOR, T_A, T_XORA},
-	{T_A, T_A, T_EQ},
-	{T_STAR, T_A, T_MULA},
-	{T_AMP, T_A, T_BANDA},
-	{T_AMP, T_AMP, T_AND},
-	{PP_HASH, PP_HASH, PP_HHASH}, // This is just stupid...
-};
+static size_t paste_size, paste_cap;
+static char *paste_buffer;
 
+// Pastes b ## a, the result is found by tokenizing the concatenated spelling.
 static struct token glue(struct token a, struct token b) {
-	struct token ret = {
-		.whitespace = b.whitespace, .first_of_line = b.first_of_line,
-		.whitespace_after = a.whitespace_after, .first_of_line_after = a.first_of_line_after
-	};
-	for (unsigned i = 0; i < sizeof paste_table / sizeof *paste_table; i++)
-		if (paste_table[i][1] == a.type && paste_table[i][0] == b.type)
-			ret.type = paste_table[i][2];
-	if (!ret.type)
+	paste_size = 0;
+	char *dest = ADD_ELEMENTS(paste_size, paste_cap, paste_buffer, b.str.len + a.str.len + 1);
+	memcpy(dest, b.str.str, b.str.len);
+	memcpy(dest + b.str.len, a.str.str, a.str.len);
+	dest[b.str.len + a.str.len] = '\0';
+
+	struct token ret;
+	if (!tokenize_paste(paste_buffer, a.pos, &ret))
 		ERROR(a.pos, "Invalid paste of %.*s and %.*s", b.str.len, b.str.str, a.str.len, a.str.str);
 
-	ret.str = sv_from_str(allocate_printf("%s%s", sv_to_str(b.str), sv_to_str(a.str))); // TODO: This can be done better.
-	ret.hs = string_set_intersection(a.hs, b.hs);
+	if (ret.type == T_IDENT) {
+		ret.str = atom_str(ret.id);
+	} else if (ret.str.str == paste_buffer) {
+		char *str = arena_alloc(&paste_arena, ret.str.len);
+		memcpy(str, ret.str.str, ret.str.len);
+		ret.str.str = str;
+	}
+
+	ret.whitespace = b.whitespace;
+	ret.first_of_line = b.first_of_line;
+	ret.whitespace_after = a.whitespace_after;
+	ret.first_of_line_after = a.first_of_line_after;
+	ret.hs = hide_set_intersection(a.hs, b.hs);
 	ret.pos = a.pos;
 
 	return ret;
@@ -228,14 +368,28 @@ static void stringify_add(struct token *t, int start) {
 	}
 }
 
+static atom line_atom, file_atom, counter_atom, va_args_atom;
+
+static void init_atoms(void) {
+	if (line_atom)
+		return;
+
+	line_atom = atom_intern(sv_from_str("__LINE__"));
+	file_atom = atom_intern(sv_from_str("__FILE__"));
+	counter_atom = atom_intern(sv_from_str("__COUNTER__"));
+	va_args_atom = atom_intern(sv_from_str("__VA_ARGS__"));
+}
+
 static int builtin_macros(struct token *t) {
 	// These are only single tokens.
 	// Remember to keep whitespace.
 	int whitespace = t->whitespace, whitespace_after = t->whitespace_after;
-	if (sv_string_cmp(t->str, "__LINE__")) {
-		*t = (struct token) { .type = T_NUM, .str = sv_from_str(allocate_printf("%d", t->pos.line)), .pos = t->pos };
-	} else if (sv_string_cmp(t->str, "__FILE__")) {
-		*t = (struct token) { .type = T_STRING, .str = sv_from_str(allocate_printf("\"%s\"", t->pos.path)), .pos = t->pos };
+	if (t->id == line_atom) {
+		*t = (struct token) { .type = T_NUM, .str = sv_from_str(allocate_printf("%d", position_line(t->pos))), .pos = t->pos };
+	} else if (t->id == file_atom) {
+		*t = (struct token) { .type = T_STRING, .str = sv_from_str(allocate_printf("\"%s\"", position_path(t->pos))), .pos = t->pos };
+	} else if (t->id == counter_atom) {
+		*t = (struct token) { .type = T_NUM, .str = sv_from_str(allocate_printf("%d", counter++)), .pos = t->pos };
 	} else
 		return 0;
 
@@ -244,6 +398,69 @@ static int builtin_macros(struct token *t) {
 	return 1;
 }
 
+// Replacement list of a macro, compiled once when it is defined. The ops
+// are in the order they are expanded, from the end of the list towards the
+// start, since the result is pushed on the input buffer.
+struct macro_op {
+	enum {
+		MACRO_LITERALS, // Body tokens [token, token + count).
+		MACRO_ARGUMENT, // Argument param, expanded unless next to ##.
+		MACRO_STRINGIFY, // # of argument param.
+		MACRO_VA_ARGS,
+		MACRO_STRINGIFY_VA_ARGS,
+		MACRO_COMMA_VA_ARGS, // , ## __VA_ARGS__, the comma is dropped without variable arguments.
+		MACRO_EDGE_CONCAT, // ## without an operand, an error if expanded.
+	} type;
+	int token, count, param;
+	int concat; // The first token of the op is preceded by ##.
+	int stringify; // # before a literal, which is an error unless pasted.
+};
+
+static void define_compile(struct define *def) {
+	init_atoms();
+
+	struct token *body = def->def.list;
+	for (int i = def->def.size - 1; i >= 0; i--) {
+		struct token t = body[i];
+		int concat = i != 0 && body[i - 1].type == PP_HHASH;
+		int stringify = i != 0 && body[i - 1].type == PP_HASH;
+		int param = get_param(def, t);
+
+		struct macro_op op = { .token = i, .count = 1, .param = param, .concat = concat };
+		struct macro_op *last = def->ops_size ? def->ops + def->ops_size - 1 : NULL;
+
+		if (t.type == PP_HHASH) {
+			op.type = MACRO_EDGE_CONCAT;
+		} else if (t.id == va_args_atom && concat && i >= 2 && body[i - 2].type == T_COMMA) {
+			op.type = MACRO_COMMA_VA_ARGS;
+			op.concat = i >= 3 && body[i - 3].type == PP_HHASH;
+			i -= 2;
+			concat = op.concat;
+		} else if (t.id == va_args_atom) {
+			op.type = stringify ? MACRO_STRINGIFY_VA_ARGS : MACRO_VA_ARGS;
+		} else if (param >= 0) {
+			op.type = stringify ? MACRO_STRINGIFY : MACRO_ARGUMENT;
+		} else if (!stringify && last && last->type == MACRO_LITERALS &&
+				   !last->concat && !last->stringify && last->token == i + 1) {
+			// Extend the run of literals to the right.
+			last->token = i;
+			last->count++;
+			last->concat = concat;
+			if (concat)
+				i--;
+			continue;
+		} else {
+			op.type = MACRO_LITERALS;
+			op.stringify = stringify;
+		}
+
+		ADD_ELEMENT(def->ops_size, def->ops_cap, def->ops) = op;
+
+		if (concat || stringify)
+			i--;
+	}
+}
+
 static struct {
 	size_t size, cap;
 	struct token *tokens;
@@ -255,9 +472,7 @@ static struct {
 } output_buffer;
 
 static void input_buffer_push(struct token *t) {
-	struct token n_token = *t;
-	n_token.hs = string_set_dup(n_token.hs);
-	ADD_ELEMENT(input_buffer.size, input_buffer.cap, input_buffer.tokens) = n_token;
+	ADD_ELEMENT(input_buffer.size, input_buffer.cap, input_buffer.tokens) = *t;
 }
 
 static struct token input_buffer_take(int input) {
@@ -318,7 +533,54 @@ static int input_buffer_parse_argument(struct token_list *tl, int ignore_comma,
 	return t.type == T_RPAR;
 }
 
-static void expand_argument(struct token origin, struct token_list tl, int *concat_with_prev, int concat, int stringify, int input) {
+// Argument of a function-like macro. The fully expanded form is made the
+// first time it is needed, and reused for every other occurrence.
+struct argument {
+	struct token_list tokens, expanded;
+	int is_expanded;
+};
+
+static void push_expanded(struct token origin, struct argument *arg, int input) {
+	if (!arg->is_expanded) {
+		input_buffer_push(&(struct token) { .type = T_EOI });
+		for (int i = arg->tokens.size - 1; i >= 0; i--)
+			input_buffer_push(&arg->tokens.list[i]);
+
+		size_t output_pos = output_buffer.size;
+		expand_buffer(input, 0, NULL);
+
+		for (unsigned i = output_pos; i < output_buffer.size; i++)
+			token_list_add(&arg->expanded, output_buffer.tokens[i]);
+		output_buffer.size = output_pos;
+
+		arg->is_expanded = 1;
+	}
+
+	struct token_list *tl = &arg->expanded;
+	if (!tl->size)
+		return;
+
+	struct token *dest = ADD_ELEMENTS(input_buffer.size, input_buffer.cap, input_buffer.tokens, tl->size);
+	for (int i = tl->size - 1; i >= 0; i--) {
+		struct token t = tl->list[i];
+		if (i == 0)
+			t.whitespace = t.whitespace || origin.whitespace;
+		if (i == tl->size - 1)
+			t.whitespace_after = t.whitespace_after || origin.whitespace_after;
+		*dest++ = t;
+	}
+}
+
+static void expand_argument(struct token origin, struct argument *arg, int *concat_with_prev, int concat, int input) {
+	struct token_list tl = arg->tokens;
+
+	if (!concat && !(*concat_with_prev && tl.size)) {
+		push_expanded(origin, arg, input);
+		return;
+	}
+
+	// Operands of ## are not expanded, except for the part of the
+	// argument that is not pasted.
 	int start_it = tl.size - 1;
 
 	if (*concat_with_prev && tl.size) {
@@ -326,9 +588,8 @@ static void expand_argument(struct token origin, struct token_list tl, int *conc
 		*end = glue(*end, tl.list[start_it--]);
 	}
 
-	int run_expand_again = 0;
-	if (!(concat || stringify)) {
-		run_expand_again = 1;
+	int run_expand_again = !concat;
+	if (run_expand_again) {
 		struct token t = { .type = T_EOI };
 		input_buffer_push(&t);
 	}
@@ -354,11 +615,12 @@ static void expand_argument(struct token origin, struct token_list tl, int *conc
 	}
 }
 
-static void subs_buffer(struct token origin, struct define *def, struct string_set *hs, struct position new_pos, int input) {
+static void subs_buffer(struct token origin, struct define *def, hide_set *hs, struct position new_pos, int input) {
 	int n_args = def->par.size;
-	struct token_list *arguments = cc_malloc(sizeof *arguments * n_args);
+	struct argument *arguments = cc_malloc(sizeof *arguments * n_args);
+	memset(arguments, 0, sizeof *arguments * n_args);
 
-	struct token_list vararg = {0};
+	struct argument vararg = {0};
 	int vararg_included = 0;
 
 	int whitespace_after = origin.whitespace_after; // This can change if function macro.
@@ -369,7 +631,7 @@ static void subs_buffer(struct token origin, struct define *def, struct string_s
 
 		int finished = 0;
 		for (int i = 0; i < n_args; i++) {
-			if (input_buffer_parse_argument(&arguments[i], 0, input)) {
+			if (input_buffer_parse_argument(&arguments[i].tokens, 0, input)) {
 				finished = 1;
 				if (i != n_args - 1)
 					ERROR(lpar.pos, "Wrong number of arguments to macro");
@@ -379,7 +641,7 @@ static void subs_buffer(struct token origin, struct define *def, struct string_s
 
 		if (def->vararg && !finished) {
 			vararg_included = 1;
-			if (!input_buffer_parse_argument(&vararg, 1, input)) {
+			if (!input_buffer_parse_argument(&vararg.tokens, 1, input)) {
 				ERROR(lpar.pos, "__VA_ARGS__ Not end of input");
 			}
 		}
@@ -389,96 +651,116 @@ static void subs_buffer(struct token origin, struct define *def, struct string_s
 
 		whitespace_after = rpar.whitespace_after;
 
-		*hs = string_set_intersection(*hs, rpar.hs);
+		*hs = hide_set_intersection(*hs, rpar.hs);
 	}
 
-	string_set_insert(hs, sv_to_str(def->name));
+	*hs = hide_set_add(*hs, def->id);
 
 	size_t input_start = input_buffer.size;
 	int concat_with_prev = 0;
-	for(int i = def->def.size - 1; i >= 0; i--) {
-		struct token t = def->def.list[i];
+	struct token *body = def->def.list;
+	for (int k = 0; k < def->ops_size; k++) {
+		struct macro_op *op = def->ops + k;
+		struct token t = body[op->token];
+
+		switch (op->type) {
+		case MACRO_LITERALS: {
+			int i = op->token + op->count - 1;
+			if (concat_with_prev) {
+				struct token *end = input_buffer_top(input);
+				*end = glue(*end, body[i--]);
+				concat_with_prev = 0;
+			} else if (op->stringify) {
+				ERROR(t.pos, "# Should be followed by macro parameter");
+			}
 
-		const int concat = (i != 0) && def->def.list[i - 1].type == PP_HHASH;
-		const int stringify = (i != 0) && def->def.list[i - 1].type == PP_HASH;
+			struct token *dest = ADD_ELEMENTS(input_buffer.size, input_buffer.cap, input_buffer.tokens, i - op->token + 1);
+			for (; i >= op->token; i--) {
+				*dest = body[i];
+				dest->pos = new_pos;
+				dest++;
+			}
 
-		if (t.type == PP_HHASH)
-			ERROR(t.pos, "Concat token at edge of macro expansion.");
+			if (op->concat)
+				concat_with_prev = 1;
+		} break;
 
-		if (sv_string_cmp(t.str, "__VA_ARGS__")) {
-			const int va_args_paste = concat && i - 2 >= 0 &&
-				def->def.list[i - 2].type == T_COMMA;
-
-			if (va_args_paste && !vararg_included) {
-				i--; // There is an additional i-- at the end of the loop.
-			} else if (stringify) {
-				struct token_list tl = vararg;
-				stringify_start();
-
-				for(int i = 0; i < tl.size; i++)
-					stringify_add(tl.list + i, i == 0);
-
-				struct token t_new = t;
-				t_new.type = T_STRING;
-				t_new.str = stringify_end();
-				input_buffer_push(&t_new);
-			} else if (vararg_included) {
-				expand_argument(t, vararg, &concat_with_prev, concat, stringify, input);
-				
-				if (vararg.size)
-					concat_with_prev = !va_args_paste && concat;
-			}
-		} else {
-			const int idx = get_param(def, t);
-			if (idx >= 0 && stringify) {
-				struct token_list tl = arguments[idx];
-				stringify_start();
-
-				for(int i = 0; i < tl.size; i++)
-					stringify_add(tl.list + i, i == 0);
-
-				struct token t_new = t;
-				t_new.type = T_STRING;
-				t_new.str = stringify_end();
-				input_buffer_push(&t_new);
-			} else if(idx >= 0) {
-				expand_argument(t, arguments[idx], &concat_with_prev, concat, stringify, input);
-
-				if (arguments[idx].size)
-					concat_with_prev = concat;
+		case MACRO_ARGUMENT:
+			expand_argument(t, &arguments[op->param], &concat_with_prev, op->concat, input);
+
+			if (arguments[op->param].tokens.size)
+				concat_with_prev = op->concat;
+			break;
+
+		case MACRO_STRINGIFY:
+		case MACRO_STRINGIFY_VA_ARGS: {
+			struct token_list tl = op->type == MACRO_STRINGIFY ? arguments[op->param].tokens : vararg.tokens;
+			stringify_start();
+
+			for(int i = 0; i < tl.size; i++)
+				stringify_add(tl.list + i, i == 0);
+
+			struct token t_new = t;
+			t_new.type = T_STRING;
+			t_new.str = stringify_end();
+			input_buffer_push(&t_new);
+		} break;
+
+		case MACRO_VA_ARGS:
+			if (!vararg_included)
+				break;
+
+			expand_argument(t, &vararg, &concat_with_prev, op->concat, input);
+
+			if (vararg.tokens.size)
+				concat_with_prev = op->concat;
+			break;
+
+		case MACRO_COMMA_VA_ARGS: {
+			if (!vararg_included)
+				break;
+
+			expand_argument(t, &vararg, &concat_with_prev, 1, input);
+
+			if (vararg.tokens.size)
+				concat_with_prev = 0;
+
+			struct token comma = body[op->token - 2];
+			if (concat_with_prev) {
+				struct token *end = input_buffer_top(input);
+				*end = glue(*end, comma);
+				concat_with_prev = 0;
 			} else {
-				if (concat_with_prev) {
-					struct token *end = input_buffer_top(input);
-					*end = glue(*end, t);
-					concat_with_prev = 0;
-				} else if (stringify) {
-					ERROR(t.pos, "# Should be followed by macro parameter");
-				} else {
-					t.pos = new_pos;
-					input_buffer_push(&t);
-				}
-
-				if (concat)
-					concat_with_prev = 1;
+				comma.pos = new_pos;
+				input_buffer_push(&comma);
 			}
-		}
 
-		if (concat || stringify)
-			i--;
+			if (op->concat)
+				concat_with_prev = 1;
+		} break;
+
+		case MACRO_EDGE_CONCAT:
+			ERROR(t.pos, "Concat token at edge of macro expansion.");
+		}
 	}
 
 	for(int i = 0; i < n_args; i++) {
-		token_list_free(&arguments[i]);
+		token_list_free(&arguments[i].tokens);
+		token_list_free(&arguments[i].expanded);
 	}
+	token_list_free(&vararg.tokens);
+	token_list_free(&vararg.expanded);
 
 	for(unsigned i = input_start; i < input_buffer.size; i++) {
 		struct token *tok = &input_buffer.tokens[i];
-		tok->hs = string_set_union(*hs, tok->hs);
+		tok->hs = hide_set_union(*hs, tok->hs);
 
 		if (i == input_start)
 			tok->whitespace_after = tok->whitespace_after || whitespace_after;
-		if (i == input_buffer.size - 1)
+		if (i == input_buffer.size - 1) {
 			tok->whitespace = tok->whitespace || origin.whitespace;
+			tok->first_of_line = tok->first_of_line || origin.first_of_line;
+		}
 	}
 
 	free(arguments);
@@ -486,14 +768,16 @@ static void subs_buffer(struct token origin, struct define *def, struct string_s
 
 // Expands until empty token.
 void expand_buffer(int input, int return_output, struct token *t) { 
+	init_atoms();
+
 	while (input || input_buffer.size) {
 		struct token top = input_buffer_take(input);
 		if (top.type == T_EOI)
 			break;
 
 		struct define *def = NULL;
-		if (top.type != T_IDENT || string_set_contains(top.hs, top.str) ||
-			builtin_macros(&top) || !(def = define_map_get(top.str))) {
+		if (top.type != T_IDENT || hide_set_contains(top.hs, top.id) ||
+			builtin_macros(&top) || !(def = define_map_get(top.id))) {
 			if (return_output) {
 				*t = top;
 				return;
@@ -505,10 +789,15 @@ void expand_buffer(int input, int return_output, struct token *t) {
 
 		assert(def);
 
-		if ((def->func && (input || input_buffer.size) && input_buffer_top(input)->type == T_LPAR) ||
-			!def->func) {
+		// Looking for the ( can read directives that replace def.
+		expansion_depth++;
+		int invoked = !def->func ||
+			((input || input_buffer.size) && input_buffer_top(input)->type == T_LPAR);
+		if (invoked)
 			subs_buffer(top, def, &top.hs, top.pos, input);
-		} else {
+		expansion_end();
+
+		if (!invoked) {
 			if (return_output) {
 				*t = top;
 				return;
@@ -548,3 +837,44 @@ void expand_token_list(struct token_list *ts) {
 
 	output_buffer.size = output_pos;
 }
+
+// The list is pushed on the input buffer above a T_EOI, which is kept
+// there until expand_lazy_end, so tokens below it are never touched.
+void expand_lazy_begin(struct token_list *ts) {
+	input_buffer_push(&(struct token) { .type = T_EOI });
+
+	for (int i = ts->size - 1; i >= 0; i--)
+		input_buffer_push(&ts->list[i]);
+}
+
+struct token expand_lazy_next(void) {
+	struct token t;
+	expand_buffer(0, 1, &t);
+
+	if (t.type == T_EOI)
+		input_buffer_push(&t);
+
+	return t;
+}
+
+struct token *expand_lazy_peek(void) {
+	return input_buffer_top(0);
+}
+
+struct token expand_lazy_take(void) {
+	struct token t = *input_buffer_top(0);
+
+	if (t.type != T_EOI)
+		input_buffer.size--;
+
+	return t;
+}
+
+void expand_lazy_push(struct token t) {
+	if (t.type != T_EOI) // The T_EOI is never removed.
+		input_buffer_push(&t);
+}
+
+void expand_lazy_end(void) {
+	while (input_buffer_take(0).type != T_EOI);
+}
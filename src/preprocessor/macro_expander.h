@@ -4,13 +4,19 @@
 #include "preprocessor.h"
 #include "token_list.h"
 
+struct macro_op;
+
 struct define {
-	struct define *next;
 	struct string_view name;
+	atom id;
 	int func;
 	int vararg;
 
 	struct token_list def, par;
+
+	// The replacement list compiled by define_map_add.
+	int ops_size, ops_cap;
+	struct macro_op *ops;
 };
 
 void define_string(char *name, char *value);
@@ -19,13 +25,33 @@ void define_add_def(struct define *d, struct token t);
 void define_add_par(struct define *d, struct token t);
 
 void define_map_add(struct define def);
-struct define *define_map_get(struct string_view str);
-void define_map_remove(struct string_view name);
+struct define *define_map_get(atom name);
+void define_map_remove(atom name);
+void define_map_for_each(void (*callback)(struct define *def, void *data), void *data);
+void define_map_print_stats(FILE *fp);
+
+// Copy with its own token lists, which is later released with define_free.
+struct define define_copy(struct define *def);
+void define_free(struct define *def);
 
 struct token expander_next(void);
 
 void expand_token_list(struct token_list *ts);
 
+// Expands ts one token at a time, for the #if evaluator. Between begin and
+// end, tokens can be taken either expanded or as they are, and taken tokens
+// can be pushed back. T_EOI is returned at the end of the list.
+void expand_lazy_begin(struct token_list *ts);
+struct token expand_lazy_next(void);
+struct token *expand_lazy_peek(void);
+struct token expand_lazy_take(void);
+void expand_lazy_push(struct token t);
+void expand_lazy_end(void);
+
+// __COUNTER__, kept across precompiled headers.
+int macro_expander_get_counter(void);
+void macro_expander_set_counter(int value);
+
 void macro_expander_reset(void);
 
 #endif
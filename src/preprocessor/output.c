@@ -0,0 +1,110 @@
+#include "preprocessor.h"
+#include "directives.h"
+#include "macro_expander.h"
+
+#include <common.h>
+
+// Output of -E. Tokens are taken before adjacent strings are concatenated,
+// so every token is written with its original spelling. Line markers have
+// the same form as GCC's, so that tools can map the output back to the source.
+
+#define OUTPUT_BUFFER_SIZE (64 * 1024)
+
+// Gaps of at most this many lines are written as empty lines instead of a marker.
+#define MAX_EMPTY_LINES 8
+
+static struct output {
+	FILE *fp;
+	size_t size;
+	char buffer[OUTPUT_BUFFER_SIZE];
+
+	const char *path;
+	int line;
+} output;
+
+static void flush(void) {
+	file_write(output.fp, output.buffer, output.size);
+	output.size = 0;
+}
+
+static void write_bytes(const char *str, size_t len) {
+	if (output.size + len > OUTPUT_BUFFER_SIZE) {
+		flush();
+
+		if (len > OUTPUT_BUFFER_SIZE) {
+			file_write(output.fp, str, len);
+			return;
+		}
+	}
+
+	memcpy(output.buffer + output.size, str, len);
+	output.size += len;
+}
+
+static void write_char(char c) {
+	if (output.size == OUTPUT_BUFFER_SIZE)
+		flush();
+	output.buffer[output.size++] = c;
+}
+
+static void write_marker(int line, const char *path) {
+	char number[16];
+	int len = snprintf(number, sizeof number, "%d", line);
+
+	write_bytes("# ", 2);
+	write_bytes(number, len);
+	write_bytes(" \"", 2);
+	write_bytes(path, strlen(path));
+	write_bytes("\"\n", 2);
+
+	output.path = path;
+	output.line = line;
+}
+
+// Move to the start of the output line for a token at pos.
+static void start_line(struct position pos, int at_line_start) {
+	if (!at_line_start) {
+		write_char('\n');
+		output.line++;
+	}
+
+	const char *path = position_path(pos);
+	int line = position_line(pos);
+	if (!path || !line)
+		return;
+
+	int same_file = path == output.path || strcmp(path, output.path) == 0;
+	int gap = line - output.line;
+
+	if (same_file && gap >= 0 && gap <= MAX_EMPTY_LINES) {
+		for (int i = 0; i < gap; i++)
+			write_char('\n');
+		output.line = line;
+	} else {
+		write_marker(line, path);
+	}
+}
+
+void preprocess_to_file(const char *path, FILE *fp) {
+	output.fp = fp;
+	output.size = 0;
+
+	directiver_push_input(path, 0);
+
+	write_marker(1, path);
+
+	int at_line_start = 1, space = 0;
+	for (struct token t = expander_next(); t.type != T_EOI; t = expander_next()) {
+		if (t.first_of_line)
+			start_line(t.pos, at_line_start);
+		else if (!at_line_start && (space || t.whitespace))
+			write_char(' ');
+
+		write_bytes(t.str.str, t.str.len);
+		at_line_start = 0;
+		space = t.whitespace_after;
+	}
+
+	write_char('\n');
+	flush();
+}
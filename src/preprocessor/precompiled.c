@@ -0,0 +1,645 @@
+#include "precompiled.h"
+#include "macro_expander.h"
+#include "directives.h"
+
+#include <common.h>
+
+#include <unistd.h>
+#include <sys/mman.h>
+
+#define PCH_MAGIC "CCPCH003"
+#define TOKEN_CACHE_MAGIC "CCTOK001"
+
+// The file is only read by the compiler that wrote it, so everything is
+// stored in host byte order. The layout is:
+// header, dependencies, tokens, define tokens, defines, sources, lines,
+// disabled paths, strings.
+// Dependencies come first, so that their 64-bit fields are aligned.
+// Strings are offsets into the string table, and are NUL-terminated so
+// that paths can be used directly from the mapped file.
+struct pch_header {
+	char magic[8];
+	uint64_t fingerprint;
+	uint64_t size;
+	uint32_t token_count, define_token_count, define_count;
+	uint32_t source_count, line_count;
+	uint32_t dependency_count, disabled_count;
+	uint32_t string_size;
+	uint32_t counter; // Value of __COUNTER__ after the header.
+};
+
+// Files read by the header. The PCH is only used if none of them changed.
+struct pch_dependency {
+	uint64_t size, hash;
+	uint32_t path;
+	uint32_t guard; // Include guard macro, an empty string if the file has none.
+};
+
+enum {
+	FLAG_FIRST_OF_LINE = 1,
+	FLAG_FIRST_OF_LINE_AFTER = 2,
+	FLAG_WHITESPACE = 4,
+	FLAG_WHITESPACE_AFTER = 8,
+};
+
+struct pch_token {
+	uint32_t str, len;
+	uint32_t source; // Index into the sources of the file, plus one. Zero if none.
+	int32_t offset;
+	uint8_t type, flags;
+};
+
+// Line tables of the files that tokens come from.
+struct pch_source {
+	uint32_t path;
+	int32_t line_diff;
+	uint32_t lines, line_count;
+};
+
+struct pch_define {
+	uint32_t name, name_len;
+	uint32_t def, def_count, par, par_count;
+	uint8_t func, vararg;
+};
+
+// A file in the token cache directory holds the tokens of one source file,
+// encoded like the tokens of a precompiled header, followed by strings.
+// It is named by a hash of the path, and only used if the path, the size
+// and hash of the contents, and the compiler binary all match.
+struct token_cache_header {
+	char magic[8];
+	uint64_t size;
+	uint64_t file_size, file_hash;
+	uint64_t compiler_size, compiler_hash; // Token types can change between builds.
+	uint32_t path;
+	uint32_t token_count, string_size;
+};
+
+// These change between compilations and are not part of the fingerprint.
+// The values of the current compilation are kept when loading.
+static int is_volatile_macro(struct string_view name) {
+	return sv_string_cmp(name, "__DATE__") || sv_string_cmp(name, "__TIME__");
+}
+
+static uint64_t hash_token_list(uint64_t hash, struct token_list *list) {
+	for (int i = 0; i < list->size; i++) {
+		struct token *t = &list->list[i];
+		hash = hash * 31 + sv_hash(t->str);
+		hash = hash * 31 + t->type * 4 + t->whitespace * 2 + t->first_of_line;
+	}
+	return hash;
+}
+
+static void fingerprint_define(struct define *def, void *data) {
+	if (is_volatile_macro(def->name))
+		return;
+
+	uint64_t hash = sv_hash(def->name) * 4 + def->func * 2 + def->vararg;
+	hash = hash_token_list(hash, &def->def);
+	hash = hash_token_list(hash, &def->par);
+
+	// Summed since the order of the define map is arbitrary.
+	*(uint64_t *)data += hash;
+}
+
+static uint64_t state_fingerprint(void) {
+	uint64_t fingerprint = 0;
+	define_map_for_each(fingerprint_define, &fingerprint);
+
+	const char *path;
+	for (size_t i = 0; (path = input_include_path(i)); i++)
+		fingerprint = fingerprint * 31 + sv_hash(sv_from_str((char *)path));
+
+	return fingerprint;
+}
+
+static struct pch_writer {
+	size_t token_size, token_cap;
+	struct pch_token *tokens;
+
+	size_t define_token_size, define_token_cap;
+	struct pch_token *define_tokens;
+
+	size_t define_size, define_cap;
+	struct pch_define *defines;
+
+	size_t source_size, source_cap;
+	struct pch_source *sources;
+
+	size_t source_id_size, source_id_cap;
+	int *source_ids; // Source of each entry in sources.
+
+	size_t line_size, line_cap;
+	int32_t *lines;
+
+	size_t dependency_size, dependency_cap;
+	struct pch_dependency *dependencies;
+
+	size_t disabled_size, disabled_cap;
+	uint32_t *disabled;
+
+	size_t string_size, string_cap;
+	char *strings;
+
+	int last_source;
+	uint32_t last_source_idx;
+} writer;
+
+static uint32_t add_string(struct string_view str) {
+	uint32_t offset = writer.string_size;
+	char *dest = ADD_ELEMENTS(writer.string_size, writer.string_cap, writer.strings, str.len + 1);
+	if (str.len)
+		memcpy(dest, str.str, str.len);
+	dest[str.len] = '\0';
+	return offset;
+}
+
+static uint32_t encode_source(int source) {
+	for (size_t i = 0; i < writer.source_size; i++) {
+		if (writer.source_ids[i] == source)
+			return i + 1;
+	}
+
+	int count, line_diff;
+	const int *lines = input_source_lines(source, &count, &line_diff);
+
+	ADD_ELEMENT(writer.source_id_size, writer.source_id_cap, writer.source_ids) = source;
+	ADD_ELEMENT(writer.source_size, writer.source_cap, writer.sources) = (struct pch_source) {
+		.path = add_string(sv_from_str((char *)position_path((struct position) { source, 0 }))),
+		.line_diff = line_diff,
+		.lines = writer.line_size,
+		.line_count = count,
+	};
+
+	for (int i = 0; i < count; i++)
+		ADD_ELEMENT(writer.line_size, writer.line_cap, writer.lines) = lines[i];
+
+	return writer.source_size;
+}
+
+static struct pch_token encode_token(struct token *t) {
+	// Consecutive tokens almost always come from the same file.
+	if (t->pos.source != writer.last_source) {
+		writer.last_source = t->pos.source;
+		writer.last_source_idx = t->pos.source ? encode_source(t->pos.source) : 0;
+	}
+
+	return (struct pch_token) {
+		.str = add_string(t->str),
+		.len = t->str.len,
+		.source = writer.last_source_idx,
+		.offset = t->pos.offset,
+		.type = t->type,
+		.flags = (t->first_of_line ? FLAG_FIRST_OF_LINE : 0) |
+		(t->first_of_line_after ? FLAG_FIRST_OF_LINE_AFTER : 0) |
+		(t->whitespace ? FLAG_WHITESPACE : 0) |
+		(t->whitespace_after ? FLAG_WHITESPACE_AFTER : 0),
+	};
+}
+
+static uint32_t encode_token_list(struct token_list *list) {
+	uint32_t start = writer.define_token_size;
+	for (int i = 0; i < list->size; i++)
+		ADD_ELEMENT(writer.define_token_size, writer.define_token_cap, writer.define_tokens) = encode_token(&list->list[i]);
+	return start;
+}
+
+static void encode_define(struct define *def, void *data) {
+	(void)data;
+	ADD_ELEMENT(writer.define_size, writer.define_cap, writer.defines) = (struct pch_define) {
+		.name = add_string(def->name),
+		.name_len = def->name.len,
+		.def = encode_token_list(&def->def),
+		.def_count = def->def.size,
+		.par = encode_token_list(&def->par),
+		.par_count = def->par.size,
+		.func = def->func,
+		.vararg = def->vararg,
+	};
+}
+
+static void writer_free(void) {
+	free(writer.tokens);
+	free(writer.define_tokens);
+	free(writer.defines);
+	free(writer.sources);
+	free(writer.source_ids);
+	free(writer.lines);
+	free(writer.dependencies);
+	free(writer.disabled);
+	free(writer.strings);
+	writer = (struct pch_writer) { 0 };
+}
+
+void precompile_header(const char *path, const char *outfile) {
+	struct pch_header header = { 0 };
+	memcpy(header.magic, PCH_MAGIC, sizeof header.magic);
+	header.fingerprint = state_fingerprint();
+
+	// Dependencies are always recorded, they are needed by -MD when loading.
+	directiver_write_dependencies();
+
+	preprocessor_init(path);
+
+	while (T0->type != T_EOI) {
+		ADD_ELEMENT(writer.token_size, writer.token_cap, writer.tokens) = encode_token(T0);
+		t_next();
+	}
+
+	define_map_for_each(encode_define, NULL);
+
+	size_t dependency_count;
+	char **dependencies = directiver_get_dependencies(&dependency_count);
+	for (size_t i = 0; i < dependency_count; i++) {
+		struct pch_dependency dependency = { 0 };
+		if (!input_stamp(dependencies[i], &dependency.size, &dependency.hash))
+			ERROR_NO_POS("Could not read %s.", dependencies[i]);
+
+		atom guard = input_get_guard(dependencies[i]);
+		dependency.path = add_string(sv_from_str(dependencies[i]));
+		dependency.guard = add_string(guard ? atom_str(guard) : (struct string_view) { 0 });
+		ADD_ELEMENT(writer.dependency_size, writer.dependency_cap, writer.dependencies) = dependency;
+	}
+
+	struct string_set disabled = input_disabled_paths();
+	for (int i = 0; i < disabled.cap; i++) {
+		if (disabled.strings[i])
+			ADD_ELEMENT(writer.disabled_size, writer.disabled_cap, writer.disabled) = add_string(sv_from_str(disabled.strings[i]));
+	}
+
+	header.token_count = writer.token_size;
+	header.define_token_count = writer.define_token_size;
+	header.define_count = writer.define_size;
+	header.source_count = writer.source_size;
+	header.line_count = writer.line_size;
+	header.dependency_count = writer.dependency_size;
+	header.disabled_count = writer.disabled_size;
+	header.string_size = writer.string_size;
+	header.counter = macro_expander_get_counter();
+	header.size = sizeof header +
+		sizeof *writer.dependencies * writer.dependency_size +
+		sizeof *writer.tokens * (writer.token_size + writer.define_token_size) +
+		sizeof *writer.defines * writer.define_size +
+		sizeof *writer.sources * writer.source_size +
+		sizeof *writer.lines * writer.line_size +
+		sizeof *writer.disabled * writer.disabled_size +
+		writer.string_size;
+
+	FILE *fp = fopen(outfile, "wb");
+	if (!fp)
+		ERROR_NO_POS("Could not open %s for writing.", outfile);
+
+	file_write(fp, &header, sizeof header);
+	file_write(fp, writer.dependencies, sizeof *writer.dependencies * writer.dependency_size);
+	file_write(fp, writer.tokens, sizeof *writer.tokens * writer.token_size);
+	file_write(fp, writer.define_tokens, sizeof *writer.define_tokens * writer.define_token_size);
+	file_write(fp, writer.defines, sizeof *writer.defines * writer.define_size);
+	file_write(fp, writer.sources, sizeof *writer.sources * writer.source_size);
+	file_write(fp, writer.lines, sizeof *writer.lines * writer.line_size);
+	file_write(fp, writer.disabled, sizeof *writer.disabled * writer.disabled_size);
+	file_write(fp, writer.strings, writer.string_size);
+
+	fclose(fp);
+
+	writer_free();
+}
+
+static const struct pch_token *replay_tokens;
+static size_t replay_size, replay_pos;
+static const char *replay_strings;
+static int *replay_sources; // Source of each pch_source, indexed by pch_token.source.
+
+// Sources are indexed by pch_token.source.
+static struct token decode_token(const struct pch_token *t, const char *strings, const int *sources) {
+	struct string_view str = { .len = t->len, .str = (char *)strings + t->str };
+	return (struct token) {
+		.type = t->type,
+		.str = str,
+		.id = t->type == T_IDENT ? atom_intern(str) : 0,
+		.first_of_line = (t->flags & FLAG_FIRST_OF_LINE) != 0,
+		.first_of_line_after = (t->flags & FLAG_FIRST_OF_LINE_AFTER) != 0,
+		.whitespace = (t->flags & FLAG_WHITESPACE) != 0,
+		.whitespace_after = (t->flags & FLAG_WHITESPACE_AFTER) != 0,
+		.pos = { .source = sources[t->source], .offset = t->offset },
+	};
+}
+
+struct removed_macros {
+	struct string_set keep;
+	size_t size, cap;
+	atom *names;
+};
+
+static void find_removed(struct define *def, void *data) {
+	struct removed_macros *removed = data;
+	if (!string_set_contains(removed->keep, def->name))
+		ADD_ELEMENT(removed->size, removed->cap, removed->names) = def->id;
+}
+
+static void load_defines(const struct pch_define *defines, size_t count, const struct pch_token *tokens) {
+	// Macros that the header #undef'd.
+	struct removed_macros removed = { 0 };
+	for (size_t i = 0; i < count; i++)
+		string_set_insert(&removed.keep, (char *)replay_strings + defines[i].name);
+
+	define_map_for_each(find_removed, &removed);
+	for (size_t i = 0; i < removed.size; i++) {
+		if (!is_volatile_macro(atom_str(removed.names[i])))
+			define_map_remove(removed.names[i]);
+	}
+
+	string_set_free(removed.keep);
+	free(removed.names);
+
+	for (size_t i = 0; i < count; i++) {
+		const struct pch_define *d = defines + i;
+		struct define def = define_init((struct string_view) {
+				.len = d->name_len, .str = (char *)replay_strings + d->name
+			});
+
+		if (is_volatile_macro(def.name))
+			continue;
+
+		for (uint32_t j = 0; j < d->def_count; j++)
+			define_add_def(&def, decode_token(tokens + d->def + j, replay_strings, replay_sources));
+		for (uint32_t j = 0; j < d->par_count; j++)
+			define_add_par(&def, decode_token(tokens + d->par + j, replay_strings, replay_sources));
+
+		def.func = d->func;
+		def.vararg = d->vararg;
+
+		define_map_add(def);
+	}
+}
+
+// Returns NULL if the file can't be read or is shorter than min_size.
+static void *map_file(const char *path, size_t min_size, size_t *size) {
+	FILE *fp = fopen(path, "rb");
+	if (!fp)
+		return NULL;
+
+	off_t end = lseek(fileno(fp), 0, SEEK_END);
+	*size = end == -1 ? 0 : end;
+
+	void *data = MAP_FAILED;
+	if (*size >= min_size)
+		data = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fileno(fp), 0);
+
+	fclose(fp);
+
+	return data == MAP_FAILED ? NULL : data;
+}
+
+int precompiled_load(const char *path) {
+	char *pch_path = allocate_printf("%s.pch", path);
+	size_t size;
+	void *data = map_file(pch_path, sizeof (struct pch_header), &size);
+	free(pch_path);
+
+	if (!data)
+		return 0;
+
+	const struct pch_header *header = data;
+	if (memcmp(header->magic, PCH_MAGIC, sizeof header->magic) != 0 ||
+		header->size != size ||
+		header->fingerprint != state_fingerprint()) {
+		munmap(data, size);
+		return 0;
+	}
+
+	const struct pch_dependency *dependencies = (const struct pch_dependency *)(header + 1);
+	const struct pch_token *tokens = (const struct pch_token *)(dependencies + header->dependency_count);
+	const struct pch_token *define_tokens = tokens + header->token_count;
+	const struct pch_define *defines = (const struct pch_define *)(define_tokens + header->define_token_count);
+	const struct pch_source *sources = (const struct pch_source *)(defines + header->define_count);
+	const int32_t *lines = (const int32_t *)(sources + header->source_count);
+	const uint32_t *disabled = (const uint32_t *)(lines + header->line_count);
+	const char *strings = (const char *)(disabled + header->disabled_count);
+
+	// The header, or a file it included, changed since it was precompiled.
+	for (uint32_t i = 0; i < header->dependency_count; i++) {
+		uint64_t file_size, file_hash;
+		if (!input_stamp(strings + dependencies[i].path, &file_size, &file_hash) ||
+			file_size != dependencies[i].size || file_hash != dependencies[i].hash) {
+			munmap(data, size);
+			return 0;
+		}
+	}
+
+	// The mapping is kept for the rest of the run, tokens point into it.
+	replay_strings = strings;
+
+	replay_sources = cc_malloc(sizeof *replay_sources * (header->source_count + 1));
+	replay_sources[0] = 0;
+	for (uint32_t i = 0; i < header->source_count; i++) {
+		const struct pch_source *source = sources + i;
+		replay_sources[i + 1] = input_add_source(replay_strings + source->path, source->line_diff,
+		                                         lines + source->lines, source->line_count);
+	}
+
+	load_defines(defines, header->define_count, define_tokens);
+
+	for (uint32_t i = 0; i < header->dependency_count; i++) {
+		const char *dependency = replay_strings + dependencies[i].path;
+		directiver_add_dependency(dependency);
+
+		const char *guard = replay_strings + dependencies[i].guard;
+		if (*guard)
+			input_set_guard(dependency, atom_intern(sv_from_str((char *)guard)));
+	}
+
+	macro_expander_set_counter(header->counter);
+
+	for (uint32_t i = 0; i < header->disabled_count; i++)
+		input_disable_path(replay_strings + disabled[i]);
+
+	replay_tokens = tokens;
+	replay_size = header->token_count;
+	replay_pos = 0;
+
+	return 1;
+}
+
+int precompiled_next(struct token *t) {
+	if (replay_pos == replay_size)
+		return 0;
+
+	*t = decode_token(replay_tokens + replay_pos++, replay_strings, replay_sources);
+	return 1;
+}
+
+void precompiled_reset(void) {
+	replay_tokens = NULL;
+	replay_size = replay_pos = 0;
+	free(replay_sources);
+	replay_sources = NULL;
+}
+
+static int compiler_stamp(uint64_t *size, uint64_t *hash) {
+	static int is_read, ok;
+	static uint64_t stamp_size, stamp_hash;
+
+	if (!is_read) {
+		ok = input_stamp("/proc/self/exe", &stamp_size, &stamp_hash);
+		is_read = 1;
+	}
+
+	*size = stamp_size;
+	*hash = stamp_hash;
+	return ok;
+}
+
+static char *token_cache_path(const char *dir, const char *path) {
+	return allocate_printf("%s/%016llx.tok", dir, (unsigned long long)input_hash(path, strlen(path)));
+}
+
+int precompiled_save_tokens(const char *dir, const char *path, uint64_t size, uint64_t hash,
+                            struct token_list *tokens) {
+	struct token_cache_header header = { 0 };
+	if (!compiler_stamp(&header.compiler_size, &header.compiler_hash))
+		return 0;
+
+	memcpy(header.magic, TOKEN_CACHE_MAGIC, sizeof header.magic);
+	header.file_size = size;
+	header.file_hash = hash;
+	header.path = add_string(sv_from_str((char *)path));
+
+	// All tokens are from the file itself, whose line table is built from
+	// its contents when it is loaded.
+	writer.last_source = tokens->size ? tokens->list[0].pos.source : 0;
+	writer.last_source_idx = 1;
+	for (int i = 0; i < tokens->size; i++)
+		ADD_ELEMENT(writer.token_size, writer.token_cap, writer.tokens) = encode_token(&tokens->list[i]);
+
+	header.token_count = writer.token_size;
+	header.string_size = writer.string_size;
+	header.size = sizeof header + sizeof *writer.tokens * writer.token_size + writer.string_size;
+
+	// Written to a temporary file that is then renamed, so that compilers
+	// running at the same time never map a partly written file.
+	char *cache_path = token_cache_path(dir, path);
+	char *tmp_path = allocate_printf("%s.%d", cache_path, (int)getpid());
+	FILE *fp = writer.source_size ? NULL : fopen(tmp_path, "wb");
+
+	int saved = 0;
+	if (fp) {
+		file_write(fp, &header, sizeof header);
+		file_write(fp, writer.tokens, sizeof *writer.tokens * writer.token_size);
+		file_write(fp, writer.strings, writer.string_size);
+		fclose(fp);
+
+		saved = rename(tmp_path, cache_path) == 0;
+		if (!saved)
+			remove(tmp_path);
+	}
+
+	free(cache_path);
+	free(tmp_path);
+	writer_free();
+
+	return saved;
+}
+
+static void read_next(struct token_cache_cursor *cursor) {
+	if (cursor->idx == cursor->count)
+		cursor->next = (struct token) { .type = T_EOI, .first_of_line = 1 };
+	else
+		cursor->next = decode_token(cursor->tokens + cursor->idx++, cursor->strings, cursor->sources);
+}
+
+int precompiled_open_tokens(const char *dir, const char *path, const char *contents, uint64_t size, uint64_t hash,
+                            struct token_cache_cursor *cursor) {
+	uint64_t compiler_size, compiler_hash;
+	if (!compiler_stamp(&compiler_size, &compiler_hash))
+		return 0;
+
+	char *cache_path = token_cache_path(dir, path);
+	size_t data_size;
+	void *data = map_file(cache_path, sizeof (struct token_cache_header), &data_size);
+	free(cache_path);
+
+	if (!data)
+		return 0;
+
+	const struct token_cache_header *header = data;
+	const struct pch_token *tokens = (const struct pch_token *)(header + 1);
+	const char *strings = (const char *)(tokens + header->token_count);
+
+	if (memcmp(header->magic, TOKEN_CACHE_MAGIC, sizeof header->magic) != 0 ||
+		header->size != data_size ||
+		header->file_size != size || header->file_hash != hash ||
+		header->compiler_size != compiler_size || header->compiler_hash != compiler_hash ||
+		strcmp(strings + header->path, path) != 0) {
+		munmap(data, data_size);
+		return 0;
+	}
+
+	// The mapping is kept for the rest of the run, tokens point into it.
+	*cursor = (struct token_cache_cursor) {
+		.tokens = tokens,
+		.strings = strings,
+		.sources = { 0, input_new_source(path, contents) },
+		.count = header->token_count,
+	};
+	read_next(cursor);
+
+	return 1;
+}
+
+struct token precompiled_read_token(struct token_cache_cursor *cursor) {
+	struct token t = cursor->next;
+	if (t.type != T_EOI)
+		read_next(cursor);
+	return t;
+}
+
+static int is_name(const struct pch_token *t, const char *strings, const char *name) {
+	return t->len == strlen(name) && memcmp(strings + t->str, name, t->len) == 0;
+}
+
+int precompiled_skip_group(struct token_cache_cursor *cursor, struct token *from) {
+	// Tokens are in the order they appear in the file.
+	uint32_t low = 0, high = cursor->count;
+	while (low < high) {
+		uint32_t mid = (low + high) / 2;
+		if (cursor->tokens[mid].offset < from->pos.offset)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	const struct pch_token *tokens = cursor->tokens;
+	const char *strings = cursor->strings;
+	int depth = 0, nested = 0;
+
+	uint32_t idx = low;
+	for (; idx + 1 < cursor->count; idx++) {
+		const struct pch_token *name = tokens + idx + 1;
+		if (tokens[idx].type != PP_DIRECTIVE || (name->flags & FLAG_FIRST_OF_LINE))
+			continue;
+
+		if (is_name(name, strings, "if") || is_name(name, strings, "ifdef") ||
+			is_name(name, strings, "ifndef")) {
+			depth++;
+			nested++;
+		} else if (is_name(name, strings, "elif") || is_name(name, strings, "elifdef") ||
+				   is_name(name, strings, "elifndef")) {
+			if (depth == 0)
+				break;
+			nested++;
+		} else if (is_name(name, strings, "else")) {
+			if (depth == 0)
+				break;
+		} else if (is_name(name, strings, "endif")) {
+			if (depth == 0)
+				break;
+			depth--;
+		}
+	}
+
+	// Continue at the # of the directive that ends the group.
+	cursor->idx = idx + 1 < cursor->count ? idx : cursor->count;
+	read_next(cursor);
+
+	return nested;
+}
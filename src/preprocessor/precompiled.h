@@ -0,0 +1,47 @@
+#ifndef PRECOMPILED_H
+#define PRECOMPILED_H
+
+#include "preprocessor.h"
+#include "token_list.h"
+
+// A precompiled header holds the result of preprocessing a header:
+// the tokens it expands to, and the macros defined after it.
+
+// Loads path.pch if it exists, was written with the same macros and include
+// paths as currently set, and none of the files it read have changed since.
+// Returns 1 if it was loaded.
+int precompiled_load(const char *path);
+
+// Takes the next token of the loaded header, returns 0 when there are none left.
+int precompiled_next(struct token *t);
+
+void precompiled_reset(void);
+
+// The token cache keeps the tokens of single files in dir across
+// invocations. Tokens are used only if they were read from contents
+// of the same size and hash, by the same compiler binary.
+// Returns 1 if the tokens were saved.
+int precompiled_save_tokens(const char *dir, const char *path, uint64_t size, uint64_t hash,
+                            struct token_list *tokens);
+
+// Reads cached tokens as they are needed, like struct tokenizer.
+struct token_cache_cursor {
+	const struct pch_token *tokens;
+	const char *strings;
+	int sources[2];
+	uint32_t idx, count;
+
+	struct token next;
+};
+
+// Returns 0 if the file has no usable tokens in the cache.
+int precompiled_open_tokens(const char *dir, const char *path, const char *contents, uint64_t size, uint64_t hash,
+                            struct token_cache_cursor *cursor);
+
+// Returns T_EOI at the end of the file, and for every call after that.
+struct token precompiled_read_token(struct token_cache_cursor *cursor);
+
+// Same as tokenizer_skip_group, but passes over the cached tokens.
+int precompiled_skip_group(struct token_cache_cursor *cursor, struct token *from);
+
+#endif
@@ -3,6 +3,7 @@
 #include "tokenizer.h"
 #include "string_concat.h"
 #include "macro_expander.h"
+#include "precompiled.h"
 
 #include <common.h>
 #include <assert.h>
@@ -11,10 +12,17 @@ static struct token_stream {
 	struct token buffer[3], pushed;
 } ts;
 
+static struct token next_token(void) {
+	struct token t;
+	if (precompiled_next(&t))
+		return t;
+	return string_concat_next();
+}
+
 void t_next(void) {
 	ts.buffer[0] = ts.buffer[1];
 	ts.buffer[1] = ts.buffer[2];
-	ts.buffer[2] = ts.pushed.type ? ts.pushed : string_concat_next();
+	ts.buffer[2] = ts.pushed.type ? ts.pushed : next_token();
 	ts.pushed = (struct token) {0};
 }
 
@@ -30,6 +38,11 @@ void t_push(struct token t) {
 void preprocessor_init(const char *path) {
 	directiver_push_input(path, 0);
 
+	// A header included on the first line can be replaced by its precompiled form.
+	const char *header = directiver_first_include();
+	if (header && precompiled_load(header))
+		directiver_skip_first_include();
+
 	for (unsigned i = 0; i < sizeof ts.buffer / sizeof *ts.buffer; i++)
 		t_next();
 }
@@ -43,11 +56,21 @@ void preprocessor_reset(void) {
 	directiver_reset();
 	input_reset();
 	macro_expander_reset();
+	precompiled_reset();
+	hide_set_reset();
 }
 
 void define_remove(const char *name) {
 	// This is a safe (char *) cast, it will not be modified.
-	define_map_remove(sv_from_str((char *)name));
+	define_map_remove(atom_intern(sv_from_str((char *)name)));
+}
+
+void preprocessor_keep_tokens(void) {
+	directiver_keep_tokens();
+}
+
+void preprocessor_set_token_cache(const char *dir) {
+	directiver_set_token_cache(dir);
 }
 
 void preprocessor_write_dependencies(void) {
@@ -57,3 +80,11 @@ void preprocessor_write_dependencies(void) {
 void preprocessor_finish_writing_dependencies(const char *mt, const char *mf) {
 	directiver_finish_writing_dependencies(mt, mf);
 }
+
+void preprocessor_print_conditionals(FILE *fp) {
+	directiver_print_conditionals(fp);
+}
+
+void preprocessor_print_defines(FILE *fp) {
+	define_map_print_stats(fp);
+}
@@ -3,8 +3,10 @@
 
 #include "input.h"
 #include "string_set.h"
+#include "hide_set.h"
 
 #include <string_view.h>
+#include <atom.h>
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -23,17 +25,18 @@ enum {
 	T_COUNT
 };
 
+// Fields are ordered to avoid padding, tokens are copied around a lot.
 struct token {
-    ttype type;
+	ttype type;
 
-	struct string_view str;
+	unsigned first_of_line : 1, first_of_line_after : 1;
+	unsigned whitespace : 1, whitespace_after : 1;
 
-    int first_of_line, first_of_line_after;
-    int whitespace, whitespace_after;
+	atom id; // Interned str of identifiers, 0 for other tokens.
+	hide_set hs; // Only used internally by the macro expander.
 
+	struct string_view str;
 	struct position pos;
-
-    struct string_set hs; // Hide set. Only unsed internally.
 };
 
 #define EXPECT(T0, ETYPE) do {											\
@@ -60,7 +63,27 @@ void preprocessor_reset(void);
 void define_string(char *name, char *value); // Defined in macro_expander.c
 void define_remove(const char *name);
 
+// Write the preprocessed form of the header at path to outfile.
+void precompile_header(const char *path, const char *outfile); // Defined in precompiled.c
+
+// Write the preprocessed tokens of path to fp, for -E.
+void preprocess_to_file(const char *path, FILE *fp); // Defined in output.c
+
+// Keep the tokens of headers read by the current translation unit,
+// so that the translation units after it can use them.
+void preprocessor_keep_tokens(void);
+
+// Load and save the tokens of each file in dir, to reuse them across
+// invocations. The directory must exist.
+void preprocessor_set_token_cache(const char *dir);
+
 void preprocessor_write_dependencies(void);
 void preprocessor_finish_writing_dependencies(const char *mt, const char *mf);
 
+// Print how many conditional directives were evaluated and skipped in each file.
+void preprocessor_print_conditionals(FILE *fp);
+
+// Print the size and load of the macro table, for -fmem-report.
+void preprocessor_print_defines(FILE *fp);
+
 #endif
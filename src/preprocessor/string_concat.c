@@ -8,15 +8,30 @@
 
 #include <assert.h>
 
-static ttype get_ident(struct string_view str) {
+// Token type of each atom, T_IDENT for everything that is not a keyword.
+// Built when the first identifier is classified, atoms never change after that.
+static size_t keyword_types_size, keyword_types_cap;
+static ttype *keyword_types;
+
+static void add_keyword(ttype type, const char *str) {
+	atom id = atom_intern(sv_from_str((char *)str));
+	while (keyword_types_size <= (size_t)id)
+		ADD_ELEMENT(keyword_types_size, keyword_types_cap, keyword_types) = T_IDENT;
+	keyword_types[id] = type;
+}
+
+static ttype get_ident(atom id) {
+	if (!keyword_types_size) {
 #define X(A, B)
 #define SYM(A, B)
-#define KEY(A, B) if(sv_string_cmp(str, B)) { return A; }
+#define KEY(A, B) add_keyword(A, B);
 #include "tokens.h"
 #undef KEY
 #undef X
 #undef SYM
-	return T_IDENT;
+	}
+
+	return (size_t)id < keyword_types_size ? keyword_types[id] : T_IDENT;
 }
 
 enum string_type {
@@ -204,7 +219,7 @@ struct token string_concat_next(void) {
 	}
 
 	if (t.type == T_IDENT) {
-		t.type = get_ident(t.str);
+		t.type = get_ident(t.id);
 	} else if (t.type == T_CHARACTER_CONSTANT) {
 		enum string_type type = take_string_prefix(&t.str);
 
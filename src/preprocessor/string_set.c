@@ -5,57 +5,63 @@
 #include <stdlib.h>
 #include <string.h>
 
-static void string_set_append(struct string_set *a, char *str) {
-	ADD_ELEMENT(a->size, a->cap, a->strings) = str;
+// Open addressing with linear probing. The capacity is zero or a power of two,
+// and at most half of the slots are used. Empty sets don't allocate anything.
+
+static char **find_slot(struct string_set a, struct string_view str) {
+	uint32_t idx = sv_hash(str) & (a.cap - 1);
+
+	while (a.strings[idx] && !sv_string_cmp(str, a.strings[idx]))
+		idx = (idx + 1) & (a.cap - 1);
+
+	return a.strings + idx;
+}
+
+static void resize(struct string_set *a, int cap) {
+	struct string_set old = *a;
+
+	a->cap = cap;
+	a->strings = cc_malloc(sizeof *a->strings * cap);
+	memset(a->strings, 0, sizeof *a->strings * cap);
+
+	for (int i = 0; i < old.cap; i++) {
+		if (old.strings[i])
+			*find_slot(*a, sv_from_str(old.strings[i])) = old.strings[i];
+	}
+
+	free(old.strings);
 }
 
 struct string_set string_set_intersection(struct string_set a, struct string_set b) {
 	struct string_set ret = {0};
 
-	int a_ptr = 0, b_ptr = 0;
-
-	while (a_ptr < a.size && b_ptr < b.size) {
-		int cmp = strcmp(a.strings[a_ptr], b.strings[b_ptr]);
+	if (a.size > b.size) {
+		struct string_set tmp = a;
+		a = b;
+		b = tmp;
+	}
 
-		if (cmp == 0) {
-			string_set_append(&ret, a.strings[a_ptr]);
-			a_ptr++;
-			b_ptr++;
-		} else if (cmp < 0) {
-			a_ptr++;
-		} else {
-			b_ptr++;
-		}
+	for (int i = 0; i < a.cap; i++) {
+		if (a.strings[i] && string_set_contains(b, sv_from_str(a.strings[i])))
+			string_set_insert(&ret, a.strings[i]);
 	}
 
 	return ret;
 }
 
 struct string_set string_set_union(struct string_set a, struct string_set b) {
-	struct string_set ret = {0};
-
-	int a_ptr = 0, b_ptr = 0;
-
-	while (a_ptr < a.size && b_ptr < b.size) {
-		int cmp = strcmp(a.strings[a_ptr], b.strings[b_ptr]);
-
-		if (cmp == 0) {
-			string_set_append(&ret, a.strings[a_ptr]);
-			a_ptr++;
-			b_ptr++;
-		} else if (cmp < 0) {
-			string_set_append(&ret, a.strings[a_ptr]);
-			a_ptr++;
-		} else {
-			string_set_append(&ret, b.strings[b_ptr]);
-			b_ptr++;
-		}
+	if (a.size < b.size) {
+		struct string_set tmp = a;
+		a = b;
+		b = tmp;
 	}
 
-	for (; a_ptr < a.size; a_ptr++)
-		string_set_append(&ret, a.strings[a_ptr]);
-	for (; b_ptr < b.size; b_ptr++)
-		string_set_append(&ret, b.strings[b_ptr]);
+	struct string_set ret = string_set_dup(a);
+
+	for (int i = 0; i < b.cap; i++) {
+		if (b.strings[i])
+			string_set_insert(&ret, b.strings[i]);
+	}
 
 	return ret;
 }
@@ -74,34 +80,20 @@ void string_set_free(struct string_set a) {
 }
 
 void string_set_insert(struct string_set *a, char *str) {
-	if (!a->size) {
-		string_set_append(a, str);
-		return;
-	}
+	if ((a->size + 1) * 2 > a->cap)
+		resize(a, MAX(a->cap * 2, 4));
 
-	int s = 0, cmp = 0;
-	for (; s < a->size; s++) {
-		if ((cmp = strcmp(a->strings[s], str)) <= 0)
-			break;
-	}
-
-	if (cmp == 0)
+	char **slot = find_slot(*a, sv_from_str(str));
+	if (*slot)
 		return;
 
-	string_set_append(a, NULL);
-
-	for (int i = a->size - 1; i > s; i--) {
-		a->strings[i] = a->strings[i - 1];
-	}
-
-	a->strings[s] = str;
+	*slot = str;
+	a->size++;
 }
 
 int string_set_contains(struct string_set a, struct string_view str) {
-	for (int i = 0; i < a.size; i++) {
-		if (sv_string_cmp(str, a.strings[i]))
-			return 1;
-	}
+	if (!a.size)
+		return 0;
 
-	return 0;
+	return *find_slot(a, str) != NULL;
 }
@@ -1,15 +1,12 @@
 #ifndef STRING_SET_H
 #define STRING_SET_H
 
-// I would like to make this immutable,
-// and so that it is hash-consed in some
-// way.
-
 #include <string_view.h>
 
+// Hash set of strings. The strings are not owned by the set.
 struct string_set {
 	int size, cap;
-	char **strings;
+	char **strings; // Hash table, NULL for empty slots.
 };
 
 struct string_set string_set_intersection(struct string_set a, struct string_set b);
@@ -1,18 +1,33 @@
 #include "token_list.h"
 
 #include <common.h>
+#include <arena.h>
+
+// Lists are freed one by one, their arrays are only tracked here.
+static struct arena token_list_arena = ARENA("token-lists");
 
 void token_list_free(struct token_list *list) {
+	arena_track(&token_list_arena, sizeof *list->list * list->cap, 0);
 	free(list->list);
 }
 
 void token_list_add(struct token_list *list, struct token t) {
+	int old_cap = list->cap;
 	ADD_ELEMENT(list->size, list->cap, list->list) = t;
+	if (list->cap != old_cap)
+		arena_track(&token_list_arena, sizeof *list->list * old_cap, sizeof *list->list * list->cap);
+}
+
+void token_list_append(struct token_list *list, const struct token *tokens, int n) {
+	int old_cap = list->cap;
+	memcpy(ADD_ELEMENTS(list->size, list->cap, list->list, n), tokens, sizeof *tokens * n);
+	if (list->cap != old_cap)
+		arena_track(&token_list_arena, sizeof *list->list * old_cap, sizeof *list->list * list->cap);
 }
 
 int token_list_index_of(struct token_list *list, struct token t) {
 	for (int i = 0; i < list->size; i++) {
-		if (sv_cmp(list->list[i].str, t.str)) return i;
+		if (t.id ? list->list[i].id == t.id : sv_cmp(list->list[i].str, t.str)) return i;
 	}
 	return -1;
 }
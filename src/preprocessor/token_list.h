@@ -11,6 +11,7 @@ struct token_list {
 void token_list_free(struct token_list *list);
 struct token token_list_take_first(struct token_list *list);
 void token_list_add(struct token_list *list, struct token t);
+void token_list_append(struct token_list *list, const struct token *tokens, int n);
 int token_list_index_of(struct token_list *list, struct token t);
 
 #endif
@@ -7,8 +7,8 @@
 #include <limits.h>
 
 static char c;
-static struct position pos;
-static const char *str;
+static int source;
+static const char *str, *contents;
 static int needs_escape_sequences_removed, needs_digit_separator_removed;
 
 enum {
@@ -37,23 +37,72 @@ static void next_char(void) {
 	if (*str == '\\' &&
 	    (str[1] == '\n' || (str[1] == '\r' && str[2] == '\n'))) {
 		str += str[1] == '\n' ? 2 : 3;
-		pos.line++;
-		pos.column = 0;
 		needs_escape_sequences_removed = 1;
 		next_char();
 		return;
 	}
 
-	if (*str == '\n') {
-		pos.line++;
-		pos.column = 0;
+	c = eq_table[(unsigned char)*str++];
+}
+
+// Comments are skipped a word at a time, 8 bytes are checked at once
+// for the characters that need attention. Loads are aligned, so they never
+// cross into an unmapped page even if the input ends in the middle of a word.
+#define REPEAT_BYTE(B) (0x0101010101010101ull * (unsigned char)(B))
+
+static uint64_t has_byte(uint64_t word, char byte) {
+	uint64_t x = word ^ REPEAT_BYTE(byte);
+	return (x - REPEAT_BYTE(1)) & ~x & REPEAT_BYTE(0x80);
+}
+
+static int is_comment_stop(char ch, int block) {
+	return ch == '\n' || ch == '\\' || ch == '\0' || (block && ch == '*');
+}
+
+// First newline, backslash or NUL at or after p, and '*' in block comments.
+static const char *find_comment_stop(const char *p, int block) {
+	for (; (size_t)p % 8; p++) {
+		if (is_comment_stop(*p, block))
+			return p;
 	}
 
-	pos.column++;
+	for (;; p += 8) {
+		uint64_t word;
+		memcpy(&word, p, sizeof word);
+		if (has_byte(word, '\n') || has_byte(word, '\\') || has_byte(word, '\0') ||
+			(block && has_byte(word, '*')))
+			break;
+	}
 
-	c = eq_table[(unsigned char)*str++];
+	while (!is_comment_stop(*p, block))
+		p++;
+
+	return p;
+}
+
+static int is_identifier_class(char eq) {
+	return eq == EQ_ALPHA || eq == 'u' || eq == 'U' || eq == EQ_EXPONENT ||
+		eq == 'L' || eq == EQ_DECIMAL || eq == '8' || eq == EQ_UTF8;
 }
 
+// Set while tokenizing the result of ##, errors are reported at the paste.
+static int pasting, paste_failed;
+static struct position paste_pos;
+
+// Position of the current character.
+static struct position current_position(void) {
+	if (pasting)
+		return paste_pos;
+	return (struct position) { source, str - 1 - contents };
+}
+
+// The result of ## is not a token, the paste gives the error instead.
+#define TOKEN_ERROR(...) do {					\
+		if (!pasting)							\
+			ERROR(current_position(), __VA_ARGS__);	\
+		paste_failed = 1;						\
+	} while (0)
+
 static struct string_view remove_escape_sequences(const char *initial_pos) {
 	size_t len = str - initial_pos - 1;
 	char *ret_str = cc_malloc(len + 1);
@@ -85,9 +134,12 @@ static struct string_view remove_escape_sequences(const char *initial_pos) {
 					codepoint |= c - 'a' + 10;
 				else if (c >= 'A' && c <= 'F')
 					codepoint |= c - 'A' + 10;
-				else
-					ERROR(pos, "Invalid universal character name in %.*s", len,
-					      initial_pos);
+				else {
+					TOKEN_ERROR("Invalid universal character name in %.*s", len,
+					            initial_pos);
+					*write = '\0';
+					return sv_from_str(ret_str);
+				}
 			}
 
 			char encoded[4];
@@ -134,7 +186,7 @@ static void parse_number(void) {
 				needs_digit_separator_removed = 1;
 				next_char();
 			} else {
-				ERROR(pos, "Expected digit or non-digit after ' separator.");
+				TOKEN_ERROR("Expected digit or non-digit after ' separator.");
 			}
 		} else if (c == EQ_DECIMAL || c == '8' || c == EQ_ALPHA || c == 'u' ||
 		           c == 'U' || c == EQ_EXPONENT || c == 'L' || c == '.') {
@@ -158,16 +210,20 @@ static void parse_string_like(char end_char) {
 		next_char();
 	}
 
-	if (c != end_char)
-		ERROR(pos, "Invalid string");
+	if (c != end_char) {
+		TOKEN_ERROR("Invalid string");
+		return;
+	}
 
 	next_char();
 }
 
 static void parse_identifier(void) {
 	for (;;) {
-		if (c == EQ_ALPHA || c == 'u' || c == 'U' || c == EQ_EXPONENT ||
-		    c == 'L' || c == EQ_DECIMAL || c == '8' || c == EQ_UTF8) {
+		if (is_identifier_class(c)) {
+			// Consume the run directly, next_char handles whatever ends it.
+			while (is_identifier_class(eq_table[(unsigned char)*str]))
+				str++;
 			next_char();
 		} else if (c == '\\') {
 			next_char();
@@ -188,15 +244,18 @@ static struct token tokenizer_next(int *is_header, int *is_directive) {
 	next_char();  \
 	next.type = IDX;
 
-restart:
-	next.pos = pos;
+	const char *initial_pos;
 
-	const char *initial_pos = str - 1;
+restart:
+	initial_pos = str - 1;
+	next.pos = (struct position) { source, initial_pos - contents };
 	needs_escape_sequences_removed = 0;
 	needs_digit_separator_removed = 0;
 
 	switch (c) {
 	case EQ_SPACE:
+		while (*str == ' ' || *str == '\t' || *str == '\r')
+			str++;
 		next_char();
 		next.whitespace = 1;
 		goto restart;
@@ -211,14 +270,16 @@ restart:
 		TYPE(T_DIV);
 		switch (c) {
 		case '/':
-			while (c != '\n' && c != EQ_NULL)
+			while (c != '\n' && c != EQ_NULL) {
+				str = find_comment_stop(str, 0);
 				next_char();
+			}
 			next.whitespace = 1;
 			goto restart;
 
 		case '*':
+			next_char();
 			for (;;) {
-				next_char();
 				if (c == '*') {
 					next_char();
 					if (c == '/') {
@@ -226,7 +287,11 @@ restart:
 						break;
 					}
 				} else if (c == EQ_NULL) {
-					ERROR(pos, "Comment reached end of file");
+					TOKEN_ERROR("Comment reached end of file");
+					break;
+				} else {
+					str = find_comment_stop(str, 1);
+					next_char();
 				}
 			}
 			next.whitespace = 1;
@@ -324,8 +389,10 @@ restart:
 
 		case '.':
 			next_char();
-			if (c != '.')
-				ERROR(pos, "Invalid token");
+			if (c != '.') {
+				TOKEN_ERROR("Invalid token");
+				break;
+			}
 			TYPE(T_ELLIPSIS);
 			break;
 		}
@@ -462,7 +529,7 @@ restart:
 		next.type = T_EOI;
 		break;
 
-	default: ERROR(next.pos, "Invalid token");
+	default: TOKEN_ERROR("Invalid token");
 	}
 
 	next.str = (struct string_view){
@@ -476,6 +543,9 @@ restart:
 	if (needs_digit_separator_removed)
 		next.str = remove_digit_separator(initial_pos);
 
+	if (next.type == T_IDENT)
+		next.id = atom_intern(next.str);
+
 	if (next.type == T_IDENT && *is_directive) {
 		*is_header = sv_string_cmp(next.str, "include");
 		*is_directive = 0;
@@ -484,16 +554,10 @@ restart:
 	return next;
 }
 
-struct token_list tokenize_input(const char *contents, const char *path) {
-	struct token_list tl = {0};
-
-	int is_header = 0, is_directive = 0;
-
+static void tokenizer_start(const char *input_contents, const char *path) {
 	c = '\n'; // Needs to start with newline.
-	pos.path = path;
-	pos.column = 1;
-	pos.line = 1;
-	str = contents;
+	source = input_new_source(path, input_contents);
+	str = contents = input_contents;
 
 	// Read, and ignore, BOM (byte order mark).
 	// BOM signifies that the text file is utf-8.
@@ -501,6 +565,14 @@ struct token_list tokenize_input(const char *contents, const char *path) {
 	if ((unsigned char)str[0] == 0xef && (unsigned char)str[1] == 0xbb &&
 	    (unsigned char)str[2] == 0xbf)
 		str += 3;
+}
+
+struct token_list tokenize_input(const char *input_contents, const char *path) {
+	struct token_list tl = {0};
+
+	int is_header = 0, is_directive = 0;
+
+	tokenizer_start(input_contents, path);
 
 	struct token t = tokenizer_next(&is_header, &is_directive);
 	while (t.type != T_EOI) {
@@ -514,3 +586,243 @@ struct token_list tokenize_input(const char *contents, const char *path) {
 
 	return tl;
 }
+
+// The state of the tokenizer is kept in globals while a token is read,
+// and moved into the cursor between reads.
+static void cursor_load(struct tokenizer *cursor) {
+	c = cursor->c;
+	source = cursor->source;
+	str = cursor->str;
+	contents = cursor->contents;
+}
+
+static void cursor_save(struct tokenizer *cursor) {
+	cursor->c = c;
+	cursor->source = source;
+	cursor->str = str;
+	cursor->contents = contents;
+}
+
+void tokenizer_open(struct tokenizer *cursor, const char *contents, const char *path) {
+	*cursor = (struct tokenizer) { 0 };
+
+	tokenizer_start(contents, path);
+	cursor->next = tokenizer_next(&cursor->is_header, &cursor->is_directive);
+	cursor_save(cursor);
+}
+
+struct token tokenizer_read(struct tokenizer *cursor) {
+	struct token t = cursor->next;
+	if (t.type == T_EOI)
+		return t;
+
+	cursor_load(cursor);
+	cursor->next = tokenizer_next(&cursor->is_header, &cursor->is_directive);
+	cursor_save(cursor);
+
+	t.whitespace_after = cursor->next.whitespace;
+	t.first_of_line_after = cursor->next.first_of_line;
+
+	return t;
+}
+
+// Skipped groups are scanned without being tokenized. Only directives,
+// comments, and string and character literals need attention, since a #
+// inside the latter two does not start a directive.
+static int is_skip_stop(char ch) {
+	return ch == '#' || ch == '/' || ch == '"' || ch == '\'' || ch == '\0';
+}
+
+static const char *find_skip_stop(const char *p) {
+	for (; (size_t)p % 8; p++) {
+		if (is_skip_stop(*p))
+			return p;
+	}
+
+	for (;; p += 8) {
+		uint64_t word;
+		memcpy(&word, p, sizeof word);
+		if (has_byte(word, '#') || has_byte(word, '/') || has_byte(word, '"') ||
+			has_byte(word, '\'') || has_byte(word, '\0'))
+			break;
+	}
+
+	while (!is_skip_stop(*p))
+		p++;
+
+	return p;
+}
+
+// Whether only whitespace and comments come before p on its line.
+// blank_until is the end of the last comment that started a line.
+static int is_line_start(const char *p, const char *start, const char *blank_until) {
+	while (p > start && (p[-1] == ' ' || p[-1] == '\t' || p[-1] == '\r'))
+		p--;
+
+	if (p == start || p == blank_until)
+		return 1;
+
+	if (p[-1] != '\n')
+		return 0;
+
+	// Spliced onto the previous line.
+	p--;
+	if (p > start && p[-1] == '\r')
+		p--;
+	return !(p > start && p[-1] == '\\');
+}
+
+// Returns the newline that ends the comment, or the end of the input.
+static const char *skip_line_comment(const char *p) {
+	for (;;) {
+		const char *end = strchr(p, '\n');
+		if (!end)
+			return p + strlen(p);
+
+		const char *before = end - (end[-1] == '\r');
+		if (before[-1] != '\\')
+			return end;
+		p = end + 1;
+	}
+}
+
+// A literal that isn't closed ends at the end of the line, like it would
+// if it wasn't skipped. Returns the character after it.
+static const char *skip_literal(const char *p) {
+	char quote = *p++;
+	for (;;) {
+		if (*p == quote)
+			return p + 1;
+		if (*p == '\n' || *p == '\0')
+			return p;
+		if (*p == '\\' && p[1] == '\r' && p[2] == '\n')
+			p += 3;
+		else if (*p == '\\' && p[1])
+			p += 2;
+		else
+			p++;
+	}
+}
+
+// The ' in 1'000 is a digit separator, not the start of a character constant.
+static int is_digit_separator(const char *p, const char *start) {
+	const char *number = p;
+	while (number > start && (is_identifier_class(eq_table[(unsigned char)number[-1]]) ||
+							  number[-1] == '.' || number[-1] == '\''))
+		number--;
+
+	if (*number == '.')
+		number++;
+
+	return number < p && (eq_table[(unsigned char)*number] == EQ_DECIMAL || *number == '8');
+}
+
+// Whitespace and comments between the # and the name of a directive.
+static const char *skip_blank(const char *p) {
+	for (;;) {
+		if (*p == ' ' || *p == '\t') {
+			p++;
+		} else if (p[0] == '/' && p[1] == '*') {
+			const char *end = strstr(p + 2, "*/");
+			if (!end)
+				return p;
+			p = end + 2;
+		} else {
+			return p;
+		}
+	}
+}
+
+static int is_name(const char *name, size_t len, const char *directive) {
+	return strlen(directive) == len && memcmp(name, directive, len) == 0;
+}
+
+int tokenizer_skip_group(struct tokenizer *cursor, struct token *from) {
+	const char *start = cursor->contents, *p = start + from->pos.offset;
+	const char *blank_until = from->first_of_line ? p : NULL;
+	int depth = 0, nested = 0;
+
+	for (;;) {
+		p = find_skip_stop(p);
+
+		if (*p == '\0') {
+			break;
+		} else if (p[0] == '/' && p[1] == '*') {
+			const char *comment = p;
+			p = strstr(p + 2, "*/");
+			if (!p) {
+				p = comment + strlen(comment);
+				break;
+			}
+
+			p += 2;
+			if (is_line_start(comment, start, blank_until))
+				blank_until = p;
+		} else if (p[0] == '/' && p[1] == '/') {
+			p = skip_line_comment(p + 2);
+		} else if (*p == '"' || (*p == '\'' && !is_digit_separator(p, start))) {
+			p = skip_literal(p);
+		} else if (*p == '#' && is_line_start(p, start, blank_until)) {
+			const char *name = skip_blank(p + 1);
+
+			size_t len = 0;
+			while (is_identifier_class(eq_table[(unsigned char)name[len]]))
+				len++;
+
+			if (is_name(name, len, "if") || is_name(name, len, "ifdef") ||
+				is_name(name, len, "ifndef")) {
+				depth++;
+				nested++;
+			} else if (is_name(name, len, "elif") || is_name(name, len, "elifdef") ||
+					   is_name(name, len, "elifndef")) {
+				if (depth == 0)
+					break;
+				nested++;
+			} else if (is_name(name, len, "else")) {
+				if (depth == 0)
+					break;
+			} else if (is_name(name, len, "endif")) {
+				if (depth == 0)
+					break;
+				depth--;
+			}
+
+			p = name + len;
+		} else {
+			p++;
+		}
+	}
+
+	// Continue from the start of the line of the directive that ends the group.
+	cursor_load(cursor);
+	c = '\n';
+	str = p;
+	cursor->next = tokenizer_next(&cursor->is_header, &cursor->is_directive);
+	cursor_save(cursor);
+
+	return nested;
+}
+
+int tokenize_paste(const char *spelling, struct position pos, struct token *t) {
+	char prev_c = c;
+	int prev_source = source;
+	const char *prev_str = str, *prev_contents = contents;
+
+	pasting = 1;
+	paste_failed = 0;
+	paste_pos = pos;
+	str = contents = spelling;
+	next_char();
+
+	int is_header = 0, is_directive = 0;
+	*t = tokenizer_next(&is_header, &is_directive);
+	struct token end = tokenizer_next(&is_header, &is_directive);
+
+	pasting = 0;
+	c = prev_c;
+	source = prev_source;
+	str = prev_str;
+	contents = prev_contents;
+
+	return !paste_failed && t->type != T_EOI && !t->whitespace && end.type == T_EOI && !end.whitespace;
+}
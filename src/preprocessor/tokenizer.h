@@ -5,4 +5,29 @@
 
 struct token_list tokenize_input(const char *contents, const char *path);
 
+// Cursor that tokenizes a file as its tokens are read.
+struct tokenizer {
+	char c;
+	int source;
+	const char *str, *contents;
+	int is_header, is_directive;
+
+	struct token next; // Read ahead, to know what follows the current token.
+};
+
+void tokenizer_open(struct tokenizer *cursor, const char *contents, const char *path);
+
+// Returns T_EOI at the end of the file, and for every call after that.
+struct token tokenizer_read(struct tokenizer *cursor);
+
+// Passes over a group skipped by a conditional directive, starting at the
+// token from, without tokenizing it. The next token read is the # of the
+// #elif, #else or #endif that ends the group, or T_EOI if there is none.
+// Returns the number of conditional directives with conditions passed over.
+int tokenizer_skip_group(struct tokenizer *cursor, struct token *from);
+
+// Tokenizes the spelling made by ##, which must be NUL-terminated.
+// Returns 0 if it is not exactly one preprocessing token.
+int tokenize_paste(const char *spelling, struct position pos, struct token *t);
+
 #endif
@@ -7,6 +7,7 @@
 
 #include "types.h"
 #include "common.h"
+#include "arena.h"
 #include "parser/expression_to_ir.h"
 #include <abi/abi.h>
 
@@ -104,6 +105,9 @@ static uint32_t type_hash(struct type *type, struct type **children) {
 	return hash;
 }
 
+// Types are deduplicated across translation units, and never freed.
+static struct arena type_arena = ARENA("types");
+
 struct type *type_create(struct type *params, struct type **children) {
 	static struct type **hashtable = NULL;
 	static int hashtable_size = 0;
@@ -126,7 +130,7 @@ struct type *type_create(struct type *params, struct type **children) {
 	if (first)
 		return first;
 
-	struct type *new = cc_malloc(sizeof(*params) + sizeof(*children) * params->n);
+	struct type *new = arena_alloc(&type_arena, sizeof(*params) + sizeof(*children) * params->n);
 	*new = *params;
 	if (params->n)
 		memcpy(new->children, children, sizeof(*children) * params->n);
@@ -176,11 +180,11 @@ struct type *type_remove_qualifications(struct type *type) {
 
 // TODO: make this better.
 struct struct_data *register_struct(void) {
-	return cc_malloc(sizeof (struct struct_data));
+	return arena_alloc(&type_arena, sizeof (struct struct_data));
 }
 
 struct enum_data *register_enum(void) {
-	return cc_malloc(sizeof (struct enum_data));
+	return arena_alloc(&type_arena, sizeof (struct enum_data));
 }
 
 int type_search_member(struct type *type, struct string_view name,
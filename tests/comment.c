@@ -3,6 +3,18 @@
 
 char *str = "a\"/*b";
 
+/** Comments can end with more than one star. **/
+int after_stars = 1;
+
+/* A line splice can also end one. *\
+/
+int after_splice = 2;
+
+// A line comment \
+continues on the next line.
+int after_line = 3;
+
 int main(void) {
 	assert(strcmp(str, "a\"/" "*b") == 0);
+	assert(after_stars + after_splice + after_line == 6);
 }
@@ -0,0 +1,24 @@
+#include <assert.h>
+
+struct pair {
+	int a, b;
+};
+
+int main(void) {
+	char *p = "x";
+	double d = 1.0;
+	long l = 5;
+
+	// Comparison results are int, storing them must not touch b.
+	struct pair pair = { 0, 7 };
+	pair.a = p != 0;
+	assert(pair.a == 1 && pair.b == 7);
+
+	pair.a = d < 2.0;
+	assert(pair.a == 1 && pair.b == 7);
+
+	pair.a = l == 5;
+	assert(pair.a == 1 && pair.b == 7);
+
+	assert(sizeof (p == 0) == sizeof (int));
+}
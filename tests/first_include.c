@@ -0,0 +1 @@
+#include "first_include.h"
\ No newline at end of file
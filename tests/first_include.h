@@ -0,0 +1,7 @@
+// The #include of this header is all there is in first_include.c, without
+// a newline at the end. Looking ahead for a header to replace with its
+// precompiled form reaches the end of that file.
+
+int main(void) {
+	return 0;
+}
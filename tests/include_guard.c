@@ -0,0 +1,21 @@
+#include <assert.h>
+
+#include "include_guard1.h"
+#include "include_guard1.h"
+
+// Guard is no longer defined, so the header must be read again.
+#undef INCLUDE_GUARD1_H
+#define guarded_function guarded_function_again
+#include "include_guard1.h"
+#undef guarded_function
+
+int main(void) {
+	int count = 0;
+	// Not a guarded header, code after #endif.
+#include "include_guard2.h"
+#include "include_guard2.h"
+	assert(count == 2);
+
+	assert(guarded_function() == 1);
+	assert(guarded_function_again() == 1);
+}
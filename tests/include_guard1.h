@@ -0,0 +1,8 @@
+#ifndef INCLUDE_GUARD1_H
+#define INCLUDE_GUARD1_H
+
+int guarded_function(void) {
+	return 1;
+}
+
+#endif
@@ -0,0 +1,4 @@
+#ifndef INCLUDE_GUARD2_H
+#define INCLUDE_GUARD2_H
+#endif
+count++;
@@ -0,0 +1,89 @@
+#include <assert.h>
+
+// Every level uses its argument twice. Unless the expansion of an argument
+// is reused, the work doubles with each level of nesting.
+#define FIRST(a, b) a
+#define TWICE(x) FIRST(x, x)
+
+#define D1(x) TWICE(x)
+#define D2(x) TWICE(D1(x))
+#define D3(x) TWICE(D2(x))
+#define D4(x) TWICE(D3(x))
+#define D5(x) TWICE(D4(x))
+#define D6(x) TWICE(D5(x))
+#define D7(x) TWICE(D6(x))
+#define D8(x) TWICE(D7(x))
+#define D9(x) TWICE(D8(x))
+#define D10(x) TWICE(D9(x))
+#define D11(x) TWICE(D10(x))
+#define D12(x) TWICE(D11(x))
+#define D13(x) TWICE(D12(x))
+#define D14(x) TWICE(D13(x))
+#define D15(x) TWICE(D14(x))
+#define D16(x) TWICE(D15(x))
+#define D17(x) TWICE(D16(x))
+#define D18(x) TWICE(D17(x))
+#define D19(x) TWICE(D18(x))
+#define D20(x) TWICE(D19(x))
+#define D21(x) TWICE(D20(x))
+#define D22(x) TWICE(D21(x))
+#define D23(x) TWICE(D22(x))
+#define D24(x) TWICE(D23(x))
+#define D25(x) TWICE(D24(x))
+#define D26(x) TWICE(D25(x))
+#define D27(x) TWICE(D26(x))
+#define D28(x) TWICE(D27(x))
+#define D29(x) TWICE(D28(x))
+#define D30(x) TWICE(D29(x))
+#define D31(x) TWICE(D30(x))
+#define D32(x) TWICE(D31(x))
+#define D33(x) TWICE(D32(x))
+#define D34(x) TWICE(D33(x))
+#define D35(x) TWICE(D34(x))
+#define D36(x) TWICE(D35(x))
+#define D37(x) TWICE(D36(x))
+#define D38(x) TWICE(D37(x))
+#define D39(x) TWICE(D38(x))
+#define D40(x) TWICE(D39(x))
+#define D41(x) TWICE(D40(x))
+#define D42(x) TWICE(D41(x))
+#define D43(x) TWICE(D42(x))
+#define D44(x) TWICE(D43(x))
+#define D45(x) TWICE(D44(x))
+#define D46(x) TWICE(D45(x))
+#define D47(x) TWICE(D46(x))
+#define D48(x) TWICE(D47(x))
+#define D49(x) TWICE(D48(x))
+#define D50(x) TWICE(D49(x))
+#define D51(x) TWICE(D50(x))
+#define D52(x) TWICE(D51(x))
+#define D53(x) TWICE(D52(x))
+#define D54(x) TWICE(D53(x))
+#define D55(x) TWICE(D54(x))
+#define D56(x) TWICE(D55(x))
+#define D57(x) TWICE(D56(x))
+#define D58(x) TWICE(D57(x))
+#define D59(x) TWICE(D58(x))
+#define D60(x) TWICE(D59(x))
+#define D61(x) TWICE(D60(x))
+#define D62(x) TWICE(D61(x))
+#define D63(x) TWICE(D62(x))
+#define D64(x) TWICE(D63(x))
+
+#ifndef DEPTH
+#define DEPTH 64
+#endif
+
+#define CAT(a, b) CAT2(a, b)
+#define CAT2(a, b) a ## b
+#define NESTED CAT(D, DEPTH)
+
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+int main(void) {
+	assert(NESTED(7) == 7);
+	assert(MAX(MAX(1, 4), MAX(3, 2)) == 4);
+
+	int i = 0;
+	assert(TWICE(i++) == 0 && i == 1);
+}
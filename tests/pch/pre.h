@@ -0,0 +1,3 @@
+#include "value.h"
+
+enum { FIRST = __COUNTER__, SECOND = __COUNTER__ };
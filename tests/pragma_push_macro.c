@@ -19,4 +19,15 @@ int main(void) {
 
 #pragma push_macro("Z")
    #undef Z
+
+#define F(x) (x + 1)
+#pragma push_macro("F")
+#undef F
+#if defined(F)
+#error
+#endif
+#define F(x) (x + 2)
+   assert(F(1) == 3);
+#pragma pop_macro("F")
+   assert(F(1) == 2);
 }
@@ -89,6 +89,18 @@ assert(strcmp(include, "Hello") == 0);
 	join_va_args(abcd,) = 2;
 	assert(abcd == 2);
 
+#define paste(a, b) a ## b
+
+	abcd paste(+, =) 3;
+	abcd paste(^, =) 1;
+	assert(abcd == 4);
+	assert(paste(0x, 1p1) == 2.0);
+	assert(sizeof paste(L, "ab") == sizeof L"ab");
+	assert(paste(u, 'a') == u'a');
+
+	int first = __COUNTER__;
+	assert(__COUNTER__ == first + 1);
+
 	return 0;
 }
 
@@ -114,5 +126,45 @@ assert(strcmp(include, "Hello") == 0);
 #error
 #endif
 
+#define ZERO 0
+#define DIV_ZERO (1 / ZERO)
+#define DIV_BY_ZERO(x) ((x) / ZERO)
+#define HAS_ZERO defined(ZERO)
+
+#if 0 && DIV_ZERO
+#error
+#endif
+
+#if !(1 || DIV_BY_ZERO(1 + (2)) || UNDEFINED)
+#error
+#endif
+
+#if !HAS_ZERO || defined UNDEFINED
+#error
+#endif
+
+#if 0
+#if 1
+#error
+#else
+#error
+#endif
+#elif 0
+#error
+#elif 1
+#ifdef UNDEFINED
+#error
+#elif !defined(ZERO)
+#error
+#endif
+#define SKIPPED_GROUPS 1
+#else
+#error
+#endif
+
+#if !SKIPPED_GROUPS
+#error
+#endif
+
 // Should ignore:
 #pragma warning(disable : 4996)
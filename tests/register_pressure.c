@@ -0,0 +1,43 @@
+#include <assert.h>
+
+// More values are live at once than there are registers to allocate,
+// so some of them have to be spilled, also across calls.
+
+static int identity(int x) {
+	return x;
+}
+
+static long sum_live(long seed) {
+	long a = seed + 1, b = seed * 2, c = seed - 3, d = seed ^ 4;
+	long e = seed + 5, f = seed * 6, g = seed - 7, h = seed ^ 8;
+	long i = seed + 9, j = seed * 10, k = seed - 11, l = seed ^ 12;
+
+	seed = identity((int)seed);
+
+	return a + b + c + d + e + f + g + h + i + j + k + l + seed;
+}
+
+static int loop_live(int n) {
+	int a = 0, b = 1, c = 2, d = 3, e = 4, f = 5, g = 6, h = 7;
+	for (int i = 0; i < n; i++) {
+		a += b; b += c; c += d; d += e;
+		e += f; f += g; g += h; h += identity(i);
+	}
+	return a ^ b ^ c ^ d ^ e ^ f ^ g ^ h;
+}
+
+int main(void) {
+	for (long seed = -20; seed <= 20; seed++) {
+		long expected = (seed + 1) + (seed * 2) + (seed - 3) + (seed ^ 4) +
+			(seed + 5) + (seed * 6) + (seed - 7) + (seed ^ 8) +
+			(seed + 9) + (seed * 10) + (seed - 11) + (seed ^ 12) + seed;
+		assert(sum_live(seed) == expected);
+	}
+
+	int a = 0, b = 1, c = 2, d = 3, e = 4, f = 5, g = 6, h = 7;
+	for (int i = 0; i < 10; i++) {
+		a += b; b += c; c += d; d += e;
+		e += f; f += g; g += h; h += i;
+	}
+	assert(loop_live(10) == (a ^ b ^ c ^ d ^ e ^ f ^ g ^ h));
+}
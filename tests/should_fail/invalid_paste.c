@@ -0,0 +1,5 @@
+#define CAT(a, b) a ## b
+
+int main(void) {
+	int x = CAT(1, +) 2;
+}
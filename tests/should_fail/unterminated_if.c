@@ -0,0 +1,6 @@
+int main(void) {
+	return 0;
+}
+
+#if 0
+int x;
@@ -0,0 +1,49 @@
+// Skipped groups are passed over without being tokenized, directives
+// inside comments and literals must not end them.
+
+#if 0
+/*
+#else
+#error
+*/
+const char *s = "#endif";
+char c = '"';
+char d = '\'';
+int n = 1'000; /* A comment that spans
+#endif
+lines. */
+// A line comment \
+#endif
+#if 1
+#else
+#endif
+/* */ # /* */ if 1
+#endif
+  #  ifdef UNDEFINED
+  #  endif
+#define WRONG 1
+#elif 1
+#define RIGHT 1
+#endif
+
+#if 1
+#elif 1
+#define WRONG 1
+/* #endif */
+#else
+#define WRONG 1
+#endif
+
+#if 0
+#elif 0
+#else
+#define ELSE_TAKEN 1
+#endif
+
+int main(void) {
+#if !defined(RIGHT) || defined(WRONG) || !ELSE_TAKEN
+	return 1;
+#else
+	return 0;
+#endif
+}
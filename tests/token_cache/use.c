@@ -0,0 +1,5 @@
+#include "value.h"
+
+int main(void) {
+	return VALUE;
+}
@@ -0,0 +1,6 @@
+#ifndef VALUE_H
+#define VALUE_H
+
+#define VALUE 1
+
+#endif
@@ -4,7 +4,17 @@
 
 #define F(fmt, ...) snprintf(NULL, 0, fmt, ##__VA_ARGS__)
 
+#define STR(...) STR2(__VA_ARGS__)
+#define STR2(...) #__VA_ARGS__
+#define LIST(first, ...) { first , ## __VA_ARGS__ , first }
+
 int main(void) {
 	F("Test");
 	F("Test %s", "Test2");
+
+	assert(strcmp(STR(LIST(1)), "{ 1 , 1 }") == 0);
+	assert(strcmp(STR(LIST(1, 2, 3)), "{ 1 , 2, 3 , 1 }") == 0);
+
+	int list[] = LIST(4, 5);
+	assert(sizeof list / sizeof *list == 3 && list[0] == 4 && list[1] == 5 && list[2] == 4);
 }